@@ -0,0 +1,342 @@
+// Replays a recorded raw IRC log through the full message pipeline:
+// IrcMessageHandler -> MessageBuilder -> Channel -> ChannelView (layout+paint).
+//
+// By default, the messages from `recentmessages-nymn.json` are replayed. To
+// replay your own log, point `CHATTERINO_REPLAY_LOG` to a file containing one
+// raw IRC line per line (tags included).
+//
+// The ChannelView is shown, so run this on an offscreen platform:
+//   QT_QPA_PLATFORM=offscreen ./chatterino-benchmark --benchmark_filter=Replay
+//
+// The argument of each benchmark is the replay rate in messages per second
+// (0 = as fast as possible).
+
+#include "common/Literals.hpp"
+#include "controllers/accounts/AccountController.hpp"
+#include "controllers/highlights/HighlightController.hpp"
+#include "controllers/plugins/PluginController.hpp"
+#include "messages/Emote.hpp"
+#include "mocks/BaseApplication.hpp"
+#include "mocks/DisabledStreamerMode.hpp"
+#include "mocks/Emotes.hpp"
+#include "mocks/LinkResolver.hpp"
+#include "mocks/Logging.hpp"
+#include "mocks/TwitchIrcServer.hpp"
+#include "mocks/UserData.hpp"
+#include "providers/bttv/BttvEmotes.hpp"
+#include "providers/chatterino/ChatterinoBadges.hpp"
+#include "providers/ffz/FfzBadges.hpp"
+#include "providers/ffz/FfzEmotes.hpp"
+#include "providers/seventv/SeventvBadges.hpp"
+#include "providers/seventv/SeventvEmotes.hpp"
+#include "providers/twitch/IrcMessageHandler.hpp"
+#include "providers/twitch/TwitchBadges.hpp"
+#include "providers/twitch/TwitchChannel.hpp"
+#include "singletons/WindowManager.hpp"
+#include "widgets/helper/ChannelView.hpp"
+
+#include <benchmark/benchmark.h>
+#include <IrcMessage>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QPixmap>
+#include <QString>
+
+#ifdef Q_OS_WIN
+// clang-format off
+#    include <Windows.h>
+#    include <Psapi.h>
+// clang-format on
+#else
+#    include <sys/resource.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace chatterino;
+using namespace literals;
+
+namespace {
+
+constexpr int VIEW_WIDTH = 400;
+constexpr int VIEW_HEIGHT = 800;
+
+class MockApplication : public mock::BaseApplication
+{
+public:
+    MockApplication()
+        : highlights(this->settings, &this->accounts)
+        , windowManager(this->paths_, this->settings, this->theme, this->fonts)
+#ifdef CHATTERINO_HAVE_PLUGINS
+        , plugins(this->paths_)
+#endif
+    {
+    }
+
+    IEmotes *getEmotes() override
+    {
+        return &this->emotes;
+    }
+
+    IUserDataController *getUserData() override
+    {
+        return &this->userData;
+    }
+
+    AccountController *getAccounts() override
+    {
+        return &this->accounts;
+    }
+
+    ITwitchIrcServer *getTwitch() override
+    {
+        return &this->twitch;
+    }
+
+    ChatterinoBadges *getChatterinoBadges() override
+    {
+        return &this->chatterinoBadges;
+    }
+
+    FfzBadges *getFfzBadges() override
+    {
+        return &this->ffzBadges;
+    }
+
+    SeventvBadges *getSeventvBadges() override
+    {
+        return &this->seventvBadges;
+    }
+
+    HighlightController *getHighlights() override
+    {
+        return &this->highlights;
+    }
+
+    TwitchBadges *getTwitchBadges() override
+    {
+        return &this->twitchBadges;
+    }
+
+    BttvEmotes *getBttvEmotes() override
+    {
+        return &this->bttvEmotes;
+    }
+
+    FfzEmotes *getFfzEmotes() override
+    {
+        return &this->ffzEmotes;
+    }
+
+    SeventvEmotes *getSeventvEmotes() override
+    {
+        return &this->seventvEmotes;
+    }
+
+    IStreamerMode *getStreamerMode() override
+    {
+        return &this->streamerMode;
+    }
+
+    ILinkResolver *getLinkResolver() override
+    {
+        return &this->linkResolver;
+    }
+
+    ILogging *getChatLogger() override
+    {
+        return &this->logging;
+    }
+
+    WindowManager *getWindows() override
+    {
+        return &this->windowManager;
+    }
+
+#ifdef CHATTERINO_HAVE_PLUGINS
+    PluginController *getPlugins() override
+    {
+        return &this->plugins;
+    }
+#endif
+
+    mock::EmptyLogging logging;
+    AccountController accounts;
+    mock::Emotes emotes;
+    mock::UserDataController userData;
+    mock::MockTwitchIrcServer twitch;
+    mock::EmptyLinkResolver linkResolver;
+    ChatterinoBadges chatterinoBadges;
+    FfzBadges ffzBadges;
+    SeventvBadges seventvBadges;
+    HighlightController highlights;
+    TwitchBadges twitchBadges;
+    BttvEmotes bttvEmotes;
+    FfzEmotes ffzEmotes;
+    SeventvEmotes seventvEmotes;
+    DisabledStreamerMode streamerMode;
+    WindowManager windowManager;
+#ifdef CHATTERINO_HAVE_PLUGINS
+    // Live messages are passed to plugins (no plugins are loaded here)
+    PluginController plugins;
+#endif
+};
+
+std::vector<QByteArray> readReplayLog()
+{
+    std::vector<QByteArray> lines;
+
+    auto customLog = qEnvironmentVariable("CHATTERINO_REPLAY_LOG");
+    if (!customLog.isEmpty())
+    {
+        QFile file(customLog);
+        if (!file.open(QFile::ReadOnly))
+        {
+            _exit(1);
+        }
+        while (!file.atEnd())
+        {
+            auto line = file.readLine().trimmed();
+            if (!line.isEmpty())
+            {
+                lines.emplace_back(std::move(line));
+            }
+        }
+        return lines;
+    }
+
+    QFile file(u":/bench/recentmessages-nymn.json"_s);
+    if (!file.open(QFile::ReadOnly))
+    {
+        _exit(1);
+    }
+    auto messages =
+        QJsonDocument::fromJson(file.readAll()).object()["messages"_L1].toArray();
+    lines.reserve(messages.size());
+    for (const auto &message : messages)
+    {
+        lines.emplace_back(message.toString().toUtf8());
+    }
+    return lines;
+}
+
+/// Returns the peak resident set size of this process in bytes
+size_t peakRss()
+{
+#ifdef Q_OS_WIN
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        return counters.PeakWorkingSetSize;
+    }
+    return 0;
+#else
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+#    ifdef Q_OS_MACOS
+    return static_cast<size_t>(usage.ru_maxrss);
+#    else
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#    endif
+#endif
+}
+
+double percentile(std::vector<double> &sorted, double p)
+{
+    if (sorted.empty())
+    {
+        return 0;
+    }
+    auto idx = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1));
+    return sorted[idx];
+}
+
+void BM_ChatReplay(benchmark::State &state)
+{
+    using Clock = std::chrono::steady_clock;
+
+    MockApplication mockApplication;
+    const auto lines = readReplayLog();
+    const auto rate = state.range(0);
+    const auto interval =
+        rate > 0 ? std::chrono::nanoseconds(std::chrono::seconds(1)) / rate
+                 : std::chrono::nanoseconds::zero();
+
+    std::vector<double> latencies;
+    latencies.reserve(lines.size());
+    double busySeconds = 0;
+
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        auto chan = std::make_shared<TwitchChannel>(u"nymn"_s);
+        ChannelView view(nullptr);
+        view.resize(VIEW_WIDTH, VIEW_HEIGHT);
+        view.setChannel(chan);
+        view.show();
+        QPixmap canvas(view.size());
+        state.ResumeTiming();
+
+        auto next = Clock::now();
+        for (const auto &line : lines)
+        {
+            if (rate > 0)
+            {
+                std::this_thread::sleep_until(next);
+                next += interval;
+            }
+
+            auto start = Clock::now();
+
+            auto *ircMessage = Communi::IrcMessage::fromData(line, nullptr);
+            if (ircMessage == nullptr)
+            {
+                continue;
+            }
+            IrcMessageHandler::parseMessageInto(ircMessage, *chan, chan.get());
+            delete ircMessage;
+
+            // Adding a message to a visible view lays it out synchronously,
+            // rendering paints it.
+            view.render(&canvas);
+
+            std::chrono::duration<double> elapsed = Clock::now() - start;
+            latencies.push_back(elapsed.count());
+            busySeconds += elapsed.count();
+        }
+
+        state.PauseTiming();
+        view.hide();
+        QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+        state.ResumeTiming();
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+
+    state.SetItemsProcessed(static_cast<int64_t>(latencies.size()));
+    state.counters["msgs_per_sec"] = benchmark::Counter(
+        busySeconds > 0 ? static_cast<double>(latencies.size()) / busySeconds
+                        : 0);
+    state.counters["p50_us"] = percentile(latencies, 0.50) * 1e6;
+    state.counters["p99_us"] = percentile(latencies, 0.99) * 1e6;
+    state.counters["peak_rss_mb"] =
+        static_cast<double>(peakRss()) / (1024.0 * 1024.0);
+}
+
+}  // namespace
+
+BENCHMARK(BM_ChatReplay)
+    ->ArgName("rate")
+    ->Arg(0)
+    ->Arg(500)
+    ->Iterations(1)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
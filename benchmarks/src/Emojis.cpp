@@ -2,10 +2,72 @@
 
 #include <benchmark/benchmark.h>
 #include <QDebug>
+#include <QFile>
 #include <QString>
+#include <rapidjson/document.h>
+
+#if defined(__GLIBC__) && \
+    (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#    include <malloc.h>
+#    define CHATTERINO_HAVE_MALLINFO2
+#endif
 
 using namespace chatterino;
 
+namespace {
+
+/// Bytes currently allocated on the heap (0 if unknown)
+size_t heapUsage()
+{
+#ifdef CHATTERINO_HAVE_MALLINFO2
+    return mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
+
+}  // namespace
+
+/// Loading all emojis from the generated tables. Their emotes are only
+/// created on lookup. `heapBytes` is the memory retained by the loaded emojis.
+static void BM_EmojisLoad(benchmark::State &state)
+{
+    size_t heapBytes = 0;
+    for (auto _ : state)
+    {
+        auto before = heapUsage();
+        Emojis emojis;
+        emojis.load();
+        heapBytes = heapUsage() - before;
+        benchmark::DoNotOptimize(emojis);
+    }
+    state.counters["heapBytes"] = static_cast<double>(heapBytes);
+}
+
+BENCHMARK(BM_EmojisLoad);
+
+/// Parsing emoji.json, which Emojis::load did before the data was compiled
+/// into tables. Building the EmojiData from the document isn't included.
+static void BM_EmojisJsonParse(benchmark::State &state)
+{
+    QFile file(":/bench/emoji.json");
+    file.open(QFile::ReadOnly);
+    auto data = file.readAll();
+
+    size_t heapBytes = 0;
+    for (auto _ : state)
+    {
+        auto before = heapUsage();
+        rapidjson::Document root;
+        root.Parse(data.constData(), static_cast<size_t>(data.size()));
+        heapBytes = heapUsage() - before;
+        benchmark::DoNotOptimize(root);
+    }
+    state.counters["heapBytes"] = static_cast<double>(heapBytes);
+}
+
+BENCHMARK(BM_EmojisJsonParse);
+
 static void BM_ShortcodeParsing(benchmark::State &state)
 {
     Emojis emojis;
@@ -78,7 +140,7 @@ static void BM_EmojiParsing(benchmark::State &state)
                 break;
             }
         }
-        return emoji->emote;
+        return emojis.getEmote(*emoji);
     };
     auto penguinEmoji = getEmoji("1F427");
     assert(penguinEmoji.get() != nullptr);
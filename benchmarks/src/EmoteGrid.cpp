@@ -0,0 +1,93 @@
+#include "messages/Emote.hpp"
+#include "messages/Image.hpp"
+#include "widgets/helper/EmoteGridLayout.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace chatterino;
+
+namespace {
+
+/// Size of the emote popup at scale 1
+constexpr int VIEW_WIDTH = 300;
+constexpr int VIEW_HEIGHT = 500;
+constexpr int CELL_SIZE = 32;
+constexpr int TEXT_HEIGHT = 24;
+
+/// Splits @a count emotes into sections of 100 emotes (like emote sets)
+std::vector<EmoteGridSection> makeSections(int64_t count)
+{
+    std::vector<EmoteGridSection> sections;
+    for (int64_t i = 0; i < count; i++)
+    {
+        if (i % 100 == 0)
+        {
+            sections.push_back({
+                .title = QString("Set %1").arg(i / 100),
+                .items = {},
+                .emptyText = {},
+            });
+        }
+
+        auto name = QString("emote%1").arg(i);
+        auto url = "https://example.com/" + name;
+        sections.back().items.push_back({
+            .emote = std::make_shared<const Emote>(Emote{
+                .name = {name},
+                .images = ImageSet{Url{url}},
+            }),
+            .name = name,
+            .insertText = name,
+        });
+    }
+    return sections;
+}
+
+}  // namespace
+
+/// Everything the emote popup does until the first paint: building the search
+/// index, laying out all sections and finding the visible rows. The counter
+/// shows how many images are requested for the first paint.
+void BM_EmoteGridOpen(benchmark::State &state)
+{
+    auto sections = makeSections(state.range(0));
+
+    size_t visibleEmotes = 0;
+    for (auto _ : state)
+    {
+        EmoteSearchIndex index(sections);
+        EmoteGridLayout layout;
+        layout.layout(sections, VIEW_WIDTH, CELL_SIZE, TEXT_HEIGHT);
+
+        visibleEmotes = 0;
+        for (const auto &row : layout.rowsIn(0, VIEW_HEIGHT))
+        {
+            visibleEmotes += row.count;
+        }
+        benchmark::DoNotOptimize(index);
+    }
+
+    state.counters["requestedImages"] = static_cast<double>(visibleEmotes);
+}
+
+/// Typing a query character by character
+void BM_EmoteGridSearch(benchmark::State &state)
+{
+    EmoteSearchIndex index(makeSections(state.range(0)));
+    EmoteGridLayout layout;
+
+    for (auto _ : state)
+    {
+        for (const auto *query : {"e", "em", "emo", "emot", "emote1"})
+        {
+            auto result = index.search(query);
+            layout.layout(result, VIEW_WIDTH, CELL_SIZE, TEXT_HEIGHT);
+            benchmark::DoNotOptimize(layout);
+        }
+    }
+}
+
+BENCHMARK(BM_EmoteGridOpen)->Arg(500)->Arg(5000)->Arg(20000);
+BENCHMARK(BM_EmoteGridSearch)->Arg(500)->Arg(5000)->Arg(20000);
@@ -0,0 +1,50 @@
+#include "messages/Emote.hpp"
+#include "providers/seventv/SeventvEmotes.hpp"
+
+#include <benchmark/benchmark.h>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+using namespace chatterino;
+
+namespace {
+
+QByteArray readSeventvEmotes()
+{
+    QFile file(":/bench/seventvemotes-nymn.json");
+    if (!file.open(QFile::ReadOnly))
+    {
+        return {};
+    }
+    return file.readAll();
+}
+
+}  // namespace
+
+/// Parses the response into a QJsonDocument first (like before)
+void BM_SeventvEmotesDom(benchmark::State &state)
+{
+    auto bytes = readSeventvEmotes();
+    for (auto _ : state)
+    {
+        auto json = QJsonDocument::fromJson(bytes).object();
+        auto emotes = seventv::detail::parseEmotes(
+            json["emote_set"].toObject()["emotes"].toArray(), false);
+        benchmark::DoNotOptimize(emotes);
+    }
+}
+
+void BM_SeventvEmotesStream(benchmark::State &state)
+{
+    auto bytes = readSeventvEmotes();
+    for (auto _ : state)
+    {
+        auto emotes = seventv::detail::parseUserEmoteSet(bytes);
+        benchmark::DoNotOptimize(emotes);
+    }
+}
+
+BENCHMARK(BM_SeventvEmotesDom);
+BENCHMARK(BM_SeventvEmotesStream);
@@ -0,0 +1,59 @@
+#include "messages/Image.hpp"
+#include "messages/ImageRegistry.hpp"
+
+#include <benchmark/benchmark.h>
+#include <QString>
+
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+using namespace chatterino;
+
+/// Emote churn over simulated hours of chat. Every simulated minute, messages
+/// use a set of emotes where half of them are new, and the messages of the
+/// last 30 minutes keep their images alive.
+///
+/// `maxEntries` stays bounded by the live images no matter how many hours are
+/// simulated, while `urls` is what a registry without pruning would hold.
+static void BM_ImageRegistryChurn(benchmark::State &state)
+{
+    constexpr int64_t EMOTES_PER_MINUTE = 200;
+    constexpr size_t RETAINED_MINUTES = 30;
+    const auto minutes = state.range(0) * 60;
+
+    auto &registry = ImageRegistry::instance();
+    size_t maxEntries = 0;
+    for (auto _ : state)
+    {
+        std::deque<std::vector<ImagePtr>> recent;
+        for (int64_t minute = 0; minute < minutes; minute++)
+        {
+            std::vector<ImagePtr> images;
+            images.reserve(EMOTES_PER_MINUTE);
+            for (int64_t i = 0; i < EMOTES_PER_MINUTE; i++)
+            {
+                auto id = (minute * EMOTES_PER_MINUTE / 2) + i;
+                images.push_back(Image::fromUrl(
+                    {QString("https://cdn.7tv.app/emote/%1/1x.webp").arg(id)}));
+            }
+
+            recent.push_back(std::move(images));
+            if (recent.size() > RETAINED_MINUTES)
+            {
+                recent.pop_front();
+            }
+            maxEntries = std::max(maxEntries, registry.size());
+        }
+    }
+
+    state.counters["maxEntries"] = static_cast<double>(maxEntries);
+    state.counters["urls"] =
+        static_cast<double>((minutes + 1) * EMOTES_PER_MINUTE / 2);
+}
+
+BENCHMARK(BM_ImageRegistryChurn)
+    ->Arg(1)
+    ->Arg(4)
+    ->Arg(12)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,146 @@
+#include "common/ChatterSet.hpp"
+#include "controllers/completion/sources/EmoteSource.hpp"
+#include "controllers/completion/strategies/ClassicUserStrategy.hpp"
+#include "controllers/completion/strategies/SmartEmoteStrategy.hpp"
+
+#include <benchmark/benchmark.h>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QString>
+
+using namespace chatterino;
+using namespace chatterino::completion;
+
+namespace {
+
+std::vector<EmoteItem> loadEmoteItems()
+{
+    QFile file(":/bench/seventvemotes-nymn.json");
+    if (!file.open(QFile::ReadOnly))
+    {
+        return {};
+    }
+
+    auto emotes = QJsonDocument::fromJson(file.readAll())
+                      .object()["emote_set"]
+                      .toObject()["emotes"]
+                      .toArray();
+
+    // Pretend multiple providers have similar emotes to get 3000+ items
+    std::vector<EmoteItem> items;
+    for (const auto *suffix : {"", "2", "HD", "W"})
+    {
+        for (auto emote : emotes)
+        {
+            auto name = emote.toObject()["name"].toString() + suffix;
+            items.push_back({
+                .emote = nullptr,
+                .searchName = name,
+                .tabCompletionName = name,
+                .displayName = name,
+                .providerName = "Channel 7TV",
+                .isEmoji = false,
+            });
+        }
+    }
+    return items;
+}
+
+void fillChatters(ChatterSet &chatters)
+{
+    for (size_t i = 0; i < ChatterSet::CHATTER_LIMIT; i++)
+    {
+        chatters.addRecentChatter(QString("Chatter%1").arg(i));
+    }
+}
+
+}  // namespace
+
+static void BM_EmoteCompletion_Linear(benchmark::State &state,
+                                      const QString &query)
+{
+    auto items = loadEmoteItems();
+    SmartEmoteStrategy strategy;
+
+    for (auto _ : state)
+    {
+        std::vector<EmoteItem> output;
+        strategy.apply(items, output, query);
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+static void BM_EmoteCompletion_Indexed(benchmark::State &state,
+                                       const QString &query)
+{
+    EmoteItemSet itemSet(loadEmoteItems());
+    SmartEmoteStrategy strategy;
+
+    QStringView normalizedQuery = query;
+    if (normalizedQuery.startsWith(u':'))
+    {
+        normalizedQuery = normalizedQuery.sliced(1);
+    }
+
+    for (auto _ : state)
+    {
+        std::vector<EmoteItem> candidates;
+        itemSet.collectCandidates(normalizedQuery, candidates);
+
+        std::vector<EmoteItem> output;
+        strategy.apply(candidates, output, query);
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+static void BM_EmoteCompletion_BuildIndex(benchmark::State &state)
+{
+    auto items = loadEmoteItems();
+
+    for (auto _ : state)
+    {
+        EmoteItemSet itemSet(items);
+        benchmark::DoNotOptimize(itemSet);
+    }
+}
+
+static void BM_UserCompletion_AllChatters(benchmark::State &state)
+{
+    ChatterSet chatters;
+    fillChatters(chatters);
+    ClassicUserStrategy strategy;
+
+    for (auto _ : state)
+    {
+        std::vector<std::pair<QString, QString>> output;
+        strategy.apply(chatters.all(), output, "chatter12");
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+static void BM_UserCompletion_PrefixIndex(benchmark::State &state)
+{
+    ChatterSet chatters;
+    fillChatters(chatters);
+    ClassicUserStrategy strategy;
+
+    for (auto _ : state)
+    {
+        std::vector<std::pair<QString, QString>> output;
+        strategy.apply(chatters.allWithPrefix("chatter12"), output,
+                       "chatter12");
+        benchmark::DoNotOptimize(output);
+    }
+}
+
+BENCHMARK_CAPTURE(BM_EmoteCompletion_Linear, short, QString("pa"));
+BENCHMARK_CAPTURE(BM_EmoteCompletion_Linear, word, QString("Pag"));
+BENCHMARK_CAPTURE(BM_EmoteCompletion_Linear, long, QString(":peepoHa"));
+BENCHMARK_CAPTURE(BM_EmoteCompletion_Indexed, short, QString("pa"));
+BENCHMARK_CAPTURE(BM_EmoteCompletion_Indexed, word, QString("Pag"));
+BENCHMARK_CAPTURE(BM_EmoteCompletion_Indexed, long, QString(":peepoHa"));
+BENCHMARK(BM_EmoteCompletion_BuildIndex);
+BENCHMARK(BM_UserCompletion_AllChatters);
+BENCHMARK(BM_UserCompletion_PrefixIndex);
@@ -0,0 +1,108 @@
+#include "messages/search/MessageSearchIndex.hpp"
+
+#include "messages/LimitedQueue.hpp"
+#include "messages/Message.hpp"
+#include "messages/search/SubstringPredicate.hpp"
+
+#include <benchmark/benchmark.h>
+#include <QStringList>
+
+#include <memory>
+#include <vector>
+
+using namespace chatterino;
+
+namespace {
+
+const QStringList WORDS{
+    "Kappa", "PogChamp", "forsenE", "monkaS",   "hello",  "chat",  "what",
+    "is",    "going",    "on",      "today",    "stream", "LULW",  "xd",
+    "the",   "game",     "looks",   "really",   "good",   "bad",   "pepeD",
+    "Clap",  "catJAM",   "lol",     "nymnCorn", "based",  "yes",   "true",
+};
+
+LimitedQueue<MessagePtr> makeMessages(size_t count)
+{
+    LimitedQueue<MessagePtr> queue(count);
+    uint32_t seed = 1;
+    for (size_t i = 0; i < count; i++)
+    {
+        auto msg = std::make_shared<Message>();
+        QStringList words;
+        for (int w = 0; w < 8; w++)
+        {
+            // xorshift, deterministic across runs
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            words.append(WORDS[static_cast<qsizetype>(seed % WORDS.size())]);
+        }
+        msg->searchText = QString("user%1 user%1: %2").arg(i % 500).arg(
+            words.join(' '));
+        queue.pushBack(msg);
+    }
+    return queue;
+}
+
+// A rare term: only a few messages of user123 match
+const QString QUERY = "user123:";
+
+}  // namespace
+
+void BM_SearchLinearScan(benchmark::State &state)
+{
+    auto queue = makeMessages(static_cast<size_t>(state.range(0)));
+    auto snapshot = queue.getSnapshot();
+    SubstringPredicate pred(QUERY);
+
+    for (auto _ : state)
+    {
+        size_t matches = 0;
+        for (const auto &msg : snapshot)
+        {
+            if (pred.appliesTo(*msg))
+            {
+                matches++;
+            }
+        }
+        benchmark::DoNotOptimize(matches);
+    }
+}
+
+void BM_SearchIndexed(benchmark::State &state)
+{
+    auto queue = makeMessages(static_cast<size_t>(state.range(0)));
+    MessageSearchIndex index;
+    index.rebuild(queue.getSnapshot());
+    SubstringPredicate pred(QUERY);
+
+    for (auto _ : state)
+    {
+        size_t matches = 0;
+        for (const auto &msg : index.candidates({QUERY}))
+        {
+            if (pred.appliesTo(*msg))
+            {
+                matches++;
+            }
+        }
+        benchmark::DoNotOptimize(matches);
+    }
+}
+
+void BM_SearchIndexBuild(benchmark::State &state)
+{
+    auto queue = makeMessages(static_cast<size_t>(state.range(0)));
+    auto snapshot = queue.getSnapshot();
+
+    for (auto _ : state)
+    {
+        MessageSearchIndex index;
+        index.rebuild(snapshot);
+        benchmark::DoNotOptimize(index.size());
+    }
+}
+
+BENCHMARK(BM_SearchLinearScan)->Arg(10'000)->Arg(100'000);
+BENCHMARK(BM_SearchIndexed)->Arg(10'000)->Arg(100'000);
+BENCHMARK(BM_SearchIndexBuild)->Arg(10'000)->Arg(100'000);
@@ -0,0 +1,161 @@
+// Simulates the requests made while starting up with 50 open channels against
+// a local httpbox (https://github.com/kevinastone/httpbox), which the tests use
+// as well.
+//
+// Every channel makes a few API requests (at the default, high priority) and
+// loads a number of emote images (at normal priority). The benchmark reports
+// how long it took until all API requests finished (`api_ms`) and until all
+// requests finished (`all_ms`).
+//
+// The server defaults to http://127.0.0.1:9051 and can be changed with the
+// CHATTERINO_BENCH_HTTPBIN environment variable.
+
+#include "common/network/NetworkManager.hpp"
+#include "common/network/NetworkRequest.hpp"
+#include "common/network/NetworkResult.hpp"
+
+#include <benchmark/benchmark.h>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QTimer>
+
+#include <memory>
+
+using namespace chatterino;
+
+namespace {
+
+constexpr int CHANNELS = 50;
+constexpr int API_REQUESTS_PER_CHANNEL = 3;
+constexpr int IMAGES_PER_CHANNEL = 20;
+constexpr int IMAGE_SIZE = 4096;
+constexpr int TIMEOUT_MS = 60 * 1000;
+
+QString baseUrl()
+{
+    auto env = qEnvironmentVariable("CHATTERINO_BENCH_HTTPBIN");
+    if (env.isEmpty())
+    {
+        return "http://127.0.0.1:9051";
+    }
+    return env;
+}
+
+bool serverReachable(const QString &base)
+{
+    QEventLoop loop;
+    bool ok = false;
+    NetworkRequest(base + "/status/200")
+        .timeout(2000)
+        .onSuccess([&](const auto &) {
+            ok = true;
+        })
+        .finally([&] {
+            loop.quit();
+        })
+        .execute();
+    loop.exec();
+    return ok;
+}
+
+void BM_NetworkStartup(benchmark::State &state)
+{
+    NetworkManager::init();
+    auto base = baseUrl();
+
+    if (!serverReachable(base))
+    {
+        state.SkipWithError("httpbox isn't reachable");
+        NetworkManager::deinit();
+        return;
+    }
+
+    constexpr int apiTotal = CHANNELS * API_REQUESTS_PER_CHANNEL;
+    constexpr int total = apiTotal + CHANNELS * IMAGES_PER_CHANNEL;
+    double apiMs = 0;
+    double allMs = 0;
+
+    for (auto _ : state)
+    {
+        // Requests might outlive this iteration if it times out
+        struct Progress {
+            QEventLoop loop;
+            QElapsedTimer timer;
+            int apiDone = 0;
+            int allDone = 0;
+            double apiMs = 0;
+            double allMs = 0;
+        };
+        auto progress = std::make_shared<Progress>();
+        auto onDone = [progress](bool api) {
+            auto elapsed = static_cast<double>(progress->timer.elapsed());
+            progress->allDone++;
+            if (api && ++progress->apiDone == apiTotal)
+            {
+                progress->apiMs = elapsed;
+            }
+            if (progress->allDone == total)
+            {
+                progress->allMs = elapsed;
+                progress->loop.quit();
+            }
+        };
+
+        progress->timer.start();
+        for (int channel = 0; channel < CHANNELS; channel++)
+        {
+            // images are requested while the API requests are still running,
+            // like emotes of messages from the recent-messages
+            for (int i = 0; i < IMAGES_PER_CHANNEL; i++)
+            {
+                NetworkRequest(QString("%1/bytes/%2?channel=%3&image=%4")
+                                   .arg(base)
+                                   .arg(IMAGE_SIZE)
+                                   .arg(channel)
+                                   .arg(i))
+                    .priority(NetworkRequestPriority::Normal)
+                    .finally([onDone] {
+                        onDone(false);
+                    })
+                    .execute();
+            }
+            for (int i = 0; i < API_REQUESTS_PER_CHANNEL; i++)
+            {
+                NetworkRequest(QString("%1/get?channel=%2&request=%3")
+                                   .arg(base)
+                                   .arg(channel)
+                                   .arg(i))
+                    .finally([onDone] {
+                        onDone(true);
+                    })
+                    .execute();
+            }
+        }
+
+        QTimer::singleShot(TIMEOUT_MS, &progress->loop,
+                           [loop = &progress->loop] {
+                               loop->quit();
+                           });
+        progress->loop.exec();
+        if (progress->allDone != total)
+        {
+            state.SkipWithError("Timed out waiting for requests");
+            break;
+        }
+        apiMs += progress->apiMs;
+        allMs += progress->allMs;
+    }
+
+    auto iterations = static_cast<double>(state.iterations());
+    if (iterations > 0)
+    {
+        state.counters["api_ms"] = apiMs / iterations;
+        state.counters["all_ms"] = allMs / iterations;
+    }
+
+    NetworkManager::deinit();
+}
+
+}  // namespace
+
+BENCHMARK(BM_NetworkStartup)->Unit(benchmark::kMillisecond)->UseRealTime();
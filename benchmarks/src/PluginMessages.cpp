@@ -0,0 +1,145 @@
+// Measures the overhead of delivering received messages to plugins through the
+// MessagesReceived event.
+//
+// Every iteration simulates one second of a 500 msg/s chat: the messages are
+// queued and delivered after every `n` messages (the argument), simulating how
+// many messages arrive per event loop iteration.
+
+#ifdef CHATTERINO_HAVE_PLUGINS
+#    include "controllers/plugins/Plugin.hpp"
+#    include "controllers/plugins/PluginController.hpp"
+#    include "controllers/plugins/PluginLimits.hpp"
+#    include "messages/Message.hpp"
+#    include "mocks/BaseApplication.hpp"
+#    include "mocks/Channel.hpp"
+
+#    include <benchmark/benchmark.h>
+#    include <QDir>
+#    include <sol/state_view.hpp>
+
+#    include <memory>
+#    include <vector>
+
+using namespace chatterino;
+
+namespace {
+
+constexpr size_t MESSAGES_PER_SECOND = 500;
+
+class MockApplication : public mock::BaseApplication
+{
+public:
+    MockApplication()
+        : plugins(this->paths_)
+    {
+    }
+
+    PluginController *getPlugins() override
+    {
+        return &this->plugins;
+    }
+
+    PluginController plugins;
+};
+
+std::vector<MessagePtr> makeMessages()
+{
+    std::vector<MessagePtr> messages;
+    messages.reserve(MESSAGES_PER_SECOND);
+    for (size_t i = 0; i < MESSAGES_PER_SECOND; i++)
+    {
+        auto msg = std::make_shared<Message>();
+        msg->loginName = "pajlada";
+        msg->displayName = "pajlada";
+        msg->channelName = "forsen";
+        msg->messageText = QString("message number %1 forsenE").arg(i);
+        messages.emplace_back(std::move(msg));
+    }
+    return messages;
+}
+
+}  // namespace
+
+namespace chatterino {
+
+class PluginControllerAccess
+{
+public:
+    /// Adds a plugin running @a script without loading it from disk
+    static void addPlugin(PluginController &controller, const char *script)
+    {
+        auto plugin = std::make_unique<Plugin>(
+            "bench", lua::newLimitedState(), PluginMeta{}, QDir::temp());
+        PluginController::openLibrariesFor(plugin.get());
+        sol::state_view(plugin->state_).script(script);
+        controller.plugins_.insert({"bench", std::move(plugin)});
+    }
+};
+
+}  // namespace chatterino
+
+namespace {
+
+void runMessages(benchmark::State &state, const char *script)
+{
+    MockApplication app;
+    PluginControllerAccess::addPlugin(app.plugins, script);
+
+    auto channel = std::make_shared<mock::MockChannel>("forsen");
+    auto messages = makeMessages();
+    auto perTick = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < messages.size(); i++)
+        {
+            app.plugins.onMessageReceived(channel, messages[i]);
+            if ((i + 1) % perTick == 0)
+            {
+                app.plugins.deliverPendingMessages();
+            }
+        }
+        app.plugins.deliverPendingMessages();
+    }
+    state.SetItemsProcessed(state.iterations() *
+                            static_cast<int64_t>(messages.size()));
+}
+
+void BM_PluginMessagesNoListener(benchmark::State &state)
+{
+    runMessages(state, R"lua(
+        -- a plugin that doesn't listen to messages
+    )lua");
+}
+
+void BM_PluginMessagesCount(benchmark::State &state)
+{
+    runMessages(state, R"lua(
+        local count = 0
+        c2.register_callback(c2.EventType.MessagesReceived, function(ev)
+            count = count + #ev.messages
+        end)
+    )lua");
+}
+
+void BM_PluginMessagesReadText(benchmark::State &state)
+{
+    runMessages(state, R"lua(
+        local matches = 0
+        c2.register_callback(c2.EventType.MessagesReceived, function(ev)
+            for _, msg in ipairs(ev.messages) do
+                if msg:get_text():find("forsenE", 1, true) then
+                    matches = matches + 1
+                end
+            end
+        end)
+    )lua");
+}
+
+}  // namespace
+
+BENCHMARK(BM_PluginMessagesNoListener)->Arg(1)->Arg(8)->Arg(500);
+BENCHMARK(BM_PluginMessagesCount)->Arg(1)->Arg(8)->Arg(500);
+BENCHMARK(BM_PluginMessagesReadText)->Arg(1)->Arg(8)->Arg(500);
+
+#endif
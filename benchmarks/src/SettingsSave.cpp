@@ -0,0 +1,65 @@
+#include "singletons/Settings.hpp"
+#include "util/AsyncFileWriter.hpp"
+
+#include <benchmark/benchmark.h>
+#include <pajlada/settings/setting.hpp>
+
+#include <memory>
+#include <vector>
+
+using namespace chatterino;
+
+namespace {
+
+/// Adds @a count settings to make the settings tree larger
+std::vector<std::unique_ptr<pajlada::Settings::Setting<QString>>> addSettings(
+    int64_t count)
+{
+    std::vector<std::unique_ptr<pajlada::Settings::Setting<QString>>> settings;
+    for (int64_t i = 0; i < count; i++)
+    {
+        auto path = "/benchmark/settings/" + std::to_string(i);
+        settings.emplace_back(
+            std::make_unique<pajlada::Settings::Setting<QString>>(path));
+        settings.back()->setValue(QString("value %1").arg(i));
+    }
+    return settings;
+}
+
+}  // namespace
+
+/// Changing a setting and saving all settings. This is the time spent on the
+/// GUI thread taking a snapshot, settings.json is written on the writer
+/// thread.
+void BM_SettingsFullSave(benchmark::State &state)
+{
+    auto settings = addSettings(state.range(0));
+
+    for (auto _ : state)
+    {
+        getSettings()->showTimestamps = !getSettings()->showTimestamps;
+        getSettings()->requestSave();
+    }
+
+    AsyncFileWriter::instance().waitForIdle();
+}
+
+/// Changing a setting and appending it to the journal. The file is written
+/// on the writer thread, so this is the time spent on the GUI thread.
+void BM_SettingsJournalChange(benchmark::State &state)
+{
+    auto settings = addSettings(state.range(0));
+
+    for (auto _ : state)
+    {
+        getSettings()->showTimestamps = !getSettings()->showTimestamps;
+        getSettings()->writeJournal();
+
+        state.PauseTiming();
+        AsyncFileWriter::instance().waitForIdle();
+        state.ResumeTiming();
+    }
+}
+
+BENCHMARK(BM_SettingsFullSave)->Arg(0)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_SettingsJournalChange)->Arg(0)->Arg(1000)->Arg(10000);
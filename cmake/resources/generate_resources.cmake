@@ -3,6 +3,8 @@ set(RES_DIR "${CMAKE_SOURCE_DIR}/resources")
 set(
         RES_IGNORED_FILES
         .gitignore
+        # compiled into src/providers/emoji/EmojiTableData.cpp
+        emoji.json
         qt.conf
         resources.qrc
         resources_autogenerated.qrc
@@ -18,6 +18,7 @@ c2.LogLevel = {
 ---@enum c2.EventType
 c2.EventType = {
     CompletionRequested = {}, ---@type c2.EventType.CompletionRequested
+    MessagesReceived = {}, ---@type c2.EventType.MessagesReceived
 }
 
 -- End src/controllers/plugins/api/EventType.hpp
@@ -36,6 +37,10 @@ c2.EventType = {
 ---@field cursor_position integer Position of the cursor in the text input in unicode codepoints (not bytes)
 ---@field is_first_word boolean True if this is the first word in the input
 
+---@class MessagesReceivedEvent
+---@field messages c2.Message[] The received messages, oldest first
+---@field dropped integer Number of messages dropped since the last event because the plugin fell behind
+
 -- Begin src/common/Channel.hpp
 
 ---@enum c2.ChannelType
@@ -174,6 +179,64 @@ function c2.Channel.by_twitch_id(id) end
 
 -- End src/controllers/plugins/api/ChannelRef.hpp
 
+-- Begin src/controllers/plugins/api/Message.hpp
+
+--- A read-only view of a received message. Properties are only converted to Lua
+--- values when they're accessed.
+---@class c2.Message
+c2.Message = {}
+
+--- Returns the ID of the message. Empty for messages without an ID.
+---
+---@return string
+function c2.Message:get_id() end
+
+--- Returns the login name of the author.
+---
+---@return string
+function c2.Message:get_login_name() end
+
+--- Returns the display name of the author.
+---
+---@return string
+function c2.Message:get_display_name() end
+
+--- Returns the Twitch user ID of the author.
+---
+---@return string
+function c2.Message:get_user_id() end
+
+--- Returns the text of the message as it was sent.
+---
+---@return string
+function c2.Message:get_text() end
+
+--- Returns the name of the channel the message was sent in.
+---
+---@return string
+function c2.Message:get_channel_name() end
+
+--- Returns the channel the message was received in.
+---
+---@return c2.Channel
+function c2.Message:get_channel() end
+
+--- Returns the time the message was received by the server in
+--- milliseconds since the Unix epoch.
+---
+---@return integer
+function c2.Message:get_timestamp() end
+
+--- Returns true if the message was highlighted.
+---
+---@return boolean
+function c2.Message:is_highlighted() end
+
+---@return string
+function c2.Message:__tostring() end
+
+-- End src/controllers/plugins/api/Message.hpp
+
 -- Begin src/controllers/plugins/api/HTTPResponse.hpp
 
 ---@class c2.HTTPResponse
@@ -314,6 +377,7 @@ function c2.register_command(name, handler) end
 ---
 ---@param type c2.EventType.CompletionRequested
 ---@param func fun(event: CompletionEvent): CompletionList The callback to be invoked.
+---@overload fun(type: c2.EventType.MessagesReceived, func: fun(event: MessagesReceivedEvent))
 function c2.register_callback(type, func) end
 
 --- Writes a message to the Chatterino log.
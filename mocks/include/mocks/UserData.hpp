@@ -2,6 +2,7 @@
 
 #include "controllers/userdata/UserDataController.hpp"
 
+#include <algorithm>
 #include <unordered_map>
 
 namespace chatterino::mock {
@@ -42,8 +43,56 @@ public:
         return this->userDataUpdated_;
     }
 
+    std::optional<UserMetadata> getMetadata(
+        const QString &userID) const override
+    {
+        auto it = this->metadata.find(userID);
+        if (it != this->metadata.end())
+        {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
+    std::optional<UserMetadata> getMetadataByLogin(
+        const QString &login) const override
+    {
+        for (const auto &[id, user] : this->metadata)
+        {
+            if (user.login.compare(login, Qt::CaseInsensitive) == 0)
+            {
+                return user;
+            }
+        }
+        return std::nullopt;
+    }
+
+    void updateMetadata(const UserMetadata &seen) override
+    {
+        auto &user = this->metadata[seen.id];
+        user.id = seen.id;
+        if (!seen.login.isEmpty())
+        {
+            user.login = seen.login;
+        }
+        if (!seen.displayName.isEmpty())
+        {
+            user.displayName = seen.displayName;
+        }
+        if (!seen.profilePictureUrl.isEmpty())
+        {
+            user.profilePictureUrl = seen.profilePictureUrl;
+        }
+        if (seen.color)
+        {
+            user.color = seen.color;
+        }
+        user.lastResolved = std::max(user.lastResolved, seen.lastResolved);
+    }
+
 private:
     std::unordered_map<QString, UserData> userMap;
+    std::unordered_map<QString, UserMetadata> metadata;
     pajlada::Signals::NoArgSignal userDataUpdated_;
 };
 
@@ -0,0 +1,261 @@
+#!/usr/bin/env python3
+"""
+Generates src/providers/emoji/EmojiTableData.cpp from resources/emoji.json.
+
+The tables are described in src/providers/emoji/EmojiTable.hpp.
+This script is run by update-emoji-data.sh.
+"""
+
+import json
+from pathlib import Path
+
+ROOT = Path(__file__).parent.parent
+SOURCE = ROOT / "resources" / "emoji.json"
+OUTPUT = ROOT / "src" / "providers" / "emoji" / "EmojiTableData.cpp"
+
+TONE_NAMES = {
+    "1F3FB": "tone1",
+    "1F3FC": "tone2",
+    "1F3FD": "tone3",
+    "1F3FE": "tone4",
+    "1F3FF": "tone5",
+}
+
+# Matches EmojiData::Capability
+CAPABILITIES = {
+    "has_img_apple": 1 << 0,
+    "has_img_google": 1 << 1,
+    "has_img_twitter": 1 << 2,
+    "has_img_facebook": 1 << 3,
+}
+
+M32 = 0xFFFFFFFF
+
+
+def hash_short_code(name: str, seed: int) -> int:
+    """Must match emojitable::hashShortCode"""
+    h = 2166136261 ^ seed
+    for unit in utf16_units(name):
+        h ^= unit
+        h = (h * 16777619) & M32
+
+    h ^= h >> 16
+    h = (h * 0x85EBCA6B) & M32
+    h ^= h >> 13
+    h = (h * 0xC2B2AE35) & M32
+    h ^= h >> 16
+    return h
+
+
+def utf16_units(text: str) -> list[int]:
+    data = text.encode("utf-16-le")
+    return [int.from_bytes(data[i : i + 2], "little") for i in range(0, len(data), 2)]
+
+
+def from_code(code: str | None) -> str:
+    if not code:
+        return ""
+    return "".join(chr(int(part, 16)) for part in code.split("-"))
+
+
+def u16_literal(text: str) -> str:
+    out = []
+    for c in text:
+        cp = ord(c)
+        if 0x20 <= cp < 0x7F and c not in '"\\':
+            out.append(c)
+        elif cp <= 0xFFFF:
+            out.append(f"\\u{cp:04X}")
+        else:
+            out.append(f"\\U{cp:08X}")
+    return 'u"' + "".join(out) + '"'
+
+
+def make_entry(emoji: dict, short_codes: list[str]) -> dict:
+    capabilities = 0
+    for key, flag in CAPABILITIES.items():
+        if emoji.get(key):
+            capabilities |= flag
+
+    return {
+        "value": from_code(emoji["unified"]),
+        "nonQualified": from_code(emoji.get("non_qualified")),
+        "unifiedCode": emoji["unified"],
+        "nonQualifiedCode": emoji.get("non_qualified") or "",
+        "shortCodes": short_codes,
+        "capabilities": capabilities,
+    }
+
+
+def load_entries() -> list[dict]:
+    with open(SOURCE, encoding="utf-8") as f:
+        emojis = json.load(f)
+
+    entries = []
+    for emoji in emojis:
+        entry = make_entry(emoji, emoji["short_names"])
+        entries.append(entry)
+
+        for tones, variation in emoji.get("skin_variations", {}).items():
+            tone_names = "-".join(
+                TONE_NAMES[tone] for tone in tones.split("-") if tone in TONE_NAMES
+            )
+            name = f"{entry['shortCodes'][0]}_{tone_names}"
+            entries.append(make_entry(variation, [name]))
+    return entries
+
+
+def build_perfect_hash(keys: dict[str, int]) -> tuple[list[int], list[int]]:
+    """
+    Builds a minimal perfect hash (hash and displace) for the keys.
+
+    Returns the seed of every bucket and the value of every slot.
+    """
+    slot_count = len(keys)
+    bucket_count = max(slot_count // 4, 1)
+
+    buckets: list[list[str]] = [[] for _ in range(bucket_count)]
+    for key in keys:
+        buckets[hash_short_code(key, 0) % bucket_count].append(key)
+
+    seeds = [0] * bucket_count
+    slots: list[int | None] = [None] * slot_count
+    order = sorted(range(bucket_count), key=lambda b: len(buckets[b]), reverse=True)
+    for bucket in order:
+        names = buckets[bucket]
+        if not names:
+            continue
+
+        seed = 1
+        while True:
+            targets = [hash_short_code(name, seed) % slot_count for name in names]
+            if len(set(targets)) == len(targets) and all(
+                slots[target] is None for target in targets
+            ):
+                break
+            seed += 1
+
+        seeds[bucket] = seed
+        for name, target in zip(names, targets):
+            slots[target] = keys[name]
+
+    assert all(slot is not None for slot in slots)
+    return seeds, [slot for slot in slots if slot is not None]
+
+
+def main():
+    entries = load_entries()
+
+    short_codes = []  # (name, entry)
+    for index, entry in enumerate(entries):
+        entry["firstShortCode"] = len(short_codes)
+        for name in entry["shortCodes"]:
+            short_codes.append((name, index))
+
+    sorted_short_codes = sorted(
+        range(len(short_codes)), key=lambda i: utf16_units(short_codes[i][0])
+    )
+
+    # Emojis by their first UTF-16 code unit, longest first, otherwise in the
+    # order of the entries
+    first_units = sorted(
+        range(len(entries)),
+        key=lambda i: (
+            utf16_units(entries[i]["value"])[0],
+            -len(utf16_units(entries[i]["value"])),
+            i,
+        ),
+    )
+
+    # Later short codes replace earlier ones
+    unique_short_codes = {}
+    for index, (name, _) in enumerate(short_codes):
+        unique_short_codes[name] = index
+    seeds, slots = build_perfect_hash(unique_short_codes)
+
+    assert len(entries) < 0xFFFF and len(short_codes) < 0xFFFF
+
+    lines = [
+        "// This file is generated by scripts/generate-emoji-table.py from",
+        "// resources/emoji.json. Do not edit it manually.",
+        "",
+        '#include "providers/emoji/EmojiTable.hpp"',
+        "",
+        "#include <iterator>",
+        "",
+        "// clang-format off",
+        "namespace chatterino::emojitable::data {",
+        "",
+        "const Entry ENTRIES[] = {",
+    ]
+    for entry in entries:
+        lines.append(
+            "    {{{}, {}, {}, {}, {}, {}, {}}},".format(
+                u16_literal(entry["value"]),
+                u16_literal(entry["nonQualified"]),
+                u16_literal(entry["unifiedCode"]),
+                u16_literal(entry["nonQualifiedCode"]),
+                entry["firstShortCode"],
+                len(entry["shortCodes"]),
+                entry["capabilities"],
+            )
+        )
+    lines += [
+        "};",
+        "const size_t ENTRY_COUNT = std::size(ENTRIES);",
+        "",
+        "const ShortCode SHORT_CODES[] = {",
+    ]
+    for name, entry in short_codes:
+        lines.append(f"    {{{u16_literal(name)}, {entry}}},")
+    lines += [
+        "};",
+        "const size_t SHORT_CODE_COUNT = std::size(SHORT_CODES);",
+        "",
+        "const uint16_t SORTED_SHORT_CODES[] = {",
+    ]
+    lines += chunked(sorted_short_codes)
+    lines += [
+        "};",
+        "",
+        "const FirstUnit FIRST_UNITS[] = {",
+    ]
+    for index in first_units:
+        unit = utf16_units(entries[index]["value"])[0]
+        lines.append(f"    {{0x{unit:04X}, {index}}},")
+    lines += [
+        "};",
+        "const size_t FIRST_UNIT_COUNT = std::size(FIRST_UNITS);",
+        "",
+        "const uint32_t SHORT_CODE_SEEDS[] = {",
+    ]
+    lines += chunked(seeds)
+    lines += [
+        "};",
+        "const size_t SHORT_CODE_BUCKET_COUNT = std::size(SHORT_CODE_SEEDS);",
+        "",
+        "const uint16_t SHORT_CODE_SLOTS[] = {",
+    ]
+    lines += chunked(slots)
+    lines += [
+        "};",
+        "const size_t SHORT_CODE_SLOT_COUNT = std::size(SHORT_CODE_SLOTS);",
+        "",
+        "}  // namespace chatterino::emojitable::data",
+        "// clang-format on",
+        "",
+    ]
+
+    with open(OUTPUT, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(lines))
+
+
+def chunked(values: list[int], per_line: int = 12) -> list[str]:
+    return [
+        "    " + ", ".join(str(v) for v in values[i : i + per_line]) + ","
+        for i in range(0, len(values), per_line)
+    ]
+
+
+if __name__ == "__main__":
+    main()
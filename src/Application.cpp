@@ -4,6 +4,7 @@
 #include "common/Channel.hpp"
 #include "common/QLogging.hpp"
 #include "common/Version.hpp"
+#include "common/websockets/WebSocketPool.hpp"
 #include "controllers/accounts/AccountController.hpp"
 #include "controllers/commands/Command.hpp"
 #include "controllers/commands/CommandController.hpp"
@@ -29,6 +30,7 @@
 #include "controllers/twitch/LiveController.hpp"
 #include "controllers/userdata/UserDataController.hpp"
 #include "debug/AssertInGuiThread.hpp"
+#include "debug/StartupProfiler.hpp"
 #include "messages/Message.hpp"
 #include "messages/MessageBuilder.hpp"
 #include "providers/bttv/BttvLiveUpdates.hpp"
@@ -95,26 +97,27 @@ ISoundController *makeSoundController(Settings &settings)
     }
 }
 
-BttvLiveUpdates *makeBttvLiveUpdates(Settings &settings)
+BttvLiveUpdates *makeBttvLiveUpdates(Settings &settings, WebSocketPool *pool)
 {
     bool enabled =
         settings.enableBTTVLiveUpdates && settings.enableBTTVChannelEmotes;
 
     if (enabled)
     {
-        return new BttvLiveUpdates(BTTV_LIVE_UPDATES_URL);
+        return new BttvLiveUpdates(BTTV_LIVE_UPDATES_URL, pool);
     }
 
     return nullptr;
 }
 
-SeventvEventAPI *makeSeventvEventAPI(Settings &settings)
+SeventvEventAPI *makeSeventvEventAPI(Settings &settings, WebSocketPool *pool)
 {
     bool enabled = settings.enableSevenTVEventAPI;
 
     if (enabled)
     {
-        return new SeventvEventAPI(SEVENTV_EVENTAPI_URL);
+        return new SeventvEventAPI(SEVENTV_EVENTAPI_URL,
+                                   std::chrono::milliseconds(25000), pool);
     }
 
     return nullptr;
@@ -185,10 +188,13 @@ Application::Application(Settings &_settings, const Paths &paths,
     , twitchBadges(new TwitchBadges)
     , chatterinoBadges(new ChatterinoBadges)
     , bttvEmotes(new BttvEmotes)
-    , bttvLiveUpdates(makeBttvLiveUpdates(_settings))
+    , liveUpdatesPool(new WebSocketPool)
+    , bttvLiveUpdates(
+          makeBttvLiveUpdates(_settings, this->liveUpdatesPool.get()))
     , ffzEmotes(new FfzEmotes)
     , seventvEmotes(new SeventvEmotes)
-    , seventvEventAPI(makeSeventvEventAPI(_settings))
+    , seventvEventAPI(
+          makeSeventvEventAPI(_settings, this->liveUpdatesPool.get()))
     , linkResolver(new LinkResolver)
     , streamerMode(new StreamerMode)
     , twitchUsers(new TwitchUsers)
@@ -233,28 +239,49 @@ void Application::initialize(Settings &settings, const Paths &paths)
         getSettings()->currentVersion.setValue(CHATTERINO_VERSION);
     }
 
-    this->accounts->load();
+    {
+        StartupStep step("Accounts");
+        this->accounts->load();
+    }
 
-    this->windows->initialize();
+    {
+        StartupStep step("Windows");
+        this->windows->initialize();
+    }
 
-    this->ffzBadges->load();
+    {
+        StartupStep step("Global badges and emotes");
+        this->ffzBadges->load();
 
-    // Load global emotes
-    this->bttvEmotes->loadEmotes();
-    this->ffzEmotes->loadEmotes();
-    this->seventvEmotes->loadGlobalEmotes();
+        // Load global emotes
+        this->bttvEmotes->loadEmotes();
+        this->ffzEmotes->loadEmotes();
+        this->seventvEmotes->loadGlobalEmotes();
+    }
 
-    this->twitch->initialize();
+    {
+        StartupStep step("Twitch");
+        this->twitch->initialize();
+    }
 
-    // Load live status
-    this->notifications->initialize();
+    {
+        StartupStep step("Notifications");
+        // Load live status
+        this->notifications->initialize();
+    }
 
-    // XXX: Loading Twitch badges after Helix has been initialized, which only happens after
-    // the AccountController initialize has been called
-    this->twitchBadges->loadTwitchBadges();
+    {
+        StartupStep step("Twitch badges");
+        // XXX: Loading Twitch badges after Helix has been initialized, which only happens after
+        // the AccountController initialize has been called
+        this->twitchBadges->loadTwitchBadges();
+    }
 
 #ifdef CHATTERINO_HAVE_PLUGINS
-    this->plugins->initialize(settings);
+    {
+        StartupStep step("Plugins");
+        this->plugins->initialize(settings);
+    }
 #endif
 
     // Show crash message.
@@ -282,14 +309,17 @@ void Application::initialize(Settings &settings, const Paths &paths)
     }
 #endif
 
-    if (!this->args_.isFramelessEmbed)
     {
-        this->initNm(paths);
-    }
-    this->twitchPubSub->initialize();
+        StartupStep step("Live updates");
+        if (!this->args_.isFramelessEmbed)
+        {
+            this->initNm(paths);
+        }
+        this->twitchPubSub->initialize();
 
-    this->initBttvLiveUpdates();
-    this->initSeventvEventAPI();
+        this->initBttvLiveUpdates();
+        this->initSeventvEventAPI();
+    }
 
     this->streamerMode->start();
 
@@ -300,10 +330,18 @@ int Application::run()
 {
     assert(this->initialized);
 
-    this->twitch->connect();
+    {
+        StartupStep step("Twitch connect");
+        this->twitch->connect();
+    }
 
     if (!this->args_.isFramelessEmbed)
     {
+        StartupStep step("Show main window");
+        if (this->args_.startupProfile)
+        {
+            startup::printOnFirstPaint(&this->windows->getMainWindow());
+        }
         this->windows->getMainWindow().show();
     }
 
@@ -600,6 +638,7 @@ void Application::save()
 {
     this->hotkeys->save();
     this->windows->save();
+    this->userData->save();
 }
 
 void Application::initNm(const Paths &paths)
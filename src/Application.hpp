@@ -48,6 +48,7 @@ class SeventvAPI;
 class CrashHandler;
 class BttvEmotes;
 class BttvLiveUpdates;
+class WebSocketPool;
 class FfzEmotes;
 class SeventvEmotes;
 class SeventvEventAPI;
@@ -171,6 +172,8 @@ private:
     std::unique_ptr<TwitchBadges> twitchBadges;
     std::unique_ptr<ChatterinoBadges> chatterinoBadges;
     std::unique_ptr<BttvEmotes> bttvEmotes;
+    /// Shared by the BTTV and 7TV live updates
+    std::unique_ptr<WebSocketPool> liveUpdatesPool;
     std::unique_ptr<BttvLiveUpdates> bttvLiveUpdates;
     std::unique_ptr<FfzEmotes> ffzEmotes;
     std::unique_ptr<SeventvEmotes> seventvEmotes;
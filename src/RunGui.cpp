@@ -5,11 +5,13 @@
 #include "common/Modes.hpp"
 #include "common/network/NetworkManager.hpp"
 #include "common/QLogging.hpp"
+#include "debug/StartupProfiler.hpp"
 #include "singletons/CrashHandler.hpp"
 #include "singletons/Paths.hpp"
 #include "singletons/Resources.hpp"
 #include "singletons/Settings.hpp"
 #include "singletons/Updates.hpp"
+#include "util/AsyncFileWriter.hpp"
 #include "util/CombinePath.hpp"
 #include "util/SelfCheck.hpp"
 #include "util/UnixSignalHandler.hpp"
@@ -247,8 +249,11 @@ namespace {
 void runGui(QApplication &a, const Paths &paths, Settings &settings,
             const Args &args, Updates &updates)
 {
-    initQt();
-    initResources();
+    {
+        StartupStep step("Resources");
+        initQt();
+        initResources();
+    }
     initSignalHandler();
 
 #ifdef Q_OS_WIN
@@ -289,9 +294,14 @@ void runGui(QApplication &a, const Paths &paths, Settings &settings,
 
         getSettings()->requestSave();
         getSettings()->disableSave();
+
+        // Wait for the settings and window layout to be written
+        AsyncFileWriter::instance().waitForIdle();
     });
 
+    auto appStart = trace::now();
     Application app(settings, paths, args, updates);
+    startup::record("Application", appStart, trace::now() - appStart);
     app.initialize(settings, paths);
     app.run();
 
@@ -117,6 +117,11 @@ Args::Args(const QApplication &app, const Paths &paths)
         "safe-mode", "Starts Chatterino without loading Plugins and always "
                      "show the settings button.");
 
+    QCommandLineOption startupProfileOption(
+        "startup-profile",
+        "Prints the time spent in each startup step once the main window is "
+        "shown.");
+
     QCommandLineOption loginOption(
         "login",
         "Starts Chatterino logged in as the account matching the supplied "
@@ -155,6 +160,7 @@ Args::Args(const QApplication &app, const Paths &paths)
         parentWindowIdOption,
         verboseOption,
         safeModeOption,
+        startupProfileOption,
         loginOption,
         channelLayout,
         activateOption,
@@ -213,6 +219,7 @@ Args::Args(const QApplication &app, const Paths &paths)
     {
         this->safeMode = true;
     }
+    this->startupProfile = parser.isSet(startupProfileOption);
 
     if (parser.isSet(loginOption))
     {
@@ -1,9 +1,11 @@
 #include "common/Channel.hpp"
 
 #include "Application.hpp"
+#include "debug/PerformanceCounters.hpp"
 #include "messages/Message.hpp"
 #include "messages/MessageBuilder.hpp"
 #include "messages/MessageSimilarity.hpp"
+#include "messages/search/MessageSearchIndex.hpp"
 #include "singletons/Logging.hpp"
 #include "singletons/Settings.hpp"
 #include "util/ChannelHelpers.hpp"
@@ -76,11 +78,55 @@ LimitedQueueSnapshot<MessagePtr> Channel::getMessageSnapshot()
     return this->messages_.getSnapshot();
 }
 
+std::vector<MessagePtr> Channel::findSearchCandidates(
+    const QStringList &substrings)
+{
+    if (this->searchIndexUsers_ == 0)
+    {
+        // An index would only be used once
+        auto snapshot = this->messages_.getSnapshot();
+        return {snapshot.begin(), snapshot.end()};
+    }
+
+    if (!this->searchIndex_)
+    {
+        this->searchIndex_ = std::make_unique<MessageSearchIndex>();
+        this->searchIndex_->rebuild(this->messages_.getSnapshot());
+    }
+    else if (!this->searchIndex_->isValid())
+    {
+        this->searchIndex_->rebuild(this->messages_.getSnapshot());
+    }
+
+    return this->searchIndex_->candidates(substrings);
+}
+
+void Channel::retainSearchIndex()
+{
+    this->searchIndexUsers_++;
+}
+
+void Channel::releaseSearchIndex()
+{
+    assert(this->searchIndexUsers_ > 0);
+    this->searchIndexUsers_--;
+    if (this->searchIndexUsers_ == 0)
+    {
+        this->searchIndex_.reset();
+    }
+}
+
 void Channel::addMessage(MessagePtr message, MessageContext context,
                          std::optional<MessageFlags> overridingFlags)
 {
     MessagePtr deleted;
 
+    if (context == MessageContext::Original)
+    {
+        PerformanceCounters::instance().messagesIngested.fetch_add(
+            1, std::memory_order_relaxed);
+    }
+
     if (context == MessageContext::Original && this->getType() != Type::None)
     {
         // Only log original messages
@@ -100,8 +146,16 @@ void Channel::addMessage(MessagePtr message, MessageContext context,
 
     if (this->messages_.pushBack(message, deleted))
     {
+        if (this->searchIndex_)
+        {
+            this->searchIndex_->evictFront();
+        }
         this->messageRemovedFromStart(deleted);
     }
+    if (this->searchIndex_)
+    {
+        this->searchIndex_->append(message);
+    }
 
     this->messageAppended.invoke(message, overridingFlags);
 }
@@ -162,6 +216,10 @@ void Channel::addMessagesAtStart(const std::vector<MessagePtr> &_messages)
 
     if (addedMessages.size() != 0)
     {
+        if (this->searchIndex_)
+        {
+            this->searchIndex_->invalidate();
+        }
         this->messagesAddedAtStart.invoke(addedMessages);
     }
 }
@@ -179,6 +237,10 @@ void Channel::fillInMissingMessages(const std::vector<MessagePtr> &messages)
         // There are no messages in this channel yet so we can just insert them
         // at the front in order
         this->messages_.pushFront(messages);
+        if (this->searchIndex_)
+        {
+            this->searchIndex_->invalidate();
+        }
         this->filledInMessages.invoke(messages);
         return;
     }
@@ -249,6 +311,10 @@ void Channel::fillInMissingMessages(const std::vector<MessagePtr> &messages)
     {
         // We only invoke a signal once at the end of filling all messages to
         // prevent doing any unnecessary repaints.
+        if (this->searchIndex_)
+        {
+            this->searchIndex_->invalidate();
+        }
         this->filledInMessages.invoke(messages);
     }
 }
@@ -260,6 +326,10 @@ void Channel::replaceMessage(const MessagePtr &message,
 
     if (index >= 0)
     {
+        if (this->searchIndex_)
+        {
+            this->searchIndex_->replace((size_t)index, message, replacement);
+        }
         this->messageReplaced.invoke((size_t)index, message, replacement);
     }
 }
@@ -269,6 +339,10 @@ void Channel::replaceMessage(size_t index, const MessagePtr &replacement)
     MessagePtr prev;
     if (this->messages_.replaceItem(index, replacement, &prev))
     {
+        if (this->searchIndex_)
+        {
+            this->searchIndex_->replace(index, prev, replacement);
+        }
         this->messageReplaced.invoke(index, prev, replacement);
     }
 }
@@ -279,6 +353,11 @@ void Channel::replaceMessage(size_t hint, const MessagePtr &message,
     auto index = this->messages_.replaceItem(hint, message, replacement);
     if (index >= 0)
     {
+        if (this->searchIndex_)
+        {
+            this->searchIndex_->replace(static_cast<size_t>(index), message,
+                                        replacement);
+        }
         this->messageReplaced.invoke(hint, message, replacement);
     }
 }
@@ -295,6 +374,10 @@ void Channel::disableMessage(const QString &messageID)
 void Channel::clearMessages()
 {
     this->messages_.clear();
+    if (this->searchIndex_)
+    {
+        this->searchIndex_->clear();
+    }
     this->messagesCleared.invoke();
 }
 
@@ -10,15 +10,18 @@
 #include <pajlada/signals/signal.hpp>
 #include <QDate>
 #include <QString>
+#include <QStringList>
 #include <QTimer>
 
 #include <memory>
 #include <optional>
+#include <vector>
 
 namespace chatterino {
 
 struct Message;
 using MessagePtr = std::shared_ptr<const Message>;
+class MessageSearchIndex;
 
 enum class TimeoutStackStyle : int {
     StackHard = 0,
@@ -120,6 +123,21 @@ public:
 
     bool hasMessages() const;
 
+    /// @brief Returns the messages that might contain all @a substrings
+    ///
+    /// While the search index is retained (see #retainSearchIndex), the first
+    /// call builds a MessageSearchIndex over this channel's messages which is
+    /// kept up to date afterwards. Otherwise, all messages are returned. The
+    /// returned messages still have to be checked against the actual search
+    /// predicates.
+    std::vector<MessagePtr> findSearchCandidates(const QStringList &substrings);
+
+    /// Keeps the search index of this channel while a search is open. Every
+    /// call must be matched by #releaseSearchIndex, the last one frees the
+    /// index.
+    void retainSearchIndex();
+    void releaseSearchIndex();
+
     void applySimilarityFilters(const MessagePtr &message) const final;
 
     MessageSinkTraits sinkTraits() const final;
@@ -152,6 +170,8 @@ protected:
 private:
     const QString name_;
     LimitedQueue<MessagePtr> messages_;
+    std::unique_ptr<MessageSearchIndex> searchIndex_;
+    size_t searchIndexUsers_ = 0;
     Type type_;
     bool anythingLogged_ = false;
     QTimer clearCompletionModelTimer_;
@@ -1,7 +1,9 @@
 #include "common/ChannelChatters.hpp"
 
+#include "Application.hpp"
 #include "common/Channel.hpp"
 #include "controllers/ignores/IgnoreController.hpp"
+#include "controllers/userdata/UserDataController.hpp"
 #include "debug/AssertInGuiThread.hpp"
 #include "messages/MessageBuilder.hpp"
 #include "providers/twitch/TwitchAccount.hpp"
@@ -120,6 +122,13 @@ const QColor ChannelChatters::getUserColor(const QString &user)
 
     if (!chatterColors->exists(lowerUser))
     {
+        // Colors are the same in all channels and kept across restarts
+        auto user = getApp()->getUserData()->getMetadataByLogin(lowerUser);
+        if (user && user->color)
+        {
+            return *user->color;
+        }
+
         // Returns an invalid color so we can decide not to override `textColor`
         return QColor();
     }
@@ -2,6 +2,8 @@
 
 #include "debug/Benchmark.hpp"
 
+#include <algorithm>
+
 namespace chatterino {
 
 ChatterSet::ChatterSet()
@@ -11,7 +13,20 @@ ChatterSet::ChatterSet()
 
 void ChatterSet::addRecentChatter(const QString &userName)
 {
-    this->items.put(userName.toLower(), userName);
+    auto lowerName = userName.toLower();
+
+    // The lru cache will evict its least recently used item
+    if (!this->items.exists(lowerName) &&
+        this->items.size() >= ChatterSet::CHATTER_LIMIT)
+    {
+        this->sortedItems.erase(std::prev(this->items.end())->first);
+    }
+
+    this->items.put(lowerName, userName);
+    this->sortedItems[lowerName] = {
+        .userName = userName,
+        .lastUsed = ++this->useCounter,
+    };
 }
 
 void ChatterSet::updateOnlineChatters(
@@ -37,6 +52,7 @@ void ChatterSet::updateOnlineChatters(
     }
 
     this->items = std::move(tmp);
+    this->rebuildIndex();
 }
 
 bool ChatterSet::contains(const QString &userName) const
@@ -46,15 +62,38 @@ bool ChatterSet::contains(const QString &userName) const
 
 std::vector<QString> ChatterSet::filterByPrefix(const QString &prefix) const
 {
-    QString lowerPrefix = prefix.toLower();
     std::vector<QString> result;
+    for (auto &&item : this->allWithPrefix(prefix))
+    {
+        result.push_back(std::move(item.second));
+    }
+
+    return result;
+}
+
+std::vector<std::pair<QString, QString>> ChatterSet::allWithPrefix(
+    const QString &prefix) const
+{
+    QString lowerPrefix = prefix.toLower();
 
-    for (auto &&item : this->items)
+    std::vector<std::pair<const QString *, const IndexEntry *>> matches;
+    for (auto it = this->sortedItems.lower_bound(lowerPrefix);
+         it != this->sortedItems.end() && it->first.startsWith(lowerPrefix);
+         ++it)
     {
-        if (item.first.startsWith(lowerPrefix))
-        {
-            result.push_back(item.second);
-        }
+        matches.emplace_back(&it->first, &it->second);
+    }
+
+    // Keep the order of the lru cache (most recent first)
+    std::sort(matches.begin(), matches.end(), [](const auto &a, const auto &b) {
+        return a.second->lastUsed > b.second->lastUsed;
+    });
+
+    std::vector<std::pair<QString, QString>> result;
+    result.reserve(matches.size());
+    for (const auto &[lowerName, entry] : matches)
+    {
+        result.emplace_back(*lowerName, entry->userName);
     }
 
     return result;
@@ -65,4 +104,20 @@ std::vector<std::pair<QString, QString>> ChatterSet::all() const
     return {this->items.begin(), this->items.end()};
 }
 
+void ChatterSet::rebuildIndex()
+{
+    this->sortedItems.clear();
+    this->useCounter = 0;
+
+    // The lru cache's items are ordered from most to least recently used
+    for (auto it = this->items.end(); it != this->items.begin();)
+    {
+        --it;
+        this->sortedItems[it->first] = {
+            .userName = it->second,
+            .lastUsed = ++this->useCounter,
+        };
+    }
+}
+
 }  // namespace chatterino
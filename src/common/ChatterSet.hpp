@@ -5,6 +5,8 @@
 #include <lrucache/lrucache.hpp>
 #include <QString>
 
+#include <cstdint>
+#include <map>
 #include <unordered_set>
 #include <vector>
 
@@ -36,13 +38,31 @@ public:
     /// are in mixed case if available.
     std::vector<QString> filterByPrefix(const QString &prefix) const;
 
+    /// Get all recent chatters whose name starts with @a prefix
+    /// (case-insensitive), most recent first. The pair elements are the same
+    /// as in #all().
+    std::vector<std::pair<QString, QString>> allWithPrefix(
+        const QString &prefix) const;
+
     /// Get all recent chatters. The first pair element contains the username
     /// in lowercase, while the second pair element is the original case.
     std::vector<std::pair<QString, QString>> all() const;
 
 private:
+    void rebuildIndex();
+
     // user name in lower case -> user name in normal case
     cache::lru_cache<QString, QString> items;
+
+    struct IndexEntry {
+        QString userName;
+        /// Higher values were used more recently
+        uint64_t lastUsed{};
+    };
+    /// The same chatters as in `items`, sorted by their lowercase name for
+    /// prefix lookups
+    std::map<QString, IndexEntry> sortedItems;
+    uint64_t useCounter{};
 };
 
 using ChatterSet = ChatterSet;
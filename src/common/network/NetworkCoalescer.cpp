@@ -0,0 +1,82 @@
+#include "common/network/NetworkCoalescer.hpp"
+
+#include "common/network/NetworkPrivate.hpp"
+#include "debug/PerformanceCounters.hpp"
+
+namespace chatterino::network::detail {
+
+QByteArray NetworkCoalescer::keyFor(NetworkData &data)
+{
+    if (data.requestType != NetworkRequestType::Get || data.multiPartPayload)
+    {
+        return {};
+    }
+
+    QByteArray key = data.typeString().toUtf8();
+    key.append(' ');
+    key.append(data.request.url().toEncoded());
+    for (const auto &header : data.request.rawHeaderList())
+    {
+        key.append('\n');
+        key.append(header);
+        key.append(':');
+        key.append(data.request.rawHeader(header));
+    }
+    if (data.timeout)
+    {
+        key.append("\ntimeout:");
+        key.append(QByteArray::number(
+            static_cast<qlonglong>(data.timeout->count())));
+    }
+    if (data.cache)
+    {
+        // only cached requests write their result to the cache
+        key.append("\ncache");
+    }
+    key.append("\n\n");
+    key.append(data.payload);
+    return key;
+}
+
+bool NetworkCoalescer::join(const QByteArray &key, const DataPtr &data)
+{
+    std::lock_guard lock(this->mutex_);
+    auto [it, inserted] = this->inFlight_.try_emplace(key);
+    if (inserted)
+    {
+        return false;
+    }
+
+    it->second.push_back(data);
+    PerformanceCounters::instance().httpRequestsCoalesced.fetch_add(
+        1, std::memory_order_relaxed);
+    return true;
+}
+
+std::vector<NetworkCoalescer::DataPtr> NetworkCoalescer::take(
+    const QByteArray &key)
+{
+    std::lock_guard lock(this->mutex_);
+    auto it = this->inFlight_.find(key);
+    if (it == this->inFlight_.end())
+    {
+        return {};
+    }
+    auto followers = std::move(it->second);
+    this->inFlight_.erase(it);
+    return followers;
+}
+
+size_t NetworkCoalescer::size() const
+{
+    std::lock_guard lock(this->mutex_);
+    return this->inFlight_.size();
+}
+
+NetworkCoalescer &NetworkCoalescer::instance()
+{
+    static NetworkCoalescer coalescer;
+    return coalescer;
+}
+
+}  // namespace chatterino::network::detail
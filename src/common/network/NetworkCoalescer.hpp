@@ -0,0 +1,61 @@
+#pragma once
+
+#include <QByteArray>
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace chatterino {
+
+class NetworkData;
+
+}  // namespace chatterino
+
+namespace chatterino::network::detail {
+
+/// @brief Lets identical requests that are in flight at the same time share
+///        one transfer
+///
+/// The first request with a given key is sent (the "leader"). Requests with
+/// the same key that are made before the leader finished are attached to it
+/// and receive a copy of its result instead of being sent themselves.
+///
+/// This is thread-safe.
+class NetworkCoalescer
+{
+public:
+    using DataPtr = std::shared_ptr<NetworkData>;
+
+    /// @brief Returns the key identifying requests that may be coalesced
+    ///
+    /// The key is made up of the method, URL, headers, timeout, caching and
+    /// body. Only GET requests are coalesced - an empty key is returned for
+    /// all other requests.
+    static QByteArray keyFor(NetworkData &data);
+
+    /// @brief Registers a request with @a key
+    ///
+    /// @returns True if an identical request is in flight and @a data was
+    ///          attached to it. False if @a data should be sent - it's now
+    ///          the leader for @a key.
+    bool join(const QByteArray &key, const DataPtr &data);
+
+    /// @brief Removes the in-flight request with @a key
+    ///
+    /// @returns The requests that were attached to it and need to receive its
+    ///          result
+    std::vector<DataPtr> take(const QByteArray &key);
+
+    /// Number of requests currently in flight (leaders only)
+    size_t size() const;
+
+    static NetworkCoalescer &instance();
+
+private:
+    mutable std::mutex mutex_;
+    std::unordered_map<QByteArray, std::vector<DataPtr>> inFlight_;
+};
+
+}  // namespace chatterino::network::detail
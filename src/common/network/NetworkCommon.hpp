@@ -2,6 +2,7 @@
 
 #include <QString>
 
+#include <cstdint>
 #include <functional>
 #include <vector>
 
@@ -14,6 +15,7 @@ class NetworkResult;
 using NetworkSuccessCallback = std::function<void(NetworkResult)>;
 using NetworkErrorCallback = std::function<void(NetworkResult)>;
 using NetworkFinallyCallback = std::function<void()>;
+using NetworkResponseCallback = std::function<void(const NetworkResult &)>;
 
 /**
  * @exposeenum c2.HTTPMethod
@@ -26,6 +28,17 @@ enum class NetworkRequestType {
     Patch,
 };
 
+/// Once a host has reached its connection limit, requests with a higher
+/// priority are started first.
+enum class NetworkRequestPriority : uint8_t {
+    /// API calls (the default)
+    High,
+    /// Images that are visible
+    Normal,
+    /// Requests that aren't needed right away (e.g. prefetching)
+    Low,
+};
+
 // parseHeaderList takes a list of headers in string form,
 // where each header pair is separated by semicolons (;) and the header name and value is divided by a colon (:)
 //
@@ -1,10 +1,12 @@
 #include "common/network/NetworkPrivate.hpp"
 
 #include "Application.hpp"
+#include "common/network/NetworkCoalescer.hpp"
 #include "common/network/NetworkManager.hpp"
 #include "common/network/NetworkResult.hpp"
 #include "common/network/NetworkTask.hpp"
 #include "common/QLogging.hpp"
+#include "debug/Trace.hpp"
 #include "singletons/Paths.hpp"
 #include "util/AbandonObject.hpp"
 #include "util/DebugCount.hpp"
@@ -44,10 +46,17 @@ void runCallback(bool concurrent, auto &&fn)
 
 void loadUncached(std::shared_ptr<NetworkData> &&data)
 {
+    auto key = NetworkCoalescer::keyFor(*data);
+    if (!key.isEmpty() && NetworkCoalescer::instance().join(key, data))
+    {
+        DebugCount::increase("http request coalesced");
+        return;
+    }
+
     DebugCount::increase("http request started");
 
     NetworkRequester requester;
-    auto *worker = new NetworkTask(std::move(data));
+    auto *worker = new NetworkTask(std::move(data), std::move(key));
 
     worker->moveToThread(NetworkManager::workerThread);
 
@@ -131,6 +140,8 @@ void NetworkData::emitSuccess(NetworkResult &&result)
                         return;
                     }
 
+                    CHATTERINO_TRACE("network", "onSuccess");
+
                     QElapsedTimer timer;
                     timer.start();
                     cb(result);
@@ -159,6 +170,7 @@ void NetworkData::emitError(NetworkResult &&result)
                         return;
                     }
 
+                    CHATTERINO_TRACE("network", "onError");
                     cb(result);
                 });
 }
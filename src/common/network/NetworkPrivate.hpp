@@ -44,8 +44,11 @@ public:
     NetworkSuccessCallback onSuccess;
     NetworkErrorCallback onError;
     NetworkFinallyCallback finally;
+    /// Called on the network thread (see NetworkRequest::onResponse)
+    NetworkResponseCallback onResponse;
 
     NetworkRequestType requestType = NetworkRequestType::Get;
+    NetworkRequestPriority priority = NetworkRequestPriority::High;
 
     QByteArray payload;
     std::unique_ptr<QHttpMultiPart, DeleteLater> multiPartPayload;
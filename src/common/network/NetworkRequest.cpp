@@ -40,6 +40,24 @@ NetworkRequest NetworkRequest::type(NetworkRequestType newRequestType) &&
     return std::move(*this);
 }
 
+NetworkRequest NetworkRequest::priority(NetworkRequestPriority priority) &&
+{
+    this->data->priority = priority;
+    switch (priority)
+    {
+        case NetworkRequestPriority::High:
+            this->data->request.setPriority(QNetworkRequest::HighPriority);
+            break;
+        case NetworkRequestPriority::Normal:
+            this->data->request.setPriority(QNetworkRequest::NormalPriority);
+            break;
+        case NetworkRequestPriority::Low:
+            this->data->request.setPriority(QNetworkRequest::LowPriority);
+            break;
+    }
+    return std::move(*this);
+}
+
 NetworkRequest NetworkRequest::caller(const QObject *caller) &&
 {
     if (caller)
@@ -71,6 +89,12 @@ NetworkRequest NetworkRequest::finally(NetworkFinallyCallback cb) &&
     return std::move(*this);
 }
 
+NetworkRequest NetworkRequest::onResponse(NetworkResponseCallback cb) &&
+{
+    this->data->onResponse = std::move(cb);
+    return std::move(*this);
+}
+
 NetworkRequest NetworkRequest::header(const char *headerName,
                                       const char *value) &&
 {
@@ -116,6 +140,15 @@ NetworkRequest NetworkRequest::headerList(
     return std::move(*this);
 }
 
+NetworkRequest NetworkRequest::ifNoneMatch(const QByteArray &etag) &&
+{
+    if (!etag.isEmpty())
+    {
+        this->data->request.setRawHeader("If-None-Match", etag);
+    }
+    return std::move(*this);
+}
+
 NetworkRequest NetworkRequest::timeout(int ms) &&
 {
     this->data->timeout = std::chrono::milliseconds(ms);
@@ -189,6 +222,11 @@ void NetworkRequest::initializeDefaultValues()
                                .toUtf8();
 
     this->data->request.setRawHeader("User-Agent", userAgent);
+    // Qt 6 enables this by default, but we want to multiplex requests to
+    // APIs and CDNs that support HTTP/2 on Qt 5 as well.
+    this->data->request.setAttribute(QNetworkRequest::Http2AllowedAttribute,
+                                     true);
+    this->data->request.setPriority(QNetworkRequest::HighPriority);
 }
 
 NetworkRequest NetworkRequest::json(const QJsonArray &root) &&
@@ -42,10 +42,17 @@ public:
     ~NetworkRequest();
 
     NetworkRequest type(NetworkRequestType newRequestType) &&;
+    /// Sets the order in which queued requests to the same host are started.
+    /// Requests default to NetworkRequestPriority::High.
+    NetworkRequest priority(NetworkRequestPriority priority) &&;
 
     NetworkRequest onError(NetworkErrorCallback cb) &&;
     NetworkRequest onSuccess(NetworkSuccessCallback cb) &&;
     NetworkRequest finally(NetworkFinallyCallback cb) &&;
+    /// Called with every response that was received (successful or not)
+    /// before onSuccess/onError. Unlike the other callbacks, this is called on
+    /// the network thread and isn't called if the request times out.
+    NetworkRequest onResponse(NetworkResponseCallback cb) &&;
 
     NetworkRequest payload(const QByteArray &payload) &&;
     NetworkRequest cache() &&;
@@ -63,6 +70,9 @@ public:
                           const QVariant &value) &&;
     NetworkRequest headerList(
         const std::vector<std::pair<QByteArray, QByteArray>> &headers) &&;
+    /// Sends `If-None-Match` with @a etag unless it's empty. If the resource
+    /// didn't change, the response has the status 304 and no body.
+    NetworkRequest ifNoneMatch(const QByteArray &etag) &&;
     NetworkRequest timeout(int ms) &&;
     NetworkRequest concurrent() &&;
     NetworkRequest multiPart(QHttpMultiPart *payload) &&;
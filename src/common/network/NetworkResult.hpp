@@ -14,8 +14,10 @@ class NetworkResult
 public:
     using NetworkError = QNetworkReply::NetworkError;
 
+    using RawHeaders = QList<QNetworkReply::RawHeaderPair>;
+
     NetworkResult(NetworkError error, const QVariant &httpStatusCode,
-                  QByteArray data);
+                  QByteArray data, RawHeaders headers = {});
 
     /// Parses the result as json and returns the root as an object.
     /// Returns empty object if parsing failed.
@@ -40,12 +42,17 @@ public:
         return this->status_;
     }
 
+    /// Returns the value of the response header @a name (case-insensitive) or
+    /// a null byte array if the response didn't include it.
+    QByteArray rawHeader(QByteArrayView name) const;
+
     /// Formats the error.
     /// If a reply is received, returns the HTTP status otherwise, the network error.
     QString formatError() const;
 
 private:
     QByteArray data_;
+    RawHeaders headers_;
 
     NetworkError error_;
     std::optional<int> status_;
@@ -0,0 +1,103 @@
+#include "common/network/NetworkScheduler.hpp"
+
+#include "debug/PerformanceCounters.hpp"
+
+#include <QUrl>
+
+#include <algorithm>
+#include <cassert>
+
+namespace chatterino::network::detail {
+
+QString NetworkScheduler::hostKey(const QUrl &url)
+{
+    return url.scheme() + u"://" + url.host() + u':' +
+           QString::number(url.port(url.scheme() == u"http" ? 80 : 443));
+}
+
+void NetworkScheduler::schedule(const QString &host,
+                                NetworkRequestPriority priority, StartFn start)
+{
+    auto &entry = this->hosts_[host];
+    if (entry.running < entry.limit)
+    {
+        entry.running++;
+        start();
+        return;
+    }
+
+    entry.queues.at(static_cast<size_t>(priority)).push_back(std::move(start));
+    PerformanceCounters::instance().httpRequestsQueued.fetch_add(
+        1, std::memory_order_relaxed);
+}
+
+void NetworkScheduler::finished(const QString &host, bool usedHttp2)
+{
+    auto it = this->hosts_.find(host);
+    if (it == this->hosts_.end())
+    {
+        assert(false && "finished() called for a host without requests");
+        return;
+    }
+
+    auto &entry = it->second;
+    if (usedHttp2)
+    {
+        entry.limit = std::max(entry.limit, HTTP2_REQUESTS_PER_HOST);
+    }
+    entry.running--;
+
+    while (entry.running < entry.limit)
+    {
+        auto queue = std::ranges::find_if(entry.queues, [](const auto &q) {
+            return !q.empty();
+        });
+        if (queue == entry.queues.end())
+        {
+            break;
+        }
+
+        auto start = std::move(queue->front());
+        queue->pop_front();
+        PerformanceCounters::instance().httpRequestsQueued.fetch_sub(
+            1, std::memory_order_relaxed);
+
+        entry.running++;
+        // this might call finished() again (e.g. if the request fails right
+        // away), which is fine since the state is consistent here
+        start();
+    }
+}
+
+size_t NetworkScheduler::running(const QString &host) const
+{
+    auto it = this->hosts_.find(host);
+    if (it == this->hosts_.end())
+    {
+        return 0;
+    }
+    return it->second.running;
+}
+
+size_t NetworkScheduler::queued(const QString &host) const
+{
+    auto it = this->hosts_.find(host);
+    if (it == this->hosts_.end())
+    {
+        return 0;
+    }
+    size_t n = 0;
+    for (const auto &queue : it->second.queues)
+    {
+        n += queue.size();
+    }
+    return n;
+}
+
+NetworkScheduler &NetworkScheduler::instance()
+{
+    static NetworkScheduler scheduler;
+    return scheduler;
+}
+
+}  // namespace chatterino::network::detail
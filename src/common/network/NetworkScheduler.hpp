@@ -0,0 +1,68 @@
+#pragma once
+
+#include "common/network/NetworkCommon.hpp"
+
+#include <QString>
+
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <unordered_map>
+
+class QUrl;
+
+namespace chatterino::network::detail {
+
+/// @brief Limits the number of concurrent requests per host
+///
+/// Requests are started right away as long as their host is below its limit.
+/// Otherwise, they're queued and started in order of their priority (and in
+/// the order they were scheduled within one priority) once a running request
+/// to that host finishes.
+///
+/// Hosts start with the limit Qt uses for HTTP/1.1 connections. Once a host is
+/// known to speak HTTP/2, its requests are multiplexed over a single
+/// connection, so more of them may run at the same time.
+///
+/// This is not thread-safe. The instance used by NetworkTask lives on the
+/// network worker thread.
+class NetworkScheduler
+{
+public:
+    using StartFn = std::function<void()>;
+
+    /// Qt opens at most this many HTTP/1.1 connections per host
+    static constexpr size_t HTTP1_REQUESTS_PER_HOST = 6;
+    /// Concurrent streams per host once it's known to support HTTP/2
+    static constexpr size_t HTTP2_REQUESTS_PER_HOST = 32;
+
+    /// Returns the key requests to the same host (and port) share
+    static QString hostKey(const QUrl &url);
+
+    /// Calls @a start once a request to @a host may be started
+    void schedule(const QString &host, NetworkRequestPriority priority,
+                  StartFn start);
+
+    /// Marks a request to @a host as finished and starts the next queued one
+    ///
+    /// @param usedHttp2 True if the request was sent using HTTP/2
+    void finished(const QString &host, bool usedHttp2);
+
+    size_t running(const QString &host) const;
+    size_t queued(const QString &host) const;
+
+    /// The scheduler used by NetworkTask (only use it on the worker thread)
+    static NetworkScheduler &instance();
+
+private:
+    struct Host {
+        size_t running = 0;
+        size_t limit = HTTP1_REQUESTS_PER_HOST;
+        std::array<std::deque<StartFn>, 3> queues;
+    };
+
+    std::unordered_map<QString, Host> hosts_;
+};
+
+}  // namespace chatterino::network::detail
@@ -1,10 +1,14 @@
 #include "common/network/NetworkTask.hpp"
 
 #include "Application.hpp"
+#include "common/network/NetworkCoalescer.hpp"
 #include "common/network/NetworkManager.hpp"
 #include "common/network/NetworkPrivate.hpp"
 #include "common/network/NetworkResult.hpp"
+#include "common/network/NetworkScheduler.hpp"
 #include "common/QLogging.hpp"
+#include "debug/PerformanceCounters.hpp"
+#include "debug/Trace.hpp"
 #include "singletons/Paths.hpp"
 #include "util/AbandonObject.hpp"
 #include "util/DebugCount.hpp"
@@ -15,8 +19,10 @@
 
 namespace chatterino::network::detail {
 
-NetworkTask::NetworkTask(std::shared_ptr<NetworkData> &&data)
+NetworkTask::NetworkTask(std::shared_ptr<NetworkData> &&data,
+                         QByteArray coalesceKey)
     : data_(std::move(data))
+    , coalesceKey_(std::move(coalesceKey))
 {
 }
 
@@ -26,10 +32,58 @@ NetworkTask::~NetworkTask()
     {
         this->reply_->deleteLater();
     }
+
+    // The request was cancelled without a result - don't leave the requests
+    // that were waiting for it hanging.
+    if (!this->coalesceKey_.isEmpty())
+    {
+        for (const auto &data :
+             NetworkCoalescer::instance().take(this->coalesceKey_))
+        {
+            data->emitError(
+                {NetworkResult::NetworkError::OperationCanceledError, {}, {}});
+            data->emitFinally();
+        }
+    }
+
+    if (this->started_)
+    {
+        auto &counters = PerformanceCounters::instance();
+        counters.httpRequestsRunning.fetch_sub(1, std::memory_order_relaxed);
+        counters.httpRequestsFinished.fetch_add(1, std::memory_order_relaxed);
+        counters.httpQueueTimeMs.fetch_add(
+            static_cast<uint64_t>(this->queuedMs_), std::memory_order_relaxed);
+        counters.httpRequestTimeMs.fetch_add(
+            static_cast<uint64_t>(this->runningTimer_.elapsed()),
+            std::memory_order_relaxed);
+        if (this->usedHttp2_)
+        {
+            counters.http2RequestsFinished.fetch_add(
+                1, std::memory_order_relaxed);
+        }
+
+        NetworkScheduler::instance().finished(this->host_, this->usedHttp2_);
+    }
 }
 
 void NetworkTask::run()
 {
+    this->queuedTimer_.start();
+    this->host_ = NetworkScheduler::hostKey(this->data_->request.url());
+    NetworkScheduler::instance().schedule(this->host_, this->data_->priority,
+                                          [this] {
+                                              this->start();
+                                          });
+}
+
+void NetworkTask::start()
+{
+    this->started_ = true;
+    this->queuedMs_ = this->queuedTimer_.elapsed();
+    this->runningTimer_.start();
+    PerformanceCounters::instance().httpRequestsRunning.fetch_add(
+        1, std::memory_order_relaxed);
+
     this->reply_ = this->createReply();
     if (!this->reply_)
     {
@@ -123,18 +177,22 @@ void NetworkTask::logReply()
     auto status =
         this->reply_->attribute(QNetworkRequest::HttpStatusCodeAttribute)
             .toInt();
+    auto timing = QStringView(u"(queued %1ms, took %2ms%3)")
+                      .arg(QString::number(this->queuedMs_),
+                           QString::number(this->runningTimer_.elapsed()),
+                           QString(this->usedHttp2_ ? ", HTTP/2" : ""));
     if (this->data_->requestType == NetworkRequestType::Get)
     {
         qCDebug(chatterinoHTTP).noquote()
             << this->data_->typeString() << status
-            << this->data_->request.url().toString();
+            << this->data_->request.url().toString() << timing;
     }
     else
     {
         qCDebug(chatterinoHTTP).noquote()
             << this->data_->typeString()
             << this->data_->request.url().toString() << status
-            << QString(this->data_->payload);
+            << QString(this->data_->payload) << timing;
     }
 }
 
@@ -164,12 +222,17 @@ void NetworkTask::timeout()
         << this->data_->typeString() << "[timed out]"
         << this->data_->request.url().toString();
 
-    this->data_->emitError({NetworkResult::NetworkError::TimeoutError, {}, {}});
-    this->data_->emitFinally();
+    for (const auto &data : this->takeRecipients())
+    {
+        data->emitError({NetworkResult::NetworkError::TimeoutError, {}, {}});
+        data->emitFinally();
+    }
 }
 
 void NetworkTask::finished()
 {
+    CHATTERINO_TRACE("network", "NetworkTask::finished");
+
     AbandonObject guard(this);
 
     if (this->timer_)
@@ -179,6 +242,8 @@ void NetworkTask::finished()
 
     auto *reply = this->reply_;
     auto status = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute);
+    this->usedHttp2_ =
+        reply->attribute(QNetworkRequest::Http2WasUsedAttribute).toBool();
 
     if (reply->error() == QNetworkReply::OperationCanceledError)
     {
@@ -192,8 +257,17 @@ void NetworkTask::finished()
     if (reply->error() != QNetworkReply::NoError)
     {
         this->logReply();
-        this->data_->emitError({reply->error(), status, reply->readAll()});
-        this->data_->emitFinally();
+        NetworkResult result(reply->error(), status, reply->readAll(),
+                             reply->rawHeaderPairs());
+        for (const auto &data : this->takeRecipients())
+        {
+            if (data->onResponse)
+            {
+                data->onResponse(result);
+            }
+            data->emitError(NetworkResult(result));
+            data->emitFinally();
+        }
 
         return;
     }
@@ -207,8 +281,29 @@ void NetworkTask::finished()
 
     DebugCount::increase("http request success");
     this->logReply();
-    this->data_->emitSuccess({reply->error(), status, bytes});
-    this->data_->emitFinally();
+    NetworkResult result(reply->error(), status, bytes,
+                         reply->rawHeaderPairs());
+    for (const auto &data : this->takeRecipients())
+    {
+        if (data->onResponse)
+        {
+            data->onResponse(result);
+        }
+        data->emitSuccess(NetworkResult(result));
+        data->emitFinally();
+    }
+}
+
+std::vector<std::shared_ptr<NetworkData>> NetworkTask::takeRecipients()
+{
+    std::vector<std::shared_ptr<NetworkData>> recipients;
+    if (!this->coalesceKey_.isEmpty())
+    {
+        recipients = NetworkCoalescer::instance().take(this->coalesceKey_);
+        this->coalesceKey_.clear();
+    }
+    recipients.insert(recipients.begin(), this->data_);
+    return recipients;
 }
 
 }  // namespace chatterino::network::detail
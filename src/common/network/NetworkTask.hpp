@@ -1,9 +1,13 @@
 #pragma once
 
+#include <QByteArray>
+#include <QElapsedTimer>
 #include <QObject>
+#include <QString>
 #include <QTimer>
 
 #include <memory>
+#include <vector>
 
 class QNetworkReply;
 
@@ -20,7 +24,11 @@ class NetworkTask : public QObject
     Q_OBJECT
 
 public:
-    NetworkTask(std::shared_ptr<NetworkData> &&data);
+    /// @param coalesceKey If non-empty, the key this request is registered
+    ///                    with in the NetworkCoalescer. The result is passed
+    ///                    to all requests attached to it.
+    NetworkTask(std::shared_ptr<NetworkData> &&data,
+                QByteArray coalesceKey = {});
     ~NetworkTask() override;
 
     NetworkTask(const NetworkTask &) = delete;
@@ -33,15 +41,30 @@ public Q_SLOTS:
     void run();
 
 private:
+    /// Sends the request once the scheduler allows it
+    void start();
     QNetworkReply *createReply();
 
     void logReply();
     void writeToCache(const QByteArray &bytes) const;
 
+    /// Returns this task's request and all requests coalesced with it
+    std::vector<std::shared_ptr<NetworkData>> takeRecipients();
+
     std::shared_ptr<NetworkData> data_;
+    QByteArray coalesceKey_;
     QNetworkReply *reply_{};  // parent: default (accessManager)
     QTimer *timer_{};         // parent: this
 
+    /// Key of the host in the NetworkScheduler
+    QString host_;
+    bool started_ = false;
+    bool usedHttp2_ = false;
+    /// Time since the task was scheduled/started
+    QElapsedTimer queuedTimer_;
+    QElapsedTimer runningTimer_;
+    qint64 queuedMs_ = 0;
+
     // NOLINTNEXTLINE(readability-redundant-access-specifiers)
 private Q_SLOTS:
     void timeout();
@@ -27,8 +27,7 @@ WebSocketPool::~WebSocketPool()
     }
 }
 
-WebSocketHandle WebSocketPool::createSocket(
-    WebSocketOptions options, std::unique_ptr<WebSocketListener> listener)
+bool WebSocketPool::ensureImpl()
 {
     if (!this->impl)
     {
@@ -42,10 +41,16 @@ WebSocketHandle WebSocketPool::createSocket(
             // The user likely runs an incompatible OpenSSL version.
             qCWarning(chatterinoWebsocket)
                 << "Failed to create WebSocket implementation" << err.what();
-            return {{}};
+            return false;
         }
     }
-    if (this->impl->closing)
+    return !this->impl->closing;
+}
+
+WebSocketHandle WebSocketPool::createSocket(
+    WebSocketOptions options, std::unique_ptr<WebSocketListener> listener)
+{
+    if (!this->ensureImpl())
     {
         return {{}};
     }
@@ -82,6 +87,20 @@ WebSocketHandle WebSocketPool::createSocket(
     return {conn};
 }
 
+void WebSocketPool::runAfter(std::chrono::milliseconds delay,
+                             std::function<void()> fn)
+{
+    if (!this->ensureImpl())
+    {
+        return;
+    }
+
+    auto *impl = this->impl.get();
+    boost::asio::post(impl->ioc, [impl, delay, fn{std::move(fn)}]() mutable {
+        impl->runAfter(delay, std::move(fn));
+    });
+}
+
 // MARK: WebSocketHandle
 
 WebSocketHandle::WebSocketHandle(
@@ -3,6 +3,8 @@
 #include <QByteArray>
 #include <QUrl>
 
+#include <chrono>
+#include <functional>
 #include <memory>
 
 namespace chatterino::ws::detail {
@@ -42,6 +44,13 @@ private:
 struct WebSocketListener {
     virtual ~WebSocketListener() = default;
 
+    /// The websocket handshake completed.
+    ///
+    /// This function is called from the websocket thread.
+    virtual void onOpen()
+    {
+    }
+
     /// A text message was received.
     ///
     /// This function is called from the websocket thread.
@@ -52,7 +61,7 @@ struct WebSocketListener {
     /// This function is called from the websocket thread.
     virtual void onBinaryMessage(QByteArray data) = 0;
 
-    /// The websocket was closed.
+    /// The websocket was closed (or the connection attempt failed).
     ///
     /// This function is called from the websocket thread.
     /// @param self The allocated listener (i.e. `self.get() == this`). Be
@@ -75,7 +84,14 @@ public:
     [[nodiscard]] WebSocketHandle createSocket(
         WebSocketOptions options, std::unique_ptr<WebSocketListener> listener);
 
+    /// Runs @a fn on the websocket thread after @a delay.
+    ///
+    /// Callbacks that are still pending when the pool shuts down are dropped.
+    void runAfter(std::chrono::milliseconds delay, std::function<void()> fn);
+
 private:
+    bool ensureImpl();
+
     std::unique_ptr<ws::detail::WebSocketPoolImpl> impl;
 };
 
@@ -12,6 +12,7 @@ WebSocketConnection::WebSocketConnection(
     std::unique_ptr<WebSocketListener> listener, WebSocketPoolImpl *pool,
     boost::asio::io_context &ioc)
     : options(std::move(options))
+    , proxy(QNetworkProxy::applicationProxy())
     , listener(std::move(listener))
     , pool(pool)
     , resolver(boost::asio::make_strand(ioc))
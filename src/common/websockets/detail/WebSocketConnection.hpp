@@ -7,6 +7,7 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/beast/core/flat_buffer.hpp>
 #include <QDebug>
+#include <QNetworkProxy>
 
 #include <deque>
 #include <memory>
@@ -61,6 +62,9 @@ protected:
     void detach();
 
     WebSocketOptions options;
+    /// The application proxy at the time this connection was created. Only
+    /// HTTP proxies are supported.
+    QNetworkProxy proxy;
     // nullable, used for signalling a disconnect
     std::unique_ptr<WebSocketListener> listener;
     // nullable, used for signalling a disconnect
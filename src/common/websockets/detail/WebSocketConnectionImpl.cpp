@@ -5,7 +5,11 @@
 
 #include <boost/asio/strand.hpp>
 #include <boost/beast/core/bind_handler.hpp>
+#include <boost/beast/http/empty_body.hpp>
+#include <boost/beast/http/read.hpp>
+#include <boost/beast/http/write.hpp>
 #include <boost/beast/websocket/ssl.hpp>
+#include <QStringBuilder>
 
 namespace chatterino::ws::detail {
 
@@ -43,8 +47,15 @@ void WebSocketConnectionHelper<Derived, Inner>::run()
         }
     }
 
+    auto port = std::to_string(this->options.url.port(Derived::DEFAULT_PORT));
+    if (this->useProxy())
+    {
+        host = this->proxy.hostName().toStdString();
+        port = std::to_string(this->proxy.port());
+    }
+
     this->resolver.async_resolve(
-        host, std::to_string(this->options.url.port(Derived::DEFAULT_PORT)),
+        host, port,
         beast::bind_front_handler(&WebSocketConnectionHelper::onResolve,
                                   this->shared_from_this()));
 }
@@ -115,11 +126,86 @@ void WebSocketConnectionHelper<Derived, Inner>::onTcpHandshake(
     }
 
     qCDebug(chatterinoWebsocket) << *this << "TCP handshake done";
+    if (this->useProxy())
+    {
+        this->options.url.setPort(
+            this->options.url.port(Derived::DEFAULT_PORT));
+        this->doProxyConnect();
+        return;
+    }
     this->options.url.setPort(ep.port());
 
     this->derived()->afterTcpHandshake();
 }
 
+template <typename Derived, typename Inner>
+bool WebSocketConnectionHelper<Derived, Inner>::useProxy() const
+{
+    return this->proxy.type() == QNetworkProxy::HttpProxy;
+}
+
+template <typename Derived, typename Inner>
+void WebSocketConnectionHelper<Derived, Inner>::doProxyConnect()
+{
+    namespace http = beast::http;
+
+    auto target = this->options.url.host(QUrl::FullyEncoded).toStdString() +
+                  ':' + std::to_string(this->options.url.port());
+    auto req = std::make_shared<http::request<http::empty_body>>(
+        http::verb::connect, target, 11);
+    req->set(http::field::host, target);
+    if (!this->proxy.user().isEmpty())
+    {
+        auto credentials =
+            (this->proxy.user() % u':' % this->proxy.password()).toUtf8();
+        req->set(http::field::proxy_authorization,
+                 "Basic " + credentials.toBase64().toStdString());
+    }
+
+    beast::get_lowest_layer(this->stream)
+        .expires_after(std::chrono::seconds{30});
+    http::async_write(
+        beast::get_lowest_layer(this->stream), *req,
+        [this, req, lifetime{this->shared_from_this()}](
+            boost::system::error_code ec, size_t /*bytesWritten*/) {
+            if (ec)
+            {
+                this->fail(ec, u"proxy CONNECT");
+                return;
+            }
+
+            auto buffer = std::make_shared<beast::flat_buffer>();
+            auto parser =
+                std::make_shared<http::response_parser<http::empty_body>>();
+            // The response to CONNECT doesn't have a body
+            parser->skip(true);
+            http::async_read(
+                beast::get_lowest_layer(this->stream), *buffer, *parser,
+                [this, buffer, parser, lifetime](
+                    boost::system::error_code ec, size_t /*bytesRead*/) {
+                    if (!this->listener || this->isClosing)
+                    {
+                        return;
+                    }
+                    if (!ec && parser->get().result() != http::status::ok)
+                    {
+                        qCWarning(chatterinoWebsocket)
+                            << *this << "Proxy responded with"
+                            << parser->get().result_int();
+                        ec = boost::asio::error::connection_refused;
+                    }
+                    if (ec)
+                    {
+                        this->fail(ec, u"proxy CONNECT");
+                        return;
+                    }
+
+                    qCDebug(chatterinoWebsocket) << *this << "Proxy connected";
+                    this->derived()->afterTcpHandshake();
+                });
+        });
+}
+
 template <typename Derived, typename Inner>
 void WebSocketConnectionHelper<Derived, Inner>::doWsHandshake()
 {
@@ -194,6 +280,7 @@ void WebSocketConnectionHelper<Derived, Inner>::onWsHandshake(
 
     qCDebug(chatterinoWebsocket) << *this << "WS handshake done";
 
+    this->listener->onOpen();
     this->trySend();
     this->stream.async_read(
         this->readBuffer,
@@ -43,6 +43,8 @@ protected:
     void fail(boost::system::error_code ec, QStringView op);
     void doWsHandshake();
 
+    bool useProxy() const;
+
     void closeImpl();
     void trySend();
 
@@ -60,6 +62,8 @@ private:
     void onTcpHandshake(
         boost::system::error_code ec,
         const boost::asio::ip::tcp::resolver::endpoint_type &ep);
+    /// Opens a tunnel to the target host through the HTTP proxy
+    void doProxyConnect();
     void onWsHandshake(boost::system::error_code ec);
 
     void onReadDone(boost::system::error_code ec, size_t bytesRead);
@@ -63,6 +63,13 @@ bool WebSocketPoolImpl::tryShutdown(std::chrono::milliseconds timeout)
     }
 
     this->work.reset();
+    // Pending timers would keep the IO context running
+    boost::asio::post(this->ioc, [this] {
+        for (const auto &timer : this->timers)
+        {
+            timer->cancel();
+        }
+    });
     {
         std::lock_guard g(this->connectionMutex);
         for (const auto &conn : this->connections)
@@ -93,4 +100,24 @@ void WebSocketPoolImpl::removeConnection(WebSocketConnection *conn)
     });
 }
 
+void WebSocketPoolImpl::runAfter(std::chrono::milliseconds delay,
+                                 std::function<void()> fn)
+{
+    if (this->closing)
+    {
+        return;
+    }
+
+    auto timer = std::make_shared<boost::asio::steady_timer>(this->ioc, delay);
+    this->timers.emplace(timer);
+    timer->async_wait(
+        [this, timer, fn{std::move(fn)}](boost::system::error_code ec) {
+            this->timers.erase(timer);
+            if (!ec)
+            {
+                fn();
+            }
+        });
+}
+
 }  // namespace chatterino::ws::detail
@@ -4,11 +4,15 @@
 
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ssl/context.hpp>
+#include <boost/asio/steady_timer.hpp>
 
+#include <atomic>
 #include <chrono>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <thread>
+#include <unordered_set>
 
 namespace chatterino::ws::detail {
 
@@ -27,6 +31,11 @@ public:
 
     void removeConnection(WebSocketConnection *conn);
 
+    /// Runs @a fn after @a delay.
+    ///
+    /// Must be called from the IO thread.
+    void runAfter(std::chrono::milliseconds delay, std::function<void()> fn);
+
     /// Attempts to shut down all connections by gracefully closing them.
     ///
     /// If the connections don't close within `timeout`, `false` is returned and
@@ -42,7 +51,11 @@ public:
     std::vector<std::shared_ptr<WebSocketConnection>> connections;
     std::mutex connectionMutex;
 
-    bool closing = false;
+    /// Pending timers from runAfter (only accessed from the IO thread)
+    std::unordered_set<std::shared_ptr<boost::asio::steady_timer>> timers;
+
+    /// Set by tryShutdown and read from the IO thread (e.g. in runAfter)
+    std::atomic<bool> closing = false;
     int nextID = 1;
 
     OnceFlag shutdownFlag;
@@ -464,6 +464,8 @@ CommandController::CommandController(const Paths &paths)
 
     this->registerCommand("/debug-test", &commands::debugTest);
 
+    this->registerCommand("/debug-trace", &commands::dumpTrace);
+
     this->registerCommand("/shield", &commands::shieldModeOn);
     this->registerCommand("/shieldoff", &commands::shieldModeOff);
 
@@ -6,17 +6,21 @@
 #include "common/Literals.hpp"
 #include "controllers/commands/CommandContext.hpp"
 #include "controllers/notifications/NotificationController.hpp"
+#include "debug/Trace.hpp"
 #include "messages/Image.hpp"
 #include "messages/Message.hpp"
 #include "messages/MessageBuilder.hpp"
 #include "messages/MessageElement.hpp"
 #include "providers/twitch/TwitchChannel.hpp"
 #include "providers/twitch/TwitchIrcServer.hpp"
+#include "singletons/Paths.hpp"
 #include "singletons/Theme.hpp"
 #include "singletons/Toasts.hpp"
 #include "util/PostToThread.hpp"
 
 #include <QApplication>
+#include <QDateTime>
+#include <QDir>
 #include <QLoggingCategory>
 #include <QString>
 
@@ -179,4 +183,59 @@ QString debugTest(const CommandContext &ctx)
     return "";
 }
 
+QString dumpTrace(const CommandContext &ctx)
+{
+    if (!ctx.channel)
+    {
+        return "";
+    }
+
+    if constexpr (!trace::isCompiledIn())
+    {
+        ctx.channel->addSystemMessage(
+            "Tracing is not available in this build. Rebuild Chatterino "
+            "with -DCHATTERINO_TRACING=On to record trace zones.");
+        return "";
+    }
+
+    const auto command = ctx.words.value(1);
+
+    if (command == "clear")
+    {
+        trace::clear();
+        ctx.channel->addSystemMessage(u"Cleared all trace zones."_s);
+        return "";
+    }
+
+    if (!command.isEmpty() && command != "dump")
+    {
+        ctx.channel->addSystemMessage(
+            "Usage: /debug-trace [dump [path] | clear]. Dumps all recorded "
+            "trace zones as Chrome trace JSON (open in chrome://tracing or "
+            "https://ui.perfetto.dev).");
+        return "";
+    }
+
+    auto path = ctx.words.value(2);
+    if (path.isEmpty())
+    {
+        path = QDir(getApp()->getPaths().miscDirectory)
+                   .filePath(u"trace-%1.json"_s.arg(
+                       QDateTime::currentDateTime().toString(
+                           u"yyyyMMdd-HHmmss"_s)));
+    }
+
+    auto result = trace::writeChromeTrace(path);
+    if (!result)
+    {
+        ctx.channel->addSystemMessage(
+            u"Failed to write trace to %1: %2"_s.arg(path, result.error()));
+        return "";
+    }
+
+    ctx.channel->addSystemMessage(
+        u"Wrote %1 trace zones to %2"_s.arg(*result).arg(path));
+    return "";
+}
+
 }  // namespace chatterino::commands
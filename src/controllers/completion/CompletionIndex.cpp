@@ -0,0 +1,99 @@
+#include "controllers/completion/CompletionIndex.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace {
+
+using namespace chatterino::completion;
+
+constexpr qsizetype TRIGRAM_LENGTH = 3;
+
+uint64_t trigramAt(QStringView str, qsizetype i)
+{
+    return (uint64_t{str[i].unicode()} << 32) |
+           (uint64_t{str[i + 1].unicode()} << 16) |
+           uint64_t{str[i + 2].unicode()};
+}
+
+}  // namespace
+
+namespace chatterino::completion {
+
+CompletionIndex::CompletionIndex(const std::vector<QString> &names)
+{
+    this->foldedNames_.reserve(names.size());
+    for (const auto &name : names)
+    {
+        auto position = static_cast<uint32_t>(this->foldedNames_.size());
+        auto folded = name.toCaseFolded();
+
+        for (qsizetype i = 0; i + TRIGRAM_LENGTH <= folded.size(); i++)
+        {
+            auto &positions = this->trigrams_[trigramAt(folded, i)];
+            // Names are added in order, so the lists stay sorted
+            if (positions.empty() || positions.back() != position)
+            {
+                positions.push_back(position);
+            }
+        }
+
+        this->foldedNames_.emplace_back(std::move(folded));
+    }
+}
+
+std::vector<uint32_t> CompletionIndex::findContaining(QStringView query) const
+{
+    auto folded = query.toString().toCaseFolded();
+    std::vector<uint32_t> result;
+
+    if (folded.isEmpty())
+    {
+        result.resize(this->foldedNames_.size());
+        std::iota(result.begin(), result.end(), 0);
+        return result;
+    }
+
+    if (folded.size() < TRIGRAM_LENGTH)
+    {
+        for (uint32_t i = 0; i < this->foldedNames_.size(); i++)
+        {
+            if (this->foldedNames_[i].contains(folded))
+            {
+                result.push_back(i);
+            }
+        }
+        return result;
+    }
+
+    // Start with the shortest posting list and only check its names
+    const std::vector<uint32_t> *shortest = nullptr;
+    for (qsizetype i = 0; i + TRIGRAM_LENGTH <= folded.size(); i++)
+    {
+        auto it = this->trigrams_.find(trigramAt(folded, i));
+        if (it == this->trigrams_.end())
+        {
+            return {};
+        }
+        if (shortest == nullptr || it->second.size() < shortest->size())
+        {
+            shortest = &it->second;
+        }
+    }
+
+    for (auto position : *shortest)
+    {
+        if (this->foldedNames_[position].contains(folded))
+        {
+            result.push_back(position);
+        }
+    }
+    return result;
+}
+
+size_t CompletionIndex::size() const
+{
+    return this->foldedNames_.size();
+}
+
+}  // namespace chatterino::completion
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <QString>
+#include <QStringView>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace chatterino::completion {
+
+/// @brief An immutable substring index over a list of names
+///
+/// Names are case-folded once when the index is built. Queries of at least
+/// three characters are answered through a trigram index, shorter ones by
+/// scanning the folded names.
+class CompletionIndex
+{
+public:
+    CompletionIndex() = default;
+    explicit CompletionIndex(const std::vector<QString> &names);
+
+    /// @brief Returns the positions of all names containing @a query
+    ///        (case-insensitively) in ascending order
+    ///
+    /// An empty query matches all names.
+    std::vector<uint32_t> findContaining(QStringView query) const;
+
+    size_t size() const;
+
+private:
+    using Trigram = uint64_t;
+
+    std::vector<QString> foldedNames_;
+    /// Sorted positions of the names containing each trigram
+    std::unordered_map<Trigram, std::vector<uint32_t>> trigrams_;
+};
+
+}  // namespace chatterino::completion
@@ -12,6 +12,8 @@
 #include "providers/twitch/TwitchIrcServer.hpp"
 #include "singletons/Emotes.hpp"
 
+#include <mutex>
+
 namespace chatterino::completion {
 
 namespace {
@@ -30,15 +32,15 @@ namespace {
         }
     }
 
-    void addEmojis(std::vector<EmoteItem> &out,
-                   const std::vector<EmojiPtr> &map)
+    void addEmojis(std::vector<EmoteItem> &out, const IEmojis &emojis)
     {
-        for (const auto &emoji : map)
+        for (const auto &emoji : emojis.getEmojis())
         {
+            auto emote = emojis.getEmote(*emoji);
             for (auto &&shortCode : emoji->shortCodes)
             {
                 out.push_back(
-                    {.emote = emoji->emote,
+                    {.emote = emote,
                      .searchName = shortCode,
                      .tabCompletionName = QStringLiteral(":%1:").arg(shortCode),
                      .displayName = shortCode,
@@ -48,8 +50,117 @@ namespace {
         };
     }
 
+    struct CachedEmoteSet {
+        std::weak_ptr<const EmoteMap> map;
+        QString providerName;
+        std::shared_ptr<const EmoteItemSet> items;
+    };
+
+    struct CachedEmojiSet {
+        const std::vector<EmojiPtr> *emojis{};
+        size_t size{};
+        std::weak_ptr<EmojiData> first;
+        std::shared_ptr<const EmoteItemSet> items;
+    };
+
+    struct ItemSetCache {
+        std::mutex mutex;
+        std::vector<CachedEmoteSet> emoteSets;
+        CachedEmojiSet emojiSet;
+    };
+
+    ItemSetCache &itemSetCache()
+    {
+        static ItemSetCache cache;
+        return cache;
+    }
+
+    std::shared_ptr<const EmoteItemSet> emoteItemSet(
+        const std::shared_ptr<const EmoteMap> &map, const QString &providerName)
+    {
+        auto &cache = itemSetCache();
+        std::lock_guard lock(cache.mutex);
+
+        std::erase_if(cache.emoteSets, [](const auto &cached) {
+            return cached.map.expired();
+        });
+        for (const auto &cached : cache.emoteSets)
+        {
+            if (cached.map.lock() == map && cached.providerName == providerName)
+            {
+                return cached.items;
+            }
+        }
+
+        std::vector<EmoteItem> items;
+        addEmotes(items, *map, providerName);
+        auto set = std::make_shared<const EmoteItemSet>(std::move(items));
+        cache.emoteSets.push_back({
+            .map = map,
+            .providerName = providerName,
+            .items = set,
+        });
+        return set;
+    }
+
+    std::shared_ptr<const EmoteItemSet> emojiItemSet(const IEmojis &emojis)
+    {
+        auto &cache = itemSetCache();
+        std::lock_guard lock(cache.mutex);
+
+        const auto &all = emojis.getEmojis();
+        auto &cached = cache.emojiSet;
+        auto first = all.empty() ? nullptr : all.front();
+        if (cached.items && cached.emojis == &all &&
+            cached.size == all.size() && cached.first.lock() == first)
+        {
+            return cached.items;
+        }
+
+        std::vector<EmoteItem> items;
+        addEmojis(items, emojis);
+        cached = {
+            .emojis = &all,
+            .size = all.size(),
+            .first = first,
+            .items = std::make_shared<const EmoteItemSet>(std::move(items)),
+        };
+        return cached.items;
+    }
+
+    std::vector<QString> searchNames(const std::vector<EmoteItem> &items)
+    {
+        std::vector<QString> names;
+        names.reserve(items.size());
+        for (const auto &item : items)
+        {
+            names.push_back(item.searchName);
+        }
+        return names;
+    }
+
 }  // namespace
 
+EmoteItemSet::EmoteItemSet(std::vector<EmoteItem> items)
+    : items_(std::move(items))
+    , index_(searchNames(this->items_))
+{
+}
+
+void EmoteItemSet::collectCandidates(QStringView query,
+                                     std::vector<EmoteItem> &out) const
+{
+    for (auto position : this->index_.findContaining(query))
+    {
+        out.push_back(this->items_[position]);
+    }
+}
+
+const std::vector<EmoteItem> &EmoteItemSet::items() const
+{
+    return this->items_;
+}
+
 EmoteSource::EmoteSource(const Channel *channel,
                          std::unique_ptr<EmoteStrategy> strategy,
                          ActionCallback callback)
@@ -62,10 +173,26 @@ EmoteSource::EmoteSource(const Channel *channel,
 void EmoteSource::update(const QString &query)
 {
     this->output_.clear();
-    if (this->strategy_)
+    if (!this->strategy_)
+    {
+        return;
+    }
+
+    // Every strategy only matches emotes containing the query (without a
+    // leading colon), so we only pass those on.
+    QStringView normalizedQuery = query;
+    if (normalizedQuery.startsWith(u':'))
+    {
+        normalizedQuery = normalizedQuery.sliced(1);
+    }
+
+    std::vector<EmoteItem> candidates;
+    for (const auto &itemSet : this->itemSets_)
     {
-        this->strategy_->apply(this->items_, this->output_, query);
+        itemSet->collectCandidates(normalizedQuery, candidates);
     }
+
+    this->strategy_->apply(candidates, this->output_, query);
 }
 
 void EmoteSource::addToListModel(GenericListModel &model, size_t maxCount) const
@@ -90,53 +217,37 @@ void EmoteSource::initializeFromChannel(const Channel *channel)
 {
     auto *app = getApp();
 
-    std::vector<EmoteItem> emotes;
+    auto addEmoteSet = [this](const std::shared_ptr<const EmoteMap> &map,
+                              const QString &providerName) {
+        if (map)
+        {
+            this->itemSets_.push_back(emoteItemSet(map, providerName));
+        }
+    };
+
     const auto *tc = dynamic_cast<const TwitchChannel *>(channel);
     // returns true also for special Twitch channels (/live, /mentions, /whispers, etc.)
     if (channel->isTwitchChannel())
     {
         if (tc)
         {
-            if (auto twitch = tc->localTwitchEmotes())
-            {
-                addEmotes(emotes, *twitch, "Local Twitch Emotes");
-            }
+            addEmoteSet(tc->localTwitchEmotes(), "Local Twitch Emotes");
 
             auto user = getApp()->getAccounts()->twitch.getCurrent();
-            addEmotes(emotes, **user->accessEmotes(), "Twitch Emote");
+            addEmoteSet(*user->accessEmotes(), "Twitch Emote");
 
             // TODO extract "Channel {BetterTTV,7TV,FrankerFaceZ}" text into a #define.
-            if (auto bttv = tc->bttvEmotes())
-            {
-                addEmotes(emotes, *bttv, "Channel BetterTTV");
-            }
-            if (auto ffz = tc->ffzEmotes())
-            {
-                addEmotes(emotes, *ffz, "Channel FrankerFaceZ");
-            }
-            if (auto seventv = tc->seventvEmotes())
-            {
-                addEmotes(emotes, *seventv, "Channel 7TV");
-            }
+            addEmoteSet(tc->bttvEmotes(), "Channel BetterTTV");
+            addEmoteSet(tc->ffzEmotes(), "Channel FrankerFaceZ");
+            addEmoteSet(tc->seventvEmotes(), "Channel 7TV");
         }
 
-        if (auto bttvG = app->getBttvEmotes()->emotes())
-        {
-            addEmotes(emotes, *bttvG, "Global BetterTTV");
-        }
-        if (auto ffzG = app->getFfzEmotes()->emotes())
-        {
-            addEmotes(emotes, *ffzG, "Global FrankerFaceZ");
-        }
-        if (auto seventvG = app->getSeventvEmotes()->globalEmotes())
-        {
-            addEmotes(emotes, *seventvG, "Global 7TV");
-        }
+        addEmoteSet(app->getBttvEmotes()->emotes(), "Global BetterTTV");
+        addEmoteSet(app->getFfzEmotes()->emotes(), "Global FrankerFaceZ");
+        addEmoteSet(app->getSeventvEmotes()->globalEmotes(), "Global 7TV");
     }
 
-    addEmojis(emotes, app->getEmotes()->getEmojis()->getEmojis());
-
-    this->items_ = std::move(emotes);
+    this->itemSets_.push_back(emojiItemSet(*app->getEmotes()->getEmojis()));
 }
 
 const std::vector<EmoteItem> &EmoteSource::output() const
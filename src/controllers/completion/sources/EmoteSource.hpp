@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common/Channel.hpp"
+#include "controllers/completion/CompletionIndex.hpp"
 #include "controllers/completion/sources/Source.hpp"
 #include "controllers/completion/strategies/Strategy.hpp"
 #include "messages/Emote.hpp"
@@ -28,6 +29,28 @@ struct EmoteItem {
     bool isEmoji{};
 };
 
+/// The completion items of a single emote provider (or the emojis) with an
+/// index over their search names.
+///
+/// Sets are cached as long as the provider's emote map is alive, so they're
+/// only rebuilt when the provider's emotes change.
+class EmoteItemSet
+{
+public:
+    explicit EmoteItemSet(std::vector<EmoteItem> items);
+
+    /// Appends all items whose search name contains @a query
+    /// (case-insensitively) to @a out, keeping their order.
+    void collectCandidates(QStringView query,
+                           std::vector<EmoteItem> &out) const;
+
+    const std::vector<EmoteItem> &items() const;
+
+private:
+    std::vector<EmoteItem> items_;
+    CompletionIndex index_;
+};
+
 class EmoteSource : public Source
 {
 public:
@@ -56,7 +79,7 @@ private:
     std::unique_ptr<EmoteStrategy> strategy_;
     ActionCallback callback_;
 
-    std::vector<EmoteItem> items_{};
+    std::vector<std::shared_ptr<const EmoteItemSet>> itemSets_{};
     std::vector<EmoteItem> output_{};
 };
 
@@ -10,11 +10,11 @@ namespace chatterino::completion {
 UserSource::UserSource(const Channel *channel,
                        std::unique_ptr<UserStrategy> strategy,
                        ActionCallback callback, bool prependAt)
-    : strategy_(std::move(strategy))
+    : channel_(dynamic_cast<const TwitchChannel *>(channel))
+    , strategy_(std::move(strategy))
     , callback_(std::move(callback))
     , prependAt_(prependAt)
 {
-    this->initializeFromChannel(channel);
 }
 
 void UserSource::update(const QString &query)
@@ -22,7 +22,11 @@ void UserSource::update(const QString &query)
     this->output_.clear();
     if (this->strategy_)
     {
-        this->strategy_->apply(this->items_, this->output_, query);
+        // User completion is always by prefix, so chatters not starting with
+        // the query don't need to be copied.
+        auto prefix = query.startsWith('@') ? query.mid(1) : query;
+        this->strategy_->apply(this->itemsWithPrefix(prefix), this->output_,
+                               query);
     }
 }
 
@@ -50,28 +54,31 @@ void UserSource::addToStringList(QStringList &list, size_t maxCount,
                        });
 }
 
-void UserSource::initializeFromChannel(const Channel *channel)
+std::vector<UserItem> UserSource::itemsWithPrefix(const QString &prefix) const
 {
-    const auto *tc = dynamic_cast<const TwitchChannel *>(channel);
+    const auto *tc = this->channel_;
     if (!tc)
     {
-        return;
+        return {};
     }
 
-    this->items_ = tc->accessChatters()->all();
+    auto items = tc->accessChatters()->allWithPrefix(prefix);
 
-    if (getSettings()->alwaysIncludeBroadcasterInUserCompletions)
+    if (getSettings()->alwaysIncludeBroadcasterInUserCompletions &&
+        tc->getName().startsWith(prefix, Qt::CaseInsensitive))
     {
-        auto it = std::find_if(this->items_.begin(), this->items_.end(),
+        auto it = std::find_if(items.begin(), items.end(),
                                [tc](const UserItem &user) {
                                    return user.first == tc->getName();
                                });
 
-        if (it == this->items_.end())
+        if (it == items.end())
         {
-            this->items_.emplace_back(tc->getName(), tc->getDisplayName());
+            items.emplace_back(tc->getName(), tc->getDisplayName());
         }
     }
+
+    return items;
 }
 
 const std::vector<UserItem> &UserSource::output() const
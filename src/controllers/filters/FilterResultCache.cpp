@@ -0,0 +1,106 @@
+#include "controllers/filters/FilterResultCache.hpp"
+
+#include "Application.hpp"
+#include "common/Channel.hpp"
+#include "controllers/filters/FilterRecord.hpp"
+#include "controllers/filters/lang/Filter.hpp"
+#include "debug/AssertInGuiThread.hpp"
+#include "debug/PerformanceCounters.hpp"
+#include "messages/Message.hpp"
+#include "providers/twitch/TwitchChannel.hpp"
+#include "providers/twitch/TwitchIrcServer.hpp"
+
+namespace chatterino {
+
+FilterResultCache &FilterResultCache::instance()
+{
+    static FilterResultCache cache;
+    return cache;
+}
+
+bool FilterResultCache::filter(const FilterRecordPtr &record,
+                               const MessagePtr &message, Channel *channel)
+{
+    assertInGuiThread();
+
+    auto &counters = PerformanceCounters::instance();
+    counters.filterEvaluationsRequested++;
+
+    // Same as channel.live in filters::buildContextMap
+    auto *tc = dynamic_cast<TwitchChannel *>(channel);
+    bool live = tc != nullptr && !channel->isEmpty() && tc->isLive();
+
+    auto watching = getApp()->getTwitch()->getWatchingChannel().get();
+
+    Key key{
+        .message = message.get(),
+        .flags = static_cast<MessageFlags::Int>(message->flags.value()),
+        .live = live,
+        .watching = watching->getName(),
+        .record = record.get(),
+    };
+    Entry entry{
+        .message = message,
+        .record = record,
+    };
+
+    auto it = this->results_.find(key);
+    if (it != this->results_.end())
+    {
+        // A destroyed message or filter might have had the same address
+        if (!it->message.expired() && !it->record.expired())
+        {
+            return it->result;
+        }
+
+        entry.result = record->filter(this->contextFor(key, message, channel));
+        counters.filterEvaluations++;
+        *it = entry;
+        return entry.result;
+    }
+
+    entry.result = record->filter(this->contextFor(key, message, channel));
+    counters.filterEvaluations++;
+
+    while (this->order_.size() >= CAPACITY)
+    {
+        this->results_.remove(this->order_.front());
+        this->order_.pop_front();
+    }
+    this->results_.insert(key, entry);
+    this->order_.push_back(key);
+
+    return entry.result;
+}
+
+const filters::ContextMap &FilterResultCache::contextFor(
+    const Key &key, const MessagePtr &message, Channel *channel)
+{
+    auto contextKey = key;
+    contextKey.record = nullptr;
+
+    if (this->lastContextKey_ != contextKey ||
+        this->lastContextMessage_.lock() != message)
+    {
+        this->lastContext_ = filters::buildContextMap(message, channel);
+        this->lastContextKey_ = contextKey;
+        this->lastContextMessage_ = message;
+    }
+    return this->lastContext_;
+}
+
+size_t FilterResultCache::size() const
+{
+    return static_cast<size_t>(this->results_.size());
+}
+
+void FilterResultCache::clear()
+{
+    this->results_.clear();
+    this->order_.clear();
+    this->lastContextKey_.reset();
+    this->lastContextMessage_.reset();
+    this->lastContext_.clear();
+}
+
+}  // namespace chatterino
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "controllers/filters/lang/Types.hpp"
+#include "messages/MessageFlag.hpp"
+
+#include <QHash>
+#include <QString>
+
+#include <deque>
+#include <memory>
+#include <optional>
+
+namespace chatterino {
+
+class Channel;
+class FilterRecord;
+struct Message;
+using FilterRecordPtr = std::shared_ptr<FilterRecord>;
+using MessagePtr = std::shared_ptr<const Message>;
+
+/// @brief Shares the results of filters between all views showing a message
+///
+/// A message is usually shown in more than one view (e.g. in every split of
+/// its channel and in /mentions) and every view used to build the context of
+/// the message and run its filters by itself. This cache remembers the result
+/// of each filter for recently seen messages, so a filter runs once per
+/// message no matter how many views use it.
+///
+/// Results are keyed by everything the context of a message depends on: the
+/// message and its current flags, whether the channel is live and which
+/// channel is being watched. The cache must only be used from the GUI thread.
+class FilterResultCache
+{
+public:
+    /// Maximum number of cached results - the oldest ones are dropped first
+    static constexpr size_t CAPACITY = 4096;
+
+    static FilterResultCache &instance();
+
+    /// Returns the result of @a record for @a message in @a channel,
+    /// running the filter only if no result is cached
+    bool filter(const FilterRecordPtr &record, const MessagePtr &message,
+                Channel *channel);
+
+    size_t size() const;
+    void clear();
+
+private:
+    struct Key {
+        const Message *message = nullptr;
+        MessageFlags::Int flags = 0;
+        bool live = false;
+        QString watching;
+        const FilterRecord *record = nullptr;
+
+        bool operator==(const Key &other) const = default;
+
+        friend size_t qHash(const Key &key, size_t seed = 0)
+        {
+            return qHashMulti(seed, key.message, key.flags, key.live,
+                              key.watching, key.record);
+        }
+    };
+
+    struct Entry {
+        /// Used to detect reused addresses of destroyed messages/filters
+        std::weak_ptr<const Message> message;
+        std::weak_ptr<FilterRecord> record;
+        bool result = false;
+    };
+
+    const filters::ContextMap &contextFor(const Key &key,
+                                          const MessagePtr &message,
+                                          Channel *channel);
+
+    QHash<Key, Entry> results_;
+    /// Keys of results_ in insertion order
+    std::deque<Key> order_;
+
+    /// The context of the last evaluated message, built on demand
+    std::optional<Key> lastContextKey_;
+    std::weak_ptr<const Message> lastContextMessage_;
+    filters::ContextMap lastContext_;
+};
+
+}  // namespace chatterino
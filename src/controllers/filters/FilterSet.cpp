@@ -1,6 +1,8 @@
 #include "controllers/filters/FilterSet.hpp"
 
 #include "controllers/filters/FilterRecord.hpp"
+#include "controllers/filters/FilterResultCache.hpp"
+#include "debug/Trace.hpp"
 #include "singletons/Settings.hpp"
 
 namespace chatterino {
@@ -42,10 +44,12 @@ bool FilterSet::filter(const MessagePtr &m, ChannelPtr channel) const
         return true;
     }
 
-    filters::ContextMap context = filters::buildContextMap(m, channel.get());
+    CHATTERINO_TRACE("filters", "FilterSet::filter");
+
+    auto &cache = FilterResultCache::instance();
     for (const auto &f : this->filters_.values())
     {
-        if (!f->valid() || !f->filter(context))
+        if (!f->valid() || !cache.filter(f, m, channel.get()))
         {
             return false;
         }
@@ -181,6 +181,7 @@ inline const std::map<HotkeyCategory, ActionDefinitionMap> actionNames{
          {"showSearch", ActionDefinition{"Search current channel"}},
          {"showGlobalSearch", ActionDefinition{"Search all channels"}},
          {"debug", ActionDefinition{"Show debug popup"}},
+         {"performance", ActionDefinition{"Show performance popup"}},
          {"popupOverlay", ActionDefinition{"New overlay popup"}},
          {"toggleOverlayInertia",
           ActionDefinition{
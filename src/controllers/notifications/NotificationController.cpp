@@ -7,6 +7,7 @@
 #include "messages/Message.hpp"
 #include "messages/MessageBuilder.hpp"
 #include "providers/twitch/api/Helix.hpp"
+#include "providers/twitch/api/HelixScheduler.hpp"
 #include "providers/twitch/TwitchIrcServer.hpp"
 #include "singletons/Settings.hpp"
 #include "singletons/StreamerMode.hpp"
@@ -190,42 +191,37 @@ void NotificationController::fetchFakeChannels()
         }
     }
 
-    for (const auto &batch : splitListIntoBatches(channels))
-    {
-        getHelix()->fetchStreams(
-            {}, batch,
-            [batch, this](const auto &streams) {
-                std::map<QString, std::optional<HelixStream>,
-                         QCompareCaseInsensitive>
-                    liveStreams;
-                for (const auto &stream : streams)
+    HelixScheduler::instance().fetchStreamsByLogin(
+        channels,
+        [channels, this](const auto &streams) {
+            std::map<QString, std::optional<HelixStream>,
+                     QCompareCaseInsensitive>
+                liveStreams;
+            for (const auto &stream : streams)
+            {
+                liveStreams.emplace(stream.userLogin, stream);
+            }
+
+            for (const auto &name : channels)
+            {
+                auto it = liveStreams.find(name);
+                if (it == liveStreams.end())
                 {
-                    liveStreams.emplace(stream.userLogin, stream);
+                    this->updateFakeChannel(name, std::nullopt);
                 }
-
-                for (const auto &name : batch)
+                else
                 {
-                    auto it = liveStreams.find(name);
-                    if (it == liveStreams.end())
-                    {
-                        this->updateFakeChannel(name, std::nullopt);
-                    }
-                    else
-                    {
-                        this->updateFakeChannel(name, it->second);
-                    }
+                    this->updateFakeChannel(name, it->second);
                 }
-            },
-            [batch]() {
-                // we done fucked up.
-                qCWarning(chatterinoNotification)
-                    << "Failed to fetch live status for " << batch;
-            },
-            []() {
-                // finally
-            });
-    }
+            }
+        },
+        [channels]() {
+            // we done fucked up.
+            qCWarning(chatterinoNotification)
+                << "Failed to fetch live status for " << channels;
+        });
 }
+
 void NotificationController::updateFakeChannel(
     const QString &channelName, const std::optional<HelixStream> &stream)
 {
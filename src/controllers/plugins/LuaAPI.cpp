@@ -5,6 +5,7 @@
 #    include "common/QLogging.hpp"
 #    include "controllers/plugins/LuaUtilities.hpp"
 #    include "controllers/plugins/PluginController.hpp"
+#    include "controllers/plugins/PluginLimits.hpp"
 #    include "controllers/plugins/SolTypes.hpp"  // for lua operations on QString{,List} for CompletionList
 
 #    include <lauxlib.h>
@@ -90,6 +91,20 @@ sol::table toTable(lua_State *L, const CompletionEvent &ev)
     );
 }
 
+sol::table toTable(lua_State *L, const MessagesReceivedEvent &ev)
+{
+    sol::state_view lua(L);
+    auto messages = lua.create_table(static_cast<int>(ev.messages.size()));
+    for (size_t i = 0; i < ev.messages.size(); i++)
+    {
+        messages[i + 1] = ev.messages[i];
+    }
+    return lua.create_table_with(
+        "messages", messages,  //
+        "dropped", ev.dropped  //
+    );
+}
+
 void c2_register_callback(ThisPluginState L, EventType evtType,
                           sol::protected_function callback)
 {
@@ -131,6 +146,7 @@ void c2_later(ThisPluginState L, sol::protected_function callback, int time)
         [pl = L.plugin(), name, timer, cb, thread, main]() {
             timer->deleteLater();
             pl->removeTimeout(timer);
+            lua::ExecutionBudget budget(pl, "c2.later");
             sol::protected_function_result res = cb();
 
             if (res.return_count() != 0)
@@ -2,6 +2,7 @@
 
 #ifdef CHATTERINO_HAVE_PLUGINS
 #    include "controllers/plugins/api/ChannelRef.hpp"
+#    include "controllers/plugins/api/Message.hpp"
 #    include "controllers/plugins/Plugin.hpp"
 #    include "controllers/plugins/SolTypes.hpp"
 
@@ -12,6 +13,7 @@
 
 #    include <cassert>
 #    include <memory>
+#    include <vector>
 
 struct lua_State;
 namespace chatterino::lua::api {
@@ -80,9 +82,26 @@ struct CompletionEvent {
 
 sol::table toTable(lua_State *L, const CompletionEvent &ev);
 
+/**
+ * @lua@class MessagesReceivedEvent
+ */
+struct MessagesReceivedEvent {
+    /**
+     * @lua@field messages c2.Message[] The received messages, oldest first
+     */
+    std::vector<MessageView> messages;
+    /**
+     * @lua@field dropped integer Number of messages dropped since the last event because the plugin fell behind
+     */
+    size_t dropped{};
+};
+
+sol::table toTable(lua_State *L, const MessagesReceivedEvent &ev);
+
 /**
  * @includefile common/Channel.hpp
  * @includefile controllers/plugins/api/ChannelRef.hpp
+ * @includefile controllers/plugins/api/Message.hpp
  * @includefile controllers/plugins/api/HTTPResponse.hpp
  * @includefile controllers/plugins/api/HTTPRequest.hpp
  * @includefile controllers/plugins/api/WebSocket.hpp
@@ -103,6 +122,7 @@ sol::table toTable(lua_State *L, const CompletionEvent &ev);
  *
  * @lua@param type c2.EventType.CompletionRequested
  * @lua@param func fun(event: CompletionEvent): CompletionList The callback to be invoked.
+ * @lua@overload fun(type: c2.EventType.MessagesReceived, func: fun(event: MessagesReceivedEvent))
  * @exposed c2.register_callback
  */
 void c2_register_callback(ThisPluginState L, EventType evtType,
@@ -4,10 +4,10 @@
 #    include "common/network/NetworkCommon.hpp"
 #    include "common/QLogging.hpp"
 #    include "controllers/commands/CommandController.hpp"
+#    include "controllers/plugins/PluginLimits.hpp"
 #    include "controllers/plugins/PluginPermission.hpp"
 #    include "util/QMagicEnum.hpp"
 
-#    include <lua.h>
 #    include <magic_enum/magic_enum.hpp>
 #    include <QJsonArray>
 #    include <QJsonObject>
@@ -233,7 +233,7 @@ Plugin::~Plugin()
         // clearing this after the state is gone is not safe to do
         this->ownedCommands.clear();
         this->callbacks.clear();
-        lua_close(this->state_);
+        lua::closeLimitedState(this->state_);
     }
     assert(this->ownedCommands.empty() &&
            "This must be empty or destructor of sol::protected_function would "
@@ -5,6 +5,7 @@
 #    include "controllers/plugins/api/EventType.hpp"
 #    include "controllers/plugins/api/HTTPRequest.hpp"
 #    include "controllers/plugins/LuaUtilities.hpp"
+#    include "controllers/plugins/PluginLimits.hpp"
 #    include "controllers/plugins/PluginPermission.hpp"
 
 #    include <QDir>
@@ -13,10 +14,13 @@
 #    include <semver/semver.hpp>
 #    include <sol/forward.hpp>
 
+#    include <deque>
+#    include <map>
 #    include <memory>
 #    include <optional>
 #    include <unordered_map>
 #    include <unordered_set>
+#    include <utility>
 #    include <vector>
 
 struct lua_State;
@@ -24,6 +28,10 @@ class QTimer;
 
 namespace chatterino {
 
+class Channel;
+struct Message;
+using MessagePtr = std::shared_ptr<const Message>;
+
 struct PluginMeta {
     // for more info on these fields see docs/plugin-info.schema.json
 
@@ -138,8 +146,26 @@ public:
     bool hasHTTPPermissionFor(const QUrl &url);
     bool hasNetworkPermission() const;
 
+    /**
+     * Memory accounting and instruction budget of this plugin's state,
+     * nullptr if the state wasn't created by lua::newLimitedState
+     */
+    lua::StateLimits *limits() const
+    {
+        return lua::limitsOf(this->state_);
+    }
+
     std::map<lua::api::EventType, sol::protected_function> callbacks;
 
+    // Time spent in callbacks, keyed by a label like "command /foo"
+    std::map<QString, lua::CallbackStats> callbackStats;
+
+    // Messages waiting to be delivered to the MessagesReceived callback
+    std::deque<std::pair<std::weak_ptr<Channel>, MessagePtr>> pendingMessages;
+    // Messages dropped since the last delivery because the queue was full
+    size_t droppedMessages = 0;
+    size_t totalDroppedMessages = 0;
+
     // In-flight HTTP Requests
     // This is a lifetime hack to ensure they get deleted with the plugin. This relies on the Plugin getting deleted on reload!
     std::vector<std::shared_ptr<lua::api::HTTPRequest>> httpRequests;
@@ -156,6 +182,7 @@ private:
     int lastTimerId = 0;
 
     friend class PluginController;
+    friend class lua::ExecutionBudget;
     friend class PluginControllerAccess;  // this is for tests
 };
 }  // namespace chatterino
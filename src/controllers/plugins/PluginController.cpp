@@ -11,9 +11,11 @@
 #    include "controllers/plugins/api/HTTPRequest.hpp"
 #    include "controllers/plugins/api/HTTPResponse.hpp"
 #    include "controllers/plugins/api/IOWrapper.hpp"
+#    include "controllers/plugins/api/Message.hpp"
 #    include "controllers/plugins/api/WebSocket.hpp"
 #    include "controllers/plugins/LuaAPI.hpp"
 #    include "controllers/plugins/LuaUtilities.hpp"
+#    include "controllers/plugins/PluginLimits.hpp"
 #    include "controllers/plugins/SolTypes.hpp"
 #    include "messages/MessageBuilder.hpp"
 #    include "singletons/Paths.hpp"
@@ -23,12 +25,14 @@
 #    include <lua.h>
 #    include <lualib.h>
 #    include <QJsonDocument>
+#    include <QTimer>
 #    include <sol/overload.hpp>
 #    include <sol/sol.hpp>
 #    include <sol/types.hpp>
 #    include <sol/variadic_args.hpp>
 #    include <sol/variadic_results.hpp>
 
+#    include <algorithm>
 #    include <memory>
 #    include <utility>
 #    include <variant>
@@ -219,6 +223,7 @@ void PluginController::initSol(sol::state_view &lua, Plugin *plugin)
     c2.set_function("later", &lua::api::c2_later);
 
     lua::api::ChannelRef::createUserType(c2);
+    lua::api::MessageView::createUserType(c2);
     lua::api::HTTPResponse::createUserType(c2);
     lua::api::HTTPRequest::createUserType(c2);
     lua::api::WebSocket::createUserType(c2, plugin);
@@ -255,7 +260,7 @@ void PluginController::load(const QFileInfo &index, const QDir &pluginDir,
                             const PluginMeta &meta)
 {
     auto pluginName = pluginDir.dirName();
-    lua_State *l = luaL_newstate();
+    lua_State *l = lua::newLimitedState();
     auto plugin = std::make_unique<Plugin>(pluginName, l, meta, pluginDir);
     auto *temp = plugin.get();
     this->plugins_.insert({pluginName, std::move(plugin)});
@@ -279,7 +284,11 @@ void PluginController::load(const QFileInfo &index, const QDir &pluginDir,
     temp->dataDirectory().mkpath(".");
 
     qCDebug(chatterinoLua) << "Running lua file:" << index;
-    int err = luaL_dofile(l, index.absoluteFilePath().toStdString().c_str());
+    int err = 0;
+    {
+        lua::ExecutionBudget budget(temp, "init.lua");
+        err = luaL_dofile(l, index.absoluteFilePath().toStdString().c_str());
+    }
     if (err != 0)
     {
         temp->error_ = lua::humanErrorText(l, err);
@@ -324,6 +333,7 @@ QString PluginController::tryExecPluginCommand(const QString &commandName,
                 "channel", lua::api::ChannelRef(ctx.channel)  //
             );
 
+            lua::ExecutionBudget budget(plugin.get(), "command " + commandName);
             auto result =
                 lua::tryCall<std::optional<QString>>(it->second, args);
             if (!result)
@@ -400,6 +410,7 @@ std::pair<bool, QStringList> PluginController::updateCustomCompletions(
                 << "Processing custom completions from plugin" << name;
             auto &cb = *opt;
             sol::state_view view(pl->state_);
+            lua::ExecutionBudget budget(pl.get(), "CompletionRequested");
             auto errOrList = lua::tryCall<sol::table>(
                 cb,
                 toTable(pl->state_, lua::api::CompletionEvent{
@@ -430,6 +441,92 @@ std::pair<bool, QStringList> PluginController::updateCustomCompletions(
     return {false, results};
 }
 
+void PluginController::onMessageReceived(
+    const std::shared_ptr<Channel> &channel, const MessagePtr &message)
+{
+    bool queued = false;
+    for (auto &[name, plugin] : this->plugins_)
+    {
+        if (!plugin->callbacks.contains(lua::api::EventType::MessagesReceived))
+        {
+            continue;
+        }
+
+        auto &queue = plugin->pendingMessages;
+        if (queue.size() >= MAX_PENDING_MESSAGES)
+        {
+            queue.pop_front();
+            plugin->droppedMessages++;
+            plugin->totalDroppedMessages++;
+        }
+        queue.emplace_back(channel, message);
+        queued = true;
+    }
+
+    if (queued)
+    {
+        this->scheduleMessageDelivery();
+    }
+}
+
+void PluginController::deliverPendingMessages()
+{
+    this->messageDeliveryScheduled_ = false;
+
+    bool morePending = false;
+    for (auto &[name, plugin] : this->plugins_)
+    {
+        auto &queue = plugin->pendingMessages;
+        if (queue.empty())
+        {
+            continue;
+        }
+
+        auto it =
+            plugin->callbacks.find(lua::api::EventType::MessagesReceived);
+        if (it == plugin->callbacks.end() || !plugin->error().isNull())
+        {
+            queue.clear();
+            plugin->droppedMessages = 0;
+            continue;
+        }
+
+        lua::api::MessagesReceivedEvent event;
+        event.dropped = std::exchange(plugin->droppedMessages, 0);
+        auto count = std::min(queue.size(), MAX_BATCH_SIZE);
+        event.messages.reserve(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            auto &[channel, message] = queue.front();
+            event.messages.emplace_back(std::move(message), std::move(channel));
+            queue.pop_front();
+        }
+        morePending = morePending || !queue.empty();
+
+        // copy the callback, the plugin might replace it while it's running
+        auto cb = it->second;
+        lua::loggedVoidCall(cb, u"MessagesReceived", plugin.get(),
+                            toTable(plugin->state_, event));
+    }
+
+    if (morePending)
+    {
+        this->scheduleMessageDelivery();
+    }
+}
+
+void PluginController::scheduleMessageDelivery()
+{
+    if (this->messageDeliveryScheduled_)
+    {
+        return;
+    }
+    this->messageDeliveryScheduled_ = true;
+    QTimer::singleShot(0, &this->lifetimeGuard_, [this] {
+        this->deliverPendingMessages();
+    });
+}
+
 WebSocketPool &PluginController::webSocketPool()
 {
     return this->webSocketPool_;
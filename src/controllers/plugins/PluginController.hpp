@@ -10,6 +10,7 @@
 #    include <QFileInfo>
 #    include <QJsonArray>
 #    include <QJsonObject>
+#    include <QObject>
 #    include <QString>
 #    include <sol/forward.hpp>
 
@@ -30,6 +31,11 @@ class PluginController
     const Paths &paths;
 
 public:
+    /// Messages a plugin may have queued before the oldest ones are dropped
+    static constexpr size_t MAX_PENDING_MESSAGES = 2000;
+    /// Messages delivered to a plugin in a single MessagesReceived event
+    static constexpr size_t MAX_BATCH_SIZE = 500;
+
     explicit PluginController(const Paths &paths_);
 
     void initialize(Settings &settings);
@@ -62,6 +68,18 @@ public:
         const QString &query, const QString &fullTextContent,
         int cursorPosition, bool isFirstWord) const;
 
+    /**
+     * @brief Queues @a message for all plugins listening to MessagesReceived
+     *
+     * The queued messages are delivered in batches once the event loop runs
+     * again. If a plugin falls behind, the oldest messages are dropped.
+     */
+    void onMessageReceived(const std::shared_ptr<Channel> &channel,
+                           const MessagePtr &message);
+
+    /// Delivers up to #MAX_BATCH_SIZE queued messages to every plugin
+    void deliverPendingMessages();
+
     WebSocketPool &webSocketPool();
 
 private:
@@ -79,6 +97,10 @@ private:
     std::map<QString, std::unique_ptr<Plugin>> plugins_;
     WebSocketPool webSocketPool_;
 
+    void scheduleMessageDelivery();
+    bool messageDeliveryScheduled_ = false;
+    QObject lifetimeGuard_;
+
     // This is for tests, pay no attention
     friend class PluginControllerAccess;
 };
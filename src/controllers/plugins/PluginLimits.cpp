@@ -0,0 +1,180 @@
+#ifdef CHATTERINO_HAVE_PLUGINS
+#    include "controllers/plugins/PluginLimits.hpp"
+
+#    include "controllers/plugins/Plugin.hpp"
+
+#    include <lauxlib.h>
+#    include <lua.h>
+
+#    include <algorithm>
+#    include <cstdlib>
+#    include <utility>
+
+namespace {
+
+using namespace chatterino::lua;
+
+/// The budget hook runs every this many instructions
+constexpr int HOOK_INTERVAL = 1000;
+
+void *limitedAlloc(void *ud, void *ptr, size_t osize, size_t nsize)
+{
+    auto *limits = static_cast<StateLimits *>(ud);
+    // If ptr is null, osize encodes the type of the allocated object
+    size_t oldSize = ptr == nullptr ? 0 : osize;
+
+    if (nsize == 0)
+    {
+        std::free(ptr);  // NOLINT(cppcoreguidelines-no-malloc)
+        limits->memoryUsed -= oldSize;
+        return nullptr;
+    }
+
+    // Shrinking must never fail (Lua relies on that)
+    if (nsize > oldSize &&
+        limits->memoryUsed - oldSize + nsize > limits->memoryLimit)
+    {
+        limits->failedAllocations++;
+        return nullptr;
+    }
+
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+    void *result = std::realloc(ptr, nsize);
+    if (result == nullptr)
+    {
+        return nullptr;
+    }
+    limits->memoryUsed = limits->memoryUsed - oldSize + nsize;
+    limits->memoryPeak = std::max(limits->memoryPeak, limits->memoryUsed);
+    return result;
+}
+
+void budgetHook(lua_State *L, lua_Debug * /*ar*/)
+{
+    auto *limits = limitsOf(L);
+    if (limits == nullptr || limits->activeScopes == 0)
+    {
+        if (lua_gethookcount(L) != HOOK_INTERVAL)
+        {
+            lua_sethook(L, &budgetHook, LUA_MASKCOUNT, HOOK_INTERVAL);
+        }
+        return;
+    }
+
+    if (!limits->budgetExceeded)
+    {
+        limits->instructionsLeft -= lua_gethookcount(L);
+        if (limits->instructionsLeft > 0)
+        {
+            // This thread might still have the hook of an exceeded budget
+            if (lua_gethookcount(L) != HOOK_INTERVAL)
+            {
+                lua_sethook(L, &budgetHook, LUA_MASKCOUNT, HOOK_INTERVAL);
+            }
+            return;
+        }
+        limits->budgetExceeded = true;
+    }
+
+    // From now on, raise an error on every instruction, so the error can't be
+    // swallowed by a pcall in a loop - it's raised again right after the pcall
+    // returns.
+    lua_sethook(L, &budgetHook, LUA_MASKCOUNT, 1);
+    luaL_error(L, "Plugin exceeded its instruction budget");
+}
+
+}  // namespace
+
+namespace chatterino::lua {
+
+lua_State *newLimitedState(size_t memoryLimit, uint64_t instructionBudget)
+{
+    auto *limits = new StateLimits{
+        .memoryLimit = memoryLimit,
+        .instructionBudget = instructionBudget,
+    };
+    lua_State *L = lua_newstate(&limitedAlloc, limits);
+    if (L == nullptr)
+    {
+        delete limits;
+        return nullptr;
+    }
+    // Threads inherit the hook of the thread they're created from, so timers
+    // and coroutines are covered as well.
+    lua_sethook(L, &budgetHook, LUA_MASKCOUNT, HOOK_INTERVAL);
+    return L;
+}
+
+void closeLimitedState(lua_State *L)
+{
+    auto *limits = limitsOf(L);
+    lua_close(L);
+    delete limits;
+}
+
+StateLimits *limitsOf(lua_State *L)
+{
+    if (L == nullptr)
+    {
+        return nullptr;
+    }
+    void *ud = nullptr;
+    if (lua_getallocf(L, &ud) != &limitedAlloc)
+    {
+        return nullptr;
+    }
+    return static_cast<StateLimits *>(ud);
+}
+
+ExecutionBudget::ExecutionBudget(Plugin *plugin, QString label)
+    : plugin_(plugin)
+    , limits_(plugin == nullptr ? nullptr : plugin->limits())
+    , label_(std::move(label))
+    , start_(std::chrono::steady_clock::now())
+{
+    if (this->limits_ == nullptr)
+    {
+        return;
+    }
+    if (this->limits_->activeScopes == 0)
+    {
+        this->outermost_ = true;
+        this->limits_->instructionsLeft =
+            static_cast<int64_t>(this->limits_->instructionBudget);
+        this->limits_->budgetExceeded = false;
+    }
+    this->limits_->activeScopes++;
+}
+
+ExecutionBudget::~ExecutionBudget()
+{
+    if (this->plugin_ == nullptr)
+    {
+        return;
+    }
+
+    auto elapsed = std::chrono::steady_clock::now() - this->start_;
+    auto &stats = this->plugin_->callbackStats[this->label_];
+    stats.calls++;
+    stats.total += elapsed;
+    stats.max = std::max<std::chrono::nanoseconds>(stats.max, elapsed);
+
+    if (this->limits_ == nullptr)
+    {
+        return;
+    }
+    this->limits_->activeScopes--;
+    if (this->outermost_ && this->limits_->budgetExceeded)
+    {
+        stats.budgetExceeded++;
+        this->limits_->budgetExceeded = false;
+
+        // The hook was set to run on every instruction (see budgetHook).
+        // Other threads reset their hook the next time it runs.
+        lua_sethook(this->plugin_->state_, &budgetHook, LUA_MASKCOUNT,
+                    HOOK_INTERVAL);
+    }
+}
+
+}  // namespace chatterino::lua
+#endif
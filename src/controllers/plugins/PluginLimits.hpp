@@ -0,0 +1,94 @@
+#pragma once
+
+#ifdef CHATTERINO_HAVE_PLUGINS
+#    include <QString>
+
+#    include <chrono>
+#    include <cstddef>
+#    include <cstdint>
+
+struct lua_State;
+
+namespace chatterino {
+
+class Plugin;
+
+}  // namespace chatterino
+
+namespace chatterino::lua {
+
+/// Memory a plugin's Lua state may allocate
+constexpr size_t DEFAULT_MEMORY_LIMIT = size_t{128} * 1024 * 1024;
+
+/// Number of VM instructions a single callback (including the plugin's
+/// `init.lua`) may execute before it's aborted
+constexpr uint64_t DEFAULT_INSTRUCTION_BUDGET = 50'000'000;
+
+/// @brief Resource accounting of a Lua state created by #newLimitedState
+///
+/// The limits are shared by all threads (coroutines) of a state.
+struct StateLimits {
+    size_t memoryLimit = DEFAULT_MEMORY_LIMIT;
+    size_t memoryUsed = 0;
+    size_t memoryPeak = 0;
+    /// Number of allocations that were refused because of #memoryLimit
+    size_t failedAllocations = 0;
+
+    uint64_t instructionBudget = DEFAULT_INSTRUCTION_BUDGET;
+    /// Instructions left in the currently running callback
+    int64_t instructionsLeft = 0;
+    /// Nesting depth of ExecutionBudget scopes. The budget is only enforced
+    /// while this is non-zero.
+    int activeScopes = 0;
+    bool budgetExceeded = false;
+};
+
+struct CallbackStats {
+    size_t calls = 0;
+    /// Number of calls aborted because they exceeded the instruction budget
+    size_t budgetExceeded = 0;
+    std::chrono::nanoseconds total{0};
+    std::chrono::nanoseconds max{0};
+};
+
+/// @brief Creates a Lua state that accounts its memory and supports
+///        instruction budgets
+///
+/// The returned state must be closed with #closeLimitedState.
+lua_State *newLimitedState(size_t memoryLimit = DEFAULT_MEMORY_LIMIT,
+                           uint64_t instructionBudget =
+                               DEFAULT_INSTRUCTION_BUDGET);
+
+/// Closes @a L and frees its accounting data if it has any
+void closeLimitedState(lua_State *L);
+
+/// Returns the limits of @a L or `nullptr` if it wasn't created by
+/// #newLimitedState
+StateLimits *limitsOf(lua_State *L);
+
+/// @brief Enforces the instruction budget of a plugin and records the time
+///        spent in a callback
+///
+/// The budget is only armed by the outermost scope, so callbacks running
+/// while another callback of the same plugin is executing share its budget.
+class ExecutionBudget
+{
+public:
+    ExecutionBudget(Plugin *plugin, QString label);
+    ~ExecutionBudget();
+
+    ExecutionBudget(const ExecutionBudget &) = delete;
+    ExecutionBudget(ExecutionBudget &&) = delete;
+    ExecutionBudget &operator=(const ExecutionBudget &) = delete;
+    ExecutionBudget &operator=(ExecutionBudget &&) = delete;
+
+private:
+    Plugin *plugin_;
+    StateLimits *limits_;
+    QString label_;
+    bool outermost_ = false;
+    std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace chatterino::lua
+#endif
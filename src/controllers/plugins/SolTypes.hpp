@@ -1,5 +1,6 @@
 #pragma once
 #ifdef CHATTERINO_HAVE_PLUGINS
+#    include "controllers/plugins/PluginLimits.hpp"
 #    include "util/QMagicEnum.hpp"
 #    include "util/TypeName.hpp"
 
@@ -169,6 +170,7 @@ bool hasValueOrLog(const nonstd::expected<T, QString> &res, QStringView context,
 void loggedVoidCall(const auto &fn, QStringView context, Plugin *plugin,
                     auto &&...args)
 {
+    ExecutionBudget budget(plugin, context.toString());
     auto res = tryCall<void>(fn, std::forward<decltype(args)>(args)...);
     hasValueOrLog(res, context, plugin);
 }
@@ -8,6 +8,7 @@
 #    include "controllers/plugins/api/HTTPResponse.hpp"
 #    include "controllers/plugins/LuaUtilities.hpp"
 #    include "controllers/plugins/PluginController.hpp"
+#    include "controllers/plugins/PluginLimits.hpp"
 #    include "controllers/plugins/SolTypes.hpp"
 #    include "util/DebugCount.hpp"
 
@@ -128,6 +129,9 @@ void HTTPRequest::execute(sol::this_state L)
                 return;
             }
             lua::StackGuard guard(L);
+            lua::ExecutionBudget budget(
+                getApp()->getPlugins()->getPluginByStatePtr(L),
+                "HTTPRequest.on_success");
             (*self->cbSuccess)(HTTPResponse(res));
             self->cbSuccess = std::nullopt;
         })
@@ -142,6 +146,9 @@ void HTTPRequest::execute(sol::this_state L)
                 return;
             }
             lua::StackGuard guard(L);
+            lua::ExecutionBudget budget(
+                getApp()->getPlugins()->getPluginByStatePtr(L),
+                "HTTPRequest.on_error");
             (*self->cbError)(HTTPResponse(res));
             self->cbError = std::nullopt;
         })
@@ -168,6 +175,7 @@ void HTTPRequest::execute(sol::this_state L)
                 return;
             }
             lua::StackGuard guard(L);
+            lua::ExecutionBudget budget(pl, "HTTPRequest.finally");
             (*self->cbFinally)();
             self->cbFinally = std::nullopt;
         })
@@ -0,0 +1,93 @@
+#ifdef CHATTERINO_HAVE_PLUGINS
+#    include "controllers/plugins/api/Message.hpp"
+
+#    include "common/Channel.hpp"
+#    include "controllers/plugins/SolTypes.hpp"
+#    include "messages/Message.hpp"
+
+#    include <sol/sol.hpp>
+
+#    include <utility>
+
+namespace chatterino::lua::api {
+
+MessageView::MessageView(MessagePtr message, std::weak_ptr<Channel> channel)
+    : message_(std::move(message))
+    , channel_(std::move(channel))
+{
+}
+
+QString MessageView::get_id() const
+{
+    return this->message_->id;
+}
+
+QString MessageView::get_login_name() const
+{
+    return this->message_->loginName;
+}
+
+QString MessageView::get_display_name() const
+{
+    return this->message_->displayName;
+}
+
+QString MessageView::get_user_id() const
+{
+    return this->message_->userID;
+}
+
+QString MessageView::get_text() const
+{
+    return this->message_->messageText;
+}
+
+QString MessageView::get_channel_name() const
+{
+    return this->message_->channelName;
+}
+
+ChannelRef MessageView::get_channel() const
+{
+    return ChannelRef(this->channel_.lock());
+}
+
+qint64 MessageView::get_timestamp() const
+{
+    return this->message_->serverReceivedTime.toMSecsSinceEpoch();
+}
+
+bool MessageView::is_highlighted() const
+{
+    return this->message_->flags.has(MessageFlag::Highlighted);
+}
+
+QString MessageView::to_string() const
+{
+    return QStringView(u"<c2.Message %1: %2>")
+        .arg(this->message_->loginName, this->message_->messageText);
+}
+
+void MessageView::createUserType(sol::table &c2)
+{
+    // clang-format off
+    c2.new_usertype<MessageView>(
+        "Message", sol::no_constructor,
+        // meta methods
+        sol::meta_method::to_string, &MessageView::to_string,
+
+        "get_id", &MessageView::get_id,
+        "get_login_name", &MessageView::get_login_name,
+        "get_display_name", &MessageView::get_display_name,
+        "get_user_id", &MessageView::get_user_id,
+        "get_text", &MessageView::get_text,
+        "get_channel_name", &MessageView::get_channel_name,
+        "get_channel", &MessageView::get_channel,
+        "get_timestamp", &MessageView::get_timestamp,
+        "is_highlighted", &MessageView::is_highlighted
+    );
+    // clang-format on
+}
+
+}  // namespace chatterino::lua::api
+#endif
@@ -0,0 +1,120 @@
+#pragma once
+#ifdef CHATTERINO_HAVE_PLUGINS
+#    include "controllers/plugins/api/ChannelRef.hpp"
+
+#    include <QString>
+#    include <sol/forward.hpp>
+
+#    include <memory>
+
+namespace chatterino {
+
+class Channel;
+struct Message;
+using MessagePtr = std::shared_ptr<const Message>;
+
+}  // namespace chatterino
+
+namespace chatterino::lua::api {
+// NOLINTBEGIN(readability-identifier-naming)
+
+/**
+ * A read-only view of a received message. Properties are only converted to Lua
+ * values when they're accessed.
+ *
+ * @lua@class c2.Message
+ */
+class MessageView
+{
+public:
+    MessageView(MessagePtr message, std::weak_ptr<Channel> channel);
+
+    /**
+     * Returns the ID of the message. Empty for messages without an ID.
+     *
+     * @lua@return string
+     * @exposed c2.Message:get_id
+     */
+    QString get_id() const;
+
+    /**
+     * Returns the login name of the author.
+     *
+     * @lua@return string
+     * @exposed c2.Message:get_login_name
+     */
+    QString get_login_name() const;
+
+    /**
+     * Returns the display name of the author.
+     *
+     * @lua@return string
+     * @exposed c2.Message:get_display_name
+     */
+    QString get_display_name() const;
+
+    /**
+     * Returns the Twitch user ID of the author.
+     *
+     * @lua@return string
+     * @exposed c2.Message:get_user_id
+     */
+    QString get_user_id() const;
+
+    /**
+     * Returns the text of the message as it was sent.
+     *
+     * @lua@return string
+     * @exposed c2.Message:get_text
+     */
+    QString get_text() const;
+
+    /**
+     * Returns the name of the channel the message was sent in.
+     *
+     * @lua@return string
+     * @exposed c2.Message:get_channel_name
+     */
+    QString get_channel_name() const;
+
+    /**
+     * Returns the channel the message was received in.
+     *
+     * @lua@return c2.Channel
+     * @exposed c2.Message:get_channel
+     */
+    ChannelRef get_channel() const;
+
+    /**
+     * Returns the time the message was received by the server in
+     * milliseconds since the Unix epoch.
+     *
+     * @lua@return integer
+     * @exposed c2.Message:get_timestamp
+     */
+    qint64 get_timestamp() const;
+
+    /**
+     * Returns true if the message was highlighted.
+     *
+     * @lua@return boolean
+     * @exposed c2.Message:is_highlighted
+     */
+    bool is_highlighted() const;
+
+    /**
+     * @lua@return string
+     * @exposed c2.Message:__tostring
+     */
+    QString to_string() const;
+
+    static void createUserType(sol::table &c2);
+
+private:
+    MessagePtr message_;
+    std::weak_ptr<Channel> channel_;
+};
+
+// NOLINTEND(readability-identifier-naming)
+}  // namespace chatterino::lua::api
+#endif
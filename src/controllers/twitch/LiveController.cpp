@@ -2,6 +2,7 @@
 
 #include "common/QLogging.hpp"
 #include "providers/twitch/api/Helix.hpp"
+#include "providers/twitch/api/HelixScheduler.hpp"
 #include "providers/twitch/TwitchChannel.hpp"
 #include "util/Helpers.hpp"
 
@@ -91,13 +92,15 @@ void TwitchLiveController::request(std::optional<QStringList> optChannelIDs)
     auto batches =
         splitListIntoBatches(channelIDs, TwitchLiveController::BATCH_SIZE);
 
-    qCDebug(LOG) << "Make" << batches.size() << "requests";
+    qCDebug(LOG) << "Make" << batches.size() << "lookups";
 
+    // Every batch is its own lookup, so a failed request only loses the
+    // channels of one batch. The scheduler still merges them with other
+    // lookups.
     for (const auto &batch : batches)
     {
-        // TODO: Explore making this concurrent
-        getHelix()->fetchStreams(
-            batch, {},
+        HelixScheduler::instance().fetchStreamsById(
+            batch,
             [this, batch{batch}](const auto &streams) {
                 std::unordered_map<QString, std::optional<HelixStream>> results;
 
@@ -145,13 +148,11 @@ void TwitchLiveController::request(std::optional<QStringList> optChannelIDs)
             },
             [] {
                 qCWarning(LOG) << "Failed stream check request";
-            },
-            [] {});
+            });
 
-        // TODO: Explore making this concurrent
-        getHelix()->fetchChannels(
+        HelixScheduler::instance().fetchChannelsById(
             batch,
-            [this, batch{batch}](const auto &helixChannels) {
+            [this](const auto &helixChannels) {
                 QStringList deadChannels;
 
                 {
@@ -35,9 +35,9 @@ public:
     static constexpr std::chrono::seconds IMMEDIATE_REQUEST_INTERVAL{1};
 
     /**
-     * How many channels to include in a single request
+     * How many channels to include in a single lookup
      *
-     * Should not be more than 100
+     * Should not be more than HelixScheduler::BATCH_SIZE
      **/
     static constexpr int BATCH_SIZE{100};
 
@@ -54,7 +54,8 @@ private:
     };
 
     /**
-     * Run batched Helix Channels & Stream requests for channels
+     * Run Helix Channels & Stream lookups for channels through the
+     * HelixScheduler
      *
      * If a list of channel IDs is passed to request, we only make a request for those channels
      *
@@ -23,6 +23,8 @@ struct UserData {
     {
         return !color.has_value() && notes.isEmpty();
     }
+
+    bool operator==(const UserData &other) const = default;
 };
 
 }  // namespace chatterino
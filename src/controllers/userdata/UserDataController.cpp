@@ -1,28 +1,44 @@
 #include "controllers/userdata/UserDataController.hpp"
 
+#include "common/QLogging.hpp"
 #include "singletons/Paths.hpp"
 #include "util/CombinePath.hpp"
 #include "util/Helpers.hpp"
+#include "util/QStringHash.hpp"
+#include "util/serialize/Container.hpp"
+
+#include <pajlada/settings.hpp>
+#include <QDateTime>
+#include <QFile>
+#include <QTimer>
+
+#include <algorithm>
+#include <unordered_map>
 
 namespace {
 
 using namespace chatterino;
 
-std::shared_ptr<pajlada::Settings::SettingManager> initSettingsInstance(
-    const Paths &paths)
+QString storePath(const Paths &paths)
 {
-    auto sm = std::make_shared<pajlada::Settings::SettingManager>();
+    return combinePath(paths.settingsDirectory, "user-data.db");
+}
 
-    auto path = combinePath(paths.settingsDirectory, "user-data.json");
+QString legacyPath(const Paths &paths)
+{
+    return combinePath(paths.settingsDirectory, "user-data.json");
+}
 
+/// Reads the custom colors and notes saved by older versions
+std::unordered_map<QString, UserData> loadLegacyUserData(const QString &path)
+{
+    auto sm = std::make_shared<pajlada::Settings::SettingManager>();
     sm->setPath(path.toUtf8().toStdString());
+    sm->load();
 
-    sm->setBackupEnabled(true);
-    sm->setBackupSlots(9);
-    sm->saveMethod =
-        pajlada::Settings::SettingManager::SaveMethod::SaveAllTheTime;
-
-    return sm;
+    pajlada::Settings::Setting<std::unordered_map<QString, UserData>> setting(
+        "/users", sm);
+    return setting.getValue();
 }
 
 }  // namespace
@@ -30,11 +46,37 @@ std::shared_ptr<pajlada::Settings::SettingManager> initSettingsInstance(
 namespace chatterino {
 
 UserDataController::UserDataController(const Paths &paths)
-    : sm(initSettingsInstance(paths))
-    , setting("/users", this->sm)
+    : store_(storePath(paths))
 {
-    this->sm->load();
-    this->users = this->setting.getValue();
+    auto legacy = legacyPath(paths);
+    if (!QFile::exists(legacy))
+    {
+        return;
+    }
+
+    auto users = loadLegacyUserData(legacy);
+    for (const auto &[userID, data] : users)
+    {
+        this->store_.update(userID, [&](UserMetadata &user) {
+            user.data = data;
+        });
+    }
+    this->store_.flush();
+    if (this->store_.hasPendingWrites())
+    {
+        // Try again on the next start
+        return;
+    }
+
+    // Only import the old file once
+    auto migrated = legacy + ".migrated";
+    QFile::remove(migrated);
+    if (!QFile::rename(legacy, migrated))
+    {
+        qCWarning(chatterinoApp) << "Failed to rename" << legacy;
+    }
+    qCDebug(chatterinoApp) << "Imported" << users.size() << "users from"
+                           << legacy;
 }
 
 std::optional<UserData> UserDataController::getUser(const QString &userID) const
@@ -44,94 +86,130 @@ std::optional<UserData> UserDataController::getUser(const QString &userID) const
         return std::nullopt;
     }
 
-    std::shared_lock lock(this->usersMutex);
-    auto it = this->users.find(userID);
-
-    if (it == this->users.end())
+    auto user = this->store_.get(userID);
+    if (!user || user->data.isEmpty())
     {
         return std::nullopt;
     }
 
-    return it->second;
-}
-
-std::unordered_map<QString, UserData> UserDataController::getUsers() const
-{
-    std::shared_lock lock(this->usersMutex);
-    return this->users;
+    return user->data;
 }
 
 void UserDataController::setUserColor(const QString &userID,
                                       const QString &colorString)
 {
-    if (userID.isEmpty())
-    {
-        return;
-    }
-
-    std::unique_lock lock(this->usersMutex);
-
-    auto c = this->users;
-    auto it = c.find(userID);
     std::optional<QColor> finalColor =
         makeConditionedOptional(!colorString.isEmpty(), QColor(colorString));
-    if (it == c.end())
-    {
-        if (!finalColor)
-        {
-            // Early out - user is not configured and will not get a new color
-            return;
-        }
 
-        UserData user;
+    this->updateUserData(userID, [&](UserData &user) {
         user.color = finalColor;
-        c.insert({userID, user});
-    }
-    else
-    {
-        it->second.color = finalColor;
-    }
-
-    this->update(std::move(c), std::move(lock));
+    });
 }
 
-void UserDataController::update(
-    std::unordered_map<QString, UserData> &&newUsers,
-    std::unique_lock<std::shared_mutex> usersLock)
+void UserDataController::setUserNotes(const QString &userID,
+                                      const QString &notes)
 {
-    // Remove empty user data items
-    std::erase_if(newUsers, [](const auto &pair) {
-        return pair.second.isEmpty();
+    this->updateUserData(userID, [&](UserData &user) {
+        user.notes = notes;
     });
+}
 
-    this->users = std::move(newUsers);
-    this->setting.setValue(this->users);
+void UserDataController::updateUserData(
+    const QString &userID, const std::function<void(UserData &)> &update)
+{
+    if (userID.isEmpty())
+    {
+        return;
+    }
 
-    // unlock before invoking updated signal
-    usersLock.unlock();
+    bool changed = this->store_.update(userID, [&](UserMetadata &user) {
+        update(user.data);
+    });
+    if (!changed)
+    {
+        return;
+    }
 
+    // Customizations are written right away
+    this->store_.flush();
     this->userDataUpdated_.invoke();
 }
 
-void UserDataController::setUserNotes(const QString &userID,
-                                      const QString &notes)
+pajlada::Signals::NoArgSignal &UserDataController::userDataUpdated()
+{
+    return this->userDataUpdated_;
+}
+
+std::optional<UserMetadata> UserDataController::getMetadata(
+    const QString &userID) const
 {
     if (userID.isEmpty())
     {
-        return;
+        return std::nullopt;
     }
+    return this->store_.get(userID);
+}
 
-    std::unique_lock lock(this->usersMutex);
+std::optional<UserMetadata> UserDataController::getMetadataByLogin(
+    const QString &login) const
+{
+    if (login.isEmpty())
+    {
+        return std::nullopt;
+    }
+    return this->store_.getByLogin(login);
+}
 
-    auto users = this->users;
-    users[userID].notes = notes;
+void UserDataController::updateMetadata(const UserMetadata &seen)
+{
+    auto now = QDateTime::currentSecsSinceEpoch();
+    bool changed = this->store_.update(seen.id, [&](UserMetadata &user) {
+        if (!seen.login.isEmpty())
+        {
+            user.login = seen.login;
+        }
+        if (!seen.displayName.isEmpty())
+        {
+            user.displayName = seen.displayName;
+        }
+        if (!seen.profilePictureUrl.isEmpty())
+        {
+            user.profilePictureUrl = seen.profilePictureUrl;
+        }
+        if (seen.color)
+        {
+            user.color = seen.color;
+        }
+        if (now - user.lastSeen >= LAST_SEEN_RESOLUTION_SECONDS)
+        {
+            user.lastSeen = now;
+        }
+        user.lastResolved = std::max(user.lastResolved, seen.lastResolved);
+    });
+
+    if (changed)
+    {
+        this->scheduleFlush();
+    }
+}
 
-    this->update(std::move(users), std::move(lock));
+void UserDataController::save()
+{
+    this->store_.flush();
 }
 
-pajlada::Signals::NoArgSignal &UserDataController::userDataUpdated()
+void UserDataController::scheduleFlush()
 {
-    return this->userDataUpdated_;
+    if (this->flushQueued_)
+    {
+        return;
+    }
+    this->flushQueued_ = true;
+
+    QTimer::singleShot(FLUSH_INTERVAL_MS, &this->lifetimeGuard_, [this] {
+        this->flushQueued_ = false;
+        this->store_.flush();
+    });
 }
 
 }  // namespace chatterino
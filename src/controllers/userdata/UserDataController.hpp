@@ -1,19 +1,15 @@
 #pragma once
 
 #include "controllers/userdata/UserData.hpp"
-#include "util/QStringHash.hpp"
-#include "util/RapidjsonHelpers.hpp"
-#include "util/RapidJsonSerializeQString.hpp"
-#include "util/serialize/Container.hpp"
+#include "controllers/userdata/UserMetadataStore.hpp"
 
-#include <pajlada/settings.hpp>
 #include <pajlada/signals/signal.hpp>
 #include <QColor>
+#include <QObject>
 #include <QString>
 
+#include <functional>
 #include <optional>
-#include <shared_mutex>
-#include <unordered_map>
 
 namespace chatterino {
 
@@ -31,11 +27,31 @@ public:
     virtual void setUserNotes(const QString &userID, const QString &notes) = 0;
 
     virtual pajlada::Signals::NoArgSignal &userDataUpdated() = 0;
+
+    /// Get everything known about a user by their ID
+    virtual std::optional<UserMetadata> getMetadata(
+        const QString &userID) const = 0;
+    /// Get everything known about a user by their login (case-insensitive)
+    virtual std::optional<UserMetadata> getMetadataByLogin(
+        const QString &login) const = 0;
+
+    /// @brief Remember the login, display name, picture and color of a user
+    ///
+    /// This is called for users seen in chat or looked up through Helix.
+    /// Empty fields of @a seen don't overwrite known ones and `data` is
+    /// ignored.
+    virtual void updateMetadata(const UserMetadata &seen) = 0;
 };
 
 class UserDataController : public IUserDataController
 {
 public:
+    /// Writes to the store are batched for this long
+    static constexpr int FLUSH_INTERVAL_MS = 10 * 1000;
+    /// The last-seen time of a user is only updated this often, otherwise
+    /// every message would change the user's record
+    static constexpr qint64 LAST_SEEN_RESOLUTION_SECONDS = 60 * 60;
+
     explicit UserDataController(const Paths &paths);
 
     // Get extra data about a user
@@ -51,19 +67,26 @@ public:
 
     pajlada::Signals::NoArgSignal &userDataUpdated() override;
 
-private:
-    void update(std::unordered_map<QString, UserData> &&newUsers,
-                std::unique_lock<std::shared_mutex> usersLock);
+    std::optional<UserMetadata> getMetadata(
+        const QString &userID) const override;
+    std::optional<UserMetadata> getMetadataByLogin(
+        const QString &login) const override;
+    void updateMetadata(const UserMetadata &seen) override;
 
-    std::unordered_map<QString, UserData> getUsers() const;
+    /// Writes all pending changes to disk
+    void save();
 
-    // Stores a real-time list of users & their customizations
-    std::unordered_map<QString, UserData> users;
-    mutable std::shared_mutex usersMutex;
+private:
+    void updateUserData(const QString &userID,
+                        const std::function<void(UserData &)> &update);
+    void scheduleFlush();
+
+    UserMetadataStore store_;
+    bool flushQueued_ = false;
 
-    std::shared_ptr<pajlada::Settings::SettingManager> sm;
-    pajlada::Settings::Setting<std::unordered_map<QString, UserData>> setting;
     pajlada::Signals::NoArgSignal userDataUpdated_;
+
+    QObject lifetimeGuard_;
 };
 
 }  // namespace chatterino
@@ -0,0 +1,437 @@
+#include "controllers/userdata/UserMetadataStore.hpp"
+
+#include "common/QLogging.hpp"
+
+#include <QDataStream>
+#include <QDateTime>
+#include <QFile>
+#include <QSaveFile>
+
+#include <mutex>
+#include <utility>
+
+namespace {
+
+using namespace chatterino;
+
+constexpr quint32 MAGIC = 0x43485553;  // "CHUS"
+constexpr quint32 VERSION = 1;
+constexpr auto STREAM_VERSION = QDataStream::Qt_6_0;
+
+/// Don't bother compacting small files
+constexpr size_t MIN_COMPACT_RECORDS = 1000;
+
+/// Records are much smaller than this, a larger size means the file is corrupt
+constexpr quint32 MAX_RECORD_SIZE = 1024 * 1024;
+
+void writeColor(QDataStream &stream, const std::optional<QColor> &color)
+{
+    stream << color.has_value() << (color ? color->rgba() : QRgb{});
+}
+
+std::optional<QColor> readColor(QDataStream &stream)
+{
+    bool valid = false;
+    QRgb rgba{};
+    stream >> valid >> rgba;
+    if (!valid)
+    {
+        return std::nullopt;
+    }
+    return QColor::fromRgba(rgba);
+}
+
+/// Copies the store at @a path to `<path>.bak`
+void backUp(const QString &path)
+{
+    QFile::remove(path + ".bak");
+    QFile::copy(path, path + ".bak");
+}
+
+void writeHeader(QDataStream &stream)
+{
+    stream << MAGIC << VERSION;
+}
+
+/// Writes the size of the record followed by its fields
+void writeRecord(QDataStream &stream, const UserMetadata &user)
+{
+    QByteArray payload;
+    QDataStream fields(&payload, QIODevice::WriteOnly);
+    fields.setVersion(STREAM_VERSION);
+    fields << user.id << user.login << user.displayName
+           << user.profilePictureUrl;
+    writeColor(fields, user.color);
+    writeColor(fields, user.data.color);
+    fields << user.data.notes << user.lastSeen << user.lastResolved;
+
+    stream << static_cast<quint32>(payload.size());
+    stream.writeRawData(payload.constData(), static_cast<int>(payload.size()));
+}
+
+/// Reads the fields of a record ending at @a end
+UserMetadata readRecord(QDataStream &stream, qint64 end)
+{
+    UserMetadata user;
+    stream >> user.id >> user.login >> user.displayName >>
+        user.profilePictureUrl;
+    user.color = readColor(stream);
+    user.data.color = readColor(stream);
+    stream >> user.data.notes >> user.lastSeen;
+
+    // Added after the first version of the format
+    if (stream.device()->pos() < end)
+    {
+        stream >> user.lastResolved;
+    }
+    return user;
+}
+
+}  // namespace
+
+namespace chatterino {
+
+UserMetadataStore::UserMetadataStore(QString path)
+    : path_(std::move(path))
+{
+    std::unique_lock lock(this->mutex_);
+    this->load();
+
+    if (this->fileRecords_ > MIN_COMPACT_RECORDS &&
+        this->fileRecords_ > 2 * this->users_.size())
+    {
+        this->compactLocked();
+    }
+}
+
+UserMetadataStore::~UserMetadataStore()
+{
+    this->flush();
+}
+
+void UserMetadataStore::load()
+{
+    QFile file(this->path_);
+    if (!file.open(QIODevice::ReadWrite))
+    {
+        qCWarning(chatterinoApp) << "Failed to open user store" << this->path_
+                                 << file.errorString();
+        return;
+    }
+
+    if (file.size() == 0)
+    {
+        QDataStream stream(&file);
+        stream.setVersion(STREAM_VERSION);
+        writeHeader(stream);
+        return;
+    }
+
+    auto fileSize = file.size();
+    auto *mapped = file.map(0, fileSize);
+    if (mapped == nullptr)
+    {
+        qCWarning(chatterinoApp) << "Failed to map user store" << this->path_
+                                 << file.errorString();
+        return;
+    }
+
+    auto bytes = QByteArray::fromRawData(reinterpret_cast<const char *>(mapped),
+                                         fileSize);
+    QDataStream stream(bytes);
+    stream.setVersion(STREAM_VERSION);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    stream >> magic >> version;
+    if (stream.status() != QDataStream::Ok || magic != MAGIC ||
+        version != VERSION)
+    {
+        file.unmap(mapped);
+        file.close();
+
+        qCWarning(chatterinoApp)
+            << "Unknown user store format - moving it to" << this->path_
+            << ".bak and starting over";
+        QFile::remove(this->path_ + ".bak");
+        QFile::rename(this->path_, this->path_ + ".bak");
+        this->compactLocked();
+        return;
+    }
+
+    auto *device = stream.device();
+    auto end = device->pos();
+    bool corrupt = false;
+    while (!stream.atEnd())
+    {
+        quint32 size = 0;
+        stream >> size;
+        auto start = device->pos();
+        if (stream.status() != QDataStream::Ok)
+        {
+            break;
+        }
+        if (size > MAX_RECORD_SIZE)
+        {
+            // We can't tell where the next record starts
+            corrupt = true;
+            break;
+        }
+        if (size > fileSize - start)
+        {
+            break;
+        }
+
+        auto user = readRecord(stream, start + size);
+        bool damaged =
+            stream.status() != QDataStream::Ok || device->pos() > start + size;
+
+        // Skip fields added by newer versions
+        stream.resetStatus();
+        device->seek(start + size);
+        this->fileRecords_++;
+        end = device->pos();
+
+        if (damaged)
+        {
+            qCWarning(chatterinoApp)
+                << "Skipping a damaged record in the user store";
+            continue;
+        }
+        this->setLocked(std::move(user));
+    }
+
+    file.unmap(mapped);
+
+    if (corrupt)
+    {
+        file.close();
+
+        qCWarning(chatterinoApp)
+            << "The user store is corrupt - backing it up to" << this->path_
+            << ".bak and keeping the" << this->users_.size()
+            << "users read before the corruption";
+        backUp(this->path_);
+        this->compactLocked();
+        return;
+    }
+
+    if (end < fileSize)
+    {
+        // We most likely crashed while appending the last record. A damaged
+        // size looks the same, so keep a copy of what's dropped.
+        file.close();
+
+        qCWarning(chatterinoApp)
+            << "Dropping" << fileSize - end << "bytes of incomplete records"
+            << "from the user store - backing it up to" << this->path_
+            << ".bak";
+        backUp(this->path_);
+        QFile::resize(this->path_, end);
+    }
+}
+
+std::optional<UserMetadata> UserMetadataStore::get(const QString &userID) const
+{
+    std::shared_lock lock(this->mutex_);
+    auto it = this->users_.find(userID);
+    if (it == this->users_.end())
+    {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+std::optional<UserMetadata> UserMetadataStore::getByLogin(
+    const QString &login) const
+{
+    std::shared_lock lock(this->mutex_);
+    auto id = this->logins_.find(login.toLower());
+    if (id == this->logins_.end())
+    {
+        return std::nullopt;
+    }
+    auto it = this->users_.find(id->second);
+    if (it == this->users_.end())
+    {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+bool UserMetadataStore::update(
+    const QString &userID, const std::function<void(UserMetadata &)> &update)
+{
+    if (userID.isEmpty())
+    {
+        return false;
+    }
+
+    std::unique_lock lock(this->mutex_);
+
+    auto it = this->users_.find(userID);
+    bool exists = it != this->users_.end();
+
+    UserMetadata user;
+    if (exists)
+    {
+        user = it->second;
+    }
+    update(user);
+    user.id = userID;
+
+    if (exists ? user == it->second : user.isEmpty())
+    {
+        return false;
+    }
+
+    this->setLocked(std::move(user));
+    this->pending_.insert(userID);
+    return true;
+}
+
+void UserMetadataStore::setLocked(UserMetadata user)
+{
+    auto it = this->users_.find(user.id);
+    if (it != this->users_.end())
+    {
+        auto login = this->logins_.find(it->second.login.toLower());
+        if (login != this->logins_.end() && login->second == user.id)
+        {
+            this->logins_.erase(login);
+        }
+    }
+
+    if (user.isEmpty())
+    {
+        if (it != this->users_.end())
+        {
+            this->users_.erase(it);
+        }
+        return;
+    }
+
+    if (!user.login.isEmpty())
+    {
+        this->logins_[user.login.toLower()] = user.id;
+    }
+    this->users_[user.id] = std::move(user);
+}
+
+void UserMetadataStore::flush()
+{
+    std::unique_lock lock(this->mutex_);
+    if (this->pending_.empty())
+    {
+        return;
+    }
+
+    QFile file(this->path_);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Append))
+    {
+        qCWarning(chatterinoApp) << "Failed to open user store" << this->path_
+                                 << file.errorString();
+        return;
+    }
+
+    auto previousSize = file.size();
+
+    QByteArray buffer;
+    QDataStream stream(&buffer, QIODevice::WriteOnly);
+    stream.setVersion(STREAM_VERSION);
+    if (previousSize == 0)
+    {
+        writeHeader(stream);
+    }
+    for (const auto &id : this->pending_)
+    {
+        auto it = this->users_.find(id);
+        if (it == this->users_.end())
+        {
+            // An empty record removes the user
+            UserMetadata removed;
+            removed.id = id;
+            writeRecord(stream, removed);
+        }
+        else
+        {
+            writeRecord(stream, it->second);
+        }
+    }
+
+    if (file.write(buffer) != buffer.size() || !file.flush())
+    {
+        qCWarning(chatterinoApp) << "Failed to write user store" << this->path_
+                                 << file.errorString();
+        // Don't leave an incomplete record in front of the next ones
+        file.resize(previousSize);
+        return;
+    }
+
+    this->fileRecords_ += this->pending_.size();
+    this->pending_.clear();
+}
+
+bool UserMetadataStore::hasPendingWrites() const
+{
+    std::shared_lock lock(this->mutex_);
+    return !this->pending_.empty();
+}
+
+void UserMetadataStore::compact()
+{
+    std::unique_lock lock(this->mutex_);
+    this->compactLocked();
+}
+
+void UserMetadataStore::compactLocked()
+{
+    auto expiry = QDateTime::currentSecsSinceEpoch() - EXPIRY_SECONDS;
+    std::erase_if(this->users_, [&](const auto &pair) {
+        const auto &user = pair.second;
+        return user.data.isEmpty() && user.lastSeen < expiry;
+    });
+    std::erase_if(this->logins_, [&](const auto &pair) {
+        return !this->users_.contains(pair.second);
+    });
+
+    QSaveFile file(this->path_);
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        qCWarning(chatterinoApp) << "Failed to compact user store"
+                                 << this->path_ << file.errorString();
+        return;
+    }
+
+    QDataStream stream(&file);
+    stream.setVersion(STREAM_VERSION);
+    writeHeader(stream);
+    for (const auto &[id, user] : this->users_)
+    {
+        writeRecord(stream, user);
+    }
+
+    if (stream.status() != QDataStream::Ok || !file.commit())
+    {
+        qCWarning(chatterinoApp) << "Failed to compact user store"
+                                 << this->path_ << file.errorString();
+        return;
+    }
+
+    this->fileRecords_ = this->users_.size();
+    this->pending_.clear();
+}
+
+size_t UserMetadataStore::size() const
+{
+    std::shared_lock lock(this->mutex_);
+    return this->users_.size();
+}
+
+size_t UserMetadataStore::fileRecords() const
+{
+    std::shared_lock lock(this->mutex_);
+    return this->fileRecords_;
+}
+
+}  // namespace chatterino
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "controllers/userdata/UserData.hpp"
+#include "util/QStringHash.hpp"
+
+#include <QColor>
+#include <QString>
+
+#include <functional>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace chatterino {
+
+/// Everything we know about a Twitch user
+struct UserMetadata {
+    /// The Twitch User ID (e.g. `117166826`)
+    QString id;
+    /// The Twitch User Login (e.g. `testaccount_420`)
+    QString login;
+    QString displayName;
+    QString profilePictureUrl;
+
+    /// The color the user picked on Twitch
+    std::optional<QColor> color;
+
+    /// Customizations made by the user of Chatterino (custom color and notes)
+    UserData data;
+
+    /// When the user was last seen in chat or looked up (seconds since epoch)
+    qint64 lastSeen = 0;
+    /// When the user was last fetched from Helix (seconds since epoch)
+    qint64 lastResolved = 0;
+
+    bool isEmpty() const
+    {
+        return this->login.isEmpty() && this->displayName.isEmpty() &&
+               this->profilePictureUrl.isEmpty() && !this->color.has_value() &&
+               this->data.isEmpty();
+    }
+
+    bool operator==(const UserMetadata &other) const = default;
+};
+
+/// @brief A persistent key-value store of UserMetadata keyed by user ID
+///
+/// All records are kept in memory. On disk, the store is a log of records
+/// where the last record of a user wins. Changed records are appended to the
+/// log on flush(), so a single change never rewrites the whole file. When
+/// opening the store, the file is memory-mapped and read in one pass. If most
+/// records in the log are outdated, the file is compacted.
+///
+/// Users that have no custom data and weren't seen for EXPIRY_SECONDS are
+/// dropped on compaction. This class is thread-safe.
+class UserMetadataStore
+{
+public:
+    /// Records without custom data expire after 90 days
+    static constexpr qint64 EXPIRY_SECONDS = 90LL * 24 * 60 * 60;
+
+    /// Opens the store at @a path, creating it if it doesn't exist
+    explicit UserMetadataStore(QString path);
+    /// Writes all pending changes
+    ~UserMetadataStore();
+
+    UserMetadataStore(const UserMetadataStore &) = delete;
+    UserMetadataStore(UserMetadataStore &&) = delete;
+    UserMetadataStore &operator=(const UserMetadataStore &) = delete;
+    UserMetadataStore &operator=(UserMetadataStore &&) = delete;
+
+    std::optional<UserMetadata> get(const QString &userID) const;
+    /// Looks up a user by their login (case-insensitive)
+    std::optional<UserMetadata> getByLogin(const QString &login) const;
+
+    /// @brief Changes the record of a user
+    ///
+    /// @a update is called with the current record of the user (or an empty
+    /// one). Records that end up empty are removed.
+    ///
+    /// @returns true if the record changed and will be written on the next
+    ///          flush()
+    bool update(const QString &userID,
+                const std::function<void(UserMetadata &)> &update);
+
+    /// Appends all changed records to the file
+    void flush();
+    bool hasPendingWrites() const;
+
+    /// Rewrites the file with the current records, dropping expired ones
+    void compact();
+
+    /// Number of stored users
+    size_t size() const;
+
+    /// Number of records in the file, including outdated ones
+    size_t fileRecords() const;
+
+private:
+    void load();
+    void compactLocked();
+    void setLocked(UserMetadata user);
+
+    const QString path_;
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<QString, UserMetadata> users_;
+    /// Lowercase login -> user ID
+    std::unordered_map<QString, QString> logins_;
+    /// IDs of users with changes that weren't written yet
+    std::unordered_set<QString> pending_;
+    size_t fileRecords_ = 0;
+};
+
+}  // namespace chatterino
@@ -0,0 +1,11 @@
+#include "debug/PerformanceCounters.hpp"
+
+namespace chatterino {
+
+PerformanceCounters &PerformanceCounters::instance()
+{
+    static PerformanceCounters counters;
+    return counters;
+}
+
+}  // namespace chatterino
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace chatterino {
+
+/// Process-wide counters shown in the performance popup.
+///
+/// Unlike `DebugCount`, these are plain atomics so they can be updated from
+/// hot paths and any thread without taking a lock or allocating strings.
+struct PerformanceCounters {
+    /// Original messages added to any channel
+    std::atomic<uint64_t> messagesIngested{0};
+
+    /// Filter results requested by views and the evaluations that actually
+    /// ran - the rest were shared through the FilterResultCache
+    std::atomic<uint64_t> filterEvaluationsRequested{0};
+    std::atomic<uint64_t> filterEvaluations{0};
+
+    /// Images that were requested but aren't decoded yet
+    std::atomic<int64_t> pendingImageLoads{0};
+
+    /// Images whose frames were decoded
+    std::atomic<uint64_t> imagesDecoded{0};
+
+    /// HTTP requests waiting for their host to be below its connection limit
+    std::atomic<int64_t> httpRequestsQueued{0};
+    /// HTTP requests that were sent and didn't finish yet
+    std::atomic<int64_t> httpRequestsRunning{0};
+    /// Finished HTTP requests and the total time they spent queued/running
+    std::atomic<uint64_t> httpRequestsFinished{0};
+    std::atomic<uint64_t> http2RequestsFinished{0};
+    std::atomic<uint64_t> httpQueueTimeMs{0};
+    std::atomic<uint64_t> httpRequestTimeMs{0};
+    /// HTTP requests that shared the transfer of an identical request
+    std::atomic<uint64_t> httpRequestsCoalesced{0};
+
+    /// Helix lookups waiting in the HelixScheduler
+    std::atomic<int64_t> helixLookupsQueued{0};
+    /// Batched Helix requests sent by the HelixScheduler
+    std::atomic<uint64_t> helixBatchesSent{0};
+    /// Completed lookups and the total time from queueing to completion
+    std::atomic<uint64_t> helixLookupsCompleted{0};
+    std::atomic<uint64_t> helixLookupLatencyMs{0};
+    /// Times the HelixScheduler had to wait for the rate limit
+    std::atomic<uint64_t> helixRateLimitWaits{0};
+
+    static PerformanceCounters &instance();
+};
+
+}  // namespace chatterino
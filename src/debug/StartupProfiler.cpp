@@ -0,0 +1,147 @@
+#include "debug/StartupProfiler.hpp"
+
+#include "common/QLogging.hpp"
+
+#include <QCoreApplication>
+#include <QEvent>
+#include <QThread>
+#include <QTimer>
+#include <QWidget>
+
+#include <algorithm>
+#include <mutex>
+
+namespace {
+
+using namespace chatterino;
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<StartupStepRecord> steps;
+};
+
+Registry &registry()
+{
+    static Registry instance;
+    return instance;
+}
+
+QString currentThreadName()
+{
+    auto *thread = QThread::currentThread();
+    auto *app = QCoreApplication::instance();
+    if (app != nullptr && thread == app->thread())
+    {
+        return QStringLiteral("GUI");
+    }
+    if (thread != nullptr && !thread->objectName().isEmpty())
+    {
+        return thread->objectName();
+    }
+    return QStringLiteral("Worker");
+}
+
+QString formatMs(int64_t ns)
+{
+    return QString("%1 ms").arg(static_cast<double>(ns) / 1e6, 9, 'f', 1);
+}
+
+/// Waits for the first paint event of the watched widget
+class FirstPaintFilter : public QObject
+{
+public:
+    using QObject::QObject;
+
+    bool eventFilter(QObject *watched, QEvent *event) override
+    {
+        if (event->type() == QEvent::Paint && !this->painted_)
+        {
+            this->painted_ = true;
+            auto firstPaint = trace::now();
+            watched->removeEventFilter(this);
+
+            // Print after the paint event finished
+            QTimer::singleShot(0, [firstPaint] {
+                auto report = startup::report(startup::steps(), firstPaint);
+                for (const auto &line : report.split('\n'))
+                {
+                    qCInfo(chatterinoApp).noquote() << line;
+                }
+            });
+            this->deleteLater();
+        }
+        return false;
+    }
+
+private:
+    bool painted_ = false;
+};
+
+}  // namespace
+
+namespace chatterino::startup {
+
+void record(const char *name, int64_t startNs, int64_t durationNs)
+{
+    auto thread = currentThreadName();
+
+    auto &reg = registry();
+    std::lock_guard lock(reg.mutex);
+    reg.steps.push_back({
+        .name = name,
+        .thread = std::move(thread),
+        .startNs = startNs,
+        .durationNs = durationNs,
+    });
+}
+
+std::vector<StartupStepRecord> steps()
+{
+    std::vector<StartupStepRecord> steps;
+    {
+        auto &reg = registry();
+        std::lock_guard lock(reg.mutex);
+        steps = reg.steps;
+    }
+
+    // Steps are recorded when they finish, so outer steps come after inner
+    // ones
+    std::ranges::stable_sort(steps, {}, &StartupStepRecord::startNs);
+    return steps;
+}
+
+QString report(const std::vector<StartupStepRecord> &steps,
+               int64_t firstPaintNs)
+{
+    if (steps.empty())
+    {
+        return QStringLiteral("No startup steps recorded");
+    }
+
+    auto origin = steps.front().startNs;
+    QStringList lines{
+        QString("Startup profile (first paint after %1)")
+            .arg(formatMs(firstPaintNs - origin).trimmed()),
+        QString("%1 %2  %3  %4")
+            .arg("start", 12)
+            .arg("duration", 12)
+            .arg("thread", -12)
+            .arg("step"),
+    };
+    for (const auto &step : steps)
+    {
+        lines.append(QString("%1 %2  %3  %4")
+                         .arg(formatMs(step.startNs - origin), 12)
+                         .arg(formatMs(step.durationNs), 12)
+                         .arg(step.thread, -12)
+                         .arg(step.name));
+    }
+    return lines.join('\n');
+}
+
+void printOnFirstPaint(QWidget *window)
+{
+    window->installEventFilter(new FirstPaintFilter(window));
+}
+
+}  // namespace chatterino::startup
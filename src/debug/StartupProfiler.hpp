@@ -0,0 +1,78 @@
+#pragma once
+
+#include "debug/Trace.hpp"
+
+#include <QString>
+
+#include <cstdint>
+#include <vector>
+
+class QWidget;
+
+namespace chatterino {
+
+/// A completed startup step
+struct StartupStepRecord {
+    const char *name{};
+    QString thread;
+    int64_t startNs{};
+    int64_t durationNs{};
+};
+
+/// Measures the steps between the start of `main` and the first paint of the
+/// main window.
+///
+/// Steps are recorded with `StartupStep` guards from any thread. Times use the
+/// trace clock (see trace::now()), so steps also show up in traces. With
+/// `--startup-profile`, the steps are printed once the main window painted.
+namespace startup {
+
+/// Records a completed step
+void record(const char *name, int64_t startNs, int64_t durationNs);
+
+/// All steps recorded so far, ordered by their start
+std::vector<StartupStepRecord> steps();
+
+/// Formats @a steps as a table with times relative to the first step
+QString report(const std::vector<StartupStepRecord> &steps,
+               int64_t firstPaintNs);
+
+/// Prints the report once @a window painted for the first time
+void printOnFirstPaint(QWidget *window);
+
+}  // namespace startup
+
+/// Records the time between its construction and destruction as a step.
+///
+/// @a name must point to a string with static storage duration.
+class StartupStep
+{
+public:
+    explicit StartupStep(const char *name)
+        : name_(name)
+        , start_(trace::now())
+    {
+    }
+
+    ~StartupStep()
+    {
+        auto duration = trace::now() - this->start_;
+        startup::record(this->name_, this->start_, duration);
+        if constexpr (trace::isCompiledIn())
+        {
+            trace::record(this->name_, "startup", this->start_, duration);
+        }
+    }
+
+    StartupStep(const StartupStep &) = delete;
+    StartupStep &operator=(const StartupStep &) = delete;
+
+    StartupStep(StartupStep &&) = delete;
+    StartupStep &operator=(StartupStep &&) = delete;
+
+private:
+    const char *name_;
+    int64_t start_;
+};
+
+}  // namespace chatterino
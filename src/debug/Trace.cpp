@@ -0,0 +1,254 @@
+#include "debug/Trace.hpp"
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QThread>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+using namespace chatterino;
+
+/// A single-producer ring buffer owned by one thread.
+///
+/// Only the owning thread writes `events` and `head`. Readers take a
+/// snapshot by reading `head` before and after copying and dropping anything
+/// that might've been overwritten in between.
+struct ThreadBuffer {
+    uint64_t threadID{};
+    QString threadName;
+
+    /// Total number of events ever written to this buffer
+    std::atomic<uint64_t> head{0};
+    /// Events before this index were cleared by trace::clear()
+    std::atomic<uint64_t> tail{0};
+
+    std::unique_ptr<TraceEvent[]> events;
+};
+
+struct Registry {
+    std::mutex mutex;
+    // Buffers are shared, so events of threads that already exited are kept
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    uint64_t nextThreadID = 1;
+};
+
+Registry &registry()
+{
+    static Registry instance;
+    return instance;
+}
+
+QString currentThreadName(uint64_t threadID)
+{
+    auto *thread = QThread::currentThread();
+    auto *app = QCoreApplication::instance();
+    if (app != nullptr && thread == app->thread())
+    {
+        return QStringLiteral("GUI");
+    }
+    if (thread != nullptr && !thread->objectName().isEmpty())
+    {
+        return thread->objectName();
+    }
+    return QStringLiteral("Thread %1").arg(threadID);
+}
+
+ThreadBuffer &currentBuffer()
+{
+    thread_local std::shared_ptr<ThreadBuffer> buffer = [] {
+        auto buf = std::make_shared<ThreadBuffer>();
+        buf->events = std::make_unique<TraceEvent[]>(trace::BUFFER_CAPACITY);
+
+        auto &reg = registry();
+        std::lock_guard lock(reg.mutex);
+        buf->threadID = reg.nextThreadID++;
+        buf->threadName = currentThreadName(buf->threadID);
+        reg.buffers.emplace_back(buf);
+        return buf;
+    }();
+    return *buffer;
+}
+
+std::vector<TraceEvent> snapshot(const ThreadBuffer &buf)
+{
+    auto head = buf.head.load(std::memory_order_acquire);
+    auto begin = std::max(buf.tail.load(std::memory_order_relaxed),
+                          head > trace::BUFFER_CAPACITY
+                              ? head - trace::BUFFER_CAPACITY
+                              : uint64_t{0});
+
+    std::vector<TraceEvent> events;
+    events.reserve(head - begin);
+    for (auto i = begin; i < head; i++)
+    {
+        events.emplace_back(buf.events[i % trace::BUFFER_CAPACITY]);
+    }
+
+    // The owning thread kept writing while we copied - drop everything that
+    // could've been overwritten.
+    auto newHead = buf.head.load(std::memory_order_acquire);
+    if (newHead > trace::BUFFER_CAPACITY)
+    {
+        auto firstValid = newHead - trace::BUFFER_CAPACITY;
+        if (firstValid > begin)
+        {
+            auto overwritten =
+                std::min<uint64_t>(firstValid - begin, events.size());
+            events.erase(events.begin(),
+                         events.begin() + static_cast<ptrdiff_t>(overwritten));
+        }
+    }
+
+    return events;
+}
+
+void appendEscaped(QByteArray &out, QByteArrayView str)
+{
+    for (char c : str)
+    {
+        if (c == '"' || c == '\\')
+        {
+            out.append('\\');
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            continue;
+        }
+        out.append(c);
+    }
+}
+
+/// Appends all events as Chrome trace JSON to @a out and returns the number
+/// of (non-metadata) events written.
+size_t writeJson(QByteArray &out)
+{
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+    {
+        auto &reg = registry();
+        std::lock_guard lock(reg.mutex);
+        buffers = reg.buffers;
+    }
+
+    auto pid = QByteArray::number(QCoreApplication::applicationPid());
+
+    size_t nEvents = 0;
+    out.append(R"({"displayTimeUnit":"ms","traceEvents":[)");
+    bool first = true;
+    auto beginEvent = [&] {
+        if (!first)
+        {
+            out.append(",\n");
+        }
+        first = false;
+    };
+
+    for (const auto &buf : buffers)
+    {
+        auto tid = QByteArray::number(buf->threadID);
+
+        beginEvent();
+        out.append(R"({"ph":"M","name":"thread_name","pid":)");
+        out.append(pid);
+        out.append(R"(,"tid":)");
+        out.append(tid);
+        out.append(R"(,"args":{"name":")");
+        appendEscaped(out, buf->threadName.toUtf8());
+        out.append(R"("}})");
+
+        for (const auto &event : snapshot(*buf))
+        {
+            beginEvent();
+            out.append(R"({"ph":"X","name":")");
+            appendEscaped(out, event.name);
+            out.append(R"(","cat":")");
+            appendEscaped(out, event.category);
+            out.append(R"(","ts":)");
+            out.append(
+                QByteArray::number(static_cast<double>(event.startNs) / 1000.0,
+                                   'f', 3));
+            out.append(R"(,"dur":)");
+            out.append(QByteArray::number(
+                static_cast<double>(event.durationNs) / 1000.0, 'f', 3));
+            out.append(R"(,"pid":)");
+            out.append(pid);
+            out.append(R"(,"tid":)");
+            out.append(tid);
+            out.append('}');
+            nEvents++;
+        }
+    }
+
+    out.append("]}\n");
+    return nEvents;
+}
+
+}  // namespace
+
+namespace chatterino::trace {
+
+int64_t now()
+{
+    static const auto epoch = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now() - epoch)
+        .count();
+}
+
+void record(const char *name, const char *category, int64_t startNs,
+            int64_t durationNs)
+{
+    auto &buf = currentBuffer();
+    auto idx = buf.head.load(std::memory_order_relaxed);
+    buf.events[idx % BUFFER_CAPACITY] = {
+        .name = name,
+        .category = category,
+        .startNs = startNs,
+        .durationNs = durationNs,
+    };
+    buf.head.store(idx + 1, std::memory_order_release);
+}
+
+void clear()
+{
+    auto &reg = registry();
+    std::lock_guard lock(reg.mutex);
+    for (const auto &buf : reg.buffers)
+    {
+        buf->tail.store(buf->head.load(std::memory_order_acquire),
+                        std::memory_order_relaxed);
+    }
+}
+
+QByteArray toChromeTraceJson()
+{
+    QByteArray out;
+    writeJson(out);
+    return out;
+}
+
+ExpectedStr<size_t> writeChromeTrace(const QString &path)
+{
+    QByteArray json;
+    auto nEvents = writeJson(json);
+
+    QFile file(path);
+    if (!file.open(QFile::WriteOnly | QFile::Truncate))
+    {
+        return makeUnexpected(file.errorString());
+    }
+    if (file.write(json) != json.size())
+    {
+        return makeUnexpected(file.errorString());
+    }
+
+    return nEvents;
+}
+
+}  // namespace chatterino::trace
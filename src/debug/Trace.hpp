@@ -0,0 +1,113 @@
+#pragma once
+
+#include "util/Expected.hpp"
+
+#include <QByteArray>
+#include <QString>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chatterino {
+
+/// A completed zone as it's stored in the per-thread buffers.
+///
+/// `name` and `category` must point to strings with static storage duration
+/// (usually string literals).
+struct TraceEvent {
+    const char *name{};
+    const char *category{};
+    int64_t startNs{};
+    int64_t durationNs{};
+};
+
+/// Low-overhead tracing of hot paths.
+///
+/// Every thread records into its own fixed-size ring buffer. Recording is
+/// lock-free and allocation-free after a thread's first zone. When a buffer
+/// is full, the oldest events are overwritten.
+///
+/// Zones are recorded with the `CHATTERINO_TRACE` macro which compiles to
+/// nothing unless Chatterino is built with `-DCHATTERINO_TRACING=On`.
+namespace trace {
+
+/// Number of events kept per thread
+inline constexpr size_t BUFFER_CAPACITY = 1 << 16;
+
+/// Returns whether zones are compiled into this build
+constexpr bool isCompiledIn()
+{
+#ifdef CHATTERINO_WITH_TRACING
+    return true;
+#else
+    return false;
+#endif
+}
+
+/// Nanoseconds since the trace epoch (monotonic)
+int64_t now();
+
+/// Records a completed zone in the calling thread's buffer
+void record(const char *name, const char *category, int64_t startNs,
+            int64_t durationNs);
+
+/// Drops all recorded events of all threads
+void clear();
+
+/// Serializes all recorded events to the Chrome trace event format
+/// (loadable in chrome://tracing or https://ui.perfetto.dev).
+QByteArray toChromeTraceJson();
+
+/// Writes the Chrome trace JSON to @a path.
+///
+/// @returns The number of events written or an error message
+ExpectedStr<size_t> writeChromeTrace(const QString &path);
+
+}  // namespace trace
+
+/// Records the time between its construction and destruction as a zone.
+class TraceZone
+{
+public:
+    TraceZone(const char *name, const char *category)
+        : name_(name)
+        , category_(category)
+        , start_(trace::now())
+    {
+    }
+
+    ~TraceZone()
+    {
+        trace::record(this->name_, this->category_, this->start_,
+                      trace::now() - this->start_);
+    }
+
+    TraceZone(const TraceZone &) = delete;
+    TraceZone &operator=(const TraceZone &) = delete;
+
+    TraceZone(TraceZone &&) = delete;
+    TraceZone &operator=(TraceZone &&) = delete;
+
+private:
+    const char *name_;
+    const char *category_;
+    int64_t start_;
+};
+
+}  // namespace chatterino
+
+#define CHATTERINO_TRACE_CONCAT_INNER(a, b) a##b
+#define CHATTERINO_TRACE_CONCAT(a, b) CHATTERINO_TRACE_CONCAT_INNER(a, b)
+
+#ifdef CHATTERINO_WITH_TRACING
+/// Traces the remainder of the current scope as a zone.
+///
+/// @param category One of "irc", "highlights", "filters", "layout", "paint",
+///                 "image", "network" (or any other string literal)
+/// @param name A string literal naming the zone
+#    define CHATTERINO_TRACE(category, name)                 \
+        ::chatterino::TraceZone CHATTERINO_TRACE_CONCAT( \
+            chatterinoTraceZone_, __LINE__)(name, category)
+#else
+#    define CHATTERINO_TRACE(category, name) static_cast<void>(0)
+#endif
@@ -4,6 +4,7 @@
 #include "common/Modes.hpp"
 #include "common/QLogging.hpp"
 #include "common/Version.hpp"
+#include "debug/StartupProfiler.hpp"
 #include "providers/IvrApi.hpp"
 #include "providers/NetworkConfigurationProvider.hpp"
 #include "providers/twitch/api/Helix.hpp"
@@ -34,7 +35,9 @@ using namespace chatterino;
 
 int main(int argc, char **argv)
 {
+    auto mainStart = trace::now();
     QApplication a(argc, argv);
+    startup::record("QApplication", mainStart, trace::now() - mainStart);
 
     QCoreApplication::setApplicationName("chatterino");
     QCoreApplication::setApplicationVersion(CHATTERINO_VERSION);
@@ -47,6 +50,7 @@ int main(int argc, char **argv)
 
     try
     {
+        StartupStep step("Paths");
         paths = std::make_unique<Paths>();
     }
     catch (std::runtime_error &error)
@@ -104,7 +108,7 @@ int main(int argc, char **argv)
     }
     else
     {
-        if (args.verbose)
+        if (args.verbose || args.startupProfile)
         {
             attachToConsole();
         }
@@ -128,7 +132,10 @@ int main(int argc, char **argv)
                               << QSslSocket::supportedProtocols();
 #endif
 
+        auto settingsStart = trace::now();
         Settings settings(args, paths->settingsDirectory);
+        startup::record("Settings", settingsStart,
+                        trace::now() - settingsStart);
 
         Updates updates(*paths, settings);
 
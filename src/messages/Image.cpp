@@ -7,6 +7,8 @@
 #include "common/QLogging.hpp"
 #include "debug/AssertInGuiThread.hpp"
 #include "debug/Benchmark.hpp"
+#include "debug/PerformanceCounters.hpp"
+#include "debug/Trace.hpp"
 #include "singletons/Emotes.hpp"
 #include "singletons/helper/GifTimer.hpp"
 #include "singletons/WindowManager.hpp"
@@ -19,6 +21,7 @@
 #include <QNetworkAccessManager>
 #include <QNetworkReply>
 #include <QNetworkRequest>
+#include <QScopeGuard>
 #include <QTimer>
 
 #include <atomic>
@@ -35,8 +38,9 @@ Frames::Frames()
     DebugCount::increase("images");
 }
 
-Frames::Frames(QList<Frame> &&frames)
+Frames::Frames(QList<Frame> &&frames, ImageProvider provider)
     : items_(std::move(frames))
+    , provider_(provider)
 {
     assertInGuiThread();
     DebugCount::increase("images");
@@ -74,8 +78,10 @@ Frames::Frames(QList<Frame> &&frames)
         this->processOffset();
     }
 
-    DebugCount::increase("image bytes", this->memoryUsage());
-    DebugCount::increase("image bytes (ever loaded)", this->memoryUsage());
+    auto bytes = this->memoryUsage();
+    DebugCount::increase("image bytes", bytes);
+    DebugCount::increase(imageBytesCounter(this->provider_), bytes);
+    DebugCount::increase("image bytes (ever loaded)", bytes);
 }
 
 Frames::~Frames()
@@ -91,8 +97,10 @@ Frames::~Frames()
     {
         DebugCount::decrease("animated images");
     }
-    DebugCount::decrease("image bytes", this->memoryUsage());
-    DebugCount::increase("image bytes (ever unloaded)", this->memoryUsage());
+    auto bytes = this->memoryUsage();
+    DebugCount::decrease("image bytes", bytes);
+    DebugCount::decrease(imageBytesCounter(this->provider_), bytes);
+    DebugCount::increase("image bytes (ever unloaded)", bytes);
 
     this->gifTimerConnection_.disconnect();
 }
@@ -147,8 +155,10 @@ void Frames::clear()
     {
         DebugCount::decrease("loaded images");
     }
-    DebugCount::decrease("image bytes", this->memoryUsage());
-    DebugCount::increase("image bytes (ever unloaded)", this->memoryUsage());
+    auto bytes = this->memoryUsage();
+    DebugCount::decrease("image bytes", bytes);
+    DebugCount::decrease(imageBytesCounter(this->provider_), bytes);
+    DebugCount::increase("image bytes (ever unloaded)", bytes);
 
     this->items_.clear();
     this->index_ = 0;
@@ -188,6 +198,10 @@ std::optional<QPixmap> Frames::first() const
 
 QList<Frame> readFrames(QImageReader &reader, const Url &url)
 {
+    CHATTERINO_TRACE("image", "readFrames");
+    PerformanceCounters::instance().imagesDecoded.fetch_add(
+        1, std::memory_order_relaxed);
+
     QList<Frame> frames;
     frames.reserve(reader.imageCount());
 
@@ -233,7 +247,8 @@ void assignFrames(std::weak_ptr<Image> weak, QList<Frame> parsed)
         {
             return;
         }
-        shared->frames_ = std::make_unique<detail::Frames>(std::move(parsed));
+        shared->frames_ = std::make_unique<detail::Frames>(std::move(parsed),
+                                                           shared->provider_);
 
         // Avoid too many layouts in one event-loop iteration
         //
@@ -264,9 +279,7 @@ namespace chatterino {
 // IMAGE2
 Image::~Image()
 {
-#ifndef DISABLE_IMAGE_EXPIRATION_POOL
-    ImageExpirationPool::instance().removeImagePtr(this);
-#endif
+    ImageRegistry::instance().remove(this->url_, this);
 
     if (this->empty_ && !this->frames_)
     {
@@ -289,19 +302,9 @@ Image::~Image()
 
 ImagePtr Image::fromUrl(const Url &url, qreal scale, QSize expectedSize)
 {
-    static std::unordered_map<Url, std::weak_ptr<Image>> cache;
-    static std::mutex mutex;
-
-    std::lock_guard<std::mutex> lock(mutex);
-
-    auto shared = cache[url].lock();
-
-    if (!shared)
-    {
-        cache[url] = shared = ImagePtr(new Image(url, scale, expectedSize));
-    }
-
-    return shared;
+    return ImageRegistry::instance().getOrCreate(url, [&] {
+        return ImagePtr(new Image(url, scale, expectedSize));
+    });
 }
 
 ImagePtr Image::fromResourcePixmap(const QPixmap &pixmap, qreal scale)
@@ -353,6 +356,7 @@ Image::Image()
 
 Image::Image(const Url &url, qreal scale, QSize expectedSize)
     : url_(url)
+    , provider_(imageProviderOf(url))
     , scale_(scale)
     , expectedSize_(expectedSize.isValid() ? expectedSize
                                            : (QSize(16, 16) * scale))
@@ -419,9 +423,6 @@ void Image::load() const
         Image *this2 = const_cast<Image *>(this);
         this2->shouldLoad_ = false;
         this2->actuallyLoad();
-#ifndef DISABLE_IMAGE_EXPIRATION_POOL
-        ImageExpirationPool::instance().addImagePtr(this2->shared_from_this());
-#endif
     }
 }
 
@@ -468,13 +469,26 @@ int Image::height() const
     return static_cast<int>(this->expectedSize_.height() * this->scale_);
 }
 
+QSize Image::expectedSize() const
+{
+    return this->expectedSize_;
+}
+
 void Image::actuallyLoad()
 {
     auto weak = weakOf(this);
+    PerformanceCounters::instance().pendingImageLoads.fetch_add(
+        1, std::memory_order_relaxed);
     NetworkRequest(this->url().string)
         .concurrent()
         .cache()
+        .priority(NetworkRequestPriority::Normal)
         .onSuccess([weak](auto result) {
+            auto decodeDone = qScopeGuard([] {
+                PerformanceCounters::instance().pendingImageLoads.fetch_sub(
+                    1, std::memory_order_relaxed);
+            });
+
             auto shared = weak.lock();
             if (!shared)
             {
@@ -526,6 +540,9 @@ void Image::actuallyLoad()
             assignFrames(shared, parsed);
         })
         .onError([weak](auto /*result*/) {
+            PerformanceCounters::instance().pendingImageLoads.fetch_sub(
+                1, std::memory_order_relaxed);
+
             auto shared = weak.lock();
             if (!shared)
             {
@@ -583,27 +600,14 @@ ImageExpirationPool &ImageExpirationPool::instance()
     return *instance;
 }
 
-void ImageExpirationPool::addImagePtr(ImagePtr imgPtr)
-{
-    std::lock_guard<std::mutex> lock(this->mutex_);
-    this->allImages_.emplace(imgPtr.get(), std::weak_ptr<Image>(imgPtr));
-}
-
-void ImageExpirationPool::removeImagePtr(Image *rawPtr)
-{
-    std::lock_guard<std::mutex> lock(this->mutex_);
-    this->allImages_.erase(rawPtr);
-}
-
 void ImageExpirationPool::freeAll()
 {
+    assertInGuiThread();
+    for (const auto &img : ImageRegistry::instance().images())
     {
-        std::lock_guard<std::mutex> lock(this->mutex_);
-        for (auto it = this->allImages_.begin(); it != this->allImages_.end();)
+        if (!img->frames_->empty())
         {
-            auto img = it->second.lock();
             img->expireFrames();
-            it = this->allImages_.erase(it);
         }
     }
     this->freeOld();
@@ -611,27 +615,21 @@ void ImageExpirationPool::freeAll()
 
 void ImageExpirationPool::freeOld()
 {
-    std::lock_guard<std::mutex> lock(this->mutex_);
+    assertInGuiThread();
 
     size_t numExpired = 0;
     size_t eligible = 0;
 
+    // Collect the images first, so no shard of the registry is locked while
+    // the last reference to an image might be dropped
+    auto images = ImageRegistry::instance().images();
+
     auto now = std::chrono::steady_clock::now();
-    for (auto it = this->allImages_.begin(); it != this->allImages_.end();)
+    for (const auto &img : images)
     {
-        auto img = it->second.lock();
-        if (!img)
-        {
-            // This can only really happen from a race condition because ~Image
-            // should remove itself from the ImageExpirationPool automatically.
-            it = this->allImages_.erase(it);
-            continue;
-        }
-
         if (img->frames_->empty())
         {
             // No frame data, nothing to do
-            ++it;
             continue;
         }
 
@@ -643,12 +641,7 @@ void ImageExpirationPool::freeOld()
         {
             ++numExpired;
             img->expireFrames();
-            // erase without mutex locking issue
-            it = this->allImages_.erase(it);
-            continue;
         }
-
-        ++it;
     }
 
 #    ifndef NDEBUG
@@ -657,7 +650,8 @@ void ImageExpirationPool::freeOld()
 #    endif
     DebugCount::set("last image gc: expired", numExpired);
     DebugCount::set("last image gc: eligible", eligible);
-    DebugCount::set("last image gc: left after gc", this->allImages_.size());
+    DebugCount::set("last image gc: left after gc", eligible - numExpired);
+    DebugCount::set("image registry entries", images.size());
 }
 
 #endif
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "common/Aliases.hpp"
+#include "messages/ImageRegistry.hpp"
 
 #include <boost/variant.hpp>
 #include <pajlada/signals/signal.hpp>
@@ -12,9 +13,7 @@
 
 #include <atomic>
 #include <chrono>
-#include <map>
 #include <memory>
-#include <mutex>
 #include <optional>
 
 namespace chatterino {
@@ -34,7 +33,8 @@ class Frames
 {
 public:
     Frames();
-    Frames(QList<Frame> &&frames);
+    Frames(QList<Frame> &&frames,
+           ImageProvider provider = ImageProvider::Other);
     ~Frames();
 
     Frames(const Frames &) = delete;
@@ -56,6 +56,7 @@ private:
     QList<Frame> items_;
     QList<Frame>::size_type index_{0};
     int durationOffset_{0};
+    ImageProvider provider_{ImageProvider::Other};
     pajlada::Signals::Connection gifTimerConnection_;
 };
 
@@ -98,6 +99,8 @@ public:
     bool isEmpty() const;
     int width() const;
     int height() const;
+    /// The size this image was expected to have when it was created
+    QSize expectedSize() const;
     bool animated() const;
 
     bool operator==(const Image &image) = delete;
@@ -113,6 +116,7 @@ private:
     void expireFrames();
 
     const Url url_{};
+    const ImageProvider provider_{ImageProvider::Other};
     const qreal scale_{1};
     /// @brief The expected size of this image once its loaded.
     ///
@@ -145,12 +149,10 @@ public:
     ImageExpirationPool();
     static ImageExpirationPool &instance();
 
-    void addImagePtr(ImagePtr imgPtr);
-    void removeImagePtr(Image *rawPtr);
-
     /**
      * @brief Frees frame data for all images that ImagePool deems to have expired.
      * 
+     * The images are taken from the ImageRegistry.
      * Expiration is based on last accessed time of the Image, stored in Image::lastUsed_.
      * Must be ran in the GUI thread.
      */
@@ -164,8 +166,6 @@ public:
 
     // Timer to periodically run freeOld()
     QTimer *freeTimer_;
-    std::map<Image *, std::weak_ptr<Image>> allImages_;
-    std::mutex mutex_;
 };
 
 #endif
@@ -0,0 +1,141 @@
+#include "messages/ImageRegistry.hpp"
+
+#include "util/DebugCount.hpp"
+
+#include <QStringView>
+
+namespace chatterino {
+
+ImageProvider imageProviderOf(const Url &url)
+{
+    QStringView rest = url.string;
+    auto schemeEnd = rest.indexOf(u"://");
+    if (schemeEnd >= 0)
+    {
+        rest = rest.mid(schemeEnd + 3);
+    }
+
+    auto pathStart = rest.indexOf(u'/');
+    auto host = pathStart < 0 ? rest : rest.left(pathStart);
+    auto path = pathStart < 0 ? QStringView{} : rest.mid(pathStart);
+
+    if (path.startsWith(u"/badge"))
+    {
+        return ImageProvider::Badges;
+    }
+    if (host.endsWith(u"jtvnw.net", Qt::CaseInsensitive))
+    {
+        return ImageProvider::Twitch;
+    }
+    if (host.endsWith(u"betterttv.net", Qt::CaseInsensitive))
+    {
+        return ImageProvider::Bttv;
+    }
+    if (host.endsWith(u"frankerfacez.com", Qt::CaseInsensitive))
+    {
+        return ImageProvider::Ffz;
+    }
+    if (host.endsWith(u"7tv.app", Qt::CaseInsensitive))
+    {
+        return ImageProvider::Seventv;
+    }
+    return ImageProvider::Other;
+}
+
+const QString &imageBytesCounter(ImageProvider provider)
+{
+    static const QString twitch = QStringLiteral("image bytes (Twitch)");
+    static const QString bttv = QStringLiteral("image bytes (BTTV)");
+    static const QString ffz = QStringLiteral("image bytes (FFZ)");
+    static const QString seventv = QStringLiteral("image bytes (7TV)");
+    static const QString badges = QStringLiteral("image bytes (badges)");
+    static const QString other = QStringLiteral("image bytes (other)");
+
+    switch (provider)
+    {
+        case ImageProvider::Twitch:
+            return twitch;
+        case ImageProvider::Bttv:
+            return bttv;
+        case ImageProvider::Ffz:
+            return ffz;
+        case ImageProvider::Seventv:
+            return seventv;
+        case ImageProvider::Badges:
+            return badges;
+        case ImageProvider::Other:
+            break;
+    }
+    return other;
+}
+
+ImageRegistry::ImageRegistry()
+{
+    for (auto provider : {ImageProvider::Twitch, ImageProvider::Bttv,
+                          ImageProvider::Ffz, ImageProvider::Seventv,
+                          ImageProvider::Badges, ImageProvider::Other})
+    {
+        DebugCount::configure(imageBytesCounter(provider),
+                              DebugCount::Flag::DataSize);
+    }
+}
+
+ImageRegistry &ImageRegistry::instance()
+{
+    // Leaked, so images destroyed during static destruction can still remove
+    // themselves
+    static auto *instance = new ImageRegistry;
+    return *instance;
+}
+
+void ImageRegistry::remove(const Url &url, const Image *image)
+{
+    auto &shard = this->shardFor(url);
+    std::lock_guard lock(shard.mutex);
+
+    auto it = shard.entries.find(url);
+    // The entry might already belong to a newer image for the same URL
+    if (it != shard.entries.end() && it->second.image == image)
+    {
+        shard.entries.erase(it);
+    }
+}
+
+std::vector<ImagePtr> ImageRegistry::images() const
+{
+    std::vector<ImagePtr> images;
+    images.reserve(this->size());
+
+    for (const auto &shard : this->shards_)
+    {
+        std::lock_guard lock(shard.mutex);
+        for (const auto &[url, entry] : shard.entries)
+        {
+            if (auto shared = entry.weak.lock())
+            {
+                images.emplace_back(std::move(shared));
+            }
+        }
+    }
+    return images;
+}
+
+size_t ImageRegistry::size() const
+{
+    size_t size = 0;
+    for (const auto &shard : this->shards_)
+    {
+        std::lock_guard lock(shard.mutex);
+        size += shard.entries.size();
+    }
+    return size;
+}
+
+ImageRegistry::Shard &ImageRegistry::shardFor(const Url &url)
+{
+    // The low bits of the hash pick the bucket in the shard's map
+    auto hash = std::hash<Url>{}(url);
+    return this->shards_[(hash >> 8) % SHARD_COUNT];
+}
+
+}  // namespace chatterino
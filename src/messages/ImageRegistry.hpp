@@ -0,0 +1,97 @@
+#pragma once
+
+#include "common/Aliases.hpp"
+
+#include <QString>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace chatterino {
+
+class Image;
+using ImagePtr = std::shared_ptr<Image>;
+
+/// The service an image was loaded from
+enum class ImageProvider : uint8_t {
+    Twitch,
+    Bttv,
+    Ffz,
+    Seventv,
+    /// Badges of any provider
+    Badges,
+    Other,
+};
+
+/// Guesses the provider of an image from the host and path of its URL
+ImageProvider imageProviderOf(const Url &url);
+
+/// The name of the DebugCount with the decoded bytes of images from
+/// @a provider
+const QString &imageBytesCounter(ImageProvider provider);
+
+/// @brief Maps URLs to the images loaded from them
+///
+/// The map is split into shards with their own mutex, so images looked up from
+/// multiple threads rarely wait for each other. An image removes its entry
+/// when it's destroyed, so the registry only holds entries of live images.
+///
+/// This class is thread safe.
+class ImageRegistry
+{
+public:
+    static constexpr size_t SHARD_COUNT = 16;
+
+    ImageRegistry();
+
+    static ImageRegistry &instance();
+
+    /// Returns the live image for @a url or registers the one returned by
+    /// @a create if there is none.
+    template <typename F>
+    ImagePtr getOrCreate(const Url &url, F &&create)
+    {
+        auto &shard = this->shardFor(url);
+        std::lock_guard lock(shard.mutex);
+
+        auto &entry = shard.entries[url];
+        auto shared = entry.weak.lock();
+        if (!shared)
+        {
+            // Either a new entry or one whose image is being destroyed
+            shared = create();
+            entry = Entry{.image = shared.get(), .weak = shared};
+        }
+        return shared;
+    }
+
+    /// Removes the entry for @a url if it still belongs to @a image
+    void remove(const Url &url, const Image *image);
+
+    /// All live images in the registry
+    std::vector<ImagePtr> images() const;
+
+    size_t size() const;
+
+private:
+    struct Entry {
+        const Image *image{};
+        std::weak_ptr<Image> weak;
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<Url, Entry> entries;
+    };
+
+    Shard &shardFor(const Url &url);
+
+    std::array<Shard, SHARD_COUNT> shards_;
+};
+
+}  // namespace chatterino
@@ -0,0 +1,30 @@
+#include "messages/MessageRouting.hpp"
+
+#include "messages/Message.hpp"
+#include "singletons/Settings.hpp"
+
+namespace chatterino {
+
+MessageRoutes routeMessage(const Message &message, MessageSinkTraits traits)
+{
+    MessageRoutes routes;
+
+    if (!message.flags.has(MessageFlag::Similar) ||
+        (!getSettings()->hideSimilar &&
+         getSettings()->shownSimilarTriggerHighlights))
+    {
+        routes.set(MessageRoute::Alert);
+    }
+
+    // Whispers don't need to be highlighted to show up in /mentions
+    if (message.flags.has(MessageFlag::ShowInMentions) &&
+        message.flags.hasAny(MessageFlag::Highlighted, MessageFlag::Whisper) &&
+        traits.has(MessageSinkTrait::AddMentionsToGlobalChannel))
+    {
+        routes.set(MessageRoute::Mentions);
+    }
+
+    return routes;
+}
+
+}  // namespace chatterino
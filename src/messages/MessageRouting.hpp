@@ -0,0 +1,35 @@
+#pragma once
+
+#include "common/FlagsEnum.hpp"
+#include "messages/MessageSink.hpp"
+
+#include <cstdint>
+
+namespace chatterino {
+
+struct Message;
+
+/// Consumers of a received message besides the channel it was received in
+enum class MessageRoute : std::uint8_t {
+    None = 0,
+
+    /// The sounds and alerts of the message's highlight should be triggered
+    Alert = 1 << 0,
+
+    /// The message should be added to the global mentions channel
+    Mentions = 1 << 1,
+};
+using MessageRoutes = FlagsEnum<MessageRoute>;
+
+/// @brief Decides where a received message goes
+///
+/// This is evaluated once per message, after its highlights were checked and
+/// similarity filters were applied. The decision only depends on the flags of
+/// the message and the traits of the sink it was received in, so consumers
+/// should check the returned routes instead of the flags.
+///
+/// @param message The received message
+/// @param traits The traits of the sink the message was received in
+MessageRoutes routeMessage(const Message &message, MessageSinkTraits traits);
+
+}  // namespace chatterino
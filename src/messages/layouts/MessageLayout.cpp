@@ -463,6 +463,17 @@ void MessageLayout::deleteCache()
 #endif
 }
 
+int64_t MessageLayout::bufferMemoryUsage() const
+{
+    if (this->buffer_ == nullptr)
+    {
+        return 0;
+    }
+
+    return static_cast<int64_t>(this->buffer_->width()) *
+           this->buffer_->height() * this->buffer_->depth() / 8;
+}
+
 // Elements
 //    assert(QThread::currentThread() == QApplication::instance()->thread());
 
@@ -65,6 +65,9 @@ public:
     void deleteBuffer();
     void deleteCache();
 
+    /// Bytes used by the pixmap buffer (0 if there's no buffer)
+    int64_t bufferMemoryUsage() const;
+
     /**
      * Returns a raw pointer to the element at the given point
      *
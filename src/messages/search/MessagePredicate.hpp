@@ -1,5 +1,7 @@
 #pragma once
 
+#include <QString>
+
 #include <memory>
 
 namespace chatterino {
@@ -38,6 +40,23 @@ public:
         return result;
     }
 
+    /**
+     * @brief Returns a substring that every message matching this predicate
+     *        contains in its `searchText` (case-insensitively)
+     *
+     * This is used to narrow down the messages to check with a search index.
+     * Predicates that don't require a specific substring return an empty
+     * string.
+     */
+    QString requiredSubstring() const
+    {
+        if (this->isNegated_)
+        {
+            return {};
+        }
+        return this->requiredSubstringImpl();
+    }
+
 protected:
     explicit MessagePredicate(bool negate)
         : isNegated_(negate)
@@ -55,6 +74,12 @@ protected:
      */
     virtual bool appliesToImpl(const Message &message) = 0;
 
+    /// See #requiredSubstring()
+    virtual QString requiredSubstringImpl() const
+    {
+        return {};
+    }
+
 private:
     const bool isNegated_ = false;
 };
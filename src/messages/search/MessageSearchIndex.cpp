@@ -0,0 +1,260 @@
+#include "messages/search/MessageSearchIndex.hpp"
+
+#include "messages/Message.hpp"
+
+#include <algorithm>
+
+namespace {
+
+using namespace chatterino;
+
+/// Evicted IDs are only removed from the posting lists once at least this many
+/// messages were evicted (or more than the index currently contains).
+constexpr size_t MIN_EVICTIONS_BEFORE_COMPACTION = 1024;
+
+/// Returns the sorted, unique trigrams of the case-folded @a text
+std::vector<uint64_t> collectTrigrams(const QString &text)
+{
+    std::vector<uint64_t> trigrams;
+    if (text.size() < MessageSearchIndex::MIN_QUERY_LENGTH)
+    {
+        return trigrams;
+    }
+
+    auto folded = text.toCaseFolded();
+    trigrams.reserve(static_cast<size_t>(folded.size() - 2));
+    for (qsizetype i = 0; i + 2 < folded.size(); i++)
+    {
+        trigrams.push_back((uint64_t{folded[i].unicode()} << 32) |
+                           (uint64_t{folded[i + 1].unicode()} << 16) |
+                           uint64_t{folded[i + 2].unicode()});
+    }
+
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()),
+                   trigrams.end());
+    return trigrams;
+}
+
+}  // namespace
+
+namespace chatterino {
+
+void MessageSearchIndex::append(const MessagePtr &message)
+{
+    std::lock_guard lock(this->mutex_);
+    if (!this->valid_)
+    {
+        return;
+    }
+
+    auto id = this->firstID_ + this->messages_.size();
+    this->messages_.push_back(message);
+    this->indexMessage(id, *message);
+}
+
+void MessageSearchIndex::evictFront()
+{
+    std::lock_guard lock(this->mutex_);
+    if (!this->valid_ || this->messages_.empty())
+    {
+        return;
+    }
+
+    this->messages_.pop_front();
+    this->firstID_++;
+    this->evictedSinceCompaction_++;
+
+    if (this->evictedSinceCompaction_ >=
+        std::max(MIN_EVICTIONS_BEFORE_COMPACTION, this->messages_.size()))
+    {
+        this->compact();
+    }
+}
+
+void MessageSearchIndex::replace(size_t index, const MessagePtr &prev,
+                                 const MessagePtr &replacement)
+{
+    std::lock_guard lock(this->mutex_);
+    if (!this->valid_)
+    {
+        return;
+    }
+
+    if (index >= this->messages_.size() || this->messages_[index] != prev)
+    {
+        this->valid_ = false;
+        return;
+    }
+
+    this->messages_[index] = replacement;
+    if (prev->searchText == replacement->searchText)
+    {
+        return;
+    }
+
+    // Trigrams of the previous text are kept - they only cause false
+    // candidates which are filtered out by the predicates.
+    auto id = this->firstID_ + index;
+    for (auto trigram : collectTrigrams(replacement->searchText))
+    {
+        auto &ids = this->postings_[trigram];
+        auto it = std::lower_bound(ids.begin(), ids.end(), id);
+        if (it == ids.end() || *it != id)
+        {
+            ids.insert(it, id);
+        }
+    }
+}
+
+void MessageSearchIndex::clear()
+{
+    std::lock_guard lock(this->mutex_);
+    this->messages_.clear();
+    this->postings_.clear();
+    this->firstID_ = 0;
+    this->evictedSinceCompaction_ = 0;
+    this->valid_ = true;
+}
+
+void MessageSearchIndex::invalidate()
+{
+    std::lock_guard lock(this->mutex_);
+    this->valid_ = false;
+    this->messages_.clear();
+    this->postings_.clear();
+}
+
+bool MessageSearchIndex::isValid() const
+{
+    std::lock_guard lock(this->mutex_);
+    return this->valid_;
+}
+
+void MessageSearchIndex::rebuild(
+    const LimitedQueueSnapshot<MessagePtr> &messages)
+{
+    std::lock_guard lock(this->mutex_);
+    this->messages_.clear();
+    this->postings_.clear();
+    this->firstID_ = 0;
+    this->evictedSinceCompaction_ = 0;
+
+    for (size_t i = 0; i < messages.size(); i++)
+    {
+        this->messages_.push_back(messages[i]);
+        this->indexMessage(i, *messages[i]);
+    }
+
+    this->valid_ = true;
+}
+
+std::vector<MessagePtr> MessageSearchIndex::candidates(
+    const QStringList &substrings) const
+{
+    std::lock_guard lock(this->mutex_);
+
+    std::vector<Trigram> trigrams;
+    for (const auto &substring : substrings)
+    {
+        auto collected = collectTrigrams(substring);
+        trigrams.insert(trigrams.end(), collected.begin(), collected.end());
+    }
+
+    if (trigrams.empty())
+    {
+        return std::vector<MessagePtr>(this->messages_.begin(),
+                                       this->messages_.end());
+    }
+
+    std::sort(trigrams.begin(), trigrams.end());
+    trigrams.erase(std::unique(trigrams.begin(), trigrams.end()),
+                   trigrams.end());
+
+    std::vector<const std::vector<MessageID> *> lists;
+    lists.reserve(trigrams.size());
+    for (auto trigram : trigrams)
+    {
+        auto it = this->postings_.find(trigram);
+        if (it == this->postings_.end())
+        {
+            return {};
+        }
+        lists.push_back(&it->second);
+    }
+
+    // Intersect starting with the shortest list, so every step is a binary
+    // search in the (potentially much) longer list.
+    std::sort(lists.begin(), lists.end(), [](const auto *a, const auto *b) {
+        return a->size() < b->size();
+    });
+
+    const auto &shortest = *lists.front();
+    std::vector<MessageID> ids(
+        std::lower_bound(shortest.begin(), shortest.end(), this->firstID_),
+        shortest.end());
+
+    for (size_t i = 1; i < lists.size() && !ids.empty(); i++)
+    {
+        const auto &list = *lists[i];
+        auto it = list.begin();
+        size_t kept = 0;
+        for (auto id : ids)
+        {
+            it = std::lower_bound(it, list.end(), id);
+            if (it == list.end())
+            {
+                break;
+            }
+            if (*it == id)
+            {
+                ids[kept++] = id;
+            }
+        }
+        ids.resize(kept);
+    }
+
+    std::vector<MessagePtr> result;
+    result.reserve(ids.size());
+    for (auto id : ids)
+    {
+        result.push_back(this->messages_[id - this->firstID_]);
+    }
+    return result;
+}
+
+size_t MessageSearchIndex::size() const
+{
+    std::lock_guard lock(this->mutex_);
+    return this->messages_.size();
+}
+
+void MessageSearchIndex::indexMessage(MessageID id, const Message &message)
+{
+    // IDs are handed out in increasing order, so the lists stay sorted
+    for (auto trigram : collectTrigrams(message.searchText))
+    {
+        this->postings_[trigram].push_back(id);
+    }
+}
+
+void MessageSearchIndex::compact()
+{
+    for (auto it = this->postings_.begin(); it != this->postings_.end();)
+    {
+        auto &ids = it->second;
+        ids.erase(ids.begin(),
+                  std::lower_bound(ids.begin(), ids.end(), this->firstID_));
+        if (ids.empty())
+        {
+            it = this->postings_.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    this->evictedSinceCompaction_ = 0;
+}
+
+}  // namespace chatterino
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "messages/LimitedQueueSnapshot.hpp"
+
+#include <QStringList>
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace chatterino {
+
+struct Message;
+using MessagePtr = std::shared_ptr<const Message>;
+
+/// @brief A trigram index over the `searchText` of a channel's messages
+///
+/// The index mirrors the channel's message queue: messages are appended at the
+/// back and evicted from the front, both of which are cheap. Any other
+/// structural change (e.g. messages inserted at the start) invalidates the
+/// index, which then has to be rebuilt before it's queried again.
+///
+/// Queries return a superset of the messages containing the searched
+/// substrings - the actual predicates still have to be checked on the
+/// candidates.
+class MessageSearchIndex
+{
+public:
+    /// Substrings shorter than this can't be looked up in the index
+    static constexpr qsizetype MIN_QUERY_LENGTH = 3;
+
+    void append(const MessagePtr &message);
+    void evictFront();
+    /// Replaces the message at @a index. If the index doesn't contain @a prev
+    /// at that position, it's invalidated.
+    void replace(size_t index, const MessagePtr &prev,
+                 const MessagePtr &replacement);
+    void clear();
+
+    /// Marks the index as out of sync with the channel
+    void invalidate();
+    bool isValid() const;
+    void rebuild(const LimitedQueueSnapshot<MessagePtr> &messages);
+
+    /// @brief Returns all messages that might contain every one of the
+    ///        @a substrings (case-insensitively), in order
+    ///
+    /// Substrings shorter than #MIN_QUERY_LENGTH don't narrow down the result.
+    std::vector<MessagePtr> candidates(const QStringList &substrings) const;
+
+    size_t size() const;
+
+private:
+    using Trigram = uint64_t;
+    using MessageID = uint64_t;
+
+    void indexMessage(MessageID id, const Message &message);
+    void compact();
+
+    mutable std::mutex mutex_;
+
+    /// The messages in the index. `messages_[i]` has the ID `firstID_ + i`.
+    std::deque<MessagePtr> messages_;
+    MessageID firstID_ = 0;
+
+    /// Sorted IDs of the messages containing each trigram. IDs of evicted
+    /// messages are removed lazily in #compact().
+    std::unordered_map<Trigram, std::vector<MessageID>> postings_;
+    size_t evictedSinceCompaction_ = 0;
+
+    bool valid_ = true;
+};
+
+}  // namespace chatterino
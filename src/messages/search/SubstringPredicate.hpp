@@ -36,6 +36,8 @@ protected:
      */
     bool appliesToImpl(const Message &message) override;
 
+    QString requiredSubstringImpl() const override;
+
 private:
     /// Holds the substring to search for in a message's `messageText`
     const QString search_;
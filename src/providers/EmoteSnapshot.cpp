@@ -0,0 +1,185 @@
+#include "providers/EmoteSnapshot.hpp"
+
+#include "Application.hpp"
+#include "common/QLogging.hpp"
+#include "messages/Image.hpp"
+#include "singletons/Paths.hpp"
+
+#include <QDataStream>
+#include <QFile>
+#include <QSaveFile>
+#include <QStringBuilder>
+#include <QThreadPool>
+
+namespace {
+
+using namespace chatterino;
+
+constexpr quint32 SNAPSHOT_MAGIC = 0x43454D53;  // CEMS
+/// Increase this when changing the format. Older snapshots are ignored.
+constexpr quint32 SNAPSHOT_VERSION = 1;
+
+QString snapshotPath(const QString &provider, const QString &key)
+{
+    return getApp()->getPaths().cacheFilePath(provider % u'.' % key %
+                                              u".emotes");
+}
+
+void writeImage(QDataStream &stream, const ImagePtr &image)
+{
+    if (!image || image->isEmpty())
+    {
+        stream << QString() << qreal{1} << QSize();
+        return;
+    }
+    stream << image->url().string << image->scale() << image->expectedSize();
+}
+
+ImagePtr readImage(QDataStream &stream)
+{
+    QString url;
+    qreal scale = 1;
+    QSize expectedSize;
+    stream >> url >> scale >> expectedSize;
+    if (url.isEmpty())
+    {
+        return Image::getEmpty();
+    }
+    return Image::fromUrl({url}, scale, expectedSize);
+}
+
+}  // namespace
+
+namespace chatterino {
+
+QString globalEmoteSnapshotKey()
+{
+    return QStringLiteral("global");
+}
+
+QString channelEmoteSnapshotKey(const QString &channelName)
+{
+    return u"channel." % channelName.toLower();
+}
+
+std::optional<EmoteSnapshot> readEmoteSnapshot(const QString &provider,
+                                               const QString &key)
+{
+    QFile file(snapshotPath(provider, key));
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return std::nullopt;
+    }
+
+    auto snapshot =
+        detail::deserializeEmoteSnapshot(qUncompress(file.readAll()));
+    if (!snapshot)
+    {
+        qCWarning(chatterinoCache)
+            << "Ignoring invalid emote snapshot" << provider << key;
+        return std::nullopt;
+    }
+
+    qCDebug(chatterinoCache) << "Loaded emote snapshot" << provider << key
+                             << "with" << snapshot->emotes.size() << "emotes";
+    return snapshot;
+}
+
+void writeEmoteSnapshot(const QString &provider, const QString &key,
+                        std::shared_ptr<const EmoteMap> emotes,
+                        const QByteArray &etag, const QStringList &extra)
+{
+    if (!emotes)
+    {
+        return;
+    }
+
+    QThreadPool::globalInstance()->start(
+        [path = snapshotPath(provider, key), emotes = std::move(emotes), etag,
+         extra] {
+            auto data = qCompress(
+                detail::serializeEmoteSnapshot(*emotes, etag, extra));
+
+            QSaveFile file(path);
+            if (!file.open(QIODevice::WriteOnly) ||
+                file.write(data) != data.size() || !file.commit())
+            {
+                qCWarning(chatterinoCache)
+                    << "Failed to write emote snapshot" << path;
+            }
+        });
+}
+
+QByteArray detail::serializeEmoteSnapshot(const EmoteMap &emotes,
+                                          const QByteArray &etag,
+                                          const QStringList &extra)
+{
+    QByteArray data;
+    QDataStream stream(&data, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_6_0);
+
+    stream << SNAPSHOT_MAGIC << SNAPSHOT_VERSION << etag << extra
+           << static_cast<quint32>(emotes.size());
+    for (const auto &[name, emote] : emotes)
+    {
+        stream << name.string << emote->name.string << emote->id.string
+               << emote->author.string << emote->tooltip.string
+               << emote->homePage.string << emote->zeroWidth
+               << emote->baseName.has_value()
+               << emote->baseName.value_or(EmoteName{}).string;
+        writeImage(stream, emote->images.getImage1());
+        writeImage(stream, emote->images.getImage2());
+        writeImage(stream, emote->images.getImage3());
+    }
+
+    return data;
+}
+
+std::optional<EmoteSnapshot> detail::deserializeEmoteSnapshot(
+    const QByteArray &data)
+{
+    QDataStream stream(data);
+    stream.setVersion(QDataStream::Qt_6_0);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    quint32 count = 0;
+    EmoteSnapshot snapshot;
+    stream >> magic >> version;
+    if (magic != SNAPSHOT_MAGIC || version != SNAPSHOT_VERSION)
+    {
+        return std::nullopt;
+    }
+    stream >> snapshot.etag >> snapshot.extra >> count;
+
+    for (quint32 i = 0; i < count && stream.status() == QDataStream::Ok; i++)
+    {
+        QString key;
+        Emote emote;
+        bool hasBaseName = false;
+        QString baseName;
+        stream >> key >> emote.name.string >> emote.id.string >>
+            emote.author.string >> emote.tooltip.string >>
+            emote.homePage.string >> emote.zeroWidth >> hasBaseName >>
+            baseName;
+        if (hasBaseName)
+        {
+            emote.baseName = EmoteName{baseName};
+        }
+        auto image1 = readImage(stream);
+        auto image2 = readImage(stream);
+        auto image3 = readImage(stream);
+        emote.images = ImageSet(image1, image2, image3);
+
+        snapshot.emotes[EmoteName{key}] =
+            std::make_shared<const Emote>(std::move(emote));
+    }
+
+    if (stream.status() != QDataStream::Ok)
+    {
+        return std::nullopt;
+    }
+    return snapshot;
+}
+
+}  // namespace chatterino
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "messages/Emote.hpp"
+
+#include <QByteArray>
+#include <QString>
+#include <QStringList>
+
+#include <memory>
+#include <optional>
+
+namespace chatterino {
+
+/// @brief A parsed emote set persisted in the cache directory
+///
+/// Snapshots are stored per provider for the global emotes and for every
+/// channel. They contain everything needed to recreate the emotes without
+/// parsing the provider's response again, so emotes can be shown as soon as a
+/// channel is created. The ETag of the response is kept to revalidate the
+/// snapshot in the background.
+struct EmoteSnapshot {
+    EmoteMap emotes;
+    /// ETag of the response the emotes were parsed from (might be empty)
+    QByteArray etag;
+    /// Provider specific data (e.g. the room ID the emotes belong to)
+    QStringList extra;
+};
+
+/// Provider names of the snapshots (used as directory names)
+inline const QString BTTV_SNAPSHOT_PROVIDER = QStringLiteral("betterttv");
+inline const QString FFZ_SNAPSHOT_PROVIDER = QStringLiteral("frankerfacez");
+inline const QString SEVENTV_SNAPSHOT_PROVIDER = QStringLiteral("seventv");
+
+/// Key of the snapshot of a provider's global emotes
+QString globalEmoteSnapshotKey();
+/// Key of the snapshot of a channel's emotes
+QString channelEmoteSnapshotKey(const QString &channelName);
+
+/// Reads a snapshot synchronously. Returns std::nullopt if there's no
+/// snapshot or it's in an unknown format.
+std::optional<EmoteSnapshot> readEmoteSnapshot(const QString &provider,
+                                               const QString &key);
+
+/// Writes a snapshot in the global thread pool
+void writeEmoteSnapshot(const QString &provider, const QString &key,
+                        std::shared_ptr<const EmoteMap> emotes,
+                        const QByteArray &etag, const QStringList &extra = {});
+
+namespace detail {
+
+    QByteArray serializeEmoteSnapshot(const EmoteMap &emotes,
+                                      const QByteArray &etag,
+                                      const QStringList &extra);
+    std::optional<EmoteSnapshot> deserializeEmoteSnapshot(
+        const QByteArray &data);
+
+}  // namespace detail
+
+}  // namespace chatterino
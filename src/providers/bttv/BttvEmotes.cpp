@@ -8,10 +8,11 @@
 #include "messages/Image.hpp"
 #include "messages/ImageSet.hpp"
 #include "messages/MessageBuilder.hpp"
+#include "providers/EmoteSnapshot.hpp"
 #include "providers/bttv/liveupdates/BttvLiveUpdateMessages.hpp"
 #include "providers/twitch/TwitchChannel.hpp"
 #include "singletons/Settings.hpp"
-#include "util/Helpers.hpp"
+#include "util/JsonStream.hpp"
 
 #include <QJsonArray>
 #include <QLoggingCategory>
@@ -60,16 +61,36 @@ EmotePtr cachedOrMake(Emote &&emote, const EmoteId &id)
     return cachedOrMakeEmotePtr(std::move(emote), cache, mutex, id);
 }
 
-std::pair<Outcome, EmoteMap> parseGlobalEmotes(const QJsonArray &jsonEmotes,
-                                               const EmoteMap &currentEmotes)
+/// Collects the global emotes while streaming the global emotes response
+class GlobalEmotesVisitor
 {
-    auto emotes = EmoteMap();
+public:
+    explicit GlobalEmotesVisitor(const EmoteMap &currentEmotes)
+        : currentEmotes_(currentEmotes)
+    {
+    }
 
-    for (auto jsonEmote : jsonEmotes)
+    void onValue(const JsonStreamPath &path, const JsonStreamValue &value)
     {
-        auto id = EmoteId{jsonEmote.toObject().value("id").toString()};
-        auto name = EmoteName{jsonEmote.toObject().value("code").toString()};
+        if (path.matches({"*", "id"}))
+        {
+            this->id_ = EmoteId{value.toString()};
+        }
+        else if (path.matches({"*", "code"}))
+        {
+            this->name_ = EmoteName{value.toString()};
+        }
+    }
+
+    void onEnd(const JsonStreamPath &path)
+    {
+        if (!path.matches({"*"}))
+        {
+            return;
+        }
 
+        const auto &id = this->id_;
+        const auto &name = this->name_;
         auto emote = Emote({
             name,
             ImageSet{
@@ -82,24 +103,37 @@ std::pair<Outcome, EmoteMap> parseGlobalEmotes(const QJsonArray &jsonEmotes,
             Url{EMOTE_LINK_FORMAT.arg(id.string)},
         });
 
-        emotes[name] = cachedOrMakeEmotePtr(std::move(emote), currentEmotes);
+        this->emotes[name] =
+            cachedOrMakeEmotePtr(std::move(emote), this->currentEmotes_);
+        this->id_ = {};
+        this->name_ = {};
     }
 
-    return {Success, std::move(emotes)};
-}
+    EmoteMap emotes;
 
-CreateEmoteResult createChannelEmote(const QString &channelDisplayName,
-                                     const QJsonObject &jsonEmote)
+private:
+    const EmoteMap &currentEmotes_;
+    EmoteId id_;
+    EmoteName name_;
+};
+
+std::pair<Outcome, EmoteMap> parseGlobalEmotes(const QByteArray &json,
+                                               const EmoteMap &currentEmotes)
 {
-    auto id = EmoteId{jsonEmote.value("id").toString()};
-    auto name = EmoteName{jsonEmote.value("code").toString()};
-    auto author = EmoteAuthor{
-        jsonEmote.value("user").toObject().value("displayName").toString()};
-    if (author.string.isEmpty())
+    GlobalEmotesVisitor visitor(currentEmotes);
+    if (!streamJson(json, visitor))
     {
-        author.string = jsonEmote["channel"].toString();
+        qCWarning(chatterinoBttv) << "Failed to parse global emotes";
+        return {Failure, {}};
     }
 
+    return {Success, std::move(visitor.emotes)};
+}
+
+CreateEmoteResult createChannelEmote(const QString &channelDisplayName,
+                                     const EmoteId &id, const EmoteName &name,
+                                     const EmoteAuthor &author)
+{
     auto emote = Emote({
         name,
         ImageSet{
@@ -122,6 +156,98 @@ CreateEmoteResult createChannelEmote(const QString &channelDisplayName,
     return {id, name, emote};
 }
 
+CreateEmoteResult createChannelEmote(const QString &channelDisplayName,
+                                     const QJsonObject &jsonEmote)
+{
+    auto id = EmoteId{jsonEmote.value("id").toString()};
+    auto name = EmoteName{jsonEmote.value("code").toString()};
+    auto author = EmoteAuthor{
+        jsonEmote.value("user").toObject().value("displayName").toString()};
+    if (author.string.isEmpty())
+    {
+        author.string = jsonEmote["channel"].toString();
+    }
+
+    return createChannelEmote(channelDisplayName, id, name, author);
+}
+
+/// Collects the channel and shared emotes while streaming a channel response
+class ChannelEmotesVisitor
+{
+public:
+    explicit ChannelEmotesVisitor(const QString &channelDisplayName)
+        : channelDisplayName_(channelDisplayName)
+    {
+    }
+
+    void onValue(const JsonStreamPath &path, const JsonStreamValue &value)
+    {
+        if (path.size() < 3 || path.indexAt(1) < 0 ||
+            (path.keyAt(0) != "channelEmotes" &&
+             path.keyAt(0) != "sharedEmotes"))
+        {
+            return;
+        }
+
+        if (path.matches({"id"}, 2))
+        {
+            this->id_ = EmoteId{value.toString()};
+        }
+        else if (path.matches({"code"}, 2))
+        {
+            this->name_ = EmoteName{value.toString()};
+        }
+        else if (path.matches({"user", "displayName"}, 2))
+        {
+            this->author_ = EmoteAuthor{value.toString()};
+        }
+        else if (path.matches({"channel"}, 2))
+        {
+            this->channel_ = value.toString();
+        }
+    }
+
+    void onEnd(const JsonStreamPath &path)
+    {
+        EmoteMap *target = nullptr;
+        if (path.matches({"channelEmotes", "*"}))
+        {
+            target = &this->channelEmotes;
+        }
+        else if (path.matches({"sharedEmotes", "*"}))
+        {
+            target = &this->sharedEmotes;
+        }
+        else
+        {
+            return;
+        }
+
+        if (this->author_.string.isEmpty())
+        {
+            this->author_.string = this->channel_;
+        }
+        auto emote = createChannelEmote(this->channelDisplayName_, this->id_,
+                                        this->name_, this->author_);
+        (*target)[emote.name] = cachedOrMake(std::move(emote.emote), emote.id);
+
+        this->id_ = {};
+        this->name_ = {};
+        this->author_ = {};
+        this->channel_.clear();
+    }
+
+    EmoteMap channelEmotes;
+    EmoteMap sharedEmotes;
+
+private:
+    const QString &channelDisplayName_;
+    EmoteId id_;
+    EmoteName name_;
+    EmoteAuthor author_;
+    QString channel_;
+};
+
 bool updateChannelEmote(Emote &emote, const QString &channelDisplayName,
                         const QJsonObject &jsonEmote)
 {
@@ -182,6 +308,24 @@ EmoteMap bttv::detail::parseChannelEmotes(const QJsonObject &jsonRoot,
     return emotes;
 }
 
+EmoteMap bttv::detail::parseChannelEmotes(const QByteArray &json,
+                                          const QString &channelDisplayName)
+{
+    ChannelEmotesVisitor visitor(channelDisplayName);
+    if (!streamJson(json, visitor))
+    {
+        qCWarning(chatterinoBttv) << "Failed to parse channel emotes";
+    }
+
+    // Shared emotes take precedence, like in the other overload
+    auto emotes = std::move(visitor.channelEmotes);
+    for (auto &[name, emote] : visitor.sharedEmotes)
+    {
+        emotes[name] = std::move(emote);
+    }
+    return emotes;
+}
+
 //
 // BttvEmotes
 //
@@ -221,25 +365,34 @@ void BttvEmotes::loadEmotes()
         return;
     }
 
-    readProviderEmotesCache("global", "betterttv", [this](const auto &jsonDoc) {
-        auto emotes = this->global_.get();
-        auto pair = parseGlobalEmotes(jsonDoc.array(), *emotes);
-        if (pair.first)
-        {
-            this->setEmotes(std::make_shared<EmoteMap>(std::move(pair.second)));
-        }
-    });
+    QByteArray etag;
+    if (auto snapshot = readEmoteSnapshot(BTTV_SNAPSHOT_PROVIDER,
+                                          globalEmoteSnapshotKey()))
+    {
+        this->setEmotes(
+            std::make_shared<EmoteMap>(std::move(snapshot->emotes)));
+        etag = std::move(snapshot->etag);
+    }
 
     NetworkRequest(QString(globalEmoteApiUrl))
         .timeout(30000)
+        .ifNoneMatch(etag)
         .onSuccess([this](auto result) {
-            writeProviderEmotesCache("global", "betterttv", result.getData());
+            if (result.status() == 304)
+            {
+                qCDebug(chatterinoBttv) << "Global BTTV emotes didn't change";
+                return;
+            }
+
             auto emotes = this->global_.get();
-            auto pair = parseGlobalEmotes(result.parseJsonArray(), *emotes);
+            auto pair = parseGlobalEmotes(result.getData(), *emotes);
             if (pair.first)
             {
-                this->setEmotes(
-                    std::make_shared<EmoteMap>(std::move(pair.second)));
+                auto map = std::make_shared<EmoteMap>(std::move(pair.second));
+                writeEmoteSnapshot(BTTV_SNAPSHOT_PROVIDER,
+                                   globalEmoteSnapshotKey(), map,
+                                   result.rawHeader("ETag"));
+                this->setEmotes(std::move(map));
             }
         })
         .onError([](auto result) {
@@ -254,21 +407,28 @@ void BttvEmotes::setEmotes(std::shared_ptr<const EmoteMap> emotes)
     this->global_.set(std::move(emotes));
 }
 
-void BttvEmotes::loadChannel(std::weak_ptr<Channel> channel,
-                             const QString &channelId,
-                             const QString &channelDisplayName,
-                             std::function<void(EmoteMap &&)> callback,
-                             bool manualRefresh, bool cacheHit)
+void BttvEmotes::loadChannel(
+    std::weak_ptr<Channel> channel, const QString &channelId,
+    const QString &channelDisplayName, const QByteArray &etag,
+    std::function<void(EmoteMap &&, QByteArray)> callback, bool manualRefresh,
+    bool cacheHit)
 {
     NetworkRequest(QString(bttvChannelEmoteApiUrl) + channelId)
         .timeout(20000)
+        .ifNoneMatch(etag)
         .onSuccess([callback = std::move(callback), channel, channelId,
                     channelDisplayName, manualRefresh](auto result) {
+            if (result.status() == 304)
+            {
+                qCDebug(chatterinoBttv)
+                    << "BTTV emotes for" << channelId << "didn't change";
+                return;
+            }
+
             auto emotes =
-                parseChannelEmotes(result.parseJson(), channelDisplayName);
+                parseChannelEmotes(result.getData(), channelDisplayName);
             bool hasEmotes = !emotes.empty();
-            writeProviderEmotesCache(channelId, "betterttv", result.getData());
-            callback(std::move(emotes));
+            callback(std::move(emotes), result.rawHeader("ETag"));
 
             if (auto shared = channel.lock(); manualRefresh)
             {
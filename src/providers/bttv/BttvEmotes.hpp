@@ -4,6 +4,7 @@
 #include "common/Atomic.hpp"
 
 #include <pajlada/signals/scoped-connection.hpp>
+#include <QByteArray>
 #include <QJsonObject>
 #include <QString>
 
@@ -27,6 +28,10 @@ namespace bttv::detail {
     EmoteMap parseChannelEmotes(const QJsonObject &jsonRoot,
                                 const QString &channelDisplayName);
 
+    /// Like the other overload, but parses @a json without building a DOM
+    EmoteMap parseChannelEmotes(const QByteArray &json,
+                                const QString &channelDisplayName);
+
 }  // namespace bttv::detail
 
 class BttvEmotes final
@@ -43,11 +48,14 @@ public:
     std::optional<EmotePtr> emote(const EmoteName &name) const;
     void loadEmotes();
     void setEmotes(std::shared_ptr<const EmoteMap> emotes);
-    static void loadChannel(std::weak_ptr<Channel> channel,
-                            const QString &channelId,
-                            const QString &channelDisplayName,
-                            std::function<void(EmoteMap &&)> callback,
-                            bool manualRefresh, bool cacheHit);
+    /// Loads the emotes of a channel. If @a etag is set and the emotes didn't
+    /// change, @a callback isn't called. @a callback receives the ETag of the
+    /// response.
+    static void loadChannel(
+        std::weak_ptr<Channel> channel, const QString &channelId,
+        const QString &channelDisplayName, const QByteArray &etag,
+        std::function<void(EmoteMap &&, QByteArray)> callback,
+        bool manualRefresh, bool cacheHit);
 
     /**
      * Adds an emote to the `channelEmoteMap`.
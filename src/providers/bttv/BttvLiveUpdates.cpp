@@ -10,8 +10,8 @@ namespace chatterino {
 
 using namespace chatterino::literals;
 
-BttvLiveUpdates::BttvLiveUpdates(QString host)
-    : BasicPubSubManager(std::move(host), u"BTTV"_s)
+BttvLiveUpdates::BttvLiveUpdates(QString host, WebSocketPool *pool)
+    : BasicPubSubManager(std::move(host), u"BTTV"_s, pool)
 {
 }
 
@@ -40,11 +40,10 @@ void BttvLiveUpdates::partChannel(const QString &id)
 }
 
 void BttvLiveUpdates::onMessage(
-    websocketpp::connection_hdl /*hdl*/,
-    BasicPubSubManager<BttvLiveUpdateSubscription>::WebsocketMessagePtr msg)
+    BasicPubSubClient<BttvLiveUpdateSubscription> & /*client*/,
+    const QByteArray &payload)
 {
-    const auto &payload = QString::fromStdString(msg->get_payload());
-    QJsonDocument jsonDoc(QJsonDocument::fromJson(payload.toUtf8()));
+    QJsonDocument jsonDoc(QJsonDocument::fromJson(payload));
 
     if (jsonDoc.isNull())
     {
@@ -18,7 +18,8 @@ class BttvLiveUpdates : public BasicPubSubManager<BttvLiveUpdateSubscription>
         pajlada::Signals::Signal<T>;  // type-id is vector<T, Alloc<T>>
 
 public:
-    BttvLiveUpdates(QString host);
+    /// @param pool The pool to open connections in (see BasicPubSubManager)
+    BttvLiveUpdates(QString host, WebSocketPool *pool = nullptr);
     ~BttvLiveUpdates() override;
 
     struct {
@@ -45,10 +46,8 @@ public:
     void partChannel(const QString &id);
 
 protected:
-    void onMessage(
-        websocketpp::connection_hdl hdl,
-        BasicPubSubManager<BttvLiveUpdateSubscription>::WebsocketMessagePtr msg)
-        override;
+    void onMessage(BasicPubSubClient<BttvLiveUpdateSubscription> &client,
+                   const QByteArray &payload) override;
 
 private:
     // Contains all joined Twitch channel-ids
@@ -0,0 +1,63 @@
+#include "providers/emoji/EmojiTable.hpp"
+
+#include <algorithm>
+
+namespace chatterino::emojitable {
+
+std::span<const Entry> entries()
+{
+    return {data::ENTRIES, data::ENTRY_COUNT};
+}
+
+std::span<const ShortCode> shortCodes()
+{
+    return {data::SHORT_CODES, data::SHORT_CODE_COUNT};
+}
+
+std::span<const uint16_t> sortedShortCodes()
+{
+    return {data::SORTED_SHORT_CODES, data::SHORT_CODE_COUNT};
+}
+
+std::span<const FirstUnit> startingWith(char16_t unit)
+{
+    std::span<const FirstUnit> all{data::FIRST_UNITS, data::FIRST_UNIT_COUNT};
+    auto [begin, end] =
+        std::ranges::equal_range(all, unit, {}, &FirstUnit::unit);
+    return {begin, end};
+}
+
+std::optional<size_t> findShortCode(QStringView name)
+{
+    auto bucket = hashShortCode(name, 0) % data::SHORT_CODE_BUCKET_COUNT;
+    auto slot = hashShortCode(name, data::SHORT_CODE_SEEDS[bucket]) %
+                data::SHORT_CODE_SLOT_COUNT;
+
+    const auto &shortCode = data::SHORT_CODES[data::SHORT_CODE_SLOTS[slot]];
+    if (name != QStringView(shortCode.name.data(),
+                            static_cast<qsizetype>(shortCode.name.size())))
+    {
+        return std::nullopt;
+    }
+    return shortCode.entry;
+}
+
+uint32_t hashShortCode(QStringView name, uint32_t seed)
+{
+    // FNV-1a followed by the MurmurHash3 finalizer
+    uint32_t hash = 2166136261U ^ seed;
+    for (auto c : name)
+    {
+        hash ^= c.unicode();
+        hash *= 16777619U;
+    }
+
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6BU;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35U;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+}  // namespace chatterino::emojitable
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <QStringView>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+
+/// @brief The emoji data from resources/emoji.json as static tables
+///
+/// The tables are generated by scripts/generate-emoji-table.py into
+/// EmojiTableData.cpp, so loading the emojis doesn't need to parse any JSON
+/// and the strings don't need to be allocated (see QString::fromRawData).
+namespace chatterino::emojitable {
+
+struct Entry {
+    /// UTF-16 representation of the emoji
+    std::u16string_view value;
+    /// UTF-16 representation of the non qualified emoji (might be empty)
+    std::u16string_view nonQualified;
+    /// i.e. 1F9D1-200D-1F4BB
+    std::u16string_view unifiedCode;
+    std::u16string_view nonQualifiedCode;
+    /// Index of the first short code in shortCodes()
+    uint16_t firstShortCode;
+    uint8_t shortCodeCount;
+    /// EmojiData::Capabilities
+    uint8_t capabilities;
+};
+
+struct ShortCode {
+    std::u16string_view name;
+    /// Index of the emoji in entries()
+    uint16_t entry;
+};
+
+struct FirstUnit {
+    char16_t unit;
+    /// Index of the emoji in entries()
+    uint16_t entry;
+};
+
+/// All emojis in the order of emoji.json. Every emoji is followed by its
+/// skin tone variations.
+std::span<const Entry> entries();
+
+/// The short codes of all emojis (see Entry::firstShortCode)
+std::span<const ShortCode> shortCodes();
+
+/// Indices into shortCodes() ordered by the name of the short code
+std::span<const uint16_t> sortedShortCodes();
+
+/// Emojis starting with the UTF-16 code unit @a unit, longest emojis first
+std::span<const FirstUnit> startingWith(char16_t unit);
+
+/// @brief Finds the emoji with the short code @a name
+///
+/// This uses a perfect hash of all short codes. If multiple emojis share a
+/// short code, the last one in entries() is returned.
+///
+/// @returns The index of the emoji in entries()
+std::optional<size_t> findShortCode(QStringView name);
+
+/// The hash used for the short code lookup. Must match the generator.
+uint32_t hashShortCode(QStringView name, uint32_t seed);
+
+namespace data {
+
+// Defined in EmojiTableData.cpp
+
+extern const Entry ENTRIES[];
+extern const size_t ENTRY_COUNT;
+
+extern const ShortCode SHORT_CODES[];
+extern const size_t SHORT_CODE_COUNT;
+
+extern const uint16_t SORTED_SHORT_CODES[];
+
+extern const FirstUnit FIRST_UNITS[];
+extern const size_t FIRST_UNIT_COUNT;
+
+/// Seeds of the perfect hash by bucket
+extern const uint32_t SHORT_CODE_SEEDS[];
+extern const size_t SHORT_CODE_BUCKET_COUNT;
+
+/// Indices into SHORT_CODES by slot
+extern const uint16_t SHORT_CODE_SLOTS[];
+extern const size_t SHORT_CODE_SLOT_COUNT;
+
+}  // namespace data
+
+}  // namespace chatterino::emojitable
@@ -0,0 +1,12177 @@
+// This file is generated by scripts/generate-emoji-table.py from
+// resources/emoji.json. Do not edit it manually.
+
+#include "providers/emoji/EmojiTable.hpp"
+
+#include <iterator>
+
+// clang-format off
+namespace chatterino::emojitable::data {
+
+const Entry ENTRIES[] = {
+    {u"#\uFE0F\u20E3", u"#\u20E3", u"0023-FE0F-20E3", u"0023-20E3", 0, 1, 7},
+    {u"*\uFE0F\u20E3", u"*\u20E3", u"002A-FE0F-20E3", u"002A-20E3", 1, 1, 7},
+    {u"0\uFE0F\u20E3", u"0\u20E3", u"0030-FE0F-20E3", u"0030-20E3", 2, 1, 7},
+    {u"1\uFE0F\u20E3", u"1\u20E3", u"0031-FE0F-20E3", u"0031-20E3", 3, 1, 7},
+    {u"2\uFE0F\u20E3", u"2\u20E3", u"0032-FE0F-20E3", u"0032-20E3", 4, 1, 7},
+    {u"3\uFE0F\u20E3", u"3\u20E3", u"0033-FE0F-20E3", u"0033-20E3", 5, 1, 7},
+    {u"4\uFE0F\u20E3", u"4\u20E3", u"0034-FE0F-20E3", u"0034-20E3", 6, 1, 7},
+    {u"5\uFE0F\u20E3", u"5\u20E3", u"0035-FE0F-20E3", u"0035-20E3", 7, 1, 7},
+    {u"6\uFE0F\u20E3", u"6\u20E3", u"0036-FE0F-20E3", u"0036-20E3", 8, 1, 7},
+    {u"7\uFE0F\u20E3", u"7\u20E3", u"0037-FE0F-20E3", u"0037-20E3", 9, 1, 7},
+    {u"8\uFE0F\u20E3", u"8\u20E3", u"0038-FE0F-20E3", u"0038-20E3", 10, 1, 7},
+    {u"9\uFE0F\u20E3", u"9\u20E3", u"0039-FE0F-20E3", u"0039-20E3", 11, 1, 7},
+    {u"\u00A9\uFE0F", u"\u00A9", u"00A9-FE0F", u"00A9", 12, 1, 7},
+    {u"\u00AE\uFE0F", u"\u00AE", u"00AE-FE0F", u"00AE", 13, 1, 7},
+    {u"\U0001F004", u"", u"1F004", u"", 14, 1, 15},
+    {u"\U0001F0CF", u"", u"1F0CF", u"", 15, 1, 15},
+    {u"\U0001F170\uFE0F", u"\U0001F170", u"1F170-FE0F", u"1F170", 16, 1, 15},
+    {u"\U0001F171\uFE0F", u"\U0001F171", u"1F171-FE0F", u"1F171", 17, 1, 15},
+    {u"\U0001F17E\uFE0F", u"\U0001F17E", u"1F17E-FE0F", u"1F17E", 18, 1, 15},
+    {u"\U0001F17F\uFE0F", u"\U0001F17F", u"1F17F-FE0F", u"1F17F", 19, 1, 15},
+    {u"\U0001F18E", u"", u"1F18E", u"", 20, 1, 15},
+    {u"\U0001F191", u"", u"1F191", u"", 21, 1, 15},
+    {u"\U0001F192", u"", u"1F192", u"", 22, 1, 15},
+    {u"\U0001F193", u"", u"1F193", u"", 23, 1, 15},
+    {u"\U0001F194", u"", u"1F194", u"", 24, 1, 15},
+    {u"\U0001F195", u"", u"1F195", u"", 25, 1, 15},
+    {u"\U0001F196", u"", u"1F196", u"", 26, 1, 15},
+    {u"\U0001F197", u"", u"1F197", u"", 27, 1, 15},
+    {u"\U0001F198", u"", u"1F198", u"", 28, 1, 15},
+    {u"\U0001F199", u"", u"1F199", u"", 29, 1, 15},
+    {u"\U0001F19A", u"", u"1F19A", u"", 30, 1, 15},
+    {u"\U0001F1E6\U0001F1E8", u"", u"1F1E6-1F1E8", u"", 31, 1, 15},
+    {u"\U0001F1E6\U0001F1E9", u"", u"1F1E6-1F1E9", u"", 32, 1, 15},
+    {u"\U0001F1E6\U0001F1EA", u"", u"1F1E6-1F1EA", u"", 33, 1, 15},
+    {u"\U0001F1E6\U0001F1EB", u"", u"1F1E6-1F1EB", u"", 34, 1, 15},
+    {u"\U0001F1E6\U0001F1EC", u"", u"1F1E6-1F1EC", u"", 35, 1, 15},
+    {u"\U0001F1E6\U0001F1EE", u"", u"1F1E6-1F1EE", u"", 36, 1, 15},
+    {u"\U0001F1E6\U0001F1F1", u"", u"1F1E6-1F1F1", u"", 37, 1, 15},
+    {u"\U0001F1E6\U0001F1F2", u"", u"1F1E6-1F1F2", u"", 38, 1, 15},
+    {u"\U0001F1E6\U0001F1F4", u"", u"1F1E6-1F1F4", u"", 39, 1, 15},
+    {u"\U0001F1E6\U0001F1F6", u"", u"1F1E6-1F1F6", u"", 40, 1, 15},
+    {u"\U0001F1E6\U0001F1F7", u"", u"1F1E6-1F1F7", u"", 41, 1, 15},
+    {u"\U0001F1E6\U0001F1F8", u"", u"1F1E6-1F1F8", u"", 42, 1, 15},
+    {u"\U0001F1E6\U0001F1F9", u"", u"1F1E6-1F1F9", u"", 43, 1, 15},
+    {u"\U0001F1E6\U0001F1FA", u"", u"1F1E6-1F1FA", u"", 44, 1, 15},
+    {u"\U0001F1E6\U0001F1FC", u"", u"1F1E6-1F1FC", u"", 45, 1, 15},
+    {u"\U0001F1E6\U0001F1FD", u"", u"1F1E6-1F1FD", u"", 46, 1, 15},
+    {u"\U0001F1E6\U0001F1FF", u"", u"1F1E6-1F1FF", u"", 47, 1, 15},
+    {u"\U0001F1E7\U0001F1E6", u"", u"1F1E7-1F1E6", u"", 48, 1, 15},
+    {u"\U0001F1E7\U0001F1E7", u"", u"1F1E7-1F1E7", u"", 49, 1, 15},
+    {u"\U0001F1E7\U0001F1E9", u"", u"1F1E7-1F1E9", u"", 50, 1, 15},
+    {u"\U0001F1E7\U0001F1EA", u"", u"1F1E7-1F1EA", u"", 51, 1, 15},
+    {u"\U0001F1E7\U0001F1EB", u"", u"1F1E7-1F1EB", u"", 52, 1, 15},
+    {u"\U0001F1E7\U0001F1EC", u"", u"1F1E7-1F1EC", u"", 53, 1, 15},
+    {u"\U0001F1E7\U0001F1ED", u"", u"1F1E7-1F1ED", u"", 54, 1, 15},
+    {u"\U0001F1E7\U0001F1EE", u"", u"1F1E7-1F1EE", u"", 55, 1, 15},
+    {u"\U0001F1E7\U0001F1EF", u"", u"1F1E7-1F1EF", u"", 56, 1, 15},
+    {u"\U0001F1E7\U0001F1F1", u"", u"1F1E7-1F1F1", u"", 57, 1, 15},
+    {u"\U0001F1E7\U0001F1F2", u"", u"1F1E7-1F1F2", u"", 58, 1, 15},
+    {u"\U0001F1E7\U0001F1F3", u"", u"1F1E7-1F1F3", u"", 59, 1, 15},
+    {u"\U0001F1E7\U0001F1F4", u"", u"1F1E7-1F1F4", u"", 60, 1, 15},
+    {u"\U0001F1E7\U0001F1F6", u"", u"1F1E7-1F1F6", u"", 61, 1, 15},
+    {u"\U0001F1E7\U0001F1F7", u"", u"1F1E7-1F1F7", u"", 62, 1, 15},
+    {u"\U0001F1E7\U0001F1F8", u"", u"1F1E7-1F1F8", u"", 63, 1, 15},
+    {u"\U0001F1E7\U0001F1F9", u"", u"1F1E7-1F1F9", u"", 64, 1, 15},
+    {u"\U0001F1E7\U0001F1FB", u"", u"1F1E7-1F1FB", u"", 65, 1, 15},
+    {u"\U0001F1E7\U0001F1FC", u"", u"1F1E7-1F1FC", u"", 66, 1, 15},
+    {u"\U0001F1E7\U0001F1FE", u"", u"1F1E7-1F1FE", u"", 67, 1, 15},
+    {u"\U0001F1E7\U0001F1FF", u"", u"1F1E7-1F1FF", u"", 68, 1, 15},
+    {u"\U0001F1E8\U0001F1E6", u"", u"1F1E8-1F1E6", u"", 69, 1, 15},
+    {u"\U0001F1E8\U0001F1E8", u"", u"1F1E8-1F1E8", u"", 70, 1, 15},
+    {u"\U0001F1E8\U0001F1E9", u"", u"1F1E8-1F1E9", u"", 71, 1, 15},
+    {u"\U0001F1E8\U0001F1EB", u"", u"1F1E8-1F1EB", u"", 72, 1, 15},
+    {u"\U0001F1E8\U0001F1EC", u"", u"1F1E8-1F1EC", u"", 73, 1, 15},
+    {u"\U0001F1E8\U0001F1ED", u"", u"1F1E8-1F1ED", u"", 74, 1, 15},
+    {u"\U0001F1E8\U0001F1EE", u"", u"1F1E8-1F1EE", u"", 75, 1, 15},
+    {u"\U0001F1E8\U0001F1F0", u"", u"1F1E8-1F1F0", u"", 76, 1, 15},
+    {u"\U0001F1E8\U0001F1F1", u"", u"1F1E8-1F1F1", u"", 77, 1, 15},
+    {u"\U0001F1E8\U0001F1F2", u"", u"1F1E8-1F1F2", u"", 78, 1, 15},
+    {u"\U0001F1E8\U0001F1F3", u"", u"1F1E8-1F1F3", u"", 79, 2, 15},
+    {u"\U0001F1E8\U0001F1F4", u"", u"1F1E8-1F1F4", u"", 81, 1, 15},
+    {u"\U0001F1E8\U0001F1F5", u"", u"1F1E8-1F1F5", u"", 82, 1, 15},
+    {u"\U0001F1E8\U0001F1F6", u"", u"1F1E8-1F1F6", u"", 83, 1, 7},
+    {u"\U0001F1E8\U0001F1F7", u"", u"1F1E8-1F1F7", u"", 84, 1, 15},
+    {u"\U0001F1E8\U0001F1FA", u"", u"1F1E8-1F1FA", u"", 85, 1, 15},
+    {u"\U0001F1E8\U0001F1FB", u"", u"1F1E8-1F1FB", u"", 86, 1, 15},
+    {u"\U0001F1E8\U0001F1FC", u"", u"1F1E8-1F1FC", u"", 87, 1, 15},
+    {u"\U0001F1E8\U0001F1FD", u"", u"1F1E8-1F1FD", u"", 88, 1, 15},
+    {u"\U0001F1E8\U0001F1FE", u"", u"1F1E8-1F1FE", u"", 89, 1, 15},
+    {u"\U0001F1E8\U0001F1FF", u"", u"1F1E8-1F1FF", u"", 90, 1, 15},
+    {u"\U0001F1E9\U0001F1EA", u"", u"1F1E9-1F1EA", u"", 91, 2, 15},
+    {u"\U0001F1E9\U0001F1EC", u"", u"1F1E9-1F1EC", u"", 93, 1, 15},
+    {u"\U0001F1E9\U0001F1EF", u"", u"1F1E9-1F1EF", u"", 94, 1, 15},
+    {u"\U0001F1E9\U0001F1F0", u"", u"1F1E9-1F1F0", u"", 95, 1, 15},
+    {u"\U0001F1E9\U0001F1F2", u"", u"1F1E9-1F1F2", u"", 96, 1, 15},
+    {u"\U0001F1E9\U0001F1F4", u"", u"1F1E9-1F1F4", u"", 97, 1, 15},
+    {u"\U0001F1E9\U0001F1FF", u"", u"1F1E9-1F1FF", u"", 98, 1, 15},
+    {u"\U0001F1EA\U0001F1E6", u"", u"1F1EA-1F1E6", u"", 99, 1, 15},
+    {u"\U0001F1EA\U0001F1E8", u"", u"1F1EA-1F1E8", u"", 100, 1, 15},
+    {u"\U0001F1EA\U0001F1EA", u"", u"1F1EA-1F1EA", u"", 101, 1, 15},
+    {u"\U0001F1EA\U0001F1EC", u"", u"1F1EA-1F1EC", u"", 102, 1, 15},
+    {u"\U0001F1EA\U0001F1ED", u"", u"1F1EA-1F1ED", u"", 103, 1, 15},
+    {u"\U0001F1EA\U0001F1F7", u"", u"1F1EA-1F1F7", u"", 104, 1, 15},
+    {u"\U0001F1EA\U0001F1F8", u"", u"1F1EA-1F1F8", u"", 105, 2, 15},
+    {u"\U0001F1EA\U0001F1F9", u"", u"1F1EA-1F1F9", u"", 107, 1, 15},
+    {u"\U0001F1EA\U0001F1FA", u"", u"1F1EA-1F1FA", u"", 108, 1, 15},
+    {u"\U0001F1EB\U0001F1EE", u"", u"1F1EB-1F1EE", u"", 109, 1, 15},
+    {u"\U0001F1EB\U0001F1EF", u"", u"1F1EB-1F1EF", u"", 110, 1, 15},
+    {u"\U0001F1EB\U0001F1F0", u"", u"1F1EB-1F1F0", u"", 111, 1, 15},
+    {u"\U0001F1EB\U0001F1F2", u"", u"1F1EB-1F1F2", u"", 112, 1, 15},
+    {u"\U0001F1EB\U0001F1F4", u"", u"1F1EB-1F1F4", u"", 113, 1, 15},
+    {u"\U0001F1EB\U0001F1F7", u"", u"1F1EB-1F1F7", u"", 114, 2, 15},
+    {u"\U0001F1EC\U0001F1E6", u"", u"1F1EC-1F1E6", u"", 116, 1, 15},
+    {u"\U0001F1EC\U0001F1E7", u"", u"1F1EC-1F1E7", u"", 117, 3, 15},
+    {u"\U0001F1EC\U0001F1E9", u"", u"1F1EC-1F1E9", u"", 120, 1, 15},
+    {u"\U0001F1EC\U0001F1EA", u"", u"1F1EC-1F1EA", u"", 121, 1, 15},
+    {u"\U0001F1EC\U0001F1EB", u"", u"1F1EC-1F1EB", u"", 122, 1, 15},
+    {u"\U0001F1EC\U0001F1EC", u"", u"1F1EC-1F1EC", u"", 123, 1, 15},
+    {u"\U0001F1EC\U0001F1ED", u"", u"1F1EC-1F1ED", u"", 124, 1, 15},
+    {u"\U0001F1EC\U0001F1EE", u"", u"1F1EC-1F1EE", u"", 125, 1, 15},
+    {u"\U0001F1EC\U0001F1F1", u"", u"1F1EC-1F1F1", u"", 126, 1, 15},
+    {u"\U0001F1EC\U0001F1F2", u"", u"1F1EC-1F1F2", u"", 127, 1, 15},
+    {u"\U0001F1EC\U0001F1F3", u"", u"1F1EC-1F1F3", u"", 128, 1, 15},
+    {u"\U0001F1EC\U0001F1F5", u"", u"1F1EC-1F1F5", u"", 129, 1, 15},
+    {u"\U0001F1EC\U0001F1F6", u"", u"1F1EC-1F1F6", u"", 130, 1, 15},
+    {u"\U0001F1EC\U0001F1F7", u"", u"1F1EC-1F1F7", u"", 131, 1, 15},
+    {u"\U0001F1EC\U0001F1F8", u"", u"1F1EC-1F1F8", u"", 132, 1, 15},
+    {u"\U0001F1EC\U0001F1F9", u"", u"1F1EC-1F1F9", u"", 133, 1, 15},
+    {u"\U0001F1EC\U0001F1FA", u"", u"1F1EC-1F1FA", u"", 134, 1, 15},
+    {u"\U0001F1EC\U0001F1FC", u"", u"1F1EC-1F1FC", u"", 135, 1, 15},
+    {u"\U0001F1EC\U0001F1FE", u"", u"1F1EC-1F1FE", u"", 136, 1, 15},
+    {u"\U0001F1ED\U0001F1F0", u"", u"1F1ED-1F1F0", u"", 137, 1, 15},
+    {u"\U0001F1ED\U0001F1F2", u"", u"1F1ED-1F1F2", u"", 138, 1, 15},
+    {u"\U0001F1ED\U0001F1F3", u"", u"1F1ED-1F1F3", u"", 139, 1, 15},
+    {u"\U0001F1ED\U0001F1F7", u"", u"1F1ED-1F1F7", u"", 140, 1, 15},
+    {u"\U0001F1ED\U0001F1F9", u"", u"1F1ED-1F1F9", u"", 141, 1, 15},
+    {u"\U0001F1ED\U0001F1FA", u"", u"1F1ED-1F1FA", u"", 142, 1, 15},
+    {u"\U0001F1EE\U0001F1E8", u"", u"1F1EE-1F1E8", u"", 143, 1, 15},
+    {u"\U0001F1EE\U0001F1E9", u"", u"1F1EE-1F1E9", u"", 144, 1, 15},
+    {u"\U0001F1EE\U0001F1EA", u"", u"1F1EE-1F1EA", u"", 145, 1, 15},
+    {u"\U0001F1EE\U0001F1F1", u"", u"1F1EE-1F1F1", u"", 146, 1, 15},
+    {u"\U0001F1EE\U0001F1F2", u"", u"1F1EE-1F1F2", u"", 147, 1, 15},
+    {u"\U0001F1EE\U0001F1F3", u"", u"1F1EE-1F1F3", u"", 148, 1, 15},
+    {u"\U0001F1EE\U0001F1F4", u"", u"1F1EE-1F1F4", u"", 149, 1, 15},
+    {u"\U0001F1EE\U0001F1F6", u"", u"1F1EE-1F1F6", u"", 150, 1, 15},
+    {u"\U0001F1EE\U0001F1F7", u"", u"1F1EE-1F1F7", u"", 151, 1, 15},
+    {u"\U0001F1EE\U0001F1F8", u"", u"1F1EE-1F1F8", u"", 152, 1, 15},
+    {u"\U0001F1EE\U0001F1F9", u"", u"1F1EE-1F1F9", u"", 153, 2, 15},
+    {u"\U0001F1EF\U0001F1EA", u"", u"1F1EF-1F1EA", u"", 155, 1, 15},
+    {u"\U0001F1EF\U0001F1F2", u"", u"1F1EF-1F1F2", u"", 156, 1, 15},
+    {u"\U0001F1EF\U0001F1F4", u"", u"1F1EF-1F1F4", u"", 157, 1, 15},
+    {u"\U0001F1EF\U0001F1F5", u"", u"1F1EF-1F1F5", u"", 158, 2, 15},
+    {u"\U0001F1F0\U0001F1EA", u"", u"1F1F0-1F1EA", u"", 160, 1, 15},
+    {u"\U0001F1F0\U0001F1EC", u"", u"1F1F0-1F1EC", u"", 161, 1, 15},
+    {u"\U0001F1F0\U0001F1ED", u"", u"1F1F0-1F1ED", u"", 162, 1, 15},
+    {u"\U0001F1F0\U0001F1EE", u"", u"1F1F0-1F1EE", u"", 163, 1, 15},
+    {u"\U0001F1F0\U0001F1F2", u"", u"1F1F0-1F1F2", u"", 164, 1, 15},
+    {u"\U0001F1F0\U0001F1F3", u"", u"1F1F0-1F1F3", u"", 165, 1, 15},
+    {u"\U0001F1F0\U0001F1F5", u"", u"1F1F0-1F1F5", u"", 166, 1, 15},
+    {u"\U0001F1F0\U0001F1F7", u"", u"1F1F0-1F1F7", u"", 167, 2, 15},
+    {u"\U0001F1F0\U0001F1FC", u"", u"1F1F0-1F1FC", u"", 169, 1, 15},
+    {u"\U0001F1F0\U0001F1FE", u"", u"1F1F0-1F1FE", u"", 170, 1, 15},
+    {u"\U0001F1F0\U0001F1FF", u"", u"1F1F0-1F1FF", u"", 171, 1, 15},
+    {u"\U0001F1F1\U0001F1E6", u"", u"1F1F1-1F1E6", u"", 172, 1, 15},
+    {u"\U0001F1F1\U0001F1E7", u"", u"1F1F1-1F1E7", u"", 173, 1, 15},
+    {u"\U0001F1F1\U0001F1E8", u"", u"1F1F1-1F1E8", u"", 174, 1, 15},
+    {u"\U0001F1F1\U0001F1EE", u"", u"1F1F1-1F1EE", u"", 175, 1, 15},
+    {u"\U0001F1F1\U0001F1F0", u"", u"1F1F1-1F1F0", u"", 176, 1, 15},
+    {u"\U0001F1F1\U0001F1F7", u"", u"1F1F1-1F1F7", u"", 177, 1, 15},
+    {u"\U0001F1F1\U0001F1F8", u"", u"1F1F1-1F1F8", u"", 178, 1, 15},
+    {u"\U0001F1F1\U0001F1F9", u"", u"1F1F1-1F1F9", u"", 179, 1, 15},
+    {u"\U0001F1F1\U0001F1FA", u"", u"1F1F1-1F1FA", u"", 180, 1, 15},
+    {u"\U0001F1F1\U0001F1FB", u"", u"1F1F1-1F1FB", u"", 181, 1, 15},
+    {u"\U0001F1F1\U0001F1FE", u"", u"1F1F1-1F1FE", u"", 182, 1, 15},
+    {u"\U0001F1F2\U0001F1E6", u"", u"1F1F2-1F1E6", u"", 183, 1, 15},
+    {u"\U0001F1F2\U0001F1E8", u"", u"1F1F2-1F1E8", u"", 184, 1, 15},
+    {u"\U0001F1F2\U0001F1E9", u"", u"1F1F2-1F1E9", u"", 185, 1, 15},
+    {u"\U0001F1F2\U0001F1EA", u"", u"1F1F2-1F1EA", u"", 186, 1, 15},
+    {u"\U0001F1F2\U0001F1EB", u"", u"1F1F2-1F1EB", u"", 187, 1, 15},
+    {u"\U0001F1F2\U0001F1EC", u"", u"1F1F2-1F1EC", u"", 188, 1, 15},
+    {u"\U0001F1F2\U0001F1ED", u"", u"1F1F2-1F1ED", u"", 189, 1, 15},
+    {u"\U0001F1F2\U0001F1F0", u"", u"1F1F2-1F1F0", u"", 190, 1, 15},
+    {u"\U0001F1F2\U0001F1F1", u"", u"1F1F2-1F1F1", u"", 191, 1, 15},
+    {u"\U0001F1F2\U0001F1F2", u"", u"1F1F2-1F1F2", u"", 192, 1, 15},
+    {u"\U0001F1F2\U0001F1F3", u"", u"1F1F2-1F1F3", u"", 193, 1, 15},
+    {u"\U0001F1F2\U0001F1F4", u"", u"1F1F2-1F1F4", u"", 194, 1, 15},
+    {u"\U0001F1F2\U0001F1F5", u"", u"1F1F2-1F1F5", u"", 195, 1, 15},
+    {u"\U0001F1F2\U0001F1F6", u"", u"1F1F2-1F1F6", u"", 196, 1, 15},
+    {u"\U0001F1F2\U0001F1F7", u"", u"1F1F2-1F1F7", u"", 197, 1, 15},
+    {u"\U0001F1F2\U0001F1F8", u"", u"1F1F2-1F1F8", u"", 198, 1, 15},
+    {u"\U0001F1F2\U0001F1F9", u"", u"1F1F2-1F1F9", u"", 199, 1, 15},
+    {u"\U0001F1F2\U0001F1FA", u"", u"1F1F2-1F1FA", u"", 200, 1, 15},
+    {u"\U0001F1F2\U0001F1FB", u"", u"1F1F2-1F1FB", u"", 201, 1, 15},
+    {u"\U0001F1F2\U0001F1FC", u"", u"1F1F2-1F1FC", u"", 202, 1, 15},
+    {u"\U0001F1F2\U0001F1FD", u"", u"1F1F2-1F1FD", u"", 203, 1, 15},
+    {u"\U0001F1F2\U0001F1FE", u"", u"1F1F2-1F1FE", u"", 204, 1, 15},
+    {u"\U0001F1F2\U0001F1FF", u"", u"1F1F2-1F1FF", u"", 205, 1, 15},
+    {u"\U0001F1F3\U0001F1E6", u"", u"1F1F3-1F1E6", u"", 206, 1, 15},
+    {u"\U0001F1F3\U0001F1E8", u"", u"1F1F3-1F1E8", u"", 207, 1, 15},
+    {u"\U0001F1F3\U0001F1EA", u"", u"1F1F3-1F1EA", u"", 208, 1, 15},
+    {u"\U0001F1F3\U0001F1EB", u"", u"1F1F3-1F1EB", u"", 209, 1, 15},
+    {u"\U0001F1F3\U0001F1EC", u"", u"1F1F3-1F1EC", u"", 210, 1, 15},
+    {u"\U0001F1F3\U0001F1EE", u"", u"1F1F3-1F1EE", u"", 211, 1, 15},
+    {u"\U0001F1F3\U0001F1F1", u"", u"1F1F3-1F1F1", u"", 212, 1, 15},
+    {u"\U0001F1F3\U0001F1F4", u"", u"1F1F3-1F1F4", u"", 213, 1, 15},
+    {u"\U0001F1F3\U0001F1F5", u"", u"1F1F3-1F1F5", u"", 214, 1, 15},
+    {u"\U0001F1F3\U0001F1F7", u"", u"1F1F3-1F1F7", u"", 215, 1, 15},
+    {u"\U0001F1F3\U0001F1FA", u"", u"1F1F3-1F1FA", u"", 216, 1, 15},
+    {u"\U0001F1F3\U0001F1FF", u"", u"1F1F3-1F1FF", u"", 217, 1, 15},
+    {u"\U0001F1F4\U0001F1F2", u"", u"1F1F4-1F1F2", u"", 218, 1, 15},
+    {u"\U0001F1F5\U0001F1E6", u"", u"1F1F5-1F1E6", u"", 219, 1, 15},
+    {u"\U0001F1F5\U0001F1EA", u"", u"1F1F5-1F1EA", u"", 220, 1, 15},
+    {u"\U0001F1F5\U0001F1EB", u"", u"1F1F5-1F1EB", u"", 221, 1, 15},
+    {u"\U0001F1F5\U0001F1EC", u"", u"1F1F5-1F1EC", u"", 222, 1, 15},
+    {u"\U0001F1F5\U0001F1ED", u"", u"1F1F5-1F1ED", u"", 223, 1, 15},
+    {u"\U0001F1F5\U0001F1F0", u"", u"1F1F5-1F1F0", u"", 224, 1, 15},
+    {u"\U0001F1F5\U0001F1F1", u"", u"1F1F5-1F1F1", u"", 225, 1, 15},
+    {u"\U0001F1F5\U0001F1F2", u"", u"1F1F5-1F1F2", u"", 226, 1, 15},
+    {u"\U0001F1F5\U0001F1F3", u"", u"1F1F5-1F1F3", u"", 227, 1, 15},
+    {u"\U0001F1F5\U0001F1F7", u"", u"1F1F5-1F1F7", u"", 228, 1, 15},
+    {u"\U0001F1F5\U0001F1F8", u"", u"1F1F5-1F1F8", u"", 229, 1, 15},
+    {u"\U0001F1F5\U0001F1F9", u"", u"1F1F5-1F1F9", u"", 230, 1, 15},
+    {u"\U0001F1F5\U0001F1FC", u"", u"1F1F5-1F1FC", u"", 231, 1, 15},
+    {u"\U0001F1F5\U0001F1FE", u"", u"1F1F5-1F1FE", u"", 232, 1, 15},
+    {u"\U0001F1F6\U0001F1E6", u"", u"1F1F6-1F1E6", u"", 233, 1, 15},
+    {u"\U0001F1F7\U0001F1EA", u"", u"1F1F7-1F1EA", u"", 234, 1, 15},
+    {u"\U0001F1F7\U0001F1F4", u"", u"1F1F7-1F1F4", u"", 235, 1, 15},
+    {u"\U0001F1F7\U0001F1F8", u"", u"1F1F7-1F1F8", u"", 236, 1, 15},
+    {u"\U0001F1F7\U0001F1FA", u"", u"1F1F7-1F1FA", u"", 237, 2, 15},
+    {u"\U0001F1F7\U0001F1FC", u"", u"1F1F7-1F1FC", u"", 239, 1, 15},
+    {u"\U0001F1F8\U0001F1E6", u"", u"1F1F8-1F1E6", u"", 240, 1, 15},
+    {u"\U0001F1F8\U0001F1E7", u"", u"1F1F8-1F1E7", u"", 241, 1, 15},
+    {u"\U0001F1F8\U0001F1E8", u"", u"1F1F8-1F1E8", u"", 242, 1, 15},
+    {u"\U0001F1F8\U0001F1E9", u"", u"1F1F8-1F1E9", u"", 243, 1, 15},
+    {u"\U0001F1F8\U0001F1EA", u"", u"1F1F8-1F1EA", u"", 244, 1, 15},
+    {u"\U0001F1F8\U0001F1EC", u"", u"1F1F8-1F1EC", u"", 245, 1, 15},
+    {u"\U0001F1F8\U0001F1ED", u"", u"1F1F8-1F1ED", u"", 246, 1, 15},
+    {u"\U0001F1F8\U0001F1EE", u"", u"1F1F8-1F1EE", u"", 247, 1, 15},
+    {u"\U0001F1F8\U0001F1EF", u"", u"1F1F8-1F1EF", u"", 248, 1, 15},
+    {u"\U0001F1F8\U0001F1F0", u"", u"1F1F8-1F1F0", u"", 249, 1, 15},
+    {u"\U0001F1F8\U0001F1F1", u"", u"1F1F8-1F1F1", u"", 250, 1, 15},
+    {u"\U0001F1F8\U0001F1F2", u"", u"1F1F8-1F1F2", u"", 251, 1, 15},
+    {u"\U0001F1F8\U0001F1F3", u"", u"1F1F8-1F1F3", u"", 252, 1, 15},
+    {u"\U0001F1F8\U0001F1F4", u"", u"1F1F8-1F1F4", u"", 253, 1, 15},
+    {u"\U0001F1F8\U0001F1F7", u"", u"1F1F8-1F1F7", u"", 254, 1, 15},
+    {u"\U0001F1F8\U0001F1F8", u"", u"1F1F8-1F1F8", u"", 255, 1, 15},
+    {u"\U0001F1F8\U0001F1F9", u"", u"1F1F8-1F1F9", u"", 256, 1, 15},
+    {u"\U0001F1F8\U0001F1FB", u"", u"1F1F8-1F1FB", u"", 257, 1, 15},
+    {u"\U0001F1F8\U0001F1FD", u"", u"1F1F8-1F1FD", u"", 258, 1, 15},
+    {u"\U0001F1F8\U0001F1FE", u"", u"1F1F8-1F1FE", u"", 259, 1, 15},
+    {u"\U0001F1F8\U0001F1FF", u"", u"1F1F8-1F1FF", u"", 260, 1, 15},
+    {u"\U0001F1F9\U0001F1E6", u"", u"1F1F9-1F1E6", u"", 261, 1, 15},
+    {u"\U0001F1F9\U0001F1E8", u"", u"1F1F9-1F1E8", u"", 262, 1, 15},
+    {u"\U0001F1F9\U0001F1E9", u"", u"1F1F9-1F1E9", u"", 263, 1, 15},
+    {u"\U0001F1F9\U0001F1EB", u"", u"1F1F9-1F1EB", u"", 264, 1, 15},
+    {u"\U0001F1F9\U0001F1EC", u"", u"1F1F9-1F1EC", u"", 265, 1, 15},
+    {u"\U0001F1F9\U0001F1ED", u"", u"1F1F9-1F1ED", u"", 266, 1, 15},
+    {u"\U0001F1F9\U0001F1EF", u"", u"1F1F9-1F1EF", u"", 267, 1, 15},
+    {u"\U0001F1F9\U0001F1F0", u"", u"1F1F9-1F1F0", u"", 268, 1, 15},
+    {u"\U0001F1F9\U0001F1F1", u"", u"1F1F9-1F1F1", u"", 269, 1, 15},
+    {u"\U0001F1F9\U0001F1F2", u"", u"1F1F9-1F1F2", u"", 270, 1, 15},
+    {u"\U0001F1F9\U0001F1F3", u"", u"1F1F9-1F1F3", u"", 271, 1, 15},
+    {u"\U0001F1F9\U0001F1F4", u"", u"1F1F9-1F1F4", u"", 272, 1, 15},
+    {u"\U0001F1F9\U0001F1F7", u"", u"1F1F9-1F1F7", u"", 273, 1, 15},
+    {u"\U0001F1F9\U0001F1F9", u"", u"1F1F9-1F1F9", u"", 274, 1, 15},
+    {u"\U0001F1F9\U0001F1FB", u"", u"1F1F9-1F1FB", u"", 275, 1, 15},
+    {u"\U0001F1F9\U0001F1FC", u"", u"1F1F9-1F1FC", u"", 276, 1, 15},
+    {u"\U0001F1F9\U0001F1FF", u"", u"1F1F9-1F1FF", u"", 277, 1, 15},
+    {u"\U0001F1FA\U0001F1E6", u"", u"1F1FA-1F1E6", u"", 278, 1, 15},
+    {u"\U0001F1FA\U0001F1EC", u"", u"1F1FA-1F1EC", u"", 279, 1, 15},
+    {u"\U0001F1FA\U0001F1F2", u"", u"1F1FA-1F1F2", u"", 280, 1, 15},
+    {u"\U0001F1FA\U0001F1F3", u"", u"1F1FA-1F1F3", u"", 281, 1, 15},
+    {u"\U0001F1FA\U0001F1F8", u"", u"1F1FA-1F1F8", u"", 282, 2, 15},
+    {u"\U0001F1FA\U0001F1FE", u"", u"1F1FA-1F1FE", u"", 284, 1, 15},
+    {u"\U0001F1FA\U0001F1FF", u"", u"1F1FA-1F1FF", u"", 285, 1, 15},
+    {u"\U0001F1FB\U0001F1E6", u"", u"1F1FB-1F1E6", u"", 286, 1, 15},
+    {u"\U0001F1FB\U0001F1E8", u"", u"1F1FB-1F1E8", u"", 287, 1, 15},
+    {u"\U0001F1FB\U0001F1EA", u"", u"1F1FB-1F1EA", u"", 288, 1, 15},
+    {u"\U0001F1FB\U0001F1EC", u"", u"1F1FB-1F1EC", u"", 289, 1, 15},
+    {u"\U0001F1FB\U0001F1EE", u"", u"1F1FB-1F1EE", u"", 290, 1, 15},
+    {u"\U0001F1FB\U0001F1F3", u"", u"1F1FB-1F1F3", u"", 291, 1, 15},
+    {u"\U0001F1FB\U0001F1FA", u"", u"1F1FB-1F1FA", u"", 292, 1, 15},
+    {u"\U0001F1FC\U0001F1EB", u"", u"1F1FC-1F1EB", u"", 293, 1, 15},
+    {u"\U0001F1FC\U0001F1F8", u"", u"1F1FC-1F1F8", u"", 294, 1, 15},
+    {u"\U0001F1FD\U0001F1F0", u"", u"1F1FD-1F1F0", u"", 295, 1, 15},
+    {u"\U0001F1FE\U0001F1EA", u"", u"1F1FE-1F1EA", u"", 296, 1, 15},
+    {u"\U0001F1FE\U0001F1F9", u"", u"1F1FE-1F1F9", u"", 297, 1, 15},
+    {u"\U0001F1FF\U0001F1E6", u"", u"1F1FF-1F1E6", u"", 298, 1, 15},
+    {u"\U0001F1FF\U0001F1F2", u"", u"1F1FF-1F1F2", u"", 299, 1, 15},
+    {u"\U0001F1FF\U0001F1FC", u"", u"1F1FF-1F1FC", u"", 300, 1, 15},
+    {u"\U0001F201", u"", u"1F201", u"", 301, 1, 15},
+    {u"\U0001F202\uFE0F", u"\U0001F202", u"1F202-FE0F", u"1F202", 302, 1, 15},
+    {u"\U0001F21A", u"", u"1F21A", u"", 303, 1, 15},
+    {u"\U0001F22F", u"", u"1F22F", u"", 304, 1, 15},
+    {u"\U0001F232", u"", u"1F232", u"", 305, 1, 15},
+    {u"\U0001F233", u"", u"1F233", u"", 306, 1, 15},
+    {u"\U0001F234", u"", u"1F234", u"", 307, 1, 15},
+    {u"\U0001F235", u"", u"1F235", u"", 308, 1, 15},
+    {u"\U0001F236", u"", u"1F236", u"", 309, 1, 15},
+    {u"\U0001F237\uFE0F", u"\U0001F237", u"1F237-FE0F", u"1F237", 310, 1, 15},
+    {u"\U0001F238", u"", u"1F238", u"", 311, 1, 15},
+    {u"\U0001F239", u"", u"1F239", u"", 312, 1, 15},
+    {u"\U0001F23A", u"", u"1F23A", u"", 313, 1, 15},
+    {u"\U0001F250", u"", u"1F250", u"", 314, 1, 15},
+    {u"\U0001F251", u"", u"1F251", u"", 315, 1, 15},
+    {u"\U0001F300", u"", u"1F300", u"", 316, 1, 15},
+    {u"\U0001F301", u"", u"1F301", u"", 317, 1, 15},
+    {u"\U0001F302", u"", u"1F302", u"", 318, 1, 15},
+    {u"\U0001F303", u"", u"1F303", u"", 319, 1, 15},
+    {u"\U0001F304", u"", u"1F304", u"", 320, 1, 15},
+    {u"\U0001F305", u"", u"1F305", u"", 321, 1, 15},
+    {u"\U0001F306", u"", u"1F306", u"", 322, 1, 15},
+    {u"\U0001F307", u"", u"1F307", u"", 323, 1, 15},
+    {u"\U0001F308", u"", u"1F308", u"", 324, 1, 15},
+    {u"\U0001F309", u"", u"1F309", u"", 325, 1, 15},
+    {u"\U0001F30A", u"", u"1F30A", u"", 326, 1, 15},
+    {u"\U0001F30B", u"", u"1F30B", u"", 327, 1, 15},
+    {u"\U0001F30C", u"", u"1F30C", u"", 328, 1, 15},
+    {u"\U0001F30D", u"", u"1F30D", u"", 329, 1, 15},
+    {u"\U0001F30E", u"", u"1F30E", u"", 330, 1, 15},
+    {u"\U0001F30F", u"", u"1F30F", u"", 331, 1, 15},
+    {u"\U0001F310", u"", u"1F310", u"", 332, 1, 15},
+    {u"\U0001F311", u"", u"1F311", u"", 333, 1, 15},
+    {u"\U0001F312", u"", u"1F312", u"", 334, 1, 15},
+    {u"\U0001F313", u"", u"1F313", u"", 335, 1, 15},
+    {u"\U0001F314", u"", u"1F314", u"", 336, 2, 15},
+    {u"\U0001F315", u"", u"1F315", u"", 338, 1, 15},
+    {u"\U0001F316", u"", u"1F316", u"", 339, 1, 15},
+    {u"\U0001F317", u"", u"1F317", u"", 340, 1, 15},
+    {u"\U0001F318", u"", u"1F318", u"", 341, 1, 15},
+    {u"\U0001F319", u"", u"1F319", u"", 342, 1, 15},
+    {u"\U0001F31A", u"", u"1F31A", u"", 343, 1, 15},
+    {u"\U0001F31B", u"", u"1F31B", u"", 344, 1, 15},
+    {u"\U0001F31C", u"", u"1F31C", u"", 345, 1, 15},
+    {u"\U0001F31D", u"", u"1F31D", u"", 346, 1, 15},
+    {u"\U0001F31E", u"", u"1F31E", u"", 347, 1, 15},
+    {u"\U0001F31F", u"", u"1F31F", u"", 348, 1, 15},
+    {u"\U0001F320", u"", u"1F320", u"", 349, 1, 15},
+    {u"\U0001F321\uFE0F", u"\U0001F321", u"1F321-FE0F", u"1F321", 350, 1, 15},
+    {u"\U0001F324\uFE0F", u"\U0001F324", u"1F324-FE0F", u"1F324", 351, 2, 15},
+    {u"\U0001F325\uFE0F", u"\U0001F325", u"1F325-FE0F", u"1F325", 353, 2, 15},
+    {u"\U0001F326\uFE0F", u"\U0001F326", u"1F326-FE0F", u"1F326", 355, 2, 15},
+    {u"\U0001F327\uFE0F", u"\U0001F327", u"1F327-FE0F", u"1F327", 357, 1, 15},
+    {u"\U0001F328\uFE0F", u"\U0001F328", u"1F328-FE0F", u"1F328", 358, 1, 15},
+    {u"\U0001F329\uFE0F", u"\U0001F329", u"1F329-FE0F", u"1F329", 359, 2, 15},
+    {u"\U0001F32A\uFE0F", u"\U0001F32A", u"1F32A-FE0F", u"1F32A", 361, 2, 15},
+    {u"\U0001F32B\uFE0F", u"\U0001F32B", u"1F32B-FE0F", u"1F32B", 363, 1, 15},
+    {u"\U0001F32C\uFE0F", u"\U0001F32C", u"1F32C-FE0F", u"1F32C", 364, 1, 15},
+    {u"\U0001F32D", u"", u"1F32D", u"", 365, 1, 15},
+    {u"\U0001F32E", u"", u"1F32E", u"", 366, 1, 15},
+    {u"\U0001F32F", u"", u"1F32F", u"", 367, 1, 15},
+    {u"\U0001F330", u"", u"1F330", u"", 368, 1, 15},
+    {u"\U0001F331", u"", u"1F331", u"", 369, 1, 15},
+    {u"\U0001F332", u"", u"1F332", u"", 370, 1, 15},
+    {u"\U0001F333", u"", u"1F333", u"", 371, 1, 15},
+    {u"\U0001F334", u"", u"1F334", u"", 372, 1, 15},
+    {u"\U0001F335", u"", u"1F335", u"", 373, 1, 15},
+    {u"\U0001F336\uFE0F", u"\U0001F336", u"1F336-FE0F", u"1F336", 374, 1, 15},
+    {u"\U0001F337", u"", u"1F337", u"", 375, 1, 15},
+    {u"\U0001F338", u"", u"1F338", u"", 376, 1, 15},
+    {u"\U0001F339", u"", u"1F339", u"", 377, 1, 15},
+    {u"\U0001F33A", u"", u"1F33A", u"", 378, 1, 15},
+    {u"\U0001F33B", u"", u"1F33B", u"", 379, 1, 15},
+    {u"\U0001F33C", u"", u"1F33C", u"", 380, 1, 15},
+    {u"\U0001F33D", u"", u"1F33D", u"", 381, 1, 15},
+    {u"\U0001F33E", u"", u"1F33E", u"", 382, 1, 15},
+    {u"\U0001F33F", u"", u"1F33F", u"", 383, 1, 15},
+    {u"\U0001F340", u"", u"1F340", u"", 384, 1, 15},
+    {u"\U0001F341", u"", u"1F341", u"", 385, 1, 15},
+    {u"\U0001F342", u"", u"1F342", u"", 386, 1, 15},
+    {u"\U0001F343", u"", u"1F343", u"", 387, 1, 15},
+    {u"\U0001F344\u200D\U0001F7EB", u"", u"1F344-200D-1F7EB", u"", 388, 1, 7},
+    {u"\U0001F344", u"", u"1F344", u"", 389, 1, 15},
+    {u"\U0001F345", u"", u"1F345", u"", 390, 1, 15},
+    {u"\U0001F346", u"", u"1F346", u"", 391, 1, 15},
+    {u"\U0001F347", u"", u"1F347", u"", 392, 1, 15},
+    {u"\U0001F348", u"", u"1F348", u"", 393, 1, 15},
+    {u"\U0001F349", u"", u"1F349", u"", 394, 1, 15},
+    {u"\U0001F34A", u"", u"1F34A", u"", 395, 1, 15},
+    {u"\U0001F34B\u200D\U0001F7E9", u"", u"1F34B-200D-1F7E9", u"", 396, 1, 7},
+    {u"\U0001F34B", u"", u"1F34B", u"", 397, 1, 15},
+    {u"\U0001F34C", u"", u"1F34C", u"", 398, 1, 15},
+    {u"\U0001F34D", u"", u"1F34D", u"", 399, 1, 15},
+    {u"\U0001F34E", u"", u"1F34E", u"", 400, 1, 15},
+    {u"\U0001F34F", u"", u"1F34F", u"", 401, 1, 15},
+    {u"\U0001F350", u"", u"1F350", u"", 402, 1, 15},
+    {u"\U0001F351", u"", u"1F351", u"", 403, 1, 15},
+    {u"\U0001F352", u"", u"1F352", u"", 404, 1, 15},
+    {u"\U0001F353", u"", u"1F353", u"", 405, 1, 15},
+    {u"\U0001F354", u"", u"1F354", u"", 406, 1, 15},
+    {u"\U0001F355", u"", u"1F355", u"", 407, 1, 15},
+    {u"\U0001F356", u"", u"1F356", u"", 408, 1, 15},
+    {u"\U0001F357", u"", u"1F357", u"", 409, 1, 15},
+    {u"\U0001F358", u"", u"1F358", u"", 410, 1, 15},
+    {u"\U0001F359", u"", u"1F359", u"", 411, 1, 15},
+    {u"\U0001F35A", u"", u"1F35A", u"", 412, 1, 15},
+    {u"\U0001F35B", u"", u"1F35B", u"", 413, 1, 15},
+    {u"\U0001F35C", u"", u"1F35C", u"", 414, 1, 15},
+    {u"\U0001F35D", u"", u"1F35D", u"", 415, 1, 15},
+    {u"\U0001F35E", u"", u"1F35E", u"", 416, 1, 15},
+    {u"\U0001F35F", u"", u"1F35F", u"", 417, 1, 15},
+    {u"\U0001F360", u"", u"1F360", u"", 418, 1, 15},
+    {u"\U0001F361", u"", u"1F361", u"", 419, 1, 15},
+    {u"\U0001F362", u"", u"1F362", u"", 420, 1, 15},
+    {u"\U0001F363", u"", u"1F363", u"", 421, 1, 15},
+    {u"\U0001F364", u"", u"1F364", u"", 422, 1, 15},
+    {u"\U0001F365", u"", u"1F365", u"", 423, 1, 15},
+    {u"\U0001F366", u"", u"1F366", u"", 424, 1, 15},
+    {u"\U0001F367", u"", u"1F367", u"", 425, 1, 15},
+    {u"\U0001F368", u"", u"1F368", u"", 426, 1, 15},
+    {u"\U0001F369", u"", u"1F369", u"", 427, 1, 15},
+    {u"\U0001F36A", u"", u"1F36A", u"", 428, 1, 15},
+    {u"\U0001F36B", u"", u"1F36B", u"", 429, 1, 15},
+    {u"\U0001F36C", u"", u"1F36C", u"", 430, 1, 15},
+    {u"\U0001F36D", u"", u"1F36D", u"", 431, 1, 15},
+    {u"\U0001F36E", u"", u"1F36E", u"", 432, 1, 15},
+    {u"\U0001F36F", u"", u"1F36F", u"", 433, 1, 15},
+    {u"\U0001F370", u"", u"1F370", u"", 434, 1, 15},
+    {u"\U0001F371", u"", u"1F371", u"", 435, 1, 15},
+    {u"\U0001F372", u"", u"1F372", u"", 436, 1, 15},
+    {u"\U0001F373", u"", u"1F373", u"", 437, 2, 15},
+    {u"\U0001F374", u"", u"1F374", u"", 439, 1, 15},
+    {u"\U0001F375", u"", u"1F375", u"", 440, 1, 15},
+    {u"\U0001F376", u"", u"1F376", u"", 441, 1, 15},
+    {u"\U0001F377", u"", u"1F377", u"", 442, 1, 15},
+    {u"\U0001F378", u"", u"1F378", u"", 443, 1, 15},
+    {u"\U0001F379", u"", u"1F379", u"", 444, 1, 15},
+    {u"\U0001F37A", u"", u"1F37A", u"", 445, 1, 15},
+    {u"\U0001F37B", u"", u"1F37B", u"", 446, 1, 15},
+    {u"\U0001F37C", u"", u"1F37C", u"", 447, 1, 15},
+    {u"\U0001F37D\uFE0F", u"\U0001F37D", u"1F37D-FE0F", u"1F37D", 448, 1, 15},
+    {u"\U0001F37E", u"", u"1F37E", u"", 449, 1, 15},
+    {u"\U0001F37F", u"", u"1F37F", u"", 450, 1, 15},
+    {u"\U0001F380", u"", u"1F380", u"", 451, 1, 15},
+    {u"\U0001F381", u"", u"1F381", u"", 452, 1, 15},
+    {u"\U0001F382", u"", u"1F382", u"", 453, 1, 15},
+    {u"\U0001F383", u"", u"1F383", u"", 454, 1, 15},
+    {u"\U0001F384", u"", u"1F384", u"", 455, 1, 15},
+    {u"\U0001F385", u"", u"1F385", u"", 456, 1, 15},
+    {u"\U0001F385\U0001F3FB", u"", u"1F385-1F3FB", u"", 457, 1, 15},
+    {u"\U0001F385\U0001F3FC", u"", u"1F385-1F3FC", u"", 458, 1, 15},
+    {u"\U0001F385\U0001F3FD", u"", u"1F385-1F3FD", u"", 459, 1, 15},
+    {u"\U0001F385\U0001F3FE", u"", u"1F385-1F3FE", u"", 460, 1, 15},
+    {u"\U0001F385\U0001F3FF", u"", u"1F385-1F3FF", u"", 461, 1, 15},
+    {u"\U0001F386", u"", u"1F386", u"", 462, 1, 15},
+    {u"\U0001F387", u"", u"1F387", u"", 463, 1, 15},
+    {u"\U0001F388", u"", u"1F388", u"", 464, 1, 15},
+    {u"\U0001F389", u"", u"1F389", u"", 465, 1, 15},
+    {u"\U0001F38A", u"", u"1F38A", u"", 466, 1, 15},
+    {u"\U0001F38B", u"", u"1F38B", u"", 467, 1, 15},
+    {u"\U0001F38C", u"", u"1F38C", u"", 468, 1, 15},
+    {u"\U0001F38D", u"", u"1F38D", u"", 469, 1, 15},
+    {u"\U0001F38E", u"", u"1F38E", u"", 470, 1, 15},
+    {u"\U0001F38F", u"", u"1F38F", u"", 471, 1, 15},
+    {u"\U0001F390", u"", u"1F390", u"", 472, 1, 15},
+    {u"\U0001F391", u"", u"1F391", u"", 473, 1, 15},
+    {u"\U0001F392", u"", u"1F392", u"", 474, 1, 15},
+    {u"\U0001F393", u"", u"1F393", u"", 475, 1, 15},
+    {u"\U0001F396\uFE0F", u"\U0001F396", u"1F396-FE0F", u"1F396", 476, 1, 15},
+    {u"\U0001F397\uFE0F", u"\U0001F397", u"1F397-FE0F", u"1F397", 477, 1, 15},
+    {u"\U0001F399\uFE0F", u"\U0001F399", u"1F399-FE0F", u"1F399", 478, 1, 15},
+    {u"\U0001F39A\uFE0F", u"\U0001F39A", u"1F39A-FE0F", u"1F39A", 479, 1, 15},
+    {u"\U0001F39B\uFE0F", u"\U0001F39B", u"1F39B-FE0F", u"1F39B", 480, 1, 15},
+    {u"\U0001F39E\uFE0F", u"\U0001F39E", u"1F39E-FE0F", u"1F39E", 481, 1, 15},
+    {u"\U0001F39F\uFE0F", u"\U0001F39F", u"1F39F-FE0F", u"1F39F", 482, 1, 15},
+    {u"\U0001F3A0", u"", u"1F3A0", u"", 483, 1, 15},
+    {u"\U0001F3A1", u"", u"1F3A1", u"", 484, 1, 15},
+    {u"\U0001F3A2", u"", u"1F3A2", u"", 485, 1, 15},
+    {u"\U0001F3A3", u"", u"1F3A3", u"", 486, 1, 15},
+    {u"\U0001F3A4", u"", u"1F3A4", u"", 487, 1, 15},
+    {u"\U0001F3A5", u"", u"1F3A5", u"", 488, 1, 15},
+    {u"\U0001F3A6", u"", u"1F3A6", u"", 489, 1, 15},
+    {u"\U0001F3A7", u"", u"1F3A7", u"", 490, 1, 15},
+    {u"\U0001F3A8", u"", u"1F3A8", u"", 491, 1, 15},
+    {u"\U0001F3A9", u"", u"1F3A9", u"", 492, 1, 15},
+    {u"\U0001F3AA", u"", u"1F3AA", u"", 493, 1, 15},
+    {u"\U0001F3AB", u"", u"1F3AB", u"", 494, 1, 15},
+    {u"\U0001F3AC", u"", u"1F3AC", u"", 495, 1, 15},
+    {u"\U0001F3AD", u"", u"1F3AD", u"", 496, 1, 15},
+    {u"\U0001F3AE", u"", u"1F3AE", u"", 497, 1, 15},
+    {u"\U0001F3AF", u"", u"1F3AF", u"", 498, 1, 15},
+    {u"\U0001F3B0", u"", u"1F3B0", u"", 499, 1, 15},
+    {u"\U0001F3B1", u"", u"1F3B1", u"", 500, 1, 15},
+    {u"\U0001F3B2", u"", u"1F3B2", u"", 501, 1, 15},
+    {u"\U0001F3B3", u"", u"1F3B3", u"", 502, 1, 15},
+    {u"\U0001F3B4", u"", u"1F3B4", u"", 503, 1, 15},
+    {u"\U0001F3B5", u"", u"1F3B5", u"", 504, 1, 15},
+    {u"\U0001F3B6", u"", u"1F3B6", u"", 505, 1, 15},
+    {u"\U0001F3B7", u"", u"1F3B7", u"", 506, 1, 15},
+    {u"\U0001F3B8", u"", u"1F3B8", u"", 507, 1, 15},
+    {u"\U0001F3B9", u"", u"1F3B9", u"", 508, 1, 15},
+    {u"\U0001F3BA", u"", u"1F3BA", u"", 509, 1, 15},
+    {u"\U0001F3BB", u"", u"1F3BB", u"", 510, 1, 15},
+    {u"\U0001F3BC", u"", u"1F3BC", u"", 511, 1, 15},
+    {u"\U0001F3BD", u"", u"1F3BD", u"", 512, 1, 15},
+    {u"\U0001F3BE", u"", u"1F3BE", u"", 513, 1, 15},
+    {u"\U0001F3BF", u"", u"1F3BF", u"", 514, 1, 15},
+    {u"\U0001F3C0", u"", u"1F3C0", u"", 515, 1, 15},
+    {u"\U0001F3C1", u"", u"1F3C1", u"", 516, 1, 15},
+    {u"\U0001F3C2", u"", u"1F3C2", u"", 517, 1, 15},
+    {u"\U0001F3C2\U0001F3FB", u"", u"1F3C2-1F3FB", u"", 518, 1, 15},
+    {u"\U0001F3C2\U0001F3FC", u"", u"1F3C2-1F3FC", u"", 519, 1, 15},
+    {u"\U0001F3C2\U0001F3FD", u"", u"1F3C2-1F3FD", u"", 520, 1, 15},
+    {u"\U0001F3C2\U0001F3FE", u"", u"1F3C2-1F3FE", u"", 521, 1, 15},
+    {u"\U0001F3C2\U0001F3FF", u"", u"1F3C2-1F3FF", u"", 522, 1, 15},
+    {u"\U0001F3C3\u200D\u2640\uFE0F", u"\U0001F3C3\u200D\u2640", u"1F3C3-200D-2640-FE0F", u"1F3C3-200D-2640", 523, 1, 15},
+    {u"\U0001F3C3\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F3C3\U0001F3FB\u200D\u2640", u"1F3C3-1F3FB-200D-2640-FE0F", u"1F3C3-1F3FB-200D-2640", 524, 1, 15},
+    {u"\U0001F3C3\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F3C3\U0001F3FC\u200D\u2640", u"1F3C3-1F3FC-200D-2640-FE0F", u"1F3C3-1F3FC-200D-2640", 525, 1, 15},
+    {u"\U0001F3C3\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F3C3\U0001F3FD\u200D\u2640", u"1F3C3-1F3FD-200D-2640-FE0F", u"1F3C3-1F3FD-200D-2640", 526, 1, 15},
+    {u"\U0001F3C3\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F3C3\U0001F3FE\u200D\u2640", u"1F3C3-1F3FE-200D-2640-FE0F", u"1F3C3-1F3FE-200D-2640", 527, 1, 15},
+    {u"\U0001F3C3\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F3C3\U0001F3FF\u200D\u2640", u"1F3C3-1F3FF-200D-2640-FE0F", u"1F3C3-1F3FF-200D-2640", 528, 1, 15},
+    {u"\U0001F3C3\u200D\u2640\uFE0F\u200D\u27A1\uFE0F", u"\U0001F3C3\u200D\u2640\u200D\u27A1", u"1F3C3-200D-2640-FE0F-200D-27A1-FE0F", u"1F3C3-200D-2640-200D-27A1", 529, 1, 7},
+    {u"\U0001F3C3\U0001F3FB\u200D\u2640\uFE0F\u200D\u27A1\uFE0F", u"\U0001F3C3\U0001F3FB\u200D\u2640\u200D\u27A1", u"1F3C3-1F3FB-200D-2640-FE0F-200D-27A1-FE0F", u"1F3C3-1F3FB-200D-2640-200D-27A1", 530, 1, 7},
+    {u"\U0001F3C3\U0001F3FC\u200D\u2640\uFE0F\u200D\u27A1\uFE0F", u"\U0001F3C3\U0001F3FC\u200D\u2640\u200D\u27A1", u"1F3C3-1F3FC-200D-2640-FE0F-200D-27A1-FE0F", u"1F3C3-1F3FC-200D-2640-200D-27A1", 531, 1, 7},
+    {u"\U0001F3C3\U0001F3FD\u200D\u2640\uFE0F\u200D\u27A1\uFE0F", u"\U0001F3C3\U0001F3FD\u200D\u2640\u200D\u27A1", u"1F3C3-1F3FD-200D-2640-FE0F-200D-27A1-FE0F", u"1F3C3-1F3FD-200D-2640-200D-27A1", 532, 1, 7},
+    {u"\U0001F3C3\U0001F3FE\u200D\u2640\uFE0F\u200D\u27A1\uFE0F", u"\U0001F3C3\U0001F3FE\u200D\u2640\u200D\u27A1", u"1F3C3-1F3FE-200D-2640-FE0F-200D-27A1-FE0F", u"1F3C3-1F3FE-200D-2640-200D-27A1", 533, 1, 7},
+    {u"\U0001F3C3\U0001F3FF\u200D\u2640\uFE0F\u200D\u27A1\uFE0F", u"\U0001F3C3\U0001F3FF\u200D\u2640\u200D\u27A1", u"1F3C3-1F3FF-200D-2640-FE0F-200D-27A1-FE0F", u"1F3C3-1F3FF-200D-2640-200D-27A1", 534, 1, 7},
+    {u"\U0001F3C3\u200D\u2642\uFE0F", u"\U0001F3C3\u200D\u2642", u"1F3C3-200D-2642-FE0F", u"1F3C3-200D-2642", 535, 1, 15},
+    {u"\U0001F3C3\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F3C3\U0001F3FB\u200D\u2642", u"1F3C3-1F3FB-200D-2642-FE0F", u"1F3C3-1F3FB-200D-2642", 536, 1, 15},
+    {u"\U0001F3C3\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F3C3\U0001F3FC\u200D\u2642", u"1F3C3-1F3FC-200D-2642-FE0F", u"1F3C3-1F3FC-200D-2642", 537, 1, 15},
+    {u"\U0001F3C3\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F3C3\U0001F3FD\u200D\u2642", u"1F3C3-1F3FD-200D-2642-FE0F", u"1F3C3-1F3FD-200D-2642", 538, 1, 15},
+    {u"\U0001F3C3\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F3C3\U0001F3FE\u200D\u2642", u"1F3C3-1F3FE-200D-2642-FE0F", u"1F3C3-1F3FE-200D-2642", 539, 1, 15},
+    {u"\U0001F3C3\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F3C3\U0001F3FF\u200D\u2642", u"1F3C3-1F3FF-200D-2642-FE0F", u"1F3C3-1F3FF-200D-2642", 540, 1, 15},
+    {u"\U0001F3C3\u200D\u2642\uFE0F\u200D\u27A1\uFE0F", u"\U0001F3C3\u200D\u2642\u200D\u27A1", u"1F3C3-200D-2642-FE0F-200D-27A1-FE0F", u"1F3C3-200D-2642-200D-27A1", 541, 1, 7},
+    {u"\U0001F3C3\U0001F3FB\u200D\u2642\uFE0F\u200D\u27A1\uFE0F", u"\U0001F3C3\U0001F3FB\u200D\u2642\u200D\u27A1", u"1F3C3-1F3FB-200D-2642-FE0F-200D-27A1-FE0F", u"1F3C3-1F3FB-200D-2642-200D-27A1", 542, 1, 7},
+    {u"\U0001F3C3\U0001F3FC\u200D\u2642\uFE0F\u200D\u27A1\uFE0F", u"\U0001F3C3\U0001F3FC\u200D\u2642\u200D\u27A1", u"1F3C3-1F3FC-200D-2642-FE0F-200D-27A1-FE0F", u"1F3C3-1F3FC-200D-2642-200D-27A1", 543, 1, 7},
+    {u"\U0001F3C3\U0001F3FD\u200D\u2642\uFE0F\u200D\u27A1\uFE0F", u"\U0001F3C3\U0001F3FD\u200D\u2642\u200D\u27A1", u"1F3C3-1F3FD-200D-2642-FE0F-200D-27A1-FE0F", u"1F3C3-1F3FD-200D-2642-200D-27A1", 544, 1, 7},
+    {u"\U0001F3C3\U0001F3FE\u200D\u2642\uFE0F\u200D\u27A1\uFE0F", u"\U0001F3C3\U0001F3FE\u200D\u2642\u200D\u27A1", u"1F3C3-1F3FE-200D-2642-FE0F-200D-27A1-FE0F", u"1F3C3-1F3FE-200D-2642-200D-27A1", 545, 1, 7},
+    {u"\U0001F3C3\U0001F3FF\u200D\u2642\uFE0F\u200D\u27A1\uFE0F", u"\U0001F3C3\U0001F3FF\u200D\u2642\u200D\u27A1", u"1F3C3-1F3FF-200D-2642-FE0F-200D-27A1-FE0F", u"1F3C3-1F3FF-200D-2642-200D-27A1", 546, 1, 7},
+    {u"\U0001F3C3\u200D\u27A1\uFE0F", u"\U0001F3C3\u200D\u27A1", u"1F3C3-200D-27A1-FE0F", u"1F3C3-200D-27A1", 547, 1, 7},
+    {u"\U0001F3C3\U0001F3FB\u200D\u27A1\uFE0F", u"\U0001F3C3\U0001F3FB\u200D\u27A1", u"1F3C3-1F3FB-200D-27A1-FE0F", u"1F3C3-1F3FB-200D-27A1", 548, 1, 7},
+    {u"\U0001F3C3\U0001F3FC\u200D\u27A1\uFE0F", u"\U0001F3C3\U0001F3FC\u200D\u27A1", u"1F3C3-1F3FC-200D-27A1-FE0F", u"1F3C3-1F3FC-200D-27A1", 549, 1, 7},
+    {u"\U0001F3C3\U0001F3FD\u200D\u27A1\uFE0F", u"\U0001F3C3\U0001F3FD\u200D\u27A1", u"1F3C3-1F3FD-200D-27A1-FE0F", u"1F3C3-1F3FD-200D-27A1", 550, 1, 7},
+    {u"\U0001F3C3\U0001F3FE\u200D\u27A1\uFE0F", u"\U0001F3C3\U0001F3FE\u200D\u27A1", u"1F3C3-1F3FE-200D-27A1-FE0F", u"1F3C3-1F3FE-200D-27A1", 551, 1, 7},
+    {u"\U0001F3C3\U0001F3FF\u200D\u27A1\uFE0F", u"\U0001F3C3\U0001F3FF\u200D\u27A1", u"1F3C3-1F3FF-200D-27A1-FE0F", u"1F3C3-1F3FF-200D-27A1", 552, 1, 7},
+    {u"\U0001F3C3", u"", u"1F3C3", u"", 553, 2, 15},
+    {u"\U0001F3C3\U0001F3FB", u"", u"1F3C3-1F3FB", u"", 555, 1, 15},
+    {u"\U0001F3C3\U0001F3FC", u"", u"1F3C3-1F3FC", u"", 556, 1, 15},
+    {u"\U0001F3C3\U0001F3FD", u"", u"1F3C3-1F3FD", u"", 557, 1, 15},
+    {u"\U0001F3C3\U0001F3FE", u"", u"1F3C3-1F3FE", u"", 558, 1, 15},
+    {u"\U0001F3C3\U0001F3FF", u"", u"1F3C3-1F3FF", u"", 559, 1, 15},
+    {u"\U0001F3C4\u200D\u2640\uFE0F", u"\U0001F3C4\u200D\u2640", u"1F3C4-200D-2640-FE0F", u"1F3C4-200D-2640", 560, 1, 15},
+    {u"\U0001F3C4\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F3C4\U0001F3FB\u200D\u2640", u"1F3C4-1F3FB-200D-2640-FE0F", u"1F3C4-1F3FB-200D-2640", 561, 1, 15},
+    {u"\U0001F3C4\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F3C4\U0001F3FC\u200D\u2640", u"1F3C4-1F3FC-200D-2640-FE0F", u"1F3C4-1F3FC-200D-2640", 562, 1, 15},
+    {u"\U0001F3C4\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F3C4\U0001F3FD\u200D\u2640", u"1F3C4-1F3FD-200D-2640-FE0F", u"1F3C4-1F3FD-200D-2640", 563, 1, 15},
+    {u"\U0001F3C4\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F3C4\U0001F3FE\u200D\u2640", u"1F3C4-1F3FE-200D-2640-FE0F", u"1F3C4-1F3FE-200D-2640", 564, 1, 15},
+    {u"\U0001F3C4\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F3C4\U0001F3FF\u200D\u2640", u"1F3C4-1F3FF-200D-2640-FE0F", u"1F3C4-1F3FF-200D-2640", 565, 1, 15},
+    {u"\U0001F3C4\u200D\u2642\uFE0F", u"\U0001F3C4\u200D\u2642", u"1F3C4-200D-2642-FE0F", u"1F3C4-200D-2642", 566, 1, 15},
+    {u"\U0001F3C4\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F3C4\U0001F3FB\u200D\u2642", u"1F3C4-1F3FB-200D-2642-FE0F", u"1F3C4-1F3FB-200D-2642", 567, 1, 15},
+    {u"\U0001F3C4\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F3C4\U0001F3FC\u200D\u2642", u"1F3C4-1F3FC-200D-2642-FE0F", u"1F3C4-1F3FC-200D-2642", 568, 1, 15},
+    {u"\U0001F3C4\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F3C4\U0001F3FD\u200D\u2642", u"1F3C4-1F3FD-200D-2642-FE0F", u"1F3C4-1F3FD-200D-2642", 569, 1, 15},
+    {u"\U0001F3C4\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F3C4\U0001F3FE\u200D\u2642", u"1F3C4-1F3FE-200D-2642-FE0F", u"1F3C4-1F3FE-200D-2642", 570, 1, 15},
+    {u"\U0001F3C4\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F3C4\U0001F3FF\u200D\u2642", u"1F3C4-1F3FF-200D-2642-FE0F", u"1F3C4-1F3FF-200D-2642", 571, 1, 15},
+    {u"\U0001F3C4", u"", u"1F3C4", u"", 572, 1, 15},
+    {u"\U0001F3C4\U0001F3FB", u"", u"1F3C4-1F3FB", u"", 573, 1, 15},
+    {u"\U0001F3C4\U0001F3FC", u"", u"1F3C4-1F3FC", u"", 574, 1, 15},
+    {u"\U0001F3C4\U0001F3FD", u"", u"1F3C4-1F3FD", u"", 575, 1, 15},
+    {u"\U0001F3C4\U0001F3FE", u"", u"1F3C4-1F3FE", u"", 576, 1, 15},
+    {u"\U0001F3C4\U0001F3FF", u"", u"1F3C4-1F3FF", u"", 577, 1, 15},
+    {u"\U0001F3C5", u"", u"1F3C5", u"", 578, 1, 15},
+    {u"\U0001F3C6", u"", u"1F3C6", u"", 579, 1, 15},
+    {u"\U0001F3C7", u"", u"1F3C7", u"", 580, 1, 15},
+    {u"\U0001F3C7\U0001F3FB", u"", u"1F3C7-1F3FB", u"", 581, 1, 15},
+    {u"\U0001F3C7\U0001F3FC", u"", u"1F3C7-1F3FC", u"", 582, 1, 15},
+    {u"\U0001F3C7\U0001F3FD", u"", u"1F3C7-1F3FD", u"", 583, 1, 15},
+    {u"\U0001F3C7\U0001F3FE", u"", u"1F3C7-1F3FE", u"", 584, 1, 15},
+    {u"\U0001F3C7\U0001F3FF", u"", u"1F3C7-1F3FF", u"", 585, 1, 15},
+    {u"\U0001F3C8", u"", u"1F3C8", u"", 586, 1, 15},
+    {u"\U0001F3C9", u"", u"1F3C9", u"", 587, 1, 15},
+    {u"\U0001F3CA\u200D\u2640\uFE0F", u"\U0001F3CA\u200D\u2640", u"1F3CA-200D-2640-FE0F", u"1F3CA-200D-2640", 588, 1, 15},
+    {u"\U0001F3CA\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F3CA\U0001F3FB\u200D\u2640", u"1F3CA-1F3FB-200D-2640-FE0F", u"1F3CA-1F3FB-200D-2640", 589, 1, 15},
+    {u"\U0001F3CA\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F3CA\U0001F3FC\u200D\u2640", u"1F3CA-1F3FC-200D-2640-FE0F", u"1F3CA-1F3FC-200D-2640", 590, 1, 15},
+    {u"\U0001F3CA\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F3CA\U0001F3FD\u200D\u2640", u"1F3CA-1F3FD-200D-2640-FE0F", u"1F3CA-1F3FD-200D-2640", 591, 1, 15},
+    {u"\U0001F3CA\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F3CA\U0001F3FE\u200D\u2640", u"1F3CA-1F3FE-200D-2640-FE0F", u"1F3CA-1F3FE-200D-2640", 592, 1, 15},
+    {u"\U0001F3CA\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F3CA\U0001F3FF\u200D\u2640", u"1F3CA-1F3FF-200D-2640-FE0F", u"1F3CA-1F3FF-200D-2640", 593, 1, 15},
+    {u"\U0001F3CA\u200D\u2642\uFE0F", u"\U0001F3CA\u200D\u2642", u"1F3CA-200D-2642-FE0F", u"1F3CA-200D-2642", 594, 1, 15},
+    {u"\U0001F3CA\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F3CA\U0001F3FB\u200D\u2642", u"1F3CA-1F3FB-200D-2642-FE0F", u"1F3CA-1F3FB-200D-2642", 595, 1, 15},
+    {u"\U0001F3CA\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F3CA\U0001F3FC\u200D\u2642", u"1F3CA-1F3FC-200D-2642-FE0F", u"1F3CA-1F3FC-200D-2642", 596, 1, 15},
+    {u"\U0001F3CA\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F3CA\U0001F3FD\u200D\u2642", u"1F3CA-1F3FD-200D-2642-FE0F", u"1F3CA-1F3FD-200D-2642", 597, 1, 15},
+    {u"\U0001F3CA\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F3CA\U0001F3FE\u200D\u2642", u"1F3CA-1F3FE-200D-2642-FE0F", u"1F3CA-1F3FE-200D-2642", 598, 1, 15},
+    {u"\U0001F3CA\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F3CA\U0001F3FF\u200D\u2642", u"1F3CA-1F3FF-200D-2642-FE0F", u"1F3CA-1F3FF-200D-2642", 599, 1, 15},
+    {u"\U0001F3CA", u"", u"1F3CA", u"", 600, 1, 15},
+    {u"\U0001F3CA\U0001F3FB", u"", u"1F3CA-1F3FB", u"", 601, 1, 15},
+    {u"\U0001F3CA\U0001F3FC", u"", u"1F3CA-1F3FC", u"", 602, 1, 15},
+    {u"\U0001F3CA\U0001F3FD", u"", u"1F3CA-1F3FD", u"", 603, 1, 15},
+    {u"\U0001F3CA\U0001F3FE", u"", u"1F3CA-1F3FE", u"", 604, 1, 15},
+    {u"\U0001F3CA\U0001F3FF", u"", u"1F3CA-1F3FF", u"", 605, 1, 15},
+    {u"\U0001F3CB\uFE0F\u200D\u2640\uFE0F", u"\U0001F3CB\u200D\u2640", u"1F3CB-FE0F-200D-2640-FE0F", u"1F3CB-200D-2640", 606, 1, 15},
+    {u"\U0001F3CB\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F3CB\U0001F3FB\u200D\u2640", u"1F3CB-1F3FB-200D-2640-FE0F", u"1F3CB-1F3FB-200D-2640", 607, 1, 15},
+    {u"\U0001F3CB\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F3CB\U0001F3FC\u200D\u2640", u"1F3CB-1F3FC-200D-2640-FE0F", u"1F3CB-1F3FC-200D-2640", 608, 1, 15},
+    {u"\U0001F3CB\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F3CB\U0001F3FD\u200D\u2640", u"1F3CB-1F3FD-200D-2640-FE0F", u"1F3CB-1F3FD-200D-2640", 609, 1, 15},
+    {u"\U0001F3CB\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F3CB\U0001F3FE\u200D\u2640", u"1F3CB-1F3FE-200D-2640-FE0F", u"1F3CB-1F3FE-200D-2640", 610, 1, 15},
+    {u"\U0001F3CB\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F3CB\U0001F3FF\u200D\u2640", u"1F3CB-1F3FF-200D-2640-FE0F", u"1F3CB-1F3FF-200D-2640", 611, 1, 15},
+    {u"\U0001F3CB\uFE0F\u200D\u2642\uFE0F", u"\U0001F3CB\u200D\u2642", u"1F3CB-FE0F-200D-2642-FE0F", u"1F3CB-200D-2642", 612, 1, 15},
+    {u"\U0001F3CB\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F3CB\U0001F3FB\u200D\u2642", u"1F3CB-1F3FB-200D-2642-FE0F", u"1F3CB-1F3FB-200D-2642", 613, 1, 15},
+    {u"\U0001F3CB\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F3CB\U0001F3FC\u200D\u2642", u"1F3CB-1F3FC-200D-2642-FE0F", u"1F3CB-1F3FC-200D-2642", 614, 1, 15},
+    {u"\U0001F3CB\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F3CB\U0001F3FD\u200D\u2642", u"1F3CB-1F3FD-200D-2642-FE0F", u"1F3CB-1F3FD-200D-2642", 615, 1, 15},
+    {u"\U0001F3CB\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F3CB\U0001F3FE\u200D\u2642", u"1F3CB-1F3FE-200D-2642-FE0F", u"1F3CB-1F3FE-200D-2642", 616, 1, 15},
+    {u"\U0001F3CB\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F3CB\U0001F3FF\u200D\u2642", u"1F3CB-1F3FF-200D-2642-FE0F", u"1F3CB-1F3FF-200D-2642", 617, 1, 15},
+    {u"\U0001F3CB\uFE0F", u"\U0001F3CB", u"1F3CB-FE0F", u"1F3CB", 618, 1, 15},
+    {u"\U0001F3CB\U0001F3FB", u"", u"1F3CB-1F3FB", u"", 619, 1, 15},
+    {u"\U0001F3CB\U0001F3FC", u"", u"1F3CB-1F3FC", u"", 620, 1, 15},
+    {u"\U0001F3CB\U0001F3FD", u"", u"1F3CB-1F3FD", u"", 621, 1, 15},
+    {u"\U0001F3CB\U0001F3FE", u"", u"1F3CB-1F3FE", u"", 622, 1, 15},
+    {u"\U0001F3CB\U0001F3FF", u"", u"1F3CB-1F3FF", u"", 623, 1, 15},
+    {u"\U0001F3CC\uFE0F\u200D\u2640\uFE0F", u"\U0001F3CC\u200D\u2640", u"1F3CC-FE0F-200D-2640-FE0F", u"1F3CC-200D-2640", 624, 1, 15},
+    {u"\U0001F3CC\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F3CC\U0001F3FB\u200D\u2640", u"1F3CC-1F3FB-200D-2640-FE0F", u"1F3CC-1F3FB-200D-2640", 625, 1, 15},
+    {u"\U0001F3CC\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F3CC\U0001F3FC\u200D\u2640", u"1F3CC-1F3FC-200D-2640-FE0F", u"1F3CC-1F3FC-200D-2640", 626, 1, 15},
+    {u"\U0001F3CC\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F3CC\U0001F3FD\u200D\u2640", u"1F3CC-1F3FD-200D-2640-FE0F", u"1F3CC-1F3FD-200D-2640", 627, 1, 15},
+    {u"\U0001F3CC\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F3CC\U0001F3FE\u200D\u2640", u"1F3CC-1F3FE-200D-2640-FE0F", u"1F3CC-1F3FE-200D-2640", 628, 1, 15},
+    {u"\U0001F3CC\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F3CC\U0001F3FF\u200D\u2640", u"1F3CC-1F3FF-200D-2640-FE0F", u"1F3CC-1F3FF-200D-2640", 629, 1, 15},
+    {u"\U0001F3CC\uFE0F\u200D\u2642\uFE0F", u"\U0001F3CC\u200D\u2642", u"1F3CC-FE0F-200D-2642-FE0F", u"1F3CC-200D-2642", 630, 1, 15},
+    {u"\U0001F3CC\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F3CC\U0001F3FB\u200D\u2642", u"1F3CC-1F3FB-200D-2642-FE0F", u"1F3CC-1F3FB-200D-2642", 631, 1, 15},
+    {u"\U0001F3CC\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F3CC\U0001F3FC\u200D\u2642", u"1F3CC-1F3FC-200D-2642-FE0F", u"1F3CC-1F3FC-200D-2642", 632, 1, 15},
+    {u"\U0001F3CC\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F3CC\U0001F3FD\u200D\u2642", u"1F3CC-1F3FD-200D-2642-FE0F", u"1F3CC-1F3FD-200D-2642", 633, 1, 15},
+    {u"\U0001F3CC\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F3CC\U0001F3FE\u200D\u2642", u"1F3CC-1F3FE-200D-2642-FE0F", u"1F3CC-1F3FE-200D-2642", 634, 1, 15},
+    {u"\U0001F3CC\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F3CC\U0001F3FF\u200D\u2642", u"1F3CC-1F3FF-200D-2642-FE0F", u"1F3CC-1F3FF-200D-2642", 635, 1, 15},
+    {u"\U0001F3CC\uFE0F", u"\U0001F3CC", u"1F3CC-FE0F", u"1F3CC", 636, 1, 15},
+    {u"\U0001F3CC\U0001F3FB", u"", u"1F3CC-1F3FB", u"", 637, 1, 15},
+    {u"\U0001F3CC\U0001F3FC", u"", u"1F3CC-1F3FC", u"", 638, 1, 15},
+    {u"\U0001F3CC\U0001F3FD", u"", u"1F3CC-1F3FD", u"", 639, 1, 15},
+    {u"\U0001F3CC\U0001F3FE", u"", u"1F3CC-1F3FE", u"", 640, 1, 15},
+    {u"\U0001F3CC\U0001F3FF", u"", u"1F3CC-1F3FF", u"", 641, 1, 15},
+    {u"\U0001F3CD\uFE0F", u"\U0001F3CD", u"1F3CD-FE0F", u"1F3CD", 642, 1, 15},
+    {u"\U0001F3CE\uFE0F", u"\U0001F3CE", u"1F3CE-FE0F", u"1F3CE", 643, 1, 15},
+    {u"\U0001F3CF", u"", u"1F3CF", u"", 644, 1, 15},
+    {u"\U0001F3D0", u"", u"1F3D0", u"", 645, 1, 15},
+    {u"\U0001F3D1", u"", u"1F3D1", u"", 646, 1, 15},
+    {u"\U0001F3D2", u"", u"1F3D2", u"", 647, 1, 15},
+    {u"\U0001F3D3", u"", u"1F3D3", u"", 648, 1, 15},
+    {u"\U0001F3D4\uFE0F", u"\U0001F3D4", u"1F3D4-FE0F", u"1F3D4", 649, 1, 15},
+    {u"\U0001F3D5\uFE0F", u"\U0001F3D5", u"1F3D5-FE0F", u"1F3D5", 650, 1, 15},
+    {u"\U0001F3D6\uFE0F", u"\U0001F3D6", u"1F3D6-FE0F", u"1F3D6", 651, 1, 15},
+    {u"\U0001F3D7\uFE0F", u"\U0001F3D7", u"1F3D7-FE0F", u"1F3D7", 652, 1, 15},
+    {u"\U0001F3D8\uFE0F", u"\U0001F3D8", u"1F3D8-FE0F", u"1F3D8", 653, 1, 15},
+    {u"\U0001F3D9\uFE0F", u"\U0001F3D9", u"1F3D9-FE0F", u"1F3D9", 654, 1, 15},
+    {u"\U0001F3DA\uFE0F", u"\U0001F3DA", u"1F3DA-FE0F", u"1F3DA", 655, 1, 15},
+    {u"\U0001F3DB\uFE0F", u"\U0001F3DB", u"1F3DB-FE0F", u"1F3DB", 656, 1, 15},
+    {u"\U0001F3DC\uFE0F", u"\U0001F3DC", u"1F3DC-FE0F", u"1F3DC", 657, 1, 15},
+    {u"\U0001F3DD\uFE0F", u"\U0001F3DD", u"1F3DD-FE0F", u"1F3DD", 658, 1, 15},
+    {u"\U0001F3DE\uFE0F", u"\U0001F3DE", u"1F3DE-FE0F", u"1F3DE", 659, 1, 15},
+    {u"\U0001F3DF\uFE0F", u"\U0001F3DF", u"1F3DF-FE0F", u"1F3DF", 660, 1, 15},
+    {u"\U0001F3E0", u"", u"1F3E0", u"", 661, 1, 15},
+    {u"\U0001F3E1", u"", u"1F3E1", u"", 662, 1, 15},
+    {u"\U0001F3E2", u"", u"1F3E2", u"", 663, 1, 15},
+    {u"\U0001F3E3", u"", u"1F3E3", u"", 664, 1, 15},
+    {u"\U0001F3E4", u"", u"1F3E4", u"", 665, 1, 15},
+    {u"\U0001F3E5", u"", u"1F3E5", u"", 666, 1, 15},
+    {u"\U0001F3E6", u"", u"1F3E6", u"", 667, 1, 15},
+    {u"\U0001F3E7", u"", u"1F3E7", u"", 668, 1, 15},
+    {u"\U0001F3E8", u"", u"1F3E8", u"", 669, 1, 15},
+    {u"\U0001F3E9", u"", u"1F3E9", u"", 670, 1, 15},
+    {u"\U0001F3EA", u"", u"1F3EA", u"", 671, 1, 15},
+    {u"\U0001F3EB", u"", u"1F3EB", u"", 672, 1, 15},
+    {u"\U0001F3EC", u"", u"1F3EC", u"", 673, 1, 15},
+    {u"\U0001F3ED", u"", u"1F3ED", u"", 674, 1, 15},
+    {u"\U0001F3EE", u"", u"1F3EE", u"", 675, 2, 15},
+    {u"\U0001F3EF", u"", u"1F3EF", u"", 677, 1, 15},
+    {u"\U0001F3F0", u"", u"1F3F0", u"", 678, 1, 15},
+    {u"\U0001F3F3\uFE0F\u200D\U0001F308", u"\U0001F3F3\u200D\U0001F308", u"1F3F3-FE0F-200D-1F308", u"1F3F3-200D-1F308", 679, 1, 15},
+    {u"\U0001F3F3\uFE0F\u200D\u26A7\uFE0F", u"\U0001F3F3\u200D\u26A7", u"1F3F3-FE0F-200D-26A7-FE0F", u"1F3F3-200D-26A7", 680, 1, 15},
+    {u"\U0001F3F3\uFE0F", u"\U0001F3F3", u"1F3F3-FE0F", u"1F3F3", 681, 1, 15},
+    {u"\U0001F3F4\u200D\u2620\uFE0F", u"\U0001F3F4\u200D\u2620", u"1F3F4-200D-2620-FE0F", u"1F3F4-200D-2620", 682, 1, 15},
+    {u"\U0001F3F4\U000E0067\U000E0062\U000E0065\U000E006E\U000E0067\U000E007F", u"", u"1F3F4-E0067-E0062-E0065-E006E-E0067-E007F", u"", 683, 1, 15},
+    {u"\U0001F3F4\U000E0067\U000E0062\U000E0073\U000E0063\U000E0074\U000E007F", u"", u"1F3F4-E0067-E0062-E0073-E0063-E0074-E007F", u"", 684, 1, 15},
+    {u"\U0001F3F4\U000E0067\U000E0062\U000E0077\U000E006C\U000E0073\U000E007F", u"", u"1F3F4-E0067-E0062-E0077-E006C-E0073-E007F", u"", 685, 1, 15},
+    {u"\U0001F3F4", u"", u"1F3F4", u"", 686, 1, 15},
+    {u"\U0001F3F5\uFE0F", u"\U0001F3F5", u"1F3F5-FE0F", u"1F3F5", 687, 1, 15},
+    {u"\U0001F3F7\uFE0F", u"\U0001F3F7", u"1F3F7-FE0F", u"1F3F7", 688, 1, 15},
+    {u"\U0001F3F8", u"", u"1F3F8", u"", 689, 1, 15},
+    {u"\U0001F3F9", u"", u"1F3F9", u"", 690, 1, 15},
+    {u"\U0001F3FA", u"", u"1F3FA", u"", 691, 1, 15},
+    {u"\U0001F3FB", u"", u"1F3FB", u"", 692, 1, 15},
+    {u"\U0001F3FC", u"", u"1F3FC", u"", 693, 1, 15},
+    {u"\U0001F3FD", u"", u"1F3FD", u"", 694, 1, 15},
+    {u"\U0001F3FE", u"", u"1F3FE", u"", 695, 1, 15},
+    {u"\U0001F3FF", u"", u"1F3FF", u"", 696, 1, 15},
+    {u"\U0001F400", u"", u"1F400", u"", 697, 1, 15},
+    {u"\U0001F401", u"", u"1F401", u"", 698, 1, 15},
+    {u"\U0001F402", u"", u"1F402", u"", 699, 1, 15},
+    {u"\U0001F403", u"", u"1F403", u"", 700, 1, 15},
+    {u"\U0001F404", u"", u"1F404", u"", 701, 1, 15},
+    {u"\U0001F405", u"", u"1F405", u"", 702, 1, 15},
+    {u"\U0001F406", u"", u"1F406", u"", 703, 1, 15},
+    {u"\U0001F407", u"", u"1F407", u"", 704, 1, 15},
+    {u"\U0001F408\u200D\u2B1B", u"", u"1F408-200D-2B1B", u"", 705, 1, 15},
+    {u"\U0001F408", u"", u"1F408", u"", 706, 1, 15},
+    {u"\U0001F409", u"", u"1F409", u"", 707, 1, 15},
+    {u"\U0001F40A", u"", u"1F40A", u"", 708, 1, 15},
+    {u"\U0001F40B", u"", u"1F40B", u"", 709, 1, 15},
+    {u"\U0001F40C", u"", u"1F40C", u"", 710, 1, 15},
+    {u"\U0001F40D", u"", u"1F40D", u"", 711, 1, 15},
+    {u"\U0001F40E", u"", u"1F40E", u"", 712, 1, 15},
+    {u"\U0001F40F", u"", u"1F40F", u"", 713, 1, 15},
+    {u"\U0001F410", u"", u"1F410", u"", 714, 1, 15},
+    {u"\U0001F411", u"", u"1F411", u"", 715, 1, 15},
+    {u"\U0001F412", u"", u"1F412", u"", 716, 1, 15},
+    {u"\U0001F413", u"", u"1F413", u"", 717, 1, 15},
+    {u"\U0001F414", u"", u"1F414", u"", 718, 1, 15},
+    {u"\U0001F415\u200D\U0001F9BA", u"", u"1F415-200D-1F9BA", u"", 719, 1, 15},
+    {u"\U0001F415", u"", u"1F415", u"", 720, 1, 15},
+    {u"\U0001F416", u"", u"1F416", u"", 721, 1, 15},
+    {u"\U0001F417", u"", u"1F417", u"", 722, 1, 15},
+    {u"\U0001F418", u"", u"1F418", u"", 723, 1, 15},
+    {u"\U0001F419", u"", u"1F419", u"", 724, 1, 15},
+    {u"\U0001F41A", u"", u"1F41A", u"", 725, 1, 15},
+    {u"\U0001F41B", u"", u"1F41B", u"", 726, 1, 15},
+    {u"\U0001F41C", u"", u"1F41C", u"", 727, 1, 15},
+    {u"\U0001F41D", u"", u"1F41D", u"", 728, 2, 15},
+    {u"\U0001F41E", u"", u"1F41E", u"", 730, 2, 15},
+    {u"\U0001F41F", u"", u"1F41F", u"", 732, 1, 15},
+    {u"\U0001F420", u"", u"1F420", u"", 733, 1, 15},
+    {u"\U0001F421", u"", u"1F421", u"", 734, 1, 15},
+    {u"\U0001F422", u"", u"1F422", u"", 735, 1, 15},
+    {u"\U0001F423", u"", u"1F423", u"", 736, 1, 15},
+    {u"\U0001F424", u"", u"1F424", u"", 737, 1, 15},
+    {u"\U0001F425", u"", u"1F425", u"", 738, 1, 15},
+    {u"\U0001F426\u200D\U0001F525", u"", u"1F426-200D-1F525", u"", 739, 1, 7},
+    {u"\U0001F426\u200D\u2B1B", u"", u"1F426-200D-2B1B", u"", 740, 1, 15},
+    {u"\U0001F426", u"", u"1F426", u"", 741, 1, 15},
+    {u"\U0001F427", u"", u"1F427", u"", 742, 1, 15},
+    {u"\U0001F428", u"", u"1F428", u"", 743, 1, 15},
+    {u"\U0001F429", u"", u"1F429", u"", 744, 1, 15},
+    {u"\U0001F42A", u"", u"1F42A", u"", 745, 1, 15},
+    {u"\U0001F42B", u"", u"1F42B", u"", 746, 1, 15},
+    {u"\U0001F42C", u"", u"1F42C", u"", 747, 2, 15},
+    {u"\U0001F42D", u"", u"1F42D", u"", 749, 1, 15},
+    {u"\U0001F42E", u"", u"1F42E", u"", 750, 1, 15},
+    {u"\U0001F42F", u"", u"1F42F", u"", 751, 1, 15},
+    {u"\U0001F430", u"", u"1F430", u"", 752, 1, 15},
+    {u"\U0001F431", u"", u"1F431", u"", 753, 1, 15},
+    {u"\U0001F432", u"", u"1F432", u"", 754, 1, 15},
+    {u"\U0001F433", u"", u"1F433", u"", 755, 1, 15},
+    {u"\U0001F434", u"", u"1F434", u"", 756, 1, 15},
+    {u"\U0001F435", u"", u"1F435", u"", 757, 1, 15},
+    {u"\U0001F436", u"", u"1F436", u"", 758, 1, 15},
+    {u"\U0001F437", u"", u"1F437", u"", 759, 1, 15},
+    {u"\U0001F438", u"", u"1F438", u"", 760, 1, 15},
+    {u"\U0001F439", u"", u"1F439", u"", 761, 1, 15},
+    {u"\U0001F43A", u"", u"1F43A", u"", 762, 1, 15},
+    {u"\U0001F43B\u200D\u2744\uFE0F", u"\U0001F43B\u200D\u2744", u"1F43B-200D-2744-FE0F", u"1F43B-200D-2744", 763, 1, 15},
+    {u"\U0001F43B", u"", u"1F43B", u"", 764, 1, 15},
+    {u"\U0001F43C", u"", u"1F43C", u"", 765, 1, 15},
+    {u"\U0001F43D", u"", u"1F43D", u"", 766, 1, 15},
+    {u"\U0001F43E", u"", u"1F43E", u"", 767, 2, 15},
+    {u"\U0001F43F\uFE0F", u"\U0001F43F", u"1F43F-FE0F", u"1F43F", 769, 1, 15},
+    {u"\U0001F440", u"", u"1F440", u"", 770, 1, 15},
+    {u"\U0001F441\uFE0F\u200D\U0001F5E8\uFE0F", u"\U0001F441\u200D\U0001F5E8", u"1F441-FE0F-200D-1F5E8-FE0F", u"1F441-200D-1F5E8", 771, 1, 7},
+    {u"\U0001F441\uFE0F", u"\U0001F441", u"1F441-FE0F", u"1F441", 772, 1, 15},
+    {u"\U0001F442", u"", u"1F442", u"", 773, 1, 15},
+    {u"\U0001F442\U0001F3FB", u"", u"1F442-1F3FB", u"", 774, 1, 15},
+    {u"\U0001F442\U0001F3FC", u"", u"1F442-1F3FC", u"", 775, 1, 15},
+    {u"\U0001F442\U0001F3FD", u"", u"1F442-1F3FD", u"", 776, 1, 15},
+    {u"\U0001F442\U0001F3FE", u"", u"1F442-1F3FE", u"", 777, 1, 15},
+    {u"\U0001F442\U0001F3FF", u"", u"1F442-1F3FF", u"", 778, 1, 15},
+    {u"\U0001F443", u"", u"1F443", u"", 779, 1, 15},
+    {u"\U0001F443\U0001F3FB", u"", u"1F443-1F3FB", u"", 780, 1, 15},
+    {u"\U0001F443\U0001F3FC", u"", u"1F443-1F3FC", u"", 781, 1, 15},
+    {u"\U0001F443\U0001F3FD", u"", u"1F443-1F3FD", u"", 782, 1, 15},
+    {u"\U0001F443\U0001F3FE", u"", u"1F443-1F3FE", u"", 783, 1, 15},
+    {u"\U0001F443\U0001F3FF", u"", u"1F443-1F3FF", u"", 784, 1, 15},
+    {u"\U0001F444", u"", u"1F444", u"", 785, 1, 15},
+    {u"\U0001F445", u"", u"1F445", u"", 786, 1, 15},
+    {u"\U0001F446", u"", u"1F446", u"", 787, 1, 15},
+    {u"\U0001F446\U0001F3FB", u"", u"1F446-1F3FB", u"", 788, 1, 15},
+    {u"\U0001F446\U0001F3FC", u"", u"1F446-1F3FC", u"", 789, 1, 15},
+    {u"\U0001F446\U0001F3FD", u"", u"1F446-1F3FD", u"", 790, 1, 15},
+    {u"\U0001F446\U0001F3FE", u"", u"1F446-1F3FE", u"", 791, 1, 15},
+    {u"\U0001F446\U0001F3FF", u"", u"1F446-1F3FF", u"", 792, 1, 15},
+    {u"\U0001F447", u"", u"1F447", u"", 793, 1, 15},
+    {u"\U0001F447\U0001F3FB", u"", u"1F447-1F3FB", u"", 794, 1, 15},
+    {u"\U0001F447\U0001F3FC", u"", u"1F447-1F3FC", u"", 795, 1, 15},
+    {u"\U0001F447\U0001F3FD", u"", u"1F447-1F3FD", u"", 796, 1, 15},
+    {u"\U0001F447\U0001F3FE", u"", u"1F447-1F3FE", u"", 797, 1, 15},
+    {u"\U0001F447\U0001F3FF", u"", u"1F447-1F3FF", u"", 798, 1, 15},
+    {u"\U0001F448", u"", u"1F448", u"", 799, 1, 15},
+    {u"\U0001F448\U0001F3FB", u"", u"1F448-1F3FB", u"", 800, 1, 15},
+    {u"\U0001F448\U0001F3FC", u"", u"1F448-1F3FC", u"", 801, 1, 15},
+    {u"\U0001F448\U0001F3FD", u"", u"1F448-1F3FD", u"", 802, 1, 15},
+    {u"\U0001F448\U0001F3FE", u"", u"1F448-1F3FE", u"", 803, 1, 15},
+    {u"\U0001F448\U0001F3FF", u"", u"1F448-1F3FF", u"", 804, 1, 15},
+    {u"\U0001F449", u"", u"1F449", u"", 805, 1, 15},
+    {u"\U0001F449\U0001F3FB", u"", u"1F449-1F3FB", u"", 806, 1, 15},
+    {u"\U0001F449\U0001F3FC", u"", u"1F449-1F3FC", u"", 807, 1, 15},
+    {u"\U0001F449\U0001F3FD", u"", u"1F449-1F3FD", u"", 808, 1, 15},
+    {u"\U0001F449\U0001F3FE", u"", u"1F449-1F3FE", u"", 809, 1, 15},
+    {u"\U0001F449\U0001F3FF", u"", u"1F449-1F3FF", u"", 810, 1, 15},
+    {u"\U0001F44A", u"", u"1F44A", u"", 811, 2, 15},
+    {u"\U0001F44A\U0001F3FB", u"", u"1F44A-1F3FB", u"", 813, 1, 15},
+    {u"\U0001F44A\U0001F3FC", u"", u"1F44A-1F3FC", u"", 814, 1, 15},
+    {u"\U0001F44A\U0001F3FD", u"", u"1F44A-1F3FD", u"", 815, 1, 15},
+    {u"\U0001F44A\U0001F3FE", u"", u"1F44A-1F3FE", u"", 816, 1, 15},
+    {u"\U0001F44A\U0001F3FF", u"", u"1F44A-1F3FF", u"", 817, 1, 15},
+    {u"\U0001F44B", u"", u"1F44B", u"", 818, 1, 15},
+    {u"\U0001F44B\U0001F3FB", u"", u"1F44B-1F3FB", u"", 819, 1, 15},
+    {u"\U0001F44B\U0001F3FC", u"", u"1F44B-1F3FC", u"", 820, 1, 15},
+    {u"\U0001F44B\U0001F3FD", u"", u"1F44B-1F3FD", u"", 821, 1, 15},
+    {u"\U0001F44B\U0001F3FE", u"", u"1F44B-1F3FE", u"", 822, 1, 15},
+    {u"\U0001F44B\U0001F3FF", u"", u"1F44B-1F3FF", u"", 823, 1, 15},
+    {u"\U0001F44C", u"", u"1F44C", u"", 824, 1, 15},
+    {u"\U0001F44C\U0001F3FB", u"", u"1F44C-1F3FB", u"", 825, 1, 15},
+    {u"\U0001F44C\U0001F3FC", u"", u"1F44C-1F3FC", u"", 826, 1, 15},
+    {u"\U0001F44C\U0001F3FD", u"", u"1F44C-1F3FD", u"", 827, 1, 15},
+    {u"\U0001F44C\U0001F3FE", u"", u"1F44C-1F3FE", u"", 828, 1, 15},
+    {u"\U0001F44C\U0001F3FF", u"", u"1F44C-1F3FF", u"", 829, 1, 15},
+    {u"\U0001F44D", u"", u"1F44D", u"", 830, 2, 15},
+    {u"\U0001F44D\U0001F3FB", u"", u"1F44D-1F3FB", u"", 832, 1, 15},
+    {u"\U0001F44D\U0001F3FC", u"", u"1F44D-1F3FC", u"", 833, 1, 15},
+    {u"\U0001F44D\U0001F3FD", u"", u"1F44D-1F3FD", u"", 834, 1, 15},
+    {u"\U0001F44D\U0001F3FE", u"", u"1F44D-1F3FE", u"", 835, 1, 15},
+    {u"\U0001F44D\U0001F3FF", u"", u"1F44D-1F3FF", u"", 836, 1, 15},
+    {u"\U0001F44E", u"", u"1F44E", u"", 837, 2, 15},
+    {u"\U0001F44E\U0001F3FB", u"", u"1F44E-1F3FB", u"", 839, 1, 15},
+    {u"\U0001F44E\U0001F3FC", u"", u"1F44E-1F3FC", u"", 840, 1, 15},
+    {u"\U0001F44E\U0001F3FD", u"", u"1F44E-1F3FD", u"", 841, 1, 15},
+    {u"\U0001F44E\U0001F3FE", u"", u"1F44E-1F3FE", u"", 842, 1, 15},
+    {u"\U0001F44E\U0001F3FF", u"", u"1F44E-1F3FF", u"", 843, 1, 15},
+    {u"\U0001F44F", u"", u"1F44F", u"", 844, 1, 15},
+    {u"\U0001F44F\U0001F3FB", u"", u"1F44F-1F3FB", u"", 845, 1, 15},
+    {u"\U0001F44F\U0001F3FC", u"", u"1F44F-1F3FC", u"", 846, 1, 15},
+    {u"\U0001F44F\U0001F3FD", u"", u"1F44F-1F3FD", u"", 847, 1, 15},
+    {u"\U0001F44F\U0001F3FE", u"", u"1F44F-1F3FE", u"", 848, 1, 15},
+    {u"\U0001F44F\U0001F3FF", u"", u"1F44F-1F3FF", u"", 849, 1, 15},
+    {u"\U0001F450", u"", u"1F450", u"", 850, 1, 15},
+    {u"\U0001F450\U0001F3FB", u"", u"1F450-1F3FB", u"", 851, 1, 15},
+    {u"\U0001F450\U0001F3FC", u"", u"1F450-1F3FC", u"", 852, 1, 15},
+    {u"\U0001F450\U0001F3FD", u"", u"1F450-1F3FD", u"", 853, 1, 15},
+    {u"\U0001F450\U0001F3FE", u"", u"1F450-1F3FE", u"", 854, 1, 15},
+    {u"\U0001F450\U0001F3FF", u"", u"1F450-1F3FF", u"", 855, 1, 15},
+    {u"\U0001F451", u"", u"1F451", u"", 856, 1, 15},
+    {u"\U0001F452", u"", u"1F452", u"", 857, 1, 15},
+    {u"\U0001F453", u"", u"1F453", u"", 858, 1, 15},
+    {u"\U0001F454", u"", u"1F454", u"", 859, 1, 15},
+    {u"\U0001F455", u"", u"1F455", u"", 860, 2, 15},
+    {u"\U0001F456", u"", u"1F456", u"", 862, 1, 15},
+    {u"\U0001F457", u"", u"1F457", u"", 863, 1, 15},
+    {u"\U0001F458", u"", u"1F458", u"", 864, 1, 15},
+    {u"\U0001F459", u"", u"1F459", u"", 865, 1, 15},
+    {u"\U0001F45A", u"", u"1F45A", u"", 866, 1, 15},
+    {u"\U0001F45B", u"", u"1F45B", u"", 867, 1, 15},
+    {u"\U0001F45C", u"", u"1F45C", u"", 868, 1, 15},
+    {u"\U0001F45D", u"", u"1F45D", u"", 869, 1, 15},
+    {u"\U0001F45E", u"", u"1F45E", u"", 870, 2, 15},
+    {u"\U0001F45F", u"", u"1F45F", u"", 872, 1, 15},
+    {u"\U0001F460", u"", u"1F460", u"", 873, 1, 15},
+    {u"\U0001F461", u"", u"1F461", u"", 874, 1, 15},
+    {u"\U0001F462", u"", u"1F462", u"", 875, 1, 15},
+    {u"\U0001F463", u"", u"1F463", u"", 876, 1, 15},
+    {u"\U0001F464", u"", u"1F464", u"", 877, 1, 15},
+    {u"\U0001F465", u"", u"1F465", u"", 878, 1, 15},
+    {u"\U0001F466", u"", u"1F466", u"", 879, 1, 15},
+    {u"\U0001F466\U0001F3FB", u"", u"1F466-1F3FB", u"", 880, 1, 15},
+    {u"\U0001F466\U0001F3FC", u"", u"1F466-1F3FC", u"", 881, 1, 15},
+    {u"\U0001F466\U0001F3FD", u"", u"1F466-1F3FD", u"", 882, 1, 15},
+    {u"\U0001F466\U0001F3FE", u"", u"1F466-1F3FE", u"", 883, 1, 15},
+    {u"\U0001F466\U0001F3FF", u"", u"1F466-1F3FF", u"", 884, 1, 15},
+    {u"\U0001F467", u"", u"1F467", u"", 885, 1, 15},
+    {u"\U0001F467\U0001F3FB", u"", u"1F467-1F3FB", u"", 886, 1, 15},
+    {u"\U0001F467\U0001F3FC", u"", u"1F467-1F3FC", u"", 887, 1, 15},
+    {u"\U0001F467\U0001F3FD", u"", u"1F467-1F3FD", u"", 888, 1, 15},
+    {u"\U0001F467\U0001F3FE", u"", u"1F467-1F3FE", u"", 889, 1, 15},
+    {u"\U0001F467\U0001F3FF", u"", u"1F467-1F3FF", u"", 890, 1, 15},
+    {u"\U0001F468\u200D\U0001F33E", u"", u"1F468-200D-1F33E", u"", 891, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F33E", u"", u"1F468-1F3FB-200D-1F33E", u"", 892, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F33E", u"", u"1F468-1F3FC-200D-1F33E", u"", 893, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F33E", u"", u"1F468-1F3FD-200D-1F33E", u"", 894, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F33E", u"", u"1F468-1F3FE-200D-1F33E", u"", 895, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F33E", u"", u"1F468-1F3FF-200D-1F33E", u"", 896, 1, 15},
+    {u"\U0001F468\u200D\U0001F373", u"", u"1F468-200D-1F373", u"", 897, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F373", u"", u"1F468-1F3FB-200D-1F373", u"", 898, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F373", u"", u"1F468-1F3FC-200D-1F373", u"", 899, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F373", u"", u"1F468-1F3FD-200D-1F373", u"", 900, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F373", u"", u"1F468-1F3FE-200D-1F373", u"", 901, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F373", u"", u"1F468-1F3FF-200D-1F373", u"", 902, 1, 15},
+    {u"\U0001F468\u200D\U0001F37C", u"", u"1F468-200D-1F37C", u"", 903, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F37C", u"", u"1F468-1F3FB-200D-1F37C", u"", 904, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F37C", u"", u"1F468-1F3FC-200D-1F37C", u"", 905, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F37C", u"", u"1F468-1F3FD-200D-1F37C", u"", 906, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F37C", u"", u"1F468-1F3FE-200D-1F37C", u"", 907, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F37C", u"", u"1F468-1F3FF-200D-1F37C", u"", 908, 1, 15},
+    {u"\U0001F468\u200D\U0001F393", u"", u"1F468-200D-1F393", u"", 909, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F393", u"", u"1F468-1F3FB-200D-1F393", u"", 910, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F393", u"", u"1F468-1F3FC-200D-1F393", u"", 911, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F393", u"", u"1F468-1F3FD-200D-1F393", u"", 912, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F393", u"", u"1F468-1F3FE-200D-1F393", u"", 913, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F393", u"", u"1F468-1F3FF-200D-1F393", u"", 914, 1, 15},
+    {u"\U0001F468\u200D\U0001F3A4", u"", u"1F468-200D-1F3A4", u"", 915, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F3A4", u"", u"1F468-1F3FB-200D-1F3A4", u"", 916, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F3A4", u"", u"1F468-1F3FC-200D-1F3A4", u"", 917, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F3A4", u"", u"1F468-1F3FD-200D-1F3A4", u"", 918, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F3A4", u"", u"1F468-1F3FE-200D-1F3A4", u"", 919, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F3A4", u"", u"1F468-1F3FF-200D-1F3A4", u"", 920, 1, 15},
+    {u"\U0001F468\u200D\U0001F3A8", u"", u"1F468-200D-1F3A8", u"", 921, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F3A8", u"", u"1F468-1F3FB-200D-1F3A8", u"", 922, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F3A8", u"", u"1F468-1F3FC-200D-1F3A8", u"", 923, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F3A8", u"", u"1F468-1F3FD-200D-1F3A8", u"", 924, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F3A8", u"", u"1F468-1F3FE-200D-1F3A8", u"", 925, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F3A8", u"", u"1F468-1F3FF-200D-1F3A8", u"", 926, 1, 15},
+    {u"\U0001F468\u200D\U0001F3EB", u"", u"1F468-200D-1F3EB", u"", 927, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F3EB", u"", u"1F468-1F3FB-200D-1F3EB", u"", 928, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F3EB", u"", u"1F468-1F3FC-200D-1F3EB", u"", 929, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F3EB", u"", u"1F468-1F3FD-200D-1F3EB", u"", 930, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F3EB", u"", u"1F468-1F3FE-200D-1F3EB", u"", 931, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F3EB", u"", u"1F468-1F3FF-200D-1F3EB", u"", 932, 1, 15},
+    {u"\U0001F468\u200D\U0001F3ED", u"", u"1F468-200D-1F3ED", u"", 933, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F3ED", u"", u"1F468-1F3FB-200D-1F3ED", u"", 934, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F3ED", u"", u"1F468-1F3FC-200D-1F3ED", u"", 935, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F3ED", u"", u"1F468-1F3FD-200D-1F3ED", u"", 936, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F3ED", u"", u"1F468-1F3FE-200D-1F3ED", u"", 937, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F3ED", u"", u"1F468-1F3FF-200D-1F3ED", u"", 938, 1, 15},
+    {u"\U0001F468\u200D\U0001F466\u200D\U0001F466", u"", u"1F468-200D-1F466-200D-1F466", u"", 939, 1, 15},
+    {u"\U0001F468\u200D\U0001F466", u"", u"1F468-200D-1F466", u"", 940, 1, 15},
+    {u"\U0001F468\u200D\U0001F467\u200D\U0001F466", u"", u"1F468-200D-1F467-200D-1F466", u"", 941, 1, 15},
+    {u"\U0001F468\u200D\U0001F467\u200D\U0001F467", u"", u"1F468-200D-1F467-200D-1F467", u"", 942, 1, 15},
+    {u"\U0001F468\u200D\U0001F467", u"", u"1F468-200D-1F467", u"", 943, 1, 15},
+    {u"\U0001F468\u200D\U0001F468\u200D\U0001F466", u"", u"1F468-200D-1F468-200D-1F466", u"", 944, 1, 15},
+    {u"\U0001F468\u200D\U0001F468\u200D\U0001F466\u200D\U0001F466", u"", u"1F468-200D-1F468-200D-1F466-200D-1F466", u"", 945, 1, 15},
+    {u"\U0001F468\u200D\U0001F468\u200D\U0001F467", u"", u"1F468-200D-1F468-200D-1F467", u"", 946, 1, 15},
+    {u"\U0001F468\u200D\U0001F468\u200D\U0001F467\u200D\U0001F466", u"", u"1F468-200D-1F468-200D-1F467-200D-1F466", u"", 947, 1, 15},
+    {u"\U0001F468\u200D\U0001F468\u200D\U0001F467\u200D\U0001F467", u"", u"1F468-200D-1F468-200D-1F467-200D-1F467", u"", 948, 1, 15},
+    {u"\U0001F468\u200D\U0001F469\u200D\U0001F466", u"", u"1F468-200D-1F469-200D-1F466", u"", 949, 1, 15},
+    {u"\U0001F468\u200D\U0001F469\u200D\U0001F466\u200D\U0001F466", u"", u"1F468-200D-1F469-200D-1F466-200D-1F466", u"", 950, 1, 15},
+    {u"\U0001F468\u200D\U0001F469\u200D\U0001F467", u"", u"1F468-200D-1F469-200D-1F467", u"", 951, 1, 15},
+    {u"\U0001F468\u200D\U0001F469\u200D\U0001F467\u200D\U0001F466", u"", u"1F468-200D-1F469-200D-1F467-200D-1F466", u"", 952, 1, 15},
+    {u"\U0001F468\u200D\U0001F469\u200D\U0001F467\u200D\U0001F467", u"", u"1F468-200D-1F469-200D-1F467-200D-1F467", u"", 953, 1, 15},
+    {u"\U0001F468\u200D\U0001F4BB", u"", u"1F468-200D-1F4BB", u"", 954, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F4BB", u"", u"1F468-1F3FB-200D-1F4BB", u"", 955, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F4BB", u"", u"1F468-1F3FC-200D-1F4BB", u"", 956, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F4BB", u"", u"1F468-1F3FD-200D-1F4BB", u"", 957, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F4BB", u"", u"1F468-1F3FE-200D-1F4BB", u"", 958, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F4BB", u"", u"1F468-1F3FF-200D-1F4BB", u"", 959, 1, 15},
+    {u"\U0001F468\u200D\U0001F4BC", u"", u"1F468-200D-1F4BC", u"", 960, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F4BC", u"", u"1F468-1F3FB-200D-1F4BC", u"", 961, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F4BC", u"", u"1F468-1F3FC-200D-1F4BC", u"", 962, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F4BC", u"", u"1F468-1F3FD-200D-1F4BC", u"", 963, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F4BC", u"", u"1F468-1F3FE-200D-1F4BC", u"", 964, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F4BC", u"", u"1F468-1F3FF-200D-1F4BC", u"", 965, 1, 15},
+    {u"\U0001F468\u200D\U0001F527", u"", u"1F468-200D-1F527", u"", 966, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F527", u"", u"1F468-1F3FB-200D-1F527", u"", 967, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F527", u"", u"1F468-1F3FC-200D-1F527", u"", 968, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F527", u"", u"1F468-1F3FD-200D-1F527", u"", 969, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F527", u"", u"1F468-1F3FE-200D-1F527", u"", 970, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F527", u"", u"1F468-1F3FF-200D-1F527", u"", 971, 1, 15},
+    {u"\U0001F468\u200D\U0001F52C", u"", u"1F468-200D-1F52C", u"", 972, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F52C", u"", u"1F468-1F3FB-200D-1F52C", u"", 973, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F52C", u"", u"1F468-1F3FC-200D-1F52C", u"", 974, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F52C", u"", u"1F468-1F3FD-200D-1F52C", u"", 975, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F52C", u"", u"1F468-1F3FE-200D-1F52C", u"", 976, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F52C", u"", u"1F468-1F3FF-200D-1F52C", u"", 977, 1, 15},
+    {u"\U0001F468\u200D\U0001F680", u"", u"1F468-200D-1F680", u"", 978, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F680", u"", u"1F468-1F3FB-200D-1F680", u"", 979, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F680", u"", u"1F468-1F3FC-200D-1F680", u"", 980, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F680", u"", u"1F468-1F3FD-200D-1F680", u"", 981, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F680", u"", u"1F468-1F3FE-200D-1F680", u"", 982, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F680", u"", u"1F468-1F3FF-200D-1F680", u"", 983, 1, 15},
+    {u"\U0001F468\u200D\U0001F692", u"", u"1F468-200D-1F692", u"", 984, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F692", u"", u"1F468-1F3FB-200D-1F692", u"", 985, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F692", u"", u"1F468-1F3FC-200D-1F692", u"", 986, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F692", u"", u"1F468-1F3FD-200D-1F692", u"", 987, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F692", u"", u"1F468-1F3FE-200D-1F692", u"", 988, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F692", u"", u"1F468-1F3FF-200D-1F692", u"", 989, 1, 15},
+    {u"\U0001F468\u200D\U0001F9AF\u200D\u27A1\uFE0F", u"\U0001F468\u200D\U0001F9AF\u200D\u27A1", u"1F468-200D-1F9AF-200D-27A1-FE0F", u"1F468-200D-1F9AF-200D-27A1", 990, 1, 7},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F9AF\u200D\u27A1\uFE0F", u"\U0001F468\U0001F3FB\u200D\U0001F9AF\u200D\u27A1", u"1F468-1F3FB-200D-1F9AF-200D-27A1-FE0F", u"1F468-1F3FB-200D-1F9AF-200D-27A1", 991, 1, 7},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F9AF\u200D\u27A1\uFE0F", u"\U0001F468\U0001F3FC\u200D\U0001F9AF\u200D\u27A1", u"1F468-1F3FC-200D-1F9AF-200D-27A1-FE0F", u"1F468-1F3FC-200D-1F9AF-200D-27A1", 992, 1, 7},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F9AF\u200D\u27A1\uFE0F", u"\U0001F468\U0001F3FD\u200D\U0001F9AF\u200D\u27A1", u"1F468-1F3FD-200D-1F9AF-200D-27A1-FE0F", u"1F468-1F3FD-200D-1F9AF-200D-27A1", 993, 1, 7},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F9AF\u200D\u27A1\uFE0F", u"\U0001F468\U0001F3FE\u200D\U0001F9AF\u200D\u27A1", u"1F468-1F3FE-200D-1F9AF-200D-27A1-FE0F", u"1F468-1F3FE-200D-1F9AF-200D-27A1", 994, 1, 7},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F9AF\u200D\u27A1\uFE0F", u"\U0001F468\U0001F3FF\u200D\U0001F9AF\u200D\u27A1", u"1F468-1F3FF-200D-1F9AF-200D-27A1-FE0F", u"1F468-1F3FF-200D-1F9AF-200D-27A1", 995, 1, 7},
+    {u"\U0001F468\u200D\U0001F9AF", u"", u"1F468-200D-1F9AF", u"", 996, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F9AF", u"", u"1F468-1F3FB-200D-1F9AF", u"", 997, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F9AF", u"", u"1F468-1F3FC-200D-1F9AF", u"", 998, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F9AF", u"", u"1F468-1F3FD-200D-1F9AF", u"", 999, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F9AF", u"", u"1F468-1F3FE-200D-1F9AF", u"", 1000, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F9AF", u"", u"1F468-1F3FF-200D-1F9AF", u"", 1001, 1, 15},
+    {u"\U0001F468\u200D\U0001F9B0", u"", u"1F468-200D-1F9B0", u"", 1002, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F9B0", u"", u"1F468-1F3FB-200D-1F9B0", u"", 1003, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F9B0", u"", u"1F468-1F3FC-200D-1F9B0", u"", 1004, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F9B0", u"", u"1F468-1F3FD-200D-1F9B0", u"", 1005, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F9B0", u"", u"1F468-1F3FE-200D-1F9B0", u"", 1006, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F9B0", u"", u"1F468-1F3FF-200D-1F9B0", u"", 1007, 1, 15},
+    {u"\U0001F468\u200D\U0001F9B1", u"", u"1F468-200D-1F9B1", u"", 1008, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F9B1", u"", u"1F468-1F3FB-200D-1F9B1", u"", 1009, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F9B1", u"", u"1F468-1F3FC-200D-1F9B1", u"", 1010, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F9B1", u"", u"1F468-1F3FD-200D-1F9B1", u"", 1011, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F9B1", u"", u"1F468-1F3FE-200D-1F9B1", u"", 1012, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F9B1", u"", u"1F468-1F3FF-200D-1F9B1", u"", 1013, 1, 15},
+    {u"\U0001F468\u200D\U0001F9B2", u"", u"1F468-200D-1F9B2", u"", 1014, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F9B2", u"", u"1F468-1F3FB-200D-1F9B2", u"", 1015, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F9B2", u"", u"1F468-1F3FC-200D-1F9B2", u"", 1016, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F9B2", u"", u"1F468-1F3FD-200D-1F9B2", u"", 1017, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F9B2", u"", u"1F468-1F3FE-200D-1F9B2", u"", 1018, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F9B2", u"", u"1F468-1F3FF-200D-1F9B2", u"", 1019, 1, 15},
+    {u"\U0001F468\u200D\U0001F9B3", u"", u"1F468-200D-1F9B3", u"", 1020, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F9B3", u"", u"1F468-1F3FB-200D-1F9B3", u"", 1021, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F9B3", u"", u"1F468-1F3FC-200D-1F9B3", u"", 1022, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F9B3", u"", u"1F468-1F3FD-200D-1F9B3", u"", 1023, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F9B3", u"", u"1F468-1F3FE-200D-1F9B3", u"", 1024, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F9B3", u"", u"1F468-1F3FF-200D-1F9B3", u"", 1025, 1, 15},
+    {u"\U0001F468\u200D\U0001F9BC\u200D\u27A1\uFE0F", u"\U0001F468\u200D\U0001F9BC\u200D\u27A1", u"1F468-200D-1F9BC-200D-27A1-FE0F", u"1F468-200D-1F9BC-200D-27A1", 1026, 1, 7},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F9BC\u200D\u27A1\uFE0F", u"\U0001F468\U0001F3FB\u200D\U0001F9BC\u200D\u27A1", u"1F468-1F3FB-200D-1F9BC-200D-27A1-FE0F", u"1F468-1F3FB-200D-1F9BC-200D-27A1", 1027, 1, 7},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F9BC\u200D\u27A1\uFE0F", u"\U0001F468\U0001F3FC\u200D\U0001F9BC\u200D\u27A1", u"1F468-1F3FC-200D-1F9BC-200D-27A1-FE0F", u"1F468-1F3FC-200D-1F9BC-200D-27A1", 1028, 1, 7},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F9BC\u200D\u27A1\uFE0F", u"\U0001F468\U0001F3FD\u200D\U0001F9BC\u200D\u27A1", u"1F468-1F3FD-200D-1F9BC-200D-27A1-FE0F", u"1F468-1F3FD-200D-1F9BC-200D-27A1", 1029, 1, 7},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F9BC\u200D\u27A1\uFE0F", u"\U0001F468\U0001F3FE\u200D\U0001F9BC\u200D\u27A1", u"1F468-1F3FE-200D-1F9BC-200D-27A1-FE0F", u"1F468-1F3FE-200D-1F9BC-200D-27A1", 1030, 1, 7},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F9BC\u200D\u27A1\uFE0F", u"\U0001F468\U0001F3FF\u200D\U0001F9BC\u200D\u27A1", u"1F468-1F3FF-200D-1F9BC-200D-27A1-FE0F", u"1F468-1F3FF-200D-1F9BC-200D-27A1", 1031, 1, 7},
+    {u"\U0001F468\u200D\U0001F9BC", u"", u"1F468-200D-1F9BC", u"", 1032, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F9BC", u"", u"1F468-1F3FB-200D-1F9BC", u"", 1033, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F9BC", u"", u"1F468-1F3FC-200D-1F9BC", u"", 1034, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F9BC", u"", u"1F468-1F3FD-200D-1F9BC", u"", 1035, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F9BC", u"", u"1F468-1F3FE-200D-1F9BC", u"", 1036, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F9BC", u"", u"1F468-1F3FF-200D-1F9BC", u"", 1037, 1, 15},
+    {u"\U0001F468\u200D\U0001F9BD\u200D\u27A1\uFE0F", u"\U0001F468\u200D\U0001F9BD\u200D\u27A1", u"1F468-200D-1F9BD-200D-27A1-FE0F", u"1F468-200D-1F9BD-200D-27A1", 1038, 1, 7},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F9BD\u200D\u27A1\uFE0F", u"\U0001F468\U0001F3FB\u200D\U0001F9BD\u200D\u27A1", u"1F468-1F3FB-200D-1F9BD-200D-27A1-FE0F", u"1F468-1F3FB-200D-1F9BD-200D-27A1", 1039, 1, 7},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F9BD\u200D\u27A1\uFE0F", u"\U0001F468\U0001F3FC\u200D\U0001F9BD\u200D\u27A1", u"1F468-1F3FC-200D-1F9BD-200D-27A1-FE0F", u"1F468-1F3FC-200D-1F9BD-200D-27A1", 1040, 1, 7},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F9BD\u200D\u27A1\uFE0F", u"\U0001F468\U0001F3FD\u200D\U0001F9BD\u200D\u27A1", u"1F468-1F3FD-200D-1F9BD-200D-27A1-FE0F", u"1F468-1F3FD-200D-1F9BD-200D-27A1", 1041, 1, 7},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F9BD\u200D\u27A1\uFE0F", u"\U0001F468\U0001F3FE\u200D\U0001F9BD\u200D\u27A1", u"1F468-1F3FE-200D-1F9BD-200D-27A1-FE0F", u"1F468-1F3FE-200D-1F9BD-200D-27A1", 1042, 1, 7},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F9BD\u200D\u27A1\uFE0F", u"\U0001F468\U0001F3FF\u200D\U0001F9BD\u200D\u27A1", u"1F468-1F3FF-200D-1F9BD-200D-27A1-FE0F", u"1F468-1F3FF-200D-1F9BD-200D-27A1", 1043, 1, 7},
+    {u"\U0001F468\u200D\U0001F9BD", u"", u"1F468-200D-1F9BD", u"", 1044, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F9BD", u"", u"1F468-1F3FB-200D-1F9BD", u"", 1045, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F9BD", u"", u"1F468-1F3FC-200D-1F9BD", u"", 1046, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F9BD", u"", u"1F468-1F3FD-200D-1F9BD", u"", 1047, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F9BD", u"", u"1F468-1F3FE-200D-1F9BD", u"", 1048, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F9BD", u"", u"1F468-1F3FF-200D-1F9BD", u"", 1049, 1, 15},
+    {u"\U0001F468\u200D\u2695\uFE0F", u"\U0001F468\u200D\u2695", u"1F468-200D-2695-FE0F", u"1F468-200D-2695", 1050, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\u2695\uFE0F", u"\U0001F468\U0001F3FB\u200D\u2695", u"1F468-1F3FB-200D-2695-FE0F", u"1F468-1F3FB-200D-2695", 1051, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\u2695\uFE0F", u"\U0001F468\U0001F3FC\u200D\u2695", u"1F468-1F3FC-200D-2695-FE0F", u"1F468-1F3FC-200D-2695", 1052, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\u2695\uFE0F", u"\U0001F468\U0001F3FD\u200D\u2695", u"1F468-1F3FD-200D-2695-FE0F", u"1F468-1F3FD-200D-2695", 1053, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\u2695\uFE0F", u"\U0001F468\U0001F3FE\u200D\u2695", u"1F468-1F3FE-200D-2695-FE0F", u"1F468-1F3FE-200D-2695", 1054, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\u2695\uFE0F", u"\U0001F468\U0001F3FF\u200D\u2695", u"1F468-1F3FF-200D-2695-FE0F", u"1F468-1F3FF-200D-2695", 1055, 1, 15},
+    {u"\U0001F468\u200D\u2696\uFE0F", u"\U0001F468\u200D\u2696", u"1F468-200D-2696-FE0F", u"1F468-200D-2696", 1056, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\u2696\uFE0F", u"\U0001F468\U0001F3FB\u200D\u2696", u"1F468-1F3FB-200D-2696-FE0F", u"1F468-1F3FB-200D-2696", 1057, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\u2696\uFE0F", u"\U0001F468\U0001F3FC\u200D\u2696", u"1F468-1F3FC-200D-2696-FE0F", u"1F468-1F3FC-200D-2696", 1058, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\u2696\uFE0F", u"\U0001F468\U0001F3FD\u200D\u2696", u"1F468-1F3FD-200D-2696-FE0F", u"1F468-1F3FD-200D-2696", 1059, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\u2696\uFE0F", u"\U0001F468\U0001F3FE\u200D\u2696", u"1F468-1F3FE-200D-2696-FE0F", u"1F468-1F3FE-200D-2696", 1060, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\u2696\uFE0F", u"\U0001F468\U0001F3FF\u200D\u2696", u"1F468-1F3FF-200D-2696-FE0F", u"1F468-1F3FF-200D-2696", 1061, 1, 15},
+    {u"\U0001F468\u200D\u2708\uFE0F", u"\U0001F468\u200D\u2708", u"1F468-200D-2708-FE0F", u"1F468-200D-2708", 1062, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\u2708\uFE0F", u"\U0001F468\U0001F3FB\u200D\u2708", u"1F468-1F3FB-200D-2708-FE0F", u"1F468-1F3FB-200D-2708", 1063, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\u2708\uFE0F", u"\U0001F468\U0001F3FC\u200D\u2708", u"1F468-1F3FC-200D-2708-FE0F", u"1F468-1F3FC-200D-2708", 1064, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\u2708\uFE0F", u"\U0001F468\U0001F3FD\u200D\u2708", u"1F468-1F3FD-200D-2708-FE0F", u"1F468-1F3FD-200D-2708", 1065, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\u2708\uFE0F", u"\U0001F468\U0001F3FE\u200D\u2708", u"1F468-1F3FE-200D-2708-FE0F", u"1F468-1F3FE-200D-2708", 1066, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\u2708\uFE0F", u"\U0001F468\U0001F3FF\u200D\u2708", u"1F468-1F3FF-200D-2708-FE0F", u"1F468-1F3FF-200D-2708", 1067, 1, 15},
+    {u"\U0001F468\u200D\u2764\uFE0F\u200D\U0001F468", u"\U0001F468\u200D\u2764\u200D\U0001F468", u"1F468-200D-2764-FE0F-200D-1F468", u"1F468-200D-2764-200D-1F468", 1068, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FB", u"\U0001F468\U0001F3FB\u200D\u2764\u200D\U0001F468\U0001F3FB", u"1F468-1F3FB-200D-2764-FE0F-200D-1F468-1F3FB", u"1F468-1F3FB-200D-2764-200D-1F468-1F3FB", 1069, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FC", u"\U0001F468\U0001F3FB\u200D\u2764\u200D\U0001F468\U0001F3FC", u"1F468-1F3FB-200D-2764-FE0F-200D-1F468-1F3FC", u"1F468-1F3FB-200D-2764-200D-1F468-1F3FC", 1070, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FD", u"\U0001F468\U0001F3FB\u200D\u2764\u200D\U0001F468\U0001F3FD", u"1F468-1F3FB-200D-2764-FE0F-200D-1F468-1F3FD", u"1F468-1F3FB-200D-2764-200D-1F468-1F3FD", 1071, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FE", u"\U0001F468\U0001F3FB\u200D\u2764\u200D\U0001F468\U0001F3FE", u"1F468-1F3FB-200D-2764-FE0F-200D-1F468-1F3FE", u"1F468-1F3FB-200D-2764-200D-1F468-1F3FE", 1072, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FF", u"\U0001F468\U0001F3FB\u200D\u2764\u200D\U0001F468\U0001F3FF", u"1F468-1F3FB-200D-2764-FE0F-200D-1F468-1F3FF", u"1F468-1F3FB-200D-2764-200D-1F468-1F3FF", 1073, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FB", u"\U0001F468\U0001F3FC\u200D\u2764\u200D\U0001F468\U0001F3FB", u"1F468-1F3FC-200D-2764-FE0F-200D-1F468-1F3FB", u"1F468-1F3FC-200D-2764-200D-1F468-1F3FB", 1074, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FC", u"\U0001F468\U0001F3FC\u200D\u2764\u200D\U0001F468\U0001F3FC", u"1F468-1F3FC-200D-2764-FE0F-200D-1F468-1F3FC", u"1F468-1F3FC-200D-2764-200D-1F468-1F3FC", 1075, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FD", u"\U0001F468\U0001F3FC\u200D\u2764\u200D\U0001F468\U0001F3FD", u"1F468-1F3FC-200D-2764-FE0F-200D-1F468-1F3FD", u"1F468-1F3FC-200D-2764-200D-1F468-1F3FD", 1076, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FE", u"\U0001F468\U0001F3FC\u200D\u2764\u200D\U0001F468\U0001F3FE", u"1F468-1F3FC-200D-2764-FE0F-200D-1F468-1F3FE", u"1F468-1F3FC-200D-2764-200D-1F468-1F3FE", 1077, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FF", u"\U0001F468\U0001F3FC\u200D\u2764\u200D\U0001F468\U0001F3FF", u"1F468-1F3FC-200D-2764-FE0F-200D-1F468-1F3FF", u"1F468-1F3FC-200D-2764-200D-1F468-1F3FF", 1078, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FB", u"\U0001F468\U0001F3FD\u200D\u2764\u200D\U0001F468\U0001F3FB", u"1F468-1F3FD-200D-2764-FE0F-200D-1F468-1F3FB", u"1F468-1F3FD-200D-2764-200D-1F468-1F3FB", 1079, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FC", u"\U0001F468\U0001F3FD\u200D\u2764\u200D\U0001F468\U0001F3FC", u"1F468-1F3FD-200D-2764-FE0F-200D-1F468-1F3FC", u"1F468-1F3FD-200D-2764-200D-1F468-1F3FC", 1080, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FD", u"\U0001F468\U0001F3FD\u200D\u2764\u200D\U0001F468\U0001F3FD", u"1F468-1F3FD-200D-2764-FE0F-200D-1F468-1F3FD", u"1F468-1F3FD-200D-2764-200D-1F468-1F3FD", 1081, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FE", u"\U0001F468\U0001F3FD\u200D\u2764\u200D\U0001F468\U0001F3FE", u"1F468-1F3FD-200D-2764-FE0F-200D-1F468-1F3FE", u"1F468-1F3FD-200D-2764-200D-1F468-1F3FE", 1082, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FF", u"\U0001F468\U0001F3FD\u200D\u2764\u200D\U0001F468\U0001F3FF", u"1F468-1F3FD-200D-2764-FE0F-200D-1F468-1F3FF", u"1F468-1F3FD-200D-2764-200D-1F468-1F3FF", 1083, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FB", u"\U0001F468\U0001F3FE\u200D\u2764\u200D\U0001F468\U0001F3FB", u"1F468-1F3FE-200D-2764-FE0F-200D-1F468-1F3FB", u"1F468-1F3FE-200D-2764-200D-1F468-1F3FB", 1084, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FC", u"\U0001F468\U0001F3FE\u200D\u2764\u200D\U0001F468\U0001F3FC", u"1F468-1F3FE-200D-2764-FE0F-200D-1F468-1F3FC", u"1F468-1F3FE-200D-2764-200D-1F468-1F3FC", 1085, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FD", u"\U0001F468\U0001F3FE\u200D\u2764\u200D\U0001F468\U0001F3FD", u"1F468-1F3FE-200D-2764-FE0F-200D-1F468-1F3FD", u"1F468-1F3FE-200D-2764-200D-1F468-1F3FD", 1086, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FE", u"\U0001F468\U0001F3FE\u200D\u2764\u200D\U0001F468\U0001F3FE", u"1F468-1F3FE-200D-2764-FE0F-200D-1F468-1F3FE", u"1F468-1F3FE-200D-2764-200D-1F468-1F3FE", 1087, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FF", u"\U0001F468\U0001F3FE\u200D\u2764\u200D\U0001F468\U0001F3FF", u"1F468-1F3FE-200D-2764-FE0F-200D-1F468-1F3FF", u"1F468-1F3FE-200D-2764-200D-1F468-1F3FF", 1088, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FB", u"\U0001F468\U0001F3FF\u200D\u2764\u200D\U0001F468\U0001F3FB", u"1F468-1F3FF-200D-2764-FE0F-200D-1F468-1F3FB", u"1F468-1F3FF-200D-2764-200D-1F468-1F3FB", 1089, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FC", u"\U0001F468\U0001F3FF\u200D\u2764\u200D\U0001F468\U0001F3FC", u"1F468-1F3FF-200D-2764-FE0F-200D-1F468-1F3FC", u"1F468-1F3FF-200D-2764-200D-1F468-1F3FC", 1090, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FD", u"\U0001F468\U0001F3FF\u200D\u2764\u200D\U0001F468\U0001F3FD", u"1F468-1F3FF-200D-2764-FE0F-200D-1F468-1F3FD", u"1F468-1F3FF-200D-2764-200D-1F468-1F3FD", 1091, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FE", u"\U0001F468\U0001F3FF\u200D\u2764\u200D\U0001F468\U0001F3FE", u"1F468-1F3FF-200D-2764-FE0F-200D-1F468-1F3FE", u"1F468-1F3FF-200D-2764-200D-1F468-1F3FE", 1092, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FF", u"\U0001F468\U0001F3FF\u200D\u2764\u200D\U0001F468\U0001F3FF", u"1F468-1F3FF-200D-2764-FE0F-200D-1F468-1F3FF", u"1F468-1F3FF-200D-2764-200D-1F468-1F3FF", 1093, 1, 15},
+    {u"\U0001F468\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468", u"\U0001F468\u200D\u2764\u200D\U0001F48B\u200D\U0001F468", u"1F468-200D-2764-FE0F-200D-1F48B-200D-1F468", u"1F468-200D-2764-200D-1F48B-200D-1F468", 1094, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FB", u"\U0001F468\U0001F3FB\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FB", u"1F468-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FB", u"1F468-1F3FB-200D-2764-200D-1F48B-200D-1F468-1F3FB", 1095, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FC", u"\U0001F468\U0001F3FB\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FC", u"1F468-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FC", u"1F468-1F3FB-200D-2764-200D-1F48B-200D-1F468-1F3FC", 1096, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FD", u"\U0001F468\U0001F3FB\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FD", u"1F468-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FD", u"1F468-1F3FB-200D-2764-200D-1F48B-200D-1F468-1F3FD", 1097, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FE", u"\U0001F468\U0001F3FB\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FE", u"1F468-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FE", u"1F468-1F3FB-200D-2764-200D-1F48B-200D-1F468-1F3FE", 1098, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FF", u"\U0001F468\U0001F3FB\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FF", u"1F468-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FF", u"1F468-1F3FB-200D-2764-200D-1F48B-200D-1F468-1F3FF", 1099, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FB", u"\U0001F468\U0001F3FC\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FB", u"1F468-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FB", u"1F468-1F3FC-200D-2764-200D-1F48B-200D-1F468-1F3FB", 1100, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FC", u"\U0001F468\U0001F3FC\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FC", u"1F468-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FC", u"1F468-1F3FC-200D-2764-200D-1F48B-200D-1F468-1F3FC", 1101, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FD", u"\U0001F468\U0001F3FC\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FD", u"1F468-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FD", u"1F468-1F3FC-200D-2764-200D-1F48B-200D-1F468-1F3FD", 1102, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FE", u"\U0001F468\U0001F3FC\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FE", u"1F468-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FE", u"1F468-1F3FC-200D-2764-200D-1F48B-200D-1F468-1F3FE", 1103, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FF", u"\U0001F468\U0001F3FC\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FF", u"1F468-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FF", u"1F468-1F3FC-200D-2764-200D-1F48B-200D-1F468-1F3FF", 1104, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FB", u"\U0001F468\U0001F3FD\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FB", u"1F468-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FB", u"1F468-1F3FD-200D-2764-200D-1F48B-200D-1F468-1F3FB", 1105, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FC", u"\U0001F468\U0001F3FD\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FC", u"1F468-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FC", u"1F468-1F3FD-200D-2764-200D-1F48B-200D-1F468-1F3FC", 1106, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FD", u"\U0001F468\U0001F3FD\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FD", u"1F468-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FD", u"1F468-1F3FD-200D-2764-200D-1F48B-200D-1F468-1F3FD", 1107, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FE", u"\U0001F468\U0001F3FD\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FE", u"1F468-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FE", u"1F468-1F3FD-200D-2764-200D-1F48B-200D-1F468-1F3FE", 1108, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FF", u"\U0001F468\U0001F3FD\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FF", u"1F468-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FF", u"1F468-1F3FD-200D-2764-200D-1F48B-200D-1F468-1F3FF", 1109, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FB", u"\U0001F468\U0001F3FE\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FB", u"1F468-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FB", u"1F468-1F3FE-200D-2764-200D-1F48B-200D-1F468-1F3FB", 1110, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FC", u"\U0001F468\U0001F3FE\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FC", u"1F468-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FC", u"1F468-1F3FE-200D-2764-200D-1F48B-200D-1F468-1F3FC", 1111, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FD", u"\U0001F468\U0001F3FE\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FD", u"1F468-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FD", u"1F468-1F3FE-200D-2764-200D-1F48B-200D-1F468-1F3FD", 1112, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FE", u"\U0001F468\U0001F3FE\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FE", u"1F468-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FE", u"1F468-1F3FE-200D-2764-200D-1F48B-200D-1F468-1F3FE", 1113, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FF", u"\U0001F468\U0001F3FE\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FF", u"1F468-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FF", u"1F468-1F3FE-200D-2764-200D-1F48B-200D-1F468-1F3FF", 1114, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FB", u"\U0001F468\U0001F3FF\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FB", u"1F468-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FB", u"1F468-1F3FF-200D-2764-200D-1F48B-200D-1F468-1F3FB", 1115, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FC", u"\U0001F468\U0001F3FF\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FC", u"1F468-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FC", u"1F468-1F3FF-200D-2764-200D-1F48B-200D-1F468-1F3FC", 1116, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FD", u"\U0001F468\U0001F3FF\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FD", u"1F468-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FD", u"1F468-1F3FF-200D-2764-200D-1F48B-200D-1F468-1F3FD", 1117, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FE", u"\U0001F468\U0001F3FF\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FE", u"1F468-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FE", u"1F468-1F3FF-200D-2764-200D-1F48B-200D-1F468-1F3FE", 1118, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FF", u"\U0001F468\U0001F3FF\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FF", u"1F468-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FF", u"1F468-1F3FF-200D-2764-200D-1F48B-200D-1F468-1F3FF", 1119, 1, 15},
+    {u"\U0001F468", u"", u"1F468", u"", 1120, 1, 15},
+    {u"\U0001F468\U0001F3FB", u"", u"1F468-1F3FB", u"", 1121, 1, 15},
+    {u"\U0001F468\U0001F3FC", u"", u"1F468-1F3FC", u"", 1122, 1, 15},
+    {u"\U0001F468\U0001F3FD", u"", u"1F468-1F3FD", u"", 1123, 1, 15},
+    {u"\U0001F468\U0001F3FE", u"", u"1F468-1F3FE", u"", 1124, 1, 15},
+    {u"\U0001F468\U0001F3FF", u"", u"1F468-1F3FF", u"", 1125, 1, 15},
+    {u"\U0001F469\u200D\U0001F33E", u"", u"1F469-200D-1F33E", u"", 1126, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F33E", u"", u"1F469-1F3FB-200D-1F33E", u"", 1127, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F33E", u"", u"1F469-1F3FC-200D-1F33E", u"", 1128, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F33E", u"", u"1F469-1F3FD-200D-1F33E", u"", 1129, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F33E", u"", u"1F469-1F3FE-200D-1F33E", u"", 1130, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F33E", u"", u"1F469-1F3FF-200D-1F33E", u"", 1131, 1, 15},
+    {u"\U0001F469\u200D\U0001F373", u"", u"1F469-200D-1F373", u"", 1132, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F373", u"", u"1F469-1F3FB-200D-1F373", u"", 1133, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F373", u"", u"1F469-1F3FC-200D-1F373", u"", 1134, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F373", u"", u"1F469-1F3FD-200D-1F373", u"", 1135, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F373", u"", u"1F469-1F3FE-200D-1F373", u"", 1136, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F373", u"", u"1F469-1F3FF-200D-1F373", u"", 1137, 1, 15},
+    {u"\U0001F469\u200D\U0001F37C", u"", u"1F469-200D-1F37C", u"", 1138, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F37C", u"", u"1F469-1F3FB-200D-1F37C", u"", 1139, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F37C", u"", u"1F469-1F3FC-200D-1F37C", u"", 1140, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F37C", u"", u"1F469-1F3FD-200D-1F37C", u"", 1141, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F37C", u"", u"1F469-1F3FE-200D-1F37C", u"", 1142, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F37C", u"", u"1F469-1F3FF-200D-1F37C", u"", 1143, 1, 15},
+    {u"\U0001F469\u200D\U0001F393", u"", u"1F469-200D-1F393", u"", 1144, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F393", u"", u"1F469-1F3FB-200D-1F393", u"", 1145, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F393", u"", u"1F469-1F3FC-200D-1F393", u"", 1146, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F393", u"", u"1F469-1F3FD-200D-1F393", u"", 1147, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F393", u"", u"1F469-1F3FE-200D-1F393", u"", 1148, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F393", u"", u"1F469-1F3FF-200D-1F393", u"", 1149, 1, 15},
+    {u"\U0001F469\u200D\U0001F3A4", u"", u"1F469-200D-1F3A4", u"", 1150, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F3A4", u"", u"1F469-1F3FB-200D-1F3A4", u"", 1151, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F3A4", u"", u"1F469-1F3FC-200D-1F3A4", u"", 1152, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F3A4", u"", u"1F469-1F3FD-200D-1F3A4", u"", 1153, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F3A4", u"", u"1F469-1F3FE-200D-1F3A4", u"", 1154, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F3A4", u"", u"1F469-1F3FF-200D-1F3A4", u"", 1155, 1, 15},
+    {u"\U0001F469\u200D\U0001F3A8", u"", u"1F469-200D-1F3A8", u"", 1156, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F3A8", u"", u"1F469-1F3FB-200D-1F3A8", u"", 1157, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F3A8", u"", u"1F469-1F3FC-200D-1F3A8", u"", 1158, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F3A8", u"", u"1F469-1F3FD-200D-1F3A8", u"", 1159, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F3A8", u"", u"1F469-1F3FE-200D-1F3A8", u"", 1160, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F3A8", u"", u"1F469-1F3FF-200D-1F3A8", u"", 1161, 1, 15},
+    {u"\U0001F469\u200D\U0001F3EB", u"", u"1F469-200D-1F3EB", u"", 1162, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F3EB", u"", u"1F469-1F3FB-200D-1F3EB", u"", 1163, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F3EB", u"", u"1F469-1F3FC-200D-1F3EB", u"", 1164, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F3EB", u"", u"1F469-1F3FD-200D-1F3EB", u"", 1165, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F3EB", u"", u"1F469-1F3FE-200D-1F3EB", u"", 1166, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F3EB", u"", u"1F469-1F3FF-200D-1F3EB", u"", 1167, 1, 15},
+    {u"\U0001F469\u200D\U0001F3ED", u"", u"1F469-200D-1F3ED", u"", 1168, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F3ED", u"", u"1F469-1F3FB-200D-1F3ED", u"", 1169, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F3ED", u"", u"1F469-1F3FC-200D-1F3ED", u"", 1170, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F3ED", u"", u"1F469-1F3FD-200D-1F3ED", u"", 1171, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F3ED", u"", u"1F469-1F3FE-200D-1F3ED", u"", 1172, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F3ED", u"", u"1F469-1F3FF-200D-1F3ED", u"", 1173, 1, 15},
+    {u"\U0001F469\u200D\U0001F466\u200D\U0001F466", u"", u"1F469-200D-1F466-200D-1F466", u"", 1174, 1, 15},
+    {u"\U0001F469\u200D\U0001F466", u"", u"1F469-200D-1F466", u"", 1175, 1, 15},
+    {u"\U0001F469\u200D\U0001F467\u200D\U0001F466", u"", u"1F469-200D-1F467-200D-1F466", u"", 1176, 1, 15},
+    {u"\U0001F469\u200D\U0001F467\u200D\U0001F467", u"", u"1F469-200D-1F467-200D-1F467", u"", 1177, 1, 15},
+    {u"\U0001F469\u200D\U0001F467", u"", u"1F469-200D-1F467", u"", 1178, 1, 15},
+    {u"\U0001F469\u200D\U0001F469\u200D\U0001F466", u"", u"1F469-200D-1F469-200D-1F466", u"", 1179, 1, 15},
+    {u"\U0001F469\u200D\U0001F469\u200D\U0001F466\u200D\U0001F466", u"", u"1F469-200D-1F469-200D-1F466-200D-1F466", u"", 1180, 1, 15},
+    {u"\U0001F469\u200D\U0001F469\u200D\U0001F467", u"", u"1F469-200D-1F469-200D-1F467", u"", 1181, 1, 15},
+    {u"\U0001F469\u200D\U0001F469\u200D\U0001F467\u200D\U0001F466", u"", u"1F469-200D-1F469-200D-1F467-200D-1F466", u"", 1182, 1, 15},
+    {u"\U0001F469\u200D\U0001F469\u200D\U0001F467\u200D\U0001F467", u"", u"1F469-200D-1F469-200D-1F467-200D-1F467", u"", 1183, 1, 15},
+    {u"\U0001F469\u200D\U0001F4BB", u"", u"1F469-200D-1F4BB", u"", 1184, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F4BB", u"", u"1F469-1F3FB-200D-1F4BB", u"", 1185, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F4BB", u"", u"1F469-1F3FC-200D-1F4BB", u"", 1186, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F4BB", u"", u"1F469-1F3FD-200D-1F4BB", u"", 1187, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F4BB", u"", u"1F469-1F3FE-200D-1F4BB", u"", 1188, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F4BB", u"", u"1F469-1F3FF-200D-1F4BB", u"", 1189, 1, 15},
+    {u"\U0001F469\u200D\U0001F4BC", u"", u"1F469-200D-1F4BC", u"", 1190, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F4BC", u"", u"1F469-1F3FB-200D-1F4BC", u"", 1191, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F4BC", u"", u"1F469-1F3FC-200D-1F4BC", u"", 1192, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F4BC", u"", u"1F469-1F3FD-200D-1F4BC", u"", 1193, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F4BC", u"", u"1F469-1F3FE-200D-1F4BC", u"", 1194, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F4BC", u"", u"1F469-1F3FF-200D-1F4BC", u"", 1195, 1, 15},
+    {u"\U0001F469\u200D\U0001F527", u"", u"1F469-200D-1F527", u"", 1196, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F527", u"", u"1F469-1F3FB-200D-1F527", u"", 1197, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F527", u"", u"1F469-1F3FC-200D-1F527", u"", 1198, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F527", u"", u"1F469-1F3FD-200D-1F527", u"", 1199, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F527", u"", u"1F469-1F3FE-200D-1F527", u"", 1200, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F527", u"", u"1F469-1F3FF-200D-1F527", u"", 1201, 1, 15},
+    {u"\U0001F469\u200D\U0001F52C", u"", u"1F469-200D-1F52C", u"", 1202, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F52C", u"", u"1F469-1F3FB-200D-1F52C", u"", 1203, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F52C", u"", u"1F469-1F3FC-200D-1F52C", u"", 1204, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F52C", u"", u"1F469-1F3FD-200D-1F52C", u"", 1205, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F52C", u"", u"1F469-1F3FE-200D-1F52C", u"", 1206, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F52C", u"", u"1F469-1F3FF-200D-1F52C", u"", 1207, 1, 15},
+    {u"\U0001F469\u200D\U0001F680", u"", u"1F469-200D-1F680", u"", 1208, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F680", u"", u"1F469-1F3FB-200D-1F680", u"", 1209, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F680", u"", u"1F469-1F3FC-200D-1F680", u"", 1210, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F680", u"", u"1F469-1F3FD-200D-1F680", u"", 1211, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F680", u"", u"1F469-1F3FE-200D-1F680", u"", 1212, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F680", u"", u"1F469-1F3FF-200D-1F680", u"", 1213, 1, 15},
+    {u"\U0001F469\u200D\U0001F692", u"", u"1F469-200D-1F692", u"", 1214, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F692", u"", u"1F469-1F3FB-200D-1F692", u"", 1215, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F692", u"", u"1F469-1F3FC-200D-1F692", u"", 1216, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F692", u"", u"1F469-1F3FD-200D-1F692", u"", 1217, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F692", u"", u"1F469-1F3FE-200D-1F692", u"", 1218, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F692", u"", u"1F469-1F3FF-200D-1F692", u"", 1219, 1, 15},
+    {u"\U0001F469\u200D\U0001F9AF\u200D\u27A1\uFE0F", u"\U0001F469\u200D\U0001F9AF\u200D\u27A1", u"1F469-200D-1F9AF-200D-27A1-FE0F", u"1F469-200D-1F9AF-200D-27A1", 1220, 1, 7},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F9AF\u200D\u27A1\uFE0F", u"\U0001F469\U0001F3FB\u200D\U0001F9AF\u200D\u27A1", u"1F469-1F3FB-200D-1F9AF-200D-27A1-FE0F", u"1F469-1F3FB-200D-1F9AF-200D-27A1", 1221, 1, 7},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F9AF\u200D\u27A1\uFE0F", u"\U0001F469\U0001F3FC\u200D\U0001F9AF\u200D\u27A1", u"1F469-1F3FC-200D-1F9AF-200D-27A1-FE0F", u"1F469-1F3FC-200D-1F9AF-200D-27A1", 1222, 1, 7},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F9AF\u200D\u27A1\uFE0F", u"\U0001F469\U0001F3FD\u200D\U0001F9AF\u200D\u27A1", u"1F469-1F3FD-200D-1F9AF-200D-27A1-FE0F", u"1F469-1F3FD-200D-1F9AF-200D-27A1", 1223, 1, 7},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F9AF\u200D\u27A1\uFE0F", u"\U0001F469\U0001F3FE\u200D\U0001F9AF\u200D\u27A1", u"1F469-1F3FE-200D-1F9AF-200D-27A1-FE0F", u"1F469-1F3FE-200D-1F9AF-200D-27A1", 1224, 1, 7},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F9AF\u200D\u27A1\uFE0F", u"\U0001F469\U0001F3FF\u200D\U0001F9AF\u200D\u27A1", u"1F469-1F3FF-200D-1F9AF-200D-27A1-FE0F", u"1F469-1F3FF-200D-1F9AF-200D-27A1", 1225, 1, 7},
+    {u"\U0001F469\u200D\U0001F9AF", u"", u"1F469-200D-1F9AF", u"", 1226, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F9AF", u"", u"1F469-1F3FB-200D-1F9AF", u"", 1227, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F9AF", u"", u"1F469-1F3FC-200D-1F9AF", u"", 1228, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F9AF", u"", u"1F469-1F3FD-200D-1F9AF", u"", 1229, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F9AF", u"", u"1F469-1F3FE-200D-1F9AF", u"", 1230, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F9AF", u"", u"1F469-1F3FF-200D-1F9AF", u"", 1231, 1, 15},
+    {u"\U0001F469\u200D\U0001F9B0", u"", u"1F469-200D-1F9B0", u"", 1232, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F9B0", u"", u"1F469-1F3FB-200D-1F9B0", u"", 1233, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F9B0", u"", u"1F469-1F3FC-200D-1F9B0", u"", 1234, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F9B0", u"", u"1F469-1F3FD-200D-1F9B0", u"", 1235, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F9B0", u"", u"1F469-1F3FE-200D-1F9B0", u"", 1236, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F9B0", u"", u"1F469-1F3FF-200D-1F9B0", u"", 1237, 1, 15},
+    {u"\U0001F469\u200D\U0001F9B1", u"", u"1F469-200D-1F9B1", u"", 1238, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F9B1", u"", u"1F469-1F3FB-200D-1F9B1", u"", 1239, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F9B1", u"", u"1F469-1F3FC-200D-1F9B1", u"", 1240, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F9B1", u"", u"1F469-1F3FD-200D-1F9B1", u"", 1241, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F9B1", u"", u"1F469-1F3FE-200D-1F9B1", u"", 1242, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F9B1", u"", u"1F469-1F3FF-200D-1F9B1", u"", 1243, 1, 15},
+    {u"\U0001F469\u200D\U0001F9B2", u"", u"1F469-200D-1F9B2", u"", 1244, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F9B2", u"", u"1F469-1F3FB-200D-1F9B2", u"", 1245, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F9B2", u"", u"1F469-1F3FC-200D-1F9B2", u"", 1246, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F9B2", u"", u"1F469-1F3FD-200D-1F9B2", u"", 1247, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F9B2", u"", u"1F469-1F3FE-200D-1F9B2", u"", 1248, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F9B2", u"", u"1F469-1F3FF-200D-1F9B2", u"", 1249, 1, 15},
+    {u"\U0001F469\u200D\U0001F9B3", u"", u"1F469-200D-1F9B3", u"", 1250, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F9B3", u"", u"1F469-1F3FB-200D-1F9B3", u"", 1251, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F9B3", u"", u"1F469-1F3FC-200D-1F9B3", u"", 1252, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F9B3", u"", u"1F469-1F3FD-200D-1F9B3", u"", 1253, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F9B3", u"", u"1F469-1F3FE-200D-1F9B3", u"", 1254, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F9B3", u"", u"1F469-1F3FF-200D-1F9B3", u"", 1255, 1, 15},
+    {u"\U0001F469\u200D\U0001F9BC\u200D\u27A1\uFE0F", u"\U0001F469\u200D\U0001F9BC\u200D\u27A1", u"1F469-200D-1F9BC-200D-27A1-FE0F", u"1F469-200D-1F9BC-200D-27A1", 1256, 1, 7},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F9BC\u200D\u27A1\uFE0F", u"\U0001F469\U0001F3FB\u200D\U0001F9BC\u200D\u27A1", u"1F469-1F3FB-200D-1F9BC-200D-27A1-FE0F", u"1F469-1F3FB-200D-1F9BC-200D-27A1", 1257, 1, 7},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F9BC\u200D\u27A1\uFE0F", u"\U0001F469\U0001F3FC\u200D\U0001F9BC\u200D\u27A1", u"1F469-1F3FC-200D-1F9BC-200D-27A1-FE0F", u"1F469-1F3FC-200D-1F9BC-200D-27A1", 1258, 1, 7},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F9BC\u200D\u27A1\uFE0F", u"\U0001F469\U0001F3FD\u200D\U0001F9BC\u200D\u27A1", u"1F469-1F3FD-200D-1F9BC-200D-27A1-FE0F", u"1F469-1F3FD-200D-1F9BC-200D-27A1", 1259, 1, 7},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F9BC\u200D\u27A1\uFE0F", u"\U0001F469\U0001F3FE\u200D\U0001F9BC\u200D\u27A1", u"1F469-1F3FE-200D-1F9BC-200D-27A1-FE0F", u"1F469-1F3FE-200D-1F9BC-200D-27A1", 1260, 1, 7},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F9BC\u200D\u27A1\uFE0F", u"\U0001F469\U0001F3FF\u200D\U0001F9BC\u200D\u27A1", u"1F469-1F3FF-200D-1F9BC-200D-27A1-FE0F", u"1F469-1F3FF-200D-1F9BC-200D-27A1", 1261, 1, 7},
+    {u"\U0001F469\u200D\U0001F9BC", u"", u"1F469-200D-1F9BC", u"", 1262, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F9BC", u"", u"1F469-1F3FB-200D-1F9BC", u"", 1263, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F9BC", u"", u"1F469-1F3FC-200D-1F9BC", u"", 1264, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F9BC", u"", u"1F469-1F3FD-200D-1F9BC", u"", 1265, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F9BC", u"", u"1F469-1F3FE-200D-1F9BC", u"", 1266, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F9BC", u"", u"1F469-1F3FF-200D-1F9BC", u"", 1267, 1, 15},
+    {u"\U0001F469\u200D\U0001F9BD\u200D\u27A1\uFE0F", u"\U0001F469\u200D\U0001F9BD\u200D\u27A1", u"1F469-200D-1F9BD-200D-27A1-FE0F", u"1F469-200D-1F9BD-200D-27A1", 1268, 1, 7},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F9BD\u200D\u27A1\uFE0F", u"\U0001F469\U0001F3FB\u200D\U0001F9BD\u200D\u27A1", u"1F469-1F3FB-200D-1F9BD-200D-27A1-FE0F", u"1F469-1F3FB-200D-1F9BD-200D-27A1", 1269, 1, 7},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F9BD\u200D\u27A1\uFE0F", u"\U0001F469\U0001F3FC\u200D\U0001F9BD\u200D\u27A1", u"1F469-1F3FC-200D-1F9BD-200D-27A1-FE0F", u"1F469-1F3FC-200D-1F9BD-200D-27A1", 1270, 1, 7},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F9BD\u200D\u27A1\uFE0F", u"\U0001F469\U0001F3FD\u200D\U0001F9BD\u200D\u27A1", u"1F469-1F3FD-200D-1F9BD-200D-27A1-FE0F", u"1F469-1F3FD-200D-1F9BD-200D-27A1", 1271, 1, 7},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F9BD\u200D\u27A1\uFE0F", u"\U0001F469\U0001F3FE\u200D\U0001F9BD\u200D\u27A1", u"1F469-1F3FE-200D-1F9BD-200D-27A1-FE0F", u"1F469-1F3FE-200D-1F9BD-200D-27A1", 1272, 1, 7},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F9BD\u200D\u27A1\uFE0F", u"\U0001F469\U0001F3FF\u200D\U0001F9BD\u200D\u27A1", u"1F469-1F3FF-200D-1F9BD-200D-27A1-FE0F", u"1F469-1F3FF-200D-1F9BD-200D-27A1", 1273, 1, 7},
+    {u"\U0001F469\u200D\U0001F9BD", u"", u"1F469-200D-1F9BD", u"", 1274, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F9BD", u"", u"1F469-1F3FB-200D-1F9BD", u"", 1275, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F9BD", u"", u"1F469-1F3FC-200D-1F9BD", u"", 1276, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F9BD", u"", u"1F469-1F3FD-200D-1F9BD", u"", 1277, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F9BD", u"", u"1F469-1F3FE-200D-1F9BD", u"", 1278, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F9BD", u"", u"1F469-1F3FF-200D-1F9BD", u"", 1279, 1, 15},
+    {u"\U0001F469\u200D\u2695\uFE0F", u"\U0001F469\u200D\u2695", u"1F469-200D-2695-FE0F", u"1F469-200D-2695", 1280, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2695\uFE0F", u"\U0001F469\U0001F3FB\u200D\u2695", u"1F469-1F3FB-200D-2695-FE0F", u"1F469-1F3FB-200D-2695", 1281, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2695\uFE0F", u"\U0001F469\U0001F3FC\u200D\u2695", u"1F469-1F3FC-200D-2695-FE0F", u"1F469-1F3FC-200D-2695", 1282, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2695\uFE0F", u"\U0001F469\U0001F3FD\u200D\u2695", u"1F469-1F3FD-200D-2695-FE0F", u"1F469-1F3FD-200D-2695", 1283, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2695\uFE0F", u"\U0001F469\U0001F3FE\u200D\u2695", u"1F469-1F3FE-200D-2695-FE0F", u"1F469-1F3FE-200D-2695", 1284, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2695\uFE0F", u"\U0001F469\U0001F3FF\u200D\u2695", u"1F469-1F3FF-200D-2695-FE0F", u"1F469-1F3FF-200D-2695", 1285, 1, 15},
+    {u"\U0001F469\u200D\u2696\uFE0F", u"\U0001F469\u200D\u2696", u"1F469-200D-2696-FE0F", u"1F469-200D-2696", 1286, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2696\uFE0F", u"\U0001F469\U0001F3FB\u200D\u2696", u"1F469-1F3FB-200D-2696-FE0F", u"1F469-1F3FB-200D-2696", 1287, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2696\uFE0F", u"\U0001F469\U0001F3FC\u200D\u2696", u"1F469-1F3FC-200D-2696-FE0F", u"1F469-1F3FC-200D-2696", 1288, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2696\uFE0F", u"\U0001F469\U0001F3FD\u200D\u2696", u"1F469-1F3FD-200D-2696-FE0F", u"1F469-1F3FD-200D-2696", 1289, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2696\uFE0F", u"\U0001F469\U0001F3FE\u200D\u2696", u"1F469-1F3FE-200D-2696-FE0F", u"1F469-1F3FE-200D-2696", 1290, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2696\uFE0F", u"\U0001F469\U0001F3FF\u200D\u2696", u"1F469-1F3FF-200D-2696-FE0F", u"1F469-1F3FF-200D-2696", 1291, 1, 15},
+    {u"\U0001F469\u200D\u2708\uFE0F", u"\U0001F469\u200D\u2708", u"1F469-200D-2708-FE0F", u"1F469-200D-2708", 1292, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2708\uFE0F", u"\U0001F469\U0001F3FB\u200D\u2708", u"1F469-1F3FB-200D-2708-FE0F", u"1F469-1F3FB-200D-2708", 1293, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2708\uFE0F", u"\U0001F469\U0001F3FC\u200D\u2708", u"1F469-1F3FC-200D-2708-FE0F", u"1F469-1F3FC-200D-2708", 1294, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2708\uFE0F", u"\U0001F469\U0001F3FD\u200D\u2708", u"1F469-1F3FD-200D-2708-FE0F", u"1F469-1F3FD-200D-2708", 1295, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2708\uFE0F", u"\U0001F469\U0001F3FE\u200D\u2708", u"1F469-1F3FE-200D-2708-FE0F", u"1F469-1F3FE-200D-2708", 1296, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2708\uFE0F", u"\U0001F469\U0001F3FF\u200D\u2708", u"1F469-1F3FF-200D-2708-FE0F", u"1F469-1F3FF-200D-2708", 1297, 1, 15},
+    {u"\U0001F469\u200D\u2764\uFE0F\u200D\U0001F468", u"\U0001F469\u200D\u2764\u200D\U0001F468", u"1F469-200D-2764-FE0F-200D-1F468", u"1F469-200D-2764-200D-1F468", 1298, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FB", u"\U0001F469\U0001F3FB\u200D\u2764\u200D\U0001F468\U0001F3FB", u"1F469-1F3FB-200D-2764-FE0F-200D-1F468-1F3FB", u"1F469-1F3FB-200D-2764-200D-1F468-1F3FB", 1299, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FC", u"\U0001F469\U0001F3FB\u200D\u2764\u200D\U0001F468\U0001F3FC", u"1F469-1F3FB-200D-2764-FE0F-200D-1F468-1F3FC", u"1F469-1F3FB-200D-2764-200D-1F468-1F3FC", 1300, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FD", u"\U0001F469\U0001F3FB\u200D\u2764\u200D\U0001F468\U0001F3FD", u"1F469-1F3FB-200D-2764-FE0F-200D-1F468-1F3FD", u"1F469-1F3FB-200D-2764-200D-1F468-1F3FD", 1301, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FE", u"\U0001F469\U0001F3FB\u200D\u2764\u200D\U0001F468\U0001F3FE", u"1F469-1F3FB-200D-2764-FE0F-200D-1F468-1F3FE", u"1F469-1F3FB-200D-2764-200D-1F468-1F3FE", 1302, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FF", u"\U0001F469\U0001F3FB\u200D\u2764\u200D\U0001F468\U0001F3FF", u"1F469-1F3FB-200D-2764-FE0F-200D-1F468-1F3FF", u"1F469-1F3FB-200D-2764-200D-1F468-1F3FF", 1303, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FB", u"\U0001F469\U0001F3FC\u200D\u2764\u200D\U0001F468\U0001F3FB", u"1F469-1F3FC-200D-2764-FE0F-200D-1F468-1F3FB", u"1F469-1F3FC-200D-2764-200D-1F468-1F3FB", 1304, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FC", u"\U0001F469\U0001F3FC\u200D\u2764\u200D\U0001F468\U0001F3FC", u"1F469-1F3FC-200D-2764-FE0F-200D-1F468-1F3FC", u"1F469-1F3FC-200D-2764-200D-1F468-1F3FC", 1305, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FD", u"\U0001F469\U0001F3FC\u200D\u2764\u200D\U0001F468\U0001F3FD", u"1F469-1F3FC-200D-2764-FE0F-200D-1F468-1F3FD", u"1F469-1F3FC-200D-2764-200D-1F468-1F3FD", 1306, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FE", u"\U0001F469\U0001F3FC\u200D\u2764\u200D\U0001F468\U0001F3FE", u"1F469-1F3FC-200D-2764-FE0F-200D-1F468-1F3FE", u"1F469-1F3FC-200D-2764-200D-1F468-1F3FE", 1307, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FF", u"\U0001F469\U0001F3FC\u200D\u2764\u200D\U0001F468\U0001F3FF", u"1F469-1F3FC-200D-2764-FE0F-200D-1F468-1F3FF", u"1F469-1F3FC-200D-2764-200D-1F468-1F3FF", 1308, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FB", u"\U0001F469\U0001F3FD\u200D\u2764\u200D\U0001F468\U0001F3FB", u"1F469-1F3FD-200D-2764-FE0F-200D-1F468-1F3FB", u"1F469-1F3FD-200D-2764-200D-1F468-1F3FB", 1309, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FC", u"\U0001F469\U0001F3FD\u200D\u2764\u200D\U0001F468\U0001F3FC", u"1F469-1F3FD-200D-2764-FE0F-200D-1F468-1F3FC", u"1F469-1F3FD-200D-2764-200D-1F468-1F3FC", 1310, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FD", u"\U0001F469\U0001F3FD\u200D\u2764\u200D\U0001F468\U0001F3FD", u"1F469-1F3FD-200D-2764-FE0F-200D-1F468-1F3FD", u"1F469-1F3FD-200D-2764-200D-1F468-1F3FD", 1311, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FE", u"\U0001F469\U0001F3FD\u200D\u2764\u200D\U0001F468\U0001F3FE", u"1F469-1F3FD-200D-2764-FE0F-200D-1F468-1F3FE", u"1F469-1F3FD-200D-2764-200D-1F468-1F3FE", 1312, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FF", u"\U0001F469\U0001F3FD\u200D\u2764\u200D\U0001F468\U0001F3FF", u"1F469-1F3FD-200D-2764-FE0F-200D-1F468-1F3FF", u"1F469-1F3FD-200D-2764-200D-1F468-1F3FF", 1313, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FB", u"\U0001F469\U0001F3FE\u200D\u2764\u200D\U0001F468\U0001F3FB", u"1F469-1F3FE-200D-2764-FE0F-200D-1F468-1F3FB", u"1F469-1F3FE-200D-2764-200D-1F468-1F3FB", 1314, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FC", u"\U0001F469\U0001F3FE\u200D\u2764\u200D\U0001F468\U0001F3FC", u"1F469-1F3FE-200D-2764-FE0F-200D-1F468-1F3FC", u"1F469-1F3FE-200D-2764-200D-1F468-1F3FC", 1315, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FD", u"\U0001F469\U0001F3FE\u200D\u2764\u200D\U0001F468\U0001F3FD", u"1F469-1F3FE-200D-2764-FE0F-200D-1F468-1F3FD", u"1F469-1F3FE-200D-2764-200D-1F468-1F3FD", 1316, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FE", u"\U0001F469\U0001F3FE\u200D\u2764\u200D\U0001F468\U0001F3FE", u"1F469-1F3FE-200D-2764-FE0F-200D-1F468-1F3FE", u"1F469-1F3FE-200D-2764-200D-1F468-1F3FE", 1317, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FF", u"\U0001F469\U0001F3FE\u200D\u2764\u200D\U0001F468\U0001F3FF", u"1F469-1F3FE-200D-2764-FE0F-200D-1F468-1F3FF", u"1F469-1F3FE-200D-2764-200D-1F468-1F3FF", 1318, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FB", u"\U0001F469\U0001F3FF\u200D\u2764\u200D\U0001F468\U0001F3FB", u"1F469-1F3FF-200D-2764-FE0F-200D-1F468-1F3FB", u"1F469-1F3FF-200D-2764-200D-1F468-1F3FB", 1319, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FC", u"\U0001F469\U0001F3FF\u200D\u2764\u200D\U0001F468\U0001F3FC", u"1F469-1F3FF-200D-2764-FE0F-200D-1F468-1F3FC", u"1F469-1F3FF-200D-2764-200D-1F468-1F3FC", 1320, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FD", u"\U0001F469\U0001F3FF\u200D\u2764\u200D\U0001F468\U0001F3FD", u"1F469-1F3FF-200D-2764-FE0F-200D-1F468-1F3FD", u"1F469-1F3FF-200D-2764-200D-1F468-1F3FD", 1321, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FE", u"\U0001F469\U0001F3FF\u200D\u2764\u200D\U0001F468\U0001F3FE", u"1F469-1F3FF-200D-2764-FE0F-200D-1F468-1F3FE", u"1F469-1F3FF-200D-2764-200D-1F468-1F3FE", 1322, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F468\U0001F3FF", u"\U0001F469\U0001F3FF\u200D\u2764\u200D\U0001F468\U0001F3FF", u"1F469-1F3FF-200D-2764-FE0F-200D-1F468-1F3FF", u"1F469-1F3FF-200D-2764-200D-1F468-1F3FF", 1323, 1, 15},
+    {u"\U0001F469\u200D\u2764\uFE0F\u200D\U0001F469", u"\U0001F469\u200D\u2764\u200D\U0001F469", u"1F469-200D-2764-FE0F-200D-1F469", u"1F469-200D-2764-200D-1F469", 1324, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FB", u"\U0001F469\U0001F3FB\u200D\u2764\u200D\U0001F469\U0001F3FB", u"1F469-1F3FB-200D-2764-FE0F-200D-1F469-1F3FB", u"1F469-1F3FB-200D-2764-200D-1F469-1F3FB", 1325, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FC", u"\U0001F469\U0001F3FB\u200D\u2764\u200D\U0001F469\U0001F3FC", u"1F469-1F3FB-200D-2764-FE0F-200D-1F469-1F3FC", u"1F469-1F3FB-200D-2764-200D-1F469-1F3FC", 1326, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FD", u"\U0001F469\U0001F3FB\u200D\u2764\u200D\U0001F469\U0001F3FD", u"1F469-1F3FB-200D-2764-FE0F-200D-1F469-1F3FD", u"1F469-1F3FB-200D-2764-200D-1F469-1F3FD", 1327, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FE", u"\U0001F469\U0001F3FB\u200D\u2764\u200D\U0001F469\U0001F3FE", u"1F469-1F3FB-200D-2764-FE0F-200D-1F469-1F3FE", u"1F469-1F3FB-200D-2764-200D-1F469-1F3FE", 1328, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FF", u"\U0001F469\U0001F3FB\u200D\u2764\u200D\U0001F469\U0001F3FF", u"1F469-1F3FB-200D-2764-FE0F-200D-1F469-1F3FF", u"1F469-1F3FB-200D-2764-200D-1F469-1F3FF", 1329, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FB", u"\U0001F469\U0001F3FC\u200D\u2764\u200D\U0001F469\U0001F3FB", u"1F469-1F3FC-200D-2764-FE0F-200D-1F469-1F3FB", u"1F469-1F3FC-200D-2764-200D-1F469-1F3FB", 1330, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FC", u"\U0001F469\U0001F3FC\u200D\u2764\u200D\U0001F469\U0001F3FC", u"1F469-1F3FC-200D-2764-FE0F-200D-1F469-1F3FC", u"1F469-1F3FC-200D-2764-200D-1F469-1F3FC", 1331, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FD", u"\U0001F469\U0001F3FC\u200D\u2764\u200D\U0001F469\U0001F3FD", u"1F469-1F3FC-200D-2764-FE0F-200D-1F469-1F3FD", u"1F469-1F3FC-200D-2764-200D-1F469-1F3FD", 1332, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FE", u"\U0001F469\U0001F3FC\u200D\u2764\u200D\U0001F469\U0001F3FE", u"1F469-1F3FC-200D-2764-FE0F-200D-1F469-1F3FE", u"1F469-1F3FC-200D-2764-200D-1F469-1F3FE", 1333, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FF", u"\U0001F469\U0001F3FC\u200D\u2764\u200D\U0001F469\U0001F3FF", u"1F469-1F3FC-200D-2764-FE0F-200D-1F469-1F3FF", u"1F469-1F3FC-200D-2764-200D-1F469-1F3FF", 1334, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FB", u"\U0001F469\U0001F3FD\u200D\u2764\u200D\U0001F469\U0001F3FB", u"1F469-1F3FD-200D-2764-FE0F-200D-1F469-1F3FB", u"1F469-1F3FD-200D-2764-200D-1F469-1F3FB", 1335, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FC", u"\U0001F469\U0001F3FD\u200D\u2764\u200D\U0001F469\U0001F3FC", u"1F469-1F3FD-200D-2764-FE0F-200D-1F469-1F3FC", u"1F469-1F3FD-200D-2764-200D-1F469-1F3FC", 1336, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FD", u"\U0001F469\U0001F3FD\u200D\u2764\u200D\U0001F469\U0001F3FD", u"1F469-1F3FD-200D-2764-FE0F-200D-1F469-1F3FD", u"1F469-1F3FD-200D-2764-200D-1F469-1F3FD", 1337, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FE", u"\U0001F469\U0001F3FD\u200D\u2764\u200D\U0001F469\U0001F3FE", u"1F469-1F3FD-200D-2764-FE0F-200D-1F469-1F3FE", u"1F469-1F3FD-200D-2764-200D-1F469-1F3FE", 1338, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FF", u"\U0001F469\U0001F3FD\u200D\u2764\u200D\U0001F469\U0001F3FF", u"1F469-1F3FD-200D-2764-FE0F-200D-1F469-1F3FF", u"1F469-1F3FD-200D-2764-200D-1F469-1F3FF", 1339, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FB", u"\U0001F469\U0001F3FE\u200D\u2764\u200D\U0001F469\U0001F3FB", u"1F469-1F3FE-200D-2764-FE0F-200D-1F469-1F3FB", u"1F469-1F3FE-200D-2764-200D-1F469-1F3FB", 1340, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FC", u"\U0001F469\U0001F3FE\u200D\u2764\u200D\U0001F469\U0001F3FC", u"1F469-1F3FE-200D-2764-FE0F-200D-1F469-1F3FC", u"1F469-1F3FE-200D-2764-200D-1F469-1F3FC", 1341, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FD", u"\U0001F469\U0001F3FE\u200D\u2764\u200D\U0001F469\U0001F3FD", u"1F469-1F3FE-200D-2764-FE0F-200D-1F469-1F3FD", u"1F469-1F3FE-200D-2764-200D-1F469-1F3FD", 1342, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FE", u"\U0001F469\U0001F3FE\u200D\u2764\u200D\U0001F469\U0001F3FE", u"1F469-1F3FE-200D-2764-FE0F-200D-1F469-1F3FE", u"1F469-1F3FE-200D-2764-200D-1F469-1F3FE", 1343, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FF", u"\U0001F469\U0001F3FE\u200D\u2764\u200D\U0001F469\U0001F3FF", u"1F469-1F3FE-200D-2764-FE0F-200D-1F469-1F3FF", u"1F469-1F3FE-200D-2764-200D-1F469-1F3FF", 1344, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FB", u"\U0001F469\U0001F3FF\u200D\u2764\u200D\U0001F469\U0001F3FB", u"1F469-1F3FF-200D-2764-FE0F-200D-1F469-1F3FB", u"1F469-1F3FF-200D-2764-200D-1F469-1F3FB", 1345, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FC", u"\U0001F469\U0001F3FF\u200D\u2764\u200D\U0001F469\U0001F3FC", u"1F469-1F3FF-200D-2764-FE0F-200D-1F469-1F3FC", u"1F469-1F3FF-200D-2764-200D-1F469-1F3FC", 1346, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FD", u"\U0001F469\U0001F3FF\u200D\u2764\u200D\U0001F469\U0001F3FD", u"1F469-1F3FF-200D-2764-FE0F-200D-1F469-1F3FD", u"1F469-1F3FF-200D-2764-200D-1F469-1F3FD", 1347, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FE", u"\U0001F469\U0001F3FF\u200D\u2764\u200D\U0001F469\U0001F3FE", u"1F469-1F3FF-200D-2764-FE0F-200D-1F469-1F3FE", u"1F469-1F3FF-200D-2764-200D-1F469-1F3FE", 1348, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F469\U0001F3FF", u"\U0001F469\U0001F3FF\u200D\u2764\u200D\U0001F469\U0001F3FF", u"1F469-1F3FF-200D-2764-FE0F-200D-1F469-1F3FF", u"1F469-1F3FF-200D-2764-200D-1F469-1F3FF", 1349, 1, 15},
+    {u"\U0001F469\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468", u"\U0001F469\u200D\u2764\u200D\U0001F48B\u200D\U0001F468", u"1F469-200D-2764-FE0F-200D-1F48B-200D-1F468", u"1F469-200D-2764-200D-1F48B-200D-1F468", 1350, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FB", u"\U0001F469\U0001F3FB\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FB", u"1F469-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FB", u"1F469-1F3FB-200D-2764-200D-1F48B-200D-1F468-1F3FB", 1351, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FC", u"\U0001F469\U0001F3FB\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FC", u"1F469-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FC", u"1F469-1F3FB-200D-2764-200D-1F48B-200D-1F468-1F3FC", 1352, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FD", u"\U0001F469\U0001F3FB\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FD", u"1F469-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FD", u"1F469-1F3FB-200D-2764-200D-1F48B-200D-1F468-1F3FD", 1353, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FE", u"\U0001F469\U0001F3FB\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FE", u"1F469-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FE", u"1F469-1F3FB-200D-2764-200D-1F48B-200D-1F468-1F3FE", 1354, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FF", u"\U0001F469\U0001F3FB\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FF", u"1F469-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FF", u"1F469-1F3FB-200D-2764-200D-1F48B-200D-1F468-1F3FF", 1355, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FB", u"\U0001F469\U0001F3FC\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FB", u"1F469-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FB", u"1F469-1F3FC-200D-2764-200D-1F48B-200D-1F468-1F3FB", 1356, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FC", u"\U0001F469\U0001F3FC\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FC", u"1F469-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FC", u"1F469-1F3FC-200D-2764-200D-1F48B-200D-1F468-1F3FC", 1357, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FD", u"\U0001F469\U0001F3FC\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FD", u"1F469-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FD", u"1F469-1F3FC-200D-2764-200D-1F48B-200D-1F468-1F3FD", 1358, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FE", u"\U0001F469\U0001F3FC\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FE", u"1F469-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FE", u"1F469-1F3FC-200D-2764-200D-1F48B-200D-1F468-1F3FE", 1359, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FF", u"\U0001F469\U0001F3FC\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FF", u"1F469-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FF", u"1F469-1F3FC-200D-2764-200D-1F48B-200D-1F468-1F3FF", 1360, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FB", u"\U0001F469\U0001F3FD\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FB", u"1F469-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FB", u"1F469-1F3FD-200D-2764-200D-1F48B-200D-1F468-1F3FB", 1361, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FC", u"\U0001F469\U0001F3FD\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FC", u"1F469-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FC", u"1F469-1F3FD-200D-2764-200D-1F48B-200D-1F468-1F3FC", 1362, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FD", u"\U0001F469\U0001F3FD\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FD", u"1F469-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FD", u"1F469-1F3FD-200D-2764-200D-1F48B-200D-1F468-1F3FD", 1363, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FE", u"\U0001F469\U0001F3FD\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FE", u"1F469-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FE", u"1F469-1F3FD-200D-2764-200D-1F48B-200D-1F468-1F3FE", 1364, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FF", u"\U0001F469\U0001F3FD\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FF", u"1F469-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FF", u"1F469-1F3FD-200D-2764-200D-1F48B-200D-1F468-1F3FF", 1365, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FB", u"\U0001F469\U0001F3FE\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FB", u"1F469-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FB", u"1F469-1F3FE-200D-2764-200D-1F48B-200D-1F468-1F3FB", 1366, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FC", u"\U0001F469\U0001F3FE\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FC", u"1F469-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FC", u"1F469-1F3FE-200D-2764-200D-1F48B-200D-1F468-1F3FC", 1367, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FD", u"\U0001F469\U0001F3FE\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FD", u"1F469-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FD", u"1F469-1F3FE-200D-2764-200D-1F48B-200D-1F468-1F3FD", 1368, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FE", u"\U0001F469\U0001F3FE\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FE", u"1F469-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FE", u"1F469-1F3FE-200D-2764-200D-1F48B-200D-1F468-1F3FE", 1369, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FF", u"\U0001F469\U0001F3FE\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FF", u"1F469-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FF", u"1F469-1F3FE-200D-2764-200D-1F48B-200D-1F468-1F3FF", 1370, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FB", u"\U0001F469\U0001F3FF\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FB", u"1F469-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FB", u"1F469-1F3FF-200D-2764-200D-1F48B-200D-1F468-1F3FB", 1371, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FC", u"\U0001F469\U0001F3FF\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FC", u"1F469-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FC", u"1F469-1F3FF-200D-2764-200D-1F48B-200D-1F468-1F3FC", 1372, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FD", u"\U0001F469\U0001F3FF\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FD", u"1F469-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FD", u"1F469-1F3FF-200D-2764-200D-1F48B-200D-1F468-1F3FD", 1373, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FE", u"\U0001F469\U0001F3FF\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FE", u"1F469-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FE", u"1F469-1F3FF-200D-2764-200D-1F48B-200D-1F468-1F3FE", 1374, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F468\U0001F3FF", u"\U0001F469\U0001F3FF\u200D\u2764\u200D\U0001F48B\u200D\U0001F468\U0001F3FF", u"1F469-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F468-1F3FF", u"1F469-1F3FF-200D-2764-200D-1F48B-200D-1F468-1F3FF", 1375, 1, 15},
+    {u"\U0001F469\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469", u"\U0001F469\u200D\u2764\u200D\U0001F48B\u200D\U0001F469", u"1F469-200D-2764-FE0F-200D-1F48B-200D-1F469", u"1F469-200D-2764-200D-1F48B-200D-1F469", 1376, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FB", u"\U0001F469\U0001F3FB\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FB", u"1F469-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FB", u"1F469-1F3FB-200D-2764-200D-1F48B-200D-1F469-1F3FB", 1377, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FC", u"\U0001F469\U0001F3FB\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FC", u"1F469-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FC", u"1F469-1F3FB-200D-2764-200D-1F48B-200D-1F469-1F3FC", 1378, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FD", u"\U0001F469\U0001F3FB\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FD", u"1F469-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FD", u"1F469-1F3FB-200D-2764-200D-1F48B-200D-1F469-1F3FD", 1379, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FE", u"\U0001F469\U0001F3FB\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FE", u"1F469-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FE", u"1F469-1F3FB-200D-2764-200D-1F48B-200D-1F469-1F3FE", 1380, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FF", u"\U0001F469\U0001F3FB\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FF", u"1F469-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FF", u"1F469-1F3FB-200D-2764-200D-1F48B-200D-1F469-1F3FF", 1381, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FB", u"\U0001F469\U0001F3FC\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FB", u"1F469-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FB", u"1F469-1F3FC-200D-2764-200D-1F48B-200D-1F469-1F3FB", 1382, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FC", u"\U0001F469\U0001F3FC\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FC", u"1F469-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FC", u"1F469-1F3FC-200D-2764-200D-1F48B-200D-1F469-1F3FC", 1383, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FD", u"\U0001F469\U0001F3FC\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FD", u"1F469-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FD", u"1F469-1F3FC-200D-2764-200D-1F48B-200D-1F469-1F3FD", 1384, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FE", u"\U0001F469\U0001F3FC\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FE", u"1F469-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FE", u"1F469-1F3FC-200D-2764-200D-1F48B-200D-1F469-1F3FE", 1385, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FF", u"\U0001F469\U0001F3FC\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FF", u"1F469-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FF", u"1F469-1F3FC-200D-2764-200D-1F48B-200D-1F469-1F3FF", 1386, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FB", u"\U0001F469\U0001F3FD\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FB", u"1F469-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FB", u"1F469-1F3FD-200D-2764-200D-1F48B-200D-1F469-1F3FB", 1387, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FC", u"\U0001F469\U0001F3FD\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FC", u"1F469-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FC", u"1F469-1F3FD-200D-2764-200D-1F48B-200D-1F469-1F3FC", 1388, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FD", u"\U0001F469\U0001F3FD\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FD", u"1F469-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FD", u"1F469-1F3FD-200D-2764-200D-1F48B-200D-1F469-1F3FD", 1389, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FE", u"\U0001F469\U0001F3FD\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FE", u"1F469-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FE", u"1F469-1F3FD-200D-2764-200D-1F48B-200D-1F469-1F3FE", 1390, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FF", u"\U0001F469\U0001F3FD\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FF", u"1F469-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FF", u"1F469-1F3FD-200D-2764-200D-1F48B-200D-1F469-1F3FF", 1391, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FB", u"\U0001F469\U0001F3FE\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FB", u"1F469-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FB", u"1F469-1F3FE-200D-2764-200D-1F48B-200D-1F469-1F3FB", 1392, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FC", u"\U0001F469\U0001F3FE\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FC", u"1F469-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FC", u"1F469-1F3FE-200D-2764-200D-1F48B-200D-1F469-1F3FC", 1393, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FD", u"\U0001F469\U0001F3FE\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FD", u"1F469-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FD", u"1F469-1F3FE-200D-2764-200D-1F48B-200D-1F469-1F3FD", 1394, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FE", u"\U0001F469\U0001F3FE\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FE", u"1F469-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FE", u"1F469-1F3FE-200D-2764-200D-1F48B-200D-1F469-1F3FE", 1395, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FF", u"\U0001F469\U0001F3FE\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FF", u"1F469-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FF", u"1F469-1F3FE-200D-2764-200D-1F48B-200D-1F469-1F3FF", 1396, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FB", u"\U0001F469\U0001F3FF\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FB", u"1F469-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FB", u"1F469-1F3FF-200D-2764-200D-1F48B-200D-1F469-1F3FB", 1397, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FC", u"\U0001F469\U0001F3FF\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FC", u"1F469-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FC", u"1F469-1F3FF-200D-2764-200D-1F48B-200D-1F469-1F3FC", 1398, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FD", u"\U0001F469\U0001F3FF\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FD", u"1F469-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FD", u"1F469-1F3FF-200D-2764-200D-1F48B-200D-1F469-1F3FD", 1399, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FE", u"\U0001F469\U0001F3FF\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FE", u"1F469-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FE", u"1F469-1F3FF-200D-2764-200D-1F48B-200D-1F469-1F3FE", 1400, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F469\U0001F3FF", u"\U0001F469\U0001F3FF\u200D\u2764\u200D\U0001F48B\u200D\U0001F469\U0001F3FF", u"1F469-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F469-1F3FF", u"1F469-1F3FF-200D-2764-200D-1F48B-200D-1F469-1F3FF", 1401, 1, 15},
+    {u"\U0001F469", u"", u"1F469", u"", 1402, 1, 15},
+    {u"\U0001F469\U0001F3FB", u"", u"1F469-1F3FB", u"", 1403, 1, 15},
+    {u"\U0001F469\U0001F3FC", u"", u"1F469-1F3FC", u"", 1404, 1, 15},
+    {u"\U0001F469\U0001F3FD", u"", u"1F469-1F3FD", u"", 1405, 1, 15},
+    {u"\U0001F469\U0001F3FE", u"", u"1F469-1F3FE", u"", 1406, 1, 15},
+    {u"\U0001F469\U0001F3FF", u"", u"1F469-1F3FF", u"", 1407, 1, 15},
+    {u"\U0001F46A", u"", u"1F46A", u"", 1408, 1, 15},
+    {u"\U0001F46B", u"", u"1F46B", u"", 1409, 3, 15},
+    {u"\U0001F46B\U0001F3FB", u"", u"1F46B-1F3FB", u"", 1412, 1, 15},
+    {u"\U0001F46B\U0001F3FC", u"", u"1F46B-1F3FC", u"", 1413, 1, 15},
+    {u"\U0001F46B\U0001F3FD", u"", u"1F46B-1F3FD", u"", 1414, 1, 15},
+    {u"\U0001F46B\U0001F3FE", u"", u"1F46B-1F3FE", u"", 1415, 1, 15},
+    {u"\U0001F46B\U0001F3FF", u"", u"1F46B-1F3FF", u"", 1416, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F91D\u200D\U0001F468\U0001F3FC", u"", u"1F469-1F3FB-200D-1F91D-200D-1F468-1F3FC", u"", 1417, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F91D\u200D\U0001F468\U0001F3FD", u"", u"1F469-1F3FB-200D-1F91D-200D-1F468-1F3FD", u"", 1418, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F91D\u200D\U0001F468\U0001F3FE", u"", u"1F469-1F3FB-200D-1F91D-200D-1F468-1F3FE", u"", 1419, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F91D\u200D\U0001F468\U0001F3FF", u"", u"1F469-1F3FB-200D-1F91D-200D-1F468-1F3FF", u"", 1420, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F91D\u200D\U0001F468\U0001F3FB", u"", u"1F469-1F3FC-200D-1F91D-200D-1F468-1F3FB", u"", 1421, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F91D\u200D\U0001F468\U0001F3FD", u"", u"1F469-1F3FC-200D-1F91D-200D-1F468-1F3FD", u"", 1422, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F91D\u200D\U0001F468\U0001F3FE", u"", u"1F469-1F3FC-200D-1F91D-200D-1F468-1F3FE", u"", 1423, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F91D\u200D\U0001F468\U0001F3FF", u"", u"1F469-1F3FC-200D-1F91D-200D-1F468-1F3FF", u"", 1424, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F91D\u200D\U0001F468\U0001F3FB", u"", u"1F469-1F3FD-200D-1F91D-200D-1F468-1F3FB", u"", 1425, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F91D\u200D\U0001F468\U0001F3FC", u"", u"1F469-1F3FD-200D-1F91D-200D-1F468-1F3FC", u"", 1426, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F91D\u200D\U0001F468\U0001F3FE", u"", u"1F469-1F3FD-200D-1F91D-200D-1F468-1F3FE", u"", 1427, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F91D\u200D\U0001F468\U0001F3FF", u"", u"1F469-1F3FD-200D-1F91D-200D-1F468-1F3FF", u"", 1428, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F91D\u200D\U0001F468\U0001F3FB", u"", u"1F469-1F3FE-200D-1F91D-200D-1F468-1F3FB", u"", 1429, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F91D\u200D\U0001F468\U0001F3FC", u"", u"1F469-1F3FE-200D-1F91D-200D-1F468-1F3FC", u"", 1430, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F91D\u200D\U0001F468\U0001F3FD", u"", u"1F469-1F3FE-200D-1F91D-200D-1F468-1F3FD", u"", 1431, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F91D\u200D\U0001F468\U0001F3FF", u"", u"1F469-1F3FE-200D-1F91D-200D-1F468-1F3FF", u"", 1432, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F91D\u200D\U0001F468\U0001F3FB", u"", u"1F469-1F3FF-200D-1F91D-200D-1F468-1F3FB", u"", 1433, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F91D\u200D\U0001F468\U0001F3FC", u"", u"1F469-1F3FF-200D-1F91D-200D-1F468-1F3FC", u"", 1434, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F91D\u200D\U0001F468\U0001F3FD", u"", u"1F469-1F3FF-200D-1F91D-200D-1F468-1F3FD", u"", 1435, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F91D\u200D\U0001F468\U0001F3FE", u"", u"1F469-1F3FF-200D-1F91D-200D-1F468-1F3FE", u"", 1436, 1, 15},
+    {u"\U0001F46C", u"", u"1F46C", u"", 1437, 2, 15},
+    {u"\U0001F46C\U0001F3FB", u"", u"1F46C-1F3FB", u"", 1439, 1, 15},
+    {u"\U0001F46C\U0001F3FC", u"", u"1F46C-1F3FC", u"", 1440, 1, 15},
+    {u"\U0001F46C\U0001F3FD", u"", u"1F46C-1F3FD", u"", 1441, 1, 15},
+    {u"\U0001F46C\U0001F3FE", u"", u"1F46C-1F3FE", u"", 1442, 1, 15},
+    {u"\U0001F46C\U0001F3FF", u"", u"1F46C-1F3FF", u"", 1443, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F91D\u200D\U0001F468\U0001F3FC", u"", u"1F468-1F3FB-200D-1F91D-200D-1F468-1F3FC", u"", 1444, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F91D\u200D\U0001F468\U0001F3FD", u"", u"1F468-1F3FB-200D-1F91D-200D-1F468-1F3FD", u"", 1445, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F91D\u200D\U0001F468\U0001F3FE", u"", u"1F468-1F3FB-200D-1F91D-200D-1F468-1F3FE", u"", 1446, 1, 15},
+    {u"\U0001F468\U0001F3FB\u200D\U0001F91D\u200D\U0001F468\U0001F3FF", u"", u"1F468-1F3FB-200D-1F91D-200D-1F468-1F3FF", u"", 1447, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F91D\u200D\U0001F468\U0001F3FB", u"", u"1F468-1F3FC-200D-1F91D-200D-1F468-1F3FB", u"", 1448, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F91D\u200D\U0001F468\U0001F3FD", u"", u"1F468-1F3FC-200D-1F91D-200D-1F468-1F3FD", u"", 1449, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F91D\u200D\U0001F468\U0001F3FE", u"", u"1F468-1F3FC-200D-1F91D-200D-1F468-1F3FE", u"", 1450, 1, 15},
+    {u"\U0001F468\U0001F3FC\u200D\U0001F91D\u200D\U0001F468\U0001F3FF", u"", u"1F468-1F3FC-200D-1F91D-200D-1F468-1F3FF", u"", 1451, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F91D\u200D\U0001F468\U0001F3FB", u"", u"1F468-1F3FD-200D-1F91D-200D-1F468-1F3FB", u"", 1452, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F91D\u200D\U0001F468\U0001F3FC", u"", u"1F468-1F3FD-200D-1F91D-200D-1F468-1F3FC", u"", 1453, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F91D\u200D\U0001F468\U0001F3FE", u"", u"1F468-1F3FD-200D-1F91D-200D-1F468-1F3FE", u"", 1454, 1, 15},
+    {u"\U0001F468\U0001F3FD\u200D\U0001F91D\u200D\U0001F468\U0001F3FF", u"", u"1F468-1F3FD-200D-1F91D-200D-1F468-1F3FF", u"", 1455, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F91D\u200D\U0001F468\U0001F3FB", u"", u"1F468-1F3FE-200D-1F91D-200D-1F468-1F3FB", u"", 1456, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F91D\u200D\U0001F468\U0001F3FC", u"", u"1F468-1F3FE-200D-1F91D-200D-1F468-1F3FC", u"", 1457, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F91D\u200D\U0001F468\U0001F3FD", u"", u"1F468-1F3FE-200D-1F91D-200D-1F468-1F3FD", u"", 1458, 1, 15},
+    {u"\U0001F468\U0001F3FE\u200D\U0001F91D\u200D\U0001F468\U0001F3FF", u"", u"1F468-1F3FE-200D-1F91D-200D-1F468-1F3FF", u"", 1459, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F91D\u200D\U0001F468\U0001F3FB", u"", u"1F468-1F3FF-200D-1F91D-200D-1F468-1F3FB", u"", 1460, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F91D\u200D\U0001F468\U0001F3FC", u"", u"1F468-1F3FF-200D-1F91D-200D-1F468-1F3FC", u"", 1461, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F91D\u200D\U0001F468\U0001F3FD", u"", u"1F468-1F3FF-200D-1F91D-200D-1F468-1F3FD", u"", 1462, 1, 15},
+    {u"\U0001F468\U0001F3FF\u200D\U0001F91D\u200D\U0001F468\U0001F3FE", u"", u"1F468-1F3FF-200D-1F91D-200D-1F468-1F3FE", u"", 1463, 1, 15},
+    {u"\U0001F46D", u"", u"1F46D", u"", 1464, 2, 15},
+    {u"\U0001F46D\U0001F3FB", u"", u"1F46D-1F3FB", u"", 1466, 1, 15},
+    {u"\U0001F46D\U0001F3FC", u"", u"1F46D-1F3FC", u"", 1467, 1, 15},
+    {u"\U0001F46D\U0001F3FD", u"", u"1F46D-1F3FD", u"", 1468, 1, 15},
+    {u"\U0001F46D\U0001F3FE", u"", u"1F46D-1F3FE", u"", 1469, 1, 15},
+    {u"\U0001F46D\U0001F3FF", u"", u"1F46D-1F3FF", u"", 1470, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F91D\u200D\U0001F469\U0001F3FC", u"", u"1F469-1F3FB-200D-1F91D-200D-1F469-1F3FC", u"", 1471, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F91D\u200D\U0001F469\U0001F3FD", u"", u"1F469-1F3FB-200D-1F91D-200D-1F469-1F3FD", u"", 1472, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F91D\u200D\U0001F469\U0001F3FE", u"", u"1F469-1F3FB-200D-1F91D-200D-1F469-1F3FE", u"", 1473, 1, 15},
+    {u"\U0001F469\U0001F3FB\u200D\U0001F91D\u200D\U0001F469\U0001F3FF", u"", u"1F469-1F3FB-200D-1F91D-200D-1F469-1F3FF", u"", 1474, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F91D\u200D\U0001F469\U0001F3FB", u"", u"1F469-1F3FC-200D-1F91D-200D-1F469-1F3FB", u"", 1475, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F91D\u200D\U0001F469\U0001F3FD", u"", u"1F469-1F3FC-200D-1F91D-200D-1F469-1F3FD", u"", 1476, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F91D\u200D\U0001F469\U0001F3FE", u"", u"1F469-1F3FC-200D-1F91D-200D-1F469-1F3FE", u"", 1477, 1, 15},
+    {u"\U0001F469\U0001F3FC\u200D\U0001F91D\u200D\U0001F469\U0001F3FF", u"", u"1F469-1F3FC-200D-1F91D-200D-1F469-1F3FF", u"", 1478, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F91D\u200D\U0001F469\U0001F3FB", u"", u"1F469-1F3FD-200D-1F91D-200D-1F469-1F3FB", u"", 1479, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F91D\u200D\U0001F469\U0001F3FC", u"", u"1F469-1F3FD-200D-1F91D-200D-1F469-1F3FC", u"", 1480, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F91D\u200D\U0001F469\U0001F3FE", u"", u"1F469-1F3FD-200D-1F91D-200D-1F469-1F3FE", u"", 1481, 1, 15},
+    {u"\U0001F469\U0001F3FD\u200D\U0001F91D\u200D\U0001F469\U0001F3FF", u"", u"1F469-1F3FD-200D-1F91D-200D-1F469-1F3FF", u"", 1482, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F91D\u200D\U0001F469\U0001F3FB", u"", u"1F469-1F3FE-200D-1F91D-200D-1F469-1F3FB", u"", 1483, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F91D\u200D\U0001F469\U0001F3FC", u"", u"1F469-1F3FE-200D-1F91D-200D-1F469-1F3FC", u"", 1484, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F91D\u200D\U0001F469\U0001F3FD", u"", u"1F469-1F3FE-200D-1F91D-200D-1F469-1F3FD", u"", 1485, 1, 15},
+    {u"\U0001F469\U0001F3FE\u200D\U0001F91D\u200D\U0001F469\U0001F3FF", u"", u"1F469-1F3FE-200D-1F91D-200D-1F469-1F3FF", u"", 1486, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F91D\u200D\U0001F469\U0001F3FB", u"", u"1F469-1F3FF-200D-1F91D-200D-1F469-1F3FB", u"", 1487, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F91D\u200D\U0001F469\U0001F3FC", u"", u"1F469-1F3FF-200D-1F91D-200D-1F469-1F3FC", u"", 1488, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F91D\u200D\U0001F469\U0001F3FD", u"", u"1F469-1F3FF-200D-1F91D-200D-1F469-1F3FD", u"", 1489, 1, 15},
+    {u"\U0001F469\U0001F3FF\u200D\U0001F91D\u200D\U0001F469\U0001F3FE", u"", u"1F469-1F3FF-200D-1F91D-200D-1F469-1F3FE", u"", 1490, 1, 15},
+    {u"\U0001F46E\u200D\u2640\uFE0F", u"\U0001F46E\u200D\u2640", u"1F46E-200D-2640-FE0F", u"1F46E-200D-2640", 1491, 1, 15},
+    {u"\U0001F46E\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F46E\U0001F3FB\u200D\u2640", u"1F46E-1F3FB-200D-2640-FE0F", u"1F46E-1F3FB-200D-2640", 1492, 1, 15},
+    {u"\U0001F46E\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F46E\U0001F3FC\u200D\u2640", u"1F46E-1F3FC-200D-2640-FE0F", u"1F46E-1F3FC-200D-2640", 1493, 1, 15},
+    {u"\U0001F46E\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F46E\U0001F3FD\u200D\u2640", u"1F46E-1F3FD-200D-2640-FE0F", u"1F46E-1F3FD-200D-2640", 1494, 1, 15},
+    {u"\U0001F46E\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F46E\U0001F3FE\u200D\u2640", u"1F46E-1F3FE-200D-2640-FE0F", u"1F46E-1F3FE-200D-2640", 1495, 1, 15},
+    {u"\U0001F46E\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F46E\U0001F3FF\u200D\u2640", u"1F46E-1F3FF-200D-2640-FE0F", u"1F46E-1F3FF-200D-2640", 1496, 1, 15},
+    {u"\U0001F46E\u200D\u2642\uFE0F", u"\U0001F46E\u200D\u2642", u"1F46E-200D-2642-FE0F", u"1F46E-200D-2642", 1497, 1, 15},
+    {u"\U0001F46E\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F46E\U0001F3FB\u200D\u2642", u"1F46E-1F3FB-200D-2642-FE0F", u"1F46E-1F3FB-200D-2642", 1498, 1, 15},
+    {u"\U0001F46E\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F46E\U0001F3FC\u200D\u2642", u"1F46E-1F3FC-200D-2642-FE0F", u"1F46E-1F3FC-200D-2642", 1499, 1, 15},
+    {u"\U0001F46E\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F46E\U0001F3FD\u200D\u2642", u"1F46E-1F3FD-200D-2642-FE0F", u"1F46E-1F3FD-200D-2642", 1500, 1, 15},
+    {u"\U0001F46E\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F46E\U0001F3FE\u200D\u2642", u"1F46E-1F3FE-200D-2642-FE0F", u"1F46E-1F3FE-200D-2642", 1501, 1, 15},
+    {u"\U0001F46E\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F46E\U0001F3FF\u200D\u2642", u"1F46E-1F3FF-200D-2642-FE0F", u"1F46E-1F3FF-200D-2642", 1502, 1, 15},
+    {u"\U0001F46E", u"", u"1F46E", u"", 1503, 1, 15},
+    {u"\U0001F46E\U0001F3FB", u"", u"1F46E-1F3FB", u"", 1504, 1, 15},
+    {u"\U0001F46E\U0001F3FC", u"", u"1F46E-1F3FC", u"", 1505, 1, 15},
+    {u"\U0001F46E\U0001F3FD", u"", u"1F46E-1F3FD", u"", 1506, 1, 15},
+    {u"\U0001F46E\U0001F3FE", u"", u"1F46E-1F3FE", u"", 1507, 1, 15},
+    {u"\U0001F46E\U0001F3FF", u"", u"1F46E-1F3FF", u"", 1508, 1, 15},
+    {u"\U0001F46F\u200D\u2640\uFE0F", u"\U0001F46F\u200D\u2640", u"1F46F-200D-2640-FE0F", u"1F46F-200D-2640", 1509, 2, 15},
+    {u"\U0001F46F\u200D\u2642\uFE0F", u"\U0001F46F\u200D\u2642", u"1F46F-200D-2642-FE0F", u"1F46F-200D-2642", 1511, 2, 15},
+    {u"\U0001F46F", u"", u"1F46F", u"", 1513, 1, 15},
+    {u"\U0001F470\u200D\u2640\uFE0F", u"\U0001F470\u200D\u2640", u"1F470-200D-2640-FE0F", u"1F470-200D-2640", 1514, 1, 15},
+    {u"\U0001F470\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F470\U0001F3FB\u200D\u2640", u"1F470-1F3FB-200D-2640-FE0F", u"1F470-1F3FB-200D-2640", 1515, 1, 15},
+    {u"\U0001F470\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F470\U0001F3FC\u200D\u2640", u"1F470-1F3FC-200D-2640-FE0F", u"1F470-1F3FC-200D-2640", 1516, 1, 15},
+    {u"\U0001F470\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F470\U0001F3FD\u200D\u2640", u"1F470-1F3FD-200D-2640-FE0F", u"1F470-1F3FD-200D-2640", 1517, 1, 15},
+    {u"\U0001F470\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F470\U0001F3FE\u200D\u2640", u"1F470-1F3FE-200D-2640-FE0F", u"1F470-1F3FE-200D-2640", 1518, 1, 15},
+    {u"\U0001F470\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F470\U0001F3FF\u200D\u2640", u"1F470-1F3FF-200D-2640-FE0F", u"1F470-1F3FF-200D-2640", 1519, 1, 15},
+    {u"\U0001F470\u200D\u2642\uFE0F", u"\U0001F470\u200D\u2642", u"1F470-200D-2642-FE0F", u"1F470-200D-2642", 1520, 1, 15},
+    {u"\U0001F470\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F470\U0001F3FB\u200D\u2642", u"1F470-1F3FB-200D-2642-FE0F", u"1F470-1F3FB-200D-2642", 1521, 1, 15},
+    {u"\U0001F470\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F470\U0001F3FC\u200D\u2642", u"1F470-1F3FC-200D-2642-FE0F", u"1F470-1F3FC-200D-2642", 1522, 1, 15},
+    {u"\U0001F470\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F470\U0001F3FD\u200D\u2642", u"1F470-1F3FD-200D-2642-FE0F", u"1F470-1F3FD-200D-2642", 1523, 1, 15},
+    {u"\U0001F470\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F470\U0001F3FE\u200D\u2642", u"1F470-1F3FE-200D-2642-FE0F", u"1F470-1F3FE-200D-2642", 1524, 1, 15},
+    {u"\U0001F470\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F470\U0001F3FF\u200D\u2642", u"1F470-1F3FF-200D-2642-FE0F", u"1F470-1F3FF-200D-2642", 1525, 1, 15},
+    {u"\U0001F470", u"", u"1F470", u"", 1526, 1, 15},
+    {u"\U0001F470\U0001F3FB", u"", u"1F470-1F3FB", u"", 1527, 1, 15},
+    {u"\U0001F470\U0001F3FC", u"", u"1F470-1F3FC", u"", 1528, 1, 15},
+    {u"\U0001F470\U0001F3FD", u"", u"1F470-1F3FD", u"", 1529, 1, 15},
+    {u"\U0001F470\U0001F3FE", u"", u"1F470-1F3FE", u"", 1530, 1, 15},
+    {u"\U0001F470\U0001F3FF", u"", u"1F470-1F3FF", u"", 1531, 1, 15},
+    {u"\U0001F471\u200D\u2640\uFE0F", u"\U0001F471\u200D\u2640", u"1F471-200D-2640-FE0F", u"1F471-200D-2640", 1532, 1, 15},
+    {u"\U0001F471\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F471\U0001F3FB\u200D\u2640", u"1F471-1F3FB-200D-2640-FE0F", u"1F471-1F3FB-200D-2640", 1533, 1, 15},
+    {u"\U0001F471\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F471\U0001F3FC\u200D\u2640", u"1F471-1F3FC-200D-2640-FE0F", u"1F471-1F3FC-200D-2640", 1534, 1, 15},
+    {u"\U0001F471\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F471\U0001F3FD\u200D\u2640", u"1F471-1F3FD-200D-2640-FE0F", u"1F471-1F3FD-200D-2640", 1535, 1, 15},
+    {u"\U0001F471\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F471\U0001F3FE\u200D\u2640", u"1F471-1F3FE-200D-2640-FE0F", u"1F471-1F3FE-200D-2640", 1536, 1, 15},
+    {u"\U0001F471\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F471\U0001F3FF\u200D\u2640", u"1F471-1F3FF-200D-2640-FE0F", u"1F471-1F3FF-200D-2640", 1537, 1, 15},
+    {u"\U0001F471\u200D\u2642\uFE0F", u"\U0001F471\u200D\u2642", u"1F471-200D-2642-FE0F", u"1F471-200D-2642", 1538, 1, 15},
+    {u"\U0001F471\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F471\U0001F3FB\u200D\u2642", u"1F471-1F3FB-200D-2642-FE0F", u"1F471-1F3FB-200D-2642", 1539, 1, 15},
+    {u"\U0001F471\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F471\U0001F3FC\u200D\u2642", u"1F471-1F3FC-200D-2642-FE0F", u"1F471-1F3FC-200D-2642", 1540, 1, 15},
+    {u"\U0001F471\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F471\U0001F3FD\u200D\u2642", u"1F471-1F3FD-200D-2642-FE0F", u"1F471-1F3FD-200D-2642", 1541, 1, 15},
+    {u"\U0001F471\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F471\U0001F3FE\u200D\u2642", u"1F471-1F3FE-200D-2642-FE0F", u"1F471-1F3FE-200D-2642", 1542, 1, 15},
+    {u"\U0001F471\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F471\U0001F3FF\u200D\u2642", u"1F471-1F3FF-200D-2642-FE0F", u"1F471-1F3FF-200D-2642", 1543, 1, 15},
+    {u"\U0001F471", u"", u"1F471", u"", 1544, 1, 15},
+    {u"\U0001F471\U0001F3FB", u"", u"1F471-1F3FB", u"", 1545, 1, 15},
+    {u"\U0001F471\U0001F3FC", u"", u"1F471-1F3FC", u"", 1546, 1, 15},
+    {u"\U0001F471\U0001F3FD", u"", u"1F471-1F3FD", u"", 1547, 1, 15},
+    {u"\U0001F471\U0001F3FE", u"", u"1F471-1F3FE", u"", 1548, 1, 15},
+    {u"\U0001F471\U0001F3FF", u"", u"1F471-1F3FF", u"", 1549, 1, 15},
+    {u"\U0001F472", u"", u"1F472", u"", 1550, 1, 15},
+    {u"\U0001F472\U0001F3FB", u"", u"1F472-1F3FB", u"", 1551, 1, 15},
+    {u"\U0001F472\U0001F3FC", u"", u"1F472-1F3FC", u"", 1552, 1, 15},
+    {u"\U0001F472\U0001F3FD", u"", u"1F472-1F3FD", u"", 1553, 1, 15},
+    {u"\U0001F472\U0001F3FE", u"", u"1F472-1F3FE", u"", 1554, 1, 15},
+    {u"\U0001F472\U0001F3FF", u"", u"1F472-1F3FF", u"", 1555, 1, 15},
+    {u"\U0001F473\u200D\u2640\uFE0F", u"\U0001F473\u200D\u2640", u"1F473-200D-2640-FE0F", u"1F473-200D-2640", 1556, 1, 15},
+    {u"\U0001F473\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F473\U0001F3FB\u200D\u2640", u"1F473-1F3FB-200D-2640-FE0F", u"1F473-1F3FB-200D-2640", 1557, 1, 15},
+    {u"\U0001F473\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F473\U0001F3FC\u200D\u2640", u"1F473-1F3FC-200D-2640-FE0F", u"1F473-1F3FC-200D-2640", 1558, 1, 15},
+    {u"\U0001F473\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F473\U0001F3FD\u200D\u2640", u"1F473-1F3FD-200D-2640-FE0F", u"1F473-1F3FD-200D-2640", 1559, 1, 15},
+    {u"\U0001F473\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F473\U0001F3FE\u200D\u2640", u"1F473-1F3FE-200D-2640-FE0F", u"1F473-1F3FE-200D-2640", 1560, 1, 15},
+    {u"\U0001F473\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F473\U0001F3FF\u200D\u2640", u"1F473-1F3FF-200D-2640-FE0F", u"1F473-1F3FF-200D-2640", 1561, 1, 15},
+    {u"\U0001F473\u200D\u2642\uFE0F", u"\U0001F473\u200D\u2642", u"1F473-200D-2642-FE0F", u"1F473-200D-2642", 1562, 1, 15},
+    {u"\U0001F473\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F473\U0001F3FB\u200D\u2642", u"1F473-1F3FB-200D-2642-FE0F", u"1F473-1F3FB-200D-2642", 1563, 1, 15},
+    {u"\U0001F473\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F473\U0001F3FC\u200D\u2642", u"1F473-1F3FC-200D-2642-FE0F", u"1F473-1F3FC-200D-2642", 1564, 1, 15},
+    {u"\U0001F473\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F473\U0001F3FD\u200D\u2642", u"1F473-1F3FD-200D-2642-FE0F", u"1F473-1F3FD-200D-2642", 1565, 1, 15},
+    {u"\U0001F473\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F473\U0001F3FE\u200D\u2642", u"1F473-1F3FE-200D-2642-FE0F", u"1F473-1F3FE-200D-2642", 1566, 1, 15},
+    {u"\U0001F473\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F473\U0001F3FF\u200D\u2642", u"1F473-1F3FF-200D-2642-FE0F", u"1F473-1F3FF-200D-2642", 1567, 1, 15},
+    {u"\U0001F473", u"", u"1F473", u"", 1568, 1, 15},
+    {u"\U0001F473\U0001F3FB", u"", u"1F473-1F3FB", u"", 1569, 1, 15},
+    {u"\U0001F473\U0001F3FC", u"", u"1F473-1F3FC", u"", 1570, 1, 15},
+    {u"\U0001F473\U0001F3FD", u"", u"1F473-1F3FD", u"", 1571, 1, 15},
+    {u"\U0001F473\U0001F3FE", u"", u"1F473-1F3FE", u"", 1572, 1, 15},
+    {u"\U0001F473\U0001F3FF", u"", u"1F473-1F3FF", u"", 1573, 1, 15},
+    {u"\U0001F474", u"", u"1F474", u"", 1574, 1, 15},
+    {u"\U0001F474\U0001F3FB", u"", u"1F474-1F3FB", u"", 1575, 1, 15},
+    {u"\U0001F474\U0001F3FC", u"", u"1F474-1F3FC", u"", 1576, 1, 15},
+    {u"\U0001F474\U0001F3FD", u"", u"1F474-1F3FD", u"", 1577, 1, 15},
+    {u"\U0001F474\U0001F3FE", u"", u"1F474-1F3FE", u"", 1578, 1, 15},
+    {u"\U0001F474\U0001F3FF", u"", u"1F474-1F3FF", u"", 1579, 1, 15},
+    {u"\U0001F475", u"", u"1F475", u"", 1580, 1, 15},
+    {u"\U0001F475\U0001F3FB", u"", u"1F475-1F3FB", u"", 1581, 1, 15},
+    {u"\U0001F475\U0001F3FC", u"", u"1F475-1F3FC", u"", 1582, 1, 15},
+    {u"\U0001F475\U0001F3FD", u"", u"1F475-1F3FD", u"", 1583, 1, 15},
+    {u"\U0001F475\U0001F3FE", u"", u"1F475-1F3FE", u"", 1584, 1, 15},
+    {u"\U0001F475\U0001F3FF", u"", u"1F475-1F3FF", u"", 1585, 1, 15},
+    {u"\U0001F476", u"", u"1F476", u"", 1586, 1, 15},
+    {u"\U0001F476\U0001F3FB", u"", u"1F476-1F3FB", u"", 1587, 1, 15},
+    {u"\U0001F476\U0001F3FC", u"", u"1F476-1F3FC", u"", 1588, 1, 15},
+    {u"\U0001F476\U0001F3FD", u"", u"1F476-1F3FD", u"", 1589, 1, 15},
+    {u"\U0001F476\U0001F3FE", u"", u"1F476-1F3FE", u"", 1590, 1, 15},
+    {u"\U0001F476\U0001F3FF", u"", u"1F476-1F3FF", u"", 1591, 1, 15},
+    {u"\U0001F477\u200D\u2640\uFE0F", u"\U0001F477\u200D\u2640", u"1F477-200D-2640-FE0F", u"1F477-200D-2640", 1592, 1, 15},
+    {u"\U0001F477\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F477\U0001F3FB\u200D\u2640", u"1F477-1F3FB-200D-2640-FE0F", u"1F477-1F3FB-200D-2640", 1593, 1, 15},
+    {u"\U0001F477\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F477\U0001F3FC\u200D\u2640", u"1F477-1F3FC-200D-2640-FE0F", u"1F477-1F3FC-200D-2640", 1594, 1, 15},
+    {u"\U0001F477\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F477\U0001F3FD\u200D\u2640", u"1F477-1F3FD-200D-2640-FE0F", u"1F477-1F3FD-200D-2640", 1595, 1, 15},
+    {u"\U0001F477\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F477\U0001F3FE\u200D\u2640", u"1F477-1F3FE-200D-2640-FE0F", u"1F477-1F3FE-200D-2640", 1596, 1, 15},
+    {u"\U0001F477\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F477\U0001F3FF\u200D\u2640", u"1F477-1F3FF-200D-2640-FE0F", u"1F477-1F3FF-200D-2640", 1597, 1, 15},
+    {u"\U0001F477\u200D\u2642\uFE0F", u"\U0001F477\u200D\u2642", u"1F477-200D-2642-FE0F", u"1F477-200D-2642", 1598, 1, 15},
+    {u"\U0001F477\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F477\U0001F3FB\u200D\u2642", u"1F477-1F3FB-200D-2642-FE0F", u"1F477-1F3FB-200D-2642", 1599, 1, 15},
+    {u"\U0001F477\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F477\U0001F3FC\u200D\u2642", u"1F477-1F3FC-200D-2642-FE0F", u"1F477-1F3FC-200D-2642", 1600, 1, 15},
+    {u"\U0001F477\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F477\U0001F3FD\u200D\u2642", u"1F477-1F3FD-200D-2642-FE0F", u"1F477-1F3FD-200D-2642", 1601, 1, 15},
+    {u"\U0001F477\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F477\U0001F3FE\u200D\u2642", u"1F477-1F3FE-200D-2642-FE0F", u"1F477-1F3FE-200D-2642", 1602, 1, 15},
+    {u"\U0001F477\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F477\U0001F3FF\u200D\u2642", u"1F477-1F3FF-200D-2642-FE0F", u"1F477-1F3FF-200D-2642", 1603, 1, 15},
+    {u"\U0001F477", u"", u"1F477", u"", 1604, 1, 15},
+    {u"\U0001F477\U0001F3FB", u"", u"1F477-1F3FB", u"", 1605, 1, 15},
+    {u"\U0001F477\U0001F3FC", u"", u"1F477-1F3FC", u"", 1606, 1, 15},
+    {u"\U0001F477\U0001F3FD", u"", u"1F477-1F3FD", u"", 1607, 1, 15},
+    {u"\U0001F477\U0001F3FE", u"", u"1F477-1F3FE", u"", 1608, 1, 15},
+    {u"\U0001F477\U0001F3FF", u"", u"1F477-1F3FF", u"", 1609, 1, 15},
+    {u"\U0001F478", u"", u"1F478", u"", 1610, 1, 15},
+    {u"\U0001F478\U0001F3FB", u"", u"1F478-1F3FB", u"", 1611, 1, 15},
+    {u"\U0001F478\U0001F3FC", u"", u"1F478-1F3FC", u"", 1612, 1, 15},
+    {u"\U0001F478\U0001F3FD", u"", u"1F478-1F3FD", u"", 1613, 1, 15},
+    {u"\U0001F478\U0001F3FE", u"", u"1F478-1F3FE", u"", 1614, 1, 15},
+    {u"\U0001F478\U0001F3FF", u"", u"1F478-1F3FF", u"", 1615, 1, 15},
+    {u"\U0001F479", u"", u"1F479", u"", 1616, 1, 15},
+    {u"\U0001F47A", u"", u"1F47A", u"", 1617, 1, 15},
+    {u"\U0001F47B", u"", u"1F47B", u"", 1618, 1, 15},
+    {u"\U0001F47C", u"", u"1F47C", u"", 1619, 1, 15},
+    {u"\U0001F47C\U0001F3FB", u"", u"1F47C-1F3FB", u"", 1620, 1, 15},
+    {u"\U0001F47C\U0001F3FC", u"", u"1F47C-1F3FC", u"", 1621, 1, 15},
+    {u"\U0001F47C\U0001F3FD", u"", u"1F47C-1F3FD", u"", 1622, 1, 15},
+    {u"\U0001F47C\U0001F3FE", u"", u"1F47C-1F3FE", u"", 1623, 1, 15},
+    {u"\U0001F47C\U0001F3FF", u"", u"1F47C-1F3FF", u"", 1624, 1, 15},
+    {u"\U0001F47D", u"", u"1F47D", u"", 1625, 1, 15},
+    {u"\U0001F47E", u"", u"1F47E", u"", 1626, 1, 15},
+    {u"\U0001F47F", u"", u"1F47F", u"", 1627, 1, 15},
+    {u"\U0001F480", u"", u"1F480", u"", 1628, 1, 15},
+    {u"\U0001F481\u200D\u2640\uFE0F", u"\U0001F481\u200D\u2640", u"1F481-200D-2640-FE0F", u"1F481-200D-2640", 1629, 1, 15},
+    {u"\U0001F481\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F481\U0001F3FB\u200D\u2640", u"1F481-1F3FB-200D-2640-FE0F", u"1F481-1F3FB-200D-2640", 1630, 1, 15},
+    {u"\U0001F481\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F481\U0001F3FC\u200D\u2640", u"1F481-1F3FC-200D-2640-FE0F", u"1F481-1F3FC-200D-2640", 1631, 1, 15},
+    {u"\U0001F481\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F481\U0001F3FD\u200D\u2640", u"1F481-1F3FD-200D-2640-FE0F", u"1F481-1F3FD-200D-2640", 1632, 1, 15},
+    {u"\U0001F481\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F481\U0001F3FE\u200D\u2640", u"1F481-1F3FE-200D-2640-FE0F", u"1F481-1F3FE-200D-2640", 1633, 1, 15},
+    {u"\U0001F481\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F481\U0001F3FF\u200D\u2640", u"1F481-1F3FF-200D-2640-FE0F", u"1F481-1F3FF-200D-2640", 1634, 1, 15},
+    {u"\U0001F481\u200D\u2642\uFE0F", u"\U0001F481\u200D\u2642", u"1F481-200D-2642-FE0F", u"1F481-200D-2642", 1635, 1, 15},
+    {u"\U0001F481\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F481\U0001F3FB\u200D\u2642", u"1F481-1F3FB-200D-2642-FE0F", u"1F481-1F3FB-200D-2642", 1636, 1, 15},
+    {u"\U0001F481\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F481\U0001F3FC\u200D\u2642", u"1F481-1F3FC-200D-2642-FE0F", u"1F481-1F3FC-200D-2642", 1637, 1, 15},
+    {u"\U0001F481\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F481\U0001F3FD\u200D\u2642", u"1F481-1F3FD-200D-2642-FE0F", u"1F481-1F3FD-200D-2642", 1638, 1, 15},
+    {u"\U0001F481\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F481\U0001F3FE\u200D\u2642", u"1F481-1F3FE-200D-2642-FE0F", u"1F481-1F3FE-200D-2642", 1639, 1, 15},
+    {u"\U0001F481\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F481\U0001F3FF\u200D\u2642", u"1F481-1F3FF-200D-2642-FE0F", u"1F481-1F3FF-200D-2642", 1640, 1, 15},
+    {u"\U0001F481", u"", u"1F481", u"", 1641, 1, 15},
+    {u"\U0001F481\U0001F3FB", u"", u"1F481-1F3FB", u"", 1642, 1, 15},
+    {u"\U0001F481\U0001F3FC", u"", u"1F481-1F3FC", u"", 1643, 1, 15},
+    {u"\U0001F481\U0001F3FD", u"", u"1F481-1F3FD", u"", 1644, 1, 15},
+    {u"\U0001F481\U0001F3FE", u"", u"1F481-1F3FE", u"", 1645, 1, 15},
+    {u"\U0001F481\U0001F3FF", u"", u"1F481-1F3FF", u"", 1646, 1, 15},
+    {u"\U0001F482\u200D\u2640\uFE0F", u"\U0001F482\u200D\u2640", u"1F482-200D-2640-FE0F", u"1F482-200D-2640", 1647, 1, 15},
+    {u"\U0001F482\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F482\U0001F3FB\u200D\u2640", u"1F482-1F3FB-200D-2640-FE0F", u"1F482-1F3FB-200D-2640", 1648, 1, 15},
+    {u"\U0001F482\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F482\U0001F3FC\u200D\u2640", u"1F482-1F3FC-200D-2640-FE0F", u"1F482-1F3FC-200D-2640", 1649, 1, 15},
+    {u"\U0001F482\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F482\U0001F3FD\u200D\u2640", u"1F482-1F3FD-200D-2640-FE0F", u"1F482-1F3FD-200D-2640", 1650, 1, 15},
+    {u"\U0001F482\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F482\U0001F3FE\u200D\u2640", u"1F482-1F3FE-200D-2640-FE0F", u"1F482-1F3FE-200D-2640", 1651, 1, 15},
+    {u"\U0001F482\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F482\U0001F3FF\u200D\u2640", u"1F482-1F3FF-200D-2640-FE0F", u"1F482-1F3FF-200D-2640", 1652, 1, 15},
+    {u"\U0001F482\u200D\u2642\uFE0F", u"\U0001F482\u200D\u2642", u"1F482-200D-2642-FE0F", u"1F482-200D-2642", 1653, 1, 15},
+    {u"\U0001F482\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F482\U0001F3FB\u200D\u2642", u"1F482-1F3FB-200D-2642-FE0F", u"1F482-1F3FB-200D-2642", 1654, 1, 15},
+    {u"\U0001F482\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F482\U0001F3FC\u200D\u2642", u"1F482-1F3FC-200D-2642-FE0F", u"1F482-1F3FC-200D-2642", 1655, 1, 15},
+    {u"\U0001F482\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F482\U0001F3FD\u200D\u2642", u"1F482-1F3FD-200D-2642-FE0F", u"1F482-1F3FD-200D-2642", 1656, 1, 15},
+    {u"\U0001F482\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F482\U0001F3FE\u200D\u2642", u"1F482-1F3FE-200D-2642-FE0F", u"1F482-1F3FE-200D-2642", 1657, 1, 15},
+    {u"\U0001F482\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F482\U0001F3FF\u200D\u2642", u"1F482-1F3FF-200D-2642-FE0F", u"1F482-1F3FF-200D-2642", 1658, 1, 15},
+    {u"\U0001F482", u"", u"1F482", u"", 1659, 1, 15},
+    {u"\U0001F482\U0001F3FB", u"", u"1F482-1F3FB", u"", 1660, 1, 15},
+    {u"\U0001F482\U0001F3FC", u"", u"1F482-1F3FC", u"", 1661, 1, 15},
+    {u"\U0001F482\U0001F3FD", u"", u"1F482-1F3FD", u"", 1662, 1, 15},
+    {u"\U0001F482\U0001F3FE", u"", u"1F482-1F3FE", u"", 1663, 1, 15},
+    {u"\U0001F482\U0001F3FF", u"", u"1F482-1F3FF", u"", 1664, 1, 15},
+    {u"\U0001F483", u"", u"1F483", u"", 1665, 1, 15},
+    {u"\U0001F483\U0001F3FB", u"", u"1F483-1F3FB", u"", 1666, 1, 15},
+    {u"\U0001F483\U0001F3FC", u"", u"1F483-1F3FC", u"", 1667, 1, 15},
+    {u"\U0001F483\U0001F3FD", u"", u"1F483-1F3FD", u"", 1668, 1, 15},
+    {u"\U0001F483\U0001F3FE", u"", u"1F483-1F3FE", u"", 1669, 1, 15},
+    {u"\U0001F483\U0001F3FF", u"", u"1F483-1F3FF", u"", 1670, 1, 15},
+    {u"\U0001F484", u"", u"1F484", u"", 1671, 1, 15},
+    {u"\U0001F485", u"", u"1F485", u"", 1672, 1, 15},
+    {u"\U0001F485\U0001F3FB", u"", u"1F485-1F3FB", u"", 1673, 1, 15},
+    {u"\U0001F485\U0001F3FC", u"", u"1F485-1F3FC", u"", 1674, 1, 15},
+    {u"\U0001F485\U0001F3FD", u"", u"1F485-1F3FD", u"", 1675, 1, 15},
+    {u"\U0001F485\U0001F3FE", u"", u"1F485-1F3FE", u"", 1676, 1, 15},
+    {u"\U0001F485\U0001F3FF", u"", u"1F485-1F3FF", u"", 1677, 1, 15},
+    {u"\U0001F486\u200D\u2640\uFE0F", u"\U0001F486\u200D\u2640", u"1F486-200D-2640-FE0F", u"1F486-200D-2640", 1678, 1, 15},
+    {u"\U0001F486\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F486\U0001F3FB\u200D\u2640", u"1F486-1F3FB-200D-2640-FE0F", u"1F486-1F3FB-200D-2640", 1679, 1, 15},
+    {u"\U0001F486\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F486\U0001F3FC\u200D\u2640", u"1F486-1F3FC-200D-2640-FE0F", u"1F486-1F3FC-200D-2640", 1680, 1, 15},
+    {u"\U0001F486\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F486\U0001F3FD\u200D\u2640", u"1F486-1F3FD-200D-2640-FE0F", u"1F486-1F3FD-200D-2640", 1681, 1, 15},
+    {u"\U0001F486\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F486\U0001F3FE\u200D\u2640", u"1F486-1F3FE-200D-2640-FE0F", u"1F486-1F3FE-200D-2640", 1682, 1, 15},
+    {u"\U0001F486\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F486\U0001F3FF\u200D\u2640", u"1F486-1F3FF-200D-2640-FE0F", u"1F486-1F3FF-200D-2640", 1683, 1, 15},
+    {u"\U0001F486\u200D\u2642\uFE0F", u"\U0001F486\u200D\u2642", u"1F486-200D-2642-FE0F", u"1F486-200D-2642", 1684, 1, 15},
+    {u"\U0001F486\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F486\U0001F3FB\u200D\u2642", u"1F486-1F3FB-200D-2642-FE0F", u"1F486-1F3FB-200D-2642", 1685, 1, 15},
+    {u"\U0001F486\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F486\U0001F3FC\u200D\u2642", u"1F486-1F3FC-200D-2642-FE0F", u"1F486-1F3FC-200D-2642", 1686, 1, 15},
+    {u"\U0001F486\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F486\U0001F3FD\u200D\u2642", u"1F486-1F3FD-200D-2642-FE0F", u"1F486-1F3FD-200D-2642", 1687, 1, 15},
+    {u"\U0001F486\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F486\U0001F3FE\u200D\u2642", u"1F486-1F3FE-200D-2642-FE0F", u"1F486-1F3FE-200D-2642", 1688, 1, 15},
+    {u"\U0001F486\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F486\U0001F3FF\u200D\u2642", u"1F486-1F3FF-200D-2642-FE0F", u"1F486-1F3FF-200D-2642", 1689, 1, 15},
+    {u"\U0001F486", u"", u"1F486", u"", 1690, 1, 15},
+    {u"\U0001F486\U0001F3FB", u"", u"1F486-1F3FB", u"", 1691, 1, 15},
+    {u"\U0001F486\U0001F3FC", u"", u"1F486-1F3FC", u"", 1692, 1, 15},
+    {u"\U0001F486\U0001F3FD", u"", u"1F486-1F3FD", u"", 1693, 1, 15},
+    {u"\U0001F486\U0001F3FE", u"", u"1F486-1F3FE", u"", 1694, 1, 15},
+    {u"\U0001F486\U0001F3FF", u"", u"1F486-1F3FF", u"", 1695, 1, 15},
+    {u"\U0001F487\u200D\u2640\uFE0F", u"\U0001F487\u200D\u2640", u"1F487-200D-2640-FE0F", u"1F487-200D-2640", 1696, 1, 15},
+    {u"\U0001F487\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F487\U0001F3FB\u200D\u2640", u"1F487-1F3FB-200D-2640-FE0F", u"1F487-1F3FB-200D-2640", 1697, 1, 15},
+    {u"\U0001F487\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F487\U0001F3FC\u200D\u2640", u"1F487-1F3FC-200D-2640-FE0F", u"1F487-1F3FC-200D-2640", 1698, 1, 15},
+    {u"\U0001F487\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F487\U0001F3FD\u200D\u2640", u"1F487-1F3FD-200D-2640-FE0F", u"1F487-1F3FD-200D-2640", 1699, 1, 15},
+    {u"\U0001F487\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F487\U0001F3FE\u200D\u2640", u"1F487-1F3FE-200D-2640-FE0F", u"1F487-1F3FE-200D-2640", 1700, 1, 15},
+    {u"\U0001F487\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F487\U0001F3FF\u200D\u2640", u"1F487-1F3FF-200D-2640-FE0F", u"1F487-1F3FF-200D-2640", 1701, 1, 15},
+    {u"\U0001F487\u200D\u2642\uFE0F", u"\U0001F487\u200D\u2642", u"1F487-200D-2642-FE0F", u"1F487-200D-2642", 1702, 1, 15},
+    {u"\U0001F487\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F487\U0001F3FB\u200D\u2642", u"1F487-1F3FB-200D-2642-FE0F", u"1F487-1F3FB-200D-2642", 1703, 1, 15},
+    {u"\U0001F487\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F487\U0001F3FC\u200D\u2642", u"1F487-1F3FC-200D-2642-FE0F", u"1F487-1F3FC-200D-2642", 1704, 1, 15},
+    {u"\U0001F487\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F487\U0001F3FD\u200D\u2642", u"1F487-1F3FD-200D-2642-FE0F", u"1F487-1F3FD-200D-2642", 1705, 1, 15},
+    {u"\U0001F487\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F487\U0001F3FE\u200D\u2642", u"1F487-1F3FE-200D-2642-FE0F", u"1F487-1F3FE-200D-2642", 1706, 1, 15},
+    {u"\U0001F487\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F487\U0001F3FF\u200D\u2642", u"1F487-1F3FF-200D-2642-FE0F", u"1F487-1F3FF-200D-2642", 1707, 1, 15},
+    {u"\U0001F487", u"", u"1F487", u"", 1708, 1, 15},
+    {u"\U0001F487\U0001F3FB", u"", u"1F487-1F3FB", u"", 1709, 1, 15},
+    {u"\U0001F487\U0001F3FC", u"", u"1F487-1F3FC", u"", 1710, 1, 15},
+    {u"\U0001F487\U0001F3FD", u"", u"1F487-1F3FD", u"", 1711, 1, 15},
+    {u"\U0001F487\U0001F3FE", u"", u"1F487-1F3FE", u"", 1712, 1, 15},
+    {u"\U0001F487\U0001F3FF", u"", u"1F487-1F3FF", u"", 1713, 1, 15},
+    {u"\U0001F488", u"", u"1F488", u"", 1714, 1, 15},
+    {u"\U0001F489", u"", u"1F489", u"", 1715, 1, 15},
+    {u"\U0001F48A", u"", u"1F48A", u"", 1716, 1, 15},
+    {u"\U0001F48B", u"", u"1F48B", u"", 1717, 1, 15},
+    {u"\U0001F48C", u"", u"1F48C", u"", 1718, 1, 15},
+    {u"\U0001F48D", u"", u"1F48D", u"", 1719, 1, 15},
+    {u"\U0001F48E", u"", u"1F48E", u"", 1720, 1, 15},
+    {u"\U0001F48F", u"", u"1F48F", u"", 1721, 1, 15},
+    {u"\U0001F48F\U0001F3FB", u"", u"1F48F-1F3FB", u"", 1722, 1, 15},
+    {u"\U0001F48F\U0001F3FC", u"", u"1F48F-1F3FC", u"", 1723, 1, 15},
+    {u"\U0001F48F\U0001F3FD", u"", u"1F48F-1F3FD", u"", 1724, 1, 15},
+    {u"\U0001F48F\U0001F3FE", u"", u"1F48F-1F3FE", u"", 1725, 1, 15},
+    {u"\U0001F48F\U0001F3FF", u"", u"1F48F-1F3FF", u"", 1726, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FC", u"\U0001F9D1\U0001F3FB\u200D\u2764\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FC", u"1F9D1-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FC", u"1F9D1-1F3FB-200D-2764-200D-1F48B-200D-1F9D1-1F3FC", 1727, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FD", u"\U0001F9D1\U0001F3FB\u200D\u2764\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FD", u"1F9D1-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FD", u"1F9D1-1F3FB-200D-2764-200D-1F48B-200D-1F9D1-1F3FD", 1728, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FE", u"\U0001F9D1\U0001F3FB\u200D\u2764\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FE", u"1F9D1-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FE", u"1F9D1-1F3FB-200D-2764-200D-1F48B-200D-1F9D1-1F3FE", 1729, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FF", u"\U0001F9D1\U0001F3FB\u200D\u2764\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FF", u"1F9D1-1F3FB-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FF", u"1F9D1-1F3FB-200D-2764-200D-1F48B-200D-1F9D1-1F3FF", 1730, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FB", u"\U0001F9D1\U0001F3FC\u200D\u2764\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FB", u"1F9D1-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FB", u"1F9D1-1F3FC-200D-2764-200D-1F48B-200D-1F9D1-1F3FB", 1731, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FD", u"\U0001F9D1\U0001F3FC\u200D\u2764\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FD", u"1F9D1-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FD", u"1F9D1-1F3FC-200D-2764-200D-1F48B-200D-1F9D1-1F3FD", 1732, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FE", u"\U0001F9D1\U0001F3FC\u200D\u2764\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FE", u"1F9D1-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FE", u"1F9D1-1F3FC-200D-2764-200D-1F48B-200D-1F9D1-1F3FE", 1733, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FF", u"\U0001F9D1\U0001F3FC\u200D\u2764\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FF", u"1F9D1-1F3FC-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FF", u"1F9D1-1F3FC-200D-2764-200D-1F48B-200D-1F9D1-1F3FF", 1734, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FB", u"\U0001F9D1\U0001F3FD\u200D\u2764\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FB", u"1F9D1-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FB", u"1F9D1-1F3FD-200D-2764-200D-1F48B-200D-1F9D1-1F3FB", 1735, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FC", u"\U0001F9D1\U0001F3FD\u200D\u2764\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FC", u"1F9D1-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FC", u"1F9D1-1F3FD-200D-2764-200D-1F48B-200D-1F9D1-1F3FC", 1736, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FE", u"\U0001F9D1\U0001F3FD\u200D\u2764\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FE", u"1F9D1-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FE", u"1F9D1-1F3FD-200D-2764-200D-1F48B-200D-1F9D1-1F3FE", 1737, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FF", u"\U0001F9D1\U0001F3FD\u200D\u2764\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FF", u"1F9D1-1F3FD-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FF", u"1F9D1-1F3FD-200D-2764-200D-1F48B-200D-1F9D1-1F3FF", 1738, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FB", u"\U0001F9D1\U0001F3FE\u200D\u2764\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FB", u"1F9D1-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FB", u"1F9D1-1F3FE-200D-2764-200D-1F48B-200D-1F9D1-1F3FB", 1739, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FC", u"\U0001F9D1\U0001F3FE\u200D\u2764\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FC", u"1F9D1-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FC", u"1F9D1-1F3FE-200D-2764-200D-1F48B-200D-1F9D1-1F3FC", 1740, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FD", u"\U0001F9D1\U0001F3FE\u200D\u2764\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FD", u"1F9D1-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FD", u"1F9D1-1F3FE-200D-2764-200D-1F48B-200D-1F9D1-1F3FD", 1741, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FF", u"\U0001F9D1\U0001F3FE\u200D\u2764\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FF", u"1F9D1-1F3FE-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FF", u"1F9D1-1F3FE-200D-2764-200D-1F48B-200D-1F9D1-1F3FF", 1742, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FB", u"\U0001F9D1\U0001F3FF\u200D\u2764\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FB", u"1F9D1-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FB", u"1F9D1-1F3FF-200D-2764-200D-1F48B-200D-1F9D1-1F3FB", 1743, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FC", u"\U0001F9D1\U0001F3FF\u200D\u2764\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FC", u"1F9D1-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FC", u"1F9D1-1F3FF-200D-2764-200D-1F48B-200D-1F9D1-1F3FC", 1744, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FD", u"\U0001F9D1\U0001F3FF\u200D\u2764\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FD", u"1F9D1-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FD", u"1F9D1-1F3FF-200D-2764-200D-1F48B-200D-1F9D1-1F3FD", 1745, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FE", u"\U0001F9D1\U0001F3FF\u200D\u2764\u200D\U0001F48B\u200D\U0001F9D1\U0001F3FE", u"1F9D1-1F3FF-200D-2764-FE0F-200D-1F48B-200D-1F9D1-1F3FE", u"1F9D1-1F3FF-200D-2764-200D-1F48B-200D-1F9D1-1F3FE", 1746, 1, 15},
+    {u"\U0001F490", u"", u"1F490", u"", 1747, 1, 15},
+    {u"\U0001F491", u"", u"1F491", u"", 1748, 1, 15},
+    {u"\U0001F491\U0001F3FB", u"", u"1F491-1F3FB", u"", 1749, 1, 15},
+    {u"\U0001F491\U0001F3FC", u"", u"1F491-1F3FC", u"", 1750, 1, 15},
+    {u"\U0001F491\U0001F3FD", u"", u"1F491-1F3FD", u"", 1751, 1, 15},
+    {u"\U0001F491\U0001F3FE", u"", u"1F491-1F3FE", u"", 1752, 1, 15},
+    {u"\U0001F491\U0001F3FF", u"", u"1F491-1F3FF", u"", 1753, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F9D1\U0001F3FC", u"\U0001F9D1\U0001F3FB\u200D\u2764\u200D\U0001F9D1\U0001F3FC", u"1F9D1-1F3FB-200D-2764-FE0F-200D-1F9D1-1F3FC", u"1F9D1-1F3FB-200D-2764-200D-1F9D1-1F3FC", 1754, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F9D1\U0001F3FD", u"\U0001F9D1\U0001F3FB\u200D\u2764\u200D\U0001F9D1\U0001F3FD", u"1F9D1-1F3FB-200D-2764-FE0F-200D-1F9D1-1F3FD", u"1F9D1-1F3FB-200D-2764-200D-1F9D1-1F3FD", 1755, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F9D1\U0001F3FE", u"\U0001F9D1\U0001F3FB\u200D\u2764\u200D\U0001F9D1\U0001F3FE", u"1F9D1-1F3FB-200D-2764-FE0F-200D-1F9D1-1F3FE", u"1F9D1-1F3FB-200D-2764-200D-1F9D1-1F3FE", 1756, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\u2764\uFE0F\u200D\U0001F9D1\U0001F3FF", u"\U0001F9D1\U0001F3FB\u200D\u2764\u200D\U0001F9D1\U0001F3FF", u"1F9D1-1F3FB-200D-2764-FE0F-200D-1F9D1-1F3FF", u"1F9D1-1F3FB-200D-2764-200D-1F9D1-1F3FF", 1757, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F9D1\U0001F3FB", u"\U0001F9D1\U0001F3FC\u200D\u2764\u200D\U0001F9D1\U0001F3FB", u"1F9D1-1F3FC-200D-2764-FE0F-200D-1F9D1-1F3FB", u"1F9D1-1F3FC-200D-2764-200D-1F9D1-1F3FB", 1758, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F9D1\U0001F3FD", u"\U0001F9D1\U0001F3FC\u200D\u2764\u200D\U0001F9D1\U0001F3FD", u"1F9D1-1F3FC-200D-2764-FE0F-200D-1F9D1-1F3FD", u"1F9D1-1F3FC-200D-2764-200D-1F9D1-1F3FD", 1759, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F9D1\U0001F3FE", u"\U0001F9D1\U0001F3FC\u200D\u2764\u200D\U0001F9D1\U0001F3FE", u"1F9D1-1F3FC-200D-2764-FE0F-200D-1F9D1-1F3FE", u"1F9D1-1F3FC-200D-2764-200D-1F9D1-1F3FE", 1760, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\u2764\uFE0F\u200D\U0001F9D1\U0001F3FF", u"\U0001F9D1\U0001F3FC\u200D\u2764\u200D\U0001F9D1\U0001F3FF", u"1F9D1-1F3FC-200D-2764-FE0F-200D-1F9D1-1F3FF", u"1F9D1-1F3FC-200D-2764-200D-1F9D1-1F3FF", 1761, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F9D1\U0001F3FB", u"\U0001F9D1\U0001F3FD\u200D\u2764\u200D\U0001F9D1\U0001F3FB", u"1F9D1-1F3FD-200D-2764-FE0F-200D-1F9D1-1F3FB", u"1F9D1-1F3FD-200D-2764-200D-1F9D1-1F3FB", 1762, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F9D1\U0001F3FC", u"\U0001F9D1\U0001F3FD\u200D\u2764\u200D\U0001F9D1\U0001F3FC", u"1F9D1-1F3FD-200D-2764-FE0F-200D-1F9D1-1F3FC", u"1F9D1-1F3FD-200D-2764-200D-1F9D1-1F3FC", 1763, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F9D1\U0001F3FE", u"\U0001F9D1\U0001F3FD\u200D\u2764\u200D\U0001F9D1\U0001F3FE", u"1F9D1-1F3FD-200D-2764-FE0F-200D-1F9D1-1F3FE", u"1F9D1-1F3FD-200D-2764-200D-1F9D1-1F3FE", 1764, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\u2764\uFE0F\u200D\U0001F9D1\U0001F3FF", u"\U0001F9D1\U0001F3FD\u200D\u2764\u200D\U0001F9D1\U0001F3FF", u"1F9D1-1F3FD-200D-2764-FE0F-200D-1F9D1-1F3FF", u"1F9D1-1F3FD-200D-2764-200D-1F9D1-1F3FF", 1765, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F9D1\U0001F3FB", u"\U0001F9D1\U0001F3FE\u200D\u2764\u200D\U0001F9D1\U0001F3FB", u"1F9D1-1F3FE-200D-2764-FE0F-200D-1F9D1-1F3FB", u"1F9D1-1F3FE-200D-2764-200D-1F9D1-1F3FB", 1766, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F9D1\U0001F3FC", u"\U0001F9D1\U0001F3FE\u200D\u2764\u200D\U0001F9D1\U0001F3FC", u"1F9D1-1F3FE-200D-2764-FE0F-200D-1F9D1-1F3FC", u"1F9D1-1F3FE-200D-2764-200D-1F9D1-1F3FC", 1767, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F9D1\U0001F3FD", u"\U0001F9D1\U0001F3FE\u200D\u2764\u200D\U0001F9D1\U0001F3FD", u"1F9D1-1F3FE-200D-2764-FE0F-200D-1F9D1-1F3FD", u"1F9D1-1F3FE-200D-2764-200D-1F9D1-1F3FD", 1768, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\u2764\uFE0F\u200D\U0001F9D1\U0001F3FF", u"\U0001F9D1\U0001F3FE\u200D\u2764\u200D\U0001F9D1\U0001F3FF", u"1F9D1-1F3FE-200D-2764-FE0F-200D-1F9D1-1F3FF", u"1F9D1-1F3FE-200D-2764-200D-1F9D1-1F3FF", 1769, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F9D1\U0001F3FB", u"\U0001F9D1\U0001F3FF\u200D\u2764\u200D\U0001F9D1\U0001F3FB", u"1F9D1-1F3FF-200D-2764-FE0F-200D-1F9D1-1F3FB", u"1F9D1-1F3FF-200D-2764-200D-1F9D1-1F3FB", 1770, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F9D1\U0001F3FC", u"\U0001F9D1\U0001F3FF\u200D\u2764\u200D\U0001F9D1\U0001F3FC", u"1F9D1-1F3FF-200D-2764-FE0F-200D-1F9D1-1F3FC", u"1F9D1-1F3FF-200D-2764-200D-1F9D1-1F3FC", 1771, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F9D1\U0001F3FD", u"\U0001F9D1\U0001F3FF\u200D\u2764\u200D\U0001F9D1\U0001F3FD", u"1F9D1-1F3FF-200D-2764-FE0F-200D-1F9D1-1F3FD", u"1F9D1-1F3FF-200D-2764-200D-1F9D1-1F3FD", 1772, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\u2764\uFE0F\u200D\U0001F9D1\U0001F3FE", u"\U0001F9D1\U0001F3FF\u200D\u2764\u200D\U0001F9D1\U0001F3FE", u"1F9D1-1F3FF-200D-2764-FE0F-200D-1F9D1-1F3FE", u"1F9D1-1F3FF-200D-2764-200D-1F9D1-1F3FE", 1773, 1, 15},
+    {u"\U0001F492", u"", u"1F492", u"", 1774, 1, 15},
+    {u"\U0001F493", u"", u"1F493", u"", 1775, 1, 15},
+    {u"\U0001F494", u"", u"1F494", u"", 1776, 1, 15},
+    {u"\U0001F495", u"", u"1F495", u"", 1777, 1, 15},
+    {u"\U0001F496", u"", u"1F496", u"", 1778, 1, 15},
+    {u"\U0001F497", u"", u"1F497", u"", 1779, 1, 15},
+    {u"\U0001F498", u"", u"1F498", u"", 1780, 1, 15},
+    {u"\U0001F499", u"", u"1F499", u"", 1781, 1, 15},
+    {u"\U0001F49A", u"", u"1F49A", u"", 1782, 1, 15},
+    {u"\U0001F49B", u"", u"1F49B", u"", 1783, 1, 15},
+    {u"\U0001F49C", u"", u"1F49C", u"", 1784, 1, 15},
+    {u"\U0001F49D", u"", u"1F49D", u"", 1785, 1, 15},
+    {u"\U0001F49E", u"", u"1F49E", u"", 1786, 1, 15},
+    {u"\U0001F49F", u"", u"1F49F", u"", 1787, 1, 15},
+    {u"\U0001F4A0", u"", u"1F4A0", u"", 1788, 1, 15},
+    {u"\U0001F4A1", u"", u"1F4A1", u"", 1789, 1, 15},
+    {u"\U0001F4A2", u"", u"1F4A2", u"", 1790, 1, 15},
+    {u"\U0001F4A3", u"", u"1F4A3", u"", 1791, 1, 15},
+    {u"\U0001F4A4", u"", u"1F4A4", u"", 1792, 1, 15},
+    {u"\U0001F4A5", u"", u"1F4A5", u"", 1793, 2, 15},
+    {u"\U0001F4A6", u"", u"1F4A6", u"", 1795, 1, 15},
+    {u"\U0001F4A7", u"", u"1F4A7", u"", 1796, 1, 15},
+    {u"\U0001F4A8", u"", u"1F4A8", u"", 1797, 1, 15},
+    {u"\U0001F4A9", u"", u"1F4A9", u"", 1798, 3, 15},
+    {u"\U0001F4AA", u"", u"1F4AA", u"", 1801, 1, 15},
+    {u"\U0001F4AA\U0001F3FB", u"", u"1F4AA-1F3FB", u"", 1802, 1, 15},
+    {u"\U0001F4AA\U0001F3FC", u"", u"1F4AA-1F3FC", u"", 1803, 1, 15},
+    {u"\U0001F4AA\U0001F3FD", u"", u"1F4AA-1F3FD", u"", 1804, 1, 15},
+    {u"\U0001F4AA\U0001F3FE", u"", u"1F4AA-1F3FE", u"", 1805, 1, 15},
+    {u"\U0001F4AA\U0001F3FF", u"", u"1F4AA-1F3FF", u"", 1806, 1, 15},
+    {u"\U0001F4AB", u"", u"1F4AB", u"", 1807, 1, 15},
+    {u"\U0001F4AC", u"", u"1F4AC", u"", 1808, 1, 15},
+    {u"\U0001F4AD", u"", u"1F4AD", u"", 1809, 1, 15},
+    {u"\U0001F4AE", u"", u"1F4AE", u"", 1810, 1, 15},
+    {u"\U0001F4AF", u"", u"1F4AF", u"", 1811, 1, 15},
+    {u"\U0001F4B0", u"", u"1F4B0", u"", 1812, 1, 15},
+    {u"\U0001F4B1", u"", u"1F4B1", u"", 1813, 1, 15},
+    {u"\U0001F4B2", u"", u"1F4B2", u"", 1814, 1, 15},
+    {u"\U0001F4B3", u"", u"1F4B3", u"", 1815, 1, 15},
+    {u"\U0001F4B4", u"", u"1F4B4", u"", 1816, 1, 15},
+    {u"\U0001F4B5", u"", u"1F4B5", u"", 1817, 1, 15},
+    {u"\U0001F4B6", u"", u"1F4B6", u"", 1818, 1, 15},
+    {u"\U0001F4B7", u"", u"1F4B7", u"", 1819, 1, 15},
+    {u"\U0001F4B8", u"", u"1F4B8", u"", 1820, 1, 15},
+    {u"\U0001F4B9", u"", u"1F4B9", u"", 1821, 1, 15},
+    {u"\U0001F4BA", u"", u"1F4BA", u"", 1822, 1, 15},
+    {u"\U0001F4BB", u"", u"1F4BB", u"", 1823, 1, 15},
+    {u"\U0001F4BC", u"", u"1F4BC", u"", 1824, 1, 15},
+    {u"\U0001F4BD", u"", u"1F4BD", u"", 1825, 1, 15},
+    {u"\U0001F4BE", u"", u"1F4BE", u"", 1826, 1, 15},
+    {u"\U0001F4BF", u"", u"1F4BF", u"", 1827, 1, 15},
+    {u"\U0001F4C0", u"", u"1F4C0", u"", 1828, 1, 15},
+    {u"\U0001F4C1", u"", u"1F4C1", u"", 1829, 1, 15},
+    {u"\U0001F4C2", u"", u"1F4C2", u"", 1830, 1, 15},
+    {u"\U0001F4C3", u"", u"1F4C3", u"", 1831, 1, 15},
+    {u"\U0001F4C4", u"", u"1F4C4", u"", 1832, 1, 15},
+    {u"\U0001F4C5", u"", u"1F4C5", u"", 1833, 1, 15},
+    {u"\U0001F4C6", u"", u"1F4C6", u"", 1834, 1, 15},
+    {u"\U0001F4C7", u"", u"1F4C7", u"", 1835, 1, 15},
+    {u"\U0001F4C8", u"", u"1F4C8", u"", 1836, 1, 15},
+    {u"\U0001F4C9", u"", u"1F4C9", u"", 1837, 1, 15},
+    {u"\U0001F4CA", u"", u"1F4CA", u"", 1838, 1, 15},
+    {u"\U0001F4CB", u"", u"1F4CB", u"", 1839, 1, 15},
+    {u"\U0001F4CC", u"", u"1F4CC", u"", 1840, 1, 15},
+    {u"\U0001F4CD", u"", u"1F4CD", u"", 1841, 1, 15},
+    {u"\U0001F4CE", u"", u"1F4CE", u"", 1842, 1, 15},
+    {u"\U0001F4CF", u"", u"1F4CF", u"", 1843, 1, 15},
+    {u"\U0001F4D0", u"", u"1F4D0", u"", 1844, 1, 15},
+    {u"\U0001F4D1", u"", u"1F4D1", u"", 1845, 1, 15},
+    {u"\U0001F4D2", u"", u"1F4D2", u"", 1846, 1, 15},
+    {u"\U0001F4D3", u"", u"1F4D3", u"", 1847, 1, 15},
+    {u"\U0001F4D4", u"", u"1F4D4", u"", 1848, 1, 15},
+    {u"\U0001F4D5", u"", u"1F4D5", u"", 1849, 1, 15},
+    {u"\U0001F4D6", u"", u"1F4D6", u"", 1850, 2, 15},
+    {u"\U0001F4D7", u"", u"1F4D7", u"", 1852, 1, 15},
+    {u"\U0001F4D8", u"", u"1F4D8", u"", 1853, 1, 15},
+    {u"\U0001F4D9", u"", u"1F4D9", u"", 1854, 1, 15},
+    {u"\U0001F4DA", u"", u"1F4DA", u"", 1855, 1, 15},
+    {u"\U0001F4DB", u"", u"1F4DB", u"", 1856, 1, 15},
+    {u"\U0001F4DC", u"", u"1F4DC", u"", 1857, 1, 15},
+    {u"\U0001F4DD", u"", u"1F4DD", u"", 1858, 2, 15},
+    {u"\U0001F4DE", u"", u"1F4DE", u"", 1860, 1, 15},
+    {u"\U0001F4DF", u"", u"1F4DF", u"", 1861, 1, 15},
+    {u"\U0001F4E0", u"", u"1F4E0", u"", 1862, 1, 15},
+    {u"\U0001F4E1", u"", u"1F4E1", u"", 1863, 1, 15},
+    {u"\U0001F4E2", u"", u"1F4E2", u"", 1864, 1, 15},
+    {u"\U0001F4E3", u"", u"1F4E3", u"", 1865, 1, 15},
+    {u"\U0001F4E4", u"", u"1F4E4", u"", 1866, 1, 15},
+    {u"\U0001F4E5", u"", u"1F4E5", u"", 1867, 1, 15},
+    {u"\U0001F4E6", u"", u"1F4E6", u"", 1868, 1, 15},
+    {u"\U0001F4E7", u"", u"1F4E7", u"", 1869, 1, 15},
+    {u"\U0001F4E8", u"", u"1F4E8", u"", 1870, 1, 15},
+    {u"\U0001F4E9", u"", u"1F4E9", u"", 1871, 1, 15},
+    {u"\U0001F4EA", u"", u"1F4EA", u"", 1872, 1, 15},
+    {u"\U0001F4EB", u"", u"1F4EB", u"", 1873, 1, 15},
+    {u"\U0001F4EC", u"", u"1F4EC", u"", 1874, 1, 15},
+    {u"\U0001F4ED", u"", u"1F4ED", u"", 1875, 1, 15},
+    {u"\U0001F4EE", u"", u"1F4EE", u"", 1876, 1, 15},
+    {u"\U0001F4EF", u"", u"1F4EF", u"", 1877, 1, 15},
+    {u"\U0001F4F0", u"", u"1F4F0", u"", 1878, 1, 15},
+    {u"\U0001F4F1", u"", u"1F4F1", u"", 1879, 1, 15},
+    {u"\U0001F4F2", u"", u"1F4F2", u"", 1880, 1, 15},
+    {u"\U0001F4F3", u"", u"1F4F3", u"", 1881, 1, 15},
+    {u"\U0001F4F4", u"", u"1F4F4", u"", 1882, 1, 15},
+    {u"\U0001F4F5", u"", u"1F4F5", u"", 1883, 1, 15},
+    {u"\U0001F4F6", u"", u"1F4F6", u"", 1884, 1, 15},
+    {u"\U0001F4F7", u"", u"1F4F7", u"", 1885, 1, 15},
+    {u"\U0001F4F8", u"", u"1F4F8", u"", 1886, 1, 15},
+    {u"\U0001F4F9", u"", u"1F4F9", u"", 1887, 1, 15},
+    {u"\U0001F4FA", u"", u"1F4FA", u"", 1888, 1, 15},
+    {u"\U0001F4FB", u"", u"1F4FB", u"", 1889, 1, 15},
+    {u"\U0001F4FC", u"", u"1F4FC", u"", 1890, 1, 15},
+    {u"\U0001F4FD\uFE0F", u"\U0001F4FD", u"1F4FD-FE0F", u"1F4FD", 1891, 1, 15},
+    {u"\U0001F4FF", u"", u"1F4FF", u"", 1892, 1, 15},
+    {u"\U0001F500", u"", u"1F500", u"", 1893, 1, 15},
+    {u"\U0001F501", u"", u"1F501", u"", 1894, 1, 15},
+    {u"\U0001F502", u"", u"1F502", u"", 1895, 1, 15},
+    {u"\U0001F503", u"", u"1F503", u"", 1896, 1, 15},
+    {u"\U0001F504", u"", u"1F504", u"", 1897, 1, 15},
+    {u"\U0001F505", u"", u"1F505", u"", 1898, 1, 15},
+    {u"\U0001F506", u"", u"1F506", u"", 1899, 1, 15},
+    {u"\U0001F507", u"", u"1F507", u"", 1900, 1, 15},
+    {u"\U0001F508", u"", u"1F508", u"", 1901, 1, 15},
+    {u"\U0001F509", u"", u"1F509", u"", 1902, 1, 15},
+    {u"\U0001F50A", u"", u"1F50A", u"", 1903, 1, 15},
+    {u"\U0001F50B", u"", u"1F50B", u"", 1904, 1, 15},
+    {u"\U0001F50C", u"", u"1F50C", u"", 1905, 1, 15},
+    {u"\U0001F50D", u"", u"1F50D", u"", 1906, 1, 15},
+    {u"\U0001F50E", u"", u"1F50E", u"", 1907, 1, 15},
+    {u"\U0001F50F", u"", u"1F50F", u"", 1908, 1, 15},
+    {u"\U0001F510", u"", u"1F510", u"", 1909, 1, 15},
+    {u"\U0001F511", u"", u"1F511", u"", 1910, 1, 15},
+    {u"\U0001F512", u"", u"1F512", u"", 1911, 1, 15},
+    {u"\U0001F513", u"", u"1F513", u"", 1912, 1, 15},
+    {u"\U0001F514", u"", u"1F514", u"", 1913, 1, 15},
+    {u"\U0001F515", u"", u"1F515", u"", 1914, 1, 15},
+    {u"\U0001F516", u"", u"1F516", u"", 1915, 1, 15},
+    {u"\U0001F517", u"", u"1F517", u"", 1916, 1, 15},
+    {u"\U0001F518", u"", u"1F518", u"", 1917, 1, 15},
+    {u"\U0001F519", u"", u"1F519", u"", 1918, 1, 15},
+    {u"\U0001F51A", u"", u"1F51A", u"", 1919, 1, 15},
+    {u"\U0001F51B", u"", u"1F51B", u"", 1920, 1, 15},
+    {u"\U0001F51C", u"", u"1F51C", u"", 1921, 1, 15},
+    {u"\U0001F51D", u"", u"1F51D", u"", 1922, 1, 15},
+    {u"\U0001F51E", u"", u"1F51E", u"", 1923, 1, 15},
+    {u"\U0001F51F", u"", u"1F51F", u"", 1924, 1, 15},
+    {u"\U0001F520", u"", u"1F520", u"", 1925, 1, 15},
+    {u"\U0001F521", u"", u"1F521", u"", 1926, 1, 15},
+    {u"\U0001F522", u"", u"1F522", u"", 1927, 1, 15},
+    {u"\U0001F523", u"", u"1F523", u"", 1928, 1, 15},
+    {u"\U0001F524", u"", u"1F524", u"", 1929, 1, 15},
+    {u"\U0001F525", u"", u"1F525", u"", 1930, 1, 15},
+    {u"\U0001F526", u"", u"1F526", u"", 1931, 1, 15},
+    {u"\U0001F527", u"", u"1F527", u"", 1932, 1, 15},
+    {u"\U0001F528", u"", u"1F528", u"", 1933, 1, 15},
+    {u"\U0001F529", u"", u"1F529", u"", 1934, 1, 15},
+    {u"\U0001F52A", u"", u"1F52A", u"", 1935, 2, 15},
+    {u"\U0001F52B", u"", u"1F52B", u"", 1937, 1, 15},
+    {u"\U0001F52C", u"", u"1F52C", u"", 1938, 1, 15},
+    {u"\U0001F52D", u"", u"1F52D", u"", 1939, 1, 15},
+    {u"\U0001F52E", u"", u"1F52E", u"", 1940, 1, 15},
+    {u"\U0001F52F", u"", u"1F52F", u"", 1941, 1, 15},
+    {u"\U0001F530", u"", u"1F530", u"", 1942, 1, 15},
+    {u"\U0001F531", u"", u"1F531", u"", 1943, 1, 15},
+    {u"\U0001F532", u"", u"1F532", u"", 1944, 1, 15},
+    {u"\U0001F533", u"", u"1F533", u"", 1945, 1, 15},
+    {u"\U0001F534", u"", u"1F534", u"", 1946, 1, 15},
+    {u"\U0001F535", u"", u"1F535", u"", 1947, 1, 15},
+    {u"\U0001F536", u"", u"1F536", u"", 1948, 1, 15},
+    {u"\U0001F537", u"", u"1F537", u"", 1949, 1, 15},
+    {u"\U0001F538", u"", u"1F538", u"", 1950, 1, 15},
+    {u"\U0001F539", u"", u"1F539", u"", 1951, 1, 15},
+    {u"\U0001F53A", u"", u"1F53A", u"", 1952, 1, 15},
+    {u"\U0001F53B", u"", u"1F53B", u"", 1953, 1, 15},
+    {u"\U0001F53C", u"", u"1F53C", u"", 1954, 1, 15},
+    {u"\U0001F53D", u"", u"1F53D", u"", 1955, 1, 15},
+    {u"\U0001F549\uFE0F", u"\U0001F549", u"1F549-FE0F", u"1F549", 1956, 1, 15},
+    {u"\U0001F54A\uFE0F", u"\U0001F54A", u"1F54A-FE0F", u"1F54A", 1957, 1, 15},
+    {u"\U0001F54B", u"", u"1F54B", u"", 1958, 1, 15},
+    {u"\U0001F54C", u"", u"1F54C", u"", 1959, 1, 15},
+    {u"\U0001F54D", u"", u"1F54D", u"", 1960, 1, 15},
+    {u"\U0001F54E", u"", u"1F54E", u"", 1961, 1, 15},
+    {u"\U0001F550", u"", u"1F550", u"", 1962, 1, 15},
+    {u"\U0001F551", u"", u"1F551", u"", 1963, 1, 15},
+    {u"\U0001F552", u"", u"1F552", u"", 1964, 1, 15},
+    {u"\U0001F553", u"", u"1F553", u"", 1965, 1, 15},
+    {u"\U0001F554", u"", u"1F554", u"", 1966, 1, 15},
+    {u"\U0001F555", u"", u"1F555", u"", 1967, 1, 15},
+    {u"\U0001F556", u"", u"1F556", u"", 1968, 1, 15},
+    {u"\U0001F557", u"", u"1F557", u"", 1969, 1, 15},
+    {u"\U0001F558", u"", u"1F558", u"", 1970, 1, 15},
+    {u"\U0001F559", u"", u"1F559", u"", 1971, 1, 15},
+    {u"\U0001F55A", u"", u"1F55A", u"", 1972, 1, 15},
+    {u"\U0001F55B", u"", u"1F55B", u"", 1973, 1, 15},
+    {u"\U0001F55C", u"", u"1F55C", u"", 1974, 1, 15},
+    {u"\U0001F55D", u"", u"1F55D", u"", 1975, 1, 15},
+    {u"\U0001F55E", u"", u"1F55E", u"", 1976, 1, 15},
+    {u"\U0001F55F", u"", u"1F55F", u"", 1977, 1, 15},
+    {u"\U0001F560", u"", u"1F560", u"", 1978, 1, 15},
+    {u"\U0001F561", u"", u"1F561", u"", 1979, 1, 15},
+    {u"\U0001F562", u"", u"1F562", u"", 1980, 1, 15},
+    {u"\U0001F563", u"", u"1F563", u"", 1981, 1, 15},
+    {u"\U0001F564", u"", u"1F564", u"", 1982, 1, 15},
+    {u"\U0001F565", u"", u"1F565", u"", 1983, 1, 15},
+    {u"\U0001F566", u"", u"1F566", u"", 1984, 1, 15},
+    {u"\U0001F567", u"", u"1F567", u"", 1985, 1, 15},
+    {u"\U0001F56F\uFE0F", u"\U0001F56F", u"1F56F-FE0F", u"1F56F", 1986, 1, 15},
+    {u"\U0001F570\uFE0F", u"\U0001F570", u"1F570-FE0F", u"1F570", 1987, 1, 15},
+    {u"\U0001F573\uFE0F", u"\U0001F573", u"1F573-FE0F", u"1F573", 1988, 1, 15},
+    {u"\U0001F574\uFE0F", u"\U0001F574", u"1F574-FE0F", u"1F574", 1989, 1, 15},
+    {u"\U0001F574\U0001F3FB", u"", u"1F574-1F3FB", u"", 1990, 1, 15},
+    {u"\U0001F574\U0001F3FC", u"", u"1F574-1F3FC", u"", 1991, 1, 15},
+    {u"\U0001F574\U0001F3FD", u"", u"1F574-1F3FD", u"", 1992, 1, 15},
+    {u"\U0001F574\U0001F3FE", u"", u"1F574-1F3FE", u"", 1993, 1, 15},
+    {u"\U0001F574\U0001F3FF", u"", u"1F574-1F3FF", u"", 1994, 1, 15},
+    {u"\U0001F575\uFE0F\u200D\u2640\uFE0F", u"\U0001F575\u200D\u2640", u"1F575-FE0F-200D-2640-FE0F", u"1F575-200D-2640", 1995, 1, 15},
+    {u"\U0001F575\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F575\U0001F3FB\u200D\u2640", u"1F575-1F3FB-200D-2640-FE0F", u"1F575-1F3FB-200D-2640", 1996, 1, 15},
+    {u"\U0001F575\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F575\U0001F3FC\u200D\u2640", u"1F575-1F3FC-200D-2640-FE0F", u"1F575-1F3FC-200D-2640", 1997, 1, 15},
+    {u"\U0001F575\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F575\U0001F3FD\u200D\u2640", u"1F575-1F3FD-200D-2640-FE0F", u"1F575-1F3FD-200D-2640", 1998, 1, 15},
+    {u"\U0001F575\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F575\U0001F3FE\u200D\u2640", u"1F575-1F3FE-200D-2640-FE0F", u"1F575-1F3FE-200D-2640", 1999, 1, 15},
+    {u"\U0001F575\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F575\U0001F3FF\u200D\u2640", u"1F575-1F3FF-200D-2640-FE0F", u"1F575-1F3FF-200D-2640", 2000, 1, 15},
+    {u"\U0001F575\uFE0F\u200D\u2642\uFE0F", u"\U0001F575\u200D\u2642", u"1F575-FE0F-200D-2642-FE0F", u"1F575-200D-2642", 2001, 1, 15},
+    {u"\U0001F575\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F575\U0001F3FB\u200D\u2642", u"1F575-1F3FB-200D-2642-FE0F", u"1F575-1F3FB-200D-2642", 2002, 1, 15},
+    {u"\U0001F575\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F575\U0001F3FC\u200D\u2642", u"1F575-1F3FC-200D-2642-FE0F", u"1F575-1F3FC-200D-2642", 2003, 1, 15},
+    {u"\U0001F575\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F575\U0001F3FD\u200D\u2642", u"1F575-1F3FD-200D-2642-FE0F", u"1F575-1F3FD-200D-2642", 2004, 1, 15},
+    {u"\U0001F575\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F575\U0001F3FE\u200D\u2642", u"1F575-1F3FE-200D-2642-FE0F", u"1F575-1F3FE-200D-2642", 2005, 1, 15},
+    {u"\U0001F575\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F575\U0001F3FF\u200D\u2642", u"1F575-1F3FF-200D-2642-FE0F", u"1F575-1F3FF-200D-2642", 2006, 1, 15},
+    {u"\U0001F575\uFE0F", u"\U0001F575", u"1F575-FE0F", u"1F575", 2007, 1, 15},
+    {u"\U0001F575\U0001F3FB", u"", u"1F575-1F3FB", u"", 2008, 1, 15},
+    {u"\U0001F575\U0001F3FC", u"", u"1F575-1F3FC", u"", 2009, 1, 15},
+    {u"\U0001F575\U0001F3FD", u"", u"1F575-1F3FD", u"", 2010, 1, 15},
+    {u"\U0001F575\U0001F3FE", u"", u"1F575-1F3FE", u"", 2011, 1, 15},
+    {u"\U0001F575\U0001F3FF", u"", u"1F575-1F3FF", u"", 2012, 1, 15},
+    {u"\U0001F576\uFE0F", u"\U0001F576", u"1F576-FE0F", u"1F576", 2013, 1, 15},
+    {u"\U0001F577\uFE0F", u"\U0001F577", u"1F577-FE0F", u"1F577", 2014, 1, 15},
+    {u"\U0001F578\uFE0F", u"\U0001F578", u"1F578-FE0F", u"1F578", 2015, 1, 15},
+    {u"\U0001F579\uFE0F", u"\U0001F579", u"1F579-FE0F", u"1F579", 2016, 1, 15},
+    {u"\U0001F57A", u"", u"1F57A", u"", 2017, 1, 15},
+    {u"\U0001F57A\U0001F3FB", u"", u"1F57A-1F3FB", u"", 2018, 1, 15},
+    {u"\U0001F57A\U0001F3FC", u"", u"1F57A-1F3FC", u"", 2019, 1, 15},
+    {u"\U0001F57A\U0001F3FD", u"", u"1F57A-1F3FD", u"", 2020, 1, 15},
+    {u"\U0001F57A\U0001F3FE", u"", u"1F57A-1F3FE", u"", 2021, 1, 15},
+    {u"\U0001F57A\U0001F3FF", u"", u"1F57A-1F3FF", u"", 2022, 1, 15},
+    {u"\U0001F587\uFE0F", u"\U0001F587", u"1F587-FE0F", u"1F587", 2023, 1, 15},
+    {u"\U0001F58A\uFE0F", u"\U0001F58A", u"1F58A-FE0F", u"1F58A", 2024, 1, 15},
+    {u"\U0001F58B\uFE0F", u"\U0001F58B", u"1F58B-FE0F", u"1F58B", 2025, 1, 15},
+    {u"\U0001F58C\uFE0F", u"\U0001F58C", u"1F58C-FE0F", u"1F58C", 2026, 1, 15},
+    {u"\U0001F58D\uFE0F", u"\U0001F58D", u"1F58D-FE0F", u"1F58D", 2027, 1, 15},
+    {u"\U0001F590\uFE0F", u"\U0001F590", u"1F590-FE0F", u"1F590", 2028, 1, 15},
+    {u"\U0001F590\U0001F3FB", u"", u"1F590-1F3FB", u"", 2029, 1, 15},
+    {u"\U0001F590\U0001F3FC", u"", u"1F590-1F3FC", u"", 2030, 1, 15},
+    {u"\U0001F590\U0001F3FD", u"", u"1F590-1F3FD", u"", 2031, 1, 15},
+    {u"\U0001F590\U0001F3FE", u"", u"1F590-1F3FE", u"", 2032, 1, 15},
+    {u"\U0001F590\U0001F3FF", u"", u"1F590-1F3FF", u"", 2033, 1, 15},
+    {u"\U0001F595", u"", u"1F595", u"", 2034, 2, 15},
+    {u"\U0001F595\U0001F3FB", u"", u"1F595-1F3FB", u"", 2036, 1, 15},
+    {u"\U0001F595\U0001F3FC", u"", u"1F595-1F3FC", u"", 2037, 1, 15},
+    {u"\U0001F595\U0001F3FD", u"", u"1F595-1F3FD", u"", 2038, 1, 15},
+    {u"\U0001F595\U0001F3FE", u"", u"1F595-1F3FE", u"", 2039, 1, 15},
+    {u"\U0001F595\U0001F3FF", u"", u"1F595-1F3FF", u"", 2040, 1, 15},
+    {u"\U0001F596", u"", u"1F596", u"", 2041, 1, 15},
+    {u"\U0001F596\U0001F3FB", u"", u"1F596-1F3FB", u"", 2042, 1, 15},
+    {u"\U0001F596\U0001F3FC", u"", u"1F596-1F3FC", u"", 2043, 1, 15},
+    {u"\U0001F596\U0001F3FD", u"", u"1F596-1F3FD", u"", 2044, 1, 15},
+    {u"\U0001F596\U0001F3FE", u"", u"1F596-1F3FE", u"", 2045, 1, 15},
+    {u"\U0001F596\U0001F3FF", u"", u"1F596-1F3FF", u"", 2046, 1, 15},
+    {u"\U0001F5A4", u"", u"1F5A4", u"", 2047, 1, 15},
+    {u"\U0001F5A5\uFE0F", u"\U0001F5A5", u"1F5A5-FE0F", u"1F5A5", 2048, 1, 15},
+    {u"\U0001F5A8\uFE0F", u"\U0001F5A8", u"1F5A8-FE0F", u"1F5A8", 2049, 1, 15},
+    {u"\U0001F5B1\uFE0F", u"\U0001F5B1", u"1F5B1-FE0F", u"1F5B1", 2050, 1, 15},
+    {u"\U0001F5B2\uFE0F", u"\U0001F5B2", u"1F5B2-FE0F", u"1F5B2", 2051, 1, 15},
+    {u"\U0001F5BC\uFE0F", u"\U0001F5BC", u"1F5BC-FE0F", u"1F5BC", 2052, 1, 15},
+    {u"\U0001F5C2\uFE0F", u"\U0001F5C2", u"1F5C2-FE0F", u"1F5C2", 2053, 1, 15},
+    {u"\U0001F5C3\uFE0F", u"\U0001F5C3", u"1F5C3-FE0F", u"1F5C3", 2054, 1, 15},
+    {u"\U0001F5C4\uFE0F", u"\U0001F5C4", u"1F5C4-FE0F", u"1F5C4", 2055, 1, 15},
+    {u"\U0001F5D1\uFE0F", u"\U0001F5D1", u"1F5D1-FE0F", u"1F5D1", 2056, 1, 15},
+    {u"\U0001F5D2\uFE0F", u"\U0001F5D2", u"1F5D2-FE0F", u"1F5D2", 2057, 1, 15},
+    {u"\U0001F5D3\uFE0F", u"\U0001F5D3", u"1F5D3-FE0F", u"1F5D3", 2058, 1, 15},
+    {u"\U0001F5DC\uFE0F", u"\U0001F5DC", u"1F5DC-FE0F", u"1F5DC", 2059, 1, 15},
+    {u"\U0001F5DD\uFE0F", u"\U0001F5DD", u"1F5DD-FE0F", u"1F5DD", 2060, 1, 15},
+    {u"\U0001F5DE\uFE0F", u"\U0001F5DE", u"1F5DE-FE0F", u"1F5DE", 2061, 1, 15},
+    {u"\U0001F5E1\uFE0F", u"\U0001F5E1", u"1F5E1-FE0F", u"1F5E1", 2062, 1, 15},
+    {u"\U0001F5E3\uFE0F", u"\U0001F5E3", u"1F5E3-FE0F", u"1F5E3", 2063, 1, 15},
+    {u"\U0001F5E8\uFE0F", u"\U0001F5E8", u"1F5E8-FE0F", u"1F5E8", 2064, 1, 15},
+    {u"\U0001F5EF\uFE0F", u"\U0001F5EF", u"1F5EF-FE0F", u"1F5EF", 2065, 1, 15},
+    {u"\U0001F5F3\uFE0F", u"\U0001F5F3", u"1F5F3-FE0F", u"1F5F3", 2066, 1, 15},
+    {u"\U0001F5FA\uFE0F", u"\U0001F5FA", u"1F5FA-FE0F", u"1F5FA", 2067, 1, 15},
+    {u"\U0001F5FB", u"", u"1F5FB", u"", 2068, 1, 15},
+    {u"\U0001F5FC", u"", u"1F5FC", u"", 2069, 1, 15},
+    {u"\U0001F5FD", u"", u"1F5FD", u"", 2070, 1, 15},
+    {u"\U0001F5FE", u"", u"1F5FE", u"", 2071, 1, 15},
+    {u"\U0001F5FF", u"", u"1F5FF", u"", 2072, 1, 15},
+    {u"\U0001F600", u"", u"1F600", u"", 2073, 1, 15},
+    {u"\U0001F601", u"", u"1F601", u"", 2074, 1, 15},
+    {u"\U0001F602", u"", u"1F602", u"", 2075, 1, 15},
+    {u"\U0001F603", u"", u"1F603", u"", 2076, 1, 15},
+    {u"\U0001F604", u"", u"1F604", u"", 2077, 1, 15},
+    {u"\U0001F605", u"", u"1F605", u"", 2078, 1, 15},
+    {u"\U0001F606", u"", u"1F606", u"", 2079, 2, 15},
+    {u"\U0001F607", u"", u"1F607", u"", 2081, 1, 15},
+    {u"\U0001F608", u"", u"1F608", u"", 2082, 1, 15},
+    {u"\U0001F609", u"", u"1F609", u"", 2083, 1, 15},
+    {u"\U0001F60A", u"", u"1F60A", u"", 2084, 1, 15},
+    {u"\U0001F60B", u"", u"1F60B", u"", 2085, 1, 15},
+    {u"\U0001F60C", u"", u"1F60C", u"", 2086, 1, 15},
+    {u"\U0001F60D", u"", u"1F60D", u"", 2087, 1, 15},
+    {u"\U0001F60E", u"", u"1F60E", u"", 2088, 1, 15},
+    {u"\U0001F60F", u"", u"1F60F", u"", 2089, 1, 15},
+    {u"\U0001F610", u"", u"1F610", u"", 2090, 1, 15},
+    {u"\U0001F611", u"", u"1F611", u"", 2091, 1, 15},
+    {u"\U0001F612", u"", u"1F612", u"", 2092, 1, 15},
+    {u"\U0001F613", u"", u"1F613", u"", 2093, 1, 15},
+    {u"\U0001F614", u"", u"1F614", u"", 2094, 1, 15},
+    {u"\U0001F615", u"", u"1F615", u"", 2095, 1, 15},
+    {u"\U0001F616", u"", u"1F616", u"", 2096, 1, 15},
+    {u"\U0001F617", u"", u"1F617", u"", 2097, 1, 15},
+    {u"\U0001F618", u"", u"1F618", u"", 2098, 1, 15},
+    {u"\U0001F619", u"", u"1F619", u"", 2099, 1, 15},
+    {u"\U0001F61A", u"", u"1F61A", u"", 2100, 1, 15},
+    {u"\U0001F61B", u"", u"1F61B", u"", 2101, 1, 15},
+    {u"\U0001F61C", u"", u"1F61C", u"", 2102, 1, 15},
+    {u"\U0001F61D", u"", u"1F61D", u"", 2103, 1, 15},
+    {u"\U0001F61E", u"", u"1F61E", u"", 2104, 1, 15},
+    {u"\U0001F61F", u"", u"1F61F", u"", 2105, 1, 15},
+    {u"\U0001F620", u"", u"1F620", u"", 2106, 1, 15},
+    {u"\U0001F621", u"", u"1F621", u"", 2107, 1, 15},
+    {u"\U0001F622", u"", u"1F622", u"", 2108, 1, 15},
+    {u"\U0001F623", u"", u"1F623", u"", 2109, 1, 15},
+    {u"\U0001F624", u"", u"1F624", u"", 2110, 1, 15},
+    {u"\U0001F625", u"", u"1F625", u"", 2111, 1, 15},
+    {u"\U0001F626", u"", u"1F626", u"", 2112, 1, 15},
+    {u"\U0001F627", u"", u"1F627", u"", 2113, 1, 15},
+    {u"\U0001F628", u"", u"1F628", u"", 2114, 1, 15},
+    {u"\U0001F629", u"", u"1F629", u"", 2115, 1, 15},
+    {u"\U0001F62A", u"", u"1F62A", u"", 2116, 1, 15},
+    {u"\U0001F62B", u"", u"1F62B", u"", 2117, 1, 15},
+    {u"\U0001F62C", u"", u"1F62C", u"", 2118, 1, 15},
+    {u"\U0001F62D", u"", u"1F62D", u"", 2119, 1, 15},
+    {u"\U0001F62E\u200D\U0001F4A8", u"", u"1F62E-200D-1F4A8", u"", 2120, 1, 15},
+    {u"\U0001F62E", u"", u"1F62E", u"", 2121, 1, 15},
+    {u"\U0001F62F", u"", u"1F62F", u"", 2122, 1, 15},
+    {u"\U0001F630", u"", u"1F630", u"", 2123, 1, 15},
+    {u"\U0001F631", u"", u"1F631", u"", 2124, 1, 15},
+    {u"\U0001F632", u"", u"1F632", u"", 2125, 1, 15},
+    {u"\U0001F633", u"", u"1F633", u"", 2126, 1, 15},
+    {u"\U0001F634", u"", u"1F634", u"", 2127, 1, 15},
+    {u"\U0001F635\u200D\U0001F4AB", u"", u"1F635-200D-1F4AB", u"", 2128, 1, 15},
+    {u"\U0001F635", u"", u"1F635", u"", 2129, 1, 15},
+    {u"\U0001F636\u200D\U0001F32B\uFE0F", u"\U0001F636\u200D\U0001F32B", u"1F636-200D-1F32B-FE0F", u"1F636-200D-1F32B", 2130, 1, 15},
+    {u"\U0001F636", u"", u"1F636", u"", 2131, 1, 15},
+    {u"\U0001F637", u"", u"1F637", u"", 2132, 1, 15},
+    {u"\U0001F638", u"", u"1F638", u"", 2133, 1, 15},
+    {u"\U0001F639", u"", u"1F639", u"", 2134, 1, 15},
+    {u"\U0001F63A", u"", u"1F63A", u"", 2135, 1, 15},
+    {u"\U0001F63B", u"", u"1F63B", u"", 2136, 1, 15},
+    {u"\U0001F63C", u"", u"1F63C", u"", 2137, 1, 15},
+    {u"\U0001F63D", u"", u"1F63D", u"", 2138, 1, 15},
+    {u"\U0001F63E", u"", u"1F63E", u"", 2139, 1, 15},
+    {u"\U0001F63F", u"", u"1F63F", u"", 2140, 1, 15},
+    {u"\U0001F640", u"", u"1F640", u"", 2141, 1, 15},
+    {u"\U0001F641", u"", u"1F641", u"", 2142, 1, 15},
+    {u"\U0001F642\u200D\u2194\uFE0F", u"\U0001F642\u200D\u2194", u"1F642-200D-2194-FE0F", u"1F642-200D-2194", 2143, 1, 7},
+    {u"\U0001F642\u200D\u2195\uFE0F", u"\U0001F642\u200D\u2195", u"1F642-200D-2195-FE0F", u"1F642-200D-2195", 2144, 1, 7},
+    {u"\U0001F642", u"", u"1F642", u"", 2145, 1, 15},
+    {u"\U0001F643", u"", u"1F643", u"", 2146, 1, 15},
+    {u"\U0001F644", u"", u"1F644", u"", 2147, 1, 15},
+    {u"\U0001F645\u200D\u2640\uFE0F", u"\U0001F645\u200D\u2640", u"1F645-200D-2640-FE0F", u"1F645-200D-2640", 2148, 1, 15},
+    {u"\U0001F645\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F645\U0001F3FB\u200D\u2640", u"1F645-1F3FB-200D-2640-FE0F", u"1F645-1F3FB-200D-2640", 2149, 1, 15},
+    {u"\U0001F645\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F645\U0001F3FC\u200D\u2640", u"1F645-1F3FC-200D-2640-FE0F", u"1F645-1F3FC-200D-2640", 2150, 1, 15},
+    {u"\U0001F645\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F645\U0001F3FD\u200D\u2640", u"1F645-1F3FD-200D-2640-FE0F", u"1F645-1F3FD-200D-2640", 2151, 1, 15},
+    {u"\U0001F645\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F645\U0001F3FE\u200D\u2640", u"1F645-1F3FE-200D-2640-FE0F", u"1F645-1F3FE-200D-2640", 2152, 1, 15},
+    {u"\U0001F645\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F645\U0001F3FF\u200D\u2640", u"1F645-1F3FF-200D-2640-FE0F", u"1F645-1F3FF-200D-2640", 2153, 1, 15},
+    {u"\U0001F645\u200D\u2642\uFE0F", u"\U0001F645\u200D\u2642", u"1F645-200D-2642-FE0F", u"1F645-200D-2642", 2154, 1, 15},
+    {u"\U0001F645\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F645\U0001F3FB\u200D\u2642", u"1F645-1F3FB-200D-2642-FE0F", u"1F645-1F3FB-200D-2642", 2155, 1, 15},
+    {u"\U0001F645\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F645\U0001F3FC\u200D\u2642", u"1F645-1F3FC-200D-2642-FE0F", u"1F645-1F3FC-200D-2642", 2156, 1, 15},
+    {u"\U0001F645\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F645\U0001F3FD\u200D\u2642", u"1F645-1F3FD-200D-2642-FE0F", u"1F645-1F3FD-200D-2642", 2157, 1, 15},
+    {u"\U0001F645\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F645\U0001F3FE\u200D\u2642", u"1F645-1F3FE-200D-2642-FE0F", u"1F645-1F3FE-200D-2642", 2158, 1, 15},
+    {u"\U0001F645\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F645\U0001F3FF\u200D\u2642", u"1F645-1F3FF-200D-2642-FE0F", u"1F645-1F3FF-200D-2642", 2159, 1, 15},
+    {u"\U0001F645", u"", u"1F645", u"", 2160, 1, 15},
+    {u"\U0001F645\U0001F3FB", u"", u"1F645-1F3FB", u"", 2161, 1, 15},
+    {u"\U0001F645\U0001F3FC", u"", u"1F645-1F3FC", u"", 2162, 1, 15},
+    {u"\U0001F645\U0001F3FD", u"", u"1F645-1F3FD", u"", 2163, 1, 15},
+    {u"\U0001F645\U0001F3FE", u"", u"1F645-1F3FE", u"", 2164, 1, 15},
+    {u"\U0001F645\U0001F3FF", u"", u"1F645-1F3FF", u"", 2165, 1, 15},
+    {u"\U0001F646\u200D\u2640\uFE0F", u"\U0001F646\u200D\u2640", u"1F646-200D-2640-FE0F", u"1F646-200D-2640", 2166, 1, 15},
+    {u"\U0001F646\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F646\U0001F3FB\u200D\u2640", u"1F646-1F3FB-200D-2640-FE0F", u"1F646-1F3FB-200D-2640", 2167, 1, 15},
+    {u"\U0001F646\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F646\U0001F3FC\u200D\u2640", u"1F646-1F3FC-200D-2640-FE0F", u"1F646-1F3FC-200D-2640", 2168, 1, 15},
+    {u"\U0001F646\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F646\U0001F3FD\u200D\u2640", u"1F646-1F3FD-200D-2640-FE0F", u"1F646-1F3FD-200D-2640", 2169, 1, 15},
+    {u"\U0001F646\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F646\U0001F3FE\u200D\u2640", u"1F646-1F3FE-200D-2640-FE0F", u"1F646-1F3FE-200D-2640", 2170, 1, 15},
+    {u"\U0001F646\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F646\U0001F3FF\u200D\u2640", u"1F646-1F3FF-200D-2640-FE0F", u"1F646-1F3FF-200D-2640", 2171, 1, 15},
+    {u"\U0001F646\u200D\u2642\uFE0F", u"\U0001F646\u200D\u2642", u"1F646-200D-2642-FE0F", u"1F646-200D-2642", 2172, 1, 15},
+    {u"\U0001F646\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F646\U0001F3FB\u200D\u2642", u"1F646-1F3FB-200D-2642-FE0F", u"1F646-1F3FB-200D-2642", 2173, 1, 15},
+    {u"\U0001F646\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F646\U0001F3FC\u200D\u2642", u"1F646-1F3FC-200D-2642-FE0F", u"1F646-1F3FC-200D-2642", 2174, 1, 15},
+    {u"\U0001F646\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F646\U0001F3FD\u200D\u2642", u"1F646-1F3FD-200D-2642-FE0F", u"1F646-1F3FD-200D-2642", 2175, 1, 15},
+    {u"\U0001F646\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F646\U0001F3FE\u200D\u2642", u"1F646-1F3FE-200D-2642-FE0F", u"1F646-1F3FE-200D-2642", 2176, 1, 15},
+    {u"\U0001F646\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F646\U0001F3FF\u200D\u2642", u"1F646-1F3FF-200D-2642-FE0F", u"1F646-1F3FF-200D-2642", 2177, 1, 15},
+    {u"\U0001F646", u"", u"1F646", u"", 2178, 1, 15},
+    {u"\U0001F646\U0001F3FB", u"", u"1F646-1F3FB", u"", 2179, 1, 15},
+    {u"\U0001F646\U0001F3FC", u"", u"1F646-1F3FC", u"", 2180, 1, 15},
+    {u"\U0001F646\U0001F3FD", u"", u"1F646-1F3FD", u"", 2181, 1, 15},
+    {u"\U0001F646\U0001F3FE", u"", u"1F646-1F3FE", u"", 2182, 1, 15},
+    {u"\U0001F646\U0001F3FF", u"", u"1F646-1F3FF", u"", 2183, 1, 15},
+    {u"\U0001F647\u200D\u2640\uFE0F", u"\U0001F647\u200D\u2640", u"1F647-200D-2640-FE0F", u"1F647-200D-2640", 2184, 1, 15},
+    {u"\U0001F647\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F647\U0001F3FB\u200D\u2640", u"1F647-1F3FB-200D-2640-FE0F", u"1F647-1F3FB-200D-2640", 2185, 1, 15},
+    {u"\U0001F647\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F647\U0001F3FC\u200D\u2640", u"1F647-1F3FC-200D-2640-FE0F", u"1F647-1F3FC-200D-2640", 2186, 1, 15},
+    {u"\U0001F647\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F647\U0001F3FD\u200D\u2640", u"1F647-1F3FD-200D-2640-FE0F", u"1F647-1F3FD-200D-2640", 2187, 1, 15},
+    {u"\U0001F647\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F647\U0001F3FE\u200D\u2640", u"1F647-1F3FE-200D-2640-FE0F", u"1F647-1F3FE-200D-2640", 2188, 1, 15},
+    {u"\U0001F647\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F647\U0001F3FF\u200D\u2640", u"1F647-1F3FF-200D-2640-FE0F", u"1F647-1F3FF-200D-2640", 2189, 1, 15},
+    {u"\U0001F647\u200D\u2642\uFE0F", u"\U0001F647\u200D\u2642", u"1F647-200D-2642-FE0F", u"1F647-200D-2642", 2190, 1, 15},
+    {u"\U0001F647\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F647\U0001F3FB\u200D\u2642", u"1F647-1F3FB-200D-2642-FE0F", u"1F647-1F3FB-200D-2642", 2191, 1, 15},
+    {u"\U0001F647\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F647\U0001F3FC\u200D\u2642", u"1F647-1F3FC-200D-2642-FE0F", u"1F647-1F3FC-200D-2642", 2192, 1, 15},
+    {u"\U0001F647\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F647\U0001F3FD\u200D\u2642", u"1F647-1F3FD-200D-2642-FE0F", u"1F647-1F3FD-200D-2642", 2193, 1, 15},
+    {u"\U0001F647\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F647\U0001F3FE\u200D\u2642", u"1F647-1F3FE-200D-2642-FE0F", u"1F647-1F3FE-200D-2642", 2194, 1, 15},
+    {u"\U0001F647\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F647\U0001F3FF\u200D\u2642", u"1F647-1F3FF-200D-2642-FE0F", u"1F647-1F3FF-200D-2642", 2195, 1, 15},
+    {u"\U0001F647", u"", u"1F647", u"", 2196, 1, 15},
+    {u"\U0001F647\U0001F3FB", u"", u"1F647-1F3FB", u"", 2197, 1, 15},
+    {u"\U0001F647\U0001F3FC", u"", u"1F647-1F3FC", u"", 2198, 1, 15},
+    {u"\U0001F647\U0001F3FD", u"", u"1F647-1F3FD", u"", 2199, 1, 15},
+    {u"\U0001F647\U0001F3FE", u"", u"1F647-1F3FE", u"", 2200, 1, 15},
+    {u"\U0001F647\U0001F3FF", u"", u"1F647-1F3FF", u"", 2201, 1, 15},
+    {u"\U0001F648", u"", u"1F648", u"", 2202, 1, 15},
+    {u"\U0001F649", u"", u"1F649", u"", 2203, 1, 15},
+    {u"\U0001F64A", u"", u"1F64A", u"", 2204, 1, 15},
+    {u"\U0001F64B\u200D\u2640\uFE0F", u"\U0001F64B\u200D\u2640", u"1F64B-200D-2640-FE0F", u"1F64B-200D-2640", 2205, 1, 15},
+    {u"\U0001F64B\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F64B\U0001F3FB\u200D\u2640", u"1F64B-1F3FB-200D-2640-FE0F", u"1F64B-1F3FB-200D-2640", 2206, 1, 15},
+    {u"\U0001F64B\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F64B\U0001F3FC\u200D\u2640", u"1F64B-1F3FC-200D-2640-FE0F", u"1F64B-1F3FC-200D-2640", 2207, 1, 15},
+    {u"\U0001F64B\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F64B\U0001F3FD\u200D\u2640", u"1F64B-1F3FD-200D-2640-FE0F", u"1F64B-1F3FD-200D-2640", 2208, 1, 15},
+    {u"\U0001F64B\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F64B\U0001F3FE\u200D\u2640", u"1F64B-1F3FE-200D-2640-FE0F", u"1F64B-1F3FE-200D-2640", 2209, 1, 15},
+    {u"\U0001F64B\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F64B\U0001F3FF\u200D\u2640", u"1F64B-1F3FF-200D-2640-FE0F", u"1F64B-1F3FF-200D-2640", 2210, 1, 15},
+    {u"\U0001F64B\u200D\u2642\uFE0F", u"\U0001F64B\u200D\u2642", u"1F64B-200D-2642-FE0F", u"1F64B-200D-2642", 2211, 1, 15},
+    {u"\U0001F64B\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F64B\U0001F3FB\u200D\u2642", u"1F64B-1F3FB-200D-2642-FE0F", u"1F64B-1F3FB-200D-2642", 2212, 1, 15},
+    {u"\U0001F64B\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F64B\U0001F3FC\u200D\u2642", u"1F64B-1F3FC-200D-2642-FE0F", u"1F64B-1F3FC-200D-2642", 2213, 1, 15},
+    {u"\U0001F64B\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F64B\U0001F3FD\u200D\u2642", u"1F64B-1F3FD-200D-2642-FE0F", u"1F64B-1F3FD-200D-2642", 2214, 1, 15},
+    {u"\U0001F64B\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F64B\U0001F3FE\u200D\u2642", u"1F64B-1F3FE-200D-2642-FE0F", u"1F64B-1F3FE-200D-2642", 2215, 1, 15},
+    {u"\U0001F64B\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F64B\U0001F3FF\u200D\u2642", u"1F64B-1F3FF-200D-2642-FE0F", u"1F64B-1F3FF-200D-2642", 2216, 1, 15},
+    {u"\U0001F64B", u"", u"1F64B", u"", 2217, 1, 15},
+    {u"\U0001F64B\U0001F3FB", u"", u"1F64B-1F3FB", u"", 2218, 1, 15},
+    {u"\U0001F64B\U0001F3FC", u"", u"1F64B-1F3FC", u"", 2219, 1, 15},
+    {u"\U0001F64B\U0001F3FD", u"", u"1F64B-1F3FD", u"", 2220, 1, 15},
+    {u"\U0001F64B\U0001F3FE", u"", u"1F64B-1F3FE", u"", 2221, 1, 15},
+    {u"\U0001F64B\U0001F3FF", u"", u"1F64B-1F3FF", u"", 2222, 1, 15},
+    {u"\U0001F64C", u"", u"1F64C", u"", 2223, 1, 15},
+    {u"\U0001F64C\U0001F3FB", u"", u"1F64C-1F3FB", u"", 2224, 1, 15},
+    {u"\U0001F64C\U0001F3FC", u"", u"1F64C-1F3FC", u"", 2225, 1, 15},
+    {u"\U0001F64C\U0001F3FD", u"", u"1F64C-1F3FD", u"", 2226, 1, 15},
+    {u"\U0001F64C\U0001F3FE", u"", u"1F64C-1F3FE", u"", 2227, 1, 15},
+    {u"\U0001F64C\U0001F3FF", u"", u"1F64C-1F3FF", u"", 2228, 1, 15},
+    {u"\U0001F64D\u200D\u2640\uFE0F", u"\U0001F64D\u200D\u2640", u"1F64D-200D-2640-FE0F", u"1F64D-200D-2640", 2229, 1, 15},
+    {u"\U0001F64D\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F64D\U0001F3FB\u200D\u2640", u"1F64D-1F3FB-200D-2640-FE0F", u"1F64D-1F3FB-200D-2640", 2230, 1, 15},
+    {u"\U0001F64D\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F64D\U0001F3FC\u200D\u2640", u"1F64D-1F3FC-200D-2640-FE0F", u"1F64D-1F3FC-200D-2640", 2231, 1, 15},
+    {u"\U0001F64D\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F64D\U0001F3FD\u200D\u2640", u"1F64D-1F3FD-200D-2640-FE0F", u"1F64D-1F3FD-200D-2640", 2232, 1, 15},
+    {u"\U0001F64D\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F64D\U0001F3FE\u200D\u2640", u"1F64D-1F3FE-200D-2640-FE0F", u"1F64D-1F3FE-200D-2640", 2233, 1, 15},
+    {u"\U0001F64D\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F64D\U0001F3FF\u200D\u2640", u"1F64D-1F3FF-200D-2640-FE0F", u"1F64D-1F3FF-200D-2640", 2234, 1, 15},
+    {u"\U0001F64D\u200D\u2642\uFE0F", u"\U0001F64D\u200D\u2642", u"1F64D-200D-2642-FE0F", u"1F64D-200D-2642", 2235, 1, 15},
+    {u"\U0001F64D\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F64D\U0001F3FB\u200D\u2642", u"1F64D-1F3FB-200D-2642-FE0F", u"1F64D-1F3FB-200D-2642", 2236, 1, 15},
+    {u"\U0001F64D\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F64D\U0001F3FC\u200D\u2642", u"1F64D-1F3FC-200D-2642-FE0F", u"1F64D-1F3FC-200D-2642", 2237, 1, 15},
+    {u"\U0001F64D\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F64D\U0001F3FD\u200D\u2642", u"1F64D-1F3FD-200D-2642-FE0F", u"1F64D-1F3FD-200D-2642", 2238, 1, 15},
+    {u"\U0001F64D\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F64D\U0001F3FE\u200D\u2642", u"1F64D-1F3FE-200D-2642-FE0F", u"1F64D-1F3FE-200D-2642", 2239, 1, 15},
+    {u"\U0001F64D\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F64D\U0001F3FF\u200D\u2642", u"1F64D-1F3FF-200D-2642-FE0F", u"1F64D-1F3FF-200D-2642", 2240, 1, 15},
+    {u"\U0001F64D", u"", u"1F64D", u"", 2241, 1, 15},
+    {u"\U0001F64D\U0001F3FB", u"", u"1F64D-1F3FB", u"", 2242, 1, 15},
+    {u"\U0001F64D\U0001F3FC", u"", u"1F64D-1F3FC", u"", 2243, 1, 15},
+    {u"\U0001F64D\U0001F3FD", u"", u"1F64D-1F3FD", u"", 2244, 1, 15},
+    {u"\U0001F64D\U0001F3FE", u"", u"1F64D-1F3FE", u"", 2245, 1, 15},
+    {u"\U0001F64D\U0001F3FF", u"", u"1F64D-1F3FF", u"", 2246, 1, 15},
+    {u"\U0001F64E\u200D\u2640\uFE0F", u"\U0001F64E\u200D\u2640", u"1F64E-200D-2640-FE0F", u"1F64E-200D-2640", 2247, 1, 15},
+    {u"\U0001F64E\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F64E\U0001F3FB\u200D\u2640", u"1F64E-1F3FB-200D-2640-FE0F", u"1F64E-1F3FB-200D-2640", 2248, 1, 15},
+    {u"\U0001F64E\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F64E\U0001F3FC\u200D\u2640", u"1F64E-1F3FC-200D-2640-FE0F", u"1F64E-1F3FC-200D-2640", 2249, 1, 15},
+    {u"\U0001F64E\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F64E\U0001F3FD\u200D\u2640", u"1F64E-1F3FD-200D-2640-FE0F", u"1F64E-1F3FD-200D-2640", 2250, 1, 15},
+    {u"\U0001F64E\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F64E\U0001F3FE\u200D\u2640", u"1F64E-1F3FE-200D-2640-FE0F", u"1F64E-1F3FE-200D-2640", 2251, 1, 15},
+    {u"\U0001F64E\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F64E\U0001F3FF\u200D\u2640", u"1F64E-1F3FF-200D-2640-FE0F", u"1F64E-1F3FF-200D-2640", 2252, 1, 15},
+    {u"\U0001F64E\u200D\u2642\uFE0F", u"\U0001F64E\u200D\u2642", u"1F64E-200D-2642-FE0F", u"1F64E-200D-2642", 2253, 1, 15},
+    {u"\U0001F64E\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F64E\U0001F3FB\u200D\u2642", u"1F64E-1F3FB-200D-2642-FE0F", u"1F64E-1F3FB-200D-2642", 2254, 1, 15},
+    {u"\U0001F64E\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F64E\U0001F3FC\u200D\u2642", u"1F64E-1F3FC-200D-2642-FE0F", u"1F64E-1F3FC-200D-2642", 2255, 1, 15},
+    {u"\U0001F64E\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F64E\U0001F3FD\u200D\u2642", u"1F64E-1F3FD-200D-2642-FE0F", u"1F64E-1F3FD-200D-2642", 2256, 1, 15},
+    {u"\U0001F64E\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F64E\U0001F3FE\u200D\u2642", u"1F64E-1F3FE-200D-2642-FE0F", u"1F64E-1F3FE-200D-2642", 2257, 1, 15},
+    {u"\U0001F64E\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F64E\U0001F3FF\u200D\u2642", u"1F64E-1F3FF-200D-2642-FE0F", u"1F64E-1F3FF-200D-2642", 2258, 1, 15},
+    {u"\U0001F64E", u"", u"1F64E", u"", 2259, 1, 15},
+    {u"\U0001F64E\U0001F3FB", u"", u"1F64E-1F3FB", u"", 2260, 1, 15},
+    {u"\U0001F64E\U0001F3FC", u"", u"1F64E-1F3FC", u"", 2261, 1, 15},
+    {u"\U0001F64E\U0001F3FD", u"", u"1F64E-1F3FD", u"", 2262, 1, 15},
+    {u"\U0001F64E\U0001F3FE", u"", u"1F64E-1F3FE", u"", 2263, 1, 15},
+    {u"\U0001F64E\U0001F3FF", u"", u"1F64E-1F3FF", u"", 2264, 1, 15},
+    {u"\U0001F64F", u"", u"1F64F", u"", 2265, 1, 15},
+    {u"\U0001F64F\U0001F3FB", u"", u"1F64F-1F3FB", u"", 2266, 1, 15},
+    {u"\U0001F64F\U0001F3FC", u"", u"1F64F-1F3FC", u"", 2267, 1, 15},
+    {u"\U0001F64F\U0001F3FD", u"", u"1F64F-1F3FD", u"", 2268, 1, 15},
+    {u"\U0001F64F\U0001F3FE", u"", u"1F64F-1F3FE", u"", 2269, 1, 15},
+    {u"\U0001F64F\U0001F3FF", u"", u"1F64F-1F3FF", u"", 2270, 1, 15},
+    {u"\U0001F680", u"", u"1F680", u"", 2271, 1, 15},
+    {u"\U0001F681", u"", u"1F681", u"", 2272, 1, 15},
+    {u"\U0001F682", u"", u"1F682", u"", 2273, 1, 15},
+    {u"\U0001F683", u"", u"1F683", u"", 2274, 1, 15},
+    {u"\U0001F684", u"", u"1F684", u"", 2275, 1, 15},
+    {u"\U0001F685", u"", u"1F685", u"", 2276, 1, 15},
+    {u"\U0001F686", u"", u"1F686", u"", 2277, 1, 15},
+    {u"\U0001F687", u"", u"1F687", u"", 2278, 1, 15},
+    {u"\U0001F688", u"", u"1F688", u"", 2279, 1, 15},
+    {u"\U0001F689", u"", u"1F689", u"", 2280, 1, 15},
+    {u"\U0001F68A", u"", u"1F68A", u"", 2281, 1, 15},
+    {u"\U0001F68B", u"", u"1F68B", u"", 2282, 1, 15},
+    {u"\U0001F68C", u"", u"1F68C", u"", 2283, 1, 15},
+    {u"\U0001F68D", u"", u"1F68D", u"", 2284, 1, 15},
+    {u"\U0001F68E", u"", u"1F68E", u"", 2285, 1, 15},
+    {u"\U0001F68F", u"", u"1F68F", u"", 2286, 1, 15},
+    {u"\U0001F690", u"", u"1F690", u"", 2287, 1, 15},
+    {u"\U0001F691", u"", u"1F691", u"", 2288, 1, 15},
+    {u"\U0001F692", u"", u"1F692", u"", 2289, 1, 15},
+    {u"\U0001F693", u"", u"1F693", u"", 2290, 1, 15},
+    {u"\U0001F694", u"", u"1F694", u"", 2291, 1, 15},
+    {u"\U0001F695", u"", u"1F695", u"", 2292, 1, 15},
+    {u"\U0001F696", u"", u"1F696", u"", 2293, 1, 15},
+    {u"\U0001F697", u"", u"1F697", u"", 2294, 2, 15},
+    {u"\U0001F698", u"", u"1F698", u"", 2296, 1, 15},
+    {u"\U0001F699", u"", u"1F699", u"", 2297, 1, 15},
+    {u"\U0001F69A", u"", u"1F69A", u"", 2298, 1, 15},
+    {u"\U0001F69B", u"", u"1F69B", u"", 2299, 1, 15},
+    {u"\U0001F69C", u"", u"1F69C", u"", 2300, 1, 15},
+    {u"\U0001F69D", u"", u"1F69D", u"", 2301, 1, 15},
+    {u"\U0001F69E", u"", u"1F69E", u"", 2302, 1, 15},
+    {u"\U0001F69F", u"", u"1F69F", u"", 2303, 1, 15},
+    {u"\U0001F6A0", u"", u"1F6A0", u"", 2304, 1, 15},
+    {u"\U0001F6A1", u"", u"1F6A1", u"", 2305, 1, 15},
+    {u"\U0001F6A2", u"", u"1F6A2", u"", 2306, 1, 15},
+    {u"\U0001F6A3\u200D\u2640\uFE0F", u"\U0001F6A3\u200D\u2640", u"1F6A3-200D-2640-FE0F", u"1F6A3-200D-2640", 2307, 1, 15},
+    {u"\U0001F6A3\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F6A3\U0001F3FB\u200D\u2640", u"1F6A3-1F3FB-200D-2640-FE0F", u"1F6A3-1F3FB-200D-2640", 2308, 1, 15},
+    {u"\U0001F6A3\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F6A3\U0001F3FC\u200D\u2640", u"1F6A3-1F3FC-200D-2640-FE0F", u"1F6A3-1F3FC-200D-2640", 2309, 1, 15},
+    {u"\U0001F6A3\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F6A3\U0001F3FD\u200D\u2640", u"1F6A3-1F3FD-200D-2640-FE0F", u"1F6A3-1F3FD-200D-2640", 2310, 1, 15},
+    {u"\U0001F6A3\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F6A3\U0001F3FE\u200D\u2640", u"1F6A3-1F3FE-200D-2640-FE0F", u"1F6A3-1F3FE-200D-2640", 2311, 1, 15},
+    {u"\U0001F6A3\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F6A3\U0001F3FF\u200D\u2640", u"1F6A3-1F3FF-200D-2640-FE0F", u"1F6A3-1F3FF-200D-2640", 2312, 1, 15},
+    {u"\U0001F6A3\u200D\u2642\uFE0F", u"\U0001F6A3\u200D\u2642", u"1F6A3-200D-2642-FE0F", u"1F6A3-200D-2642", 2313, 1, 15},
+    {u"\U0001F6A3\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F6A3\U0001F3FB\u200D\u2642", u"1F6A3-1F3FB-200D-2642-FE0F", u"1F6A3-1F3FB-200D-2642", 2314, 1, 15},
+    {u"\U0001F6A3\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F6A3\U0001F3FC\u200D\u2642", u"1F6A3-1F3FC-200D-2642-FE0F", u"1F6A3-1F3FC-200D-2642", 2315, 1, 15},
+    {u"\U0001F6A3\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F6A3\U0001F3FD\u200D\u2642", u"1F6A3-1F3FD-200D-2642-FE0F", u"1F6A3-1F3FD-200D-2642", 2316, 1, 15},
+    {u"\U0001F6A3\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F6A3\U0001F3FE\u200D\u2642", u"1F6A3-1F3FE-200D-2642-FE0F", u"1F6A3-1F3FE-200D-2642", 2317, 1, 15},
+    {u"\U0001F6A3\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F6A3\U0001F3FF\u200D\u2642", u"1F6A3-1F3FF-200D-2642-FE0F", u"1F6A3-1F3FF-200D-2642", 2318, 1, 15},
+    {u"\U0001F6A3", u"", u"1F6A3", u"", 2319, 1, 15},
+    {u"\U0001F6A3\U0001F3FB", u"", u"1F6A3-1F3FB", u"", 2320, 1, 15},
+    {u"\U0001F6A3\U0001F3FC", u"", u"1F6A3-1F3FC", u"", 2321, 1, 15},
+    {u"\U0001F6A3\U0001F3FD", u"", u"1F6A3-1F3FD", u"", 2322, 1, 15},
+    {u"\U0001F6A3\U0001F3FE", u"", u"1F6A3-1F3FE", u"", 2323, 1, 15},
+    {u"\U0001F6A3\U0001F3FF", u"", u"1F6A3-1F3FF", u"", 2324, 1, 15},
+    {u"\U0001F6A4", u"", u"1F6A4", u"", 2325, 1, 15},
+    {u"\U0001F6A5", u"", u"1F6A5", u"", 2326, 1, 15},
+    {u"\U0001F6A6", u"", u"1F6A6", u"", 2327, 1, 15},
+    {u"\U0001F6A7", u"", u"1F6A7", u"", 2328, 1, 15},
+    {u"\U0001F6A8", u"", u"1F6A8", u"", 2329, 1, 15},
+    {u"\U0001F6A9", u"", u"1F6A9", u"", 2330, 1, 15},
+    {u"\U0001F6AA", u"", u"1F6AA", u"", 2331, 1, 15},
+    {u"\U0001F6AB", u"", u"1F6AB", u"", 2332, 1, 15},
+    {u"\U0001F6AC", u"", u"1F6AC", u"", 2333, 1, 15},
+    {u"\U0001F6AD", u"", u"1F6AD", u"", 2334, 1, 15},
+    {u"\U0001F6AE", u"", u"1F6AE", u"", 2335, 1, 15},
+    {u"\U0001F6AF", u"", u"1F6AF", u"", 2336, 1, 15},
+    {u"\U0001F6B0", u"", u"1F6B0", u"", 2337, 1, 15},
+    {u"\U0001F6B1", u"", u"1F6B1", u"", 2338, 1, 15},
+    {u"\U0001F6B2", u"", u"1F6B2", u"", 2339, 1, 15},
+    {u"\U0001F6B3", u"", u"1F6B3", u"", 2340, 1, 15},
+    {u"\U0001F6B4\u200D\u2640\uFE0F", u"\U0001F6B4\u200D\u2640", u"1F6B4-200D-2640-FE0F", u"1F6B4-200D-2640", 2341, 1, 15},
+    {u"\U0001F6B4\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F6B4\U0001F3FB\u200D\u2640", u"1F6B4-1F3FB-200D-2640-FE0F", u"1F6B4-1F3FB-200D-2640", 2342, 1, 15},
+    {u"\U0001F6B4\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F6B4\U0001F3FC\u200D\u2640", u"1F6B4-1F3FC-200D-2640-FE0F", u"1F6B4-1F3FC-200D-2640", 2343, 1, 15},
+    {u"\U0001F6B4\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F6B4\U0001F3FD\u200D\u2640", u"1F6B4-1F3FD-200D-2640-FE0F", u"1F6B4-1F3FD-200D-2640", 2344, 1, 15},
+    {u"\U0001F6B4\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F6B4\U0001F3FE\u200D\u2640", u"1F6B4-1F3FE-200D-2640-FE0F", u"1F6B4-1F3FE-200D-2640", 2345, 1, 15},
+    {u"\U0001F6B4\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F6B4\U0001F3FF\u200D\u2640", u"1F6B4-1F3FF-200D-2640-FE0F", u"1F6B4-1F3FF-200D-2640", 2346, 1, 15},
+    {u"\U0001F6B4\u200D\u2642\uFE0F", u"\U0001F6B4\u200D\u2642", u"1F6B4-200D-2642-FE0F", u"1F6B4-200D-2642", 2347, 1, 15},
+    {u"\U0001F6B4\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F6B4\U0001F3FB\u200D\u2642", u"1F6B4-1F3FB-200D-2642-FE0F", u"1F6B4-1F3FB-200D-2642", 2348, 1, 15},
+    {u"\U0001F6B4\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F6B4\U0001F3FC\u200D\u2642", u"1F6B4-1F3FC-200D-2642-FE0F", u"1F6B4-1F3FC-200D-2642", 2349, 1, 15},
+    {u"\U0001F6B4\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F6B4\U0001F3FD\u200D\u2642", u"1F6B4-1F3FD-200D-2642-FE0F", u"1F6B4-1F3FD-200D-2642", 2350, 1, 15},
+    {u"\U0001F6B4\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F6B4\U0001F3FE\u200D\u2642", u"1F6B4-1F3FE-200D-2642-FE0F", u"1F6B4-1F3FE-200D-2642", 2351, 1, 15},
+    {u"\U0001F6B4\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F6B4\U0001F3FF\u200D\u2642", u"1F6B4-1F3FF-200D-2642-FE0F", u"1F6B4-1F3FF-200D-2642", 2352, 1, 15},
+    {u"\U0001F6B4", u"", u"1F6B4", u"", 2353, 1, 15},
+    {u"\U0001F6B4\U0001F3FB", u"", u"1F6B4-1F3FB", u"", 2354, 1, 15},
+    {u"\U0001F6B4\U0001F3FC", u"", u"1F6B4-1F3FC", u"", 2355, 1, 15},
+    {u"\U0001F6B4\U0001F3FD", u"", u"1F6B4-1F3FD", u"", 2356, 1, 15},
+    {u"\U0001F6B4\U0001F3FE", u"", u"1F6B4-1F3FE", u"", 2357, 1, 15},
+    {u"\U0001F6B4\U0001F3FF", u"", u"1F6B4-1F3FF", u"", 2358, 1, 15},
+    {u"\U0001F6B5\u200D\u2640\uFE0F", u"\U0001F6B5\u200D\u2640", u"1F6B5-200D-2640-FE0F", u"1F6B5-200D-2640", 2359, 1, 15},
+    {u"\U0001F6B5\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F6B5\U0001F3FB\u200D\u2640", u"1F6B5-1F3FB-200D-2640-FE0F", u"1F6B5-1F3FB-200D-2640", 2360, 1, 15},
+    {u"\U0001F6B5\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F6B5\U0001F3FC\u200D\u2640", u"1F6B5-1F3FC-200D-2640-FE0F", u"1F6B5-1F3FC-200D-2640", 2361, 1, 15},
+    {u"\U0001F6B5\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F6B5\U0001F3FD\u200D\u2640", u"1F6B5-1F3FD-200D-2640-FE0F", u"1F6B5-1F3FD-200D-2640", 2362, 1, 15},
+    {u"\U0001F6B5\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F6B5\U0001F3FE\u200D\u2640", u"1F6B5-1F3FE-200D-2640-FE0F", u"1F6B5-1F3FE-200D-2640", 2363, 1, 15},
+    {u"\U0001F6B5\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F6B5\U0001F3FF\u200D\u2640", u"1F6B5-1F3FF-200D-2640-FE0F", u"1F6B5-1F3FF-200D-2640", 2364, 1, 15},
+    {u"\U0001F6B5\u200D\u2642\uFE0F", u"\U0001F6B5\u200D\u2642", u"1F6B5-200D-2642-FE0F", u"1F6B5-200D-2642", 2365, 1, 15},
+    {u"\U0001F6B5\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F6B5\U0001F3FB\u200D\u2642", u"1F6B5-1F3FB-200D-2642-FE0F", u"1F6B5-1F3FB-200D-2642", 2366, 1, 15},
+    {u"\U0001F6B5\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F6B5\U0001F3FC\u200D\u2642", u"1F6B5-1F3FC-200D-2642-FE0F", u"1F6B5-1F3FC-200D-2642", 2367, 1, 15},
+    {u"\U0001F6B5\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F6B5\U0001F3FD\u200D\u2642", u"1F6B5-1F3FD-200D-2642-FE0F", u"1F6B5-1F3FD-200D-2642", 2368, 1, 15},
+    {u"\U0001F6B5\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F6B5\U0001F3FE\u200D\u2642", u"1F6B5-1F3FE-200D-2642-FE0F", u"1F6B5-1F3FE-200D-2642", 2369, 1, 15},
+    {u"\U0001F6B5\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F6B5\U0001F3FF\u200D\u2642", u"1F6B5-1F3FF-200D-2642-FE0F", u"1F6B5-1F3FF-200D-2642", 2370, 1, 15},
+    {u"\U0001F6B5", u"", u"1F6B5", u"", 2371, 1, 15},
+    {u"\U0001F6B5\U0001F3FB", u"", u"1F6B5-1F3FB", u"", 2372, 1, 15},
+    {u"\U0001F6B5\U0001F3FC", u"", u"1F6B5-1F3FC", u"", 2373, 1, 15},
+    {u"\U0001F6B5\U0001F3FD", u"", u"1F6B5-1F3FD", u"", 2374, 1, 15},
+    {u"\U0001F6B5\U0001F3FE", u"", u"1F6B5-1F3FE", u"", 2375, 1, 15},
+    {u"\U0001F6B5\U0001F3FF", u"", u"1F6B5-1F3FF", u"", 2376, 1, 15},
+    {u"\U0001F6B6\u200D\u2640\uFE0F", u"\U0001F6B6\u200D\u2640", u"1F6B6-200D-2640-FE0F", u"1F6B6-200D-2640", 2377, 1, 15},
+    {u"\U0001F6B6\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F6B6\U0001F3FB\u200D\u2640", u"1F6B6-1F3FB-200D-2640-FE0F", u"1F6B6-1F3FB-200D-2640", 2378, 1, 15},
+    {u"\U0001F6B6\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F6B6\U0001F3FC\u200D\u2640", u"1F6B6-1F3FC-200D-2640-FE0F", u"1F6B6-1F3FC-200D-2640", 2379, 1, 15},
+    {u"\U0001F6B6\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F6B6\U0001F3FD\u200D\u2640", u"1F6B6-1F3FD-200D-2640-FE0F", u"1F6B6-1F3FD-200D-2640", 2380, 1, 15},
+    {u"\U0001F6B6\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F6B6\U0001F3FE\u200D\u2640", u"1F6B6-1F3FE-200D-2640-FE0F", u"1F6B6-1F3FE-200D-2640", 2381, 1, 15},
+    {u"\U0001F6B6\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F6B6\U0001F3FF\u200D\u2640", u"1F6B6-1F3FF-200D-2640-FE0F", u"1F6B6-1F3FF-200D-2640", 2382, 1, 15},
+    {u"\U0001F6B6\u200D\u2640\uFE0F\u200D\u27A1\uFE0F", u"\U0001F6B6\u200D\u2640\u200D\u27A1", u"1F6B6-200D-2640-FE0F-200D-27A1-FE0F", u"1F6B6-200D-2640-200D-27A1", 2383, 1, 7},
+    {u"\U0001F6B6\U0001F3FB\u200D\u2640\uFE0F\u200D\u27A1\uFE0F", u"\U0001F6B6\U0001F3FB\u200D\u2640\u200D\u27A1", u"1F6B6-1F3FB-200D-2640-FE0F-200D-27A1-FE0F", u"1F6B6-1F3FB-200D-2640-200D-27A1", 2384, 1, 7},
+    {u"\U0001F6B6\U0001F3FC\u200D\u2640\uFE0F\u200D\u27A1\uFE0F", u"\U0001F6B6\U0001F3FC\u200D\u2640\u200D\u27A1", u"1F6B6-1F3FC-200D-2640-FE0F-200D-27A1-FE0F", u"1F6B6-1F3FC-200D-2640-200D-27A1", 2385, 1, 7},
+    {u"\U0001F6B6\U0001F3FD\u200D\u2640\uFE0F\u200D\u27A1\uFE0F", u"\U0001F6B6\U0001F3FD\u200D\u2640\u200D\u27A1", u"1F6B6-1F3FD-200D-2640-FE0F-200D-27A1-FE0F", u"1F6B6-1F3FD-200D-2640-200D-27A1", 2386, 1, 7},
+    {u"\U0001F6B6\U0001F3FE\u200D\u2640\uFE0F\u200D\u27A1\uFE0F", u"\U0001F6B6\U0001F3FE\u200D\u2640\u200D\u27A1", u"1F6B6-1F3FE-200D-2640-FE0F-200D-27A1-FE0F", u"1F6B6-1F3FE-200D-2640-200D-27A1", 2387, 1, 7},
+    {u"\U0001F6B6\U0001F3FF\u200D\u2640\uFE0F\u200D\u27A1\uFE0F", u"\U0001F6B6\U0001F3FF\u200D\u2640\u200D\u27A1", u"1F6B6-1F3FF-200D-2640-FE0F-200D-27A1-FE0F", u"1F6B6-1F3FF-200D-2640-200D-27A1", 2388, 1, 7},
+    {u"\U0001F6B6\u200D\u2642\uFE0F", u"\U0001F6B6\u200D\u2642", u"1F6B6-200D-2642-FE0F", u"1F6B6-200D-2642", 2389, 1, 15},
+    {u"\U0001F6B6\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F6B6\U0001F3FB\u200D\u2642", u"1F6B6-1F3FB-200D-2642-FE0F", u"1F6B6-1F3FB-200D-2642", 2390, 1, 15},
+    {u"\U0001F6B6\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F6B6\U0001F3FC\u200D\u2642", u"1F6B6-1F3FC-200D-2642-FE0F", u"1F6B6-1F3FC-200D-2642", 2391, 1, 15},
+    {u"\U0001F6B6\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F6B6\U0001F3FD\u200D\u2642", u"1F6B6-1F3FD-200D-2642-FE0F", u"1F6B6-1F3FD-200D-2642", 2392, 1, 15},
+    {u"\U0001F6B6\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F6B6\U0001F3FE\u200D\u2642", u"1F6B6-1F3FE-200D-2642-FE0F", u"1F6B6-1F3FE-200D-2642", 2393, 1, 15},
+    {u"\U0001F6B6\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F6B6\U0001F3FF\u200D\u2642", u"1F6B6-1F3FF-200D-2642-FE0F", u"1F6B6-1F3FF-200D-2642", 2394, 1, 15},
+    {u"\U0001F6B6\u200D\u2642\uFE0F\u200D\u27A1\uFE0F", u"\U0001F6B6\u200D\u2642\u200D\u27A1", u"1F6B6-200D-2642-FE0F-200D-27A1-FE0F", u"1F6B6-200D-2642-200D-27A1", 2395, 1, 7},
+    {u"\U0001F6B6\U0001F3FB\u200D\u2642\uFE0F\u200D\u27A1\uFE0F", u"\U0001F6B6\U0001F3FB\u200D\u2642\u200D\u27A1", u"1F6B6-1F3FB-200D-2642-FE0F-200D-27A1-FE0F", u"1F6B6-1F3FB-200D-2642-200D-27A1", 2396, 1, 7},
+    {u"\U0001F6B6\U0001F3FC\u200D\u2642\uFE0F\u200D\u27A1\uFE0F", u"\U0001F6B6\U0001F3FC\u200D\u2642\u200D\u27A1", u"1F6B6-1F3FC-200D-2642-FE0F-200D-27A1-FE0F", u"1F6B6-1F3FC-200D-2642-200D-27A1", 2397, 1, 7},
+    {u"\U0001F6B6\U0001F3FD\u200D\u2642\uFE0F\u200D\u27A1\uFE0F", u"\U0001F6B6\U0001F3FD\u200D\u2642\u200D\u27A1", u"1F6B6-1F3FD-200D-2642-FE0F-200D-27A1-FE0F", u"1F6B6-1F3FD-200D-2642-200D-27A1", 2398, 1, 7},
+    {u"\U0001F6B6\U0001F3FE\u200D\u2642\uFE0F\u200D\u27A1\uFE0F", u"\U0001F6B6\U0001F3FE\u200D\u2642\u200D\u27A1", u"1F6B6-1F3FE-200D-2642-FE0F-200D-27A1-FE0F", u"1F6B6-1F3FE-200D-2642-200D-27A1", 2399, 1, 7},
+    {u"\U0001F6B6\U0001F3FF\u200D\u2642\uFE0F\u200D\u27A1\uFE0F", u"\U0001F6B6\U0001F3FF\u200D\u2642\u200D\u27A1", u"1F6B6-1F3FF-200D-2642-FE0F-200D-27A1-FE0F", u"1F6B6-1F3FF-200D-2642-200D-27A1", 2400, 1, 7},
+    {u"\U0001F6B6\u200D\u27A1\uFE0F", u"\U0001F6B6\u200D\u27A1", u"1F6B6-200D-27A1-FE0F", u"1F6B6-200D-27A1", 2401, 1, 7},
+    {u"\U0001F6B6\U0001F3FB\u200D\u27A1\uFE0F", u"\U0001F6B6\U0001F3FB\u200D\u27A1", u"1F6B6-1F3FB-200D-27A1-FE0F", u"1F6B6-1F3FB-200D-27A1", 2402, 1, 7},
+    {u"\U0001F6B6\U0001F3FC\u200D\u27A1\uFE0F", u"\U0001F6B6\U0001F3FC\u200D\u27A1", u"1F6B6-1F3FC-200D-27A1-FE0F", u"1F6B6-1F3FC-200D-27A1", 2403, 1, 7},
+    {u"\U0001F6B6\U0001F3FD\u200D\u27A1\uFE0F", u"\U0001F6B6\U0001F3FD\u200D\u27A1", u"1F6B6-1F3FD-200D-27A1-FE0F", u"1F6B6-1F3FD-200D-27A1", 2404, 1, 7},
+    {u"\U0001F6B6\U0001F3FE\u200D\u27A1\uFE0F", u"\U0001F6B6\U0001F3FE\u200D\u27A1", u"1F6B6-1F3FE-200D-27A1-FE0F", u"1F6B6-1F3FE-200D-27A1", 2405, 1, 7},
+    {u"\U0001F6B6\U0001F3FF\u200D\u27A1\uFE0F", u"\U0001F6B6\U0001F3FF\u200D\u27A1", u"1F6B6-1F3FF-200D-27A1-FE0F", u"1F6B6-1F3FF-200D-27A1", 2406, 1, 7},
+    {u"\U0001F6B6", u"", u"1F6B6", u"", 2407, 1, 15},
+    {u"\U0001F6B6\U0001F3FB", u"", u"1F6B6-1F3FB", u"", 2408, 1, 15},
+    {u"\U0001F6B6\U0001F3FC", u"", u"1F6B6-1F3FC", u"", 2409, 1, 15},
+    {u"\U0001F6B6\U0001F3FD", u"", u"1F6B6-1F3FD", u"", 2410, 1, 15},
+    {u"\U0001F6B6\U0001F3FE", u"", u"1F6B6-1F3FE", u"", 2411, 1, 15},
+    {u"\U0001F6B6\U0001F3FF", u"", u"1F6B6-1F3FF", u"", 2412, 1, 15},
+    {u"\U0001F6B7", u"", u"1F6B7", u"", 2413, 1, 15},
+    {u"\U0001F6B8", u"", u"1F6B8", u"", 2414, 1, 15},
+    {u"\U0001F6B9", u"", u"1F6B9", u"", 2415, 1, 15},
+    {u"\U0001F6BA", u"", u"1F6BA", u"", 2416, 1, 15},
+    {u"\U0001F6BB", u"", u"1F6BB", u"", 2417, 1, 15},
+    {u"\U0001F6BC", u"", u"1F6BC", u"", 2418, 1, 15},
+    {u"\U0001F6BD", u"", u"1F6BD", u"", 2419, 1, 15},
+    {u"\U0001F6BE", u"", u"1F6BE", u"", 2420, 1, 15},
+    {u"\U0001F6BF", u"", u"1F6BF", u"", 2421, 1, 15},
+    {u"\U0001F6C0", u"", u"1F6C0", u"", 2422, 1, 15},
+    {u"\U0001F6C0\U0001F3FB", u"", u"1F6C0-1F3FB", u"", 2423, 1, 15},
+    {u"\U0001F6C0\U0001F3FC", u"", u"1F6C0-1F3FC", u"", 2424, 1, 15},
+    {u"\U0001F6C0\U0001F3FD", u"", u"1F6C0-1F3FD", u"", 2425, 1, 15},
+    {u"\U0001F6C0\U0001F3FE", u"", u"1F6C0-1F3FE", u"", 2426, 1, 15},
+    {u"\U0001F6C0\U0001F3FF", u"", u"1F6C0-1F3FF", u"", 2427, 1, 15},
+    {u"\U0001F6C1", u"", u"1F6C1", u"", 2428, 1, 15},
+    {u"\U0001F6C2", u"", u"1F6C2", u"", 2429, 1, 15},
+    {u"\U0001F6C3", u"", u"1F6C3", u"", 2430, 1, 15},
+    {u"\U0001F6C4", u"", u"1F6C4", u"", 2431, 1, 15},
+    {u"\U0001F6C5", u"", u"1F6C5", u"", 2432, 1, 15},
+    {u"\U0001F6CB\uFE0F", u"\U0001F6CB", u"1F6CB-FE0F", u"1F6CB", 2433, 1, 15},
+    {u"\U0001F6CC", u"", u"1F6CC", u"", 2434, 1, 15},
+    {u"\U0001F6CC\U0001F3FB", u"", u"1F6CC-1F3FB", u"", 2435, 1, 15},
+    {u"\U0001F6CC\U0001F3FC", u"", u"1F6CC-1F3FC", u"", 2436, 1, 15},
+    {u"\U0001F6CC\U0001F3FD", u"", u"1F6CC-1F3FD", u"", 2437, 1, 15},
+    {u"\U0001F6CC\U0001F3FE", u"", u"1F6CC-1F3FE", u"", 2438, 1, 15},
+    {u"\U0001F6CC\U0001F3FF", u"", u"1F6CC-1F3FF", u"", 2439, 1, 15},
+    {u"\U0001F6CD\uFE0F", u"\U0001F6CD", u"1F6CD-FE0F", u"1F6CD", 2440, 1, 15},
+    {u"\U0001F6CE\uFE0F", u"\U0001F6CE", u"1F6CE-FE0F", u"1F6CE", 2441, 1, 15},
+    {u"\U0001F6CF\uFE0F", u"\U0001F6CF", u"1F6CF-FE0F", u"1F6CF", 2442, 1, 15},
+    {u"\U0001F6D0", u"", u"1F6D0", u"", 2443, 1, 15},
+    {u"\U0001F6D1", u"", u"1F6D1", u"", 2444, 1, 15},
+    {u"\U0001F6D2", u"", u"1F6D2", u"", 2445, 1, 15},
+    {u"\U0001F6D5", u"", u"1F6D5", u"", 2446, 1, 15},
+    {u"\U0001F6D6", u"", u"1F6D6", u"", 2447, 1, 15},
+    {u"\U0001F6D7", u"", u"1F6D7", u"", 2448, 1, 15},
+    {u"\U0001F6DC", u"", u"1F6DC", u"", 2449, 1, 15},
+    {u"\U0001F6DD", u"", u"1F6DD", u"", 2450, 1, 15},
+    {u"\U0001F6DE", u"", u"1F6DE", u"", 2451, 1, 15},
+    {u"\U0001F6DF", u"", u"1F6DF", u"", 2452, 1, 15},
+    {u"\U0001F6E0\uFE0F", u"\U0001F6E0", u"1F6E0-FE0F", u"1F6E0", 2453, 1, 15},
+    {u"\U0001F6E1\uFE0F", u"\U0001F6E1", u"1F6E1-FE0F", u"1F6E1", 2454, 1, 15},
+    {u"\U0001F6E2\uFE0F", u"\U0001F6E2", u"1F6E2-FE0F", u"1F6E2", 2455, 1, 15},
+    {u"\U0001F6E3\uFE0F", u"\U0001F6E3", u"1F6E3-FE0F", u"1F6E3", 2456, 1, 15},
+    {u"\U0001F6E4\uFE0F", u"\U0001F6E4", u"1F6E4-FE0F", u"1F6E4", 2457, 1, 15},
+    {u"\U0001F6E5\uFE0F", u"\U0001F6E5", u"1F6E5-FE0F", u"1F6E5", 2458, 1, 15},
+    {u"\U0001F6E9\uFE0F", u"\U0001F6E9", u"1F6E9-FE0F", u"1F6E9", 2459, 1, 15},
+    {u"\U0001F6EB", u"", u"1F6EB", u"", 2460, 1, 15},
+    {u"\U0001F6EC", u"", u"1F6EC", u"", 2461, 1, 15},
+    {u"\U0001F6F0\uFE0F", u"\U0001F6F0", u"1F6F0-FE0F", u"1F6F0", 2462, 1, 15},
+    {u"\U0001F6F3\uFE0F", u"\U0001F6F3", u"1F6F3-FE0F", u"1F6F3", 2463, 1, 15},
+    {u"\U0001F6F4", u"", u"1F6F4", u"", 2464, 1, 15},
+    {u"\U0001F6F5", u"", u"1F6F5", u"", 2465, 1, 15},
+    {u"\U0001F6F6", u"", u"1F6F6", u"", 2466, 1, 15},
+    {u"\U0001F6F7", u"", u"1F6F7", u"", 2467, 1, 15},
+    {u"\U0001F6F8", u"", u"1F6F8", u"", 2468, 1, 15},
+    {u"\U0001F6F9", u"", u"1F6F9", u"", 2469, 1, 15},
+    {u"\U0001F6FA", u"", u"1F6FA", u"", 2470, 1, 15},
+    {u"\U0001F6FB", u"", u"1F6FB", u"", 2471, 1, 15},
+    {u"\U0001F6FC", u"", u"1F6FC", u"", 2472, 1, 15},
+    {u"\U0001F7E0", u"", u"1F7E0", u"", 2473, 1, 15},
+    {u"\U0001F7E1", u"", u"1F7E1", u"", 2474, 1, 15},
+    {u"\U0001F7E2", u"", u"1F7E2", u"", 2475, 1, 15},
+    {u"\U0001F7E3", u"", u"1F7E3", u"", 2476, 1, 15},
+    {u"\U0001F7E4", u"", u"1F7E4", u"", 2477, 1, 15},
+    {u"\U0001F7E5", u"", u"1F7E5", u"", 2478, 1, 15},
+    {u"\U0001F7E6", u"", u"1F7E6", u"", 2479, 1, 15},
+    {u"\U0001F7E7", u"", u"1F7E7", u"", 2480, 1, 15},
+    {u"\U0001F7E8", u"", u"1F7E8", u"", 2481, 1, 15},
+    {u"\U0001F7E9", u"", u"1F7E9", u"", 2482, 1, 15},
+    {u"\U0001F7EA", u"", u"1F7EA", u"", 2483, 1, 15},
+    {u"\U0001F7EB", u"", u"1F7EB", u"", 2484, 1, 15},
+    {u"\U0001F7F0", u"", u"1F7F0", u"", 2485, 1, 15},
+    {u"\U0001F90C", u"", u"1F90C", u"", 2486, 1, 15},
+    {u"\U0001F90C\U0001F3FB", u"", u"1F90C-1F3FB", u"", 2487, 1, 15},
+    {u"\U0001F90C\U0001F3FC", u"", u"1F90C-1F3FC", u"", 2488, 1, 15},
+    {u"\U0001F90C\U0001F3FD", u"", u"1F90C-1F3FD", u"", 2489, 1, 15},
+    {u"\U0001F90C\U0001F3FE", u"", u"1F90C-1F3FE", u"", 2490, 1, 15},
+    {u"\U0001F90C\U0001F3FF", u"", u"1F90C-1F3FF", u"", 2491, 1, 15},
+    {u"\U0001F90D", u"", u"1F90D", u"", 2492, 1, 15},
+    {u"\U0001F90E", u"", u"1F90E", u"", 2493, 1, 15},
+    {u"\U0001F90F", u"", u"1F90F", u"", 2494, 1, 15},
+    {u"\U0001F90F\U0001F3FB", u"", u"1F90F-1F3FB", u"", 2495, 1, 15},
+    {u"\U0001F90F\U0001F3FC", u"", u"1F90F-1F3FC", u"", 2496, 1, 15},
+    {u"\U0001F90F\U0001F3FD", u"", u"1F90F-1F3FD", u"", 2497, 1, 15},
+    {u"\U0001F90F\U0001F3FE", u"", u"1F90F-1F3FE", u"", 2498, 1, 15},
+    {u"\U0001F90F\U0001F3FF", u"", u"1F90F-1F3FF", u"", 2499, 1, 15},
+    {u"\U0001F910", u"", u"1F910", u"", 2500, 1, 15},
+    {u"\U0001F911", u"", u"1F911", u"", 2501, 1, 15},
+    {u"\U0001F912", u"", u"1F912", u"", 2502, 1, 15},
+    {u"\U0001F913", u"", u"1F913", u"", 2503, 1, 15},
+    {u"\U0001F914", u"", u"1F914", u"", 2504, 1, 15},
+    {u"\U0001F915", u"", u"1F915", u"", 2505, 1, 15},
+    {u"\U0001F916", u"", u"1F916", u"", 2506, 1, 15},
+    {u"\U0001F917", u"", u"1F917", u"", 2507, 1, 15},
+    {u"\U0001F918", u"", u"1F918", u"", 2508, 2, 15},
+    {u"\U0001F918\U0001F3FB", u"", u"1F918-1F3FB", u"", 2510, 1, 15},
+    {u"\U0001F918\U0001F3FC", u"", u"1F918-1F3FC", u"", 2511, 1, 15},
+    {u"\U0001F918\U0001F3FD", u"", u"1F918-1F3FD", u"", 2512, 1, 15},
+    {u"\U0001F918\U0001F3FE", u"", u"1F918-1F3FE", u"", 2513, 1, 15},
+    {u"\U0001F918\U0001F3FF", u"", u"1F918-1F3FF", u"", 2514, 1, 15},
+    {u"\U0001F919", u"", u"1F919", u"", 2515, 1, 15},
+    {u"\U0001F919\U0001F3FB", u"", u"1F919-1F3FB", u"", 2516, 1, 15},
+    {u"\U0001F919\U0001F3FC", u"", u"1F919-1F3FC", u"", 2517, 1, 15},
+    {u"\U0001F919\U0001F3FD", u"", u"1F919-1F3FD", u"", 2518, 1, 15},
+    {u"\U0001F919\U0001F3FE", u"", u"1F919-1F3FE", u"", 2519, 1, 15},
+    {u"\U0001F919\U0001F3FF", u"", u"1F919-1F3FF", u"", 2520, 1, 15},
+    {u"\U0001F91A", u"", u"1F91A", u"", 2521, 1, 15},
+    {u"\U0001F91A\U0001F3FB", u"", u"1F91A-1F3FB", u"", 2522, 1, 15},
+    {u"\U0001F91A\U0001F3FC", u"", u"1F91A-1F3FC", u"", 2523, 1, 15},
+    {u"\U0001F91A\U0001F3FD", u"", u"1F91A-1F3FD", u"", 2524, 1, 15},
+    {u"\U0001F91A\U0001F3FE", u"", u"1F91A-1F3FE", u"", 2525, 1, 15},
+    {u"\U0001F91A\U0001F3FF", u"", u"1F91A-1F3FF", u"", 2526, 1, 15},
+    {u"\U0001F91B", u"", u"1F91B", u"", 2527, 1, 15},
+    {u"\U0001F91B\U0001F3FB", u"", u"1F91B-1F3FB", u"", 2528, 1, 15},
+    {u"\U0001F91B\U0001F3FC", u"", u"1F91B-1F3FC", u"", 2529, 1, 15},
+    {u"\U0001F91B\U0001F3FD", u"", u"1F91B-1F3FD", u"", 2530, 1, 15},
+    {u"\U0001F91B\U0001F3FE", u"", u"1F91B-1F3FE", u"", 2531, 1, 15},
+    {u"\U0001F91B\U0001F3FF", u"", u"1F91B-1F3FF", u"", 2532, 1, 15},
+    {u"\U0001F91C", u"", u"1F91C", u"", 2533, 1, 15},
+    {u"\U0001F91C\U0001F3FB", u"", u"1F91C-1F3FB", u"", 2534, 1, 15},
+    {u"\U0001F91C\U0001F3FC", u"", u"1F91C-1F3FC", u"", 2535, 1, 15},
+    {u"\U0001F91C\U0001F3FD", u"", u"1F91C-1F3FD", u"", 2536, 1, 15},
+    {u"\U0001F91C\U0001F3FE", u"", u"1F91C-1F3FE", u"", 2537, 1, 15},
+    {u"\U0001F91C\U0001F3FF", u"", u"1F91C-1F3FF", u"", 2538, 1, 15},
+    {u"\U0001F91D", u"", u"1F91D", u"", 2539, 1, 15},
+    {u"\U0001F91D\U0001F3FB", u"", u"1F91D-1F3FB", u"", 2540, 1, 15},
+    {u"\U0001F91D\U0001F3FC", u"", u"1F91D-1F3FC", u"", 2541, 1, 15},
+    {u"\U0001F91D\U0001F3FD", u"", u"1F91D-1F3FD", u"", 2542, 1, 15},
+    {u"\U0001F91D\U0001F3FE", u"", u"1F91D-1F3FE", u"", 2543, 1, 15},
+    {u"\U0001F91D\U0001F3FF", u"", u"1F91D-1F3FF", u"", 2544, 1, 15},
+    {u"\U0001FAF1\U0001F3FB\u200D\U0001FAF2\U0001F3FC", u"", u"1FAF1-1F3FB-200D-1FAF2-1F3FC", u"", 2545, 1, 15},
+    {u"\U0001FAF1\U0001F3FB\u200D\U0001FAF2\U0001F3FD", u"", u"1FAF1-1F3FB-200D-1FAF2-1F3FD", u"", 2546, 1, 15},
+    {u"\U0001FAF1\U0001F3FB\u200D\U0001FAF2\U0001F3FE", u"", u"1FAF1-1F3FB-200D-1FAF2-1F3FE", u"", 2547, 1, 15},
+    {u"\U0001FAF1\U0001F3FB\u200D\U0001FAF2\U0001F3FF", u"", u"1FAF1-1F3FB-200D-1FAF2-1F3FF", u"", 2548, 1, 15},
+    {u"\U0001FAF1\U0001F3FC\u200D\U0001FAF2\U0001F3FB", u"", u"1FAF1-1F3FC-200D-1FAF2-1F3FB", u"", 2549, 1, 15},
+    {u"\U0001FAF1\U0001F3FC\u200D\U0001FAF2\U0001F3FD", u"", u"1FAF1-1F3FC-200D-1FAF2-1F3FD", u"", 2550, 1, 15},
+    {u"\U0001FAF1\U0001F3FC\u200D\U0001FAF2\U0001F3FE", u"", u"1FAF1-1F3FC-200D-1FAF2-1F3FE", u"", 2551, 1, 15},
+    {u"\U0001FAF1\U0001F3FC\u200D\U0001FAF2\U0001F3FF", u"", u"1FAF1-1F3FC-200D-1FAF2-1F3FF", u"", 2552, 1, 15},
+    {u"\U0001FAF1\U0001F3FD\u200D\U0001FAF2\U0001F3FB", u"", u"1FAF1-1F3FD-200D-1FAF2-1F3FB", u"", 2553, 1, 15},
+    {u"\U0001FAF1\U0001F3FD\u200D\U0001FAF2\U0001F3FC", u"", u"1FAF1-1F3FD-200D-1FAF2-1F3FC", u"", 2554, 1, 15},
+    {u"\U0001FAF1\U0001F3FD\u200D\U0001FAF2\U0001F3FE", u"", u"1FAF1-1F3FD-200D-1FAF2-1F3FE", u"", 2555, 1, 15},
+    {u"\U0001FAF1\U0001F3FD\u200D\U0001FAF2\U0001F3FF", u"", u"1FAF1-1F3FD-200D-1FAF2-1F3FF", u"", 2556, 1, 15},
+    {u"\U0001FAF1\U0001F3FE\u200D\U0001FAF2\U0001F3FB", u"", u"1FAF1-1F3FE-200D-1FAF2-1F3FB", u"", 2557, 1, 15},
+    {u"\U0001FAF1\U0001F3FE\u200D\U0001FAF2\U0001F3FC", u"", u"1FAF1-1F3FE-200D-1FAF2-1F3FC", u"", 2558, 1, 15},
+    {u"\U0001FAF1\U0001F3FE\u200D\U0001FAF2\U0001F3FD", u"", u"1FAF1-1F3FE-200D-1FAF2-1F3FD", u"", 2559, 1, 15},
+    {u"\U0001FAF1\U0001F3FE\u200D\U0001FAF2\U0001F3FF", u"", u"1FAF1-1F3FE-200D-1FAF2-1F3FF", u"", 2560, 1, 15},
+    {u"\U0001FAF1\U0001F3FF\u200D\U0001FAF2\U0001F3FB", u"", u"1FAF1-1F3FF-200D-1FAF2-1F3FB", u"", 2561, 1, 15},
+    {u"\U0001FAF1\U0001F3FF\u200D\U0001FAF2\U0001F3FC", u"", u"1FAF1-1F3FF-200D-1FAF2-1F3FC", u"", 2562, 1, 15},
+    {u"\U0001FAF1\U0001F3FF\u200D\U0001FAF2\U0001F3FD", u"", u"1FAF1-1F3FF-200D-1FAF2-1F3FD", u"", 2563, 1, 15},
+    {u"\U0001FAF1\U0001F3FF\u200D\U0001FAF2\U0001F3FE", u"", u"1FAF1-1F3FF-200D-1FAF2-1F3FE", u"", 2564, 1, 15},
+    {u"\U0001F91E", u"", u"1F91E", u"", 2565, 2, 15},
+    {u"\U0001F91E\U0001F3FB", u"", u"1F91E-1F3FB", u"", 2567, 1, 15},
+    {u"\U0001F91E\U0001F3FC", u"", u"1F91E-1F3FC", u"", 2568, 1, 15},
+    {u"\U0001F91E\U0001F3FD", u"", u"1F91E-1F3FD", u"", 2569, 1, 15},
+    {u"\U0001F91E\U0001F3FE", u"", u"1F91E-1F3FE", u"", 2570, 1, 15},
+    {u"\U0001F91E\U0001F3FF", u"", u"1F91E-1F3FF", u"", 2571, 1, 15},
+    {u"\U0001F91F", u"", u"1F91F", u"", 2572, 1, 15},
+    {u"\U0001F91F\U0001F3FB", u"", u"1F91F-1F3FB", u"", 2573, 1, 15},
+    {u"\U0001F91F\U0001F3FC", u"", u"1F91F-1F3FC", u"", 2574, 1, 15},
+    {u"\U0001F91F\U0001F3FD", u"", u"1F91F-1F3FD", u"", 2575, 1, 15},
+    {u"\U0001F91F\U0001F3FE", u"", u"1F91F-1F3FE", u"", 2576, 1, 15},
+    {u"\U0001F91F\U0001F3FF", u"", u"1F91F-1F3FF", u"", 2577, 1, 15},
+    {u"\U0001F920", u"", u"1F920", u"", 2578, 1, 15},
+    {u"\U0001F921", u"", u"1F921", u"", 2579, 1, 15},
+    {u"\U0001F922", u"", u"1F922", u"", 2580, 1, 15},
+    {u"\U0001F923", u"", u"1F923", u"", 2581, 1, 15},
+    {u"\U0001F924", u"", u"1F924", u"", 2582, 1, 15},
+    {u"\U0001F925", u"", u"1F925", u"", 2583, 1, 15},
+    {u"\U0001F926\u200D\u2640\uFE0F", u"\U0001F926\u200D\u2640", u"1F926-200D-2640-FE0F", u"1F926-200D-2640", 2584, 1, 15},
+    {u"\U0001F926\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F926\U0001F3FB\u200D\u2640", u"1F926-1F3FB-200D-2640-FE0F", u"1F926-1F3FB-200D-2640", 2585, 1, 15},
+    {u"\U0001F926\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F926\U0001F3FC\u200D\u2640", u"1F926-1F3FC-200D-2640-FE0F", u"1F926-1F3FC-200D-2640", 2586, 1, 15},
+    {u"\U0001F926\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F926\U0001F3FD\u200D\u2640", u"1F926-1F3FD-200D-2640-FE0F", u"1F926-1F3FD-200D-2640", 2587, 1, 15},
+    {u"\U0001F926\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F926\U0001F3FE\u200D\u2640", u"1F926-1F3FE-200D-2640-FE0F", u"1F926-1F3FE-200D-2640", 2588, 1, 15},
+    {u"\U0001F926\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F926\U0001F3FF\u200D\u2640", u"1F926-1F3FF-200D-2640-FE0F", u"1F926-1F3FF-200D-2640", 2589, 1, 15},
+    {u"\U0001F926\u200D\u2642\uFE0F", u"\U0001F926\u200D\u2642", u"1F926-200D-2642-FE0F", u"1F926-200D-2642", 2590, 1, 15},
+    {u"\U0001F926\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F926\U0001F3FB\u200D\u2642", u"1F926-1F3FB-200D-2642-FE0F", u"1F926-1F3FB-200D-2642", 2591, 1, 15},
+    {u"\U0001F926\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F926\U0001F3FC\u200D\u2642", u"1F926-1F3FC-200D-2642-FE0F", u"1F926-1F3FC-200D-2642", 2592, 1, 15},
+    {u"\U0001F926\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F926\U0001F3FD\u200D\u2642", u"1F926-1F3FD-200D-2642-FE0F", u"1F926-1F3FD-200D-2642", 2593, 1, 15},
+    {u"\U0001F926\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F926\U0001F3FE\u200D\u2642", u"1F926-1F3FE-200D-2642-FE0F", u"1F926-1F3FE-200D-2642", 2594, 1, 15},
+    {u"\U0001F926\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F926\U0001F3FF\u200D\u2642", u"1F926-1F3FF-200D-2642-FE0F", u"1F926-1F3FF-200D-2642", 2595, 1, 15},
+    {u"\U0001F926", u"", u"1F926", u"", 2596, 1, 15},
+    {u"\U0001F926\U0001F3FB", u"", u"1F926-1F3FB", u"", 2597, 1, 15},
+    {u"\U0001F926\U0001F3FC", u"", u"1F926-1F3FC", u"", 2598, 1, 15},
+    {u"\U0001F926\U0001F3FD", u"", u"1F926-1F3FD", u"", 2599, 1, 15},
+    {u"\U0001F926\U0001F3FE", u"", u"1F926-1F3FE", u"", 2600, 1, 15},
+    {u"\U0001F926\U0001F3FF", u"", u"1F926-1F3FF", u"", 2601, 1, 15},
+    {u"\U0001F927", u"", u"1F927", u"", 2602, 1, 15},
+    {u"\U0001F928", u"", u"1F928", u"", 2603, 2, 15},
+    {u"\U0001F929", u"", u"1F929", u"", 2605, 2, 15},
+    {u"\U0001F92A", u"", u"1F92A", u"", 2607, 2, 15},
+    {u"\U0001F92B", u"", u"1F92B", u"", 2609, 2, 15},
+    {u"\U0001F92C", u"", u"1F92C", u"", 2611, 2, 15},
+    {u"\U0001F92D", u"", u"1F92D", u"", 2613, 2, 15},
+    {u"\U0001F92E", u"", u"1F92E", u"", 2615, 2, 15},
+    {u"\U0001F92F", u"", u"1F92F", u"", 2617, 2, 15},
+    {u"\U0001F930", u"", u"1F930", u"", 2619, 1, 15},
+    {u"\U0001F930\U0001F3FB", u"", u"1F930-1F3FB", u"", 2620, 1, 15},
+    {u"\U0001F930\U0001F3FC", u"", u"1F930-1F3FC", u"", 2621, 1, 15},
+    {u"\U0001F930\U0001F3FD", u"", u"1F930-1F3FD", u"", 2622, 1, 15},
+    {u"\U0001F930\U0001F3FE", u"", u"1F930-1F3FE", u"", 2623, 1, 15},
+    {u"\U0001F930\U0001F3FF", u"", u"1F930-1F3FF", u"", 2624, 1, 15},
+    {u"\U0001F931", u"", u"1F931", u"", 2625, 1, 15},
+    {u"\U0001F931\U0001F3FB", u"", u"1F931-1F3FB", u"", 2626, 1, 15},
+    {u"\U0001F931\U0001F3FC", u"", u"1F931-1F3FC", u"", 2627, 1, 15},
+    {u"\U0001F931\U0001F3FD", u"", u"1F931-1F3FD", u"", 2628, 1, 15},
+    {u"\U0001F931\U0001F3FE", u"", u"1F931-1F3FE", u"", 2629, 1, 15},
+    {u"\U0001F931\U0001F3FF", u"", u"1F931-1F3FF", u"", 2630, 1, 15},
+    {u"\U0001F932", u"", u"1F932", u"", 2631, 1, 15},
+    {u"\U0001F932\U0001F3FB", u"", u"1F932-1F3FB", u"", 2632, 1, 15},
+    {u"\U0001F932\U0001F3FC", u"", u"1F932-1F3FC", u"", 2633, 1, 15},
+    {u"\U0001F932\U0001F3FD", u"", u"1F932-1F3FD", u"", 2634, 1, 15},
+    {u"\U0001F932\U0001F3FE", u"", u"1F932-1F3FE", u"", 2635, 1, 15},
+    {u"\U0001F932\U0001F3FF", u"", u"1F932-1F3FF", u"", 2636, 1, 15},
+    {u"\U0001F933", u"", u"1F933", u"", 2637, 1, 15},
+    {u"\U0001F933\U0001F3FB", u"", u"1F933-1F3FB", u"", 2638, 1, 15},
+    {u"\U0001F933\U0001F3FC", u"", u"1F933-1F3FC", u"", 2639, 1, 15},
+    {u"\U0001F933\U0001F3FD", u"", u"1F933-1F3FD", u"", 2640, 1, 15},
+    {u"\U0001F933\U0001F3FE", u"", u"1F933-1F3FE", u"", 2641, 1, 15},
+    {u"\U0001F933\U0001F3FF", u"", u"1F933-1F3FF", u"", 2642, 1, 15},
+    {u"\U0001F934", u"", u"1F934", u"", 2643, 1, 15},
+    {u"\U0001F934\U0001F3FB", u"", u"1F934-1F3FB", u"", 2644, 1, 15},
+    {u"\U0001F934\U0001F3FC", u"", u"1F934-1F3FC", u"", 2645, 1, 15},
+    {u"\U0001F934\U0001F3FD", u"", u"1F934-1F3FD", u"", 2646, 1, 15},
+    {u"\U0001F934\U0001F3FE", u"", u"1F934-1F3FE", u"", 2647, 1, 15},
+    {u"\U0001F934\U0001F3FF", u"", u"1F934-1F3FF", u"", 2648, 1, 15},
+    {u"\U0001F935\u200D\u2640\uFE0F", u"\U0001F935\u200D\u2640", u"1F935-200D-2640-FE0F", u"1F935-200D-2640", 2649, 1, 15},
+    {u"\U0001F935\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F935\U0001F3FB\u200D\u2640", u"1F935-1F3FB-200D-2640-FE0F", u"1F935-1F3FB-200D-2640", 2650, 1, 15},
+    {u"\U0001F935\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F935\U0001F3FC\u200D\u2640", u"1F935-1F3FC-200D-2640-FE0F", u"1F935-1F3FC-200D-2640", 2651, 1, 15},
+    {u"\U0001F935\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F935\U0001F3FD\u200D\u2640", u"1F935-1F3FD-200D-2640-FE0F", u"1F935-1F3FD-200D-2640", 2652, 1, 15},
+    {u"\U0001F935\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F935\U0001F3FE\u200D\u2640", u"1F935-1F3FE-200D-2640-FE0F", u"1F935-1F3FE-200D-2640", 2653, 1, 15},
+    {u"\U0001F935\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F935\U0001F3FF\u200D\u2640", u"1F935-1F3FF-200D-2640-FE0F", u"1F935-1F3FF-200D-2640", 2654, 1, 15},
+    {u"\U0001F935\u200D\u2642\uFE0F", u"\U0001F935\u200D\u2642", u"1F935-200D-2642-FE0F", u"1F935-200D-2642", 2655, 1, 15},
+    {u"\U0001F935\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F935\U0001F3FB\u200D\u2642", u"1F935-1F3FB-200D-2642-FE0F", u"1F935-1F3FB-200D-2642", 2656, 1, 15},
+    {u"\U0001F935\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F935\U0001F3FC\u200D\u2642", u"1F935-1F3FC-200D-2642-FE0F", u"1F935-1F3FC-200D-2642", 2657, 1, 15},
+    {u"\U0001F935\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F935\U0001F3FD\u200D\u2642", u"1F935-1F3FD-200D-2642-FE0F", u"1F935-1F3FD-200D-2642", 2658, 1, 15},
+    {u"\U0001F935\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F935\U0001F3FE\u200D\u2642", u"1F935-1F3FE-200D-2642-FE0F", u"1F935-1F3FE-200D-2642", 2659, 1, 15},
+    {u"\U0001F935\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F935\U0001F3FF\u200D\u2642", u"1F935-1F3FF-200D-2642-FE0F", u"1F935-1F3FF-200D-2642", 2660, 1, 15},
+    {u"\U0001F935", u"", u"1F935", u"", 2661, 1, 15},
+    {u"\U0001F935\U0001F3FB", u"", u"1F935-1F3FB", u"", 2662, 1, 15},
+    {u"\U0001F935\U0001F3FC", u"", u"1F935-1F3FC", u"", 2663, 1, 15},
+    {u"\U0001F935\U0001F3FD", u"", u"1F935-1F3FD", u"", 2664, 1, 15},
+    {u"\U0001F935\U0001F3FE", u"", u"1F935-1F3FE", u"", 2665, 1, 15},
+    {u"\U0001F935\U0001F3FF", u"", u"1F935-1F3FF", u"", 2666, 1, 15},
+    {u"\U0001F936", u"", u"1F936", u"", 2667, 2, 15},
+    {u"\U0001F936\U0001F3FB", u"", u"1F936-1F3FB", u"", 2669, 1, 15},
+    {u"\U0001F936\U0001F3FC", u"", u"1F936-1F3FC", u"", 2670, 1, 15},
+    {u"\U0001F936\U0001F3FD", u"", u"1F936-1F3FD", u"", 2671, 1, 15},
+    {u"\U0001F936\U0001F3FE", u"", u"1F936-1F3FE", u"", 2672, 1, 15},
+    {u"\U0001F936\U0001F3FF", u"", u"1F936-1F3FF", u"", 2673, 1, 15},
+    {u"\U0001F937\u200D\u2640\uFE0F", u"\U0001F937\u200D\u2640", u"1F937-200D-2640-FE0F", u"1F937-200D-2640", 2674, 1, 15},
+    {u"\U0001F937\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F937\U0001F3FB\u200D\u2640", u"1F937-1F3FB-200D-2640-FE0F", u"1F937-1F3FB-200D-2640", 2675, 1, 15},
+    {u"\U0001F937\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F937\U0001F3FC\u200D\u2640", u"1F937-1F3FC-200D-2640-FE0F", u"1F937-1F3FC-200D-2640", 2676, 1, 15},
+    {u"\U0001F937\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F937\U0001F3FD\u200D\u2640", u"1F937-1F3FD-200D-2640-FE0F", u"1F937-1F3FD-200D-2640", 2677, 1, 15},
+    {u"\U0001F937\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F937\U0001F3FE\u200D\u2640", u"1F937-1F3FE-200D-2640-FE0F", u"1F937-1F3FE-200D-2640", 2678, 1, 15},
+    {u"\U0001F937\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F937\U0001F3FF\u200D\u2640", u"1F937-1F3FF-200D-2640-FE0F", u"1F937-1F3FF-200D-2640", 2679, 1, 15},
+    {u"\U0001F937\u200D\u2642\uFE0F", u"\U0001F937\u200D\u2642", u"1F937-200D-2642-FE0F", u"1F937-200D-2642", 2680, 1, 15},
+    {u"\U0001F937\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F937\U0001F3FB\u200D\u2642", u"1F937-1F3FB-200D-2642-FE0F", u"1F937-1F3FB-200D-2642", 2681, 1, 15},
+    {u"\U0001F937\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F937\U0001F3FC\u200D\u2642", u"1F937-1F3FC-200D-2642-FE0F", u"1F937-1F3FC-200D-2642", 2682, 1, 15},
+    {u"\U0001F937\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F937\U0001F3FD\u200D\u2642", u"1F937-1F3FD-200D-2642-FE0F", u"1F937-1F3FD-200D-2642", 2683, 1, 15},
+    {u"\U0001F937\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F937\U0001F3FE\u200D\u2642", u"1F937-1F3FE-200D-2642-FE0F", u"1F937-1F3FE-200D-2642", 2684, 1, 15},
+    {u"\U0001F937\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F937\U0001F3FF\u200D\u2642", u"1F937-1F3FF-200D-2642-FE0F", u"1F937-1F3FF-200D-2642", 2685, 1, 15},
+    {u"\U0001F937", u"", u"1F937", u"", 2686, 1, 15},
+    {u"\U0001F937\U0001F3FB", u"", u"1F937-1F3FB", u"", 2687, 1, 15},
+    {u"\U0001F937\U0001F3FC", u"", u"1F937-1F3FC", u"", 2688, 1, 15},
+    {u"\U0001F937\U0001F3FD", u"", u"1F937-1F3FD", u"", 2689, 1, 15},
+    {u"\U0001F937\U0001F3FE", u"", u"1F937-1F3FE", u"", 2690, 1, 15},
+    {u"\U0001F937\U0001F3FF", u"", u"1F937-1F3FF", u"", 2691, 1, 15},
+    {u"\U0001F938\u200D\u2640\uFE0F", u"\U0001F938\u200D\u2640", u"1F938-200D-2640-FE0F", u"1F938-200D-2640", 2692, 1, 15},
+    {u"\U0001F938\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F938\U0001F3FB\u200D\u2640", u"1F938-1F3FB-200D-2640-FE0F", u"1F938-1F3FB-200D-2640", 2693, 1, 15},
+    {u"\U0001F938\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F938\U0001F3FC\u200D\u2640", u"1F938-1F3FC-200D-2640-FE0F", u"1F938-1F3FC-200D-2640", 2694, 1, 15},
+    {u"\U0001F938\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F938\U0001F3FD\u200D\u2640", u"1F938-1F3FD-200D-2640-FE0F", u"1F938-1F3FD-200D-2640", 2695, 1, 15},
+    {u"\U0001F938\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F938\U0001F3FE\u200D\u2640", u"1F938-1F3FE-200D-2640-FE0F", u"1F938-1F3FE-200D-2640", 2696, 1, 15},
+    {u"\U0001F938\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F938\U0001F3FF\u200D\u2640", u"1F938-1F3FF-200D-2640-FE0F", u"1F938-1F3FF-200D-2640", 2697, 1, 15},
+    {u"\U0001F938\u200D\u2642\uFE0F", u"\U0001F938\u200D\u2642", u"1F938-200D-2642-FE0F", u"1F938-200D-2642", 2698, 1, 15},
+    {u"\U0001F938\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F938\U0001F3FB\u200D\u2642", u"1F938-1F3FB-200D-2642-FE0F", u"1F938-1F3FB-200D-2642", 2699, 1, 15},
+    {u"\U0001F938\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F938\U0001F3FC\u200D\u2642", u"1F938-1F3FC-200D-2642-FE0F", u"1F938-1F3FC-200D-2642", 2700, 1, 15},
+    {u"\U0001F938\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F938\U0001F3FD\u200D\u2642", u"1F938-1F3FD-200D-2642-FE0F", u"1F938-1F3FD-200D-2642", 2701, 1, 15},
+    {u"\U0001F938\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F938\U0001F3FE\u200D\u2642", u"1F938-1F3FE-200D-2642-FE0F", u"1F938-1F3FE-200D-2642", 2702, 1, 15},
+    {u"\U0001F938\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F938\U0001F3FF\u200D\u2642", u"1F938-1F3FF-200D-2642-FE0F", u"1F938-1F3FF-200D-2642", 2703, 1, 15},
+    {u"\U0001F938", u"", u"1F938", u"", 2704, 1, 15},
+    {u"\U0001F938\U0001F3FB", u"", u"1F938-1F3FB", u"", 2705, 1, 15},
+    {u"\U0001F938\U0001F3FC", u"", u"1F938-1F3FC", u"", 2706, 1, 15},
+    {u"\U0001F938\U0001F3FD", u"", u"1F938-1F3FD", u"", 2707, 1, 15},
+    {u"\U0001F938\U0001F3FE", u"", u"1F938-1F3FE", u"", 2708, 1, 15},
+    {u"\U0001F938\U0001F3FF", u"", u"1F938-1F3FF", u"", 2709, 1, 15},
+    {u"\U0001F939\u200D\u2640\uFE0F", u"\U0001F939\u200D\u2640", u"1F939-200D-2640-FE0F", u"1F939-200D-2640", 2710, 1, 15},
+    {u"\U0001F939\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F939\U0001F3FB\u200D\u2640", u"1F939-1F3FB-200D-2640-FE0F", u"1F939-1F3FB-200D-2640", 2711, 1, 15},
+    {u"\U0001F939\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F939\U0001F3FC\u200D\u2640", u"1F939-1F3FC-200D-2640-FE0F", u"1F939-1F3FC-200D-2640", 2712, 1, 15},
+    {u"\U0001F939\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F939\U0001F3FD\u200D\u2640", u"1F939-1F3FD-200D-2640-FE0F", u"1F939-1F3FD-200D-2640", 2713, 1, 15},
+    {u"\U0001F939\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F939\U0001F3FE\u200D\u2640", u"1F939-1F3FE-200D-2640-FE0F", u"1F939-1F3FE-200D-2640", 2714, 1, 15},
+    {u"\U0001F939\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F939\U0001F3FF\u200D\u2640", u"1F939-1F3FF-200D-2640-FE0F", u"1F939-1F3FF-200D-2640", 2715, 1, 15},
+    {u"\U0001F939\u200D\u2642\uFE0F", u"\U0001F939\u200D\u2642", u"1F939-200D-2642-FE0F", u"1F939-200D-2642", 2716, 1, 15},
+    {u"\U0001F939\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F939\U0001F3FB\u200D\u2642", u"1F939-1F3FB-200D-2642-FE0F", u"1F939-1F3FB-200D-2642", 2717, 1, 15},
+    {u"\U0001F939\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F939\U0001F3FC\u200D\u2642", u"1F939-1F3FC-200D-2642-FE0F", u"1F939-1F3FC-200D-2642", 2718, 1, 15},
+    {u"\U0001F939\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F939\U0001F3FD\u200D\u2642", u"1F939-1F3FD-200D-2642-FE0F", u"1F939-1F3FD-200D-2642", 2719, 1, 15},
+    {u"\U0001F939\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F939\U0001F3FE\u200D\u2642", u"1F939-1F3FE-200D-2642-FE0F", u"1F939-1F3FE-200D-2642", 2720, 1, 15},
+    {u"\U0001F939\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F939\U0001F3FF\u200D\u2642", u"1F939-1F3FF-200D-2642-FE0F", u"1F939-1F3FF-200D-2642", 2721, 1, 15},
+    {u"\U0001F939", u"", u"1F939", u"", 2722, 1, 15},
+    {u"\U0001F939\U0001F3FB", u"", u"1F939-1F3FB", u"", 2723, 1, 15},
+    {u"\U0001F939\U0001F3FC", u"", u"1F939-1F3FC", u"", 2724, 1, 15},
+    {u"\U0001F939\U0001F3FD", u"", u"1F939-1F3FD", u"", 2725, 1, 15},
+    {u"\U0001F939\U0001F3FE", u"", u"1F939-1F3FE", u"", 2726, 1, 15},
+    {u"\U0001F939\U0001F3FF", u"", u"1F939-1F3FF", u"", 2727, 1, 15},
+    {u"\U0001F93A", u"", u"1F93A", u"", 2728, 1, 15},
+    {u"\U0001F93C\u200D\u2640\uFE0F", u"\U0001F93C\u200D\u2640", u"1F93C-200D-2640-FE0F", u"1F93C-200D-2640", 2729, 1, 15},
+    {u"\U0001F93C\u200D\u2642\uFE0F", u"\U0001F93C\u200D\u2642", u"1F93C-200D-2642-FE0F", u"1F93C-200D-2642", 2730, 1, 15},
+    {u"\U0001F93C", u"", u"1F93C", u"", 2731, 1, 15},
+    {u"\U0001F93D\u200D\u2640\uFE0F", u"\U0001F93D\u200D\u2640", u"1F93D-200D-2640-FE0F", u"1F93D-200D-2640", 2732, 1, 15},
+    {u"\U0001F93D\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F93D\U0001F3FB\u200D\u2640", u"1F93D-1F3FB-200D-2640-FE0F", u"1F93D-1F3FB-200D-2640", 2733, 1, 15},
+    {u"\U0001F93D\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F93D\U0001F3FC\u200D\u2640", u"1F93D-1F3FC-200D-2640-FE0F", u"1F93D-1F3FC-200D-2640", 2734, 1, 15},
+    {u"\U0001F93D\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F93D\U0001F3FD\u200D\u2640", u"1F93D-1F3FD-200D-2640-FE0F", u"1F93D-1F3FD-200D-2640", 2735, 1, 15},
+    {u"\U0001F93D\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F93D\U0001F3FE\u200D\u2640", u"1F93D-1F3FE-200D-2640-FE0F", u"1F93D-1F3FE-200D-2640", 2736, 1, 15},
+    {u"\U0001F93D\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F93D\U0001F3FF\u200D\u2640", u"1F93D-1F3FF-200D-2640-FE0F", u"1F93D-1F3FF-200D-2640", 2737, 1, 15},
+    {u"\U0001F93D\u200D\u2642\uFE0F", u"\U0001F93D\u200D\u2642", u"1F93D-200D-2642-FE0F", u"1F93D-200D-2642", 2738, 1, 15},
+    {u"\U0001F93D\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F93D\U0001F3FB\u200D\u2642", u"1F93D-1F3FB-200D-2642-FE0F", u"1F93D-1F3FB-200D-2642", 2739, 1, 15},
+    {u"\U0001F93D\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F93D\U0001F3FC\u200D\u2642", u"1F93D-1F3FC-200D-2642-FE0F", u"1F93D-1F3FC-200D-2642", 2740, 1, 15},
+    {u"\U0001F93D\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F93D\U0001F3FD\u200D\u2642", u"1F93D-1F3FD-200D-2642-FE0F", u"1F93D-1F3FD-200D-2642", 2741, 1, 15},
+    {u"\U0001F93D\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F93D\U0001F3FE\u200D\u2642", u"1F93D-1F3FE-200D-2642-FE0F", u"1F93D-1F3FE-200D-2642", 2742, 1, 15},
+    {u"\U0001F93D\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F93D\U0001F3FF\u200D\u2642", u"1F93D-1F3FF-200D-2642-FE0F", u"1F93D-1F3FF-200D-2642", 2743, 1, 15},
+    {u"\U0001F93D", u"", u"1F93D", u"", 2744, 1, 15},
+    {u"\U0001F93D\U0001F3FB", u"", u"1F93D-1F3FB", u"", 2745, 1, 15},
+    {u"\U0001F93D\U0001F3FC", u"", u"1F93D-1F3FC", u"", 2746, 1, 15},
+    {u"\U0001F93D\U0001F3FD", u"", u"1F93D-1F3FD", u"", 2747, 1, 15},
+    {u"\U0001F93D\U0001F3FE", u"", u"1F93D-1F3FE", u"", 2748, 1, 15},
+    {u"\U0001F93D\U0001F3FF", u"", u"1F93D-1F3FF", u"", 2749, 1, 15},
+    {u"\U0001F93E\u200D\u2640\uFE0F", u"\U0001F93E\u200D\u2640", u"1F93E-200D-2640-FE0F", u"1F93E-200D-2640", 2750, 1, 15},
+    {u"\U0001F93E\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F93E\U0001F3FB\u200D\u2640", u"1F93E-1F3FB-200D-2640-FE0F", u"1F93E-1F3FB-200D-2640", 2751, 1, 15},
+    {u"\U0001F93E\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F93E\U0001F3FC\u200D\u2640", u"1F93E-1F3FC-200D-2640-FE0F", u"1F93E-1F3FC-200D-2640", 2752, 1, 15},
+    {u"\U0001F93E\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F93E\U0001F3FD\u200D\u2640", u"1F93E-1F3FD-200D-2640-FE0F", u"1F93E-1F3FD-200D-2640", 2753, 1, 15},
+    {u"\U0001F93E\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F93E\U0001F3FE\u200D\u2640", u"1F93E-1F3FE-200D-2640-FE0F", u"1F93E-1F3FE-200D-2640", 2754, 1, 15},
+    {u"\U0001F93E\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F93E\U0001F3FF\u200D\u2640", u"1F93E-1F3FF-200D-2640-FE0F", u"1F93E-1F3FF-200D-2640", 2755, 1, 15},
+    {u"\U0001F93E\u200D\u2642\uFE0F", u"\U0001F93E\u200D\u2642", u"1F93E-200D-2642-FE0F", u"1F93E-200D-2642", 2756, 1, 15},
+    {u"\U0001F93E\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F93E\U0001F3FB\u200D\u2642", u"1F93E-1F3FB-200D-2642-FE0F", u"1F93E-1F3FB-200D-2642", 2757, 1, 15},
+    {u"\U0001F93E\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F93E\U0001F3FC\u200D\u2642", u"1F93E-1F3FC-200D-2642-FE0F", u"1F93E-1F3FC-200D-2642", 2758, 1, 15},
+    {u"\U0001F93E\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F93E\U0001F3FD\u200D\u2642", u"1F93E-1F3FD-200D-2642-FE0F", u"1F93E-1F3FD-200D-2642", 2759, 1, 15},
+    {u"\U0001F93E\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F93E\U0001F3FE\u200D\u2642", u"1F93E-1F3FE-200D-2642-FE0F", u"1F93E-1F3FE-200D-2642", 2760, 1, 15},
+    {u"\U0001F93E\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F93E\U0001F3FF\u200D\u2642", u"1F93E-1F3FF-200D-2642-FE0F", u"1F93E-1F3FF-200D-2642", 2761, 1, 15},
+    {u"\U0001F93E", u"", u"1F93E", u"", 2762, 1, 15},
+    {u"\U0001F93E\U0001F3FB", u"", u"1F93E-1F3FB", u"", 2763, 1, 15},
+    {u"\U0001F93E\U0001F3FC", u"", u"1F93E-1F3FC", u"", 2764, 1, 15},
+    {u"\U0001F93E\U0001F3FD", u"", u"1F93E-1F3FD", u"", 2765, 1, 15},
+    {u"\U0001F93E\U0001F3FE", u"", u"1F93E-1F3FE", u"", 2766, 1, 15},
+    {u"\U0001F93E\U0001F3FF", u"", u"1F93E-1F3FF", u"", 2767, 1, 15},
+    {u"\U0001F93F", u"", u"1F93F", u"", 2768, 1, 15},
+    {u"\U0001F940", u"", u"1F940", u"", 2769, 1, 15},
+    {u"\U0001F941", u"", u"1F941", u"", 2770, 1, 15},
+    {u"\U0001F942", u"", u"1F942", u"", 2771, 1, 15},
+    {u"\U0001F943", u"", u"1F943", u"", 2772, 1, 15},
+    {u"\U0001F944", u"", u"1F944", u"", 2773, 1, 15},
+    {u"\U0001F945", u"", u"1F945", u"", 2774, 1, 15},
+    {u"\U0001F947", u"", u"1F947", u"", 2775, 1, 15},
+    {u"\U0001F948", u"", u"1F948", u"", 2776, 1, 15},
+    {u"\U0001F949", u"", u"1F949", u"", 2777, 1, 15},
+    {u"\U0001F94A", u"", u"1F94A", u"", 2778, 1, 15},
+    {u"\U0001F94B", u"", u"1F94B", u"", 2779, 1, 15},
+    {u"\U0001F94C", u"", u"1F94C", u"", 2780, 1, 15},
+    {u"\U0001F94D", u"", u"1F94D", u"", 2781, 1, 15},
+    {u"\U0001F94E", u"", u"1F94E", u"", 2782, 1, 15},
+    {u"\U0001F94F", u"", u"1F94F", u"", 2783, 1, 15},
+    {u"\U0001F950", u"", u"1F950", u"", 2784, 1, 15},
+    {u"\U0001F951", u"", u"1F951", u"", 2785, 1, 15},
+    {u"\U0001F952", u"", u"1F952", u"", 2786, 1, 15},
+    {u"\U0001F953", u"", u"1F953", u"", 2787, 1, 15},
+    {u"\U0001F954", u"", u"1F954", u"", 2788, 1, 15},
+    {u"\U0001F955", u"", u"1F955", u"", 2789, 1, 15},
+    {u"\U0001F956", u"", u"1F956", u"", 2790, 1, 15},
+    {u"\U0001F957", u"", u"1F957", u"", 2791, 1, 15},
+    {u"\U0001F958", u"", u"1F958", u"", 2792, 1, 15},
+    {u"\U0001F959", u"", u"1F959", u"", 2793, 1, 15},
+    {u"\U0001F95A", u"", u"1F95A", u"", 2794, 1, 15},
+    {u"\U0001F95B", u"", u"1F95B", u"", 2795, 1, 15},
+    {u"\U0001F95C", u"", u"1F95C", u"", 2796, 1, 15},
+    {u"\U0001F95D", u"", u"1F95D", u"", 2797, 1, 15},
+    {u"\U0001F95E", u"", u"1F95E", u"", 2798, 1, 15},
+    {u"\U0001F95F", u"", u"1F95F", u"", 2799, 1, 15},
+    {u"\U0001F960", u"", u"1F960", u"", 2800, 1, 15},
+    {u"\U0001F961", u"", u"1F961", u"", 2801, 1, 15},
+    {u"\U0001F962", u"", u"1F962", u"", 2802, 1, 15},
+    {u"\U0001F963", u"", u"1F963", u"", 2803, 1, 15},
+    {u"\U0001F964", u"", u"1F964", u"", 2804, 1, 15},
+    {u"\U0001F965", u"", u"1F965", u"", 2805, 1, 15},
+    {u"\U0001F966", u"", u"1F966", u"", 2806, 1, 15},
+    {u"\U0001F967", u"", u"1F967", u"", 2807, 1, 15},
+    {u"\U0001F968", u"", u"1F968", u"", 2808, 1, 15},
+    {u"\U0001F969", u"", u"1F969", u"", 2809, 1, 15},
+    {u"\U0001F96A", u"", u"1F96A", u"", 2810, 1, 15},
+    {u"\U0001F96B", u"", u"1F96B", u"", 2811, 1, 15},
+    {u"\U0001F96C", u"", u"1F96C", u"", 2812, 1, 15},
+    {u"\U0001F96D", u"", u"1F96D", u"", 2813, 1, 15},
+    {u"\U0001F96E", u"", u"1F96E", u"", 2814, 1, 15},
+    {u"\U0001F96F", u"", u"1F96F", u"", 2815, 1, 15},
+    {u"\U0001F970", u"", u"1F970", u"", 2816, 1, 15},
+    {u"\U0001F971", u"", u"1F971", u"", 2817, 1, 15},
+    {u"\U0001F972", u"", u"1F972", u"", 2818, 1, 15},
+    {u"\U0001F973", u"", u"1F973", u"", 2819, 1, 15},
+    {u"\U0001F974", u"", u"1F974", u"", 2820, 1, 15},
+    {u"\U0001F975", u"", u"1F975", u"", 2821, 1, 15},
+    {u"\U0001F976", u"", u"1F976", u"", 2822, 1, 15},
+    {u"\U0001F977", u"", u"1F977", u"", 2823, 1, 15},
+    {u"\U0001F977\U0001F3FB", u"", u"1F977-1F3FB", u"", 2824, 1, 15},
+    {u"\U0001F977\U0001F3FC", u"", u"1F977-1F3FC", u"", 2825, 1, 15},
+    {u"\U0001F977\U0001F3FD", u"", u"1F977-1F3FD", u"", 2826, 1, 15},
+    {u"\U0001F977\U0001F3FE", u"", u"1F977-1F3FE", u"", 2827, 1, 15},
+    {u"\U0001F977\U0001F3FF", u"", u"1F977-1F3FF", u"", 2828, 1, 15},
+    {u"\U0001F978", u"", u"1F978", u"", 2829, 1, 15},
+    {u"\U0001F979", u"", u"1F979", u"", 2830, 1, 15},
+    {u"\U0001F97A", u"", u"1F97A", u"", 2831, 1, 15},
+    {u"\U0001F97B", u"", u"1F97B", u"", 2832, 1, 15},
+    {u"\U0001F97C", u"", u"1F97C", u"", 2833, 1, 15},
+    {u"\U0001F97D", u"", u"1F97D", u"", 2834, 1, 15},
+    {u"\U0001F97E", u"", u"1F97E", u"", 2835, 1, 15},
+    {u"\U0001F97F", u"", u"1F97F", u"", 2836, 1, 15},
+    {u"\U0001F980", u"", u"1F980", u"", 2837, 1, 15},
+    {u"\U0001F981", u"", u"1F981", u"", 2838, 1, 15},
+    {u"\U0001F982", u"", u"1F982", u"", 2839, 1, 15},
+    {u"\U0001F983", u"", u"1F983", u"", 2840, 1, 15},
+    {u"\U0001F984", u"", u"1F984", u"", 2841, 1, 15},
+    {u"\U0001F985", u"", u"1F985", u"", 2842, 1, 15},
+    {u"\U0001F986", u"", u"1F986", u"", 2843, 1, 15},
+    {u"\U0001F987", u"", u"1F987", u"", 2844, 1, 15},
+    {u"\U0001F988", u"", u"1F988", u"", 2845, 1, 15},
+    {u"\U0001F989", u"", u"1F989", u"", 2846, 1, 15},
+    {u"\U0001F98A", u"", u"1F98A", u"", 2847, 1, 15},
+    {u"\U0001F98B", u"", u"1F98B", u"", 2848, 1, 15},
+    {u"\U0001F98C", u"", u"1F98C", u"", 2849, 1, 15},
+    {u"\U0001F98D", u"", u"1F98D", u"", 2850, 1, 15},
+    {u"\U0001F98E", u"", u"1F98E", u"", 2851, 1, 15},
+    {u"\U0001F98F", u"", u"1F98F", u"", 2852, 1, 15},
+    {u"\U0001F990", u"", u"1F990", u"", 2853, 1, 15},
+    {u"\U0001F991", u"", u"1F991", u"", 2854, 1, 15},
+    {u"\U0001F992", u"", u"1F992", u"", 2855, 1, 15},
+    {u"\U0001F993", u"", u"1F993", u"", 2856, 1, 15},
+    {u"\U0001F994", u"", u"1F994", u"", 2857, 1, 15},
+    {u"\U0001F995", u"", u"1F995", u"", 2858, 1, 15},
+    {u"\U0001F996", u"", u"1F996", u"", 2859, 1, 15},
+    {u"\U0001F997", u"", u"1F997", u"", 2860, 1, 15},
+    {u"\U0001F998", u"", u"1F998", u"", 2861, 1, 15},
+    {u"\U0001F999", u"", u"1F999", u"", 2862, 1, 15},
+    {u"\U0001F99A", u"", u"1F99A", u"", 2863, 1, 15},
+    {u"\U0001F99B", u"", u"1F99B", u"", 2864, 1, 15},
+    {u"\U0001F99C", u"", u"1F99C", u"", 2865, 1, 15},
+    {u"\U0001F99D", u"", u"1F99D", u"", 2866, 1, 15},
+    {u"\U0001F99E", u"", u"1F99E", u"", 2867, 1, 15},
+    {u"\U0001F99F", u"", u"1F99F", u"", 2868, 1, 15},
+    {u"\U0001F9A0", u"", u"1F9A0", u"", 2869, 1, 15},
+    {u"\U0001F9A1", u"", u"1F9A1", u"", 2870, 1, 15},
+    {u"\U0001F9A2", u"", u"1F9A2", u"", 2871, 1, 15},
+    {u"\U0001F9A3", u"", u"1F9A3", u"", 2872, 1, 15},
+    {u"\U0001F9A4", u"", u"1F9A4", u"", 2873, 1, 15},
+    {u"\U0001F9A5", u"", u"1F9A5", u"", 2874, 1, 15},
+    {u"\U0001F9A6", u"", u"1F9A6", u"", 2875, 1, 15},
+    {u"\U0001F9A7", u"", u"1F9A7", u"", 2876, 1, 15},
+    {u"\U0001F9A8", u"", u"1F9A8", u"", 2877, 1, 15},
+    {u"\U0001F9A9", u"", u"1F9A9", u"", 2878, 1, 15},
+    {u"\U0001F9AA", u"", u"1F9AA", u"", 2879, 1, 15},
+    {u"\U0001F9AB", u"", u"1F9AB", u"", 2880, 1, 15},
+    {u"\U0001F9AC", u"", u"1F9AC", u"", 2881, 1, 15},
+    {u"\U0001F9AD", u"", u"1F9AD", u"", 2882, 1, 15},
+    {u"\U0001F9AE", u"", u"1F9AE", u"", 2883, 1, 15},
+    {u"\U0001F9AF", u"", u"1F9AF", u"", 2884, 1, 15},
+    {u"\U0001F9B4", u"", u"1F9B4", u"", 2885, 1, 15},
+    {u"\U0001F9B5", u"", u"1F9B5", u"", 2886, 1, 15},
+    {u"\U0001F9B5\U0001F3FB", u"", u"1F9B5-1F3FB", u"", 2887, 1, 15},
+    {u"\U0001F9B5\U0001F3FC", u"", u"1F9B5-1F3FC", u"", 2888, 1, 15},
+    {u"\U0001F9B5\U0001F3FD", u"", u"1F9B5-1F3FD", u"", 2889, 1, 15},
+    {u"\U0001F9B5\U0001F3FE", u"", u"1F9B5-1F3FE", u"", 2890, 1, 15},
+    {u"\U0001F9B5\U0001F3FF", u"", u"1F9B5-1F3FF", u"", 2891, 1, 15},
+    {u"\U0001F9B6", u"", u"1F9B6", u"", 2892, 1, 15},
+    {u"\U0001F9B6\U0001F3FB", u"", u"1F9B6-1F3FB", u"", 2893, 1, 15},
+    {u"\U0001F9B6\U0001F3FC", u"", u"1F9B6-1F3FC", u"", 2894, 1, 15},
+    {u"\U0001F9B6\U0001F3FD", u"", u"1F9B6-1F3FD", u"", 2895, 1, 15},
+    {u"\U0001F9B6\U0001F3FE", u"", u"1F9B6-1F3FE", u"", 2896, 1, 15},
+    {u"\U0001F9B6\U0001F3FF", u"", u"1F9B6-1F3FF", u"", 2897, 1, 15},
+    {u"\U0001F9B7", u"", u"1F9B7", u"", 2898, 1, 15},
+    {u"\U0001F9B8\u200D\u2640\uFE0F", u"\U0001F9B8\u200D\u2640", u"1F9B8-200D-2640-FE0F", u"1F9B8-200D-2640", 2899, 1, 15},
+    {u"\U0001F9B8\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F9B8\U0001F3FB\u200D\u2640", u"1F9B8-1F3FB-200D-2640-FE0F", u"1F9B8-1F3FB-200D-2640", 2900, 1, 15},
+    {u"\U0001F9B8\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F9B8\U0001F3FC\u200D\u2640", u"1F9B8-1F3FC-200D-2640-FE0F", u"1F9B8-1F3FC-200D-2640", 2901, 1, 15},
+    {u"\U0001F9B8\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F9B8\U0001F3FD\u200D\u2640", u"1F9B8-1F3FD-200D-2640-FE0F", u"1F9B8-1F3FD-200D-2640", 2902, 1, 15},
+    {u"\U0001F9B8\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F9B8\U0001F3FE\u200D\u2640", u"1F9B8-1F3FE-200D-2640-FE0F", u"1F9B8-1F3FE-200D-2640", 2903, 1, 15},
+    {u"\U0001F9B8\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F9B8\U0001F3FF\u200D\u2640", u"1F9B8-1F3FF-200D-2640-FE0F", u"1F9B8-1F3FF-200D-2640", 2904, 1, 15},
+    {u"\U0001F9B8\u200D\u2642\uFE0F", u"\U0001F9B8\u200D\u2642", u"1F9B8-200D-2642-FE0F", u"1F9B8-200D-2642", 2905, 1, 15},
+    {u"\U0001F9B8\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F9B8\U0001F3FB\u200D\u2642", u"1F9B8-1F3FB-200D-2642-FE0F", u"1F9B8-1F3FB-200D-2642", 2906, 1, 15},
+    {u"\U0001F9B8\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F9B8\U0001F3FC\u200D\u2642", u"1F9B8-1F3FC-200D-2642-FE0F", u"1F9B8-1F3FC-200D-2642", 2907, 1, 15},
+    {u"\U0001F9B8\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F9B8\U0001F3FD\u200D\u2642", u"1F9B8-1F3FD-200D-2642-FE0F", u"1F9B8-1F3FD-200D-2642", 2908, 1, 15},
+    {u"\U0001F9B8\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F9B8\U0001F3FE\u200D\u2642", u"1F9B8-1F3FE-200D-2642-FE0F", u"1F9B8-1F3FE-200D-2642", 2909, 1, 15},
+    {u"\U0001F9B8\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F9B8\U0001F3FF\u200D\u2642", u"1F9B8-1F3FF-200D-2642-FE0F", u"1F9B8-1F3FF-200D-2642", 2910, 1, 15},
+    {u"\U0001F9B8", u"", u"1F9B8", u"", 2911, 1, 15},
+    {u"\U0001F9B8\U0001F3FB", u"", u"1F9B8-1F3FB", u"", 2912, 1, 15},
+    {u"\U0001F9B8\U0001F3FC", u"", u"1F9B8-1F3FC", u"", 2913, 1, 15},
+    {u"\U0001F9B8\U0001F3FD", u"", u"1F9B8-1F3FD", u"", 2914, 1, 15},
+    {u"\U0001F9B8\U0001F3FE", u"", u"1F9B8-1F3FE", u"", 2915, 1, 15},
+    {u"\U0001F9B8\U0001F3FF", u"", u"1F9B8-1F3FF", u"", 2916, 1, 15},
+    {u"\U0001F9B9\u200D\u2640\uFE0F", u"\U0001F9B9\u200D\u2640", u"1F9B9-200D-2640-FE0F", u"1F9B9-200D-2640", 2917, 1, 15},
+    {u"\U0001F9B9\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F9B9\U0001F3FB\u200D\u2640", u"1F9B9-1F3FB-200D-2640-FE0F", u"1F9B9-1F3FB-200D-2640", 2918, 1, 15},
+    {u"\U0001F9B9\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F9B9\U0001F3FC\u200D\u2640", u"1F9B9-1F3FC-200D-2640-FE0F", u"1F9B9-1F3FC-200D-2640", 2919, 1, 15},
+    {u"\U0001F9B9\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F9B9\U0001F3FD\u200D\u2640", u"1F9B9-1F3FD-200D-2640-FE0F", u"1F9B9-1F3FD-200D-2640", 2920, 1, 15},
+    {u"\U0001F9B9\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F9B9\U0001F3FE\u200D\u2640", u"1F9B9-1F3FE-200D-2640-FE0F", u"1F9B9-1F3FE-200D-2640", 2921, 1, 15},
+    {u"\U0001F9B9\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F9B9\U0001F3FF\u200D\u2640", u"1F9B9-1F3FF-200D-2640-FE0F", u"1F9B9-1F3FF-200D-2640", 2922, 1, 15},
+    {u"\U0001F9B9\u200D\u2642\uFE0F", u"\U0001F9B9\u200D\u2642", u"1F9B9-200D-2642-FE0F", u"1F9B9-200D-2642", 2923, 1, 15},
+    {u"\U0001F9B9\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F9B9\U0001F3FB\u200D\u2642", u"1F9B9-1F3FB-200D-2642-FE0F", u"1F9B9-1F3FB-200D-2642", 2924, 1, 15},
+    {u"\U0001F9B9\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F9B9\U0001F3FC\u200D\u2642", u"1F9B9-1F3FC-200D-2642-FE0F", u"1F9B9-1F3FC-200D-2642", 2925, 1, 15},
+    {u"\U0001F9B9\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F9B9\U0001F3FD\u200D\u2642", u"1F9B9-1F3FD-200D-2642-FE0F", u"1F9B9-1F3FD-200D-2642", 2926, 1, 15},
+    {u"\U0001F9B9\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F9B9\U0001F3FE\u200D\u2642", u"1F9B9-1F3FE-200D-2642-FE0F", u"1F9B9-1F3FE-200D-2642", 2927, 1, 15},
+    {u"\U0001F9B9\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F9B9\U0001F3FF\u200D\u2642", u"1F9B9-1F3FF-200D-2642-FE0F", u"1F9B9-1F3FF-200D-2642", 2928, 1, 15},
+    {u"\U0001F9B9", u"", u"1F9B9", u"", 2929, 1, 15},
+    {u"\U0001F9B9\U0001F3FB", u"", u"1F9B9-1F3FB", u"", 2930, 1, 15},
+    {u"\U0001F9B9\U0001F3FC", u"", u"1F9B9-1F3FC", u"", 2931, 1, 15},
+    {u"\U0001F9B9\U0001F3FD", u"", u"1F9B9-1F3FD", u"", 2932, 1, 15},
+    {u"\U0001F9B9\U0001F3FE", u"", u"1F9B9-1F3FE", u"", 2933, 1, 15},
+    {u"\U0001F9B9\U0001F3FF", u"", u"1F9B9-1F3FF", u"", 2934, 1, 15},
+    {u"\U0001F9BA", u"", u"1F9BA", u"", 2935, 1, 15},
+    {u"\U0001F9BB", u"", u"1F9BB", u"", 2936, 1, 15},
+    {u"\U0001F9BB\U0001F3FB", u"", u"1F9BB-1F3FB", u"", 2937, 1, 15},
+    {u"\U0001F9BB\U0001F3FC", u"", u"1F9BB-1F3FC", u"", 2938, 1, 15},
+    {u"\U0001F9BB\U0001F3FD", u"", u"1F9BB-1F3FD", u"", 2939, 1, 15},
+    {u"\U0001F9BB\U0001F3FE", u"", u"1F9BB-1F3FE", u"", 2940, 1, 15},
+    {u"\U0001F9BB\U0001F3FF", u"", u"1F9BB-1F3FF", u"", 2941, 1, 15},
+    {u"\U0001F9BC", u"", u"1F9BC", u"", 2942, 1, 15},
+    {u"\U0001F9BD", u"", u"1F9BD", u"", 2943, 1, 15},
+    {u"\U0001F9BE", u"", u"1F9BE", u"", 2944, 1, 15},
+    {u"\U0001F9BF", u"", u"1F9BF", u"", 2945, 1, 15},
+    {u"\U0001F9C0", u"", u"1F9C0", u"", 2946, 1, 15},
+    {u"\U0001F9C1", u"", u"1F9C1", u"", 2947, 1, 15},
+    {u"\U0001F9C2", u"", u"1F9C2", u"", 2948, 1, 15},
+    {u"\U0001F9C3", u"", u"1F9C3", u"", 2949, 1, 15},
+    {u"\U0001F9C4", u"", u"1F9C4", u"", 2950, 1, 15},
+    {u"\U0001F9C5", u"", u"1F9C5", u"", 2951, 1, 15},
+    {u"\U0001F9C6", u"", u"1F9C6", u"", 2952, 1, 15},
+    {u"\U0001F9C7", u"", u"1F9C7", u"", 2953, 1, 15},
+    {u"\U0001F9C8", u"", u"1F9C8", u"", 2954, 1, 15},
+    {u"\U0001F9C9", u"", u"1F9C9", u"", 2955, 1, 15},
+    {u"\U0001F9CA", u"", u"1F9CA", u"", 2956, 1, 15},
+    {u"\U0001F9CB", u"", u"1F9CB", u"", 2957, 1, 15},
+    {u"\U0001F9CC", u"", u"1F9CC", u"", 2958, 1, 15},
+    {u"\U0001F9CD\u200D\u2640\uFE0F", u"\U0001F9CD\u200D\u2640", u"1F9CD-200D-2640-FE0F", u"1F9CD-200D-2640", 2959, 1, 15},
+    {u"\U0001F9CD\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F9CD\U0001F3FB\u200D\u2640", u"1F9CD-1F3FB-200D-2640-FE0F", u"1F9CD-1F3FB-200D-2640", 2960, 1, 15},
+    {u"\U0001F9CD\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F9CD\U0001F3FC\u200D\u2640", u"1F9CD-1F3FC-200D-2640-FE0F", u"1F9CD-1F3FC-200D-2640", 2961, 1, 15},
+    {u"\U0001F9CD\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F9CD\U0001F3FD\u200D\u2640", u"1F9CD-1F3FD-200D-2640-FE0F", u"1F9CD-1F3FD-200D-2640", 2962, 1, 15},
+    {u"\U0001F9CD\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F9CD\U0001F3FE\u200D\u2640", u"1F9CD-1F3FE-200D-2640-FE0F", u"1F9CD-1F3FE-200D-2640", 2963, 1, 15},
+    {u"\U0001F9CD\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F9CD\U0001F3FF\u200D\u2640", u"1F9CD-1F3FF-200D-2640-FE0F", u"1F9CD-1F3FF-200D-2640", 2964, 1, 15},
+    {u"\U0001F9CD\u200D\u2642\uFE0F", u"\U0001F9CD\u200D\u2642", u"1F9CD-200D-2642-FE0F", u"1F9CD-200D-2642", 2965, 1, 15},
+    {u"\U0001F9CD\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F9CD\U0001F3FB\u200D\u2642", u"1F9CD-1F3FB-200D-2642-FE0F", u"1F9CD-1F3FB-200D-2642", 2966, 1, 15},
+    {u"\U0001F9CD\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F9CD\U0001F3FC\u200D\u2642", u"1F9CD-1F3FC-200D-2642-FE0F", u"1F9CD-1F3FC-200D-2642", 2967, 1, 15},
+    {u"\U0001F9CD\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F9CD\U0001F3FD\u200D\u2642", u"1F9CD-1F3FD-200D-2642-FE0F", u"1F9CD-1F3FD-200D-2642", 2968, 1, 15},
+    {u"\U0001F9CD\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F9CD\U0001F3FE\u200D\u2642", u"1F9CD-1F3FE-200D-2642-FE0F", u"1F9CD-1F3FE-200D-2642", 2969, 1, 15},
+    {u"\U0001F9CD\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F9CD\U0001F3FF\u200D\u2642", u"1F9CD-1F3FF-200D-2642-FE0F", u"1F9CD-1F3FF-200D-2642", 2970, 1, 15},
+    {u"\U0001F9CD", u"", u"1F9CD", u"", 2971, 1, 15},
+    {u"\U0001F9CD\U0001F3FB", u"", u"1F9CD-1F3FB", u"", 2972, 1, 15},
+    {u"\U0001F9CD\U0001F3FC", u"", u"1F9CD-1F3FC", u"", 2973, 1, 15},
+    {u"\U0001F9CD\U0001F3FD", u"", u"1F9CD-1F3FD", u"", 2974, 1, 15},
+    {u"\U0001F9CD\U0001F3FE", u"", u"1F9CD-1F3FE", u"", 2975, 1, 15},
+    {u"\U0001F9CD\U0001F3FF", u"", u"1F9CD-1F3FF", u"", 2976, 1, 15},
+    {u"\U0001F9CE\u200D\u2640\uFE0F", u"\U0001F9CE\u200D\u2640", u"1F9CE-200D-2640-FE0F", u"1F9CE-200D-2640", 2977, 1, 15},
+    {u"\U0001F9CE\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F9CE\U0001F3FB\u200D\u2640", u"1F9CE-1F3FB-200D-2640-FE0F", u"1F9CE-1F3FB-200D-2640", 2978, 1, 15},
+    {u"\U0001F9CE\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F9CE\U0001F3FC\u200D\u2640", u"1F9CE-1F3FC-200D-2640-FE0F", u"1F9CE-1F3FC-200D-2640", 2979, 1, 15},
+    {u"\U0001F9CE\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F9CE\U0001F3FD\u200D\u2640", u"1F9CE-1F3FD-200D-2640-FE0F", u"1F9CE-1F3FD-200D-2640", 2980, 1, 15},
+    {u"\U0001F9CE\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F9CE\U0001F3FE\u200D\u2640", u"1F9CE-1F3FE-200D-2640-FE0F", u"1F9CE-1F3FE-200D-2640", 2981, 1, 15},
+    {u"\U0001F9CE\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F9CE\U0001F3FF\u200D\u2640", u"1F9CE-1F3FF-200D-2640-FE0F", u"1F9CE-1F3FF-200D-2640", 2982, 1, 15},
+    {u"\U0001F9CE\u200D\u2640\uFE0F\u200D\u27A1\uFE0F", u"\U0001F9CE\u200D\u2640\u200D\u27A1", u"1F9CE-200D-2640-FE0F-200D-27A1-FE0F", u"1F9CE-200D-2640-200D-27A1", 2983, 1, 7},
+    {u"\U0001F9CE\U0001F3FB\u200D\u2640\uFE0F\u200D\u27A1\uFE0F", u"\U0001F9CE\U0001F3FB\u200D\u2640\u200D\u27A1", u"1F9CE-1F3FB-200D-2640-FE0F-200D-27A1-FE0F", u"1F9CE-1F3FB-200D-2640-200D-27A1", 2984, 1, 7},
+    {u"\U0001F9CE\U0001F3FC\u200D\u2640\uFE0F\u200D\u27A1\uFE0F", u"\U0001F9CE\U0001F3FC\u200D\u2640\u200D\u27A1", u"1F9CE-1F3FC-200D-2640-FE0F-200D-27A1-FE0F", u"1F9CE-1F3FC-200D-2640-200D-27A1", 2985, 1, 7},
+    {u"\U0001F9CE\U0001F3FD\u200D\u2640\uFE0F\u200D\u27A1\uFE0F", u"\U0001F9CE\U0001F3FD\u200D\u2640\u200D\u27A1", u"1F9CE-1F3FD-200D-2640-FE0F-200D-27A1-FE0F", u"1F9CE-1F3FD-200D-2640-200D-27A1", 2986, 1, 7},
+    {u"\U0001F9CE\U0001F3FE\u200D\u2640\uFE0F\u200D\u27A1\uFE0F", u"\U0001F9CE\U0001F3FE\u200D\u2640\u200D\u27A1", u"1F9CE-1F3FE-200D-2640-FE0F-200D-27A1-FE0F", u"1F9CE-1F3FE-200D-2640-200D-27A1", 2987, 1, 7},
+    {u"\U0001F9CE\U0001F3FF\u200D\u2640\uFE0F\u200D\u27A1\uFE0F", u"\U0001F9CE\U0001F3FF\u200D\u2640\u200D\u27A1", u"1F9CE-1F3FF-200D-2640-FE0F-200D-27A1-FE0F", u"1F9CE-1F3FF-200D-2640-200D-27A1", 2988, 1, 7},
+    {u"\U0001F9CE\u200D\u2642\uFE0F", u"\U0001F9CE\u200D\u2642", u"1F9CE-200D-2642-FE0F", u"1F9CE-200D-2642", 2989, 1, 15},
+    {u"\U0001F9CE\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F9CE\U0001F3FB\u200D\u2642", u"1F9CE-1F3FB-200D-2642-FE0F", u"1F9CE-1F3FB-200D-2642", 2990, 1, 15},
+    {u"\U0001F9CE\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F9CE\U0001F3FC\u200D\u2642", u"1F9CE-1F3FC-200D-2642-FE0F", u"1F9CE-1F3FC-200D-2642", 2991, 1, 15},
+    {u"\U0001F9CE\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F9CE\U0001F3FD\u200D\u2642", u"1F9CE-1F3FD-200D-2642-FE0F", u"1F9CE-1F3FD-200D-2642", 2992, 1, 15},
+    {u"\U0001F9CE\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F9CE\U0001F3FE\u200D\u2642", u"1F9CE-1F3FE-200D-2642-FE0F", u"1F9CE-1F3FE-200D-2642", 2993, 1, 15},
+    {u"\U0001F9CE\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F9CE\U0001F3FF\u200D\u2642", u"1F9CE-1F3FF-200D-2642-FE0F", u"1F9CE-1F3FF-200D-2642", 2994, 1, 15},
+    {u"\U0001F9CE\u200D\u2642\uFE0F\u200D\u27A1\uFE0F", u"\U0001F9CE\u200D\u2642\u200D\u27A1", u"1F9CE-200D-2642-FE0F-200D-27A1-FE0F", u"1F9CE-200D-2642-200D-27A1", 2995, 1, 7},
+    {u"\U0001F9CE\U0001F3FB\u200D\u2642\uFE0F\u200D\u27A1\uFE0F", u"\U0001F9CE\U0001F3FB\u200D\u2642\u200D\u27A1", u"1F9CE-1F3FB-200D-2642-FE0F-200D-27A1-FE0F", u"1F9CE-1F3FB-200D-2642-200D-27A1", 2996, 1, 7},
+    {u"\U0001F9CE\U0001F3FC\u200D\u2642\uFE0F\u200D\u27A1\uFE0F", u"\U0001F9CE\U0001F3FC\u200D\u2642\u200D\u27A1", u"1F9CE-1F3FC-200D-2642-FE0F-200D-27A1-FE0F", u"1F9CE-1F3FC-200D-2642-200D-27A1", 2997, 1, 7},
+    {u"\U0001F9CE\U0001F3FD\u200D\u2642\uFE0F\u200D\u27A1\uFE0F", u"\U0001F9CE\U0001F3FD\u200D\u2642\u200D\u27A1", u"1F9CE-1F3FD-200D-2642-FE0F-200D-27A1-FE0F", u"1F9CE-1F3FD-200D-2642-200D-27A1", 2998, 1, 7},
+    {u"\U0001F9CE\U0001F3FE\u200D\u2642\uFE0F\u200D\u27A1\uFE0F", u"\U0001F9CE\U0001F3FE\u200D\u2642\u200D\u27A1", u"1F9CE-1F3FE-200D-2642-FE0F-200D-27A1-FE0F", u"1F9CE-1F3FE-200D-2642-200D-27A1", 2999, 1, 7},
+    {u"\U0001F9CE\U0001F3FF\u200D\u2642\uFE0F\u200D\u27A1\uFE0F", u"\U0001F9CE\U0001F3FF\u200D\u2642\u200D\u27A1", u"1F9CE-1F3FF-200D-2642-FE0F-200D-27A1-FE0F", u"1F9CE-1F3FF-200D-2642-200D-27A1", 3000, 1, 7},
+    {u"\U0001F9CE\u200D\u27A1\uFE0F", u"\U0001F9CE\u200D\u27A1", u"1F9CE-200D-27A1-FE0F", u"1F9CE-200D-27A1", 3001, 1, 7},
+    {u"\U0001F9CE\U0001F3FB\u200D\u27A1\uFE0F", u"\U0001F9CE\U0001F3FB\u200D\u27A1", u"1F9CE-1F3FB-200D-27A1-FE0F", u"1F9CE-1F3FB-200D-27A1", 3002, 1, 7},
+    {u"\U0001F9CE\U0001F3FC\u200D\u27A1\uFE0F", u"\U0001F9CE\U0001F3FC\u200D\u27A1", u"1F9CE-1F3FC-200D-27A1-FE0F", u"1F9CE-1F3FC-200D-27A1", 3003, 1, 7},
+    {u"\U0001F9CE\U0001F3FD\u200D\u27A1\uFE0F", u"\U0001F9CE\U0001F3FD\u200D\u27A1", u"1F9CE-1F3FD-200D-27A1-FE0F", u"1F9CE-1F3FD-200D-27A1", 3004, 1, 7},
+    {u"\U0001F9CE\U0001F3FE\u200D\u27A1\uFE0F", u"\U0001F9CE\U0001F3FE\u200D\u27A1", u"1F9CE-1F3FE-200D-27A1-FE0F", u"1F9CE-1F3FE-200D-27A1", 3005, 1, 7},
+    {u"\U0001F9CE\U0001F3FF\u200D\u27A1\uFE0F", u"\U0001F9CE\U0001F3FF\u200D\u27A1", u"1F9CE-1F3FF-200D-27A1-FE0F", u"1F9CE-1F3FF-200D-27A1", 3006, 1, 7},
+    {u"\U0001F9CE", u"", u"1F9CE", u"", 3007, 1, 15},
+    {u"\U0001F9CE\U0001F3FB", u"", u"1F9CE-1F3FB", u"", 3008, 1, 15},
+    {u"\U0001F9CE\U0001F3FC", u"", u"1F9CE-1F3FC", u"", 3009, 1, 15},
+    {u"\U0001F9CE\U0001F3FD", u"", u"1F9CE-1F3FD", u"", 3010, 1, 15},
+    {u"\U0001F9CE\U0001F3FE", u"", u"1F9CE-1F3FE", u"", 3011, 1, 15},
+    {u"\U0001F9CE\U0001F3FF", u"", u"1F9CE-1F3FF", u"", 3012, 1, 15},
+    {u"\U0001F9CF\u200D\u2640\uFE0F", u"\U0001F9CF\u200D\u2640", u"1F9CF-200D-2640-FE0F", u"1F9CF-200D-2640", 3013, 1, 15},
+    {u"\U0001F9CF\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F9CF\U0001F3FB\u200D\u2640", u"1F9CF-1F3FB-200D-2640-FE0F", u"1F9CF-1F3FB-200D-2640", 3014, 1, 15},
+    {u"\U0001F9CF\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F9CF\U0001F3FC\u200D\u2640", u"1F9CF-1F3FC-200D-2640-FE0F", u"1F9CF-1F3FC-200D-2640", 3015, 1, 15},
+    {u"\U0001F9CF\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F9CF\U0001F3FD\u200D\u2640", u"1F9CF-1F3FD-200D-2640-FE0F", u"1F9CF-1F3FD-200D-2640", 3016, 1, 15},
+    {u"\U0001F9CF\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F9CF\U0001F3FE\u200D\u2640", u"1F9CF-1F3FE-200D-2640-FE0F", u"1F9CF-1F3FE-200D-2640", 3017, 1, 15},
+    {u"\U0001F9CF\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F9CF\U0001F3FF\u200D\u2640", u"1F9CF-1F3FF-200D-2640-FE0F", u"1F9CF-1F3FF-200D-2640", 3018, 1, 15},
+    {u"\U0001F9CF\u200D\u2642\uFE0F", u"\U0001F9CF\u200D\u2642", u"1F9CF-200D-2642-FE0F", u"1F9CF-200D-2642", 3019, 1, 15},
+    {u"\U0001F9CF\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F9CF\U0001F3FB\u200D\u2642", u"1F9CF-1F3FB-200D-2642-FE0F", u"1F9CF-1F3FB-200D-2642", 3020, 1, 15},
+    {u"\U0001F9CF\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F9CF\U0001F3FC\u200D\u2642", u"1F9CF-1F3FC-200D-2642-FE0F", u"1F9CF-1F3FC-200D-2642", 3021, 1, 15},
+    {u"\U0001F9CF\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F9CF\U0001F3FD\u200D\u2642", u"1F9CF-1F3FD-200D-2642-FE0F", u"1F9CF-1F3FD-200D-2642", 3022, 1, 15},
+    {u"\U0001F9CF\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F9CF\U0001F3FE\u200D\u2642", u"1F9CF-1F3FE-200D-2642-FE0F", u"1F9CF-1F3FE-200D-2642", 3023, 1, 15},
+    {u"\U0001F9CF\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F9CF\U0001F3FF\u200D\u2642", u"1F9CF-1F3FF-200D-2642-FE0F", u"1F9CF-1F3FF-200D-2642", 3024, 1, 15},
+    {u"\U0001F9CF", u"", u"1F9CF", u"", 3025, 1, 15},
+    {u"\U0001F9CF\U0001F3FB", u"", u"1F9CF-1F3FB", u"", 3026, 1, 15},
+    {u"\U0001F9CF\U0001F3FC", u"", u"1F9CF-1F3FC", u"", 3027, 1, 15},
+    {u"\U0001F9CF\U0001F3FD", u"", u"1F9CF-1F3FD", u"", 3028, 1, 15},
+    {u"\U0001F9CF\U0001F3FE", u"", u"1F9CF-1F3FE", u"", 3029, 1, 15},
+    {u"\U0001F9CF\U0001F3FF", u"", u"1F9CF-1F3FF", u"", 3030, 1, 15},
+    {u"\U0001F9D0", u"", u"1F9D0", u"", 3031, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F33E", u"", u"1F9D1-200D-1F33E", u"", 3032, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F33E", u"", u"1F9D1-1F3FB-200D-1F33E", u"", 3033, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F33E", u"", u"1F9D1-1F3FC-200D-1F33E", u"", 3034, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F33E", u"", u"1F9D1-1F3FD-200D-1F33E", u"", 3035, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F33E", u"", u"1F9D1-1F3FE-200D-1F33E", u"", 3036, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F33E", u"", u"1F9D1-1F3FF-200D-1F33E", u"", 3037, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F373", u"", u"1F9D1-200D-1F373", u"", 3038, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F373", u"", u"1F9D1-1F3FB-200D-1F373", u"", 3039, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F373", u"", u"1F9D1-1F3FC-200D-1F373", u"", 3040, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F373", u"", u"1F9D1-1F3FD-200D-1F373", u"", 3041, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F373", u"", u"1F9D1-1F3FE-200D-1F373", u"", 3042, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F373", u"", u"1F9D1-1F3FF-200D-1F373", u"", 3043, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F37C", u"", u"1F9D1-200D-1F37C", u"", 3044, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F37C", u"", u"1F9D1-1F3FB-200D-1F37C", u"", 3045, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F37C", u"", u"1F9D1-1F3FC-200D-1F37C", u"", 3046, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F37C", u"", u"1F9D1-1F3FD-200D-1F37C", u"", 3047, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F37C", u"", u"1F9D1-1F3FE-200D-1F37C", u"", 3048, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F37C", u"", u"1F9D1-1F3FF-200D-1F37C", u"", 3049, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F384", u"", u"1F9D1-200D-1F384", u"", 3050, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F384", u"", u"1F9D1-1F3FB-200D-1F384", u"", 3051, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F384", u"", u"1F9D1-1F3FC-200D-1F384", u"", 3052, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F384", u"", u"1F9D1-1F3FD-200D-1F384", u"", 3053, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F384", u"", u"1F9D1-1F3FE-200D-1F384", u"", 3054, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F384", u"", u"1F9D1-1F3FF-200D-1F384", u"", 3055, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F393", u"", u"1F9D1-200D-1F393", u"", 3056, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F393", u"", u"1F9D1-1F3FB-200D-1F393", u"", 3057, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F393", u"", u"1F9D1-1F3FC-200D-1F393", u"", 3058, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F393", u"", u"1F9D1-1F3FD-200D-1F393", u"", 3059, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F393", u"", u"1F9D1-1F3FE-200D-1F393", u"", 3060, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F393", u"", u"1F9D1-1F3FF-200D-1F393", u"", 3061, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F3A4", u"", u"1F9D1-200D-1F3A4", u"", 3062, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F3A4", u"", u"1F9D1-1F3FB-200D-1F3A4", u"", 3063, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F3A4", u"", u"1F9D1-1F3FC-200D-1F3A4", u"", 3064, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F3A4", u"", u"1F9D1-1F3FD-200D-1F3A4", u"", 3065, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F3A4", u"", u"1F9D1-1F3FE-200D-1F3A4", u"", 3066, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F3A4", u"", u"1F9D1-1F3FF-200D-1F3A4", u"", 3067, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F3A8", u"", u"1F9D1-200D-1F3A8", u"", 3068, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F3A8", u"", u"1F9D1-1F3FB-200D-1F3A8", u"", 3069, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F3A8", u"", u"1F9D1-1F3FC-200D-1F3A8", u"", 3070, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F3A8", u"", u"1F9D1-1F3FD-200D-1F3A8", u"", 3071, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F3A8", u"", u"1F9D1-1F3FE-200D-1F3A8", u"", 3072, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F3A8", u"", u"1F9D1-1F3FF-200D-1F3A8", u"", 3073, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F3EB", u"", u"1F9D1-200D-1F3EB", u"", 3074, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F3EB", u"", u"1F9D1-1F3FB-200D-1F3EB", u"", 3075, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F3EB", u"", u"1F9D1-1F3FC-200D-1F3EB", u"", 3076, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F3EB", u"", u"1F9D1-1F3FD-200D-1F3EB", u"", 3077, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F3EB", u"", u"1F9D1-1F3FE-200D-1F3EB", u"", 3078, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F3EB", u"", u"1F9D1-1F3FF-200D-1F3EB", u"", 3079, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F3ED", u"", u"1F9D1-200D-1F3ED", u"", 3080, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F3ED", u"", u"1F9D1-1F3FB-200D-1F3ED", u"", 3081, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F3ED", u"", u"1F9D1-1F3FC-200D-1F3ED", u"", 3082, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F3ED", u"", u"1F9D1-1F3FD-200D-1F3ED", u"", 3083, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F3ED", u"", u"1F9D1-1F3FE-200D-1F3ED", u"", 3084, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F3ED", u"", u"1F9D1-1F3FF-200D-1F3ED", u"", 3085, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F4BB", u"", u"1F9D1-200D-1F4BB", u"", 3086, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F4BB", u"", u"1F9D1-1F3FB-200D-1F4BB", u"", 3087, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F4BB", u"", u"1F9D1-1F3FC-200D-1F4BB", u"", 3088, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F4BB", u"", u"1F9D1-1F3FD-200D-1F4BB", u"", 3089, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F4BB", u"", u"1F9D1-1F3FE-200D-1F4BB", u"", 3090, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F4BB", u"", u"1F9D1-1F3FF-200D-1F4BB", u"", 3091, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F4BC", u"", u"1F9D1-200D-1F4BC", u"", 3092, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F4BC", u"", u"1F9D1-1F3FB-200D-1F4BC", u"", 3093, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F4BC", u"", u"1F9D1-1F3FC-200D-1F4BC", u"", 3094, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F4BC", u"", u"1F9D1-1F3FD-200D-1F4BC", u"", 3095, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F4BC", u"", u"1F9D1-1F3FE-200D-1F4BC", u"", 3096, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F4BC", u"", u"1F9D1-1F3FF-200D-1F4BC", u"", 3097, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F527", u"", u"1F9D1-200D-1F527", u"", 3098, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F527", u"", u"1F9D1-1F3FB-200D-1F527", u"", 3099, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F527", u"", u"1F9D1-1F3FC-200D-1F527", u"", 3100, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F527", u"", u"1F9D1-1F3FD-200D-1F527", u"", 3101, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F527", u"", u"1F9D1-1F3FE-200D-1F527", u"", 3102, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F527", u"", u"1F9D1-1F3FF-200D-1F527", u"", 3103, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F52C", u"", u"1F9D1-200D-1F52C", u"", 3104, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F52C", u"", u"1F9D1-1F3FB-200D-1F52C", u"", 3105, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F52C", u"", u"1F9D1-1F3FC-200D-1F52C", u"", 3106, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F52C", u"", u"1F9D1-1F3FD-200D-1F52C", u"", 3107, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F52C", u"", u"1F9D1-1F3FE-200D-1F52C", u"", 3108, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F52C", u"", u"1F9D1-1F3FF-200D-1F52C", u"", 3109, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F680", u"", u"1F9D1-200D-1F680", u"", 3110, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F680", u"", u"1F9D1-1F3FB-200D-1F680", u"", 3111, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F680", u"", u"1F9D1-1F3FC-200D-1F680", u"", 3112, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F680", u"", u"1F9D1-1F3FD-200D-1F680", u"", 3113, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F680", u"", u"1F9D1-1F3FE-200D-1F680", u"", 3114, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F680", u"", u"1F9D1-1F3FF-200D-1F680", u"", 3115, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F692", u"", u"1F9D1-200D-1F692", u"", 3116, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F692", u"", u"1F9D1-1F3FB-200D-1F692", u"", 3117, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F692", u"", u"1F9D1-1F3FC-200D-1F692", u"", 3118, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F692", u"", u"1F9D1-1F3FD-200D-1F692", u"", 3119, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F692", u"", u"1F9D1-1F3FE-200D-1F692", u"", 3120, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F692", u"", u"1F9D1-1F3FF-200D-1F692", u"", 3121, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F91D\u200D\U0001F9D1", u"", u"1F9D1-200D-1F91D-200D-1F9D1", u"", 3122, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FB", u"", u"1F9D1-1F3FB-200D-1F91D-200D-1F9D1-1F3FB", u"", 3123, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FC", u"", u"1F9D1-1F3FB-200D-1F91D-200D-1F9D1-1F3FC", u"", 3124, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FD", u"", u"1F9D1-1F3FB-200D-1F91D-200D-1F9D1-1F3FD", u"", 3125, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FE", u"", u"1F9D1-1F3FB-200D-1F91D-200D-1F9D1-1F3FE", u"", 3126, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FF", u"", u"1F9D1-1F3FB-200D-1F91D-200D-1F9D1-1F3FF", u"", 3127, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FB", u"", u"1F9D1-1F3FC-200D-1F91D-200D-1F9D1-1F3FB", u"", 3128, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FC", u"", u"1F9D1-1F3FC-200D-1F91D-200D-1F9D1-1F3FC", u"", 3129, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FD", u"", u"1F9D1-1F3FC-200D-1F91D-200D-1F9D1-1F3FD", u"", 3130, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FE", u"", u"1F9D1-1F3FC-200D-1F91D-200D-1F9D1-1F3FE", u"", 3131, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FF", u"", u"1F9D1-1F3FC-200D-1F91D-200D-1F9D1-1F3FF", u"", 3132, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FB", u"", u"1F9D1-1F3FD-200D-1F91D-200D-1F9D1-1F3FB", u"", 3133, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FC", u"", u"1F9D1-1F3FD-200D-1F91D-200D-1F9D1-1F3FC", u"", 3134, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FD", u"", u"1F9D1-1F3FD-200D-1F91D-200D-1F9D1-1F3FD", u"", 3135, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FE", u"", u"1F9D1-1F3FD-200D-1F91D-200D-1F9D1-1F3FE", u"", 3136, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FF", u"", u"1F9D1-1F3FD-200D-1F91D-200D-1F9D1-1F3FF", u"", 3137, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FB", u"", u"1F9D1-1F3FE-200D-1F91D-200D-1F9D1-1F3FB", u"", 3138, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FC", u"", u"1F9D1-1F3FE-200D-1F91D-200D-1F9D1-1F3FC", u"", 3139, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FD", u"", u"1F9D1-1F3FE-200D-1F91D-200D-1F9D1-1F3FD", u"", 3140, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FE", u"", u"1F9D1-1F3FE-200D-1F91D-200D-1F9D1-1F3FE", u"", 3141, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FF", u"", u"1F9D1-1F3FE-200D-1F91D-200D-1F9D1-1F3FF", u"", 3142, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FB", u"", u"1F9D1-1F3FF-200D-1F91D-200D-1F9D1-1F3FB", u"", 3143, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FC", u"", u"1F9D1-1F3FF-200D-1F91D-200D-1F9D1-1F3FC", u"", 3144, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FD", u"", u"1F9D1-1F3FF-200D-1F91D-200D-1F9D1-1F3FD", u"", 3145, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FE", u"", u"1F9D1-1F3FF-200D-1F91D-200D-1F9D1-1F3FE", u"", 3146, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F91D\u200D\U0001F9D1\U0001F3FF", u"", u"1F9D1-1F3FF-200D-1F91D-200D-1F9D1-1F3FF", u"", 3147, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F9AF\u200D\u27A1\uFE0F", u"\U0001F9D1\u200D\U0001F9AF\u200D\u27A1", u"1F9D1-200D-1F9AF-200D-27A1-FE0F", u"1F9D1-200D-1F9AF-200D-27A1", 3148, 1, 7},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F9AF\u200D\u27A1\uFE0F", u"\U0001F9D1\U0001F3FB\u200D\U0001F9AF\u200D\u27A1", u"1F9D1-1F3FB-200D-1F9AF-200D-27A1-FE0F", u"1F9D1-1F3FB-200D-1F9AF-200D-27A1", 3149, 1, 7},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F9AF\u200D\u27A1\uFE0F", u"\U0001F9D1\U0001F3FC\u200D\U0001F9AF\u200D\u27A1", u"1F9D1-1F3FC-200D-1F9AF-200D-27A1-FE0F", u"1F9D1-1F3FC-200D-1F9AF-200D-27A1", 3150, 1, 7},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F9AF\u200D\u27A1\uFE0F", u"\U0001F9D1\U0001F3FD\u200D\U0001F9AF\u200D\u27A1", u"1F9D1-1F3FD-200D-1F9AF-200D-27A1-FE0F", u"1F9D1-1F3FD-200D-1F9AF-200D-27A1", 3151, 1, 7},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F9AF\u200D\u27A1\uFE0F", u"\U0001F9D1\U0001F3FE\u200D\U0001F9AF\u200D\u27A1", u"1F9D1-1F3FE-200D-1F9AF-200D-27A1-FE0F", u"1F9D1-1F3FE-200D-1F9AF-200D-27A1", 3152, 1, 7},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F9AF\u200D\u27A1\uFE0F", u"\U0001F9D1\U0001F3FF\u200D\U0001F9AF\u200D\u27A1", u"1F9D1-1F3FF-200D-1F9AF-200D-27A1-FE0F", u"1F9D1-1F3FF-200D-1F9AF-200D-27A1", 3153, 1, 7},
+    {u"\U0001F9D1\u200D\U0001F9AF", u"", u"1F9D1-200D-1F9AF", u"", 3154, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F9AF", u"", u"1F9D1-1F3FB-200D-1F9AF", u"", 3155, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F9AF", u"", u"1F9D1-1F3FC-200D-1F9AF", u"", 3156, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F9AF", u"", u"1F9D1-1F3FD-200D-1F9AF", u"", 3157, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F9AF", u"", u"1F9D1-1F3FE-200D-1F9AF", u"", 3158, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F9AF", u"", u"1F9D1-1F3FF-200D-1F9AF", u"", 3159, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F9B0", u"", u"1F9D1-200D-1F9B0", u"", 3160, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F9B0", u"", u"1F9D1-1F3FB-200D-1F9B0", u"", 3161, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F9B0", u"", u"1F9D1-1F3FC-200D-1F9B0", u"", 3162, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F9B0", u"", u"1F9D1-1F3FD-200D-1F9B0", u"", 3163, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F9B0", u"", u"1F9D1-1F3FE-200D-1F9B0", u"", 3164, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F9B0", u"", u"1F9D1-1F3FF-200D-1F9B0", u"", 3165, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F9B1", u"", u"1F9D1-200D-1F9B1", u"", 3166, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F9B1", u"", u"1F9D1-1F3FB-200D-1F9B1", u"", 3167, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F9B1", u"", u"1F9D1-1F3FC-200D-1F9B1", u"", 3168, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F9B1", u"", u"1F9D1-1F3FD-200D-1F9B1", u"", 3169, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F9B1", u"", u"1F9D1-1F3FE-200D-1F9B1", u"", 3170, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F9B1", u"", u"1F9D1-1F3FF-200D-1F9B1", u"", 3171, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F9B2", u"", u"1F9D1-200D-1F9B2", u"", 3172, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F9B2", u"", u"1F9D1-1F3FB-200D-1F9B2", u"", 3173, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F9B2", u"", u"1F9D1-1F3FC-200D-1F9B2", u"", 3174, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F9B2", u"", u"1F9D1-1F3FD-200D-1F9B2", u"", 3175, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F9B2", u"", u"1F9D1-1F3FE-200D-1F9B2", u"", 3176, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F9B2", u"", u"1F9D1-1F3FF-200D-1F9B2", u"", 3177, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F9B3", u"", u"1F9D1-200D-1F9B3", u"", 3178, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F9B3", u"", u"1F9D1-1F3FB-200D-1F9B3", u"", 3179, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F9B3", u"", u"1F9D1-1F3FC-200D-1F9B3", u"", 3180, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F9B3", u"", u"1F9D1-1F3FD-200D-1F9B3", u"", 3181, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F9B3", u"", u"1F9D1-1F3FE-200D-1F9B3", u"", 3182, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F9B3", u"", u"1F9D1-1F3FF-200D-1F9B3", u"", 3183, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F9BC\u200D\u27A1\uFE0F", u"\U0001F9D1\u200D\U0001F9BC\u200D\u27A1", u"1F9D1-200D-1F9BC-200D-27A1-FE0F", u"1F9D1-200D-1F9BC-200D-27A1", 3184, 1, 7},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F9BC\u200D\u27A1\uFE0F", u"\U0001F9D1\U0001F3FB\u200D\U0001F9BC\u200D\u27A1", u"1F9D1-1F3FB-200D-1F9BC-200D-27A1-FE0F", u"1F9D1-1F3FB-200D-1F9BC-200D-27A1", 3185, 1, 7},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F9BC\u200D\u27A1\uFE0F", u"\U0001F9D1\U0001F3FC\u200D\U0001F9BC\u200D\u27A1", u"1F9D1-1F3FC-200D-1F9BC-200D-27A1-FE0F", u"1F9D1-1F3FC-200D-1F9BC-200D-27A1", 3186, 1, 7},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F9BC\u200D\u27A1\uFE0F", u"\U0001F9D1\U0001F3FD\u200D\U0001F9BC\u200D\u27A1", u"1F9D1-1F3FD-200D-1F9BC-200D-27A1-FE0F", u"1F9D1-1F3FD-200D-1F9BC-200D-27A1", 3187, 1, 7},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F9BC\u200D\u27A1\uFE0F", u"\U0001F9D1\U0001F3FE\u200D\U0001F9BC\u200D\u27A1", u"1F9D1-1F3FE-200D-1F9BC-200D-27A1-FE0F", u"1F9D1-1F3FE-200D-1F9BC-200D-27A1", 3188, 1, 7},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F9BC\u200D\u27A1\uFE0F", u"\U0001F9D1\U0001F3FF\u200D\U0001F9BC\u200D\u27A1", u"1F9D1-1F3FF-200D-1F9BC-200D-27A1-FE0F", u"1F9D1-1F3FF-200D-1F9BC-200D-27A1", 3189, 1, 7},
+    {u"\U0001F9D1\u200D\U0001F9BC", u"", u"1F9D1-200D-1F9BC", u"", 3190, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F9BC", u"", u"1F9D1-1F3FB-200D-1F9BC", u"", 3191, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F9BC", u"", u"1F9D1-1F3FC-200D-1F9BC", u"", 3192, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F9BC", u"", u"1F9D1-1F3FD-200D-1F9BC", u"", 3193, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F9BC", u"", u"1F9D1-1F3FE-200D-1F9BC", u"", 3194, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F9BC", u"", u"1F9D1-1F3FF-200D-1F9BC", u"", 3195, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F9BD\u200D\u27A1\uFE0F", u"\U0001F9D1\u200D\U0001F9BD\u200D\u27A1", u"1F9D1-200D-1F9BD-200D-27A1-FE0F", u"1F9D1-200D-1F9BD-200D-27A1", 3196, 1, 7},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F9BD\u200D\u27A1\uFE0F", u"\U0001F9D1\U0001F3FB\u200D\U0001F9BD\u200D\u27A1", u"1F9D1-1F3FB-200D-1F9BD-200D-27A1-FE0F", u"1F9D1-1F3FB-200D-1F9BD-200D-27A1", 3197, 1, 7},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F9BD\u200D\u27A1\uFE0F", u"\U0001F9D1\U0001F3FC\u200D\U0001F9BD\u200D\u27A1", u"1F9D1-1F3FC-200D-1F9BD-200D-27A1-FE0F", u"1F9D1-1F3FC-200D-1F9BD-200D-27A1", 3198, 1, 7},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F9BD\u200D\u27A1\uFE0F", u"\U0001F9D1\U0001F3FD\u200D\U0001F9BD\u200D\u27A1", u"1F9D1-1F3FD-200D-1F9BD-200D-27A1-FE0F", u"1F9D1-1F3FD-200D-1F9BD-200D-27A1", 3199, 1, 7},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F9BD\u200D\u27A1\uFE0F", u"\U0001F9D1\U0001F3FE\u200D\U0001F9BD\u200D\u27A1", u"1F9D1-1F3FE-200D-1F9BD-200D-27A1-FE0F", u"1F9D1-1F3FE-200D-1F9BD-200D-27A1", 3200, 1, 7},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F9BD\u200D\u27A1\uFE0F", u"\U0001F9D1\U0001F3FF\u200D\U0001F9BD\u200D\u27A1", u"1F9D1-1F3FF-200D-1F9BD-200D-27A1-FE0F", u"1F9D1-1F3FF-200D-1F9BD-200D-27A1", 3201, 1, 7},
+    {u"\U0001F9D1\u200D\U0001F9BD", u"", u"1F9D1-200D-1F9BD", u"", 3202, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\U0001F9BD", u"", u"1F9D1-1F3FB-200D-1F9BD", u"", 3203, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\U0001F9BD", u"", u"1F9D1-1F3FC-200D-1F9BD", u"", 3204, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\U0001F9BD", u"", u"1F9D1-1F3FD-200D-1F9BD", u"", 3205, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\U0001F9BD", u"", u"1F9D1-1F3FE-200D-1F9BD", u"", 3206, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\U0001F9BD", u"", u"1F9D1-1F3FF-200D-1F9BD", u"", 3207, 1, 15},
+    {u"\U0001F9D1\u200D\U0001F9D1\u200D\U0001F9D2", u"", u"1F9D1-200D-1F9D1-200D-1F9D2", u"", 3208, 1, 7},
+    {u"\U0001F9D1\u200D\U0001F9D1\u200D\U0001F9D2\u200D\U0001F9D2", u"", u"1F9D1-200D-1F9D1-200D-1F9D2-200D-1F9D2", u"", 3209, 1, 7},
+    {u"\U0001F9D1\u200D\U0001F9D2\u200D\U0001F9D2", u"", u"1F9D1-200D-1F9D2-200D-1F9D2", u"", 3210, 1, 7},
+    {u"\U0001F9D1\u200D\U0001F9D2", u"", u"1F9D1-200D-1F9D2", u"", 3211, 1, 7},
+    {u"\U0001F9D1\u200D\u2695\uFE0F", u"\U0001F9D1\u200D\u2695", u"1F9D1-200D-2695-FE0F", u"1F9D1-200D-2695", 3212, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\u2695\uFE0F", u"\U0001F9D1\U0001F3FB\u200D\u2695", u"1F9D1-1F3FB-200D-2695-FE0F", u"1F9D1-1F3FB-200D-2695", 3213, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\u2695\uFE0F", u"\U0001F9D1\U0001F3FC\u200D\u2695", u"1F9D1-1F3FC-200D-2695-FE0F", u"1F9D1-1F3FC-200D-2695", 3214, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\u2695\uFE0F", u"\U0001F9D1\U0001F3FD\u200D\u2695", u"1F9D1-1F3FD-200D-2695-FE0F", u"1F9D1-1F3FD-200D-2695", 3215, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\u2695\uFE0F", u"\U0001F9D1\U0001F3FE\u200D\u2695", u"1F9D1-1F3FE-200D-2695-FE0F", u"1F9D1-1F3FE-200D-2695", 3216, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\u2695\uFE0F", u"\U0001F9D1\U0001F3FF\u200D\u2695", u"1F9D1-1F3FF-200D-2695-FE0F", u"1F9D1-1F3FF-200D-2695", 3217, 1, 15},
+    {u"\U0001F9D1\u200D\u2696\uFE0F", u"\U0001F9D1\u200D\u2696", u"1F9D1-200D-2696-FE0F", u"1F9D1-200D-2696", 3218, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\u2696\uFE0F", u"\U0001F9D1\U0001F3FB\u200D\u2696", u"1F9D1-1F3FB-200D-2696-FE0F", u"1F9D1-1F3FB-200D-2696", 3219, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\u2696\uFE0F", u"\U0001F9D1\U0001F3FC\u200D\u2696", u"1F9D1-1F3FC-200D-2696-FE0F", u"1F9D1-1F3FC-200D-2696", 3220, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\u2696\uFE0F", u"\U0001F9D1\U0001F3FD\u200D\u2696", u"1F9D1-1F3FD-200D-2696-FE0F", u"1F9D1-1F3FD-200D-2696", 3221, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\u2696\uFE0F", u"\U0001F9D1\U0001F3FE\u200D\u2696", u"1F9D1-1F3FE-200D-2696-FE0F", u"1F9D1-1F3FE-200D-2696", 3222, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\u2696\uFE0F", u"\U0001F9D1\U0001F3FF\u200D\u2696", u"1F9D1-1F3FF-200D-2696-FE0F", u"1F9D1-1F3FF-200D-2696", 3223, 1, 15},
+    {u"\U0001F9D1\u200D\u2708\uFE0F", u"\U0001F9D1\u200D\u2708", u"1F9D1-200D-2708-FE0F", u"1F9D1-200D-2708", 3224, 1, 15},
+    {u"\U0001F9D1\U0001F3FB\u200D\u2708\uFE0F", u"\U0001F9D1\U0001F3FB\u200D\u2708", u"1F9D1-1F3FB-200D-2708-FE0F", u"1F9D1-1F3FB-200D-2708", 3225, 1, 15},
+    {u"\U0001F9D1\U0001F3FC\u200D\u2708\uFE0F", u"\U0001F9D1\U0001F3FC\u200D\u2708", u"1F9D1-1F3FC-200D-2708-FE0F", u"1F9D1-1F3FC-200D-2708", 3226, 1, 15},
+    {u"\U0001F9D1\U0001F3FD\u200D\u2708\uFE0F", u"\U0001F9D1\U0001F3FD\u200D\u2708", u"1F9D1-1F3FD-200D-2708-FE0F", u"1F9D1-1F3FD-200D-2708", 3227, 1, 15},
+    {u"\U0001F9D1\U0001F3FE\u200D\u2708\uFE0F", u"\U0001F9D1\U0001F3FE\u200D\u2708", u"1F9D1-1F3FE-200D-2708-FE0F", u"1F9D1-1F3FE-200D-2708", 3228, 1, 15},
+    {u"\U0001F9D1\U0001F3FF\u200D\u2708\uFE0F", u"\U0001F9D1\U0001F3FF\u200D\u2708", u"1F9D1-1F3FF-200D-2708-FE0F", u"1F9D1-1F3FF-200D-2708", 3229, 1, 15},
+    {u"\U0001F9D1", u"", u"1F9D1", u"", 3230, 1, 15},
+    {u"\U0001F9D1\U0001F3FB", u"", u"1F9D1-1F3FB", u"", 3231, 1, 15},
+    {u"\U0001F9D1\U0001F3FC", u"", u"1F9D1-1F3FC", u"", 3232, 1, 15},
+    {u"\U0001F9D1\U0001F3FD", u"", u"1F9D1-1F3FD", u"", 3233, 1, 15},
+    {u"\U0001F9D1\U0001F3FE", u"", u"1F9D1-1F3FE", u"", 3234, 1, 15},
+    {u"\U0001F9D1\U0001F3FF", u"", u"1F9D1-1F3FF", u"", 3235, 1, 15},
+    {u"\U0001F9D2", u"", u"1F9D2", u"", 3236, 1, 15},
+    {u"\U0001F9D2\U0001F3FB", u"", u"1F9D2-1F3FB", u"", 3237, 1, 15},
+    {u"\U0001F9D2\U0001F3FC", u"", u"1F9D2-1F3FC", u"", 3238, 1, 15},
+    {u"\U0001F9D2\U0001F3FD", u"", u"1F9D2-1F3FD", u"", 3239, 1, 15},
+    {u"\U0001F9D2\U0001F3FE", u"", u"1F9D2-1F3FE", u"", 3240, 1, 15},
+    {u"\U0001F9D2\U0001F3FF", u"", u"1F9D2-1F3FF", u"", 3241, 1, 15},
+    {u"\U0001F9D3", u"", u"1F9D3", u"", 3242, 1, 15},
+    {u"\U0001F9D3\U0001F3FB", u"", u"1F9D3-1F3FB", u"", 3243, 1, 15},
+    {u"\U0001F9D3\U0001F3FC", u"", u"1F9D3-1F3FC", u"", 3244, 1, 15},
+    {u"\U0001F9D3\U0001F3FD", u"", u"1F9D3-1F3FD", u"", 3245, 1, 15},
+    {u"\U0001F9D3\U0001F3FE", u"", u"1F9D3-1F3FE", u"", 3246, 1, 15},
+    {u"\U0001F9D3\U0001F3FF", u"", u"1F9D3-1F3FF", u"", 3247, 1, 15},
+    {u"\U0001F9D4\u200D\u2640\uFE0F", u"\U0001F9D4\u200D\u2640", u"1F9D4-200D-2640-FE0F", u"1F9D4-200D-2640", 3248, 1, 15},
+    {u"\U0001F9D4\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F9D4\U0001F3FB\u200D\u2640", u"1F9D4-1F3FB-200D-2640-FE0F", u"1F9D4-1F3FB-200D-2640", 3249, 1, 15},
+    {u"\U0001F9D4\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F9D4\U0001F3FC\u200D\u2640", u"1F9D4-1F3FC-200D-2640-FE0F", u"1F9D4-1F3FC-200D-2640", 3250, 1, 15},
+    {u"\U0001F9D4\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F9D4\U0001F3FD\u200D\u2640", u"1F9D4-1F3FD-200D-2640-FE0F", u"1F9D4-1F3FD-200D-2640", 3251, 1, 15},
+    {u"\U0001F9D4\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F9D4\U0001F3FE\u200D\u2640", u"1F9D4-1F3FE-200D-2640-FE0F", u"1F9D4-1F3FE-200D-2640", 3252, 1, 15},
+    {u"\U0001F9D4\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F9D4\U0001F3FF\u200D\u2640", u"1F9D4-1F3FF-200D-2640-FE0F", u"1F9D4-1F3FF-200D-2640", 3253, 1, 15},
+    {u"\U0001F9D4\u200D\u2642\uFE0F", u"\U0001F9D4\u200D\u2642", u"1F9D4-200D-2642-FE0F", u"1F9D4-200D-2642", 3254, 1, 15},
+    {u"\U0001F9D4\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F9D4\U0001F3FB\u200D\u2642", u"1F9D4-1F3FB-200D-2642-FE0F", u"1F9D4-1F3FB-200D-2642", 3255, 1, 15},
+    {u"\U0001F9D4\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F9D4\U0001F3FC\u200D\u2642", u"1F9D4-1F3FC-200D-2642-FE0F", u"1F9D4-1F3FC-200D-2642", 3256, 1, 15},
+    {u"\U0001F9D4\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F9D4\U0001F3FD\u200D\u2642", u"1F9D4-1F3FD-200D-2642-FE0F", u"1F9D4-1F3FD-200D-2642", 3257, 1, 15},
+    {u"\U0001F9D4\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F9D4\U0001F3FE\u200D\u2642", u"1F9D4-1F3FE-200D-2642-FE0F", u"1F9D4-1F3FE-200D-2642", 3258, 1, 15},
+    {u"\U0001F9D4\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F9D4\U0001F3FF\u200D\u2642", u"1F9D4-1F3FF-200D-2642-FE0F", u"1F9D4-1F3FF-200D-2642", 3259, 1, 15},
+    {u"\U0001F9D4", u"", u"1F9D4", u"", 3260, 1, 15},
+    {u"\U0001F9D4\U0001F3FB", u"", u"1F9D4-1F3FB", u"", 3261, 1, 15},
+    {u"\U0001F9D4\U0001F3FC", u"", u"1F9D4-1F3FC", u"", 3262, 1, 15},
+    {u"\U0001F9D4\U0001F3FD", u"", u"1F9D4-1F3FD", u"", 3263, 1, 15},
+    {u"\U0001F9D4\U0001F3FE", u"", u"1F9D4-1F3FE", u"", 3264, 1, 15},
+    {u"\U0001F9D4\U0001F3FF", u"", u"1F9D4-1F3FF", u"", 3265, 1, 15},
+    {u"\U0001F9D5", u"", u"1F9D5", u"", 3266, 1, 15},
+    {u"\U0001F9D5\U0001F3FB", u"", u"1F9D5-1F3FB", u"", 3267, 1, 15},
+    {u"\U0001F9D5\U0001F3FC", u"", u"1F9D5-1F3FC", u"", 3268, 1, 15},
+    {u"\U0001F9D5\U0001F3FD", u"", u"1F9D5-1F3FD", u"", 3269, 1, 15},
+    {u"\U0001F9D5\U0001F3FE", u"", u"1F9D5-1F3FE", u"", 3270, 1, 15},
+    {u"\U0001F9D5\U0001F3FF", u"", u"1F9D5-1F3FF", u"", 3271, 1, 15},
+    {u"\U0001F9D6\u200D\u2640\uFE0F", u"\U0001F9D6\u200D\u2640", u"1F9D6-200D-2640-FE0F", u"1F9D6-200D-2640", 3272, 1, 15},
+    {u"\U0001F9D6\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F9D6\U0001F3FB\u200D\u2640", u"1F9D6-1F3FB-200D-2640-FE0F", u"1F9D6-1F3FB-200D-2640", 3273, 1, 15},
+    {u"\U0001F9D6\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F9D6\U0001F3FC\u200D\u2640", u"1F9D6-1F3FC-200D-2640-FE0F", u"1F9D6-1F3FC-200D-2640", 3274, 1, 15},
+    {u"\U0001F9D6\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F9D6\U0001F3FD\u200D\u2640", u"1F9D6-1F3FD-200D-2640-FE0F", u"1F9D6-1F3FD-200D-2640", 3275, 1, 15},
+    {u"\U0001F9D6\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F9D6\U0001F3FE\u200D\u2640", u"1F9D6-1F3FE-200D-2640-FE0F", u"1F9D6-1F3FE-200D-2640", 3276, 1, 15},
+    {u"\U0001F9D6\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F9D6\U0001F3FF\u200D\u2640", u"1F9D6-1F3FF-200D-2640-FE0F", u"1F9D6-1F3FF-200D-2640", 3277, 1, 15},
+    {u"\U0001F9D6\u200D\u2642\uFE0F", u"\U0001F9D6\u200D\u2642", u"1F9D6-200D-2642-FE0F", u"1F9D6-200D-2642", 3278, 1, 15},
+    {u"\U0001F9D6\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F9D6\U0001F3FB\u200D\u2642", u"1F9D6-1F3FB-200D-2642-FE0F", u"1F9D6-1F3FB-200D-2642", 3279, 1, 15},
+    {u"\U0001F9D6\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F9D6\U0001F3FC\u200D\u2642", u"1F9D6-1F3FC-200D-2642-FE0F", u"1F9D6-1F3FC-200D-2642", 3280, 1, 15},
+    {u"\U0001F9D6\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F9D6\U0001F3FD\u200D\u2642", u"1F9D6-1F3FD-200D-2642-FE0F", u"1F9D6-1F3FD-200D-2642", 3281, 1, 15},
+    {u"\U0001F9D6\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F9D6\U0001F3FE\u200D\u2642", u"1F9D6-1F3FE-200D-2642-FE0F", u"1F9D6-1F3FE-200D-2642", 3282, 1, 15},
+    {u"\U0001F9D6\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F9D6\U0001F3FF\u200D\u2642", u"1F9D6-1F3FF-200D-2642-FE0F", u"1F9D6-1F3FF-200D-2642", 3283, 1, 15},
+    {u"\U0001F9D6", u"", u"1F9D6", u"", 3284, 1, 15},
+    {u"\U0001F9D6\U0001F3FB", u"", u"1F9D6-1F3FB", u"", 3285, 1, 15},
+    {u"\U0001F9D6\U0001F3FC", u"", u"1F9D6-1F3FC", u"", 3286, 1, 15},
+    {u"\U0001F9D6\U0001F3FD", u"", u"1F9D6-1F3FD", u"", 3287, 1, 15},
+    {u"\U0001F9D6\U0001F3FE", u"", u"1F9D6-1F3FE", u"", 3288, 1, 15},
+    {u"\U0001F9D6\U0001F3FF", u"", u"1F9D6-1F3FF", u"", 3289, 1, 15},
+    {u"\U0001F9D7\u200D\u2640\uFE0F", u"\U0001F9D7\u200D\u2640", u"1F9D7-200D-2640-FE0F", u"1F9D7-200D-2640", 3290, 1, 15},
+    {u"\U0001F9D7\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F9D7\U0001F3FB\u200D\u2640", u"1F9D7-1F3FB-200D-2640-FE0F", u"1F9D7-1F3FB-200D-2640", 3291, 1, 15},
+    {u"\U0001F9D7\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F9D7\U0001F3FC\u200D\u2640", u"1F9D7-1F3FC-200D-2640-FE0F", u"1F9D7-1F3FC-200D-2640", 3292, 1, 15},
+    {u"\U0001F9D7\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F9D7\U0001F3FD\u200D\u2640", u"1F9D7-1F3FD-200D-2640-FE0F", u"1F9D7-1F3FD-200D-2640", 3293, 1, 15},
+    {u"\U0001F9D7\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F9D7\U0001F3FE\u200D\u2640", u"1F9D7-1F3FE-200D-2640-FE0F", u"1F9D7-1F3FE-200D-2640", 3294, 1, 15},
+    {u"\U0001F9D7\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F9D7\U0001F3FF\u200D\u2640", u"1F9D7-1F3FF-200D-2640-FE0F", u"1F9D7-1F3FF-200D-2640", 3295, 1, 15},
+    {u"\U0001F9D7\u200D\u2642\uFE0F", u"\U0001F9D7\u200D\u2642", u"1F9D7-200D-2642-FE0F", u"1F9D7-200D-2642", 3296, 1, 15},
+    {u"\U0001F9D7\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F9D7\U0001F3FB\u200D\u2642", u"1F9D7-1F3FB-200D-2642-FE0F", u"1F9D7-1F3FB-200D-2642", 3297, 1, 15},
+    {u"\U0001F9D7\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F9D7\U0001F3FC\u200D\u2642", u"1F9D7-1F3FC-200D-2642-FE0F", u"1F9D7-1F3FC-200D-2642", 3298, 1, 15},
+    {u"\U0001F9D7\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F9D7\U0001F3FD\u200D\u2642", u"1F9D7-1F3FD-200D-2642-FE0F", u"1F9D7-1F3FD-200D-2642", 3299, 1, 15},
+    {u"\U0001F9D7\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F9D7\U0001F3FE\u200D\u2642", u"1F9D7-1F3FE-200D-2642-FE0F", u"1F9D7-1F3FE-200D-2642", 3300, 1, 15},
+    {u"\U0001F9D7\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F9D7\U0001F3FF\u200D\u2642", u"1F9D7-1F3FF-200D-2642-FE0F", u"1F9D7-1F3FF-200D-2642", 3301, 1, 15},
+    {u"\U0001F9D7", u"", u"1F9D7", u"", 3302, 1, 15},
+    {u"\U0001F9D7\U0001F3FB", u"", u"1F9D7-1F3FB", u"", 3303, 1, 15},
+    {u"\U0001F9D7\U0001F3FC", u"", u"1F9D7-1F3FC", u"", 3304, 1, 15},
+    {u"\U0001F9D7\U0001F3FD", u"", u"1F9D7-1F3FD", u"", 3305, 1, 15},
+    {u"\U0001F9D7\U0001F3FE", u"", u"1F9D7-1F3FE", u"", 3306, 1, 15},
+    {u"\U0001F9D7\U0001F3FF", u"", u"1F9D7-1F3FF", u"", 3307, 1, 15},
+    {u"\U0001F9D8\u200D\u2640\uFE0F", u"\U0001F9D8\u200D\u2640", u"1F9D8-200D-2640-FE0F", u"1F9D8-200D-2640", 3308, 1, 15},
+    {u"\U0001F9D8\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F9D8\U0001F3FB\u200D\u2640", u"1F9D8-1F3FB-200D-2640-FE0F", u"1F9D8-1F3FB-200D-2640", 3309, 1, 15},
+    {u"\U0001F9D8\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F9D8\U0001F3FC\u200D\u2640", u"1F9D8-1F3FC-200D-2640-FE0F", u"1F9D8-1F3FC-200D-2640", 3310, 1, 15},
+    {u"\U0001F9D8\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F9D8\U0001F3FD\u200D\u2640", u"1F9D8-1F3FD-200D-2640-FE0F", u"1F9D8-1F3FD-200D-2640", 3311, 1, 15},
+    {u"\U0001F9D8\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F9D8\U0001F3FE\u200D\u2640", u"1F9D8-1F3FE-200D-2640-FE0F", u"1F9D8-1F3FE-200D-2640", 3312, 1, 15},
+    {u"\U0001F9D8\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F9D8\U0001F3FF\u200D\u2640", u"1F9D8-1F3FF-200D-2640-FE0F", u"1F9D8-1F3FF-200D-2640", 3313, 1, 15},
+    {u"\U0001F9D8\u200D\u2642\uFE0F", u"\U0001F9D8\u200D\u2642", u"1F9D8-200D-2642-FE0F", u"1F9D8-200D-2642", 3314, 1, 15},
+    {u"\U0001F9D8\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F9D8\U0001F3FB\u200D\u2642", u"1F9D8-1F3FB-200D-2642-FE0F", u"1F9D8-1F3FB-200D-2642", 3315, 1, 15},
+    {u"\U0001F9D8\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F9D8\U0001F3FC\u200D\u2642", u"1F9D8-1F3FC-200D-2642-FE0F", u"1F9D8-1F3FC-200D-2642", 3316, 1, 15},
+    {u"\U0001F9D8\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F9D8\U0001F3FD\u200D\u2642", u"1F9D8-1F3FD-200D-2642-FE0F", u"1F9D8-1F3FD-200D-2642", 3317, 1, 15},
+    {u"\U0001F9D8\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F9D8\U0001F3FE\u200D\u2642", u"1F9D8-1F3FE-200D-2642-FE0F", u"1F9D8-1F3FE-200D-2642", 3318, 1, 15},
+    {u"\U0001F9D8\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F9D8\U0001F3FF\u200D\u2642", u"1F9D8-1F3FF-200D-2642-FE0F", u"1F9D8-1F3FF-200D-2642", 3319, 1, 15},
+    {u"\U0001F9D8", u"", u"1F9D8", u"", 3320, 1, 15},
+    {u"\U0001F9D8\U0001F3FB", u"", u"1F9D8-1F3FB", u"", 3321, 1, 15},
+    {u"\U0001F9D8\U0001F3FC", u"", u"1F9D8-1F3FC", u"", 3322, 1, 15},
+    {u"\U0001F9D8\U0001F3FD", u"", u"1F9D8-1F3FD", u"", 3323, 1, 15},
+    {u"\U0001F9D8\U0001F3FE", u"", u"1F9D8-1F3FE", u"", 3324, 1, 15},
+    {u"\U0001F9D8\U0001F3FF", u"", u"1F9D8-1F3FF", u"", 3325, 1, 15},
+    {u"\U0001F9D9\u200D\u2640\uFE0F", u"\U0001F9D9\u200D\u2640", u"1F9D9-200D-2640-FE0F", u"1F9D9-200D-2640", 3326, 1, 15},
+    {u"\U0001F9D9\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F9D9\U0001F3FB\u200D\u2640", u"1F9D9-1F3FB-200D-2640-FE0F", u"1F9D9-1F3FB-200D-2640", 3327, 1, 15},
+    {u"\U0001F9D9\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F9D9\U0001F3FC\u200D\u2640", u"1F9D9-1F3FC-200D-2640-FE0F", u"1F9D9-1F3FC-200D-2640", 3328, 1, 15},
+    {u"\U0001F9D9\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F9D9\U0001F3FD\u200D\u2640", u"1F9D9-1F3FD-200D-2640-FE0F", u"1F9D9-1F3FD-200D-2640", 3329, 1, 15},
+    {u"\U0001F9D9\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F9D9\U0001F3FE\u200D\u2640", u"1F9D9-1F3FE-200D-2640-FE0F", u"1F9D9-1F3FE-200D-2640", 3330, 1, 15},
+    {u"\U0001F9D9\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F9D9\U0001F3FF\u200D\u2640", u"1F9D9-1F3FF-200D-2640-FE0F", u"1F9D9-1F3FF-200D-2640", 3331, 1, 15},
+    {u"\U0001F9D9\u200D\u2642\uFE0F", u"\U0001F9D9\u200D\u2642", u"1F9D9-200D-2642-FE0F", u"1F9D9-200D-2642", 3332, 1, 15},
+    {u"\U0001F9D9\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F9D9\U0001F3FB\u200D\u2642", u"1F9D9-1F3FB-200D-2642-FE0F", u"1F9D9-1F3FB-200D-2642", 3333, 1, 15},
+    {u"\U0001F9D9\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F9D9\U0001F3FC\u200D\u2642", u"1F9D9-1F3FC-200D-2642-FE0F", u"1F9D9-1F3FC-200D-2642", 3334, 1, 15},
+    {u"\U0001F9D9\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F9D9\U0001F3FD\u200D\u2642", u"1F9D9-1F3FD-200D-2642-FE0F", u"1F9D9-1F3FD-200D-2642", 3335, 1, 15},
+    {u"\U0001F9D9\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F9D9\U0001F3FE\u200D\u2642", u"1F9D9-1F3FE-200D-2642-FE0F", u"1F9D9-1F3FE-200D-2642", 3336, 1, 15},
+    {u"\U0001F9D9\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F9D9\U0001F3FF\u200D\u2642", u"1F9D9-1F3FF-200D-2642-FE0F", u"1F9D9-1F3FF-200D-2642", 3337, 1, 15},
+    {u"\U0001F9D9", u"", u"1F9D9", u"", 3338, 1, 15},
+    {u"\U0001F9D9\U0001F3FB", u"", u"1F9D9-1F3FB", u"", 3339, 1, 15},
+    {u"\U0001F9D9\U0001F3FC", u"", u"1F9D9-1F3FC", u"", 3340, 1, 15},
+    {u"\U0001F9D9\U0001F3FD", u"", u"1F9D9-1F3FD", u"", 3341, 1, 15},
+    {u"\U0001F9D9\U0001F3FE", u"", u"1F9D9-1F3FE", u"", 3342, 1, 15},
+    {u"\U0001F9D9\U0001F3FF", u"", u"1F9D9-1F3FF", u"", 3343, 1, 15},
+    {u"\U0001F9DA\u200D\u2640\uFE0F", u"\U0001F9DA\u200D\u2640", u"1F9DA-200D-2640-FE0F", u"1F9DA-200D-2640", 3344, 1, 15},
+    {u"\U0001F9DA\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F9DA\U0001F3FB\u200D\u2640", u"1F9DA-1F3FB-200D-2640-FE0F", u"1F9DA-1F3FB-200D-2640", 3345, 1, 15},
+    {u"\U0001F9DA\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F9DA\U0001F3FC\u200D\u2640", u"1F9DA-1F3FC-200D-2640-FE0F", u"1F9DA-1F3FC-200D-2640", 3346, 1, 15},
+    {u"\U0001F9DA\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F9DA\U0001F3FD\u200D\u2640", u"1F9DA-1F3FD-200D-2640-FE0F", u"1F9DA-1F3FD-200D-2640", 3347, 1, 15},
+    {u"\U0001F9DA\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F9DA\U0001F3FE\u200D\u2640", u"1F9DA-1F3FE-200D-2640-FE0F", u"1F9DA-1F3FE-200D-2640", 3348, 1, 15},
+    {u"\U0001F9DA\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F9DA\U0001F3FF\u200D\u2640", u"1F9DA-1F3FF-200D-2640-FE0F", u"1F9DA-1F3FF-200D-2640", 3349, 1, 15},
+    {u"\U0001F9DA\u200D\u2642\uFE0F", u"\U0001F9DA\u200D\u2642", u"1F9DA-200D-2642-FE0F", u"1F9DA-200D-2642", 3350, 1, 15},
+    {u"\U0001F9DA\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F9DA\U0001F3FB\u200D\u2642", u"1F9DA-1F3FB-200D-2642-FE0F", u"1F9DA-1F3FB-200D-2642", 3351, 1, 15},
+    {u"\U0001F9DA\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F9DA\U0001F3FC\u200D\u2642", u"1F9DA-1F3FC-200D-2642-FE0F", u"1F9DA-1F3FC-200D-2642", 3352, 1, 15},
+    {u"\U0001F9DA\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F9DA\U0001F3FD\u200D\u2642", u"1F9DA-1F3FD-200D-2642-FE0F", u"1F9DA-1F3FD-200D-2642", 3353, 1, 15},
+    {u"\U0001F9DA\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F9DA\U0001F3FE\u200D\u2642", u"1F9DA-1F3FE-200D-2642-FE0F", u"1F9DA-1F3FE-200D-2642", 3354, 1, 15},
+    {u"\U0001F9DA\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F9DA\U0001F3FF\u200D\u2642", u"1F9DA-1F3FF-200D-2642-FE0F", u"1F9DA-1F3FF-200D-2642", 3355, 1, 15},
+    {u"\U0001F9DA", u"", u"1F9DA", u"", 3356, 1, 15},
+    {u"\U0001F9DA\U0001F3FB", u"", u"1F9DA-1F3FB", u"", 3357, 1, 15},
+    {u"\U0001F9DA\U0001F3FC", u"", u"1F9DA-1F3FC", u"", 3358, 1, 15},
+    {u"\U0001F9DA\U0001F3FD", u"", u"1F9DA-1F3FD", u"", 3359, 1, 15},
+    {u"\U0001F9DA\U0001F3FE", u"", u"1F9DA-1F3FE", u"", 3360, 1, 15},
+    {u"\U0001F9DA\U0001F3FF", u"", u"1F9DA-1F3FF", u"", 3361, 1, 15},
+    {u"\U0001F9DB\u200D\u2640\uFE0F", u"\U0001F9DB\u200D\u2640", u"1F9DB-200D-2640-FE0F", u"1F9DB-200D-2640", 3362, 1, 15},
+    {u"\U0001F9DB\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F9DB\U0001F3FB\u200D\u2640", u"1F9DB-1F3FB-200D-2640-FE0F", u"1F9DB-1F3FB-200D-2640", 3363, 1, 15},
+    {u"\U0001F9DB\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F9DB\U0001F3FC\u200D\u2640", u"1F9DB-1F3FC-200D-2640-FE0F", u"1F9DB-1F3FC-200D-2640", 3364, 1, 15},
+    {u"\U0001F9DB\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F9DB\U0001F3FD\u200D\u2640", u"1F9DB-1F3FD-200D-2640-FE0F", u"1F9DB-1F3FD-200D-2640", 3365, 1, 15},
+    {u"\U0001F9DB\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F9DB\U0001F3FE\u200D\u2640", u"1F9DB-1F3FE-200D-2640-FE0F", u"1F9DB-1F3FE-200D-2640", 3366, 1, 15},
+    {u"\U0001F9DB\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F9DB\U0001F3FF\u200D\u2640", u"1F9DB-1F3FF-200D-2640-FE0F", u"1F9DB-1F3FF-200D-2640", 3367, 1, 15},
+    {u"\U0001F9DB\u200D\u2642\uFE0F", u"\U0001F9DB\u200D\u2642", u"1F9DB-200D-2642-FE0F", u"1F9DB-200D-2642", 3368, 1, 15},
+    {u"\U0001F9DB\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F9DB\U0001F3FB\u200D\u2642", u"1F9DB-1F3FB-200D-2642-FE0F", u"1F9DB-1F3FB-200D-2642", 3369, 1, 15},
+    {u"\U0001F9DB\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F9DB\U0001F3FC\u200D\u2642", u"1F9DB-1F3FC-200D-2642-FE0F", u"1F9DB-1F3FC-200D-2642", 3370, 1, 15},
+    {u"\U0001F9DB\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F9DB\U0001F3FD\u200D\u2642", u"1F9DB-1F3FD-200D-2642-FE0F", u"1F9DB-1F3FD-200D-2642", 3371, 1, 15},
+    {u"\U0001F9DB\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F9DB\U0001F3FE\u200D\u2642", u"1F9DB-1F3FE-200D-2642-FE0F", u"1F9DB-1F3FE-200D-2642", 3372, 1, 15},
+    {u"\U0001F9DB\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F9DB\U0001F3FF\u200D\u2642", u"1F9DB-1F3FF-200D-2642-FE0F", u"1F9DB-1F3FF-200D-2642", 3373, 1, 15},
+    {u"\U0001F9DB", u"", u"1F9DB", u"", 3374, 1, 15},
+    {u"\U0001F9DB\U0001F3FB", u"", u"1F9DB-1F3FB", u"", 3375, 1, 15},
+    {u"\U0001F9DB\U0001F3FC", u"", u"1F9DB-1F3FC", u"", 3376, 1, 15},
+    {u"\U0001F9DB\U0001F3FD", u"", u"1F9DB-1F3FD", u"", 3377, 1, 15},
+    {u"\U0001F9DB\U0001F3FE", u"", u"1F9DB-1F3FE", u"", 3378, 1, 15},
+    {u"\U0001F9DB\U0001F3FF", u"", u"1F9DB-1F3FF", u"", 3379, 1, 15},
+    {u"\U0001F9DC\u200D\u2640\uFE0F", u"\U0001F9DC\u200D\u2640", u"1F9DC-200D-2640-FE0F", u"1F9DC-200D-2640", 3380, 1, 15},
+    {u"\U0001F9DC\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F9DC\U0001F3FB\u200D\u2640", u"1F9DC-1F3FB-200D-2640-FE0F", u"1F9DC-1F3FB-200D-2640", 3381, 1, 15},
+    {u"\U0001F9DC\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F9DC\U0001F3FC\u200D\u2640", u"1F9DC-1F3FC-200D-2640-FE0F", u"1F9DC-1F3FC-200D-2640", 3382, 1, 15},
+    {u"\U0001F9DC\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F9DC\U0001F3FD\u200D\u2640", u"1F9DC-1F3FD-200D-2640-FE0F", u"1F9DC-1F3FD-200D-2640", 3383, 1, 15},
+    {u"\U0001F9DC\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F9DC\U0001F3FE\u200D\u2640", u"1F9DC-1F3FE-200D-2640-FE0F", u"1F9DC-1F3FE-200D-2640", 3384, 1, 15},
+    {u"\U0001F9DC\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F9DC\U0001F3FF\u200D\u2640", u"1F9DC-1F3FF-200D-2640-FE0F", u"1F9DC-1F3FF-200D-2640", 3385, 1, 15},
+    {u"\U0001F9DC\u200D\u2642\uFE0F", u"\U0001F9DC\u200D\u2642", u"1F9DC-200D-2642-FE0F", u"1F9DC-200D-2642", 3386, 1, 15},
+    {u"\U0001F9DC\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F9DC\U0001F3FB\u200D\u2642", u"1F9DC-1F3FB-200D-2642-FE0F", u"1F9DC-1F3FB-200D-2642", 3387, 1, 15},
+    {u"\U0001F9DC\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F9DC\U0001F3FC\u200D\u2642", u"1F9DC-1F3FC-200D-2642-FE0F", u"1F9DC-1F3FC-200D-2642", 3388, 1, 15},
+    {u"\U0001F9DC\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F9DC\U0001F3FD\u200D\u2642", u"1F9DC-1F3FD-200D-2642-FE0F", u"1F9DC-1F3FD-200D-2642", 3389, 1, 15},
+    {u"\U0001F9DC\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F9DC\U0001F3FE\u200D\u2642", u"1F9DC-1F3FE-200D-2642-FE0F", u"1F9DC-1F3FE-200D-2642", 3390, 1, 15},
+    {u"\U0001F9DC\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F9DC\U0001F3FF\u200D\u2642", u"1F9DC-1F3FF-200D-2642-FE0F", u"1F9DC-1F3FF-200D-2642", 3391, 1, 15},
+    {u"\U0001F9DC", u"", u"1F9DC", u"", 3392, 1, 15},
+    {u"\U0001F9DC\U0001F3FB", u"", u"1F9DC-1F3FB", u"", 3393, 1, 15},
+    {u"\U0001F9DC\U0001F3FC", u"", u"1F9DC-1F3FC", u"", 3394, 1, 15},
+    {u"\U0001F9DC\U0001F3FD", u"", u"1F9DC-1F3FD", u"", 3395, 1, 15},
+    {u"\U0001F9DC\U0001F3FE", u"", u"1F9DC-1F3FE", u"", 3396, 1, 15},
+    {u"\U0001F9DC\U0001F3FF", u"", u"1F9DC-1F3FF", u"", 3397, 1, 15},
+    {u"\U0001F9DD\u200D\u2640\uFE0F", u"\U0001F9DD\u200D\u2640", u"1F9DD-200D-2640-FE0F", u"1F9DD-200D-2640", 3398, 1, 15},
+    {u"\U0001F9DD\U0001F3FB\u200D\u2640\uFE0F", u"\U0001F9DD\U0001F3FB\u200D\u2640", u"1F9DD-1F3FB-200D-2640-FE0F", u"1F9DD-1F3FB-200D-2640", 3399, 1, 15},
+    {u"\U0001F9DD\U0001F3FC\u200D\u2640\uFE0F", u"\U0001F9DD\U0001F3FC\u200D\u2640", u"1F9DD-1F3FC-200D-2640-FE0F", u"1F9DD-1F3FC-200D-2640", 3400, 1, 15},
+    {u"\U0001F9DD\U0001F3FD\u200D\u2640\uFE0F", u"\U0001F9DD\U0001F3FD\u200D\u2640", u"1F9DD-1F3FD-200D-2640-FE0F", u"1F9DD-1F3FD-200D-2640", 3401, 1, 15},
+    {u"\U0001F9DD\U0001F3FE\u200D\u2640\uFE0F", u"\U0001F9DD\U0001F3FE\u200D\u2640", u"1F9DD-1F3FE-200D-2640-FE0F", u"1F9DD-1F3FE-200D-2640", 3402, 1, 15},
+    {u"\U0001F9DD\U0001F3FF\u200D\u2640\uFE0F", u"\U0001F9DD\U0001F3FF\u200D\u2640", u"1F9DD-1F3FF-200D-2640-FE0F", u"1F9DD-1F3FF-200D-2640", 3403, 1, 15},
+    {u"\U0001F9DD\u200D\u2642\uFE0F", u"\U0001F9DD\u200D\u2642", u"1F9DD-200D-2642-FE0F", u"1F9DD-200D-2642", 3404, 1, 15},
+    {u"\U0001F9DD\U0001F3FB\u200D\u2642\uFE0F", u"\U0001F9DD\U0001F3FB\u200D\u2642", u"1F9DD-1F3FB-200D-2642-FE0F", u"1F9DD-1F3FB-200D-2642", 3405, 1, 15},
+    {u"\U0001F9DD\U0001F3FC\u200D\u2642\uFE0F", u"\U0001F9DD\U0001F3FC\u200D\u2642", u"1F9DD-1F3FC-200D-2642-FE0F", u"1F9DD-1F3FC-200D-2642", 3406, 1, 15},
+    {u"\U0001F9DD\U0001F3FD\u200D\u2642\uFE0F", u"\U0001F9DD\U0001F3FD\u200D\u2642", u"1F9DD-1F3FD-200D-2642-FE0F", u"1F9DD-1F3FD-200D-2642", 3407, 1, 15},
+    {u"\U0001F9DD\U0001F3FE\u200D\u2642\uFE0F", u"\U0001F9DD\U0001F3FE\u200D\u2642", u"1F9DD-1F3FE-200D-2642-FE0F", u"1F9DD-1F3FE-200D-2642", 3408, 1, 15},
+    {u"\U0001F9DD\U0001F3FF\u200D\u2642\uFE0F", u"\U0001F9DD\U0001F3FF\u200D\u2642", u"1F9DD-1F3FF-200D-2642-FE0F", u"1F9DD-1F3FF-200D-2642", 3409, 1, 15},
+    {u"\U0001F9DD", u"", u"1F9DD", u"", 3410, 1, 15},
+    {u"\U0001F9DD\U0001F3FB", u"", u"1F9DD-1F3FB", u"", 3411, 1, 15},
+    {u"\U0001F9DD\U0001F3FC", u"", u"1F9DD-1F3FC", u"", 3412, 1, 15},
+    {u"\U0001F9DD\U0001F3FD", u"", u"1F9DD-1F3FD", u"", 3413, 1, 15},
+    {u"\U0001F9DD\U0001F3FE", u"", u"1F9DD-1F3FE", u"", 3414, 1, 15},
+    {u"\U0001F9DD\U0001F3FF", u"", u"1F9DD-1F3FF", u"", 3415, 1, 15},
+    {u"\U0001F9DE\u200D\u2640\uFE0F", u"\U0001F9DE\u200D\u2640", u"1F9DE-200D-2640-FE0F", u"1F9DE-200D-2640", 3416, 1, 15},
+    {u"\U0001F9DE\u200D\u2642\uFE0F", u"\U0001F9DE\u200D\u2642", u"1F9DE-200D-2642-FE0F", u"1F9DE-200D-2642", 3417, 1, 15},
+    {u"\U0001F9DE", u"", u"1F9DE", u"", 3418, 1, 15},
+    {u"\U0001F9DF\u200D\u2640\uFE0F", u"\U0001F9DF\u200D\u2640", u"1F9DF-200D-2640-FE0F", u"1F9DF-200D-2640", 3419, 1, 15},
+    {u"\U0001F9DF\u200D\u2642\uFE0F", u"\U0001F9DF\u200D\u2642", u"1F9DF-200D-2642-FE0F", u"1F9DF-200D-2642", 3420, 1, 15},
+    {u"\U0001F9DF", u"", u"1F9DF", u"", 3421, 1, 15},
+    {u"\U0001F9E0", u"", u"1F9E0", u"", 3422, 1, 15},
+    {u"\U0001F9E1", u"", u"1F9E1", u"", 3423, 1, 15},
+    {u"\U0001F9E2", u"", u"1F9E2", u"", 3424, 1, 15},
+    {u"\U0001F9E3", u"", u"1F9E3", u"", 3425, 1, 15},
+    {u"\U0001F9E4", u"", u"1F9E4", u"", 3426, 1, 15},
+    {u"\U0001F9E5", u"", u"1F9E5", u"", 3427, 1, 15},
+    {u"\U0001F9E6", u"", u"1F9E6", u"", 3428, 1, 15},
+    {u"\U0001F9E7", u"", u"1F9E7", u"", 3429, 1, 15},
+    {u"\U0001F9E8", u"", u"1F9E8", u"", 3430, 1, 15},
+    {u"\U0001F9E9", u"", u"1F9E9", u"", 3431, 1, 15},
+    {u"\U0001F9EA", u"", u"1F9EA", u"", 3432, 1, 15},
+    {u"\U0001F9EB", u"", u"1F9EB", u"", 3433, 1, 15},
+    {u"\U0001F9EC", u"", u"1F9EC", u"", 3434, 1, 15},
+    {u"\U0001F9ED", u"", u"1F9ED", u"", 3435, 1, 15},
+    {u"\U0001F9EE", u"", u"1F9EE", u"", 3436, 1, 15},
+    {u"\U0001F9EF", u"", u"1F9EF", u"", 3437, 1, 15},
+    {u"\U0001F9F0", u"", u"1F9F0", u"", 3438, 1, 15},
+    {u"\U0001F9F1", u"", u"1F9F1", u"", 3439, 1, 15},
+    {u"\U0001F9F2", u"", u"1F9F2", u"", 3440, 1, 15},
+    {u"\U0001F9F3", u"", u"1F9F3", u"", 3441, 1, 15},
+    {u"\U0001F9F4", u"", u"1F9F4", u"", 3442, 1, 15},
+    {u"\U0001F9F5", u"", u"1F9F5", u"", 3443, 1, 15},
+    {u"\U0001F9F6", u"", u"1F9F6", u"", 3444, 1, 15},
+    {u"\U0001F9F7", u"", u"1F9F7", u"", 3445, 1, 15},
+    {u"\U0001F9F8", u"", u"1F9F8", u"", 3446, 1, 15},
+    {u"\U0001F9F9", u"", u"1F9F9", u"", 3447, 1, 15},
+    {u"\U0001F9FA", u"", u"1F9FA", u"", 3448, 1, 15},
+    {u"\U0001F9FB", u"", u"1F9FB", u"", 3449, 1, 15},
+    {u"\U0001F9FC", u"", u"1F9FC", u"", 3450, 1, 15},
+    {u"\U0001F9FD", u"", u"1F9FD", u"", 3451, 1, 15},
+    {u"\U0001F9FE", u"", u"1F9FE", u"", 3452, 1, 15},
+    {u"\U0001F9FF", u"", u"1F9FF", u"", 3453, 1, 15},
+    {u"\U0001FA70", u"", u"1FA70", u"", 3454, 1, 15},
+    {u"\U0001FA71", u"", u"1FA71", u"", 3455, 1, 15},
+    {u"\U0001FA72", u"", u"1FA72", u"", 3456, 1, 15},
+    {u"\U0001FA73", u"", u"1FA73", u"", 3457, 1, 15},
+    {u"\U0001FA74", u"", u"1FA74", u"", 3458, 1, 15},
+    {u"\U0001FA75", u"", u"1FA75", u"", 3459, 1, 15},
+    {u"\U0001FA76", u"", u"1FA76", u"", 3460, 1, 15},
+    {u"\U0001FA77", u"", u"1FA77", u"", 3461, 1, 15},
+    {u"\U0001FA78", u"", u"1FA78", u"", 3462, 1, 15},
+    {u"\U0001FA79", u"", u"1FA79", u"", 3463, 1, 15},
+    {u"\U0001FA7A", u"", u"1FA7A", u"", 3464, 1, 15},
+    {u"\U0001FA7B", u"", u"1FA7B", u"", 3465, 1, 15},
+    {u"\U0001FA7C", u"", u"1FA7C", u"", 3466, 1, 15},
+    {u"\U0001FA80", u"", u"1FA80", u"", 3467, 1, 15},
+    {u"\U0001FA81", u"", u"1FA81", u"", 3468, 1, 15},
+    {u"\U0001FA82", u"", u"1FA82", u"", 3469, 1, 15},
+    {u"\U0001FA83", u"", u"1FA83", u"", 3470, 1, 15},
+    {u"\U0001FA84", u"", u"1FA84", u"", 3471, 1, 15},
+    {u"\U0001FA85", u"", u"1FA85", u"", 3472, 1, 15},
+    {u"\U0001FA86", u"", u"1FA86", u"", 3473, 1, 15},
+    {u"\U0001FA87", u"", u"1FA87", u"", 3474, 1, 15},
+    {u"\U0001FA88", u"", u"1FA88", u"", 3475, 1, 15},
+    {u"\U0001FA89", u"", u"1FA89", u"", 3476, 1, 7},
+    {u"\U0001FA8F", u"", u"1FA8F", u"", 3477, 1, 7},
+    {u"\U0001FA90", u"", u"1FA90", u"", 3478, 1, 15},
+    {u"\U0001FA91", u"", u"1FA91", u"", 3479, 1, 15},
+    {u"\U0001FA92", u"", u"1FA92", u"", 3480, 1, 15},
+    {u"\U0001FA93", u"", u"1FA93", u"", 3481, 1, 15},
+    {u"\U0001FA94", u"", u"1FA94", u"", 3482, 1, 15},
+    {u"\U0001FA95", u"", u"1FA95", u"", 3483, 1, 15},
+    {u"\U0001FA96", u"", u"1FA96", u"", 3484, 1, 15},
+    {u"\U0001FA97", u"", u"1FA97", u"", 3485, 1, 15},
+    {u"\U0001FA98", u"", u"1FA98", u"", 3486, 1, 15},
+    {u"\U0001FA99", u"", u"1FA99", u"", 3487, 1, 15},
+    {u"\U0001FA9A", u"", u"1FA9A", u"", 3488, 1, 15},
+    {u"\U0001FA9B", u"", u"1FA9B", u"", 3489, 1, 15},
+    {u"\U0001FA9C", u"", u"1FA9C", u"", 3490, 1, 15},
+    {u"\U0001FA9D", u"", u"1FA9D", u"", 3491, 1, 15},
+    {u"\U0001FA9E", u"", u"1FA9E", u"", 3492, 1, 15},
+    {u"\U0001FA9F", u"", u"1FA9F", u"", 3493, 1, 15},
+    {u"\U0001FAA0", u"", u"1FAA0", u"", 3494, 1, 15},
+    {u"\U0001FAA1", u"", u"1FAA1", u"", 3495, 1, 15},
+    {u"\U0001FAA2", u"", u"1FAA2", u"", 3496, 1, 15},
+    {u"\U0001FAA3", u"", u"1FAA3", u"", 3497, 1, 15},
+    {u"\U0001FAA4", u"", u"1FAA4", u"", 3498, 1, 15},
+    {u"\U0001FAA5", u"", u"1FAA5", u"", 3499, 1, 15},
+    {u"\U0001FAA6", u"", u"1FAA6", u"", 3500, 1, 15},
+    {u"\U0001FAA7", u"", u"1FAA7", u"", 3501, 1, 15},
+    {u"\U0001FAA8", u"", u"1FAA8", u"", 3502, 1, 15},
+    {u"\U0001FAA9", u"", u"1FAA9", u"", 3503, 1, 15},
+    {u"\U0001FAAA", u"", u"1FAAA", u"", 3504, 1, 15},
+    {u"\U0001FAAB", u"", u"1FAAB", u"", 3505, 1, 15},
+    {u"\U0001FAAC", u"", u"1FAAC", u"", 3506, 1, 15},
+    {u"\U0001FAAD", u"", u"1FAAD", u"", 3507, 1, 15},
+    {u"\U0001FAAE", u"", u"1FAAE", u"", 3508, 1, 15},
+    {u"\U0001FAAF", u"", u"1FAAF", u"", 3509, 1, 15},
+    {u"\U0001FAB0", u"", u"1FAB0", u"", 3510, 1, 15},
+    {u"\U0001FAB1", u"", u"1FAB1", u"", 3511, 1, 15},
+    {u"\U0001FAB2", u"", u"1FAB2", u"", 3512, 1, 15},
+    {u"\U0001FAB3", u"", u"1FAB3", u"", 3513, 1, 15},
+    {u"\U0001FAB4", u"", u"1FAB4", u"", 3514, 1, 15},
+    {u"\U0001FAB5", u"", u"1FAB5", u"", 3515, 1, 15},
+    {u"\U0001FAB6", u"", u"1FAB6", u"", 3516, 1, 15},
+    {u"\U0001FAB7", u"", u"1FAB7", u"", 3517, 1, 15},
+    {u"\U0001FAB8", u"", u"1FAB8", u"", 3518, 1, 15},
+    {u"\U0001FAB9", u"", u"1FAB9", u"", 3519, 1, 15},
+    {u"\U0001FABA", u"", u"1FABA", u"", 3520, 1, 15},
+    {u"\U0001FABB", u"", u"1FABB", u"", 3521, 1, 15},
+    {u"\U0001FABC", u"", u"1FABC", u"", 3522, 1, 15},
+    {u"\U0001FABD", u"", u"1FABD", u"", 3523, 1, 15},
+    {u"\U0001FABE", u"", u"1FABE", u"", 3524, 1, 7},
+    {u"\U0001FABF", u"", u"1FABF", u"", 3525, 1, 15},
+    {u"\U0001FAC0", u"", u"1FAC0", u"", 3526, 1, 15},
+    {u"\U0001FAC1", u"", u"1FAC1", u"", 3527, 1, 15},
+    {u"\U0001FAC2", u"", u"1FAC2", u"", 3528, 1, 15},
+    {u"\U0001FAC3", u"", u"1FAC3", u"", 3529, 1, 15},
+    {u"\U0001FAC3\U0001F3FB", u"", u"1FAC3-1F3FB", u"", 3530, 1, 15},
+    {u"\U0001FAC3\U0001F3FC", u"", u"1FAC3-1F3FC", u"", 3531, 1, 15},
+    {u"\U0001FAC3\U0001F3FD", u"", u"1FAC3-1F3FD", u"", 3532, 1, 15},
+    {u"\U0001FAC3\U0001F3FE", u"", u"1FAC3-1F3FE", u"", 3533, 1, 15},
+    {u"\U0001FAC3\U0001F3FF", u"", u"1FAC3-1F3FF", u"", 3534, 1, 15},
+    {u"\U0001FAC4", u"", u"1FAC4", u"", 3535, 1, 15},
+    {u"\U0001FAC4\U0001F3FB", u"", u"1FAC4-1F3FB", u"", 3536, 1, 15},
+    {u"\U0001FAC4\U0001F3FC", u"", u"1FAC4-1F3FC", u"", 3537, 1, 15},
+    {u"\U0001FAC4\U0001F3FD", u"", u"1FAC4-1F3FD", u"", 3538, 1, 15},
+    {u"\U0001FAC4\U0001F3FE", u"", u"1FAC4-1F3FE", u"", 3539, 1, 15},
+    {u"\U0001FAC4\U0001F3FF", u"", u"1FAC4-1F3FF", u"", 3540, 1, 15},
+    {u"\U0001FAC5", u"", u"1FAC5", u"", 3541, 1, 15},
+    {u"\U0001FAC5\U0001F3FB", u"", u"1FAC5-1F3FB", u"", 3542, 1, 15},
+    {u"\U0001FAC5\U0001F3FC", u"", u"1FAC5-1F3FC", u"", 3543, 1, 15},
+    {u"\U0001FAC5\U0001F3FD", u"", u"1FAC5-1F3FD", u"", 3544, 1, 15},
+    {u"\U0001FAC5\U0001F3FE", u"", u"1FAC5-1F3FE", u"", 3545, 1, 15},
+    {u"\U0001FAC5\U0001F3FF", u"", u"1FAC5-1F3FF", u"", 3546, 1, 15},
+    {u"\U0001FAC6", u"", u"1FAC6", u"", 3547, 1, 7},
+    {u"\U0001FACE", u"", u"1FACE", u"", 3548, 1, 15},
+    {u"\U0001FACF", u"", u"1FACF", u"", 3549, 1, 15},
+    {u"\U0001FAD0", u"", u"1FAD0", u"", 3550, 1, 15},
+    {u"\U0001FAD1", u"", u"1FAD1", u"", 3551, 1, 15},
+    {u"\U0001FAD2", u"", u"1FAD2", u"", 3552, 1, 15},
+    {u"\U0001FAD3", u"", u"1FAD3", u"", 3553, 1, 15},
+    {u"\U0001FAD4", u"", u"1FAD4", u"", 3554, 1, 15},
+    {u"\U0001FAD5", u"", u"1FAD5", u"", 3555, 1, 15},
+    {u"\U0001FAD6", u"", u"1FAD6", u"", 3556, 1, 15},
+    {u"\U0001FAD7", u"", u"1FAD7", u"", 3557, 1, 15},
+    {u"\U0001FAD8", u"", u"1FAD8", u"", 3558, 1, 15},
+    {u"\U0001FAD9", u"", u"1FAD9", u"", 3559, 1, 15},
+    {u"\U0001FADA", u"", u"1FADA", u"", 3560, 1, 15},
+    {u"\U0001FADB", u"", u"1FADB", u"", 3561, 1, 15},
+    {u"\U0001FADC", u"", u"1FADC", u"", 3562, 1, 7},
+    {u"\U0001FADF", u"", u"1FADF", u"", 3563, 1, 7},
+    {u"\U0001FAE0", u"", u"1FAE0", u"", 3564, 1, 15},
+    {u"\U0001FAE1", u"", u"1FAE1", u"", 3565, 1, 15},
+    {u"\U0001FAE2", u"", u"1FAE2", u"", 3566, 1, 15},
+    {u"\U0001FAE3", u"", u"1FAE3", u"", 3567, 1, 15},
+    {u"\U0001FAE4", u"", u"1FAE4", u"", 3568, 1, 15},
+    {u"\U0001FAE5", u"", u"1FAE5", u"", 3569, 1, 15},
+    {u"\U0001FAE6", u"", u"1FAE6", u"", 3570, 1, 15},
+    {u"\U0001FAE7", u"", u"1FAE7", u"", 3571, 1, 15},
+    {u"\U0001FAE8", u"", u"1FAE8", u"", 3572, 1, 15},
+    {u"\U0001FAE9", u"", u"1FAE9", u"", 3573, 1, 7},
+    {u"\U0001FAF0", u"", u"1FAF0", u"", 3574, 1, 15},
+    {u"\U0001FAF0\U0001F3FB", u"", u"1FAF0-1F3FB", u"", 3575, 1, 15},
+    {u"\U0001FAF0\U0001F3FC", u"", u"1FAF0-1F3FC", u"", 3576, 1, 15},
+    {u"\U0001FAF0\U0001F3FD", u"", u"1FAF0-1F3FD", u"", 3577, 1, 15},
+    {u"\U0001FAF0\U0001F3FE", u"", u"1FAF0-1F3FE", u"", 3578, 1, 15},
+    {u"\U0001FAF0\U0001F3FF", u"", u"1FAF0-1F3FF", u"", 3579, 1, 15},
+    {u"\U0001FAF1", u"", u"1FAF1", u"", 3580, 1, 15},
+    {u"\U0001FAF1\U0001F3FB", u"", u"1FAF1-1F3FB", u"", 3581, 1, 15},
+    {u"\U0001FAF1\U0001F3FC", u"", u"1FAF1-1F3FC", u"", 3582, 1, 15},
+    {u"\U0001FAF1\U0001F3FD", u"", u"1FAF1-1F3FD", u"", 3583, 1, 15},
+    {u"\U0001FAF1\U0001F3FE", u"", u"1FAF1-1F3FE", u"", 3584, 1, 15},
+    {u"\U0001FAF1\U0001F3FF", u"", u"1FAF1-1F3FF", u"", 3585, 1, 15},
+    {u"\U0001FAF2", u"", u"1FAF2", u"", 3586, 1, 15},
+    {u"\U0001FAF2\U0001F3FB", u"", u"1FAF2-1F3FB", u"", 3587, 1, 15},
+    {u"\U0001FAF2\U0001F3FC", u"", u"1FAF2-1F3FC", u"", 3588, 1, 15},
+    {u"\U0001FAF2\U0001F3FD", u"", u"1FAF2-1F3FD", u"", 3589, 1, 15},
+    {u"\U0001FAF2\U0001F3FE", u"", u"1FAF2-1F3FE", u"", 3590, 1, 15},
+    {u"\U0001FAF2\U0001F3FF", u"", u"1FAF2-1F3FF", u"", 3591, 1, 15},
+    {u"\U0001FAF3", u"", u"1FAF3", u"", 3592, 1, 15},
+    {u"\U0001FAF3\U0001F3FB", u"", u"1FAF3-1F3FB", u"", 3593, 1, 15},
+    {u"\U0001FAF3\U0001F3FC", u"", u"1FAF3-1F3FC", u"", 3594, 1, 15},
+    {u"\U0001FAF3\U0001F3FD", u"", u"1FAF3-1F3FD", u"", 3595, 1, 15},
+    {u"\U0001FAF3\U0001F3FE", u"", u"1FAF3-1F3FE", u"", 3596, 1, 15},
+    {u"\U0001FAF3\U0001F3FF", u"", u"1FAF3-1F3FF", u"", 3597, 1, 15},
+    {u"\U0001FAF4", u"", u"1FAF4", u"", 3598, 1, 15},
+    {u"\U0001FAF4\U0001F3FB", u"", u"1FAF4-1F3FB", u"", 3599, 1, 15},
+    {u"\U0001FAF4\U0001F3FC", u"", u"1FAF4-1F3FC", u"", 3600, 1, 15},
+    {u"\U0001FAF4\U0001F3FD", u"", u"1FAF4-1F3FD", u"", 3601, 1, 15},
+    {u"\U0001FAF4\U0001F3FE", u"", u"1FAF4-1F3FE", u"", 3602, 1, 15},
+    {u"\U0001FAF4\U0001F3FF", u"", u"1FAF4-1F3FF", u"", 3603, 1, 15},
+    {u"\U0001FAF5", u"", u"1FAF5", u"", 3604, 1, 15},
+    {u"\U0001FAF5\U0001F3FB", u"", u"1FAF5-1F3FB", u"", 3605, 1, 15},
+    {u"\U0001FAF5\U0001F3FC", u"", u"1FAF5-1F3FC", u"", 3606, 1, 15},
+    {u"\U0001FAF5\U0001F3FD", u"", u"1FAF5-1F3FD", u"", 3607, 1, 15},
+    {u"\U0001FAF5\U0001F3FE", u"", u"1FAF5-1F3FE", u"", 3608, 1, 15},
+    {u"\U0001FAF5\U0001F3FF", u"", u"1FAF5-1F3FF", u"", 3609, 1, 15},
+    {u"\U0001FAF6", u"", u"1FAF6", u"", 3610, 1, 15},
+    {u"\U0001FAF6\U0001F3FB", u"", u"1FAF6-1F3FB", u"", 3611, 1, 15},
+    {u"\U0001FAF6\U0001F3FC", u"", u"1FAF6-1F3FC", u"", 3612, 1, 15},
+    {u"\U0001FAF6\U0001F3FD", u"", u"1FAF6-1F3FD", u"", 3613, 1, 15},
+    {u"\U0001FAF6\U0001F3FE", u"", u"1FAF6-1F3FE", u"", 3614, 1, 15},
+    {u"\U0001FAF6\U0001F3FF", u"", u"1FAF6-1F3FF", u"", 3615, 1, 15},
+    {u"\U0001FAF7", u"", u"1FAF7", u"", 3616, 1, 15},
+    {u"\U0001FAF7\U0001F3FB", u"", u"1FAF7-1F3FB", u"", 3617, 1, 15},
+    {u"\U0001FAF7\U0001F3FC", u"", u"1FAF7-1F3FC", u"", 3618, 1, 15},
+    {u"\U0001FAF7\U0001F3FD", u"", u"1FAF7-1F3FD", u"", 3619, 1, 15},
+    {u"\U0001FAF7\U0001F3FE", u"", u"1FAF7-1F3FE", u"", 3620, 1, 15},
+    {u"\U0001FAF7\U0001F3FF", u"", u"1FAF7-1F3FF", u"", 3621, 1, 15},
+    {u"\U0001FAF8", u"", u"1FAF8", u"", 3622, 1, 15},
+    {u"\U0001FAF8\U0001F3FB", u"", u"1FAF8-1F3FB", u"", 3623, 1, 15},
+    {u"\U0001FAF8\U0001F3FC", u"", u"1FAF8-1F3FC", u"", 3624, 1, 15},
+    {u"\U0001FAF8\U0001F3FD", u"", u"1FAF8-1F3FD", u"", 3625, 1, 15},
+    {u"\U0001FAF8\U0001F3FE", u"", u"1FAF8-1F3FE", u"", 3626, 1, 15},
+    {u"\U0001FAF8\U0001F3FF", u"", u"1FAF8-1F3FF", u"", 3627, 1, 15},
+    {u"\u203C\uFE0F", u"\u203C", u"203C-FE0F", u"203C", 3628, 1, 15},
+    {u"\u2049\uFE0F", u"\u2049", u"2049-FE0F", u"2049", 3629, 1, 15},
+    {u"\u2122\uFE0F", u"\u2122", u"2122-FE0F", u"2122", 3630, 1, 15},
+    {u"\u2139\uFE0F", u"\u2139", u"2139-FE0F", u"2139", 3631, 1, 15},
+    {u"\u2194\uFE0F", u"\u2194", u"2194-FE0F", u"2194", 3632, 1, 15},
+    {u"\u2195\uFE0F", u"\u2195", u"2195-FE0F", u"2195", 3633, 1, 15},
+    {u"\u2196\uFE0F", u"\u2196", u"2196-FE0F", u"2196", 3634, 1, 15},
+    {u"\u2197\uFE0F", u"\u2197", u"2197-FE0F", u"2197", 3635, 1, 15},
+    {u"\u2198\uFE0F", u"\u2198", u"2198-FE0F", u"2198", 3636, 1, 15},
+    {u"\u2199\uFE0F", u"\u2199", u"2199-FE0F", u"2199", 3637, 1, 15},
+    {u"\u21A9\uFE0F", u"\u21A9", u"21A9-FE0F", u"21A9", 3638, 1, 15},
+    {u"\u21AA\uFE0F", u"\u21AA", u"21AA-FE0F", u"21AA", 3639, 1, 15},
+    {u"\u231A", u"", u"231A", u"", 3640, 1, 15},
+    {u"\u231B", u"", u"231B", u"", 3641, 1, 15},
+    {u"\u2328\uFE0F", u"\u2328", u"2328-FE0F", u"2328", 3642, 1, 15},
+    {u"\u23CF\uFE0F", u"\u23CF", u"23CF-FE0F", u"23CF", 3643, 1, 15},
+    {u"\u23E9", u"", u"23E9", u"", 3644, 1, 15},
+    {u"\u23EA", u"", u"23EA", u"", 3645, 1, 15},
+    {u"\u23EB", u"", u"23EB", u"", 3646, 1, 15},
+    {u"\u23EC", u"", u"23EC", u"", 3647, 1, 15},
+    {u"\u23ED\uFE0F", u"\u23ED", u"23ED-FE0F", u"23ED", 3648, 1, 15},
+    {u"\u23EE\uFE0F", u"\u23EE", u"23EE-FE0F", u"23EE", 3649, 1, 15},
+    {u"\u23EF\uFE0F", u"\u23EF", u"23EF-FE0F", u"23EF", 3650, 1, 15},
+    {u"\u23F0", u"", u"23F0", u"", 3651, 1, 15},
+    {u"\u23F1\uFE0F", u"\u23F1", u"23F1-FE0F", u"23F1", 3652, 1, 15},
+    {u"\u23F2\uFE0F", u"\u23F2", u"23F2-FE0F", u"23F2", 3653, 1, 15},
+    {u"\u23F3", u"", u"23F3", u"", 3654, 1, 15},
+    {u"\u23F8\uFE0F", u"\u23F8", u"23F8-FE0F", u"23F8", 3655, 1, 15},
+    {u"\u23F9\uFE0F", u"\u23F9", u"23F9-FE0F", u"23F9", 3656, 1, 15},
+    {u"\u23FA\uFE0F", u"\u23FA", u"23FA-FE0F", u"23FA", 3657, 1, 15},
+    {u"\u24C2\uFE0F", u"\u24C2", u"24C2-FE0F", u"24C2", 3658, 1, 15},
+    {u"\u25AA\uFE0F", u"\u25AA", u"25AA-FE0F", u"25AA", 3659, 1, 15},
+    {u"\u25AB\uFE0F", u"\u25AB", u"25AB-FE0F", u"25AB", 3660, 1, 15},
+    {u"\u25B6\uFE0F", u"\u25B6", u"25B6-FE0F", u"25B6", 3661, 1, 15},
+    {u"\u25C0\uFE0F", u"\u25C0", u"25C0-FE0F", u"25C0", 3662, 1, 15},
+    {u"\u25FB\uFE0F", u"\u25FB", u"25FB-FE0F", u"25FB", 3663, 1, 15},
+    {u"\u25FC\uFE0F", u"\u25FC", u"25FC-FE0F", u"25FC", 3664, 1, 15},
+    {u"\u25FD", u"", u"25FD", u"", 3665, 1, 15},
+    {u"\u25FE", u"", u"25FE", u"", 3666, 1, 15},
+    {u"\u2600\uFE0F", u"\u2600", u"2600-FE0F", u"2600", 3667, 1, 15},
+    {u"\u2601\uFE0F", u"\u2601", u"2601-FE0F", u"2601", 3668, 1, 15},
+    {u"\u2602\uFE0F", u"\u2602", u"2602-FE0F", u"2602", 3669, 1, 15},
+    {u"\u2603\uFE0F", u"\u2603", u"2603-FE0F", u"2603", 3670, 1, 15},
+    {u"\u2604\uFE0F", u"\u2604", u"2604-FE0F", u"2604", 3671, 1, 15},
+    {u"\u260E\uFE0F", u"\u260E", u"260E-FE0F", u"260E", 3672, 2, 15},
+    {u"\u2611\uFE0F", u"\u2611", u"2611-FE0F", u"2611", 3674, 1, 15},
+    {u"\u2614", u"", u"2614", u"", 3675, 1, 15},
+    {u"\u2615", u"", u"2615", u"", 3676, 1, 15},
+    {u"\u2618\uFE0F", u"\u2618", u"2618-FE0F", u"2618", 3677, 1, 15},
+    {u"\u261D\uFE0F", u"\u261D", u"261D-FE0F", u"261D", 3678, 1, 15},
+    {u"\u261D\U0001F3FB", u"", u"261D-1F3FB", u"", 3679, 1, 15},
+    {u"\u261D\U0001F3FC", u"", u"261D-1F3FC", u"", 3680, 1, 15},
+    {u"\u261D\U0001F3FD", u"", u"261D-1F3FD", u"", 3681, 1, 15},
+    {u"\u261D\U0001F3FE", u"", u"261D-1F3FE", u"", 3682, 1, 15},
+    {u"\u261D\U0001F3FF", u"", u"261D-1F3FF", u"", 3683, 1, 15},
+    {u"\u2620\uFE0F", u"\u2620", u"2620-FE0F", u"2620", 3684, 1, 15},
+    {u"\u2622\uFE0F", u"\u2622", u"2622-FE0F", u"2622", 3685, 1, 15},
+    {u"\u2623\uFE0F", u"\u2623", u"2623-FE0F", u"2623", 3686, 1, 15},
+    {u"\u2626\uFE0F", u"\u2626", u"2626-FE0F", u"2626", 3687, 1, 15},
+    {u"\u262A\uFE0F", u"\u262A", u"262A-FE0F", u"262A", 3688, 1, 15},
+    {u"\u262E\uFE0F", u"\u262E", u"262E-FE0F", u"262E", 3689, 1, 15},
+    {u"\u262F\uFE0F", u"\u262F", u"262F-FE0F", u"262F", 3690, 1, 15},
+    {u"\u2638\uFE0F", u"\u2638", u"2638-FE0F", u"2638", 3691, 1, 15},
+    {u"\u2639\uFE0F", u"\u2639", u"2639-FE0F", u"2639", 3692, 1, 15},
+    {u"\u263A\uFE0F", u"\u263A", u"263A-FE0F", u"263A", 3693, 1, 15},
+    {u"\u2640\uFE0F", u"\u2640", u"2640-FE0F", u"2640", 3694, 1, 14},
+    {u"\u2642\uFE0F", u"\u2642", u"2642-FE0F", u"2642", 3695, 1, 14},
+    {u"\u2648", u"", u"2648", u"", 3696, 1, 15},
+    {u"\u2649", u"", u"2649", u"", 3697, 1, 15},
+    {u"\u264A", u"", u"264A", u"", 3698, 1, 15},
+    {u"\u264B", u"", u"264B", u"", 3699, 1, 15},
+    {u"\u264C", u"", u"264C", u"", 3700, 1, 15},
+    {u"\u264D", u"", u"264D", u"", 3701, 1, 15},
+    {u"\u264E", u"", u"264E", u"", 3702, 1, 15},
+    {u"\u264F", u"", u"264F", u"", 3703, 1, 15},
+    {u"\u2650", u"", u"2650", u"", 3704, 1, 15},
+    {u"\u2651", u"", u"2651", u"", 3705, 1, 15},
+    {u"\u2652", u"", u"2652", u"", 3706, 1, 15},
+    {u"\u2653", u"", u"2653", u"", 3707, 1, 15},
+    {u"\u265F\uFE0F", u"\u265F", u"265F-FE0F", u"265F", 3708, 1, 15},
+    {u"\u2660\uFE0F", u"\u2660", u"2660-FE0F", u"2660", 3709, 1, 15},
+    {u"\u2663\uFE0F", u"\u2663", u"2663-FE0F", u"2663", 3710, 1, 15},
+    {u"\u2665\uFE0F", u"\u2665", u"2665-FE0F", u"2665", 3711, 1, 15},
+    {u"\u2666\uFE0F", u"\u2666", u"2666-FE0F", u"2666", 3712, 1, 15},
+    {u"\u2668\uFE0F", u"\u2668", u"2668-FE0F", u"2668", 3713, 1, 15},
+    {u"\u267B\uFE0F", u"\u267B", u"267B-FE0F", u"267B", 3714, 1, 15},
+    {u"\u267E\uFE0F", u"\u267E", u"267E-FE0F", u"267E", 3715, 1, 15},
+    {u"\u267F", u"", u"267F", u"", 3716, 1, 15},
+    {u"\u2692\uFE0F", u"\u2692", u"2692-FE0F", u"2692", 3717, 1, 15},
+    {u"\u2693", u"", u"2693", u"", 3718, 1, 15},
+    {u"\u2694\uFE0F", u"\u2694", u"2694-FE0F", u"2694", 3719, 1, 15},
+    {u"\u2695\uFE0F", u"\u2695", u"2695-FE0F", u"2695", 3720, 2, 14},
+    {u"\u2696\uFE0F", u"\u2696", u"2696-FE0F", u"2696", 3722, 1, 15},
+    {u"\u2697\uFE0F", u"\u2697", u"2697-FE0F", u"2697", 3723, 1, 15},
+    {u"\u2699\uFE0F", u"\u2699", u"2699-FE0F", u"2699", 3724, 1, 15},
+    {u"\u269B\uFE0F", u"\u269B", u"269B-FE0F", u"269B", 3725, 1, 15},
+    {u"\u269C\uFE0F", u"\u269C", u"269C-FE0F", u"269C", 3726, 1, 15},
+    {u"\u26A0\uFE0F", u"\u26A0", u"26A0-FE0F", u"26A0", 3727, 1, 15},
+    {u"\u26A1", u"", u"26A1", u"", 3728, 1, 15},
+    {u"\u26A7\uFE0F", u"\u26A7", u"26A7-FE0F", u"26A7", 3729, 1, 15},
+    {u"\u26AA", u"", u"26AA", u"", 3730, 1, 15},
+    {u"\u26AB", u"", u"26AB", u"", 3731, 1, 15},
+    {u"\u26B0\uFE0F", u"\u26B0", u"26B0-FE0F", u"26B0", 3732, 1, 15},
+    {u"\u26B1\uFE0F", u"\u26B1", u"26B1-FE0F", u"26B1", 3733, 1, 15},
+    {u"\u26BD", u"", u"26BD", u"", 3734, 1, 15},
+    {u"\u26BE", u"", u"26BE", u"", 3735, 1, 15},
+    {u"\u26C4", u"", u"26C4", u"", 3736, 1, 15},
+    {u"\u26C5", u"", u"26C5", u"", 3737, 1, 15},
+    {u"\u26C8\uFE0F", u"\u26C8", u"26C8-FE0F", u"26C8", 3738, 1, 15},
+    {u"\u26CE", u"", u"26CE", u"", 3739, 1, 15},
+    {u"\u26CF\uFE0F", u"\u26CF", u"26CF-FE0F", u"26CF", 3740, 1, 15},
+    {u"\u26D1\uFE0F", u"\u26D1", u"26D1-FE0F", u"26D1", 3741, 1, 15},
+    {u"\u26D3\uFE0F\u200D\U0001F4A5", u"\u26D3\u200D\U0001F4A5", u"26D3-FE0F-200D-1F4A5", u"26D3-200D-1F4A5", 3742, 1, 7},
+    {u"\u26D3\uFE0F", u"\u26D3", u"26D3-FE0F", u"26D3", 3743, 1, 15},
+    {u"\u26D4", u"", u"26D4", u"", 3744, 1, 15},
+    {u"\u26E9\uFE0F", u"\u26E9", u"26E9-FE0F", u"26E9", 3745, 1, 15},
+    {u"\u26EA", u"", u"26EA", u"", 3746, 1, 15},
+    {u"\u26F0\uFE0F", u"\u26F0", u"26F0-FE0F", u"26F0", 3747, 1, 15},
+    {u"\u26F1\uFE0F", u"\u26F1", u"26F1-FE0F", u"26F1", 3748, 1, 15},
+    {u"\u26F2", u"", u"26F2", u"", 3749, 1, 15},
+    {u"\u26F3", u"", u"26F3", u"", 3750, 1, 15},
+    {u"\u26F4\uFE0F", u"\u26F4", u"26F4-FE0F", u"26F4", 3751, 1, 15},
+    {u"\u26F5", u"", u"26F5", u"", 3752, 2, 15},
+    {u"\u26F7\uFE0F", u"\u26F7", u"26F7-FE0F", u"26F7", 3754, 1, 15},
+    {u"\u26F8\uFE0F", u"\u26F8", u"26F8-FE0F", u"26F8", 3755, 1, 15},
+    {u"\u26F9\uFE0F\u200D\u2640\uFE0F", u"\u26F9\u200D\u2640", u"26F9-FE0F-200D-2640-FE0F", u"26F9-200D-2640", 3756, 1, 15},
+    {u"\u26F9\U0001F3FB\u200D\u2640\uFE0F", u"\u26F9\U0001F3FB\u200D\u2640", u"26F9-1F3FB-200D-2640-FE0F", u"26F9-1F3FB-200D-2640", 3757, 1, 15},
+    {u"\u26F9\U0001F3FC\u200D\u2640\uFE0F", u"\u26F9\U0001F3FC\u200D\u2640", u"26F9-1F3FC-200D-2640-FE0F", u"26F9-1F3FC-200D-2640", 3758, 1, 15},
+    {u"\u26F9\U0001F3FD\u200D\u2640\uFE0F", u"\u26F9\U0001F3FD\u200D\u2640", u"26F9-1F3FD-200D-2640-FE0F", u"26F9-1F3FD-200D-2640", 3759, 1, 15},
+    {u"\u26F9\U0001F3FE\u200D\u2640\uFE0F", u"\u26F9\U0001F3FE\u200D\u2640", u"26F9-1F3FE-200D-2640-FE0F", u"26F9-1F3FE-200D-2640", 3760, 1, 15},
+    {u"\u26F9\U0001F3FF\u200D\u2640\uFE0F", u"\u26F9\U0001F3FF\u200D\u2640", u"26F9-1F3FF-200D-2640-FE0F", u"26F9-1F3FF-200D-2640", 3761, 1, 15},
+    {u"\u26F9\uFE0F\u200D\u2642\uFE0F", u"\u26F9\u200D\u2642", u"26F9-FE0F-200D-2642-FE0F", u"26F9-200D-2642", 3762, 1, 15},
+    {u"\u26F9\U0001F3FB\u200D\u2642\uFE0F", u"\u26F9\U0001F3FB\u200D\u2642", u"26F9-1F3FB-200D-2642-FE0F", u"26F9-1F3FB-200D-2642", 3763, 1, 15},
+    {u"\u26F9\U0001F3FC\u200D\u2642\uFE0F", u"\u26F9\U0001F3FC\u200D\u2642", u"26F9-1F3FC-200D-2642-FE0F", u"26F9-1F3FC-200D-2642", 3764, 1, 15},
+    {u"\u26F9\U0001F3FD\u200D\u2642\uFE0F", u"\u26F9\U0001F3FD\u200D\u2642", u"26F9-1F3FD-200D-2642-FE0F", u"26F9-1F3FD-200D-2642", 3765, 1, 15},
+    {u"\u26F9\U0001F3FE\u200D\u2642\uFE0F", u"\u26F9\U0001F3FE\u200D\u2642", u"26F9-1F3FE-200D-2642-FE0F", u"26F9-1F3FE-200D-2642", 3766, 1, 15},
+    {u"\u26F9\U0001F3FF\u200D\u2642\uFE0F", u"\u26F9\U0001F3FF\u200D\u2642", u"26F9-1F3FF-200D-2642-FE0F", u"26F9-1F3FF-200D-2642", 3767, 1, 15},
+    {u"\u26F9\uFE0F", u"\u26F9", u"26F9-FE0F", u"26F9", 3768, 1, 15},
+    {u"\u26F9\U0001F3FB", u"", u"26F9-1F3FB", u"", 3769, 1, 15},
+    {u"\u26F9\U0001F3FC", u"", u"26F9-1F3FC", u"", 3770, 1, 15},
+    {u"\u26F9\U0001F3FD", u"", u"26F9-1F3FD", u"", 3771, 1, 15},
+    {u"\u26F9\U0001F3FE", u"", u"26F9-1F3FE", u"", 3772, 1, 15},
+    {u"\u26F9\U0001F3FF", u"", u"26F9-1F3FF", u"", 3773, 1, 15},
+    {u"\u26FA", u"", u"26FA", u"", 3774, 1, 15},
+    {u"\u26FD", u"", u"26FD", u"", 3775, 1, 15},
+    {u"\u2702\uFE0F", u"\u2702", u"2702-FE0F", u"2702", 3776, 1, 15},
+    {u"\u2705", u"", u"2705", u"", 3777, 1, 15},
+    {u"\u2708\uFE0F", u"\u2708", u"2708-FE0F", u"2708", 3778, 1, 15},
+    {u"\u2709\uFE0F", u"\u2709", u"2709-FE0F", u"2709", 3779, 2, 15},
+    {u"\u270A", u"", u"270A", u"", 3781, 1, 15},
+    {u"\u270A\U0001F3FB", u"", u"270A-1F3FB", u"", 3782, 1, 15},
+    {u"\u270A\U0001F3FC", u"", u"270A-1F3FC", u"", 3783, 1, 15},
+    {u"\u270A\U0001F3FD", u"", u"270A-1F3FD", u"", 3784, 1, 15},
+    {u"\u270A\U0001F3FE", u"", u"270A-1F3FE", u"", 3785, 1, 15},
+    {u"\u270A\U0001F3FF", u"", u"270A-1F3FF", u"", 3786, 1, 15},
+    {u"\u270B", u"", u"270B", u"", 3787, 2, 15},
+    {u"\u270B\U0001F3FB", u"", u"270B-1F3FB", u"", 3789, 1, 15},
+    {u"\u270B\U0001F3FC", u"", u"270B-1F3FC", u"", 3790, 1, 15},
+    {u"\u270B\U0001F3FD", u"", u"270B-1F3FD", u"", 3791, 1, 15},
+    {u"\u270B\U0001F3FE", u"", u"270B-1F3FE", u"", 3792, 1, 15},
+    {u"\u270B\U0001F3FF", u"", u"270B-1F3FF", u"", 3793, 1, 15},
+    {u"\u270C\uFE0F", u"\u270C", u"270C-FE0F", u"270C", 3794, 1, 15},
+    {u"\u270C\U0001F3FB", u"", u"270C-1F3FB", u"", 3795, 1, 15},
+    {u"\u270C\U0001F3FC", u"", u"270C-1F3FC", u"", 3796, 1, 15},
+    {u"\u270C\U0001F3FD", u"", u"270C-1F3FD", u"", 3797, 1, 15},
+    {u"\u270C\U0001F3FE", u"", u"270C-1F3FE", u"", 3798, 1, 15},
+    {u"\u270C\U0001F3FF", u"", u"270C-1F3FF", u"", 3799, 1, 15},
+    {u"\u270D\uFE0F", u"\u270D", u"270D-FE0F", u"270D", 3800, 1, 15},
+    {u"\u270D\U0001F3FB", u"", u"270D-1F3FB", u"", 3801, 1, 15},
+    {u"\u270D\U0001F3FC", u"", u"270D-1F3FC", u"", 3802, 1, 15},
+    {u"\u270D\U0001F3FD", u"", u"270D-1F3FD", u"", 3803, 1, 15},
+    {u"\u270D\U0001F3FE", u"", u"270D-1F3FE", u"", 3804, 1, 15},
+    {u"\u270D\U0001F3FF", u"", u"270D-1F3FF", u"", 3805, 1, 15},
+    {u"\u270F\uFE0F", u"\u270F", u"270F-FE0F", u"270F", 3806, 1, 15},
+    {u"\u2712\uFE0F", u"\u2712", u"2712-FE0F", u"2712", 3807, 1, 15},
+    {u"\u2714\uFE0F", u"\u2714", u"2714-FE0F", u"2714", 3808, 1, 15},
+    {u"\u2716\uFE0F", u"\u2716", u"2716-FE0F", u"2716", 3809, 1, 15},
+    {u"\u271D\uFE0F", u"\u271D", u"271D-FE0F", u"271D", 3810, 1, 15},
+    {u"\u2721\uFE0F", u"\u2721", u"2721-FE0F", u"2721", 3811, 1, 15},
+    {u"\u2728", u"", u"2728", u"", 3812, 1, 15},
+    {u"\u2733\uFE0F", u"\u2733", u"2733-FE0F", u"2733", 3813, 1, 15},
+    {u"\u2734\uFE0F", u"\u2734", u"2734-FE0F", u"2734", 3814, 1, 15},
+    {u"\u2744\uFE0F", u"\u2744", u"2744-FE0F", u"2744", 3815, 1, 15},
+    {u"\u2747\uFE0F", u"\u2747", u"2747-FE0F", u"2747", 3816, 1, 15},
+    {u"\u274C", u"", u"274C", u"", 3817, 1, 15},
+    {u"\u274E", u"", u"274E", u"", 3818, 1, 15},
+    {u"\u2753", u"", u"2753", u"", 3819, 1, 15},
+    {u"\u2754", u"", u"2754", u"", 3820, 1, 15},
+    {u"\u2755", u"", u"2755", u"", 3821, 1, 15},
+    {u"\u2757", u"", u"2757", u"", 3822, 2, 15},
+    {u"\u2763\uFE0F", u"\u2763", u"2763-FE0F", u"2763", 3824, 1, 15},
+    {u"\u2764\uFE0F\u200D\U0001F525", u"\u2764\u200D\U0001F525", u"2764-FE0F-200D-1F525", u"2764-200D-1F525", 3825, 1, 15},
+    {u"\u2764\uFE0F\u200D\U0001FA79", u"\u2764\u200D\U0001FA79", u"2764-FE0F-200D-1FA79", u"2764-200D-1FA79", 3826, 1, 15},
+    {u"\u2764\uFE0F", u"\u2764", u"2764-FE0F", u"2764", 3827, 1, 15},
+    {u"\u2795", u"", u"2795", u"", 3828, 1, 15},
+    {u"\u2796", u"", u"2796", u"", 3829, 1, 15},
+    {u"\u2797", u"", u"2797", u"", 3830, 1, 15},
+    {u"\u27A1\uFE0F", u"\u27A1", u"27A1-FE0F", u"27A1", 3831, 1, 15},
+    {u"\u27B0", u"", u"27B0", u"", 3832, 1, 15},
+    {u"\u27BF", u"", u"27BF", u"", 3833, 1, 15},
+    {u"\u2934\uFE0F", u"\u2934", u"2934-FE0F", u"2934", 3834, 1, 15},
+    {u"\u2935\uFE0F", u"\u2935", u"2935-FE0F", u"2935", 3835, 1, 15},
+    {u"\u2B05\uFE0F", u"\u2B05", u"2B05-FE0F", u"2B05", 3836, 1, 15},
+    {u"\u2B06\uFE0F", u"\u2B06", u"2B06-FE0F", u"2B06", 3837, 1, 15},
+    {u"\u2B07\uFE0F", u"\u2B07", u"2B07-FE0F", u"2B07", 3838, 1, 15},
+    {u"\u2B1B", u"", u"2B1B", u"", 3839, 1, 15},
+    {u"\u2B1C", u"", u"2B1C", u"", 3840, 1, 15},
+    {u"\u2B50", u"", u"2B50", u"", 3841, 1, 15},
+    {u"\u2B55", u"", u"2B55", u"", 3842, 1, 15},
+    {u"\u3030\uFE0F", u"\u3030", u"3030-FE0F", u"3030", 3843, 1, 15},
+    {u"\u303D\uFE0F", u"\u303D", u"303D-FE0F", u"303D", 3844, 1, 15},
+    {u"\u3297\uFE0F", u"\u3297", u"3297-FE0F", u"3297", 3845, 1, 15},
+    {u"\u3299\uFE0F", u"\u3299", u"3299-FE0F", u"3299", 3846, 1, 15},
+};
+const size_t ENTRY_COUNT = std::size(ENTRIES);
+
+const ShortCode SHORT_CODES[] = {
+    {u"hash", 0},
+    {u"keycap_star", 1},
+    {u"zero", 2},
+    {u"one", 3},
+    {u"two", 4},
+    {u"three", 5},
+    {u"four", 6},
+    {u"five", 7},
+    {u"six", 8},
+    {u"seven", 9},
+    {u"eight", 10},
+    {u"nine", 11},
+    {u"copyright", 12},
+    {u"registered", 13},
+    {u"mahjong", 14},
+    {u"black_joker", 15},
+    {u"a", 16},
+    {u"b", 17},
+    {u"o2", 18},
+    {u"parking", 19},
+    {u"ab", 20},
+    {u"cl", 21},
+    {u"cool", 22},
+    {u"free", 23},
+    {u"id", 24},
+    {u"new", 25},
+    {u"ng", 26},
+    {u"ok", 27},
+    {u"sos", 28},
+    {u"up", 29},
+    {u"vs", 30},
+    {u"flag-ac", 31},
+    {u"flag-ad", 32},
+    {u"flag-ae", 33},
+    {u"flag-af", 34},
+    {u"flag-ag", 35},
+    {u"flag-ai", 36},
+    {u"flag-al", 37},
+    {u"flag-am", 38},
+    {u"flag-ao", 39},
+    {u"flag-aq", 40},
+    {u"flag-ar", 41},
+    {u"flag-as", 42},
+    {u"flag-at", 43},
+    {u"flag-au", 44},
+    {u"flag-aw", 45},
+    {u"flag-ax", 46},
+    {u"flag-az", 47},
+    {u"flag-ba", 48},
+    {u"flag-bb", 49},
+    {u"flag-bd", 50},
+    {u"flag-be", 51},
+    {u"flag-bf", 52},
+    {u"flag-bg", 53},
+    {u"flag-bh", 54},
+    {u"flag-bi", 55},
+    {u"flag-bj", 56},
+    {u"flag-bl", 57},
+    {u"flag-bm", 58},
+    {u"flag-bn", 59},
+    {u"flag-bo", 60},
+    {u"flag-bq", 61},
+    {u"flag-br", 62},
+    {u"flag-bs", 63},
+    {u"flag-bt", 64},
+    {u"flag-bv", 65},
+    {u"flag-bw", 66},
+    {u"flag-by", 67},
+    {u"flag-bz", 68},
+    {u"flag-ca", 69},
+    {u"flag-cc", 70},
+    {u"flag-cd", 71},
+    {u"flag-cf", 72},
+    {u"flag-cg", 73},
+    {u"flag-ch", 74},
+    {u"flag-ci", 75},
+    {u"flag-ck", 76},
+    {u"flag-cl", 77},
+    {u"flag-cm", 78},
+    {u"cn", 79},
+    {u"flag-cn", 79},
+    {u"flag-co", 80},
+    {u"flag-cp", 81},
+    {u"flag-sark", 82},
+    {u"flag-cr", 83},
+    {u"flag-cu", 84},
+    {u"flag-cv", 85},
+    {u"flag-cw", 86},
+    {u"flag-cx", 87},
+    {u"flag-cy", 88},
+    {u"flag-cz", 89},
+    {u"de", 90},
+    {u"flag-de", 90},
+    {u"flag-dg", 91},
+    {u"flag-dj", 92},
+    {u"flag-dk", 93},
+    {u"flag-dm", 94},
+    {u"flag-do", 95},
+    {u"flag-dz", 96},
+    {u"flag-ea", 97},
+    {u"flag-ec", 98},
+    {u"flag-ee", 99},
+    {u"flag-eg", 100},
+    {u"flag-eh", 101},
+    {u"flag-er", 102},
+    {u"es", 103},
+    {u"flag-es", 103},
+    {u"flag-et", 104},
+    {u"flag-eu", 105},
+    {u"flag-fi", 106},
+    {u"flag-fj", 107},
+    {u"flag-fk", 108},
+    {u"flag-fm", 109},
+    {u"flag-fo", 110},
+    {u"fr", 111},
+    {u"flag-fr", 111},
+    {u"flag-ga", 112},
+    {u"gb", 113},
+    {u"uk", 113},
+    {u"flag-gb", 113},
+    {u"flag-gd", 114},
+    {u"flag-ge", 115},
+    {u"flag-gf", 116},
+    {u"flag-gg", 117},
+    {u"flag-gh", 118},
+    {u"flag-gi", 119},
+    {u"flag-gl", 120},
+    {u"flag-gm", 121},
+    {u"flag-gn", 122},
+    {u"flag-gp", 123},
+    {u"flag-gq", 124},
+    {u"flag-gr", 125},
+    {u"flag-gs", 126},
+    {u"flag-gt", 127},
+    {u"flag-gu", 128},
+    {u"flag-gw", 129},
+    {u"flag-gy", 130},
+    {u"flag-hk", 131},
+    {u"flag-hm", 132},
+    {u"flag-hn", 133},
+    {u"flag-hr", 134},
+    {u"flag-ht", 135},
+    {u"flag-hu", 136},
+    {u"flag-ic", 137},
+    {u"flag-id", 138},
+    {u"flag-ie", 139},
+    {u"flag-il", 140},
+    {u"flag-im", 141},
+    {u"flag-in", 142},
+    {u"flag-io", 143},
+    {u"flag-iq", 144},
+    {u"flag-ir", 145},
+    {u"flag-is", 146},
+    {u"it", 147},
+    {u"flag-it", 147},
+    {u"flag-je", 148},
+    {u"flag-jm", 149},
+    {u"flag-jo", 150},
+    {u"jp", 151},
+    {u"flag-jp", 151},
+    {u"flag-ke", 152},
+    {u"flag-kg", 153},
+    {u"flag-kh", 154},
+    {u"flag-ki", 155},
+    {u"flag-km", 156},
+    {u"flag-kn", 157},
+    {u"flag-kp", 158},
+    {u"kr", 159},
+    {u"flag-kr", 159},
+    {u"flag-kw", 160},
+    {u"flag-ky", 161},
+    {u"flag-kz", 162},
+    {u"flag-la", 163},
+    {u"flag-lb", 164},
+    {u"flag-lc", 165},
+    {u"flag-li", 166},
+    {u"flag-lk", 167},
+    {u"flag-lr", 168},
+    {u"flag-ls", 169},
+    {u"flag-lt", 170},
+    {u"flag-lu", 171},
+    {u"flag-lv", 172},
+    {u"flag-ly", 173},
+    {u"flag-ma", 174},
+    {u"flag-mc", 175},
+    {u"flag-md", 176},
+    {u"flag-me", 177},
+    {u"flag-mf", 178},
+    {u"flag-mg", 179},
+    {u"flag-mh", 180},
+    {u"flag-mk", 181},
+    {u"flag-ml", 182},
+    {u"flag-mm", 183},
+    {u"flag-mn", 184},
+    {u"flag-mo", 185},
+    {u"flag-mp", 186},
+    {u"flag-mq", 187},
+    {u"flag-mr", 188},
+    {u"flag-ms", 189},
+    {u"flag-mt", 190},
+    {u"flag-mu", 191},
+    {u"flag-mv", 192},
+    {u"flag-mw", 193},
+    {u"flag-mx", 194},
+    {u"flag-my", 195},
+    {u"flag-mz", 196},
+    {u"flag-na", 197},
+    {u"flag-nc", 198},
+    {u"flag-ne", 199},
+    {u"flag-nf", 200},
+    {u"flag-ng", 201},
+    {u"flag-ni", 202},
+    {u"flag-nl", 203},
+    {u"flag-no", 204},
+    {u"flag-np", 205},
+    {u"flag-nr", 206},
+    {u"flag-nu", 207},
+    {u"flag-nz", 208},
+    {u"flag-om", 209},
+    {u"flag-pa", 210},
+    {u"flag-pe", 211},
+    {u"flag-pf", 212},
+    {u"flag-pg", 213},
+    {u"flag-ph", 214},
+    {u"flag-pk", 215},
+    {u"flag-pl", 216},
+    {u"flag-pm", 217},
+    {u"flag-pn", 218},
+    {u"flag-pr", 219},
+    {u"flag-ps", 220},
+    {u"flag-pt", 221},
+    {u"flag-pw", 222},
+    {u"flag-py", 223},
+    {u"flag-qa", 224},
+    {u"flag-re", 225},
+    {u"flag-ro", 226},
+    {u"flag-rs", 227},
+    {u"ru", 228},
+    {u"flag-ru", 228},
+    {u"flag-rw", 229},
+    {u"flag-sa", 230},
+    {u"flag-sb", 231},
+    {u"flag-sc", 232},
+    {u"flag-sd", 233},
+    {u"flag-se", 234},
+    {u"flag-sg", 235},
+    {u"flag-sh", 236},
+    {u"flag-si", 237},
+    {u"flag-sj", 238},
+    {u"flag-sk", 239},
+    {u"flag-sl", 240},
+    {u"flag-sm", 241},
+    {u"flag-sn", 242},
+    {u"flag-so", 243},
+    {u"flag-sr", 244},
+    {u"flag-ss", 245},
+    {u"flag-st", 246},
+    {u"flag-sv", 247},
+    {u"flag-sx", 248},
+    {u"flag-sy", 249},
+    {u"flag-sz", 250},
+    {u"flag-ta", 251},
+    {u"flag-tc", 252},
+    {u"flag-td", 253},
+    {u"flag-tf", 254},
+    {u"flag-tg", 255},
+    {u"flag-th", 256},
+    {u"flag-tj", 257},
+    {u"flag-tk", 258},
+    {u"flag-tl", 259},
+    {u"flag-tm", 260},
+    {u"flag-tn", 261},
+    {u"flag-to", 262},
+    {u"flag-tr", 263},
+    {u"flag-tt", 264},
+    {u"flag-tv", 265},
+    {u"flag-tw", 266},
+    {u"flag-tz", 267},
+    {u"flag-ua", 268},
+    {u"flag-ug", 269},
+    {u"flag-um", 270},
+    {u"flag-un", 271},
+    {u"us", 272},
+    {u"flag-us", 272},
+    {u"flag-uy", 273},
+    {u"flag-uz", 274},
+    {u"flag-va", 275},
+    {u"flag-vc", 276},
+    {u"flag-ve", 277},
+    {u"flag-vg", 278},
+    {u"flag-vi", 279},
+    {u"flag-vn", 280},
+    {u"flag-vu", 281},
+    {u"flag-wf", 282},
+    {u"flag-ws", 283},
+    {u"flag-xk", 284},
+    {u"flag-ye", 285},
+    {u"flag-yt", 286},
+    {u"flag-za", 287},
+    {u"flag-zm", 288},
+    {u"flag-zw", 289},
+    {u"koko", 290},
+    {u"sa", 291},
+    {u"u7121", 292},
+    {u"u6307", 293},
+    {u"u7981", 294},
+    {u"u7a7a", 295},
+    {u"u5408", 296},
+    {u"u6e80", 297},
+    {u"u6709", 298},
+    {u"u6708", 299},
+    {u"u7533", 300},
+    {u"u5272", 301},
+    {u"u55b6", 302},
+    {u"ideograph_advantage", 303},
+    {u"accept", 304},
+    {u"cyclone", 305},
+    {u"foggy", 306},
+    {u"closed_umbrella", 307},
+    {u"night_with_stars", 308},
+    {u"sunrise_over_mountains", 309},
+    {u"sunrise", 310},
+    {u"city_sunset", 311},
+    {u"city_sunrise", 312},
+    {u"rainbow", 313},
+    {u"bridge_at_night", 314},
+    {u"ocean", 315},
+    {u"volcano", 316},
+    {u"milky_way", 317},
+    {u"earth_africa", 318},
+    {u"earth_americas", 319},
+    {u"earth_asia", 320},
+    {u"globe_with_meridians", 321},
+    {u"new_moon", 322},
+    {u"waxing_crescent_moon", 323},
+    {u"first_quarter_moon", 324},
+    {u"moon", 325},
+    {u"waxing_gibbous_moon", 325},
+    {u"full_moon", 326},
+    {u"waning_gibbous_moon", 327},
+    {u"last_quarter_moon", 328},
+    {u"waning_crescent_moon", 329},
+    {u"crescent_moon", 330},
+    {u"new_moon_with_face", 331},
+    {u"first_quarter_moon_with_face", 332},
+    {u"last_quarter_moon_with_face", 333},
+    {u"full_moon_with_face", 334},
+    {u"sun_with_face", 335},
+    {u"star2", 336},
+    {u"stars", 337},
+    {u"thermometer", 338},
+    {u"mostly_sunny", 339},
+    {u"sun_small_cloud", 339},
+    {u"barely_sunny", 340},
+    {u"sun_behind_cloud", 340},
+    {u"partly_sunny_rain", 341},
+    {u"sun_behind_rain_cloud", 341},
+    {u"rain_cloud", 342},
+    {u"snow_cloud", 343},
+    {u"lightning", 344},
+    {u"lightning_cloud", 344},
+    {u"tornado", 345},
+    {u"tornado_cloud", 345},
+    {u"fog", 346},
+    {u"wind_blowing_face", 347},
+    {u"hotdog", 348},
+    {u"taco", 349},
+    {u"burrito", 350},
+    {u"chestnut", 351},
+    {u"seedling", 352},
+    {u"evergreen_tree", 353},
+    {u"deciduous_tree", 354},
+    {u"palm_tree", 355},
+    {u"cactus", 356},
+    {u"hot_pepper", 357},
+    {u"tulip", 358},
+    {u"cherry_blossom", 359},
+    {u"rose", 360},
+    {u"hibiscus", 361},
+    {u"sunflower", 362},
+    {u"blossom", 363},
+    {u"corn", 364},
+    {u"ear_of_rice", 365},
+    {u"herb", 366},
+    {u"four_leaf_clover", 367},
+    {u"maple_leaf", 368},
+    {u"fallen_leaf", 369},
+    {u"leaves", 370},
+    {u"brown_mushroom", 371},
+    {u"mushroom", 372},
+    {u"tomato", 373},
+    {u"eggplant", 374},
+    {u"grapes", 375},
+    {u"melon", 376},
+    {u"watermelon", 377},
+    {u"tangerine", 378},
+    {u"lime", 379},
+    {u"lemon", 380},
+    {u"banana", 381},
+    {u"pineapple", 382},
+    {u"apple", 383},
+    {u"green_apple", 384},
+    {u"pear", 385},
+    {u"peach", 386},
+    {u"cherries", 387},
+    {u"strawberry", 388},
+    {u"hamburger", 389},
+    {u"pizza", 390},
+    {u"meat_on_bone", 391},
+    {u"poultry_leg", 392},
+    {u"rice_cracker", 393},
+    {u"rice_ball", 394},
+    {u"rice", 395},
+    {u"curry", 396},
+    {u"ramen", 397},
+    {u"spaghetti", 398},
+    {u"bread", 399},
+    {u"fries", 400},
+    {u"sweet_potato", 401},
+    {u"dango", 402},
+    {u"oden", 403},
+    {u"sushi", 404},
+    {u"fried_shrimp", 405},
+    {u"fish_cake", 406},
+    {u"icecream", 407},
+    {u"shaved_ice", 408},
+    {u"ice_cream", 409},
+    {u"doughnut", 410},
+    {u"cookie", 411},
+    {u"chocolate_bar", 412},
+    {u"candy", 413},
+    {u"lollipop", 414},
+    {u"custard", 415},
+    {u"honey_pot", 416},
+    {u"cake", 417},
+    {u"bento", 418},
+    {u"stew", 419},
+    {u"fried_egg", 420},
+    {u"cooking", 420},
+    {u"fork_and_knife", 421},
+    {u"tea", 422},
+    {u"sake", 423},
+    {u"wine_glass", 424},
+    {u"cocktail", 425},
+    {u"tropical_drink", 426},
+    {u"beer", 427},
+    {u"beers", 428},
+    {u"baby_bottle", 429},
+    {u"knife_fork_plate", 430},
+    {u"champagne", 431},
+    {u"popcorn", 432},
+    {u"ribbon", 433},
+    {u"gift", 434},
+    {u"birthday", 435},
+    {u"jack_o_lantern", 436},
+    {u"christmas_tree", 437},
+    {u"santa", 438},
+    {u"santa_tone1", 439},
+    {u"santa_tone2", 440},
+    {u"santa_tone3", 441},
+    {u"santa_tone4", 442},
+    {u"santa_tone5", 443},
+    {u"fireworks", 444},
+    {u"sparkler", 445},
+    {u"balloon", 446},
+    {u"tada", 447},
+    {u"confetti_ball", 448},
+    {u"tanabata_tree", 449},
+    {u"crossed_flags", 450},
+    {u"bamboo", 451},
+    {u"dolls", 452},
+    {u"flags", 453},
+    {u"wind_chime", 454},
+    {u"rice_scene", 455},
+    {u"school_satchel", 456},
+    {u"mortar_board", 457},
+    {u"medal", 458},
+    {u"reminder_ribbon", 459},
+    {u"studio_microphone", 460},
+    {u"level_slider", 461},
+    {u"control_knobs", 462},
+    {u"film_frames", 463},
+    {u"admission_tickets", 464},
+    {u"carousel_horse", 465},
+    {u"ferris_wheel", 466},
+    {u"roller_coaster", 467},
+    {u"fishing_pole_and_fish", 468},
+    {u"microphone", 469},
+    {u"movie_camera", 470},
+    {u"cinema", 471},
+    {u"headphones", 472},
+    {u"art", 473},
+    {u"tophat", 474},
+    {u"circus_tent", 475},
+    {u"ticket", 476},
+    {u"clapper", 477},
+    {u"performing_arts", 478},
+    {u"video_game", 479},
+    {u"dart", 480},
+    {u"slot_machine", 481},
+    {u"8ball", 482},
+    {u"game_die", 483},
+    {u"bowling", 484},
+    {u"flower_playing_cards", 485},
+    {u"musical_note", 486},
+    {u"notes", 487},
+    {u"saxophone", 488},
+    {u"guitar", 489},
+    {u"musical_keyboard", 490},
+    {u"trumpet", 491},
+    {u"violin", 492},
+    {u"musical_score", 493},
+    {u"running_shirt_with_sash", 494},
+    {u"tennis", 495},
+    {u"ski", 496},
+    {u"basketball", 497},
+    {u"checkered_flag", 498},
+    {u"snowboarder", 499},
+    {u"snowboarder_tone1", 500},
+    {u"snowboarder_tone2", 501},
+    {u"snowboarder_tone3", 502},
+    {u"snowboarder_tone4", 503},
+    {u"snowboarder_tone5", 504},
+    {u"woman-running", 505},
+    {u"woman-running_tone1", 506},
+    {u"woman-running_tone2", 507},
+    {u"woman-running_tone3", 508},
+    {u"woman-running_tone4", 509},
+    {u"woman-running_tone5", 510},
+    {u"woman_running_facing_right", 511},
+    {u"woman_running_facing_right_tone1", 512},
+    {u"woman_running_facing_right_tone2", 513},
+    {u"woman_running_facing_right_tone3", 514},
+    {u"woman_running_facing_right_tone4", 515},
+    {u"woman_running_facing_right_tone5", 516},
+    {u"man-running", 517},
+    {u"man-running_tone1", 518},
+    {u"man-running_tone2", 519},
+    {u"man-running_tone3", 520},
+    {u"man-running_tone4", 521},
+    {u"man-running_tone5", 522},
+    {u"man_running_facing_right", 523},
+    {u"man_running_facing_right_tone1", 524},
+    {u"man_running_facing_right_tone2", 525},
+    {u"man_running_facing_right_tone3", 526},
+    {u"man_running_facing_right_tone4", 527},
+    {u"man_running_facing_right_tone5", 528},
+    {u"person_running_facing_right", 529},
+    {u"person_running_facing_right_tone1", 530},
+    {u"person_running_facing_right_tone2", 531},
+    {u"person_running_facing_right_tone3", 532},
+    {u"person_running_facing_right_tone4", 533},
+    {u"person_running_facing_right_tone5", 534},
+    {u"runner", 535},
+    {u"running", 535},
+    {u"runner_tone1", 536},
+    {u"runner_tone2", 537},
+    {u"runner_tone3", 538},
+    {u"runner_tone4", 539},
+    {u"runner_tone5", 540},
+    {u"woman-surfing", 541},
+    {u"woman-surfing_tone1", 542},
+    {u"woman-surfing_tone2", 543},
+    {u"woman-surfing_tone3", 544},
+    {u"woman-surfing_tone4", 545},
+    {u"woman-surfing_tone5", 546},
+    {u"man-surfing", 547},
+    {u"man-surfing_tone1", 548},
+    {u"man-surfing_tone2", 549},
+    {u"man-surfing_tone3", 550},
+    {u"man-surfing_tone4", 551},
+    {u"man-surfing_tone5", 552},
+    {u"surfer", 553},
+    {u"surfer_tone1", 554},
+    {u"surfer_tone2", 555},
+    {u"surfer_tone3", 556},
+    {u"surfer_tone4", 557},
+    {u"surfer_tone5", 558},
+    {u"sports_medal", 559},
+    {u"trophy", 560},
+    {u"horse_racing", 561},
+    {u"horse_racing_tone1", 562},
+    {u"horse_racing_tone2", 563},
+    {u"horse_racing_tone3", 564},
+    {u"horse_racing_tone4", 565},
+    {u"horse_racing_tone5", 566},
+    {u"football", 567},
+    {u"rugby_football", 568},
+    {u"woman-swimming", 569},
+    {u"woman-swimming_tone1", 570},
+    {u"woman-swimming_tone2", 571},
+    {u"woman-swimming_tone3", 572},
+    {u"woman-swimming_tone4", 573},
+    {u"woman-swimming_tone5", 574},
+    {u"man-swimming", 575},
+    {u"man-swimming_tone1", 576},
+    {u"man-swimming_tone2", 577},
+    {u"man-swimming_tone3", 578},
+    {u"man-swimming_tone4", 579},
+    {u"man-swimming_tone5", 580},
+    {u"swimmer", 581},
+    {u"swimmer_tone1", 582},
+    {u"swimmer_tone2", 583},
+    {u"swimmer_tone3", 584},
+    {u"swimmer_tone4", 585},
+    {u"swimmer_tone5", 586},
+    {u"woman-lifting-weights", 587},
+    {u"woman-lifting-weights_tone1", 588},
+    {u"woman-lifting-weights_tone2", 589},
+    {u"woman-lifting-weights_tone3", 590},
+    {u"woman-lifting-weights_tone4", 591},
+    {u"woman-lifting-weights_tone5", 592},
+    {u"man-lifting-weights", 593},
+    {u"man-lifting-weights_tone1", 594},
+    {u"man-lifting-weights_tone2", 595},
+    {u"man-lifting-weights_tone3", 596},
+    {u"man-lifting-weights_tone4", 597},
+    {u"man-lifting-weights_tone5", 598},
+    {u"weight_lifter", 599},
+    {u"weight_lifter_tone1", 600},
+    {u"weight_lifter_tone2", 601},
+    {u"weight_lifter_tone3", 602},
+    {u"weight_lifter_tone4", 603},
+    {u"weight_lifter_tone5", 604},
+    {u"woman-golfing", 605},
+    {u"woman-golfing_tone1", 606},
+    {u"woman-golfing_tone2", 607},
+    {u"woman-golfing_tone3", 608},
+    {u"woman-golfing_tone4", 609},
+    {u"woman-golfing_tone5", 610},
+    {u"man-golfing", 611},
+    {u"man-golfing_tone1", 612},
+    {u"man-golfing_tone2", 613},
+    {u"man-golfing_tone3", 614},
+    {u"man-golfing_tone4", 615},
+    {u"man-golfing_tone5", 616},
+    {u"golfer", 617},
+    {u"golfer_tone1", 618},
+    {u"golfer_tone2", 619},
+    {u"golfer_tone3", 620},
+    {u"golfer_tone4", 621},
+    {u"golfer_tone5", 622},
+    {u"racing_motorcycle", 623},
+    {u"racing_car", 624},
+    {u"cricket_bat_and_ball", 625},
+    {u"volleyball", 626},
+    {u"field_hockey_stick_and_ball", 627},
+    {u"ice_hockey_stick_and_puck", 628},
+    {u"table_tennis_paddle_and_ball", 629},
+    {u"snow_capped_mountain", 630},
+    {u"camping", 631},
+    {u"beach_with_umbrella", 632},
+    {u"building_construction", 633},
+    {u"house_buildings", 634},
+    {u"cityscape", 635},
+    {u"derelict_house_building", 636},
+    {u"classical_building", 637},
+    {u"desert", 638},
+    {u"desert_island", 639},
+    {u"national_park", 640},
+    {u"stadium", 641},
+    {u"house", 642},
+    {u"house_with_garden", 643},
+    {u"office", 644},
+    {u"post_office", 645},
+    {u"european_post_office", 646},
+    {u"hospital", 647},
+    {u"bank", 648},
+    {u"atm", 649},
+    {u"hotel", 650},
+    {u"love_hotel", 651},
+    {u"convenience_store", 652},
+    {u"school", 653},
+    {u"department_store", 654},
+    {u"factory", 655},
+    {u"izakaya_lantern", 656},
+    {u"lantern", 656},
+    {u"japanese_castle", 657},
+    {u"european_castle", 658},
+    {u"rainbow-flag", 659},
+    {u"transgender_flag", 660},
+    {u"waving_white_flag", 661},
+    {u"pirate_flag", 662},
+    {u"flag-england", 663},
+    {u"flag-scotland", 664},
+    {u"flag-wales", 665},
+    {u"waving_black_flag", 666},
+    {u"rosette", 667},
+    {u"label", 668},
+    {u"badminton_racquet_and_shuttlecock", 669},
+    {u"bow_and_arrow", 670},
+    {u"amphora", 671},
+    {u"skin-tone-2", 672},
+    {u"skin-tone-3", 673},
+    {u"skin-tone-4", 674},
+    {u"skin-tone-5", 675},
+    {u"skin-tone-6", 676},
+    {u"rat", 677},
+    {u"mouse2", 678},
+    {u"ox", 679},
+    {u"water_buffalo", 680},
+    {u"cow2", 681},
+    {u"tiger2", 682},
+    {u"leopard", 683},
+    {u"rabbit2", 684},
+    {u"black_cat", 685},
+    {u"cat2", 686},
+    {u"dragon", 687},
+    {u"crocodile", 688},
+    {u"whale2", 689},
+    {u"snail", 690},
+    {u"snake", 691},
+    {u"racehorse", 692},
+    {u"ram", 693},
+    {u"goat", 694},
+    {u"sheep", 695},
+    {u"monkey", 696},
+    {u"rooster", 697},
+    {u"chicken", 698},
+    {u"service_dog", 699},
+    {u"dog2", 700},
+    {u"pig2", 701},
+    {u"boar", 702},
+    {u"elephant", 703},
+    {u"octopus", 704},
+    {u"shell", 705},
+    {u"bug", 706},
+    {u"ant", 707},
+    {u"bee", 708},
+    {u"honeybee", 708},
+    {u"ladybug", 709},
+    {u"lady_beetle", 709},
+    {u"fish", 710},
+    {u"tropical_fish", 711},
+    {u"blowfish", 712},
+    {u"turtle", 713},
+    {u"hatching_chick", 714},
+    {u"baby_chick", 715},
+    {u"hatched_chick", 716},
+    {u"phoenix", 717},
+    {u"black_bird", 718},
+    {u"bird", 719},
+    {u"penguin", 720},
+    {u"koala", 721},
+    {u"poodle", 722},
+    {u"dromedary_camel", 723},
+    {u"camel", 724},
+    {u"dolphin", 725},
+    {u"flipper", 725},
+    {u"mouse", 726},
+    {u"cow", 727},
+    {u"tiger", 728},
+    {u"rabbit", 729},
+    {u"cat", 730},
+    {u"dragon_face", 731},
+    {u"whale", 732},
+    {u"horse", 733},
+    {u"monkey_face", 734},
+    {u"dog", 735},
+    {u"pig", 736},
+    {u"frog", 737},
+    {u"hamster", 738},
+    {u"wolf", 739},
+    {u"polar_bear", 740},
+    {u"bear", 741},
+    {u"panda_face", 742},
+    {u"pig_nose", 743},
+    {u"feet", 744},
+    {u"paw_prints", 744},
+    {u"chipmunk", 745},
+    {u"eyes", 746},
+    {u"eye-in-speech-bubble", 747},
+    {u"eye", 748},
+    {u"ear", 749},
+    {u"ear_tone1", 750},
+    {u"ear_tone2", 751},
+    {u"ear_tone3", 752},
+    {u"ear_tone4", 753},
+    {u"ear_tone5", 754},
+    {u"nose", 755},
+    {u"nose_tone1", 756},
+    {u"nose_tone2", 757},
+    {u"nose_tone3", 758},
+    {u"nose_tone4", 759},
+    {u"nose_tone5", 760},
+    {u"lips", 761},
+    {u"tongue", 762},
+    {u"point_up_2", 763},
+    {u"point_up_2_tone1", 764},
+    {u"point_up_2_tone2", 765},
+    {u"point_up_2_tone3", 766},
+    {u"point_up_2_tone4", 767},
+    {u"point_up_2_tone5", 768},
+    {u"point_down", 769},
+    {u"point_down_tone1", 770},
+    {u"point_down_tone2", 771},
+    {u"point_down_tone3", 772},
+    {u"point_down_tone4", 773},
+    {u"point_down_tone5", 774},
+    {u"point_left", 775},
+    {u"point_left_tone1", 776},
+    {u"point_left_tone2", 777},
+    {u"point_left_tone3", 778},
+    {u"point_left_tone4", 779},
+    {u"point_left_tone5", 780},
+    {u"point_right", 781},
+    {u"point_right_tone1", 782},
+    {u"point_right_tone2", 783},
+    {u"point_right_tone3", 784},
+    {u"point_right_tone4", 785},
+    {u"point_right_tone5", 786},
+    {u"facepunch", 787},
+    {u"punch", 787},
+    {u"facepunch_tone1", 788},
+    {u"facepunch_tone2", 789},
+    {u"facepunch_tone3", 790},
+    {u"facepunch_tone4", 791},
+    {u"facepunch_tone5", 792},
+    {u"wave", 793},
+    {u"wave_tone1", 794},
+    {u"wave_tone2", 795},
+    {u"wave_tone3", 796},
+    {u"wave_tone4", 797},
+    {u"wave_tone5", 798},
+    {u"ok_hand", 799},
+    {u"ok_hand_tone1", 800},
+    {u"ok_hand_tone2", 801},
+    {u"ok_hand_tone3", 802},
+    {u"ok_hand_tone4", 803},
+    {u"ok_hand_tone5", 804},
+    {u"+1", 805},
+    {u"thumbsup", 805},
+    {u"+1_tone1", 806},
+    {u"+1_tone2", 807},
+    {u"+1_tone3", 808},
+    {u"+1_tone4", 809},
+    {u"+1_tone5", 810},
+    {u"-1", 811},
+    {u"thumbsdown", 811},
+    {u"-1_tone1", 812},
+    {u"-1_tone2", 813},
+    {u"-1_tone3", 814},
+    {u"-1_tone4", 815},
+    {u"-1_tone5", 816},
+    {u"clap", 817},
+    {u"clap_tone1", 818},
+    {u"clap_tone2", 819},
+    {u"clap_tone3", 820},
+    {u"clap_tone4", 821},
+    {u"clap_tone5", 822},
+    {u"open_hands", 823},
+    {u"open_hands_tone1", 824},
+    {u"open_hands_tone2", 825},
+    {u"open_hands_tone3", 826},
+    {u"open_hands_tone4", 827},
+    {u"open_hands_tone5", 828},
+    {u"crown", 829},
+    {u"womans_hat", 830},
+    {u"eyeglasses", 831},
+    {u"necktie", 832},
+    {u"shirt", 833},
+    {u"tshirt", 833},
+    {u"jeans", 834},
+    {u"dress", 835},
+    {u"kimono", 836},
+    {u"bikini", 837},
+    {u"womans_clothes", 838},
+    {u"purse", 839},
+    {u"handbag", 840},
+    {u"pouch", 841},
+    {u"mans_shoe", 842},
+    {u"shoe", 842},
+    {u"athletic_shoe", 843},
+    {u"high_heel", 844},
+    {u"sandal", 845},
+    {u"boot", 846},
+    {u"footprints", 847},
+    {u"bust_in_silhouette", 848},
+    {u"busts_in_silhouette", 849},
+    {u"boy", 850},
+    {u"boy_tone1", 851},
+    {u"boy_tone2", 852},
+    {u"boy_tone3", 853},
+    {u"boy_tone4", 854},
+    {u"boy_tone5", 855},
+    {u"girl", 856},
+    {u"girl_tone1", 857},
+    {u"girl_tone2", 858},
+    {u"girl_tone3", 859},
+    {u"girl_tone4", 860},
+    {u"girl_tone5", 861},
+    {u"male-farmer", 862},
+    {u"male-farmer_tone1", 863},
+    {u"male-farmer_tone2", 864},
+    {u"male-farmer_tone3", 865},
+    {u"male-farmer_tone4", 866},
+    {u"male-farmer_tone5", 867},
+    {u"male-cook", 868},
+    {u"male-cook_tone1", 869},
+    {u"male-cook_tone2", 870},
+    {u"male-cook_tone3", 871},
+    {u"male-cook_tone4", 872},
+    {u"male-cook_tone5", 873},
+    {u"man_feeding_baby", 874},
+    {u"man_feeding_baby_tone1", 875},
+    {u"man_feeding_baby_tone2", 876},
+    {u"man_feeding_baby_tone3", 877},
+    {u"man_feeding_baby_tone4", 878},
+    {u"man_feeding_baby_tone5", 879},
+    {u"male-student", 880},
+    {u"male-student_tone1", 881},
+    {u"male-student_tone2", 882},
+    {u"male-student_tone3", 883},
+    {u"male-student_tone4", 884},
+    {u"male-student_tone5", 885},
+    {u"male-singer", 886},
+    {u"male-singer_tone1", 887},
+    {u"male-singer_tone2", 888},
+    {u"male-singer_tone3", 889},
+    {u"male-singer_tone4", 890},
+    {u"male-singer_tone5", 891},
+    {u"male-artist", 892},
+    {u"male-artist_tone1", 893},
+    {u"male-artist_tone2", 894},
+    {u"male-artist_tone3", 895},
+    {u"male-artist_tone4", 896},
+    {u"male-artist_tone5", 897},
+    {u"male-teacher", 898},
+    {u"male-teacher_tone1", 899},
+    {u"male-teacher_tone2", 900},
+    {u"male-teacher_tone3", 901},
+    {u"male-teacher_tone4", 902},
+    {u"male-teacher_tone5", 903},
+    {u"male-factory-worker", 904},
+    {u"male-factory-worker_tone1", 905},
+    {u"male-factory-worker_tone2", 906},
+    {u"male-factory-worker_tone3", 907},
+    {u"male-factory-worker_tone4", 908},
+    {u"male-factory-worker_tone5", 909},
+    {u"man-boy-boy", 910},
+    {u"man-boy", 911},
+    {u"man-girl-boy", 912},
+    {u"man-girl-girl", 913},
+    {u"man-girl", 914},
+    {u"man-man-boy", 915},
+    {u"man-man-boy-boy", 916},
+    {u"man-man-girl", 917},
+    {u"man-man-girl-boy", 918},
+    {u"man-man-girl-girl", 919},
+    {u"man-woman-boy", 920},
+    {u"man-woman-boy-boy", 921},
+    {u"man-woman-girl", 922},
+    {u"man-woman-girl-boy", 923},
+    {u"man-woman-girl-girl", 924},
+    {u"male-technologist", 925},
+    {u"male-technologist_tone1", 926},
+    {u"male-technologist_tone2", 927},
+    {u"male-technologist_tone3", 928},
+    {u"male-technologist_tone4", 929},
+    {u"male-technologist_tone5", 930},
+    {u"male-office-worker", 931},
+    {u"male-office-worker_tone1", 932},
+    {u"male-office-worker_tone2", 933},
+    {u"male-office-worker_tone3", 934},
+    {u"male-office-worker_tone4", 935},
+    {u"male-office-worker_tone5", 936},
+    {u"male-mechanic", 937},
+    {u"male-mechanic_tone1", 938},
+    {u"male-mechanic_tone2", 939},
+    {u"male-mechanic_tone3", 940},
+    {u"male-mechanic_tone4", 941},
+    {u"male-mechanic_tone5", 942},
+    {u"male-scientist", 943},
+    {u"male-scientist_tone1", 944},
+    {u"male-scientist_tone2", 945},
+    {u"male-scientist_tone3", 946},
+    {u"male-scientist_tone4", 947},
+    {u"male-scientist_tone5", 948},
+    {u"male-astronaut", 949},
+    {u"male-astronaut_tone1", 950},
+    {u"male-astronaut_tone2", 951},
+    {u"male-astronaut_tone3", 952},
+    {u"male-astronaut_tone4", 953},
+    {u"male-astronaut_tone5", 954},
+    {u"male-firefighter", 955},
+    {u"male-firefighter_tone1", 956},
+    {u"male-firefighter_tone2", 957},
+    {u"male-firefighter_tone3", 958},
+    {u"male-firefighter_tone4", 959},
+    {u"male-firefighter_tone5", 960},
+    {u"man_with_white_cane_facing_right", 961},
+    {u"man_with_white_cane_facing_right_tone1", 962},
+    {u"man_with_white_cane_facing_right_tone2", 963},
+    {u"man_with_white_cane_facing_right_tone3", 964},
+    {u"man_with_white_cane_facing_right_tone4", 965},
+    {u"man_with_white_cane_facing_right_tone5", 966},
+    {u"man_with_probing_cane", 967},
+    {u"man_with_probing_cane_tone1", 968},
+    {u"man_with_probing_cane_tone2", 969},
+    {u"man_with_probing_cane_tone3", 970},
+    {u"man_with_probing_cane_tone4", 971},
+    {u"man_with_probing_cane_tone5", 972},
+    {u"red_haired_man", 973},
+    {u"red_haired_man_tone1", 974},
+    {u"red_haired_man_tone2", 975},
+    {u"red_haired_man_tone3", 976},
+    {u"red_haired_man_tone4", 977},
+    {u"red_haired_man_tone5", 978},
+    {u"curly_haired_man", 979},
+    {u"curly_haired_man_tone1", 980},
+    {u"curly_haired_man_tone2", 981},
+    {u"curly_haired_man_tone3", 982},
+    {u"curly_haired_man_tone4", 983},
+    {u"curly_haired_man_tone5", 984},
+    {u"bald_man", 985},
+    {u"bald_man_tone1", 986},
+    {u"bald_man_tone2", 987},
+    {u"bald_man_tone3", 988},
+    {u"bald_man_tone4", 989},
+    {u"bald_man_tone5", 990},
+    {u"white_haired_man", 991},
+    {u"white_haired_man_tone1", 992},
+    {u"white_haired_man_tone2", 993},
+    {u"white_haired_man_tone3", 994},
+    {u"white_haired_man_tone4", 995},
+    {u"white_haired_man_tone5", 996},
+    {u"man_in_motorized_wheelchair_facing_right", 997},
+    {u"man_in_motorized_wheelchair_facing_right_tone1", 998},
+    {u"man_in_motorized_wheelchair_facing_right_tone2", 999},
+    {u"man_in_motorized_wheelchair_facing_right_tone3", 1000},
+    {u"man_in_motorized_wheelchair_facing_right_tone4", 1001},
+    {u"man_in_motorized_wheelchair_facing_right_tone5", 1002},
+    {u"man_in_motorized_wheelchair", 1003},
+    {u"man_in_motorized_wheelchair_tone1", 1004},
+    {u"man_in_motorized_wheelchair_tone2", 1005},
+    {u"man_in_motorized_wheelchair_tone3", 1006},
+    {u"man_in_motorized_wheelchair_tone4", 1007},
+    {u"man_in_motorized_wheelchair_tone5", 1008},
+    {u"man_in_manual_wheelchair_facing_right", 1009},
+    {u"man_in_manual_wheelchair_facing_right_tone1", 1010},
+    {u"man_in_manual_wheelchair_facing_right_tone2", 1011},
+    {u"man_in_manual_wheelchair_facing_right_tone3", 1012},
+    {u"man_in_manual_wheelchair_facing_right_tone4", 1013},
+    {u"man_in_manual_wheelchair_facing_right_tone5", 1014},
+    {u"man_in_manual_wheelchair", 1015},
+    {u"man_in_manual_wheelchair_tone1", 1016},
+    {u"man_in_manual_wheelchair_tone2", 1017},
+    {u"man_in_manual_wheelchair_tone3", 1018},
+    {u"man_in_manual_wheelchair_tone4", 1019},
+    {u"man_in_manual_wheelchair_tone5", 1020},
+    {u"male-doctor", 1021},
+    {u"male-doctor_tone1", 1022},
+    {u"male-doctor_tone2", 1023},
+    {u"male-doctor_tone3", 1024},
+    {u"male-doctor_tone4", 1025},
+    {u"male-doctor_tone5", 1026},
+    {u"male-judge", 1027},
+    {u"male-judge_tone1", 1028},
+    {u"male-judge_tone2", 1029},
+    {u"male-judge_tone3", 1030},
+    {u"male-judge_tone4", 1031},
+    {u"male-judge_tone5", 1032},
+    {u"male-pilot", 1033},
+    {u"male-pilot_tone1", 1034},
+    {u"male-pilot_tone2", 1035},
+    {u"male-pilot_tone3", 1036},
+    {u"male-pilot_tone4", 1037},
+    {u"male-pilot_tone5", 1038},
+    {u"man-heart-man", 1039},
+    {u"man-heart-man_tone1-tone1", 1040},
+    {u"man-heart-man_tone1-tone2", 1041},
+    {u"man-heart-man_tone1-tone3", 1042},
+    {u"man-heart-man_tone1-tone4", 1043},
+    {u"man-heart-man_tone1-tone5", 1044},
+    {u"man-heart-man_tone2-tone1", 1045},
+    {u"man-heart-man_tone2-tone2", 1046},
+    {u"man-heart-man_tone2-tone3", 1047},
+    {u"man-heart-man_tone2-tone4", 1048},
+    {u"man-heart-man_tone2-tone5", 1049},
+    {u"man-heart-man_tone3-tone1", 1050},
+    {u"man-heart-man_tone3-tone2", 1051},
+    {u"man-heart-man_tone3-tone3", 1052},
+    {u"man-heart-man_tone3-tone4", 1053},
+    {u"man-heart-man_tone3-tone5", 1054},
+    {u"man-heart-man_tone4-tone1", 1055},
+    {u"man-heart-man_tone4-tone2", 1056},
+    {u"man-heart-man_tone4-tone3", 1057},
+    {u"man-heart-man_tone4-tone4", 1058},
+    {u"man-heart-man_tone4-tone5", 1059},
+    {u"man-heart-man_tone5-tone1", 1060},
+    {u"man-heart-man_tone5-tone2", 1061},
+    {u"man-heart-man_tone5-tone3", 1062},
+    {u"man-heart-man_tone5-tone4", 1063},
+    {u"man-heart-man_tone5-tone5", 1064},
+    {u"man-kiss-man", 1065},
+    {u"man-kiss-man_tone1-tone1", 1066},
+    {u"man-kiss-man_tone1-tone2", 1067},
+    {u"man-kiss-man_tone1-tone3", 1068},
+    {u"man-kiss-man_tone1-tone4", 1069},
+    {u"man-kiss-man_tone1-tone5", 1070},
+    {u"man-kiss-man_tone2-tone1", 1071},
+    {u"man-kiss-man_tone2-tone2", 1072},
+    {u"man-kiss-man_tone2-tone3", 1073},
+    {u"man-kiss-man_tone2-tone4", 1074},
+    {u"man-kiss-man_tone2-tone5", 1075},
+    {u"man-kiss-man_tone3-tone1", 1076},
+    {u"man-kiss-man_tone3-tone2", 1077},
+    {u"man-kiss-man_tone3-tone3", 1078},
+    {u"man-kiss-man_tone3-tone4", 1079},
+    {u"man-kiss-man_tone3-tone5", 1080},
+    {u"man-kiss-man_tone4-tone1", 1081},
+    {u"man-kiss-man_tone4-tone2", 1082},
+    {u"man-kiss-man_tone4-tone3", 1083},
+    {u"man-kiss-man_tone4-tone4", 1084},
+    {u"man-kiss-man_tone4-tone5", 1085},
+    {u"man-kiss-man_tone5-tone1", 1086},
+    {u"man-kiss-man_tone5-tone2", 1087},
+    {u"man-kiss-man_tone5-tone3", 1088},
+    {u"man-kiss-man_tone5-tone4", 1089},
+    {u"man-kiss-man_tone5-tone5", 1090},
+    {u"man", 1091},
+    {u"man_tone1", 1092},
+    {u"man_tone2", 1093},
+    {u"man_tone3", 1094},
+    {u"man_tone4", 1095},
+    {u"man_tone5", 1096},
+    {u"female-farmer", 1097},
+    {u"female-farmer_tone1", 1098},
+    {u"female-farmer_tone2", 1099},
+    {u"female-farmer_tone3", 1100},
+    {u"female-farmer_tone4", 1101},
+    {u"female-farmer_tone5", 1102},
+    {u"female-cook", 1103},
+    {u"female-cook_tone1", 1104},
+    {u"female-cook_tone2", 1105},
+    {u"female-cook_tone3", 1106},
+    {u"female-cook_tone4", 1107},
+    {u"female-cook_tone5", 1108},
+    {u"woman_feeding_baby", 1109},
+    {u"woman_feeding_baby_tone1", 1110},
+    {u"woman_feeding_baby_tone2", 1111},
+    {u"woman_feeding_baby_tone3", 1112},
+    {u"woman_feeding_baby_tone4", 1113},
+    {u"woman_feeding_baby_tone5", 1114},
+    {u"female-student", 1115},
+    {u"female-student_tone1", 1116},
+    {u"female-student_tone2", 1117},
+    {u"female-student_tone3", 1118},
+    {u"female-student_tone4", 1119},
+    {u"female-student_tone5", 1120},
+    {u"female-singer", 1121},
+    {u"female-singer_tone1", 1122},
+    {u"female-singer_tone2", 1123},
+    {u"female-singer_tone3", 1124},
+    {u"female-singer_tone4", 1125},
+    {u"female-singer_tone5", 1126},
+    {u"female-artist", 1127},
+    {u"female-artist_tone1", 1128},
+    {u"female-artist_tone2", 1129},
+    {u"female-artist_tone3", 1130},
+    {u"female-artist_tone4", 1131},
+    {u"female-artist_tone5", 1132},
+    {u"female-teacher", 1133},
+    {u"female-teacher_tone1", 1134},
+    {u"female-teacher_tone2", 1135},
+    {u"female-teacher_tone3", 1136},
+    {u"female-teacher_tone4", 1137},
+    {u"female-teacher_tone5", 1138},
+    {u"female-factory-worker", 1139},
+    {u"female-factory-worker_tone1", 1140},
+    {u"female-factory-worker_tone2", 1141},
+    {u"female-factory-worker_tone3", 1142},
+    {u"female-factory-worker_tone4", 1143},
+    {u"female-factory-worker_tone5", 1144},
+    {u"woman-boy-boy", 1145},
+    {u"woman-boy", 1146},
+    {u"woman-girl-boy", 1147},
+    {u"woman-girl-girl", 1148},
+    {u"woman-girl", 1149},
+    {u"woman-woman-boy", 1150},
+    {u"woman-woman-boy-boy", 1151},
+    {u"woman-woman-girl", 1152},
+    {u"woman-woman-girl-boy", 1153},
+    {u"woman-woman-girl-girl", 1154},
+    {u"female-technologist", 1155},
+    {u"female-technologist_tone1", 1156},
+    {u"female-technologist_tone2", 1157},
+    {u"female-technologist_tone3", 1158},
+    {u"female-technologist_tone4", 1159},
+    {u"female-technologist_tone5", 1160},
+    {u"female-office-worker", 1161},
+    {u"female-office-worker_tone1", 1162},
+    {u"female-office-worker_tone2", 1163},
+    {u"female-office-worker_tone3", 1164},
+    {u"female-office-worker_tone4", 1165},
+    {u"female-office-worker_tone5", 1166},
+    {u"female-mechanic", 1167},
+    {u"female-mechanic_tone1", 1168},
+    {u"female-mechanic_tone2", 1169},
+    {u"female-mechanic_tone3", 1170},
+    {u"female-mechanic_tone4", 1171},
+    {u"female-mechanic_tone5", 1172},
+    {u"female-scientist", 1173},
+    {u"female-scientist_tone1", 1174},
+    {u"female-scientist_tone2", 1175},
+    {u"female-scientist_tone3", 1176},
+    {u"female-scientist_tone4", 1177},
+    {u"female-scientist_tone5", 1178},
+    {u"female-astronaut", 1179},
+    {u"female-astronaut_tone1", 1180},
+    {u"female-astronaut_tone2", 1181},
+    {u"female-astronaut_tone3", 1182},
+    {u"female-astronaut_tone4", 1183},
+    {u"female-astronaut_tone5", 1184},
+    {u"female-firefighter", 1185},
+    {u"female-firefighter_tone1", 1186},
+    {u"female-firefighter_tone2", 1187},
+    {u"female-firefighter_tone3", 1188},
+    {u"female-firefighter_tone4", 1189},
+    {u"female-firefighter_tone5", 1190},
+    {u"woman_with_white_cane_facing_right", 1191},
+    {u"woman_with_white_cane_facing_right_tone1", 1192},
+    {u"woman_with_white_cane_facing_right_tone2", 1193},
+    {u"woman_with_white_cane_facing_right_tone3", 1194},
+    {u"woman_with_white_cane_facing_right_tone4", 1195},
+    {u"woman_with_white_cane_facing_right_tone5", 1196},
+    {u"woman_with_probing_cane", 1197},
+    {u"woman_with_probing_cane_tone1", 1198},
+    {u"woman_with_probing_cane_tone2", 1199},
+    {u"woman_with_probing_cane_tone3", 1200},
+    {u"woman_with_probing_cane_tone4", 1201},
+    {u"woman_with_probing_cane_tone5", 1202},
+    {u"red_haired_woman", 1203},
+    {u"red_haired_woman_tone1", 1204},
+    {u"red_haired_woman_tone2", 1205},
+    {u"red_haired_woman_tone3", 1206},
+    {u"red_haired_woman_tone4", 1207},
+    {u"red_haired_woman_tone5", 1208},
+    {u"curly_haired_woman", 1209},
+    {u"curly_haired_woman_tone1", 1210},
+    {u"curly_haired_woman_tone2", 1211},
+    {u"curly_haired_woman_tone3", 1212},
+    {u"curly_haired_woman_tone4", 1213},
+    {u"curly_haired_woman_tone5", 1214},
+    {u"bald_woman", 1215},
+    {u"bald_woman_tone1", 1216},
+    {u"bald_woman_tone2", 1217},
+    {u"bald_woman_tone3", 1218},
+    {u"bald_woman_tone4", 1219},
+    {u"bald_woman_tone5", 1220},
+    {u"white_haired_woman", 1221},
+    {u"white_haired_woman_tone1", 1222},
+    {u"white_haired_woman_tone2", 1223},
+    {u"white_haired_woman_tone3", 1224},
+    {u"white_haired_woman_tone4", 1225},
+    {u"white_haired_woman_tone5", 1226},
+    {u"woman_in_motorized_wheelchair_facing_right", 1227},
+    {u"woman_in_motorized_wheelchair_facing_right_tone1", 1228},
+    {u"woman_in_motorized_wheelchair_facing_right_tone2", 1229},
+    {u"woman_in_motorized_wheelchair_facing_right_tone3", 1230},
+    {u"woman_in_motorized_wheelchair_facing_right_tone4", 1231},
+    {u"woman_in_motorized_wheelchair_facing_right_tone5", 1232},
+    {u"woman_in_motorized_wheelchair", 1233},
+    {u"woman_in_motorized_wheelchair_tone1", 1234},
+    {u"woman_in_motorized_wheelchair_tone2", 1235},
+    {u"woman_in_motorized_wheelchair_tone3", 1236},
+    {u"woman_in_motorized_wheelchair_tone4", 1237},
+    {u"woman_in_motorized_wheelchair_tone5", 1238},
+    {u"woman_in_manual_wheelchair_facing_right", 1239},
+    {u"woman_in_manual_wheelchair_facing_right_tone1", 1240},
+    {u"woman_in_manual_wheelchair_facing_right_tone2", 1241},
+    {u"woman_in_manual_wheelchair_facing_right_tone3", 1242},
+    {u"woman_in_manual_wheelchair_facing_right_tone4", 1243},
+    {u"woman_in_manual_wheelchair_facing_right_tone5", 1244},
+    {u"woman_in_manual_wheelchair", 1245},
+    {u"woman_in_manual_wheelchair_tone1", 1246},
+    {u"woman_in_manual_wheelchair_tone2", 1247},
+    {u"woman_in_manual_wheelchair_tone3", 1248},
+    {u"woman_in_manual_wheelchair_tone4", 1249},
+    {u"woman_in_manual_wheelchair_tone5", 1250},
+    {u"female-doctor", 1251},
+    {u"female-doctor_tone1", 1252},
+    {u"female-doctor_tone2", 1253},
+    {u"female-doctor_tone3", 1254},
+    {u"female-doctor_tone4", 1255},
+    {u"female-doctor_tone5", 1256},
+    {u"female-judge", 1257},
+    {u"female-judge_tone1", 1258},
+    {u"female-judge_tone2", 1259},
+    {u"female-judge_tone3", 1260},
+    {u"female-judge_tone4", 1261},
+    {u"female-judge_tone5", 1262},
+    {u"female-pilot", 1263},
+    {u"female-pilot_tone1", 1264},
+    {u"female-pilot_tone2", 1265},
+    {u"female-pilot_tone3", 1266},
+    {u"female-pilot_tone4", 1267},
+    {u"female-pilot_tone5", 1268},
+    {u"woman-heart-man", 1269},
+    {u"woman-heart-man_tone1-tone1", 1270},
+    {u"woman-heart-man_tone1-tone2", 1271},
+    {u"woman-heart-man_tone1-tone3", 1272},
+    {u"woman-heart-man_tone1-tone4", 1273},
+    {u"woman-heart-man_tone1-tone5", 1274},
+    {u"woman-heart-man_tone2-tone1", 1275},
+    {u"woman-heart-man_tone2-tone2", 1276},
+    {u"woman-heart-man_tone2-tone3", 1277},
+    {u"woman-heart-man_tone2-tone4", 1278},
+    {u"woman-heart-man_tone2-tone5", 1279},
+    {u"woman-heart-man_tone3-tone1", 1280},
+    {u"woman-heart-man_tone3-tone2", 1281},
+    {u"woman-heart-man_tone3-tone3", 1282},
+    {u"woman-heart-man_tone3-tone4", 1283},
+    {u"woman-heart-man_tone3-tone5", 1284},
+    {u"woman-heart-man_tone4-tone1", 1285},
+    {u"woman-heart-man_tone4-tone2", 1286},
+    {u"woman-heart-man_tone4-tone3", 1287},
+    {u"woman-heart-man_tone4-tone4", 1288},
+    {u"woman-heart-man_tone4-tone5", 1289},
+    {u"woman-heart-man_tone5-tone1", 1290},
+    {u"woman-heart-man_tone5-tone2", 1291},
+    {u"woman-heart-man_tone5-tone3", 1292},
+    {u"woman-heart-man_tone5-tone4", 1293},
+    {u"woman-heart-man_tone5-tone5", 1294},
+    {u"woman-heart-woman", 1295},
+    {u"woman-heart-woman_tone1-tone1", 1296},
+    {u"woman-heart-woman_tone1-tone2", 1297},
+    {u"woman-heart-woman_tone1-tone3", 1298},
+    {u"woman-heart-woman_tone1-tone4", 1299},
+    {u"woman-heart-woman_tone1-tone5", 1300},
+    {u"woman-heart-woman_tone2-tone1", 1301},
+    {u"woman-heart-woman_tone2-tone2", 1302},
+    {u"woman-heart-woman_tone2-tone3", 1303},
+    {u"woman-heart-woman_tone2-tone4", 1304},
+    {u"woman-heart-woman_tone2-tone5", 1305},
+    {u"woman-heart-woman_tone3-tone1", 1306},
+    {u"woman-heart-woman_tone3-tone2", 1307},
+    {u"woman-heart-woman_tone3-tone3", 1308},
+    {u"woman-heart-woman_tone3-tone4", 1309},
+    {u"woman-heart-woman_tone3-tone5", 1310},
+    {u"woman-heart-woman_tone4-tone1", 1311},
+    {u"woman-heart-woman_tone4-tone2", 1312},
+    {u"woman-heart-woman_tone4-tone3", 1313},
+    {u"woman-heart-woman_tone4-tone4", 1314},
+    {u"woman-heart-woman_tone4-tone5", 1315},
+    {u"woman-heart-woman_tone5-tone1", 1316},
+    {u"woman-heart-woman_tone5-tone2", 1317},
+    {u"woman-heart-woman_tone5-tone3", 1318},
+    {u"woman-heart-woman_tone5-tone4", 1319},
+    {u"woman-heart-woman_tone5-tone5", 1320},
+    {u"woman-kiss-man", 1321},
+    {u"woman-kiss-man_tone1-tone1", 1322},
+    {u"woman-kiss-man_tone1-tone2", 1323},
+    {u"woman-kiss-man_tone1-tone3", 1324},
+    {u"woman-kiss-man_tone1-tone4", 1325},
+    {u"woman-kiss-man_tone1-tone5", 1326},
+    {u"woman-kiss-man_tone2-tone1", 1327},
+    {u"woman-kiss-man_tone2-tone2", 1328},
+    {u"woman-kiss-man_tone2-tone3", 1329},
+    {u"woman-kiss-man_tone2-tone4", 1330},
+    {u"woman-kiss-man_tone2-tone5", 1331},
+    {u"woman-kiss-man_tone3-tone1", 1332},
+    {u"woman-kiss-man_tone3-tone2", 1333},
+    {u"woman-kiss-man_tone3-tone3", 1334},
+    {u"woman-kiss-man_tone3-tone4", 1335},
+    {u"woman-kiss-man_tone3-tone5", 1336},
+    {u"woman-kiss-man_tone4-tone1", 1337},
+    {u"woman-kiss-man_tone4-tone2", 1338},
+    {u"woman-kiss-man_tone4-tone3", 1339},
+    {u"woman-kiss-man_tone4-tone4", 1340},
+    {u"woman-kiss-man_tone4-tone5", 1341},
+    {u"woman-kiss-man_tone5-tone1", 1342},
+    {u"woman-kiss-man_tone5-tone2", 1343},
+    {u"woman-kiss-man_tone5-tone3", 1344},
+    {u"woman-kiss-man_tone5-tone4", 1345},
+    {u"woman-kiss-man_tone5-tone5", 1346},
+    {u"woman-kiss-woman", 1347},
+    {u"woman-kiss-woman_tone1-tone1", 1348},
+    {u"woman-kiss-woman_tone1-tone2", 1349},
+    {u"woman-kiss-woman_tone1-tone3", 1350},
+    {u"woman-kiss-woman_tone1-tone4", 1351},
+    {u"woman-kiss-woman_tone1-tone5", 1352},
+    {u"woman-kiss-woman_tone2-tone1", 1353},
+    {u"woman-kiss-woman_tone2-tone2", 1354},
+    {u"woman-kiss-woman_tone2-tone3", 1355},
+    {u"woman-kiss-woman_tone2-tone4", 1356},
+    {u"woman-kiss-woman_tone2-tone5", 1357},
+    {u"woman-kiss-woman_tone3-tone1", 1358},
+    {u"woman-kiss-woman_tone3-tone2", 1359},
+    {u"woman-kiss-woman_tone3-tone3", 1360},
+    {u"woman-kiss-woman_tone3-tone4", 1361},
+    {u"woman-kiss-woman_tone3-tone5", 1362},
+    {u"woman-kiss-woman_tone4-tone1", 1363},
+    {u"woman-kiss-woman_tone4-tone2", 1364},
+    {u"woman-kiss-woman_tone4-tone3", 1365},
+    {u"woman-kiss-woman_tone4-tone4", 1366},
+    {u"woman-kiss-woman_tone4-tone5", 1367},
+    {u"woman-kiss-woman_tone5-tone1", 1368},
+    {u"woman-kiss-woman_tone5-tone2", 1369},
+    {u"woman-kiss-woman_tone5-tone3", 1370},
+    {u"woman-kiss-woman_tone5-tone4", 1371},
+    {u"woman-kiss-woman_tone5-tone5", 1372},
+    {u"woman", 1373},
+    {u"woman_tone1", 1374},
+    {u"woman_tone2", 1375},
+    {u"woman_tone3", 1376},
+    {u"woman_tone4", 1377},
+    {u"woman_tone5", 1378},
+    {u"family", 1379},
+    {u"man_and_woman_holding_hands", 1380},
+    {u"woman_and_man_holding_hands", 1380},
+    {u"couple", 1380},
+    {u"man_and_woman_holding_hands_tone1", 1381},
+    {u"man_and_woman_holding_hands_tone2", 1382},
+    {u"man_and_woman_holding_hands_tone3", 1383},
+    {u"man_and_woman_holding_hands_tone4", 1384},
+    {u"man_and_woman_holding_hands_tone5", 1385},
+    {u"man_and_woman_holding_hands_tone1-tone2", 1386},
+    {u"man_and_woman_holding_hands_tone1-tone3", 1387},
+    {u"man_and_woman_holding_hands_tone1-tone4", 1388},
+    {u"man_and_woman_holding_hands_tone1-tone5", 1389},
+    {u"man_and_woman_holding_hands_tone2-tone1", 1390},
+    {u"man_and_woman_holding_hands_tone2-tone3", 1391},
+    {u"man_and_woman_holding_hands_tone2-tone4", 1392},
+    {u"man_and_woman_holding_hands_tone2-tone5", 1393},
+    {u"man_and_woman_holding_hands_tone3-tone1", 1394},
+    {u"man_and_woman_holding_hands_tone3-tone2", 1395},
+    {u"man_and_woman_holding_hands_tone3-tone4", 1396},
+    {u"man_and_woman_holding_hands_tone3-tone5", 1397},
+    {u"man_and_woman_holding_hands_tone4-tone1", 1398},
+    {u"man_and_woman_holding_hands_tone4-tone2", 1399},
+    {u"man_and_woman_holding_hands_tone4-tone3", 1400},
+    {u"man_and_woman_holding_hands_tone4-tone5", 1401},
+    {u"man_and_woman_holding_hands_tone5-tone1", 1402},
+    {u"man_and_woman_holding_hands_tone5-tone2", 1403},
+    {u"man_and_woman_holding_hands_tone5-tone3", 1404},
+    {u"man_and_woman_holding_hands_tone5-tone4", 1405},
+    {u"two_men_holding_hands", 1406},
+    {u"men_holding_hands", 1406},
+    {u"two_men_holding_hands_tone1", 1407},
+    {u"two_men_holding_hands_tone2", 1408},
+    {u"two_men_holding_hands_tone3", 1409},
+    {u"two_men_holding_hands_tone4", 1410},
+    {u"two_men_holding_hands_tone5", 1411},
+    {u"two_men_holding_hands_tone1-tone2", 1412},
+    {u"two_men_holding_hands_tone1-tone3", 1413},
+    {u"two_men_holding_hands_tone1-tone4", 1414},
+    {u"two_men_holding_hands_tone1-tone5", 1415},
+    {u"two_men_holding_hands_tone2-tone1", 1416},
+    {u"two_men_holding_hands_tone2-tone3", 1417},
+    {u"two_men_holding_hands_tone2-tone4", 1418},
+    {u"two_men_holding_hands_tone2-tone5", 1419},
+    {u"two_men_holding_hands_tone3-tone1", 1420},
+    {u"two_men_holding_hands_tone3-tone2", 1421},
+    {u"two_men_holding_hands_tone3-tone4", 1422},
+    {u"two_men_holding_hands_tone3-tone5", 1423},
+    {u"two_men_holding_hands_tone4-tone1", 1424},
+    {u"two_men_holding_hands_tone4-tone2", 1425},
+    {u"two_men_holding_hands_tone4-tone3", 1426},
+    {u"two_men_holding_hands_tone4-tone5", 1427},
+    {u"two_men_holding_hands_tone5-tone1", 1428},
+    {u"two_men_holding_hands_tone5-tone2", 1429},
+    {u"two_men_holding_hands_tone5-tone3", 1430},
+    {u"two_men_holding_hands_tone5-tone4", 1431},
+    {u"two_women_holding_hands", 1432},
+    {u"women_holding_hands", 1432},
+    {u"two_women_holding_hands_tone1", 1433},
+    {u"two_women_holding_hands_tone2", 1434},
+    {u"two_women_holding_hands_tone3", 1435},
+    {u"two_women_holding_hands_tone4", 1436},
+    {u"two_women_holding_hands_tone5", 1437},
+    {u"two_women_holding_hands_tone1-tone2", 1438},
+    {u"two_women_holding_hands_tone1-tone3", 1439},
+    {u"two_women_holding_hands_tone1-tone4", 1440},
+    {u"two_women_holding_hands_tone1-tone5", 1441},
+    {u"two_women_holding_hands_tone2-tone1", 1442},
+    {u"two_women_holding_hands_tone2-tone3", 1443},
+    {u"two_women_holding_hands_tone2-tone4", 1444},
+    {u"two_women_holding_hands_tone2-tone5", 1445},
+    {u"two_women_holding_hands_tone3-tone1", 1446},
+    {u"two_women_holding_hands_tone3-tone2", 1447},
+    {u"two_women_holding_hands_tone3-tone4", 1448},
+    {u"two_women_holding_hands_tone3-tone5", 1449},
+    {u"two_women_holding_hands_tone4-tone1", 1450},
+    {u"two_women_holding_hands_tone4-tone2", 1451},
+    {u"two_women_holding_hands_tone4-tone3", 1452},
+    {u"two_women_holding_hands_tone4-tone5", 1453},
+    {u"two_women_holding_hands_tone5-tone1", 1454},
+    {u"two_women_holding_hands_tone5-tone2", 1455},
+    {u"two_women_holding_hands_tone5-tone3", 1456},
+    {u"two_women_holding_hands_tone5-tone4", 1457},
+    {u"female-police-officer", 1458},
+    {u"female-police-officer_tone1", 1459},
+    {u"female-police-officer_tone2", 1460},
+    {u"female-police-officer_tone3", 1461},
+    {u"female-police-officer_tone4", 1462},
+    {u"female-police-officer_tone5", 1463},
+    {u"male-police-officer", 1464},
+    {u"male-police-officer_tone1", 1465},
+    {u"male-police-officer_tone2", 1466},
+    {u"male-police-officer_tone3", 1467},
+    {u"male-police-officer_tone4", 1468},
+    {u"male-police-officer_tone5", 1469},
+    {u"cop", 1470},
+    {u"cop_tone1", 1471},
+    {u"cop_tone2", 1472},
+    {u"cop_tone3", 1473},
+    {u"cop_tone4", 1474},
+    {u"cop_tone5", 1475},
+    {u"women-with-bunny-ears-partying", 1476},
+    {u"woman-with-bunny-ears-partying", 1476},
+    {u"men-with-bunny-ears-partying", 1477},
+    {u"man-with-bunny-ears-partying", 1477},
+    {u"dancers", 1478},
+    {u"woman_with_veil", 1479},
+    {u"woman_with_veil_tone1", 1480},
+    {u"woman_with_veil_tone2", 1481},
+    {u"woman_with_veil_tone3", 1482},
+    {u"woman_with_veil_tone4", 1483},
+    {u"woman_with_veil_tone5", 1484},
+    {u"man_with_veil", 1485},
+    {u"man_with_veil_tone1", 1486},
+    {u"man_with_veil_tone2", 1487},
+    {u"man_with_veil_tone3", 1488},
+    {u"man_with_veil_tone4", 1489},
+    {u"man_with_veil_tone5", 1490},
+    {u"bride_with_veil", 1491},
+    {u"bride_with_veil_tone1", 1492},
+    {u"bride_with_veil_tone2", 1493},
+    {u"bride_with_veil_tone3", 1494},
+    {u"bride_with_veil_tone4", 1495},
+    {u"bride_with_veil_tone5", 1496},
+    {u"blond-haired-woman", 1497},
+    {u"blond-haired-woman_tone1", 1498},
+    {u"blond-haired-woman_tone2", 1499},
+    {u"blond-haired-woman_tone3", 1500},
+    {u"blond-haired-woman_tone4", 1501},
+    {u"blond-haired-woman_tone5", 1502},
+    {u"blond-haired-man", 1503},
+    {u"blond-haired-man_tone1", 1504},
+    {u"blond-haired-man_tone2", 1505},
+    {u"blond-haired-man_tone3", 1506},
+    {u"blond-haired-man_tone4", 1507},
+    {u"blond-haired-man_tone5", 1508},
+    {u"person_with_blond_hair", 1509},
+    {u"person_with_blond_hair_tone1", 1510},
+    {u"person_with_blond_hair_tone2", 1511},
+    {u"person_with_blond_hair_tone3", 1512},
+    {u"person_with_blond_hair_tone4", 1513},
+    {u"person_with_blond_hair_tone5", 1514},
+    {u"man_with_gua_pi_mao", 1515},
+    {u"man_with_gua_pi_mao_tone1", 1516},
+    {u"man_with_gua_pi_mao_tone2", 1517},
+    {u"man_with_gua_pi_mao_tone3", 1518},
+    {u"man_with_gua_pi_mao_tone4", 1519},
+    {u"man_with_gua_pi_mao_tone5", 1520},
+    {u"woman-wearing-turban", 1521},
+    {u"woman-wearing-turban_tone1", 1522},
+    {u"woman-wearing-turban_tone2", 1523},
+    {u"woman-wearing-turban_tone3", 1524},
+    {u"woman-wearing-turban_tone4", 1525},
+    {u"woman-wearing-turban_tone5", 1526},
+    {u"man-wearing-turban", 1527},
+    {u"man-wearing-turban_tone1", 1528},
+    {u"man-wearing-turban_tone2", 1529},
+    {u"man-wearing-turban_tone3", 1530},
+    {u"man-wearing-turban_tone4", 1531},
+    {u"man-wearing-turban_tone5", 1532},
+    {u"man_with_turban", 1533},
+    {u"man_with_turban_tone1", 1534},
+    {u"man_with_turban_tone2", 1535},
+    {u"man_with_turban_tone3", 1536},
+    {u"man_with_turban_tone4", 1537},
+    {u"man_with_turban_tone5", 1538},
+    {u"older_man", 1539},
+    {u"older_man_tone1", 1540},
+    {u"older_man_tone2", 1541},
+    {u"older_man_tone3", 1542},
+    {u"older_man_tone4", 1543},
+    {u"older_man_tone5", 1544},
+    {u"older_woman", 1545},
+    {u"older_woman_tone1", 1546},
+    {u"older_woman_tone2", 1547},
+    {u"older_woman_tone3", 1548},
+    {u"older_woman_tone4", 1549},
+    {u"older_woman_tone5", 1550},
+    {u"baby", 1551},
+    {u"baby_tone1", 1552},
+    {u"baby_tone2", 1553},
+    {u"baby_tone3", 1554},
+    {u"baby_tone4", 1555},
+    {u"baby_tone5", 1556},
+    {u"female-construction-worker", 1557},
+    {u"female-construction-worker_tone1", 1558},
+    {u"female-construction-worker_tone2", 1559},
+    {u"female-construction-worker_tone3", 1560},
+    {u"female-construction-worker_tone4", 1561},
+    {u"female-construction-worker_tone5", 1562},
+    {u"male-construction-worker", 1563},
+    {u"male-construction-worker_tone1", 1564},
+    {u"male-construction-worker_tone2", 1565},
+    {u"male-construction-worker_tone3", 1566},
+    {u"male-construction-worker_tone4", 1567},
+    {u"male-construction-worker_tone5", 1568},
+    {u"construction_worker", 1569},
+    {u"construction_worker_tone1", 1570},
+    {u"construction_worker_tone2", 1571},
+    {u"construction_worker_tone3", 1572},
+    {u"construction_worker_tone4", 1573},
+    {u"construction_worker_tone5", 1574},
+    {u"princess", 1575},
+    {u"princess_tone1", 1576},
+    {u"princess_tone2", 1577},
+    {u"princess_tone3", 1578},
+    {u"princess_tone4", 1579},
+    {u"princess_tone5", 1580},
+    {u"japanese_ogre", 1581},
+    {u"japanese_goblin", 1582},
+    {u"ghost", 1583},
+    {u"angel", 1584},
+    {u"angel_tone1", 1585},
+    {u"angel_tone2", 1586},
+    {u"angel_tone3", 1587},
+    {u"angel_tone4", 1588},
+    {u"angel_tone5", 1589},
+    {u"alien", 1590},
+    {u"space_invader", 1591},
+    {u"imp", 1592},
+    {u"skull", 1593},
+    {u"woman-tipping-hand", 1594},
+    {u"woman-tipping-hand_tone1", 1595},
+    {u"woman-tipping-hand_tone2", 1596},
+    {u"woman-tipping-hand_tone3", 1597},
+    {u"woman-tipping-hand_tone4", 1598},
+    {u"woman-tipping-hand_tone5", 1599},
+    {u"man-tipping-hand", 1600},
+    {u"man-tipping-hand_tone1", 1601},
+    {u"man-tipping-hand_tone2", 1602},
+    {u"man-tipping-hand_tone3", 1603},
+    {u"man-tipping-hand_tone4", 1604},
+    {u"man-tipping-hand_tone5", 1605},
+    {u"information_desk_person", 1606},
+    {u"information_desk_person_tone1", 1607},
+    {u"information_desk_person_tone2", 1608},
+    {u"information_desk_person_tone3", 1609},
+    {u"information_desk_person_tone4", 1610},
+    {u"information_desk_person_tone5", 1611},
+    {u"female-guard", 1612},
+    {u"female-guard_tone1", 1613},
+    {u"female-guard_tone2", 1614},
+    {u"female-guard_tone3", 1615},
+    {u"female-guard_tone4", 1616},
+    {u"female-guard_tone5", 1617},
+    {u"male-guard", 1618},
+    {u"male-guard_tone1", 1619},
+    {u"male-guard_tone2", 1620},
+    {u"male-guard_tone3", 1621},
+    {u"male-guard_tone4", 1622},
+    {u"male-guard_tone5", 1623},
+    {u"guardsman", 1624},
+    {u"guardsman_tone1", 1625},
+    {u"guardsman_tone2", 1626},
+    {u"guardsman_tone3", 1627},
+    {u"guardsman_tone4", 1628},
+    {u"guardsman_tone5", 1629},
+    {u"dancer", 1630},
+    {u"dancer_tone1", 1631},
+    {u"dancer_tone2", 1632},
+    {u"dancer_tone3", 1633},
+    {u"dancer_tone4", 1634},
+    {u"dancer_tone5", 1635},
+    {u"lipstick", 1636},
+    {u"nail_care", 1637},
+    {u"nail_care_tone1", 1638},
+    {u"nail_care_tone2", 1639},
+    {u"nail_care_tone3", 1640},
+    {u"nail_care_tone4", 1641},
+    {u"nail_care_tone5", 1642},
+    {u"woman-getting-massage", 1643},
+    {u"woman-getting-massage_tone1", 1644},
+    {u"woman-getting-massage_tone2", 1645},
+    {u"woman-getting-massage_tone3", 1646},
+    {u"woman-getting-massage_tone4", 1647},
+    {u"woman-getting-massage_tone5", 1648},
+    {u"man-getting-massage", 1649},
+    {u"man-getting-massage_tone1", 1650},
+    {u"man-getting-massage_tone2", 1651},
+    {u"man-getting-massage_tone3", 1652},
+    {u"man-getting-massage_tone4", 1653},
+    {u"man-getting-massage_tone5", 1654},
+    {u"massage", 1655},
+    {u"massage_tone1", 1656},
+    {u"massage_tone2", 1657},
+    {u"massage_tone3", 1658},
+    {u"massage_tone4", 1659},
+    {u"massage_tone5", 1660},
+    {u"woman-getting-haircut", 1661},
+    {u"woman-getting-haircut_tone1", 1662},
+    {u"woman-getting-haircut_tone2", 1663},
+    {u"woman-getting-haircut_tone3", 1664},
+    {u"woman-getting-haircut_tone4", 1665},
+    {u"woman-getting-haircut_tone5", 1666},
+    {u"man-getting-haircut", 1667},
+    {u"man-getting-haircut_tone1", 1668},
+    {u"man-getting-haircut_tone2", 1669},
+    {u"man-getting-haircut_tone3", 1670},
+    {u"man-getting-haircut_tone4", 1671},
+    {u"man-getting-haircut_tone5", 1672},
+    {u"haircut", 1673},
+    {u"haircut_tone1", 1674},
+    {u"haircut_tone2", 1675},
+    {u"haircut_tone3", 1676},
+    {u"haircut_tone4", 1677},
+    {u"haircut_tone5", 1678},
+    {u"barber", 1679},
+    {u"syringe", 1680},
+    {u"pill", 1681},
+    {u"kiss", 1682},
+    {u"love_letter", 1683},
+    {u"ring", 1684},
+    {u"gem", 1685},
+    {u"couplekiss", 1686},
+    {u"couplekiss_tone1", 1687},
+    {u"couplekiss_tone2", 1688},
+    {u"couplekiss_tone3", 1689},
+    {u"couplekiss_tone4", 1690},
+    {u"couplekiss_tone5", 1691},
+    {u"couplekiss_tone1-tone2", 1692},
+    {u"couplekiss_tone1-tone3", 1693},
+    {u"couplekiss_tone1-tone4", 1694},
+    {u"couplekiss_tone1-tone5", 1695},
+    {u"couplekiss_tone2-tone1", 1696},
+    {u"couplekiss_tone2-tone3", 1697},
+    {u"couplekiss_tone2-tone4", 1698},
+    {u"couplekiss_tone2-tone5", 1699},
+    {u"couplekiss_tone3-tone1", 1700},
+    {u"couplekiss_tone3-tone2", 1701},
+    {u"couplekiss_tone3-tone4", 1702},
+    {u"couplekiss_tone3-tone5", 1703},
+    {u"couplekiss_tone4-tone1", 1704},
+    {u"couplekiss_tone4-tone2", 1705},
+    {u"couplekiss_tone4-tone3", 1706},
+    {u"couplekiss_tone4-tone5", 1707},
+    {u"couplekiss_tone5-tone1", 1708},
+    {u"couplekiss_tone5-tone2", 1709},
+    {u"couplekiss_tone5-tone3", 1710},
+    {u"couplekiss_tone5-tone4", 1711},
+    {u"bouquet", 1712},
+    {u"couple_with_heart", 1713},
+    {u"couple_with_heart_tone1", 1714},
+    {u"couple_with_heart_tone2", 1715},
+    {u"couple_with_heart_tone3", 1716},
+    {u"couple_with_heart_tone4", 1717},
+    {u"couple_with_heart_tone5", 1718},
+    {u"couple_with_heart_tone1-tone2", 1719},
+    {u"couple_with_heart_tone1-tone3", 1720},
+    {u"couple_with_heart_tone1-tone4", 1721},
+    {u"couple_with_heart_tone1-tone5", 1722},
+    {u"couple_with_heart_tone2-tone1", 1723},
+    {u"couple_with_heart_tone2-tone3", 1724},
+    {u"couple_with_heart_tone2-tone4", 1725},
+    {u"couple_with_heart_tone2-tone5", 1726},
+    {u"couple_with_heart_tone3-tone1", 1727},
+    {u"couple_with_heart_tone3-tone2", 1728},
+    {u"couple_with_heart_tone3-tone4", 1729},
+    {u"couple_with_heart_tone3-tone5", 1730},
+    {u"couple_with_heart_tone4-tone1", 1731},
+    {u"couple_with_heart_tone4-tone2", 1732},
+    {u"couple_with_heart_tone4-tone3", 1733},
+    {u"couple_with_heart_tone4-tone5", 1734},
+    {u"couple_with_heart_tone5-tone1", 1735},
+    {u"couple_with_heart_tone5-tone2", 1736},
+    {u"couple_with_heart_tone5-tone3", 1737},
+    {u"couple_with_heart_tone5-tone4", 1738},
+    {u"wedding", 1739},
+    {u"heartbeat", 1740},
+    {u"broken_heart", 1741},
+    {u"two_hearts", 1742},
+    {u"sparkling_heart", 1743},
+    {u"heartpulse", 1744},
+    {u"cupid", 1745},
+    {u"blue_heart", 1746},
+    {u"green_heart", 1747},
+    {u"yellow_heart", 1748},
+    {u"purple_heart", 1749},
+    {u"gift_heart", 1750},
+    {u"revolving_hearts", 1751},
+    {u"heart_decoration", 1752},
+    {u"diamond_shape_with_a_dot_inside", 1753},
+    {u"bulb", 1754},
+    {u"anger", 1755},
+    {u"bomb", 1756},
+    {u"zzz", 1757},
+    {u"boom", 1758},
+    {u"collision", 1758},
+    {u"sweat_drops", 1759},
+    {u"droplet", 1760},
+    {u"dash", 1761},
+    {u"hankey", 1762},
+    {u"poop", 1762},
+    {u"shit", 1762},
+    {u"muscle", 1763},
+    {u"muscle_tone1", 1764},
+    {u"muscle_tone2", 1765},
+    {u"muscle_tone3", 1766},
+    {u"muscle_tone4", 1767},
+    {u"muscle_tone5", 1768},
+    {u"dizzy", 1769},
+    {u"speech_balloon", 1770},
+    {u"thought_balloon", 1771},
+    {u"white_flower", 1772},
+    {u"100", 1773},
+    {u"moneybag", 1774},
+    {u"currency_exchange", 1775},
+    {u"heavy_dollar_sign", 1776},
+    {u"credit_card", 1777},
+    {u"yen", 1778},
+    {u"dollar", 1779},
+    {u"euro", 1780},
+    {u"pound", 1781},
+    {u"money_with_wings", 1782},
+    {u"chart", 1783},
+    {u"seat", 1784},
+    {u"computer", 1785},
+    {u"briefcase", 1786},
+    {u"minidisc", 1787},
+    {u"floppy_disk", 1788},
+    {u"cd", 1789},
+    {u"dvd", 1790},
+    {u"file_folder", 1791},
+    {u"open_file_folder", 1792},
+    {u"page_with_curl", 1793},
+    {u"page_facing_up", 1794},
+    {u"date", 1795},
+    {u"calendar", 1796},
+    {u"card_index", 1797},
+    {u"chart_with_upwards_trend", 1798},
+    {u"chart_with_downwards_trend", 1799},
+    {u"bar_chart", 1800},
+    {u"clipboard", 1801},
+    {u"pushpin", 1802},
+    {u"round_pushpin", 1803},
+    {u"paperclip", 1804},
+    {u"straight_ruler", 1805},
+    {u"triangular_ruler", 1806},
+    {u"bookmark_tabs", 1807},
+    {u"ledger", 1808},
+    {u"notebook", 1809},
+    {u"notebook_with_decorative_cover", 1810},
+    {u"closed_book", 1811},
+    {u"book", 1812},
+    {u"open_book", 1812},
+    {u"green_book", 1813},
+    {u"blue_book", 1814},
+    {u"orange_book", 1815},
+    {u"books", 1816},
+    {u"name_badge", 1817},
+    {u"scroll", 1818},
+    {u"memo", 1819},
+    {u"pencil", 1819},
+    {u"telephone_receiver", 1820},
+    {u"pager", 1821},
+    {u"fax", 1822},
+    {u"satellite_antenna", 1823},
+    {u"loudspeaker", 1824},
+    {u"mega", 1825},
+    {u"outbox_tray", 1826},
+    {u"inbox_tray", 1827},
+    {u"package", 1828},
+    {u"e-mail", 1829},
+    {u"incoming_envelope", 1830},
+    {u"envelope_with_arrow", 1831},
+    {u"mailbox_closed", 1832},
+    {u"mailbox", 1833},
+    {u"mailbox_with_mail", 1834},
+    {u"mailbox_with_no_mail", 1835},
+    {u"postbox", 1836},
+    {u"postal_horn", 1837},
+    {u"newspaper", 1838},
+    {u"iphone", 1839},
+    {u"calling", 1840},
+    {u"vibration_mode", 1841},
+    {u"mobile_phone_off", 1842},
+    {u"no_mobile_phones", 1843},
+    {u"signal_strength", 1844},
+    {u"camera", 1845},
+    {u"camera_with_flash", 1846},
+    {u"video_camera", 1847},
+    {u"tv", 1848},
+    {u"radio", 1849},
+    {u"vhs", 1850},
+    {u"film_projector", 1851},
+    {u"prayer_beads", 1852},
+    {u"twisted_rightwards_arrows", 1853},
+    {u"repeat", 1854},
+    {u"repeat_one", 1855},
+    {u"arrows_clockwise", 1856},
+    {u"arrows_counterclockwise", 1857},
+    {u"low_brightness", 1858},
+    {u"high_brightness", 1859},
+    {u"mute", 1860},
+    {u"speaker", 1861},
+    {u"sound", 1862},
+    {u"loud_sound", 1863},
+    {u"battery", 1864},
+    {u"electric_plug", 1865},
+    {u"mag", 1866},
+    {u"mag_right", 1867},
+    {u"lock_with_ink_pen", 1868},
+    {u"closed_lock_with_key", 1869},
+    {u"key", 1870},
+    {u"lock", 1871},
+    {u"unlock", 1872},
+    {u"bell", 1873},
+    {u"no_bell", 1874},
+    {u"bookmark", 1875},
+    {u"link", 1876},
+    {u"radio_button", 1877},
+    {u"back", 1878},
+    {u"end", 1879},
+    {u"on", 1880},
+    {u"soon", 1881},
+    {u"top", 1882},
+    {u"underage", 1883},
+    {u"keycap_ten", 1884},
+    {u"capital_abcd", 1885},
+    {u"abcd", 1886},
+    {u"1234", 1887},
+    {u"symbols", 1888},
+    {u"abc", 1889},
+    {u"fire", 1890},
+    {u"flashlight", 1891},
+    {u"wrench", 1892},
+    {u"hammer", 1893},
+    {u"nut_and_bolt", 1894},
+    {u"hocho", 1895},
+    {u"knife", 1895},
+    {u"gun", 1896},
+    {u"microscope", 1897},
+    {u"telescope", 1898},
+    {u"crystal_ball", 1899},
+    {u"six_pointed_star", 1900},
+    {u"beginner", 1901},
+    {u"trident", 1902},
+    {u"black_square_button", 1903},
+    {u"white_square_button", 1904},
+    {u"red_circle", 1905},
+    {u"large_blue_circle", 1906},
+    {u"large_orange_diamond", 1907},
+    {u"large_blue_diamond", 1908},
+    {u"small_orange_diamond", 1909},
+    {u"small_blue_diamond", 1910},
+    {u"small_red_triangle", 1911},
+    {u"small_red_triangle_down", 1912},
+    {u"arrow_up_small", 1913},
+    {u"arrow_down_small", 1914},
+    {u"om_symbol", 1915},
+    {u"dove_of_peace", 1916},
+    {u"kaaba", 1917},
+    {u"mosque", 1918},
+    {u"synagogue", 1919},
+    {u"menorah_with_nine_branches", 1920},
+    {u"clock1", 1921},
+    {u"clock2", 1922},
+    {u"clock3", 1923},
+    {u"clock4", 1924},
+    {u"clock5", 1925},
+    {u"clock6", 1926},
+    {u"clock7", 1927},
+    {u"clock8", 1928},
+    {u"clock9", 1929},
+    {u"clock10", 1930},
+    {u"clock11", 1931},
+    {u"clock12", 1932},
+    {u"clock130", 1933},
+    {u"clock230", 1934},
+    {u"clock330", 1935},
+    {u"clock430", 1936},
+    {u"clock530", 1937},
+    {u"clock630", 1938},
+    {u"clock730", 1939},
+    {u"clock830", 1940},
+    {u"clock930", 1941},
+    {u"clock1030", 1942},
+    {u"clock1130", 1943},
+    {u"clock1230", 1944},
+    {u"candle", 1945},
+    {u"mantelpiece_clock", 1946},
+    {u"hole", 1947},
+    {u"man_in_business_suit_levitating", 1948},
+    {u"man_in_business_suit_levitating_tone1", 1949},
+    {u"man_in_business_suit_levitating_tone2", 1950},
+    {u"man_in_business_suit_levitating_tone3", 1951},
+    {u"man_in_business_suit_levitating_tone4", 1952},
+    {u"man_in_business_suit_levitating_tone5", 1953},
+    {u"female-detective", 1954},
+    {u"female-detective_tone1", 1955},
+    {u"female-detective_tone2", 1956},
+    {u"female-detective_tone3", 1957},
+    {u"female-detective_tone4", 1958},
+    {u"female-detective_tone5", 1959},
+    {u"male-detective", 1960},
+    {u"male-detective_tone1", 1961},
+    {u"male-detective_tone2", 1962},
+    {u"male-detective_tone3", 1963},
+    {u"male-detective_tone4", 1964},
+    {u"male-detective_tone5", 1965},
+    {u"sleuth_or_spy", 1966},
+    {u"sleuth_or_spy_tone1", 1967},
+    {u"sleuth_or_spy_tone2", 1968},
+    {u"sleuth_or_spy_tone3", 1969},
+    {u"sleuth_or_spy_tone4", 1970},
+    {u"sleuth_or_spy_tone5", 1971},
+    {u"dark_sunglasses", 1972},
+    {u"spider", 1973},
+    {u"spider_web", 1974},
+    {u"joystick", 1975},
+    {u"man_dancing", 1976},
+    {u"man_dancing_tone1", 1977},
+    {u"man_dancing_tone2", 1978},
+    {u"man_dancing_tone3", 1979},
+    {u"man_dancing_tone4", 1980},
+    {u"man_dancing_tone5", 1981},
+    {u"linked_paperclips", 1982},
+    {u"lower_left_ballpoint_pen", 1983},
+    {u"lower_left_fountain_pen", 1984},
+    {u"lower_left_paintbrush", 1985},
+    {u"lower_left_crayon", 1986},
+    {u"raised_hand_with_fingers_splayed", 1987},
+    {u"raised_hand_with_fingers_splayed_tone1", 1988},
+    {u"raised_hand_with_fingers_splayed_tone2", 1989},
+    {u"raised_hand_with_fingers_splayed_tone3", 1990},
+    {u"raised_hand_with_fingers_splayed_tone4", 1991},
+    {u"raised_hand_with_fingers_splayed_tone5", 1992},
+    {u"middle_finger", 1993},
+    {u"reversed_hand_with_middle_finger_extended", 1993},
+    {u"middle_finger_tone1", 1994},
+    {u"middle_finger_tone2", 1995},
+    {u"middle_finger_tone3", 1996},
+    {u"middle_finger_tone4", 1997},
+    {u"middle_finger_tone5", 1998},
+    {u"spock-hand", 1999},
+    {u"spock-hand_tone1", 2000},
+    {u"spock-hand_tone2", 2001},
+    {u"spock-hand_tone3", 2002},
+    {u"spock-hand_tone4", 2003},
+    {u"spock-hand_tone5", 2004},
+    {u"black_heart", 2005},
+    {u"desktop_computer", 2006},
+    {u"printer", 2007},
+    {u"three_button_mouse", 2008},
+    {u"trackball", 2009},
+    {u"frame_with_picture", 2010},
+    {u"card_index_dividers", 2011},
+    {u"card_file_box", 2012},
+    {u"file_cabinet", 2013},
+    {u"wastebasket", 2014},
+    {u"spiral_note_pad", 2015},
+    {u"spiral_calendar_pad", 2016},
+    {u"compression", 2017},
+    {u"old_key", 2018},
+    {u"rolled_up_newspaper", 2019},
+    {u"dagger_knife", 2020},
+    {u"speaking_head_in_silhouette", 2021},
+    {u"left_speech_bubble", 2022},
+    {u"right_anger_bubble", 2023},
+    {u"ballot_box_with_ballot", 2024},
+    {u"world_map", 2025},
+    {u"mount_fuji", 2026},
+    {u"tokyo_tower", 2027},
+    {u"statue_of_liberty", 2028},
+    {u"japan", 2029},
+    {u"moyai", 2030},
+    {u"grinning", 2031},
+    {u"grin", 2032},
+    {u"joy", 2033},
+    {u"smiley", 2034},
+    {u"smile", 2035},
+    {u"sweat_smile", 2036},
+    {u"laughing", 2037},
+    {u"satisfied", 2037},
+    {u"innocent", 2038},
+    {u"smiling_imp", 2039},
+    {u"wink", 2040},
+    {u"blush", 2041},
+    {u"yum", 2042},
+    {u"relieved", 2043},
+    {u"heart_eyes", 2044},
+    {u"sunglasses", 2045},
+    {u"smirk", 2046},
+    {u"neutral_face", 2047},
+    {u"expressionless", 2048},
+    {u"unamused", 2049},
+    {u"sweat", 2050},
+    {u"pensive", 2051},
+    {u"confused", 2052},
+    {u"confounded", 2053},
+    {u"kissing", 2054},
+    {u"kissing_heart", 2055},
+    {u"kissing_smiling_eyes", 2056},
+    {u"kissing_closed_eyes", 2057},
+    {u"stuck_out_tongue", 2058},
+    {u"stuck_out_tongue_winking_eye", 2059},
+    {u"stuck_out_tongue_closed_eyes", 2060},
+    {u"disappointed", 2061},
+    {u"worried", 2062},
+    {u"angry", 2063},
+    {u"rage", 2064},
+    {u"cry", 2065},
+    {u"persevere", 2066},
+    {u"triumph", 2067},
+    {u"disappointed_relieved", 2068},
+    {u"frowning", 2069},
+    {u"anguished", 2070},
+    {u"fearful", 2071},
+    {u"weary", 2072},
+    {u"sleepy", 2073},
+    {u"tired_face", 2074},
+    {u"grimacing", 2075},
+    {u"sob", 2076},
+    {u"face_exhaling", 2077},
+    {u"open_mouth", 2078},
+    {u"hushed", 2079},
+    {u"cold_sweat", 2080},
+    {u"scream", 2081},
+    {u"astonished", 2082},
+    {u"flushed", 2083},
+    {u"sleeping", 2084},
+    {u"face_with_spiral_eyes", 2085},
+    {u"dizzy_face", 2086},
+    {u"face_in_clouds", 2087},
+    {u"no_mouth", 2088},
+    {u"mask", 2089},
+    {u"smile_cat", 2090},
+    {u"joy_cat", 2091},
+    {u"smiley_cat", 2092},
+    {u"heart_eyes_cat", 2093},
+    {u"smirk_cat", 2094},
+    {u"kissing_cat", 2095},
+    {u"pouting_cat", 2096},
+    {u"crying_cat_face", 2097},
+    {u"scream_cat", 2098},
+    {u"slightly_frowning_face", 2099},
+    {u"head_shaking_horizontally", 2100},
+    {u"head_shaking_vertically", 2101},
+    {u"slightly_smiling_face", 2102},
+    {u"upside_down_face", 2103},
+    {u"face_with_rolling_eyes", 2104},
+    {u"woman-gesturing-no", 2105},
+    {u"woman-gesturing-no_tone1", 2106},
+    {u"woman-gesturing-no_tone2", 2107},
+    {u"woman-gesturing-no_tone3", 2108},
+    {u"woman-gesturing-no_tone4", 2109},
+    {u"woman-gesturing-no_tone5", 2110},
+    {u"man-gesturing-no", 2111},
+    {u"man-gesturing-no_tone1", 2112},
+    {u"man-gesturing-no_tone2", 2113},
+    {u"man-gesturing-no_tone3", 2114},
+    {u"man-gesturing-no_tone4", 2115},
+    {u"man-gesturing-no_tone5", 2116},
+    {u"no_good", 2117},
+    {u"no_good_tone1", 2118},
+    {u"no_good_tone2", 2119},
+    {u"no_good_tone3", 2120},
+    {u"no_good_tone4", 2121},
+    {u"no_good_tone5", 2122},
+    {u"woman-gesturing-ok", 2123},
+    {u"woman-gesturing-ok_tone1", 2124},
+    {u"woman-gesturing-ok_tone2", 2125},
+    {u"woman-gesturing-ok_tone3", 2126},
+    {u"woman-gesturing-ok_tone4", 2127},
+    {u"woman-gesturing-ok_tone5", 2128},
+    {u"man-gesturing-ok", 2129},
+    {u"man-gesturing-ok_tone1", 2130},
+    {u"man-gesturing-ok_tone2", 2131},
+    {u"man-gesturing-ok_tone3", 2132},
+    {u"man-gesturing-ok_tone4", 2133},
+    {u"man-gesturing-ok_tone5", 2134},
+    {u"ok_woman", 2135},
+    {u"ok_woman_tone1", 2136},
+    {u"ok_woman_tone2", 2137},
+    {u"ok_woman_tone3", 2138},
+    {u"ok_woman_tone4", 2139},
+    {u"ok_woman_tone5", 2140},
+    {u"woman-bowing", 2141},
+    {u"woman-bowing_tone1", 2142},
+    {u"woman-bowing_tone2", 2143},
+    {u"woman-bowing_tone3", 2144},
+    {u"woman-bowing_tone4", 2145},
+    {u"woman-bowing_tone5", 2146},
+    {u"man-bowing", 2147},
+    {u"man-bowing_tone1", 2148},
+    {u"man-bowing_tone2", 2149},
+    {u"man-bowing_tone3", 2150},
+    {u"man-bowing_tone4", 2151},
+    {u"man-bowing_tone5", 2152},
+    {u"bow", 2153},
+    {u"bow_tone1", 2154},
+    {u"bow_tone2", 2155},
+    {u"bow_tone3", 2156},
+    {u"bow_tone4", 2157},
+    {u"bow_tone5", 2158},
+    {u"see_no_evil", 2159},
+    {u"hear_no_evil", 2160},
+    {u"speak_no_evil", 2161},
+    {u"woman-raising-hand", 2162},
+    {u"woman-raising-hand_tone1", 2163},
+    {u"woman-raising-hand_tone2", 2164},
+    {u"woman-raising-hand_tone3", 2165},
+    {u"woman-raising-hand_tone4", 2166},
+    {u"woman-raising-hand_tone5", 2167},
+    {u"man-raising-hand", 2168},
+    {u"man-raising-hand_tone1", 2169},
+    {u"man-raising-hand_tone2", 2170},
+    {u"man-raising-hand_tone3", 2171},
+    {u"man-raising-hand_tone4", 2172},
+    {u"man-raising-hand_tone5", 2173},
+    {u"raising_hand", 2174},
+    {u"raising_hand_tone1", 2175},
+    {u"raising_hand_tone2", 2176},
+    {u"raising_hand_tone3", 2177},
+    {u"raising_hand_tone4", 2178},
+    {u"raising_hand_tone5", 2179},
+    {u"raised_hands", 2180},
+    {u"raised_hands_tone1", 2181},
+    {u"raised_hands_tone2", 2182},
+    {u"raised_hands_tone3", 2183},
+    {u"raised_hands_tone4", 2184},
+    {u"raised_hands_tone5", 2185},
+    {u"woman-frowning", 2186},
+    {u"woman-frowning_tone1", 2187},
+    {u"woman-frowning_tone2", 2188},
+    {u"woman-frowning_tone3", 2189},
+    {u"woman-frowning_tone4", 2190},
+    {u"woman-frowning_tone5", 2191},
+    {u"man-frowning", 2192},
+    {u"man-frowning_tone1", 2193},
+    {u"man-frowning_tone2", 2194},
+    {u"man-frowning_tone3", 2195},
+    {u"man-frowning_tone4", 2196},
+    {u"man-frowning_tone5", 2197},
+    {u"person_frowning", 2198},
+    {u"person_frowning_tone1", 2199},
+    {u"person_frowning_tone2", 2200},
+    {u"person_frowning_tone3", 2201},
+    {u"person_frowning_tone4", 2202},
+    {u"person_frowning_tone5", 2203},
+    {u"woman-pouting", 2204},
+    {u"woman-pouting_tone1", 2205},
+    {u"woman-pouting_tone2", 2206},
+    {u"woman-pouting_tone3", 2207},
+    {u"woman-pouting_tone4", 2208},
+    {u"woman-pouting_tone5", 2209},
+    {u"man-pouting", 2210},
+    {u"man-pouting_tone1", 2211},
+    {u"man-pouting_tone2", 2212},
+    {u"man-pouting_tone3", 2213},
+    {u"man-pouting_tone4", 2214},
+    {u"man-pouting_tone5", 2215},
+    {u"person_with_pouting_face", 2216},
+    {u"person_with_pouting_face_tone1", 2217},
+    {u"person_with_pouting_face_tone2", 2218},
+    {u"person_with_pouting_face_tone3", 2219},
+    {u"person_with_pouting_face_tone4", 2220},
+    {u"person_with_pouting_face_tone5", 2221},
+    {u"pray", 2222},
+    {u"pray_tone1", 2223},
+    {u"pray_tone2", 2224},
+    {u"pray_tone3", 2225},
+    {u"pray_tone4", 2226},
+    {u"pray_tone5", 2227},
+    {u"rocket", 2228},
+    {u"helicopter", 2229},
+    {u"steam_locomotive", 2230},
+    {u"railway_car", 2231},
+    {u"bullettrain_side", 2232},
+    {u"bullettrain_front", 2233},
+    {u"train2", 2234},
+    {u"metro", 2235},
+    {u"light_rail", 2236},
+    {u"station", 2237},
+    {u"tram", 2238},
+    {u"train", 2239},
+    {u"bus", 2240},
+    {u"oncoming_bus", 2241},
+    {u"trolleybus", 2242},
+    {u"busstop", 2243},
+    {u"minibus", 2244},
+    {u"ambulance", 2245},
+    {u"fire_engine", 2246},
+    {u"police_car", 2247},
+    {u"oncoming_police_car", 2248},
+    {u"taxi", 2249},
+    {u"oncoming_taxi", 2250},
+    {u"car", 2251},
+    {u"red_car", 2251},
+    {u"oncoming_automobile", 2252},
+    {u"blue_car", 2253},
+    {u"truck", 2254},
+    {u"articulated_lorry", 2255},
+    {u"tractor", 2256},
+    {u"monorail", 2257},
+    {u"mountain_railway", 2258},
+    {u"suspension_railway", 2259},
+    {u"mountain_cableway", 2260},
+    {u"aerial_tramway", 2261},
+    {u"ship", 2262},
+    {u"woman-rowing-boat", 2263},
+    {u"woman-rowing-boat_tone1", 2264},
+    {u"woman-rowing-boat_tone2", 2265},
+    {u"woman-rowing-boat_tone3", 2266},
+    {u"woman-rowing-boat_tone4", 2267},
+    {u"woman-rowing-boat_tone5", 2268},
+    {u"man-rowing-boat", 2269},
+    {u"man-rowing-boat_tone1", 2270},
+    {u"man-rowing-boat_tone2", 2271},
+    {u"man-rowing-boat_tone3", 2272},
+    {u"man-rowing-boat_tone4", 2273},
+    {u"man-rowing-boat_tone5", 2274},
+    {u"rowboat", 2275},
+    {u"rowboat_tone1", 2276},
+    {u"rowboat_tone2", 2277},
+    {u"rowboat_tone3", 2278},
+    {u"rowboat_tone4", 2279},
+    {u"rowboat_tone5", 2280},
+    {u"speedboat", 2281},
+    {u"traffic_light", 2282},
+    {u"vertical_traffic_light", 2283},
+    {u"construction", 2284},
+    {u"rotating_light", 2285},
+    {u"triangular_flag_on_post", 2286},
+    {u"door", 2287},
+    {u"no_entry_sign", 2288},
+    {u"smoking", 2289},
+    {u"no_smoking", 2290},
+    {u"put_litter_in_its_place", 2291},
+    {u"do_not_litter", 2292},
+    {u"potable_water", 2293},
+    {u"non-potable_water", 2294},
+    {u"bike", 2295},
+    {u"no_bicycles", 2296},
+    {u"woman-biking", 2297},
+    {u"woman-biking_tone1", 2298},
+    {u"woman-biking_tone2", 2299},
+    {u"woman-biking_tone3", 2300},
+    {u"woman-biking_tone4", 2301},
+    {u"woman-biking_tone5", 2302},
+    {u"man-biking", 2303},
+    {u"man-biking_tone1", 2304},
+    {u"man-biking_tone2", 2305},
+    {u"man-biking_tone3", 2306},
+    {u"man-biking_tone4", 2307},
+    {u"man-biking_tone5", 2308},
+    {u"bicyclist", 2309},
+    {u"bicyclist_tone1", 2310},
+    {u"bicyclist_tone2", 2311},
+    {u"bicyclist_tone3", 2312},
+    {u"bicyclist_tone4", 2313},
+    {u"bicyclist_tone5", 2314},
+    {u"woman-mountain-biking", 2315},
+    {u"woman-mountain-biking_tone1", 2316},
+    {u"woman-mountain-biking_tone2", 2317},
+    {u"woman-mountain-biking_tone3", 2318},
+    {u"woman-mountain-biking_tone4", 2319},
+    {u"woman-mountain-biking_tone5", 2320},
+    {u"man-mountain-biking", 2321},
+    {u"man-mountain-biking_tone1", 2322},
+    {u"man-mountain-biking_tone2", 2323},
+    {u"man-mountain-biking_tone3", 2324},
+    {u"man-mountain-biking_tone4", 2325},
+    {u"man-mountain-biking_tone5", 2326},
+    {u"mountain_bicyclist", 2327},
+    {u"mountain_bicyclist_tone1", 2328},
+    {u"mountain_bicyclist_tone2", 2329},
+    {u"mountain_bicyclist_tone3", 2330},
+    {u"mountain_bicyclist_tone4", 2331},
+    {u"mountain_bicyclist_tone5", 2332},
+    {u"woman-walking", 2333},
+    {u"woman-walking_tone1", 2334},
+    {u"woman-walking_tone2", 2335},
+    {u"woman-walking_tone3", 2336},
+    {u"woman-walking_tone4", 2337},
+    {u"woman-walking_tone5", 2338},
+    {u"woman_walking_facing_right", 2339},
+    {u"woman_walking_facing_right_tone1", 2340},
+    {u"woman_walking_facing_right_tone2", 2341},
+    {u"woman_walking_facing_right_tone3", 2342},
+    {u"woman_walking_facing_right_tone4", 2343},
+    {u"woman_walking_facing_right_tone5", 2344},
+    {u"man-walking", 2345},
+    {u"man-walking_tone1", 2346},
+    {u"man-walking_tone2", 2347},
+    {u"man-walking_tone3", 2348},
+    {u"man-walking_tone4", 2349},
+    {u"man-walking_tone5", 2350},
+    {u"man_walking_facing_right", 2351},
+    {u"man_walking_facing_right_tone1", 2352},
+    {u"man_walking_facing_right_tone2", 2353},
+    {u"man_walking_facing_right_tone3", 2354},
+    {u"man_walking_facing_right_tone4", 2355},
+    {u"man_walking_facing_right_tone5", 2356},
+    {u"person_walking_facing_right", 2357},
+    {u"person_walking_facing_right_tone1", 2358},
+    {u"person_walking_facing_right_tone2", 2359},
+    {u"person_walking_facing_right_tone3", 2360},
+    {u"person_walking_facing_right_tone4", 2361},
+    {u"person_walking_facing_right_tone5", 2362},
+    {u"walking", 2363},
+    {u"walking_tone1", 2364},
+    {u"walking_tone2", 2365},
+    {u"walking_tone3", 2366},
+    {u"walking_tone4", 2367},
+    {u"walking_tone5", 2368},
+    {u"no_pedestrians", 2369},
+    {u"children_crossing", 2370},
+    {u"mens", 2371},
+    {u"womens", 2372},
+    {u"restroom", 2373},
+    {u"baby_symbol", 2374},
+    {u"toilet", 2375},
+    {u"wc", 2376},
+    {u"shower", 2377},
+    {u"bath", 2378},
+    {u"bath_tone1", 2379},
+    {u"bath_tone2", 2380},
+    {u"bath_tone3", 2381},
+    {u"bath_tone4", 2382},
+    {u"bath_tone5", 2383},
+    {u"bathtub", 2384},
+    {u"passport_control", 2385},
+    {u"customs", 2386},
+    {u"baggage_claim", 2387},
+    {u"left_luggage", 2388},
+    {u"couch_and_lamp", 2389},
+    {u"sleeping_accommodation", 2390},
+    {u"sleeping_accommodation_tone1", 2391},
+    {u"sleeping_accommodation_tone2", 2392},
+    {u"sleeping_accommodation_tone3", 2393},
+    {u"sleeping_accommodation_tone4", 2394},
+    {u"sleeping_accommodation_tone5", 2395},
+    {u"shopping_bags", 2396},
+    {u"bellhop_bell", 2397},
+    {u"bed", 2398},
+    {u"place_of_worship", 2399},
+    {u"octagonal_sign", 2400},
+    {u"shopping_trolley", 2401},
+    {u"hindu_temple", 2402},
+    {u"hut", 2403},
+    {u"elevator", 2404},
+    {u"wireless", 2405},
+    {u"playground_slide", 2406},
+    {u"wheel", 2407},
+    {u"ring_buoy", 2408},
+    {u"hammer_and_wrench", 2409},
+    {u"shield", 2410},
+    {u"oil_drum", 2411},
+    {u"motorway", 2412},
+    {u"railway_track", 2413},
+    {u"motor_boat", 2414},
+    {u"small_airplane", 2415},
+    {u"airplane_departure", 2416},
+    {u"airplane_arriving", 2417},
+    {u"satellite", 2418},
+    {u"passenger_ship", 2419},
+    {u"scooter", 2420},
+    {u"motor_scooter", 2421},
+    {u"canoe", 2422},
+    {u"sled", 2423},
+    {u"flying_saucer", 2424},
+    {u"skateboard", 2425},
+    {u"auto_rickshaw", 2426},
+    {u"pickup_truck", 2427},
+    {u"roller_skate", 2428},
+    {u"large_orange_circle", 2429},
+    {u"large_yellow_circle", 2430},
+    {u"large_green_circle", 2431},
+    {u"large_purple_circle", 2432},
+    {u"large_brown_circle", 2433},
+    {u"large_red_square", 2434},
+    {u"large_blue_square", 2435},
+    {u"large_orange_square", 2436},
+    {u"large_yellow_square", 2437},
+    {u"large_green_square", 2438},
+    {u"large_purple_square", 2439},
+    {u"large_brown_square", 2440},
+    {u"heavy_equals_sign", 2441},
+    {u"pinched_fingers", 2442},
+    {u"pinched_fingers_tone1", 2443},
+    {u"pinched_fingers_tone2", 2444},
+    {u"pinched_fingers_tone3", 2445},
+    {u"pinched_fingers_tone4", 2446},
+    {u"pinched_fingers_tone5", 2447},
+    {u"white_heart", 2448},
+    {u"brown_heart", 2449},
+    {u"pinching_hand", 2450},
+    {u"pinching_hand_tone1", 2451},
+    {u"pinching_hand_tone2", 2452},
+    {u"pinching_hand_tone3", 2453},
+    {u"pinching_hand_tone4", 2454},
+    {u"pinching_hand_tone5", 2455},
+    {u"zipper_mouth_face", 2456},
+    {u"money_mouth_face", 2457},
+    {u"face_with_thermometer", 2458},
+    {u"nerd_face", 2459},
+    {u"thinking_face", 2460},
+    {u"face_with_head_bandage", 2461},
+    {u"robot_face", 2462},
+    {u"hugging_face", 2463},
+    {u"the_horns", 2464},
+    {u"sign_of_the_horns", 2464},
+    {u"the_horns_tone1", 2465},
+    {u"the_horns_tone2", 2466},
+    {u"the_horns_tone3", 2467},
+    {u"the_horns_tone4", 2468},
+    {u"the_horns_tone5", 2469},
+    {u"call_me_hand", 2470},
+    {u"call_me_hand_tone1", 2471},
+    {u"call_me_hand_tone2", 2472},
+    {u"call_me_hand_tone3", 2473},
+    {u"call_me_hand_tone4", 2474},
+    {u"call_me_hand_tone5", 2475},
+    {u"raised_back_of_hand", 2476},
+    {u"raised_back_of_hand_tone1", 2477},
+    {u"raised_back_of_hand_tone2", 2478},
+    {u"raised_back_of_hand_tone3", 2479},
+    {u"raised_back_of_hand_tone4", 2480},
+    {u"raised_back_of_hand_tone5", 2481},
+    {u"left-facing_fist", 2482},
+    {u"left-facing_fist_tone1", 2483},
+    {u"left-facing_fist_tone2", 2484},
+    {u"left-facing_fist_tone3", 2485},
+    {u"left-facing_fist_tone4", 2486},
+    {u"left-facing_fist_tone5", 2487},
+    {u"right-facing_fist", 2488},
+    {u"right-facing_fist_tone1", 2489},
+    {u"right-facing_fist_tone2", 2490},
+    {u"right-facing_fist_tone3", 2491},
+    {u"right-facing_fist_tone4", 2492},
+    {u"right-facing_fist_tone5", 2493},
+    {u"handshake", 2494},
+    {u"handshake_tone1", 2495},
+    {u"handshake_tone2", 2496},
+    {u"handshake_tone3", 2497},
+    {u"handshake_tone4", 2498},
+    {u"handshake_tone5", 2499},
+    {u"handshake_tone1-tone2", 2500},
+    {u"handshake_tone1-tone3", 2501},
+    {u"handshake_tone1-tone4", 2502},
+    {u"handshake_tone1-tone5", 2503},
+    {u"handshake_tone2-tone1", 2504},
+    {u"handshake_tone2-tone3", 2505},
+    {u"handshake_tone2-tone4", 2506},
+    {u"handshake_tone2-tone5", 2507},
+    {u"handshake_tone3-tone1", 2508},
+    {u"handshake_tone3-tone2", 2509},
+    {u"handshake_tone3-tone4", 2510},
+    {u"handshake_tone3-tone5", 2511},
+    {u"handshake_tone4-tone1", 2512},
+    {u"handshake_tone4-tone2", 2513},
+    {u"handshake_tone4-tone3", 2514},
+    {u"handshake_tone4-tone5", 2515},
+    {u"handshake_tone5-tone1", 2516},
+    {u"handshake_tone5-tone2", 2517},
+    {u"handshake_tone5-tone3", 2518},
+    {u"handshake_tone5-tone4", 2519},
+    {u"crossed_fingers", 2520},
+    {u"hand_with_index_and_middle_fingers_crossed", 2520},
+    {u"crossed_fingers_tone1", 2521},
+    {u"crossed_fingers_tone2", 2522},
+    {u"crossed_fingers_tone3", 2523},
+    {u"crossed_fingers_tone4", 2524},
+    {u"crossed_fingers_tone5", 2525},
+    {u"i_love_you_hand_sign", 2526},
+    {u"i_love_you_hand_sign_tone1", 2527},
+    {u"i_love_you_hand_sign_tone2", 2528},
+    {u"i_love_you_hand_sign_tone3", 2529},
+    {u"i_love_you_hand_sign_tone4", 2530},
+    {u"i_love_you_hand_sign_tone5", 2531},
+    {u"face_with_cowboy_hat", 2532},
+    {u"clown_face", 2533},
+    {u"nauseated_face", 2534},
+    {u"rolling_on_the_floor_laughing", 2535},
+    {u"drooling_face", 2536},
+    {u"lying_face", 2537},
+    {u"woman-facepalming", 2538},
+    {u"woman-facepalming_tone1", 2539},
+    {u"woman-facepalming_tone2", 2540},
+    {u"woman-facepalming_tone3", 2541},
+    {u"woman-facepalming_tone4", 2542},
+    {u"woman-facepalming_tone5", 2543},
+    {u"man-facepalming", 2544},
+    {u"man-facepalming_tone1", 2545},
+    {u"man-facepalming_tone2", 2546},
+    {u"man-facepalming_tone3", 2547},
+    {u"man-facepalming_tone4", 2548},
+    {u"man-facepalming_tone5", 2549},
+    {u"face_palm", 2550},
+    {u"face_palm_tone1", 2551},
+    {u"face_palm_tone2", 2552},
+    {u"face_palm_tone3", 2553},
+    {u"face_palm_tone4", 2554},
+    {u"face_palm_tone5", 2555},
+    {u"sneezing_face", 2556},
+    {u"face_with_raised_eyebrow", 2557},
+    {u"face_with_one_eyebrow_raised", 2557},
+    {u"star-struck", 2558},
+    {u"grinning_face_with_star_eyes", 2558},
+    {u"zany_face", 2559},
+    {u"grinning_face_with_one_large_and_one_small_eye", 2559},
+    {u"shushing_face", 2560},
+    {u"face_with_finger_covering_closed_lips", 2560},
+    {u"face_with_symbols_on_mouth", 2561},
+    {u"serious_face_with_symbols_covering_mouth", 2561},
+    {u"face_with_hand_over_mouth", 2562},
+    {u"smiling_face_with_smiling_eyes_and_hand_covering_mouth", 2562},
+    {u"face_vomiting", 2563},
+    {u"face_with_open_mouth_vomiting", 2563},
+    {u"exploding_head", 2564},
+    {u"shocked_face_with_exploding_head", 2564},
+    {u"pregnant_woman", 2565},
+    {u"pregnant_woman_tone1", 2566},
+    {u"pregnant_woman_tone2", 2567},
+    {u"pregnant_woman_tone3", 2568},
+    {u"pregnant_woman_tone4", 2569},
+    {u"pregnant_woman_tone5", 2570},
+    {u"breast-feeding", 2571},
+    {u"breast-feeding_tone1", 2572},
+    {u"breast-feeding_tone2", 2573},
+    {u"breast-feeding_tone3", 2574},
+    {u"breast-feeding_tone4", 2575},
+    {u"breast-feeding_tone5", 2576},
+    {u"palms_up_together", 2577},
+    {u"palms_up_together_tone1", 2578},
+    {u"palms_up_together_tone2", 2579},
+    {u"palms_up_together_tone3", 2580},
+    {u"palms_up_together_tone4", 2581},
+    {u"palms_up_together_tone5", 2582},
+    {u"selfie", 2583},
+    {u"selfie_tone1", 2584},
+    {u"selfie_tone2", 2585},
+    {u"selfie_tone3", 2586},
+    {u"selfie_tone4", 2587},
+    {u"selfie_tone5", 2588},
+    {u"prince", 2589},
+    {u"prince_tone1", 2590},
+    {u"prince_tone2", 2591},
+    {u"prince_tone3", 2592},
+    {u"prince_tone4", 2593},
+    {u"prince_tone5", 2594},
+    {u"woman_in_tuxedo", 2595},
+    {u"woman_in_tuxedo_tone1", 2596},
+    {u"woman_in_tuxedo_tone2", 2597},
+    {u"woman_in_tuxedo_tone3", 2598},
+    {u"woman_in_tuxedo_tone4", 2599},
+    {u"woman_in_tuxedo_tone5", 2600},
+    {u"man_in_tuxedo", 2601},
+    {u"man_in_tuxedo_tone1", 2602},
+    {u"man_in_tuxedo_tone2", 2603},
+    {u"man_in_tuxedo_tone3", 2604},
+    {u"man_in_tuxedo_tone4", 2605},
+    {u"man_in_tuxedo_tone5", 2606},
+    {u"person_in_tuxedo", 2607},
+    {u"person_in_tuxedo_tone1", 2608},
+    {u"person_in_tuxedo_tone2", 2609},
+    {u"person_in_tuxedo_tone3", 2610},
+    {u"person_in_tuxedo_tone4", 2611},
+    {u"person_in_tuxedo_tone5", 2612},
+    {u"mrs_claus", 2613},
+    {u"mother_christmas", 2613},
+    {u"mrs_claus_tone1", 2614},
+    {u"mrs_claus_tone2", 2615},
+    {u"mrs_claus_tone3", 2616},
+    {u"mrs_claus_tone4", 2617},
+    {u"mrs_claus_tone5", 2618},
+    {u"woman-shrugging", 2619},
+    {u"woman-shrugging_tone1", 2620},
+    {u"woman-shrugging_tone2", 2621},
+    {u"woman-shrugging_tone3", 2622},
+    {u"woman-shrugging_tone4", 2623},
+    {u"woman-shrugging_tone5", 2624},
+    {u"man-shrugging", 2625},
+    {u"man-shrugging_tone1", 2626},
+    {u"man-shrugging_tone2", 2627},
+    {u"man-shrugging_tone3", 2628},
+    {u"man-shrugging_tone4", 2629},
+    {u"man-shrugging_tone5", 2630},
+    {u"shrug", 2631},
+    {u"shrug_tone1", 2632},
+    {u"shrug_tone2", 2633},
+    {u"shrug_tone3", 2634},
+    {u"shrug_tone4", 2635},
+    {u"shrug_tone5", 2636},
+    {u"woman-cartwheeling", 2637},
+    {u"woman-cartwheeling_tone1", 2638},
+    {u"woman-cartwheeling_tone2", 2639},
+    {u"woman-cartwheeling_tone3", 2640},
+    {u"woman-cartwheeling_tone4", 2641},
+    {u"woman-cartwheeling_tone5", 2642},
+    {u"man-cartwheeling", 2643},
+    {u"man-cartwheeling_tone1", 2644},
+    {u"man-cartwheeling_tone2", 2645},
+    {u"man-cartwheeling_tone3", 2646},
+    {u"man-cartwheeling_tone4", 2647},
+    {u"man-cartwheeling_tone5", 2648},
+    {u"person_doing_cartwheel", 2649},
+    {u"person_doing_cartwheel_tone1", 2650},
+    {u"person_doing_cartwheel_tone2", 2651},
+    {u"person_doing_cartwheel_tone3", 2652},
+    {u"person_doing_cartwheel_tone4", 2653},
+    {u"person_doing_cartwheel_tone5", 2654},
+    {u"woman-juggling", 2655},
+    {u"woman-juggling_tone1", 2656},
+    {u"woman-juggling_tone2", 2657},
+    {u"woman-juggling_tone3", 2658},
+    {u"woman-juggling_tone4", 2659},
+    {u"woman-juggling_tone5", 2660},
+    {u"man-juggling", 2661},
+    {u"man-juggling_tone1", 2662},
+    {u"man-juggling_tone2", 2663},
+    {u"man-juggling_tone3", 2664},
+    {u"man-juggling_tone4", 2665},
+    {u"man-juggling_tone5", 2666},
+    {u"juggling", 2667},
+    {u"juggling_tone1", 2668},
+    {u"juggling_tone2", 2669},
+    {u"juggling_tone3", 2670},
+    {u"juggling_tone4", 2671},
+    {u"juggling_tone5", 2672},
+    {u"fencer", 2673},
+    {u"woman-wrestling", 2674},
+    {u"man-wrestling", 2675},
+    {u"wrestlers", 2676},
+    {u"woman-playing-water-polo", 2677},
+    {u"woman-playing-water-polo_tone1", 2678},
+    {u"woman-playing-water-polo_tone2", 2679},
+    {u"woman-playing-water-polo_tone3", 2680},
+    {u"woman-playing-water-polo_tone4", 2681},
+    {u"woman-playing-water-polo_tone5", 2682},
+    {u"man-playing-water-polo", 2683},
+    {u"man-playing-water-polo_tone1", 2684},
+    {u"man-playing-water-polo_tone2", 2685},
+    {u"man-playing-water-polo_tone3", 2686},
+    {u"man-playing-water-polo_tone4", 2687},
+    {u"man-playing-water-polo_tone5", 2688},
+    {u"water_polo", 2689},
+    {u"water_polo_tone1", 2690},
+    {u"water_polo_tone2", 2691},
+    {u"water_polo_tone3", 2692},
+    {u"water_polo_tone4", 2693},
+    {u"water_polo_tone5", 2694},
+    {u"woman-playing-handball", 2695},
+    {u"woman-playing-handball_tone1", 2696},
+    {u"woman-playing-handball_tone2", 2697},
+    {u"woman-playing-handball_tone3", 2698},
+    {u"woman-playing-handball_tone4", 2699},
+    {u"woman-playing-handball_tone5", 2700},
+    {u"man-playing-handball", 2701},
+    {u"man-playing-handball_tone1", 2702},
+    {u"man-playing-handball_tone2", 2703},
+    {u"man-playing-handball_tone3", 2704},
+    {u"man-playing-handball_tone4", 2705},
+    {u"man-playing-handball_tone5", 2706},
+    {u"handball", 2707},
+    {u"handball_tone1", 2708},
+    {u"handball_tone2", 2709},
+    {u"handball_tone3", 2710},
+    {u"handball_tone4", 2711},
+    {u"handball_tone5", 2712},
+    {u"diving_mask", 2713},
+    {u"wilted_flower", 2714},
+    {u"drum_with_drumsticks", 2715},
+    {u"clinking_glasses", 2716},
+    {u"tumbler_glass", 2717},
+    {u"spoon", 2718},
+    {u"goal_net", 2719},
+    {u"first_place_medal", 2720},
+    {u"second_place_medal", 2721},
+    {u"third_place_medal", 2722},
+    {u"boxing_glove", 2723},
+    {u"martial_arts_uniform", 2724},
+    {u"curling_stone", 2725},
+    {u"lacrosse", 2726},
+    {u"softball", 2727},
+    {u"flying_disc", 2728},
+    {u"croissant", 2729},
+    {u"avocado", 2730},
+    {u"cucumber", 2731},
+    {u"bacon", 2732},
+    {u"potato", 2733},
+    {u"carrot", 2734},
+    {u"baguette_bread", 2735},
+    {u"green_salad", 2736},
+    {u"shallow_pan_of_food", 2737},
+    {u"stuffed_flatbread", 2738},
+    {u"egg", 2739},
+    {u"glass_of_milk", 2740},
+    {u"peanuts", 2741},
+    {u"kiwifruit", 2742},
+    {u"pancakes", 2743},
+    {u"dumpling", 2744},
+    {u"fortune_cookie", 2745},
+    {u"takeout_box", 2746},
+    {u"chopsticks", 2747},
+    {u"bowl_with_spoon", 2748},
+    {u"cup_with_straw", 2749},
+    {u"coconut", 2750},
+    {u"broccoli", 2751},
+    {u"pie", 2752},
+    {u"pretzel", 2753},
+    {u"cut_of_meat", 2754},
+    {u"sandwich", 2755},
+    {u"canned_food", 2756},
+    {u"leafy_green", 2757},
+    {u"mango", 2758},
+    {u"moon_cake", 2759},
+    {u"bagel", 2760},
+    {u"smiling_face_with_3_hearts", 2761},
+    {u"yawning_face", 2762},
+    {u"smiling_face_with_tear", 2763},
+    {u"partying_face", 2764},
+    {u"woozy_face", 2765},
+    {u"hot_face", 2766},
+    {u"cold_face", 2767},
+    {u"ninja", 2768},
+    {u"ninja_tone1", 2769},
+    {u"ninja_tone2", 2770},
+    {u"ninja_tone3", 2771},
+    {u"ninja_tone4", 2772},
+    {u"ninja_tone5", 2773},
+    {u"disguised_face", 2774},
+    {u"face_holding_back_tears", 2775},
+    {u"pleading_face", 2776},
+    {u"sari", 2777},
+    {u"lab_coat", 2778},
+    {u"goggles", 2779},
+    {u"hiking_boot", 2780},
+    {u"womans_flat_shoe", 2781},
+    {u"crab", 2782},
+    {u"lion_face", 2783},
+    {u"scorpion", 2784},
+    {u"turkey", 2785},
+    {u"unicorn_face", 2786},
+    {u"eagle", 2787},
+    {u"duck", 2788},
+    {u"bat", 2789},
+    {u"shark", 2790},
+    {u"owl", 2791},
+    {u"fox_face", 2792},
+    {u"butterfly", 2793},
+    {u"deer", 2794},
+    {u"gorilla", 2795},
+    {u"lizard", 2796},
+    {u"rhinoceros", 2797},
+    {u"shrimp", 2798},
+    {u"squid", 2799},
+    {u"giraffe_face", 2800},
+    {u"zebra_face", 2801},
+    {u"hedgehog", 2802},
+    {u"sauropod", 2803},
+    {u"t-rex", 2804},
+    {u"cricket", 2805},
+    {u"kangaroo", 2806},
+    {u"llama", 2807},
+    {u"peacock", 2808},
+    {u"hippopotamus", 2809},
+    {u"parrot", 2810},
+    {u"raccoon", 2811},
+    {u"lobster", 2812},
+    {u"mosquito", 2813},
+    {u"microbe", 2814},
+    {u"badger", 2815},
+    {u"swan", 2816},
+    {u"mammoth", 2817},
+    {u"dodo", 2818},
+    {u"sloth", 2819},
+    {u"otter", 2820},
+    {u"orangutan", 2821},
+    {u"skunk", 2822},
+    {u"flamingo", 2823},
+    {u"oyster", 2824},
+    {u"beaver", 2825},
+    {u"bison", 2826},
+    {u"seal", 2827},
+    {u"guide_dog", 2828},
+    {u"probing_cane", 2829},
+    {u"bone", 2830},
+    {u"leg", 2831},
+    {u"leg_tone1", 2832},
+    {u"leg_tone2", 2833},
+    {u"leg_tone3", 2834},
+    {u"leg_tone4", 2835},
+    {u"leg_tone5", 2836},
+    {u"foot", 2837},
+    {u"foot_tone1", 2838},
+    {u"foot_tone2", 2839},
+    {u"foot_tone3", 2840},
+    {u"foot_tone4", 2841},
+    {u"foot_tone5", 2842},
+    {u"tooth", 2843},
+    {u"female_superhero", 2844},
+    {u"female_superhero_tone1", 2845},
+    {u"female_superhero_tone2", 2846},
+    {u"female_superhero_tone3", 2847},
+    {u"female_superhero_tone4", 2848},
+    {u"female_superhero_tone5", 2849},
+    {u"male_superhero", 2850},
+    {u"male_superhero_tone1", 2851},
+    {u"male_superhero_tone2", 2852},
+    {u"male_superhero_tone3", 2853},
+    {u"male_superhero_tone4", 2854},
+    {u"male_superhero_tone5", 2855},
+    {u"superhero", 2856},
+    {u"superhero_tone1", 2857},
+    {u"superhero_tone2", 2858},
+    {u"superhero_tone3", 2859},
+    {u"superhero_tone4", 2860},
+    {u"superhero_tone5", 2861},
+    {u"female_supervillain", 2862},
+    {u"female_supervillain_tone1", 2863},
+    {u"female_supervillain_tone2", 2864},
+    {u"female_supervillain_tone3", 2865},
+    {u"female_supervillain_tone4", 2866},
+    {u"female_supervillain_tone5", 2867},
+    {u"male_supervillain", 2868},
+    {u"male_supervillain_tone1", 2869},
+    {u"male_supervillain_tone2", 2870},
+    {u"male_supervillain_tone3", 2871},
+    {u"male_supervillain_tone4", 2872},
+    {u"male_supervillain_tone5", 2873},
+    {u"supervillain", 2874},
+    {u"supervillain_tone1", 2875},
+    {u"supervillain_tone2", 2876},
+    {u"supervillain_tone3", 2877},
+    {u"supervillain_tone4", 2878},
+    {u"supervillain_tone5", 2879},
+    {u"safety_vest", 2880},
+    {u"ear_with_hearing_aid", 2881},
+    {u"ear_with_hearing_aid_tone1", 2882},
+    {u"ear_with_hearing_aid_tone2", 2883},
+    {u"ear_with_hearing_aid_tone3", 2884},
+    {u"ear_with_hearing_aid_tone4", 2885},
+    {u"ear_with_hearing_aid_tone5", 2886},
+    {u"motorized_wheelchair", 2887},
+    {u"manual_wheelchair", 2888},
+    {u"mechanical_arm", 2889},
+    {u"mechanical_leg", 2890},
+    {u"cheese_wedge", 2891},
+    {u"cupcake", 2892},
+    {u"salt", 2893},
+    {u"beverage_box", 2894},
+    {u"garlic", 2895},
+    {u"onion", 2896},
+    {u"falafel", 2897},
+    {u"waffle", 2898},
+    {u"butter", 2899},
+    {u"mate_drink", 2900},
+    {u"ice_cube", 2901},
+    {u"bubble_tea", 2902},
+    {u"troll", 2903},
+    {u"woman_standing", 2904},
+    {u"woman_standing_tone1", 2905},
+    {u"woman_standing_tone2", 2906},
+    {u"woman_standing_tone3", 2907},
+    {u"woman_standing_tone4", 2908},
+    {u"woman_standing_tone5", 2909},
+    {u"man_standing", 2910},
+    {u"man_standing_tone1", 2911},
+    {u"man_standing_tone2", 2912},
+    {u"man_standing_tone3", 2913},
+    {u"man_standing_tone4", 2914},
+    {u"man_standing_tone5", 2915},
+    {u"standing_person", 2916},
+    {u"standing_person_tone1", 2917},
+    {u"standing_person_tone2", 2918},
+    {u"standing_person_tone3", 2919},
+    {u"standing_person_tone4", 2920},
+    {u"standing_person_tone5", 2921},
+    {u"woman_kneeling", 2922},
+    {u"woman_kneeling_tone1", 2923},
+    {u"woman_kneeling_tone2", 2924},
+    {u"woman_kneeling_tone3", 2925},
+    {u"woman_kneeling_tone4", 2926},
+    {u"woman_kneeling_tone5", 2927},
+    {u"woman_kneeling_facing_right", 2928},
+    {u"woman_kneeling_facing_right_tone1", 2929},
+    {u"woman_kneeling_facing_right_tone2", 2930},
+    {u"woman_kneeling_facing_right_tone3", 2931},
+    {u"woman_kneeling_facing_right_tone4", 2932},
+    {u"woman_kneeling_facing_right_tone5", 2933},
+    {u"man_kneeling", 2934},
+    {u"man_kneeling_tone1", 2935},
+    {u"man_kneeling_tone2", 2936},
+    {u"man_kneeling_tone3", 2937},
+    {u"man_kneeling_tone4", 2938},
+    {u"man_kneeling_tone5", 2939},
+    {u"man_kneeling_facing_right", 2940},
+    {u"man_kneeling_facing_right_tone1", 2941},
+    {u"man_kneeling_facing_right_tone2", 2942},
+    {u"man_kneeling_facing_right_tone3", 2943},
+    {u"man_kneeling_facing_right_tone4", 2944},
+    {u"man_kneeling_facing_right_tone5", 2945},
+    {u"person_kneeling_facing_right", 2946},
+    {u"person_kneeling_facing_right_tone1", 2947},
+    {u"person_kneeling_facing_right_tone2", 2948},
+    {u"person_kneeling_facing_right_tone3", 2949},
+    {u"person_kneeling_facing_right_tone4", 2950},
+    {u"person_kneeling_facing_right_tone5", 2951},
+    {u"kneeling_person", 2952},
+    {u"kneeling_person_tone1", 2953},
+    {u"kneeling_person_tone2", 2954},
+    {u"kneeling_person_tone3", 2955},
+    {u"kneeling_person_tone4", 2956},
+    {u"kneeling_person_tone5", 2957},
+    {u"deaf_woman", 2958},
+    {u"deaf_woman_tone1", 2959},
+    {u"deaf_woman_tone2", 2960},
+    {u"deaf_woman_tone3", 2961},
+    {u"deaf_woman_tone4", 2962},
+    {u"deaf_woman_tone5", 2963},
+    {u"deaf_man", 2964},
+    {u"deaf_man_tone1", 2965},
+    {u"deaf_man_tone2", 2966},
+    {u"deaf_man_tone3", 2967},
+    {u"deaf_man_tone4", 2968},
+    {u"deaf_man_tone5", 2969},
+    {u"deaf_person", 2970},
+    {u"deaf_person_tone1", 2971},
+    {u"deaf_person_tone2", 2972},
+    {u"deaf_person_tone3", 2973},
+    {u"deaf_person_tone4", 2974},
+    {u"deaf_person_tone5", 2975},
+    {u"face_with_monocle", 2976},
+    {u"farmer", 2977},
+    {u"farmer_tone1", 2978},
+    {u"farmer_tone2", 2979},
+    {u"farmer_tone3", 2980},
+    {u"farmer_tone4", 2981},
+    {u"farmer_tone5", 2982},
+    {u"cook", 2983},
+    {u"cook_tone1", 2984},
+    {u"cook_tone2", 2985},
+    {u"cook_tone3", 2986},
+    {u"cook_tone4", 2987},
+    {u"cook_tone5", 2988},
+    {u"person_feeding_baby", 2989},
+    {u"person_feeding_baby_tone1", 2990},
+    {u"person_feeding_baby_tone2", 2991},
+    {u"person_feeding_baby_tone3", 2992},
+    {u"person_feeding_baby_tone4", 2993},
+    {u"person_feeding_baby_tone5", 2994},
+    {u"mx_claus", 2995},
+    {u"mx_claus_tone1", 2996},
+    {u"mx_claus_tone2", 2997},
+    {u"mx_claus_tone3", 2998},
+    {u"mx_claus_tone4", 2999},
+    {u"mx_claus_tone5", 3000},
+    {u"student", 3001},
+    {u"student_tone1", 3002},
+    {u"student_tone2", 3003},
+    {u"student_tone3", 3004},
+    {u"student_tone4", 3005},
+    {u"student_tone5", 3006},
+    {u"singer", 3007},
+    {u"singer_tone1", 3008},
+    {u"singer_tone2", 3009},
+    {u"singer_tone3", 3010},
+    {u"singer_tone4", 3011},
+    {u"singer_tone5", 3012},
+    {u"artist", 3013},
+    {u"artist_tone1", 3014},
+    {u"artist_tone2", 3015},
+    {u"artist_tone3", 3016},
+    {u"artist_tone4", 3017},
+    {u"artist_tone5", 3018},
+    {u"teacher", 3019},
+    {u"teacher_tone1", 3020},
+    {u"teacher_tone2", 3021},
+    {u"teacher_tone3", 3022},
+    {u"teacher_tone4", 3023},
+    {u"teacher_tone5", 3024},
+    {u"factory_worker", 3025},
+    {u"factory_worker_tone1", 3026},
+    {u"factory_worker_tone2", 3027},
+    {u"factory_worker_tone3", 3028},
+    {u"factory_worker_tone4", 3029},
+    {u"factory_worker_tone5", 3030},
+    {u"technologist", 3031},
+    {u"technologist_tone1", 3032},
+    {u"technologist_tone2", 3033},
+    {u"technologist_tone3", 3034},
+    {u"technologist_tone4", 3035},
+    {u"technologist_tone5", 3036},
+    {u"office_worker", 3037},
+    {u"office_worker_tone1", 3038},
+    {u"office_worker_tone2", 3039},
+    {u"office_worker_tone3", 3040},
+    {u"office_worker_tone4", 3041},
+    {u"office_worker_tone5", 3042},
+    {u"mechanic", 3043},
+    {u"mechanic_tone1", 3044},
+    {u"mechanic_tone2", 3045},
+    {u"mechanic_tone3", 3046},
+    {u"mechanic_tone4", 3047},
+    {u"mechanic_tone5", 3048},
+    {u"scientist", 3049},
+    {u"scientist_tone1", 3050},
+    {u"scientist_tone2", 3051},
+    {u"scientist_tone3", 3052},
+    {u"scientist_tone4", 3053},
+    {u"scientist_tone5", 3054},
+    {u"astronaut", 3055},
+    {u"astronaut_tone1", 3056},
+    {u"astronaut_tone2", 3057},
+    {u"astronaut_tone3", 3058},
+    {u"astronaut_tone4", 3059},
+    {u"astronaut_tone5", 3060},
+    {u"firefighter", 3061},
+    {u"firefighter_tone1", 3062},
+    {u"firefighter_tone2", 3063},
+    {u"firefighter_tone3", 3064},
+    {u"firefighter_tone4", 3065},
+    {u"firefighter_tone5", 3066},
+    {u"people_holding_hands", 3067},
+    {u"people_holding_hands_tone1-tone1", 3068},
+    {u"people_holding_hands_tone1-tone2", 3069},
+    {u"people_holding_hands_tone1-tone3", 3070},
+    {u"people_holding_hands_tone1-tone4", 3071},
+    {u"people_holding_hands_tone1-tone5", 3072},
+    {u"people_holding_hands_tone2-tone1", 3073},
+    {u"people_holding_hands_tone2-tone2", 3074},
+    {u"people_holding_hands_tone2-tone3", 3075},
+    {u"people_holding_hands_tone2-tone4", 3076},
+    {u"people_holding_hands_tone2-tone5", 3077},
+    {u"people_holding_hands_tone3-tone1", 3078},
+    {u"people_holding_hands_tone3-tone2", 3079},
+    {u"people_holding_hands_tone3-tone3", 3080},
+    {u"people_holding_hands_tone3-tone4", 3081},
+    {u"people_holding_hands_tone3-tone5", 3082},
+    {u"people_holding_hands_tone4-tone1", 3083},
+    {u"people_holding_hands_tone4-tone2", 3084},
+    {u"people_holding_hands_tone4-tone3", 3085},
+    {u"people_holding_hands_tone4-tone4", 3086},
+    {u"people_holding_hands_tone4-tone5", 3087},
+    {u"people_holding_hands_tone5-tone1", 3088},
+    {u"people_holding_hands_tone5-tone2", 3089},
+    {u"people_holding_hands_tone5-tone3", 3090},
+    {u"people_holding_hands_tone5-tone4", 3091},
+    {u"people_holding_hands_tone5-tone5", 3092},
+    {u"person_with_white_cane_facing_right", 3093},
+    {u"person_with_white_cane_facing_right_tone1", 3094},
+    {u"person_with_white_cane_facing_right_tone2", 3095},
+    {u"person_with_white_cane_facing_right_tone3", 3096},
+    {u"person_with_white_cane_facing_right_tone4", 3097},
+    {u"person_with_white_cane_facing_right_tone5", 3098},
+    {u"person_with_probing_cane", 3099},
+    {u"person_with_probing_cane_tone1", 3100},
+    {u"person_with_probing_cane_tone2", 3101},
+    {u"person_with_probing_cane_tone3", 3102},
+    {u"person_with_probing_cane_tone4", 3103},
+    {u"person_with_probing_cane_tone5", 3104},
+    {u"red_haired_person", 3105},
+    {u"red_haired_person_tone1", 3106},
+    {u"red_haired_person_tone2", 3107},
+    {u"red_haired_person_tone3", 3108},
+    {u"red_haired_person_tone4", 3109},
+    {u"red_haired_person_tone5", 3110},
+    {u"curly_haired_person", 3111},
+    {u"curly_haired_person_tone1", 3112},
+    {u"curly_haired_person_tone2", 3113},
+    {u"curly_haired_person_tone3", 3114},
+    {u"curly_haired_person_tone4", 3115},
+    {u"curly_haired_person_tone5", 3116},
+    {u"bald_person", 3117},
+    {u"bald_person_tone1", 3118},
+    {u"bald_person_tone2", 3119},
+    {u"bald_person_tone3", 3120},
+    {u"bald_person_tone4", 3121},
+    {u"bald_person_tone5", 3122},
+    {u"white_haired_person", 3123},
+    {u"white_haired_person_tone1", 3124},
+    {u"white_haired_person_tone2", 3125},
+    {u"white_haired_person_tone3", 3126},
+    {u"white_haired_person_tone4", 3127},
+    {u"white_haired_person_tone5", 3128},
+    {u"person_in_motorized_wheelchair_facing_right", 3129},
+    {u"person_in_motorized_wheelchair_facing_right_tone1", 3130},
+    {u"person_in_motorized_wheelchair_facing_right_tone2", 3131},
+    {u"person_in_motorized_wheelchair_facing_right_tone3", 3132},
+    {u"person_in_motorized_wheelchair_facing_right_tone4", 3133},
+    {u"person_in_motorized_wheelchair_facing_right_tone5", 3134},
+    {u"person_in_motorized_wheelchair", 3135},
+    {u"person_in_motorized_wheelchair_tone1", 3136},
+    {u"person_in_motorized_wheelchair_tone2", 3137},
+    {u"person_in_motorized_wheelchair_tone3", 3138},
+    {u"person_in_motorized_wheelchair_tone4", 3139},
+    {u"person_in_motorized_wheelchair_tone5", 3140},
+    {u"person_in_manual_wheelchair_facing_right", 3141},
+    {u"person_in_manual_wheelchair_facing_right_tone1", 3142},
+    {u"person_in_manual_wheelchair_facing_right_tone2", 3143},
+    {u"person_in_manual_wheelchair_facing_right_tone3", 3144},
+    {u"person_in_manual_wheelchair_facing_right_tone4", 3145},
+    {u"person_in_manual_wheelchair_facing_right_tone5", 3146},
+    {u"person_in_manual_wheelchair", 3147},
+    {u"person_in_manual_wheelchair_tone1", 3148},
+    {u"person_in_manual_wheelchair_tone2", 3149},
+    {u"person_in_manual_wheelchair_tone3", 3150},
+    {u"person_in_manual_wheelchair_tone4", 3151},
+    {u"person_in_manual_wheelchair_tone5", 3152},
+    {u"family_adult_adult_child", 3153},
+    {u"family_adult_adult_child_child", 3154},
+    {u"family_adult_child_child", 3155},
+    {u"family_adult_child", 3156},
+    {u"health_worker", 3157},
+    {u"health_worker_tone1", 3158},
+    {u"health_worker_tone2", 3159},
+    {u"health_worker_tone3", 3160},
+    {u"health_worker_tone4", 3161},
+    {u"health_worker_tone5", 3162},
+    {u"judge", 3163},
+    {u"judge_tone1", 3164},
+    {u"judge_tone2", 3165},
+    {u"judge_tone3", 3166},
+    {u"judge_tone4", 3167},
+    {u"judge_tone5", 3168},
+    {u"pilot", 3169},
+    {u"pilot_tone1", 3170},
+    {u"pilot_tone2", 3171},
+    {u"pilot_tone3", 3172},
+    {u"pilot_tone4", 3173},
+    {u"pilot_tone5", 3174},
+    {u"adult", 3175},
+    {u"adult_tone1", 3176},
+    {u"adult_tone2", 3177},
+    {u"adult_tone3", 3178},
+    {u"adult_tone4", 3179},
+    {u"adult_tone5", 3180},
+    {u"child", 3181},
+    {u"child_tone1", 3182},
+    {u"child_tone2", 3183},
+    {u"child_tone3", 3184},
+    {u"child_tone4", 3185},
+    {u"child_tone5", 3186},
+    {u"older_adult", 3187},
+    {u"older_adult_tone1", 3188},
+    {u"older_adult_tone2", 3189},
+    {u"older_adult_tone3", 3190},
+    {u"older_adult_tone4", 3191},
+    {u"older_adult_tone5", 3192},
+    {u"woman_with_beard", 3193},
+    {u"woman_with_beard_tone1", 3194},
+    {u"woman_with_beard_tone2", 3195},
+    {u"woman_with_beard_tone3", 3196},
+    {u"woman_with_beard_tone4", 3197},
+    {u"woman_with_beard_tone5", 3198},
+    {u"man_with_beard", 3199},
+    {u"man_with_beard_tone1", 3200},
+    {u"man_with_beard_tone2", 3201},
+    {u"man_with_beard_tone3", 3202},
+    {u"man_with_beard_tone4", 3203},
+    {u"man_with_beard_tone5", 3204},
+    {u"bearded_person", 3205},
+    {u"bearded_person_tone1", 3206},
+    {u"bearded_person_tone2", 3207},
+    {u"bearded_person_tone3", 3208},
+    {u"bearded_person_tone4", 3209},
+    {u"bearded_person_tone5", 3210},
+    {u"person_with_headscarf", 3211},
+    {u"person_with_headscarf_tone1", 3212},
+    {u"person_with_headscarf_tone2", 3213},
+    {u"person_with_headscarf_tone3", 3214},
+    {u"person_with_headscarf_tone4", 3215},
+    {u"person_with_headscarf_tone5", 3216},
+    {u"woman_in_steamy_room", 3217},
+    {u"woman_in_steamy_room_tone1", 3218},
+    {u"woman_in_steamy_room_tone2", 3219},
+    {u"woman_in_steamy_room_tone3", 3220},
+    {u"woman_in_steamy_room_tone4", 3221},
+    {u"woman_in_steamy_room_tone5", 3222},
+    {u"man_in_steamy_room", 3223},
+    {u"man_in_steamy_room_tone1", 3224},
+    {u"man_in_steamy_room_tone2", 3225},
+    {u"man_in_steamy_room_tone3", 3226},
+    {u"man_in_steamy_room_tone4", 3227},
+    {u"man_in_steamy_room_tone5", 3228},
+    {u"person_in_steamy_room", 3229},
+    {u"person_in_steamy_room_tone1", 3230},
+    {u"person_in_steamy_room_tone2", 3231},
+    {u"person_in_steamy_room_tone3", 3232},
+    {u"person_in_steamy_room_tone4", 3233},
+    {u"person_in_steamy_room_tone5", 3234},
+    {u"woman_climbing", 3235},
+    {u"woman_climbing_tone1", 3236},
+    {u"woman_climbing_tone2", 3237},
+    {u"woman_climbing_tone3", 3238},
+    {u"woman_climbing_tone4", 3239},
+    {u"woman_climbing_tone5", 3240},
+    {u"man_climbing", 3241},
+    {u"man_climbing_tone1", 3242},
+    {u"man_climbing_tone2", 3243},
+    {u"man_climbing_tone3", 3244},
+    {u"man_climbing_tone4", 3245},
+    {u"man_climbing_tone5", 3246},
+    {u"person_climbing", 3247},
+    {u"person_climbing_tone1", 3248},
+    {u"person_climbing_tone2", 3249},
+    {u"person_climbing_tone3", 3250},
+    {u"person_climbing_tone4", 3251},
+    {u"person_climbing_tone5", 3252},
+    {u"woman_in_lotus_position", 3253},
+    {u"woman_in_lotus_position_tone1", 3254},
+    {u"woman_in_lotus_position_tone2", 3255},
+    {u"woman_in_lotus_position_tone3", 3256},
+    {u"woman_in_lotus_position_tone4", 3257},
+    {u"woman_in_lotus_position_tone5", 3258},
+    {u"man_in_lotus_position", 3259},
+    {u"man_in_lotus_position_tone1", 3260},
+    {u"man_in_lotus_position_tone2", 3261},
+    {u"man_in_lotus_position_tone3", 3262},
+    {u"man_in_lotus_position_tone4", 3263},
+    {u"man_in_lotus_position_tone5", 3264},
+    {u"person_in_lotus_position", 3265},
+    {u"person_in_lotus_position_tone1", 3266},
+    {u"person_in_lotus_position_tone2", 3267},
+    {u"person_in_lotus_position_tone3", 3268},
+    {u"person_in_lotus_position_tone4", 3269},
+    {u"person_in_lotus_position_tone5", 3270},
+    {u"female_mage", 3271},
+    {u"female_mage_tone1", 3272},
+    {u"female_mage_tone2", 3273},
+    {u"female_mage_tone3", 3274},
+    {u"female_mage_tone4", 3275},
+    {u"female_mage_tone5", 3276},
+    {u"male_mage", 3277},
+    {u"male_mage_tone1", 3278},
+    {u"male_mage_tone2", 3279},
+    {u"male_mage_tone3", 3280},
+    {u"male_mage_tone4", 3281},
+    {u"male_mage_tone5", 3282},
+    {u"mage", 3283},
+    {u"mage_tone1", 3284},
+    {u"mage_tone2", 3285},
+    {u"mage_tone3", 3286},
+    {u"mage_tone4", 3287},
+    {u"mage_tone5", 3288},
+    {u"female_fairy", 3289},
+    {u"female_fairy_tone1", 3290},
+    {u"female_fairy_tone2", 3291},
+    {u"female_fairy_tone3", 3292},
+    {u"female_fairy_tone4", 3293},
+    {u"female_fairy_tone5", 3294},
+    {u"male_fairy", 3295},
+    {u"male_fairy_tone1", 3296},
+    {u"male_fairy_tone2", 3297},
+    {u"male_fairy_tone3", 3298},
+    {u"male_fairy_tone4", 3299},
+    {u"male_fairy_tone5", 3300},
+    {u"fairy", 3301},
+    {u"fairy_tone1", 3302},
+    {u"fairy_tone2", 3303},
+    {u"fairy_tone3", 3304},
+    {u"fairy_tone4", 3305},
+    {u"fairy_tone5", 3306},
+    {u"female_vampire", 3307},
+    {u"female_vampire_tone1", 3308},
+    {u"female_vampire_tone2", 3309},
+    {u"female_vampire_tone3", 3310},
+    {u"female_vampire_tone4", 3311},
+    {u"female_vampire_tone5", 3312},
+    {u"male_vampire", 3313},
+    {u"male_vampire_tone1", 3314},
+    {u"male_vampire_tone2", 3315},
+    {u"male_vampire_tone3", 3316},
+    {u"male_vampire_tone4", 3317},
+    {u"male_vampire_tone5", 3318},
+    {u"vampire", 3319},
+    {u"vampire_tone1", 3320},
+    {u"vampire_tone2", 3321},
+    {u"vampire_tone3", 3322},
+    {u"vampire_tone4", 3323},
+    {u"vampire_tone5", 3324},
+    {u"mermaid", 3325},
+    {u"mermaid_tone1", 3326},
+    {u"mermaid_tone2", 3327},
+    {u"mermaid_tone3", 3328},
+    {u"mermaid_tone4", 3329},
+    {u"mermaid_tone5", 3330},
+    {u"merman", 3331},
+    {u"merman_tone1", 3332},
+    {u"merman_tone2", 3333},
+    {u"merman_tone3", 3334},
+    {u"merman_tone4", 3335},
+    {u"merman_tone5", 3336},
+    {u"merperson", 3337},
+    {u"merperson_tone1", 3338},
+    {u"merperson_tone2", 3339},
+    {u"merperson_tone3", 3340},
+    {u"merperson_tone4", 3341},
+    {u"merperson_tone5", 3342},
+    {u"female_elf", 3343},
+    {u"female_elf_tone1", 3344},
+    {u"female_elf_tone2", 3345},
+    {u"female_elf_tone3", 3346},
+    {u"female_elf_tone4", 3347},
+    {u"female_elf_tone5", 3348},
+    {u"male_elf", 3349},
+    {u"male_elf_tone1", 3350},
+    {u"male_elf_tone2", 3351},
+    {u"male_elf_tone3", 3352},
+    {u"male_elf_tone4", 3353},
+    {u"male_elf_tone5", 3354},
+    {u"elf", 3355},
+    {u"elf_tone1", 3356},
+    {u"elf_tone2", 3357},
+    {u"elf_tone3", 3358},
+    {u"elf_tone4", 3359},
+    {u"elf_tone5", 3360},
+    {u"female_genie", 3361},
+    {u"male_genie", 3362},
+    {u"genie", 3363},
+    {u"female_zombie", 3364},
+    {u"male_zombie", 3365},
+    {u"zombie", 3366},
+    {u"brain", 3367},
+    {u"orange_heart", 3368},
+    {u"billed_cap", 3369},
+    {u"scarf", 3370},
+    {u"gloves", 3371},
+    {u"coat", 3372},
+    {u"socks", 3373},
+    {u"red_envelope", 3374},
+    {u"firecracker", 3375},
+    {u"jigsaw", 3376},
+    {u"test_tube", 3377},
+    {u"petri_dish", 3378},
+    {u"dna", 3379},
+    {u"compass", 3380},
+    {u"abacus", 3381},
+    {u"fire_extinguisher", 3382},
+    {u"toolbox", 3383},
+    {u"bricks", 3384},
+    {u"magnet", 3385},
+    {u"luggage", 3386},
+    {u"lotion_bottle", 3387},
+    {u"thread", 3388},
+    {u"yarn", 3389},
+    {u"safety_pin", 3390},
+    {u"teddy_bear", 3391},
+    {u"broom", 3392},
+    {u"basket", 3393},
+    {u"roll_of_paper", 3394},
+    {u"soap", 3395},
+    {u"sponge", 3396},
+    {u"receipt", 3397},
+    {u"nazar_amulet", 3398},
+    {u"ballet_shoes", 3399},
+    {u"one-piece_swimsuit", 3400},
+    {u"briefs", 3401},
+    {u"shorts", 3402},
+    {u"thong_sandal", 3403},
+    {u"light_blue_heart", 3404},
+    {u"grey_heart", 3405},
+    {u"pink_heart", 3406},
+    {u"drop_of_blood", 3407},
+    {u"adhesive_bandage", 3408},
+    {u"stethoscope", 3409},
+    {u"x-ray", 3410},
+    {u"crutch", 3411},
+    {u"yo-yo", 3412},
+    {u"kite", 3413},
+    {u"parachute", 3414},
+    {u"boomerang", 3415},
+    {u"magic_wand", 3416},
+    {u"pinata", 3417},
+    {u"nesting_dolls", 3418},
+    {u"maracas", 3419},
+    {u"flute", 3420},
+    {u"harp", 3421},
+    {u"shovel", 3422},
+    {u"ringed_planet", 3423},
+    {u"chair", 3424},
+    {u"razor", 3425},
+    {u"axe", 3426},
+    {u"diya_lamp", 3427},
+    {u"banjo", 3428},
+    {u"military_helmet", 3429},
+    {u"accordion", 3430},
+    {u"long_drum", 3431},
+    {u"coin", 3432},
+    {u"carpentry_saw", 3433},
+    {u"screwdriver", 3434},
+    {u"ladder", 3435},
+    {u"hook", 3436},
+    {u"mirror", 3437},
+    {u"window", 3438},
+    {u"plunger", 3439},
+    {u"sewing_needle", 3440},
+    {u"knot", 3441},
+    {u"bucket", 3442},
+    {u"mouse_trap", 3443},
+    {u"toothbrush", 3444},
+    {u"headstone", 3445},
+    {u"placard", 3446},
+    {u"rock", 3447},
+    {u"mirror_ball", 3448},
+    {u"identification_card", 3449},
+    {u"low_battery", 3450},
+    {u"hamsa", 3451},
+    {u"folding_hand_fan", 3452},
+    {u"hair_pick", 3453},
+    {u"khanda", 3454},
+    {u"fly", 3455},
+    {u"worm", 3456},
+    {u"beetle", 3457},
+    {u"cockroach", 3458},
+    {u"potted_plant", 3459},
+    {u"wood", 3460},
+    {u"feather", 3461},
+    {u"lotus", 3462},
+    {u"coral", 3463},
+    {u"empty_nest", 3464},
+    {u"nest_with_eggs", 3465},
+    {u"hyacinth", 3466},
+    {u"jellyfish", 3467},
+    {u"wing", 3468},
+    {u"leafless_tree", 3469},
+    {u"goose", 3470},
+    {u"anatomical_heart", 3471},
+    {u"lungs", 3472},
+    {u"people_hugging", 3473},
+    {u"pregnant_man", 3474},
+    {u"pregnant_man_tone1", 3475},
+    {u"pregnant_man_tone2", 3476},
+    {u"pregnant_man_tone3", 3477},
+    {u"pregnant_man_tone4", 3478},
+    {u"pregnant_man_tone5", 3479},
+    {u"pregnant_person", 3480},
+    {u"pregnant_person_tone1", 3481},
+    {u"pregnant_person_tone2", 3482},
+    {u"pregnant_person_tone3", 3483},
+    {u"pregnant_person_tone4", 3484},
+    {u"pregnant_person_tone5", 3485},
+    {u"person_with_crown", 3486},
+    {u"person_with_crown_tone1", 3487},
+    {u"person_with_crown_tone2", 3488},
+    {u"person_with_crown_tone3", 3489},
+    {u"person_with_crown_tone4", 3490},
+    {u"person_with_crown_tone5", 3491},
+    {u"fingerprint", 3492},
+    {u"moose", 3493},
+    {u"donkey", 3494},
+    {u"blueberries", 3495},
+    {u"bell_pepper", 3496},
+    {u"olive", 3497},
+    {u"flatbread", 3498},
+    {u"tamale", 3499},
+    {u"fondue", 3500},
+    {u"teapot", 3501},
+    {u"pouring_liquid", 3502},
+    {u"beans", 3503},
+    {u"jar", 3504},
+    {u"ginger_root", 3505},
+    {u"pea_pod", 3506},
+    {u"root_vegetable", 3507},
+    {u"splatter", 3508},
+    {u"melting_face", 3509},
+    {u"saluting_face", 3510},
+    {u"face_with_open_eyes_and_hand_over_mouth", 3511},
+    {u"face_with_peeking_eye", 3512},
+    {u"face_with_diagonal_mouth", 3513},
+    {u"dotted_line_face", 3514},
+    {u"biting_lip", 3515},
+    {u"bubbles", 3516},
+    {u"shaking_face", 3517},
+    {u"face_with_bags_under_eyes", 3518},
+    {u"hand_with_index_finger_and_thumb_crossed", 3519},
+    {u"hand_with_index_finger_and_thumb_crossed_tone1", 3520},
+    {u"hand_with_index_finger_and_thumb_crossed_tone2", 3521},
+    {u"hand_with_index_finger_and_thumb_crossed_tone3", 3522},
+    {u"hand_with_index_finger_and_thumb_crossed_tone4", 3523},
+    {u"hand_with_index_finger_and_thumb_crossed_tone5", 3524},
+    {u"rightwards_hand", 3525},
+    {u"rightwards_hand_tone1", 3526},
+    {u"rightwards_hand_tone2", 3527},
+    {u"rightwards_hand_tone3", 3528},
+    {u"rightwards_hand_tone4", 3529},
+    {u"rightwards_hand_tone5", 3530},
+    {u"leftwards_hand", 3531},
+    {u"leftwards_hand_tone1", 3532},
+    {u"leftwards_hand_tone2", 3533},
+    {u"leftwards_hand_tone3", 3534},
+    {u"leftwards_hand_tone4", 3535},
+    {u"leftwards_hand_tone5", 3536},
+    {u"palm_down_hand", 3537},
+    {u"palm_down_hand_tone1", 3538},
+    {u"palm_down_hand_tone2", 3539},
+    {u"palm_down_hand_tone3", 3540},
+    {u"palm_down_hand_tone4", 3541},
+    {u"palm_down_hand_tone5", 3542},
+    {u"palm_up_hand", 3543},
+    {u"palm_up_hand_tone1", 3544},
+    {u"palm_up_hand_tone2", 3545},
+    {u"palm_up_hand_tone3", 3546},
+    {u"palm_up_hand_tone4", 3547},
+    {u"palm_up_hand_tone5", 3548},
+    {u"index_pointing_at_the_viewer", 3549},
+    {u"index_pointing_at_the_viewer_tone1", 3550},
+    {u"index_pointing_at_the_viewer_tone2", 3551},
+    {u"index_pointing_at_the_viewer_tone3", 3552},
+    {u"index_pointing_at_the_viewer_tone4", 3553},
+    {u"index_pointing_at_the_viewer_tone5", 3554},
+    {u"heart_hands", 3555},
+    {u"heart_hands_tone1", 3556},
+    {u"heart_hands_tone2", 3557},
+    {u"heart_hands_tone3", 3558},
+    {u"heart_hands_tone4", 3559},
+    {u"heart_hands_tone5", 3560},
+    {u"leftwards_pushing_hand", 3561},
+    {u"leftwards_pushing_hand_tone1", 3562},
+    {u"leftwards_pushing_hand_tone2", 3563},
+    {u"leftwards_pushing_hand_tone3", 3564},
+    {u"leftwards_pushing_hand_tone4", 3565},
+    {u"leftwards_pushing_hand_tone5", 3566},
+    {u"rightwards_pushing_hand", 3567},
+    {u"rightwards_pushing_hand_tone1", 3568},
+    {u"rightwards_pushing_hand_tone2", 3569},
+    {u"rightwards_pushing_hand_tone3", 3570},
+    {u"rightwards_pushing_hand_tone4", 3571},
+    {u"rightwards_pushing_hand_tone5", 3572},
+    {u"bangbang", 3573},
+    {u"interrobang", 3574},
+    {u"tm", 3575},
+    {u"information_source", 3576},
+    {u"left_right_arrow", 3577},
+    {u"arrow_up_down", 3578},
+    {u"arrow_upper_left", 3579},
+    {u"arrow_upper_right", 3580},
+    {u"arrow_lower_right", 3581},
+    {u"arrow_lower_left", 3582},
+    {u"leftwards_arrow_with_hook", 3583},
+    {u"arrow_right_hook", 3584},
+    {u"watch", 3585},
+    {u"hourglass", 3586},
+    {u"keyboard", 3587},
+    {u"eject", 3588},
+    {u"fast_forward", 3589},
+    {u"rewind", 3590},
+    {u"arrow_double_up", 3591},
+    {u"arrow_double_down", 3592},
+    {u"black_right_pointing_double_triangle_with_vertical_bar", 3593},
+    {u"black_left_pointing_double_triangle_with_vertical_bar", 3594},
+    {u"black_right_pointing_triangle_with_double_vertical_bar", 3595},
+    {u"alarm_clock", 3596},
+    {u"stopwatch", 3597},
+    {u"timer_clock", 3598},
+    {u"hourglass_flowing_sand", 3599},
+    {u"double_vertical_bar", 3600},
+    {u"black_square_for_stop", 3601},
+    {u"black_circle_for_record", 3602},
+    {u"m", 3603},
+    {u"black_small_square", 3604},
+    {u"white_small_square", 3605},
+    {u"arrow_forward", 3606},
+    {u"arrow_backward", 3607},
+    {u"white_medium_square", 3608},
+    {u"black_medium_square", 3609},
+    {u"white_medium_small_square", 3610},
+    {u"black_medium_small_square", 3611},
+    {u"sunny", 3612},
+    {u"cloud", 3613},
+    {u"umbrella", 3614},
+    {u"snowman", 3615},
+    {u"comet", 3616},
+    {u"phone", 3617},
+    {u"telephone", 3617},
+    {u"ballot_box_with_check", 3618},
+    {u"umbrella_with_rain_drops", 3619},
+    {u"coffee", 3620},
+    {u"shamrock", 3621},
+    {u"point_up", 3622},
+    {u"point_up_tone1", 3623},
+    {u"point_up_tone2", 3624},
+    {u"point_up_tone3", 3625},
+    {u"point_up_tone4", 3626},
+    {u"point_up_tone5", 3627},
+    {u"skull_and_crossbones", 3628},
+    {u"radioactive_sign", 3629},
+    {u"biohazard_sign", 3630},
+    {u"orthodox_cross", 3631},
+    {u"star_and_crescent", 3632},
+    {u"peace_symbol", 3633},
+    {u"yin_yang", 3634},
+    {u"wheel_of_dharma", 3635},
+    {u"white_frowning_face", 3636},
+    {u"relaxed", 3637},
+    {u"female_sign", 3638},
+    {u"male_sign", 3639},
+    {u"aries", 3640},
+    {u"taurus", 3641},
+    {u"gemini", 3642},
+    {u"cancer", 3643},
+    {u"leo", 3644},
+    {u"virgo", 3645},
+    {u"libra", 3646},
+    {u"scorpius", 3647},
+    {u"sagittarius", 3648},
+    {u"capricorn", 3649},
+    {u"aquarius", 3650},
+    {u"pisces", 3651},
+    {u"chess_pawn", 3652},
+    {u"spades", 3653},
+    {u"clubs", 3654},
+    {u"hearts", 3655},
+    {u"diamonds", 3656},
+    {u"hotsprings", 3657},
+    {u"recycle", 3658},
+    {u"infinity", 3659},
+    {u"wheelchair", 3660},
+    {u"hammer_and_pick", 3661},
+    {u"anchor", 3662},
+    {u"crossed_swords", 3663},
+    {u"medical_symbol", 3664},
+    {u"staff_of_aesculapius", 3664},
+    {u"scales", 3665},
+    {u"alembic", 3666},
+    {u"gear", 3667},
+    {u"atom_symbol", 3668},
+    {u"fleur_de_lis", 3669},
+    {u"warning", 3670},
+    {u"zap", 3671},
+    {u"transgender_symbol", 3672},
+    {u"white_circle", 3673},
+    {u"black_circle", 3674},
+    {u"coffin", 3675},
+    {u"funeral_urn", 3676},
+    {u"soccer", 3677},
+    {u"baseball", 3678},
+    {u"snowman_without_snow", 3679},
+    {u"partly_sunny", 3680},
+    {u"thunder_cloud_and_rain", 3681},
+    {u"ophiuchus", 3682},
+    {u"pick", 3683},
+    {u"helmet_with_white_cross", 3684},
+    {u"broken_chain", 3685},
+    {u"chains", 3686},
+    {u"no_entry", 3687},
+    {u"shinto_shrine", 3688},
+    {u"church", 3689},
+    {u"mountain", 3690},
+    {u"umbrella_on_ground", 3691},
+    {u"fountain", 3692},
+    {u"golf", 3693},
+    {u"ferry", 3694},
+    {u"boat", 3695},
+    {u"sailboat", 3695},
+    {u"skier", 3696},
+    {u"ice_skate", 3697},
+    {u"woman-bouncing-ball", 3698},
+    {u"woman-bouncing-ball_tone1", 3699},
+    {u"woman-bouncing-ball_tone2", 3700},
+    {u"woman-bouncing-ball_tone3", 3701},
+    {u"woman-bouncing-ball_tone4", 3702},
+    {u"woman-bouncing-ball_tone5", 3703},
+    {u"man-bouncing-ball", 3704},
+    {u"man-bouncing-ball_tone1", 3705},
+    {u"man-bouncing-ball_tone2", 3706},
+    {u"man-bouncing-ball_tone3", 3707},
+    {u"man-bouncing-ball_tone4", 3708},
+    {u"man-bouncing-ball_tone5", 3709},
+    {u"person_with_ball", 3710},
+    {u"person_with_ball_tone1", 3711},
+    {u"person_with_ball_tone2", 3712},
+    {u"person_with_ball_tone3", 3713},
+    {u"person_with_ball_tone4", 3714},
+    {u"person_with_ball_tone5", 3715},
+    {u"tent", 3716},
+    {u"fuelpump", 3717},
+    {u"scissors", 3718},
+    {u"white_check_mark", 3719},
+    {u"airplane", 3720},
+    {u"email", 3721},
+    {u"envelope", 3721},
+    {u"fist", 3722},
+    {u"fist_tone1", 3723},
+    {u"fist_tone2", 3724},
+    {u"fist_tone3", 3725},
+    {u"fist_tone4", 3726},
+    {u"fist_tone5", 3727},
+    {u"hand", 3728},
+    {u"raised_hand", 3728},
+    {u"hand_tone1", 3729},
+    {u"hand_tone2", 3730},
+    {u"hand_tone3", 3731},
+    {u"hand_tone4", 3732},
+    {u"hand_tone5", 3733},
+    {u"v", 3734},
+    {u"v_tone1", 3735},
+    {u"v_tone2", 3736},
+    {u"v_tone3", 3737},
+    {u"v_tone4", 3738},
+    {u"v_tone5", 3739},
+    {u"writing_hand", 3740},
+    {u"writing_hand_tone1", 3741},
+    {u"writing_hand_tone2", 3742},
+    {u"writing_hand_tone3", 3743},
+    {u"writing_hand_tone4", 3744},
+    {u"writing_hand_tone5", 3745},
+    {u"pencil2", 3746},
+    {u"black_nib", 3747},
+    {u"heavy_check_mark", 3748},
+    {u"heavy_multiplication_x", 3749},
+    {u"latin_cross", 3750},
+    {u"star_of_david", 3751},
+    {u"sparkles", 3752},
+    {u"eight_spoked_asterisk", 3753},
+    {u"eight_pointed_black_star", 3754},
+    {u"snowflake", 3755},
+    {u"sparkle", 3756},
+    {u"x", 3757},
+    {u"negative_squared_cross_mark", 3758},
+    {u"question", 3759},
+    {u"grey_question", 3760},
+    {u"grey_exclamation", 3761},
+    {u"exclamation", 3762},
+    {u"heavy_exclamation_mark", 3762},
+    {u"heavy_heart_exclamation_mark_ornament", 3763},
+    {u"heart_on_fire", 3764},
+    {u"mending_heart", 3765},
+    {u"heart", 3766},
+    {u"heavy_plus_sign", 3767},
+    {u"heavy_minus_sign", 3768},
+    {u"heavy_division_sign", 3769},
+    {u"arrow_right", 3770},
+    {u"curly_loop", 3771},
+    {u"loop", 3772},
+    {u"arrow_heading_up", 3773},
+    {u"arrow_heading_down", 3774},
+    {u"arrow_left", 3775},
+    {u"arrow_up", 3776},
+    {u"arrow_down", 3777},
+    {u"black_large_square", 3778},
+    {u"white_large_square", 3779},
+    {u"star", 3780},
+    {u"o", 3781},
+    {u"wavy_dash", 3782},
+    {u"part_alternation_mark", 3783},
+    {u"congratulations", 3784},
+    {u"secret", 3785},
+};
+const size_t SHORT_CODE_COUNT = std::size(SHORT_CODES);
+
+const uint16_t SORTED_SHORT_CODES[] = {
+    830, 832, 833, 834, 835, 836, 837, 839, 840, 841, 842, 843,
+    1811, 1927, 500, 16, 20, 3436, 1929, 1926, 315, 3485, 3463, 482,
+    3230, 3231, 3232, 3233, 3234, 3235, 2305, 3778, 2461, 2460, 3651, 3723,
+    1625, 2288, 691, 3526, 3718, 1619, 1620, 1621, 1622, 1623, 1624, 1790,
+    2106, 2113, 727, 400, 3706, 3696, 3662, 3647, 3646, 3838, 1955, 3661,
+    3835, 3834, 3836, 3637, 3636, 3831, 3639, 3837, 3633, 1954, 3634, 3635,
+    1896, 1897, 491, 2299, 3068, 3069, 3070, 3071, 3072, 3073, 2125, 3110,
+    3111, 3112, 3113, 3114, 3115, 872, 668, 3725, 2470, 2785, 3481, 17,
+    1586, 447, 737, 2418, 1587, 1588, 1589, 1590, 1591, 1918, 2787, 2870,
+    689, 2815, 2431, 2790, 1014, 1015, 1016, 1017, 1018, 1019, 3172, 3173,
+    3174, 3175, 3176, 3177, 1244, 1245, 1246, 1247, 1248, 1249, 3454, 464,
+    2066, 3674, 469, 398, 3628, 3483, 667, 1838, 1714, 353, 3735, 3448,
+    515, 2844, 2422, 2423, 2424, 2425, 2426, 2427, 2428, 1904, 651, 3558,
+    764, 3260, 3261, 3262, 3263, 3264, 3265, 2880, 2442, 728, 445, 446,
+    3512, 1942, 1913, 3551, 2441, 435, 2949, 2353, 2354, 2355, 2356, 2357,
+    2358, 2339, 865, 3424, 3686, 741, 453, 2881, 3570, 740, 705, 3731,
+    3657, 2047, 15, 3839, 3649, 3666, 3664, 3807, 3648, 3650, 3659, 1944,
+    3656, 1538, 1539, 1540, 1541, 1542, 1543, 1532, 1533, 1534, 1535, 1536,
+    1537, 380, 734, 1853, 2297, 1781, 3550, 2084, 722, 3752, 1791, 2885,
+    1850, 1915, 1845, 1855, 1793, 3470, 875, 1747, 2196, 690, 2197, 2198,
+    2199, 2200, 2201, 2803, 502, 2778, 879, 880, 881, 882, 883, 884,
+    3422, 416, 2625, 2626, 2627, 2628, 2629, 2630, 3439, 1526, 1527, 1528,
+    1529, 1530, 1531, 325, 1824, 3456, 2806, 3742, 1776, 3447, 2493, 388,
+    2957, 3571, 3497, 726, 652, 1789, 2276, 2275, 367, 2283, 2286, 877,
+    878, 2954, 2848, 373, 434, 1834, 2515, 2516, 2517, 2518, 2519, 2520,
+    1880, 746, 1885, 1886, 650, 3699, 1986, 430, 2811, 2466, 1925, 3705,
+    2294, 2054, 1835, 2053, 483, 3488, 2789, 753, 706, 1827, 3743, 3479,
+    449, 1821, 1837, 1836, 516, 2946, 404, 376, 3708, 368, 718, 3236,
+    3237, 3238, 3239, 3240, 3241, 2414, 769, 429, 2802, 455, 3746, 489,
+    493, 323, 322, 654, 21, 844, 845, 846, 847, 848, 849, 495,
+    656, 2771, 1839, 1962, 1971, 1983, 1972, 1984, 1973, 1985, 1974, 1963,
+    1975, 1964, 1976, 1965, 1977, 1966, 1978, 1967, 1979, 1968, 1980, 1969,
+    1981, 1970, 1982, 1849, 1909, 318, 3668, 2579, 3710, 79, 3427, 3513,
+    443, 2805, 3676, 3732, 3487, 2822, 2123, 1794, 3671, 3435, 2059, 1823,
+    466, 2096, 2095, 3845, 2328, 1604, 1605, 1606, 1607, 1608, 1609, 480,
+    671, 3038, 3039, 3040, 3041, 3042, 3043, 428, 438, 22, 1503, 1504,
+    1505, 1506, 1507, 1508, 12, 3518, 381, 2433, 1411, 1748, 1749, 1754,
+    1755, 1756, 1757, 1750, 1758, 1759, 1760, 1761, 1751, 1762, 1763, 1764,
+    1765, 1752, 1766, 1767, 1768, 1769, 1753, 1770, 1771, 1772, 1773, 1721,
+    1722, 1727, 1728, 1729, 1730, 1723, 1731, 1732, 1733, 1734, 1724, 1735,
+    1736, 1737, 1738, 1725, 1739, 1740, 1741, 1742, 1726, 1743, 1744, 1745,
+    1746, 750, 701, 2837, 1815, 342, 2860, 644, 708, 2784, 2565, 2567,
+    2568, 2569, 2570, 2571, 468, 3719, 856, 3466, 2108, 2140, 1940, 2786,
+    2804, 2947, 1780, 2780, 1008, 1009, 1010, 1011, 1012, 1013, 3166, 3167,
+    3168, 3169, 3170, 3171, 1238, 1239, 1240, 1241, 1242, 1243, 3832, 1813,
+    413, 432, 2430, 2809, 316, 2062, 1665, 1666, 1667, 1668, 1669, 1670,
+    1513, 419, 2013, 498, 1797, 1833, 91, 3019, 3020, 3021, 3022, 3023,
+    3024, 3025, 3026, 3027, 3028, 3029, 3030, 3013, 3014, 3015, 3016, 3017,
+    3018, 371, 2849, 673, 655, 657, 658, 2048, 1788, 3712, 2104, 2111,
+    2829, 2768, 3482, 1807, 2129, 3434, 2336, 2873, 758, 720, 1817, 470,
+    747, 3549, 2331, 3569, 3655, 427, 1957, 707, 754, 863, 745, 2582,
+    3462, 1796, 2770, 2843, 2799, 1828, 1869, 2842, 773, 382, 774, 775,
+    776, 777, 778, 2936, 2937, 2938, 2939, 2940, 2941, 329, 330, 331,
+    2794, 391, 10, 3814, 3813, 3643, 1905, 723, 2448, 3410, 3411, 3412,
+    3413, 3414, 3415, 3779, 3519, 1919, 3780, 1871, 105, 1818, 678, 665,
+    370, 3822, 2617, 2091, 772, 771, 858, 770, 2120, 2830, 2130, 2596,
+    2597, 2598, 2599, 2600, 2601, 2615, 3573, 2578, 3568, 2610, 2613, 2505,
+    3031, 2604, 3566, 2616, 3567, 2603, 2147, 2128, 2611, 2502, 811, 813,
+    814, 815, 816, 817, 674, 3080, 3081, 3082, 3083, 3084, 3085, 3356,
+    3357, 3358, 3359, 3360, 3361, 2952, 386, 1408, 3208, 3209, 3211, 3210,
+    3032, 3033, 3034, 3035, 3036, 3037, 3644, 1862, 2114, 3516, 767, 1156,
+    1157, 1158, 1159, 1160, 1161, 1208, 1209, 1210, 1211, 1212, 1213, 1592,
+    1593, 1594, 1595, 1596, 1597, 1132, 1133, 1134, 1135, 1136, 1137, 1995,
+    1996, 1997, 1998, 1999, 2000, 1280, 1281, 1282, 1283, 1284, 1285, 1168,
+    1169, 1170, 1171, 1172, 1173, 1126, 1127, 1128, 1129, 1130, 1131, 1214,
+    1215, 1216, 1217, 1218, 1219, 1647, 1648, 1649, 1650, 1651, 1652, 1286,
+    1287, 1288, 1289, 1290, 1291, 1196, 1197, 1198, 1199, 1200, 1201, 1190,
+    1191, 1192, 1193, 1194, 1195, 1292, 1293, 1294, 1295, 1296, 1297, 1491,
+    1492, 1493, 1494, 1495, 1496, 1202, 1203, 1204, 1205, 1206, 1207, 1150,
+    1151, 1152, 1153, 1154, 1155, 1144, 1145, 1146, 1147, 1148, 1149, 1162,
+    1163, 1164, 1165, 1166, 1167, 1184, 1185, 1186, 1187, 1188, 1189, 3398,
+    3399, 3400, 3401, 3402, 3403, 3344, 3345, 3346, 3347, 3348, 3349, 3416,
+    3326, 3327, 3328, 3329, 3330, 3331, 3694, 2899, 2900, 2901, 2902, 2903,
+    2904, 2917, 2918, 2919, 2920, 2921, 2922, 3362, 3363, 3364, 3365, 3366,
+    3367, 3419, 2728, 484, 3751, 646, 2055, 1829, 481, 1891, 3547, 1930,
+    2289, 3437, 3430, 3116, 3117, 3118, 3119, 3120, 3121, 462, 2775, 335,
+    344, 732, 423, 486, 3781, 3782, 3783, 3784, 3785, 3786, 7, 31,
+    32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43,
+    44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+    56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67,
+    68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 80,
+    81, 82, 84, 85, 86, 87, 88, 89, 90, 92, 93, 94,
+    95, 96, 97, 98, 99, 100, 101, 102, 103, 683, 104, 106,
+    107, 108, 109, 110, 111, 112, 113, 115, 116, 119, 120, 121,
+    122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133,
+    134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145,
+    146, 147, 148, 149, 150, 151, 152, 154, 155, 156, 157, 159,
+    160, 161, 162, 163, 164, 165, 166, 168, 169, 170, 171, 172,
+    173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184,
+    185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+    197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208,
+    209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220,
+    221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232,
+    233, 234, 235, 236, 238, 239, 240, 83, 241, 242, 684, 243,
+    244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+    256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267,
+    268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279,
+    280, 281, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292,
+    685, 293, 294, 295, 296, 297, 298, 299, 300, 471, 2878, 1931,
+    3553, 3726, 748, 1826, 503, 2126, 3475, 3510, 2783, 2468, 363, 317,
+    3507, 3555, 2892, 2893, 2894, 2895, 2896, 2897, 586, 876, 439, 2800,
+    3749, 6, 384, 2847, 114, 2052, 23, 437, 422, 417, 760, 2112,
+    3775, 338, 346, 3733, 501, 2950, 117, 3724, 1720, 3698, 3418, 1618,
+    452, 1785, 3560, 2855, 885, 886, 887, 888, 889, 890, 2795, 332,
+    3426, 2774, 714, 2834, 3750, 636, 637, 638, 639, 640, 641, 3525,
+    2850, 392, 401, 1852, 1782, 2791, 3821, 3460, 3820, 2118, 2074, 2073,
+    2608, 2606, 1659, 1660, 1661, 1662, 1663, 1664, 2883, 507, 1937, 3508,
+    1708, 1709, 1710, 1711, 1712, 1713, 406, 1933, 3717, 2453, 3506, 761,
+    3787, 3789, 3790, 3791, 3792, 3793, 2566, 3574, 3575, 3576, 3577, 3578,
+    3579, 868, 2762, 2763, 2764, 2765, 2766, 2767, 2539, 2540, 2545, 2546,
+    2547, 2548, 2541, 2549, 2550, 2551, 2552, 2542, 2553, 2554, 2555, 2556,
+    2543, 2557, 2558, 2559, 2560, 2544, 2561, 2562, 2563, 2564, 1798, 3476,
+    0, 738, 736, 2143, 2144, 490, 3500, 3212, 3213, 3214, 3215, 3216,
+    3217, 2203, 3827, 1787, 2087, 2136, 3610, 3611, 3612, 3613, 3614, 3615,
+    3825, 1775, 1779, 3711, 3808, 3830, 1814, 2485, 3823, 3824, 3829, 3809,
+    3828, 2857, 2272, 3741, 383, 378, 1899, 873, 2835, 2446, 2864, 1935,
+    1988, 433, 729, 3491, 756, 580, 581, 582, 583, 584, 585, 666,
+    2821, 374, 365, 669, 3713, 3641, 3654, 661, 653, 662, 2507, 2122,
+    2447, 3521, 2572, 2573, 2574, 2575, 2576, 2577, 426, 2956, 647, 3755,
+    424, 24, 3504, 314, 1627, 1867, 1870, 3604, 3605, 3606, 3607, 3608,
+    3609, 3715, 1641, 1642, 1643, 1644, 1645, 1646, 3631, 2081, 3629, 1879,
+    153, 675, 454, 2071, 677, 1617, 1616, 3559, 862, 3522, 3431, 2075,
+    2134, 2016, 158, 3218, 3219, 3220, 3221, 3222, 3223, 2722, 2723, 2724,
+    2725, 2726, 2727, 1958, 2861, 1910, 3642, 1, 1924, 3509, 864, 1717,
+    2097, 2138, 2100, 2098, 2099, 3468, 2797, 3007, 3008, 3009, 3010, 3011,
+    3012, 1936, 448, 3496, 743, 301, 167, 2833, 688, 2781, 3490, 731,
+    730, 676, 1947, 1949, 2479, 2477, 2484, 2475, 2482, 2473, 1948, 2480,
+    2476, 2483, 2478, 2474, 2481, 340, 345, 3810, 2079, 3524, 2812, 387,
+    1846, 2527, 2528, 2529, 2530, 2531, 2532, 2432, 3632, 2064, 3638, 3586,
+    3587, 3588, 3589, 3590, 3591, 3616, 3617, 3618, 3619, 3620, 3621, 2886,
+    2887, 2888, 2889, 2890, 2891, 397, 3700, 703, 479, 3702, 3459, 2279,
+    359, 360, 396, 1916, 2023, 2838, 785, 1671, 2851, 2862, 2867, 1911,
+    1908, 431, 3486, 3833, 3442, 3517, 1903, 1864, 670, 1718, 3505, 1898,
+    2024, 2027, 2025, 2026, 3441, 3527, 2583, 3658, 1906, 1907, 3338, 3339,
+    3340, 3341, 3342, 3343, 3471, 3440, 14, 1873, 1872, 1874, 1875, 921,
+    922, 923, 924, 925, 926, 978, 979, 980, 981, 982, 983, 1598,
+    1599, 1600, 1601, 1602, 1603, 897, 898, 899, 900, 901, 902, 2001,
+    2002, 2003, 2004, 2005, 2006, 1050, 1051, 1052, 1053, 1054, 1055, 933,
+    934, 935, 936, 937, 938, 891, 892, 893, 894, 895, 896, 984,
+    985, 986, 987, 988, 989, 1653, 1654, 1655, 1656, 1657, 1658, 1056,
+    1057, 1058, 1059, 1060, 1061, 966, 967, 968, 969, 970, 971, 960,
+    961, 962, 963, 964, 965, 1062, 1063, 1064, 1065, 1066, 1067, 1497,
+    1498, 1499, 1500, 1501, 1502, 972, 973, 974, 975, 976, 977, 915,
+    916, 917, 918, 919, 920, 909, 910, 911, 912, 913, 914, 927,
+    928, 929, 930, 931, 932, 954, 955, 956, 957, 958, 959, 3404,
+    3405, 3406, 3407, 3408, 3409, 3350, 3351, 3352, 3353, 3354, 3355, 3417,
+    3332, 3333, 3334, 3335, 3336, 3337, 3695, 2905, 2906, 2907, 2908, 2909,
+    2910, 2923, 2924, 2925, 2926, 2927, 2928, 3368, 3369, 3370, 3371, 3372,
+    3373, 3420, 2872, 1120, 2347, 2348, 2349, 2350, 2351, 2352, 3762, 3763,
+    3764, 3765, 3766, 3767, 2190, 2191, 2192, 2193, 2194, 2195, 940, 939,
+    2698, 2699, 2700, 2701, 2702, 2703, 2590, 2591, 2592, 2593, 2594, 2595,
+    2235, 2236, 2237, 2238, 2239, 2240, 2154, 2155, 2156, 2157, 2158, 2159,
+    2172, 2173, 2174, 2175, 2176, 2177, 1702, 1703, 1704, 1705, 1706, 1707,
+    1684, 1685, 1686, 1687, 1688, 1689, 943, 941, 942, 630, 631, 632,
+    633, 634, 635, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076,
+    1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088,
+    1089, 1090, 1091, 1092, 1093, 2716, 2717, 2718, 2719, 2720, 2721, 1094,
+    1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106,
+    1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118,
+    1119, 612, 613, 614, 615, 616, 617, 944, 945, 946, 947, 948,
+    2365, 2366, 2367, 2368, 2369, 2370, 2756, 2757, 2758, 2759, 2760, 2761,
+    2738, 2739, 2740, 2741, 2742, 2743, 2253, 2254, 2255, 2256, 2257, 2258,
+    2211, 2212, 2213, 2214, 2215, 2216, 2313, 2314, 2315, 2316, 2317, 2318,
+    535, 536, 537, 538, 539, 540, 2680, 2681, 2682, 2683, 2684, 2685,
+    566, 567, 568, 569, 570, 571, 594, 595, 596, 597, 598, 599,
+    1635, 1636, 1637, 1638, 1639, 1640, 2389, 2390, 2391, 2392, 2393, 2394,
+    1562, 1563, 1564, 1565, 1566, 1567, 1512, 949, 950, 951, 952, 953,
+    2730, 1409, 1412, 1417, 1418, 1419, 1420, 1413, 1421, 1422, 1423, 1424,
+    1414, 1425, 1426, 1427, 1428, 1415, 1429, 1430, 1431, 1432, 1416, 1433,
+    1434, 1435, 1436, 3296, 3297, 3298, 3299, 3300, 3301, 2017, 2018, 2019,
+    2020, 2021, 2022, 903, 904, 905, 906, 907, 908, 1989, 1990, 1991,
+    1992, 1993, 1994, 3314, 3315, 3316, 3317, 3318, 3319, 1044, 1038, 1039,
+    1040, 1041, 1042, 1043, 1045, 1046, 1047, 1048, 1049, 1032, 1026, 1027,
+    1028, 1029, 1030, 1031, 1033, 1034, 1035, 1036, 1037, 3278, 3279, 3280,
+    3281, 3282, 3283, 2655, 2656, 2657, 2658, 2659, 2660, 2989, 2995, 2996,
+    2997, 2998, 2999, 3000, 2990, 2991, 2992, 2993, 2994, 541, 542, 543,
+    544, 545, 546, 2965, 2966, 2967, 2968, 2969, 2970, 1121, 1122, 1123,
+    1124, 1125, 2395, 2396, 2397, 2398, 2399, 2400, 3254, 3255, 3256, 3257,
+    3258, 3259, 1550, 1551, 1552, 1553, 1554, 1555, 996, 997, 998, 999,
+    1000, 1001, 1568, 1569, 1570, 1571, 1572, 1573, 1520, 1521, 1522, 1523,
+    1524, 1525, 990, 991, 992, 993, 994, 995, 2813, 870, 1987, 2943,
+    385, 3474, 2779, 2132, 1690, 1691, 1692, 1693, 1694, 1695, 2955, 408,
+    3098, 3099, 3100, 3101, 3102, 3103, 2944, 2945, 476, 3720, 1865, 393,
+    3564, 1858, 1511, 1438, 3826, 1961, 2415, 3380, 3381, 3382, 3383, 3384,
+    3385, 3386, 3387, 3388, 3389, 3390, 3391, 3392, 3393, 3394, 3395, 3396,
+    3397, 2278, 2869, 487, 1938, 2034, 2036, 2037, 2038, 2039, 2040, 3484,
+    328, 2287, 1825, 3492, 3503, 1882, 2501, 1820, 1812, 716, 757, 2301,
+    336, 2814, 3548, 475, 1959, 2868, 351, 2668, 2458, 2465, 2942, 2456,
+    2068, 3747, 2371, 2372, 2373, 2374, 2375, 2376, 2304, 2302, 749, 698,
+    3498, 488, 2072, 2667, 2669, 2670, 2671, 2672, 2673, 1801, 1802, 1803,
+    1804, 1805, 1806, 389, 508, 504, 511, 1900, 3050, 3051, 3052, 3053,
+    3054, 3055, 1672, 1673, 1674, 1675, 1676, 1677, 1856, 659, 2580, 3453,
+    859, 3818, 2503, 3520, 3473, 2090, 25, 333, 343, 1878, 26, 319,
+    11, 2823, 2824, 2825, 2826, 2827, 2828, 1914, 2340, 3744, 2332, 2160,
+    2161, 2162, 2163, 2164, 2165, 1883, 2131, 2413, 2334, 2338, 779, 780,
+    781, 782, 783, 784, 1847, 1848, 505, 1934, 3842, 18, 326, 2444,
+    724, 420, 663, 3092, 3093, 3094, 3095, 3096, 3097, 2455, 27, 824,
+    825, 826, 827, 828, 829, 2178, 2179, 2180, 2181, 2182, 2183, 2060,
+    3242, 3243, 3244, 3245, 3246, 3247, 1574, 1575, 1576, 1577, 1578, 1579,
+    1580, 1581, 1582, 1583, 1584, 1585, 3552, 1956, 1920, 2296, 2284, 2291,
+    2293, 3, 3455, 2951, 1851, 1830, 850, 851, 852, 853, 854, 855,
+    2121, 3739, 1854, 3423, 2876, 3687, 2875, 1866, 2846, 699, 2879, 1868,
+    1832, 1831, 1861, 3592, 3593, 3594, 3595, 3596, 3597, 372, 3598, 3599,
+    3600, 3601, 3602, 3603, 2631, 2632, 2633, 2634, 2635, 2636, 2798, 765,
+    1842, 3469, 19, 2865, 3844, 3737, 355, 2819, 2463, 2429, 768, 3561,
+    3689, 403, 2863, 2796, 402, 1859, 3806, 742, 2094, 3122, 3123, 3124,
+    3125, 3126, 3127, 3128, 3129, 3130, 3131, 3132, 3133, 3134, 3135, 3136,
+    3137, 3138, 3139, 3140, 3141, 3142, 3143, 3144, 3145, 3146, 3147, 3528,
+    496, 2109, 3302, 3303, 3304, 3305, 3306, 3307, 2704, 2705, 2706, 2707,
+    2708, 2709, 3044, 3045, 3046, 3047, 3048, 3049, 2241, 2242, 2243, 2244,
+    2245, 2246, 3320, 3321, 3322, 3323, 3324, 3325, 3202, 3196, 3197, 3198,
+    3199, 3200, 3201, 3203, 3204, 3205, 3206, 3207, 3190, 3184, 3185, 3186,
+    3187, 3188, 3189, 3191, 3192, 3193, 3194, 3195, 3284, 3285, 3286, 3287,
+    3288, 3289, 2661, 2662, 2663, 2664, 2665, 2666, 3001, 3002, 3003, 3004,
+    3005, 3006, 547, 548, 549, 550, 551, 552, 2401, 2402, 2403, 2404,
+    2405, 2406, 3768, 3769, 3770, 3771, 3772, 3773, 1544, 1545, 1546, 1547,
+    1548, 1549, 3541, 3542, 3543, 3544, 3545, 3546, 3266, 3267, 3268, 3269,
+    3270, 3271, 2259, 2260, 2261, 2262, 2263, 2264, 3154, 3155, 3156, 3157,
+    3158, 3159, 3148, 3149, 3150, 3151, 3152, 3153, 3433, 739, 3672, 3740,
+    2471, 2807, 759, 721, 766, 1716, 3224, 3225, 3226, 3227, 3228, 3229,
+    3472, 2486, 2487, 2488, 2489, 2490, 2491, 2494, 2495, 2496, 2497, 2498,
+    2499, 399, 3461, 682, 3707, 407, 3501, 2443, 2450, 2831, 3494, 793,
+    794, 795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805,
+    806, 807, 808, 809, 810, 3678, 787, 788, 789, 790, 791, 792,
+    3679, 3680, 3681, 3682, 3683, 763, 2290, 744, 1799, 450, 664, 1877,
+    1876, 2337, 2788, 3514, 869, 409, 1819, 3557, 2139, 2265, 2266, 2267,
+    2268, 2269, 2270, 1892, 3529, 3530, 3531, 3532, 3533, 3534, 3535, 3536,
+    3537, 3538, 3539, 3540, 2619, 2620, 2621, 2622, 2623, 2624, 2808, 2643,
+    2644, 2645, 2646, 2647, 2648, 1610, 1611, 1612, 1613, 1614, 1615, 2049,
+    2884, 812, 1784, 867, 1840, 2335, 3819, 752, 704, 2866, 712, 643,
+    642, 1889, 1917, 3685, 2107, 2274, 2457, 357, 324, 679, 2521, 2522,
+    2523, 2524, 2525, 2526, 3788, 2028, 2029, 2030, 2031, 2032, 2033, 2223,
+    2224, 2225, 2226, 2227, 2228, 2217, 2218, 2219, 2220, 2221, 2222, 713,
+    414, 697, 3480, 3452, 3714, 2295, 1946, 3429, 1002, 1003, 1004, 1005,
+    1006, 1007, 3160, 3161, 3162, 3163, 3164, 3165, 1232, 1233, 1234, 1235,
+    1236, 1237, 13, 3693, 2086, 477, 1894, 1895, 2417, 2035, 1786, 3645,
+    2852, 451, 412, 411, 410, 473, 2533, 2534, 2535, 2536, 2537, 2538,
+    2065, 3580, 3581, 3582, 3583, 3584, 3585, 3622, 3623, 3624, 3625, 3626,
+    3627, 1719, 2452, 3478, 2506, 3502, 2271, 3449, 2061, 485, 2472, 2581,
+    717, 3562, 377, 687, 2329, 1841, 2319, 2320, 2321, 2322, 2323, 2324,
+    237, 587, 553, 555, 556, 557, 558, 559, 554, 512, 302, 3445,
+    2935, 3704, 3753, 441, 2948, 3565, 874, 2810, 456, 457, 458, 459,
+    460, 461, 2832, 2462, 1863, 2080, 2858, 506, 3722, 3425, 672, 474,
+    3104, 3105, 3106, 3107, 3108, 3109, 3776, 2464, 2839, 3703, 2124, 2141,
+    3489, 1857, 2882, 1822, 2776, 3846, 2202, 369, 2637, 2638, 2639, 2640,
+    2641, 2642, 2612, 719, 9, 3495, 3572, 2792, 3677, 2845, 425, 715,
+    725, 2454, 3745, 2306, 860, 1800, 2618, 871, 2440, 2445, 3457, 3477,
+    2421, 2853, 2686, 2687, 2688, 2689, 2690, 2691, 2609, 2509, 1884, 3062,
+    3063, 3064, 3065, 3066, 3067, 8, 1941, 2469, 514, 3754, 692, 693,
+    694, 695, 696, 1628, 3684, 2877, 2467, 2127, 2434, 2435, 2436, 2437,
+    2438, 2439, 2116, 2007, 2008, 2009, 2010, 2011, 2012, 2142, 2145, 499,
+    2874, 2459, 1951, 1950, 1952, 1953, 2077, 2133, 2076, 2135, 2816, 2614,
+    2818, 2082, 2089, 2137, 2333, 710, 711, 2602, 649, 358, 517, 518,
+    519, 520, 521, 522, 3815, 3670, 3736, 3450, 2119, 3734, 3428, 2782,
+    1921, 28, 1902, 1626, 3709, 415, 3816, 463, 3812, 1778, 2204, 1901,
+    2063, 1808, 2325, 2014, 2015, 2058, 2057, 3563, 2041, 2042, 2043, 2044,
+    2045, 2046, 3451, 2773, 578, 2854, 660, 3721, 2971, 2972, 2973, 2974,
+    2975, 2976, 3841, 2605, 348, 3688, 3811, 349, 2280, 2070, 2273, 3464,
+    436, 3652, 1843, 405, 2101, 2103, 2102, 3056, 3057, 3058, 3059, 3060,
+    3061, 478, 2793, 354, 356, 352, 347, 379, 2088, 3667, 321, 320,
+    2911, 2912, 2913, 2914, 2915, 2916, 2929, 2930, 2931, 2932, 2933, 2934,
+    572, 573, 574, 575, 576, 577, 421, 2303, 2871, 2093, 1795, 2078,
+    418, 600, 601, 602, 603, 604, 605, 1928, 1960, 1715, 2859, 648,
+    366, 465, 2801, 3554, 467, 395, 3697, 2292, 440, 3074, 3075, 3076,
+    3077, 3078, 3079, 3556, 3086, 3087, 3088, 3089, 3090, 3091, 3446, 3673,
+    1860, 1939, 513, 3774, 3432, 2508, 2510, 2511, 2512, 2513, 2514, 350,
+    2504, 2777, 3458, 1809, 3443, 5, 2050, 838, 831, 3738, 494, 751,
+    702, 3653, 2117, 3630, 2419, 2069, 390, 786, 3438, 2898, 3499, 1922,
+    492, 361, 362, 2051, 2300, 2326, 2282, 2277, 2281, 680, 3729, 2330,
+    1844, 1943, 2110, 2958, 2285, 579, 444, 733, 2298, 509, 861, 375,
+    2772, 2840, 735, 1888, 1893, 4, 1777, 1437, 1439, 1444, 1445, 1446,
+    1447, 1440, 1448, 1449, 1450, 1451, 1441, 1452, 1453, 1454, 1455, 1442,
+    1456, 1457, 1458, 1459, 1443, 1460, 1461, 1462, 1463, 1464, 1466, 1471,
+    1472, 1473, 1474, 1467, 1475, 1476, 1477, 1478, 1468, 1479, 1480, 1481,
+    1482, 1469, 1483, 1484, 1485, 1486, 1470, 1487, 1488, 1489, 1490, 312,
+    307, 313, 304, 310, 309, 308, 303, 311, 305, 306, 118, 3669,
+    3748, 3675, 2092, 1923, 2841, 1912, 29, 2146, 282, 3794, 3795, 3796,
+    3797, 3798, 3799, 3374, 3375, 3376, 3377, 3378, 3379, 2327, 1890, 1881,
+    1887, 497, 510, 3701, 327, 645, 30, 2953, 2407, 2408, 2409, 2410,
+    2411, 2412, 341, 339, 3727, 2056, 3640, 700, 2744, 2745, 2746, 2747,
+    2748, 2749, 394, 818, 819, 820, 821, 822, 823, 686, 681, 3843,
+    334, 337, 2420, 2115, 1774, 618, 619, 620, 621, 622, 623, 755,
+    709, 2451, 3691, 3716, 3777, 3730, 1810, 3692, 1020, 1021, 1022, 1023,
+    1024, 1025, 3178, 3179, 3180, 3181, 3182, 3183, 1250, 1251, 1252, 1253,
+    1254, 1255, 2492, 3840, 3665, 3663, 3660, 1945, 2769, 364, 472, 3493,
+    442, 3523, 2083, 2449, 762, 1402, 2341, 2342, 2343, 2344, 2345, 2346,
+    3756, 3757, 3758, 3759, 3760, 3761, 2184, 2185, 2186, 2187, 2188, 2189,
+    1175, 1174, 2692, 2693, 2694, 2695, 2696, 2697, 2584, 2585, 2586, 2587,
+    2588, 2589, 2229, 2230, 2231, 2232, 2233, 2234, 2148, 2149, 2150, 2151,
+    2152, 2153, 2166, 2167, 2168, 2169, 2170, 2171, 1696, 1697, 1698, 1699,
+    1700, 1701, 1678, 1679, 1680, 1681, 1682, 1683, 1178, 1176, 1177, 624,
+    625, 626, 627, 628, 629, 1298, 1299, 1300, 1301, 1302, 1303, 1304,
+    1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316,
+    1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328,
+    1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340,
+    1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 2710, 2711, 2712,
+    2713, 2714, 2715, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358,
+    1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370,
+    1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382,
+    1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394,
+    1395, 1396, 1397, 1398, 1399, 1400, 1401, 606, 607, 608, 609, 610,
+    611, 2359, 2360, 2361, 2362, 2363, 2364, 2750, 2751, 2752, 2753, 2754,
+    2755, 2732, 2733, 2734, 2735, 2736, 2737, 2247, 2248, 2249, 2250, 2251,
+    2252, 2205, 2206, 2207, 2208, 2209, 2210, 2307, 2308, 2309, 2310, 2311,
+    2312, 523, 524, 525, 526, 527, 528, 2674, 2675, 2676, 2677, 2678,
+    2679, 560, 561, 562, 563, 564, 565, 588, 589, 590, 591, 592,
+    593, 1629, 1630, 1631, 1632, 1633, 1634, 2377, 2378, 2379, 2380, 2381,
+    2382, 1556, 1557, 1558, 1559, 1560, 1561, 1510, 1179, 1180, 1181, 1182,
+    1183, 2729, 1410, 3290, 3291, 3292, 3293, 3294, 3295, 1138, 1139, 1140,
+    1141, 1142, 1143, 3308, 3309, 3310, 3311, 3312, 3313, 1274, 1268, 1269,
+    1270, 1271, 1272, 1273, 1275, 1276, 1277, 1278, 1279, 1262, 1256, 1257,
+    1258, 1259, 1260, 1261, 1263, 1264, 1265, 1266, 1267, 3272, 3273, 3274,
+    3275, 3276, 3277, 2649, 2650, 2651, 2652, 2653, 2654, 2977, 2983, 2984,
+    2985, 2986, 2987, 2988, 2978, 2979, 2980, 2981, 2982, 529, 530, 531,
+    532, 533, 534, 2959, 2960, 2961, 2962, 2963, 2964, 1403, 1404, 1405,
+    1406, 1407, 2383, 2384, 2385, 2386, 2387, 2388, 3248, 3249, 3250, 3251,
+    3252, 3253, 1226, 1227, 1228, 1229, 1230, 1231, 1514, 1515, 1516, 1517,
+    1518, 1519, 1220, 1221, 1222, 1223, 1224, 1225, 866, 2836, 857, 1509,
+    1465, 2416, 3515, 2820, 2067, 3511, 2105, 1932, 2731, 3800, 3801, 3802,
+    3803, 3804, 3805, 3817, 3465, 3444, 2817, 1783, 1816, 3690, 3467, 2085,
+    2607, 3728, 2856, 2, 2500, 3421, 1792,
+};
+
+const FirstUnit FIRST_UNITS[] = {
+    {0x0023, 0},
+    {0x002A, 1},
+    {0x0030, 2},
+    {0x0031, 3},
+    {0x0032, 4},
+    {0x0033, 5},
+    {0x0034, 6},
+    {0x0035, 7},
+    {0x0036, 8},
+    {0x0037, 9},
+    {0x0038, 10},
+    {0x0039, 11},
+    {0x00A9, 12},
+    {0x00AE, 13},
+    {0x203C, 3573},
+    {0x2049, 3574},
+    {0x2122, 3575},
+    {0x2139, 3576},
+    {0x2194, 3577},
+    {0x2195, 3578},
+    {0x2196, 3579},
+    {0x2197, 3580},
+    {0x2198, 3581},
+    {0x2199, 3582},
+    {0x21A9, 3583},
+    {0x21AA, 3584},
+    {0x231A, 3585},
+    {0x231B, 3586},
+    {0x2328, 3587},
+    {0x23CF, 3588},
+    {0x23E9, 3589},
+    {0x23EA, 3590},
+    {0x23EB, 3591},
+    {0x23EC, 3592},
+    {0x23ED, 3593},
+    {0x23EE, 3594},
+    {0x23EF, 3595},
+    {0x23F0, 3596},
+    {0x23F1, 3597},
+    {0x23F2, 3598},
+    {0x23F3, 3599},
+    {0x23F8, 3600},
+    {0x23F9, 3601},
+    {0x23FA, 3602},
+    {0x24C2, 3603},
+    {0x25AA, 3604},
+    {0x25AB, 3605},
+    {0x25B6, 3606},
+    {0x25C0, 3607},
+    {0x25FB, 3608},
+    {0x25FC, 3609},
+    {0x25FD, 3610},
+    {0x25FE, 3611},
+    {0x2600, 3612},
+    {0x2601, 3613},
+    {0x2602, 3614},
+    {0x2603, 3615},
+    {0x2604, 3616},
+    {0x260E, 3617},
+    {0x2611, 3618},
+    {0x2614, 3619},
+    {0x2615, 3620},
+    {0x2618, 3621},
+    {0x261D, 3623},
+    {0x261D, 3624},
+    {0x261D, 3625},
+    {0x261D, 3626},
+    {0x261D, 3627},
+    {0x261D, 3622},
+    {0x2620, 3628},
+    {0x2622, 3629},
+    {0x2623, 3630},
+    {0x2626, 3631},
+    {0x262A, 3632},
+    {0x262E, 3633},
+    {0x262F, 3634},
+    {0x2638, 3635},
+    {0x2639, 3636},
+    {0x263A, 3637},
+    {0x2640, 3638},
+    {0x2642, 3639},
+    {0x2648, 3640},
+    {0x2649, 3641},
+    {0x264A, 3642},
+    {0x264B, 3643},
+    {0x264C, 3644},
+    {0x264D, 3645},
+    {0x264E, 3646},
+    {0x264F, 3647},
+    {0x2650, 3648},
+    {0x2651, 3649},
+    {0x2652, 3650},
+    {0x2653, 3651},
+    {0x265F, 3652},
+    {0x2660, 3653},
+    {0x2663, 3654},
+    {0x2665, 3655},
+    {0x2666, 3656},
+    {0x2668, 3657},
+    {0x267B, 3658},
+    {0x267E, 3659},
+    {0x267F, 3660},
+    {0x2692, 3661},
+    {0x2693, 3662},
+    {0x2694, 3663},
+    {0x2695, 3664},
+    {0x2696, 3665},
+    {0x2697, 3666},
+    {0x2699, 3667},
+    {0x269B, 3668},
+    {0x269C, 3669},
+    {0x26A0, 3670},
+    {0x26A1, 3671},
+    {0x26A7, 3672},
+    {0x26AA, 3673},
+    {0x26AB, 3674},
+    {0x26B0, 3675},
+    {0x26B1, 3676},
+    {0x26BD, 3677},
+    {0x26BE, 3678},
+    {0x26C4, 3679},
+    {0x26C5, 3680},
+    {0x26C8, 3681},
+    {0x26CE, 3682},
+    {0x26CF, 3683},
+    {0x26D1, 3684},
+    {0x26D3, 3685},
+    {0x26D3, 3686},
+    {0x26D4, 3687},
+    {0x26E9, 3688},
+    {0x26EA, 3689},
+    {0x26F0, 3690},
+    {0x26F1, 3691},
+    {0x26F2, 3692},
+    {0x26F3, 3693},
+    {0x26F4, 3694},
+    {0x26F5, 3695},
+    {0x26F7, 3696},
+    {0x26F8, 3697},
+    {0x26F9, 3699},
+    {0x26F9, 3700},
+    {0x26F9, 3701},
+    {0x26F9, 3702},
+    {0x26F9, 3703},
+    {0x26F9, 3705},
+    {0x26F9, 3706},
+    {0x26F9, 3707},
+    {0x26F9, 3708},
+    {0x26F9, 3709},
+    {0x26F9, 3698},
+    {0x26F9, 3704},
+    {0x26F9, 3711},
+    {0x26F9, 3712},
+    {0x26F9, 3713},
+    {0x26F9, 3714},
+    {0x26F9, 3715},
+    {0x26F9, 3710},
+    {0x26FA, 3716},
+    {0x26FD, 3717},
+    {0x2702, 3718},
+    {0x2705, 3719},
+    {0x2708, 3720},
+    {0x2709, 3721},
+    {0x270A, 3723},
+    {0x270A, 3724},
+    {0x270A, 3725},
+    {0x270A, 3726},
+    {0x270A, 3727},
+    {0x270A, 3722},
+    {0x270B, 3729},
+    {0x270B, 3730},
+    {0x270B, 3731},
+    {0x270B, 3732},
+    {0x270B, 3733},
+    {0x270B, 3728},
+    {0x270C, 3735},
+    {0x270C, 3736},
+    {0x270C, 3737},
+    {0x270C, 3738},
+    {0x270C, 3739},
+    {0x270C, 3734},
+    {0x270D, 3741},
+    {0x270D, 3742},
+    {0x270D, 3743},
+    {0x270D, 3744},
+    {0x270D, 3745},
+    {0x270D, 3740},
+    {0x270F, 3746},
+    {0x2712, 3747},
+    {0x2714, 3748},
+    {0x2716, 3749},
+    {0x271D, 3750},
+    {0x2721, 3751},
+    {0x2728, 3752},
+    {0x2733, 3753},
+    {0x2734, 3754},
+    {0x2744, 3755},
+    {0x2747, 3756},
+    {0x274C, 3757},
+    {0x274E, 3758},
+    {0x2753, 3759},
+    {0x2754, 3760},
+    {0x2755, 3761},
+    {0x2757, 3762},
+    {0x2763, 3763},
+    {0x2764, 3764},
+    {0x2764, 3765},
+    {0x2764, 3766},
+    {0x2795, 3767},
+    {0x2796, 3768},
+    {0x2797, 3769},
+    {0x27A1, 3770},
+    {0x27B0, 3771},
+    {0x27BF, 3772},
+    {0x2934, 3773},
+    {0x2935, 3774},
+    {0x2B05, 3775},
+    {0x2B06, 3776},
+    {0x2B07, 3777},
+    {0x2B1B, 3778},
+    {0x2B1C, 3779},
+    {0x2B50, 3780},
+    {0x2B55, 3781},
+    {0x3030, 3782},
+    {0x303D, 3783},
+    {0x3297, 3784},
+    {0x3299, 3785},
+    {0xD83C, 663},
+    {0xD83C, 664},
+    {0xD83C, 665},
+    {0xD83C, 512},
+    {0xD83C, 513},
+    {0xD83C, 514},
+    {0xD83C, 515},
+    {0xD83C, 516},
+    {0xD83C, 524},
+    {0xD83C, 525},
+    {0xD83C, 526},
+    {0xD83C, 527},
+    {0xD83C, 528},
+    {0xD83C, 511},
+    {0xD83C, 523},
+    {0xD83C, 506},
+    {0xD83C, 507},
+    {0xD83C, 508},
+    {0xD83C, 509},
+    {0xD83C, 510},
+    {0xD83C, 518},
+    {0xD83C, 519},
+    {0xD83C, 520},
+    {0xD83C, 521},
+    {0xD83C, 522},
+    {0xD83C, 530},
+    {0xD83C, 531},
+    {0xD83C, 532},
+    {0xD83C, 533},
+    {0xD83C, 534},
+    {0xD83C, 542},
+    {0xD83C, 543},
+    {0xD83C, 544},
+    {0xD83C, 545},
+    {0xD83C, 546},
+    {0xD83C, 548},
+    {0xD83C, 549},
+    {0xD83C, 550},
+    {0xD83C, 551},
+    {0xD83C, 552},
+    {0xD83C, 570},
+    {0xD83C, 571},
+    {0xD83C, 572},
+    {0xD83C, 573},
+    {0xD83C, 574},
+    {0xD83C, 576},
+    {0xD83C, 577},
+    {0xD83C, 578},
+    {0xD83C, 579},
+    {0xD83C, 580},
+    {0xD83C, 588},
+    {0xD83C, 589},
+    {0xD83C, 590},
+    {0xD83C, 591},
+    {0xD83C, 592},
+    {0xD83C, 594},
+    {0xD83C, 595},
+    {0xD83C, 596},
+    {0xD83C, 597},
+    {0xD83C, 598},
+    {0xD83C, 606},
+    {0xD83C, 607},
+    {0xD83C, 608},
+    {0xD83C, 609},
+    {0xD83C, 610},
+    {0xD83C, 612},
+    {0xD83C, 613},
+    {0xD83C, 614},
+    {0xD83C, 615},
+    {0xD83C, 616},
+    {0xD83C, 587},
+    {0xD83C, 593},
+    {0xD83C, 605},
+    {0xD83C, 611},
+    {0xD83C, 659},
+    {0xD83C, 660},
+    {0xD83C, 371},
+    {0xD83C, 379},
+    {0xD83C, 505},
+    {0xD83C, 517},
+    {0xD83C, 529},
+    {0xD83C, 541},
+    {0xD83C, 547},
+    {0xD83C, 569},
+    {0xD83C, 575},
+    {0xD83C, 662},
+    {0xD83C, 31},
+    {0xD83C, 32},
+    {0xD83C, 33},
+    {0xD83C, 34},
+    {0xD83C, 35},
+    {0xD83C, 36},
+    {0xD83C, 37},
+    {0xD83C, 38},
+    {0xD83C, 39},
+    {0xD83C, 40},
+    {0xD83C, 41},
+    {0xD83C, 42},
+    {0xD83C, 43},
+    {0xD83C, 44},
+    {0xD83C, 45},
+    {0xD83C, 46},
+    {0xD83C, 47},
+    {0xD83C, 48},
+    {0xD83C, 49},
+    {0xD83C, 50},
+    {0xD83C, 51},
+    {0xD83C, 52},
+    {0xD83C, 53},
+    {0xD83C, 54},
+    {0xD83C, 55},
+    {0xD83C, 56},
+    {0xD83C, 57},
+    {0xD83C, 58},
+    {0xD83C, 59},
+    {0xD83C, 60},
+    {0xD83C, 61},
+    {0xD83C, 62},
+    {0xD83C, 63},
+    {0xD83C, 64},
+    {0xD83C, 65},
+    {0xD83C, 66},
+    {0xD83C, 67},
+    {0xD83C, 68},
+    {0xD83C, 69},
+    {0xD83C, 70},
+    {0xD83C, 71},
+    {0xD83C, 72},
+    {0xD83C, 73},
+    {0xD83C, 74},
+    {0xD83C, 75},
+    {0xD83C, 76},
+    {0xD83C, 77},
+    {0xD83C, 78},
+    {0xD83C, 79},
+    {0xD83C, 80},
+    {0xD83C, 81},
+    {0xD83C, 82},
+    {0xD83C, 83},
+    {0xD83C, 84},
+    {0xD83C, 85},
+    {0xD83C, 86},
+    {0xD83C, 87},
+    {0xD83C, 88},
+    {0xD83C, 89},
+    {0xD83C, 90},
+    {0xD83C, 91},
+    {0xD83C, 92},
+    {0xD83C, 93},
+    {0xD83C, 94},
+    {0xD83C, 95},
+    {0xD83C, 96},
+    {0xD83C, 97},
+    {0xD83C, 98},
+    {0xD83C, 99},
+    {0xD83C, 100},
+    {0xD83C, 101},
+    {0xD83C, 102},
+    {0xD83C, 103},
+    {0xD83C, 104},
+    {0xD83C, 105},
+    {0xD83C, 106},
+    {0xD83C, 107},
+    {0xD83C, 108},
+    {0xD83C, 109},
+    {0xD83C, 110},
+    {0xD83C, 111},
+    {0xD83C, 112},
+    {0xD83C, 113},
+    {0xD83C, 114},
+    {0xD83C, 115},
+    {0xD83C, 116},
+    {0xD83C, 117},
+    {0xD83C, 118},
+    {0xD83C, 119},
+    {0xD83C, 120},
+    {0xD83C, 121},
+    {0xD83C, 122},
+    {0xD83C, 123},
+    {0xD83C, 124},
+    {0xD83C, 125},
+    {0xD83C, 126},
+    {0xD83C, 127},
+    {0xD83C, 128},
+    {0xD83C, 129},
+    {0xD83C, 130},
+    {0xD83C, 131},
+    {0xD83C, 132},
+    {0xD83C, 133},
+    {0xD83C, 134},
+    {0xD83C, 135},
+    {0xD83C, 136},
+    {0xD83C, 137},
+    {0xD83C, 138},
+    {0xD83C, 139},
+    {0xD83C, 140},
+    {0xD83C, 141},
+    {0xD83C, 142},
+    {0xD83C, 143},
+    {0xD83C, 144},
+    {0xD83C, 145},
+    {0xD83C, 146},
+    {0xD83C, 147},
+    {0xD83C, 148},
+    {0xD83C, 149},
+    {0xD83C, 150},
+    {0xD83C, 151},
+    {0xD83C, 152},
+    {0xD83C, 153},
+    {0xD83C, 154},
+    {0xD83C, 155},
+    {0xD83C, 156},
+    {0xD83C, 157},
+    {0xD83C, 158},
+    {0xD83C, 159},
+    {0xD83C, 160},
+    {0xD83C, 161},
+    {0xD83C, 162},
+    {0xD83C, 163},
+    {0xD83C, 164},
+    {0xD83C, 165},
+    {0xD83C, 166},
+    {0xD83C, 167},
+    {0xD83C, 168},
+    {0xD83C, 169},
+    {0xD83C, 170},
+    {0xD83C, 171},
+    {0xD83C, 172},
+    {0xD83C, 173},
+    {0xD83C, 174},
+    {0xD83C, 175},
+    {0xD83C, 176},
+    {0xD83C, 177},
+    {0xD83C, 178},
+    {0xD83C, 179},
+    {0xD83C, 180},
+    {0xD83C, 181},
+    {0xD83C, 182},
+    {0xD83C, 183},
+    {0xD83C, 184},
+    {0xD83C, 185},
+    {0xD83C, 186},
+    {0xD83C, 187},
+    {0xD83C, 188},
+    {0xD83C, 189},
+    {0xD83C, 190},
+    {0xD83C, 191},
+    {0xD83C, 192},
+    {0xD83C, 193},
+    {0xD83C, 194},
+    {0xD83C, 195},
+    {0xD83C, 196},
+    {0xD83C, 197},
+    {0xD83C, 198},
+    {0xD83C, 199},
+    {0xD83C, 200},
+    {0xD83C, 201},
+    {0xD83C, 202},
+    {0xD83C, 203},
+    {0xD83C, 204},
+    {0xD83C, 205},
+    {0xD83C, 206},
+    {0xD83C, 207},
+    {0xD83C, 208},
+    {0xD83C, 209},
+    {0xD83C, 210},
+    {0xD83C, 211},
+    {0xD83C, 212},
+    {0xD83C, 213},
+    {0xD83C, 214},
+    {0xD83C, 215},
+    {0xD83C, 216},
+    {0xD83C, 217},
+    {0xD83C, 218},
+    {0xD83C, 219},
+    {0xD83C, 220},
+    {0xD83C, 221},
+    {0xD83C, 222},
+    {0xD83C, 223},
+    {0xD83C, 224},
+    {0xD83C, 225},
+    {0xD83C, 226},
+    {0xD83C, 227},
+    {0xD83C, 228},
+    {0xD83C, 229},
+    {0xD83C, 230},
+    {0xD83C, 231},
+    {0xD83C, 232},
+    {0xD83C, 233},
+    {0xD83C, 234},
+    {0xD83C, 235},
+    {0xD83C, 236},
+    {0xD83C, 237},
+    {0xD83C, 238},
+    {0xD83C, 239},
+    {0xD83C, 240},
+    {0xD83C, 241},
+    {0xD83C, 242},
+    {0xD83C, 243},
+    {0xD83C, 244},
+    {0xD83C, 245},
+    {0xD83C, 246},
+    {0xD83C, 247},
+    {0xD83C, 248},
+    {0xD83C, 249},
+    {0xD83C, 250},
+    {0xD83C, 251},
+    {0xD83C, 252},
+    {0xD83C, 253},
+    {0xD83C, 254},
+    {0xD83C, 255},
+    {0xD83C, 256},
+    {0xD83C, 257},
+    {0xD83C, 258},
+    {0xD83C, 259},
+    {0xD83C, 260},
+    {0xD83C, 261},
+    {0xD83C, 262},
+    {0xD83C, 263},
+    {0xD83C, 264},
+    {0xD83C, 265},
+    {0xD83C, 266},
+    {0xD83C, 267},
+    {0xD83C, 268},
+    {0xD83C, 269},
+    {0xD83C, 270},
+    {0xD83C, 271},
+    {0xD83C, 272},
+    {0xD83C, 273},
+    {0xD83C, 274},
+    {0xD83C, 275},
+    {0xD83C, 276},
+    {0xD83C, 277},
+    {0xD83C, 278},
+    {0xD83C, 279},
+    {0xD83C, 280},
+    {0xD83C, 281},
+    {0xD83C, 282},
+    {0xD83C, 283},
+    {0xD83C, 284},
+    {0xD83C, 285},
+    {0xD83C, 286},
+    {0xD83C, 287},
+    {0xD83C, 288},
+    {0xD83C, 289},
+    {0xD83C, 439},
+    {0xD83C, 440},
+    {0xD83C, 441},
+    {0xD83C, 442},
+    {0xD83C, 443},
+    {0xD83C, 500},
+    {0xD83C, 501},
+    {0xD83C, 502},
+    {0xD83C, 503},
+    {0xD83C, 504},
+    {0xD83C, 536},
+    {0xD83C, 537},
+    {0xD83C, 538},
+    {0xD83C, 539},
+    {0xD83C, 540},
+    {0xD83C, 554},
+    {0xD83C, 555},
+    {0xD83C, 556},
+    {0xD83C, 557},
+    {0xD83C, 558},
+    {0xD83C, 562},
+    {0xD83C, 563},
+    {0xD83C, 564},
+    {0xD83C, 565},
+    {0xD83C, 566},
+    {0xD83C, 582},
+    {0xD83C, 583},
+    {0xD83C, 584},
+    {0xD83C, 585},
+    {0xD83C, 586},
+    {0xD83C, 600},
+    {0xD83C, 601},
+    {0xD83C, 602},
+    {0xD83C, 603},
+    {0xD83C, 604},
+    {0xD83C, 618},
+    {0xD83C, 619},
+    {0xD83C, 620},
+    {0xD83C, 621},
+    {0xD83C, 622},
+    {0xD83C, 16},
+    {0xD83C, 17},
+    {0xD83C, 18},
+    {0xD83C, 19},
+    {0xD83C, 291},
+    {0xD83C, 299},
+    {0xD83C, 338},
+    {0xD83C, 339},
+    {0xD83C, 340},
+    {0xD83C, 341},
+    {0xD83C, 342},
+    {0xD83C, 343},
+    {0xD83C, 344},
+    {0xD83C, 345},
+    {0xD83C, 346},
+    {0xD83C, 347},
+    {0xD83C, 357},
+    {0xD83C, 430},
+    {0xD83C, 458},
+    {0xD83C, 459},
+    {0xD83C, 460},
+    {0xD83C, 461},
+    {0xD83C, 462},
+    {0xD83C, 463},
+    {0xD83C, 464},
+    {0xD83C, 599},
+    {0xD83C, 617},
+    {0xD83C, 623},
+    {0xD83C, 624},
+    {0xD83C, 630},
+    {0xD83C, 631},
+    {0xD83C, 632},
+    {0xD83C, 633},
+    {0xD83C, 634},
+    {0xD83C, 635},
+    {0xD83C, 636},
+    {0xD83C, 637},
+    {0xD83C, 638},
+    {0xD83C, 639},
+    {0xD83C, 640},
+    {0xD83C, 641},
+    {0xD83C, 661},
+    {0xD83C, 667},
+    {0xD83C, 668},
+    {0xD83C, 14},
+    {0xD83C, 15},
+    {0xD83C, 20},
+    {0xD83C, 21},
+    {0xD83C, 22},
+    {0xD83C, 23},
+    {0xD83C, 24},
+    {0xD83C, 25},
+    {0xD83C, 26},
+    {0xD83C, 27},
+    {0xD83C, 28},
+    {0xD83C, 29},
+    {0xD83C, 30},
+    {0xD83C, 290},
+    {0xD83C, 292},
+    {0xD83C, 293},
+    {0xD83C, 294},
+    {0xD83C, 295},
+    {0xD83C, 296},
+    {0xD83C, 297},
+    {0xD83C, 298},
+    {0xD83C, 300},
+    {0xD83C, 301},
+    {0xD83C, 302},
+    {0xD83C, 303},
+    {0xD83C, 304},
+    {0xD83C, 305},
+    {0xD83C, 306},
+    {0xD83C, 307},
+    {0xD83C, 308},
+    {0xD83C, 309},
+    {0xD83C, 310},
+    {0xD83C, 311},
+    {0xD83C, 312},
+    {0xD83C, 313},
+    {0xD83C, 314},
+    {0xD83C, 315},
+    {0xD83C, 316},
+    {0xD83C, 317},
+    {0xD83C, 318},
+    {0xD83C, 319},
+    {0xD83C, 320},
+    {0xD83C, 321},
+    {0xD83C, 322},
+    {0xD83C, 323},
+    {0xD83C, 324},
+    {0xD83C, 325},
+    {0xD83C, 326},
+    {0xD83C, 327},
+    {0xD83C, 328},
+    {0xD83C, 329},
+    {0xD83C, 330},
+    {0xD83C, 331},
+    {0xD83C, 332},
+    {0xD83C, 333},
+    {0xD83C, 334},
+    {0xD83C, 335},
+    {0xD83C, 336},
+    {0xD83C, 337},
+    {0xD83C, 348},
+    {0xD83C, 349},
+    {0xD83C, 350},
+    {0xD83C, 351},
+    {0xD83C, 352},
+    {0xD83C, 353},
+    {0xD83C, 354},
+    {0xD83C, 355},
+    {0xD83C, 356},
+    {0xD83C, 358},
+    {0xD83C, 359},
+    {0xD83C, 360},
+    {0xD83C, 361},
+    {0xD83C, 362},
+    {0xD83C, 363},
+    {0xD83C, 364},
+    {0xD83C, 365},
+    {0xD83C, 366},
+    {0xD83C, 367},
+    {0xD83C, 368},
+    {0xD83C, 369},
+    {0xD83C, 370},
+    {0xD83C, 372},
+    {0xD83C, 373},
+    {0xD83C, 374},
+    {0xD83C, 375},
+    {0xD83C, 376},
+    {0xD83C, 377},
+    {0xD83C, 378},
+    {0xD83C, 380},
+    {0xD83C, 381},
+    {0xD83C, 382},
+    {0xD83C, 383},
+    {0xD83C, 384},
+    {0xD83C, 385},
+    {0xD83C, 386},
+    {0xD83C, 387},
+    {0xD83C, 388},
+    {0xD83C, 389},
+    {0xD83C, 390},
+    {0xD83C, 391},
+    {0xD83C, 392},
+    {0xD83C, 393},
+    {0xD83C, 394},
+    {0xD83C, 395},
+    {0xD83C, 396},
+    {0xD83C, 397},
+    {0xD83C, 398},
+    {0xD83C, 399},
+    {0xD83C, 400},
+    {0xD83C, 401},
+    {0xD83C, 402},
+    {0xD83C, 403},
+    {0xD83C, 404},
+    {0xD83C, 405},
+    {0xD83C, 406},
+    {0xD83C, 407},
+    {0xD83C, 408},
+    {0xD83C, 409},
+    {0xD83C, 410},
+    {0xD83C, 411},
+    {0xD83C, 412},
+    {0xD83C, 413},
+    {0xD83C, 414},
+    {0xD83C, 415},
+    {0xD83C, 416},
+    {0xD83C, 417},
+    {0xD83C, 418},
+    {0xD83C, 419},
+    {0xD83C, 420},
+    {0xD83C, 421},
+    {0xD83C, 422},
+    {0xD83C, 423},
+    {0xD83C, 424},
+    {0xD83C, 425},
+    {0xD83C, 426},
+    {0xD83C, 427},
+    {0xD83C, 428},
+    {0xD83C, 429},
+    {0xD83C, 431},
+    {0xD83C, 432},
+    {0xD83C, 433},
+    {0xD83C, 434},
+    {0xD83C, 435},
+    {0xD83C, 436},
+    {0xD83C, 437},
+    {0xD83C, 438},
+    {0xD83C, 444},
+    {0xD83C, 445},
+    {0xD83C, 446},
+    {0xD83C, 447},
+    {0xD83C, 448},
+    {0xD83C, 449},
+    {0xD83C, 450},
+    {0xD83C, 451},
+    {0xD83C, 452},
+    {0xD83C, 453},
+    {0xD83C, 454},
+    {0xD83C, 455},
+    {0xD83C, 456},
+    {0xD83C, 457},
+    {0xD83C, 465},
+    {0xD83C, 466},
+    {0xD83C, 467},
+    {0xD83C, 468},
+    {0xD83C, 469},
+    {0xD83C, 470},
+    {0xD83C, 471},
+    {0xD83C, 472},
+    {0xD83C, 473},
+    {0xD83C, 474},
+    {0xD83C, 475},
+    {0xD83C, 476},
+    {0xD83C, 477},
+    {0xD83C, 478},
+    {0xD83C, 479},
+    {0xD83C, 480},
+    {0xD83C, 481},
+    {0xD83C, 482},
+    {0xD83C, 483},
+    {0xD83C, 484},
+    {0xD83C, 485},
+    {0xD83C, 486},
+    {0xD83C, 487},
+    {0xD83C, 488},
+    {0xD83C, 489},
+    {0xD83C, 490},
+    {0xD83C, 491},
+    {0xD83C, 492},
+    {0xD83C, 493},
+    {0xD83C, 494},
+    {0xD83C, 495},
+    {0xD83C, 496},
+    {0xD83C, 497},
+    {0xD83C, 498},
+    {0xD83C, 499},
+    {0xD83C, 535},
+    {0xD83C, 553},
+    {0xD83C, 559},
+    {0xD83C, 560},
+    {0xD83C, 561},
+    {0xD83C, 567},
+    {0xD83C, 568},
+    {0xD83C, 581},
+    {0xD83C, 625},
+    {0xD83C, 626},
+    {0xD83C, 627},
+    {0xD83C, 628},
+    {0xD83C, 629},
+    {0xD83C, 642},
+    {0xD83C, 643},
+    {0xD83C, 644},
+    {0xD83C, 645},
+    {0xD83C, 646},
+    {0xD83C, 647},
+    {0xD83C, 648},
+    {0xD83C, 649},
+    {0xD83C, 650},
+    {0xD83C, 651},
+    {0xD83C, 652},
+    {0xD83C, 653},
+    {0xD83C, 654},
+    {0xD83C, 655},
+    {0xD83C, 656},
+    {0xD83C, 657},
+    {0xD83C, 658},
+    {0xD83C, 666},
+    {0xD83C, 669},
+    {0xD83C, 670},
+    {0xD83C, 671},
+    {0xD83C, 672},
+    {0xD83C, 673},
+    {0xD83C, 674},
+    {0xD83C, 675},
+    {0xD83C, 676},
+    {0xD83D, 1066},
+    {0xD83D, 1067},
+    {0xD83D, 1068},
+    {0xD83D, 1069},
+    {0xD83D, 1070},
+    {0xD83D, 1071},
+    {0xD83D, 1072},
+    {0xD83D, 1073},
+    {0xD83D, 1074},
+    {0xD83D, 1075},
+    {0xD83D, 1076},
+    {0xD83D, 1077},
+    {0xD83D, 1078},
+    {0xD83D, 1079},
+    {0xD83D, 1080},
+    {0xD83D, 1081},
+    {0xD83D, 1082},
+    {0xD83D, 1083},
+    {0xD83D, 1084},
+    {0xD83D, 1085},
+    {0xD83D, 1086},
+    {0xD83D, 1087},
+    {0xD83D, 1088},
+    {0xD83D, 1089},
+    {0xD83D, 1090},
+    {0xD83D, 1322},
+    {0xD83D, 1323},
+    {0xD83D, 1324},
+    {0xD83D, 1325},
+    {0xD83D, 1326},
+    {0xD83D, 1327},
+    {0xD83D, 1328},
+    {0xD83D, 1329},
+    {0xD83D, 1330},
+    {0xD83D, 1331},
+    {0xD83D, 1332},
+    {0xD83D, 1333},
+    {0xD83D, 1334},
+    {0xD83D, 1335},
+    {0xD83D, 1336},
+    {0xD83D, 1337},
+    {0xD83D, 1338},
+    {0xD83D, 1339},
+    {0xD83D, 1340},
+    {0xD83D, 1341},
+    {0xD83D, 1342},
+    {0xD83D, 1343},
+    {0xD83D, 1344},
+    {0xD83D, 1345},
+    {0xD83D, 1346},
+    {0xD83D, 1348},
+    {0xD83D, 1349},
+    {0xD83D, 1350},
+    {0xD83D, 1351},
+    {0xD83D, 1352},
+    {0xD83D, 1353},
+    {0xD83D, 1354},
+    {0xD83D, 1355},
+    {0xD83D, 1356},
+    {0xD83D, 1357},
+    {0xD83D, 1358},
+    {0xD83D, 1359},
+    {0xD83D, 1360},
+    {0xD83D, 1361},
+    {0xD83D, 1362},
+    {0xD83D, 1363},
+    {0xD83D, 1364},
+    {0xD83D, 1365},
+    {0xD83D, 1366},
+    {0xD83D, 1367},
+    {0xD83D, 1368},
+    {0xD83D, 1369},
+    {0xD83D, 1370},
+    {0xD83D, 1371},
+    {0xD83D, 1372},
+    {0xD83D, 1040},
+    {0xD83D, 1041},
+    {0xD83D, 1042},
+    {0xD83D, 1043},
+    {0xD83D, 1044},
+    {0xD83D, 1045},
+    {0xD83D, 1046},
+    {0xD83D, 1047},
+    {0xD83D, 1048},
+    {0xD83D, 1049},
+    {0xD83D, 1050},
+    {0xD83D, 1051},
+    {0xD83D, 1052},
+    {0xD83D, 1053},
+    {0xD83D, 1054},
+    {0xD83D, 1055},
+    {0xD83D, 1056},
+    {0xD83D, 1057},
+    {0xD83D, 1058},
+    {0xD83D, 1059},
+    {0xD83D, 1060},
+    {0xD83D, 1061},
+    {0xD83D, 1062},
+    {0xD83D, 1063},
+    {0xD83D, 1064},
+    {0xD83D, 1270},
+    {0xD83D, 1271},
+    {0xD83D, 1272},
+    {0xD83D, 1273},
+    {0xD83D, 1274},
+    {0xD83D, 1275},
+    {0xD83D, 1276},
+    {0xD83D, 1277},
+    {0xD83D, 1278},
+    {0xD83D, 1279},
+    {0xD83D, 1280},
+    {0xD83D, 1281},
+    {0xD83D, 1282},
+    {0xD83D, 1283},
+    {0xD83D, 1284},
+    {0xD83D, 1285},
+    {0xD83D, 1286},
+    {0xD83D, 1287},
+    {0xD83D, 1288},
+    {0xD83D, 1289},
+    {0xD83D, 1290},
+    {0xD83D, 1291},
+    {0xD83D, 1292},
+    {0xD83D, 1293},
+    {0xD83D, 1294},
+    {0xD83D, 1296},
+    {0xD83D, 1297},
+    {0xD83D, 1298},
+    {0xD83D, 1299},
+    {0xD83D, 1300},
+    {0xD83D, 1301},
+    {0xD83D, 1302},
+    {0xD83D, 1303},
+    {0xD83D, 1304},
+    {0xD83D, 1305},
+    {0xD83D, 1306},
+    {0xD83D, 1307},
+    {0xD83D, 1308},
+    {0xD83D, 1309},
+    {0xD83D, 1310},
+    {0xD83D, 1311},
+    {0xD83D, 1312},
+    {0xD83D, 1313},
+    {0xD83D, 1314},
+    {0xD83D, 1315},
+    {0xD83D, 1316},
+    {0xD83D, 1317},
+    {0xD83D, 1318},
+    {0xD83D, 1319},
+    {0xD83D, 1320},
+    {0xD83D, 1386},
+    {0xD83D, 1387},
+    {0xD83D, 1388},
+    {0xD83D, 1389},
+    {0xD83D, 1390},
+    {0xD83D, 1391},
+    {0xD83D, 1392},
+    {0xD83D, 1393},
+    {0xD83D, 1394},
+    {0xD83D, 1395},
+    {0xD83D, 1396},
+    {0xD83D, 1397},
+    {0xD83D, 1398},
+    {0xD83D, 1399},
+    {0xD83D, 1400},
+    {0xD83D, 1401},
+    {0xD83D, 1402},
+    {0xD83D, 1403},
+    {0xD83D, 1404},
+    {0xD83D, 1405},
+    {0xD83D, 1412},
+    {0xD83D, 1413},
+    {0xD83D, 1414},
+    {0xD83D, 1415},
+    {0xD83D, 1416},
+    {0xD83D, 1417},
+    {0xD83D, 1418},
+    {0xD83D, 1419},
+    {0xD83D, 1420},
+    {0xD83D, 1421},
+    {0xD83D, 1422},
+    {0xD83D, 1423},
+    {0xD83D, 1424},
+    {0xD83D, 1425},
+    {0xD83D, 1426},
+    {0xD83D, 1427},
+    {0xD83D, 1428},
+    {0xD83D, 1429},
+    {0xD83D, 1430},
+    {0xD83D, 1431},
+    {0xD83D, 1438},
+    {0xD83D, 1439},
+    {0xD83D, 1440},
+    {0xD83D, 1441},
+    {0xD83D, 1442},
+    {0xD83D, 1443},
+    {0xD83D, 1444},
+    {0xD83D, 1445},
+    {0xD83D, 1446},
+    {0xD83D, 1447},
+    {0xD83D, 1448},
+    {0xD83D, 1449},
+    {0xD83D, 1450},
+    {0xD83D, 1451},
+    {0xD83D, 1452},
+    {0xD83D, 1453},
+    {0xD83D, 1454},
+    {0xD83D, 1455},
+    {0xD83D, 1456},
+    {0xD83D, 1457},
+    {0xD83D, 916},
+    {0xD83D, 918},
+    {0xD83D, 919},
+    {0xD83D, 921},
+    {0xD83D, 923},
+    {0xD83D, 924},
+    {0xD83D, 1065},
+    {0xD83D, 1151},
+    {0xD83D, 1153},
+    {0xD83D, 1154},
+    {0xD83D, 1321},
+    {0xD83D, 1347},
+    {0xD83D, 962},
+    {0xD83D, 963},
+    {0xD83D, 964},
+    {0xD83D, 965},
+    {0xD83D, 966},
+    {0xD83D, 998},
+    {0xD83D, 999},
+    {0xD83D, 1000},
+    {0xD83D, 1001},
+    {0xD83D, 1002},
+    {0xD83D, 1010},
+    {0xD83D, 1011},
+    {0xD83D, 1012},
+    {0xD83D, 1013},
+    {0xD83D, 1014},
+    {0xD83D, 1192},
+    {0xD83D, 1193},
+    {0xD83D, 1194},
+    {0xD83D, 1195},
+    {0xD83D, 1196},
+    {0xD83D, 1228},
+    {0xD83D, 1229},
+    {0xD83D, 1230},
+    {0xD83D, 1231},
+    {0xD83D, 1232},
+    {0xD83D, 1240},
+    {0xD83D, 1241},
+    {0xD83D, 1242},
+    {0xD83D, 1243},
+    {0xD83D, 1244},
+    {0xD83D, 2340},
+    {0xD83D, 2341},
+    {0xD83D, 2342},
+    {0xD83D, 2343},
+    {0xD83D, 2344},
+    {0xD83D, 2352},
+    {0xD83D, 2353},
+    {0xD83D, 2354},
+    {0xD83D, 2355},
+    {0xD83D, 2356},
+    {0xD83D, 910},
+    {0xD83D, 912},
+    {0xD83D, 913},
+    {0xD83D, 915},
+    {0xD83D, 917},
+    {0xD83D, 920},
+    {0xD83D, 922},
+    {0xD83D, 961},
+    {0xD83D, 997},
+    {0xD83D, 1009},
+    {0xD83D, 1039},
+    {0xD83D, 1145},
+    {0xD83D, 1147},
+    {0xD83D, 1148},
+    {0xD83D, 1150},
+    {0xD83D, 1152},
+    {0xD83D, 1191},
+    {0xD83D, 1227},
+    {0xD83D, 1239},
+    {0xD83D, 1269},
+    {0xD83D, 1295},
+    {0xD83D, 2339},
+    {0xD83D, 2351},
+    {0xD83D, 747},
+    {0xD83D, 863},
+    {0xD83D, 864},
+    {0xD83D, 865},
+    {0xD83D, 866},
+    {0xD83D, 867},
+    {0xD83D, 869},
+    {0xD83D, 870},
+    {0xD83D, 871},
+    {0xD83D, 872},
+    {0xD83D, 873},
+    {0xD83D, 875},
+    {0xD83D, 876},
+    {0xD83D, 877},
+    {0xD83D, 878},
+    {0xD83D, 879},
+    {0xD83D, 881},
+    {0xD83D, 882},
+    {0xD83D, 883},
+    {0xD83D, 884},
+    {0xD83D, 885},
+    {0xD83D, 887},
+    {0xD83D, 888},
+    {0xD83D, 889},
+    {0xD83D, 890},
+    {0xD83D, 891},
+    {0xD83D, 893},
+    {0xD83D, 894},
+    {0xD83D, 895},
+    {0xD83D, 896},
+    {0xD83D, 897},
+    {0xD83D, 899},
+    {0xD83D, 900},
+    {0xD83D, 901},
+    {0xD83D, 902},
+    {0xD83D, 903},
+    {0xD83D, 905},
+    {0xD83D, 906},
+    {0xD83D, 907},
+    {0xD83D, 908},
+    {0xD83D, 909},
+    {0xD83D, 926},
+    {0xD83D, 927},
+    {0xD83D, 928},
+    {0xD83D, 929},
+    {0xD83D, 930},
+    {0xD83D, 932},
+    {0xD83D, 933},
+    {0xD83D, 934},
+    {0xD83D, 935},
+    {0xD83D, 936},
+    {0xD83D, 938},
+    {0xD83D, 939},
+    {0xD83D, 940},
+    {0xD83D, 941},
+    {0xD83D, 942},
+    {0xD83D, 944},
+    {0xD83D, 945},
+    {0xD83D, 946},
+    {0xD83D, 947},
+    {0xD83D, 948},
+    {0xD83D, 950},
+    {0xD83D, 951},
+    {0xD83D, 952},
+    {0xD83D, 953},
+    {0xD83D, 954},
+    {0xD83D, 956},
+    {0xD83D, 957},
+    {0xD83D, 958},
+    {0xD83D, 959},
+    {0xD83D, 960},
+    {0xD83D, 968},
+    {0xD83D, 969},
+    {0xD83D, 970},
+    {0xD83D, 971},
+    {0xD83D, 972},
+    {0xD83D, 974},
+    {0xD83D, 975},
+    {0xD83D, 976},
+    {0xD83D, 977},
+    {0xD83D, 978},
+    {0xD83D, 980},
+    {0xD83D, 981},
+    {0xD83D, 982},
+    {0xD83D, 983},
+    {0xD83D, 984},
+    {0xD83D, 986},
+    {0xD83D, 987},
+    {0xD83D, 988},
+    {0xD83D, 989},
+    {0xD83D, 990},
+    {0xD83D, 992},
+    {0xD83D, 993},
+    {0xD83D, 994},
+    {0xD83D, 995},
+    {0xD83D, 996},
+    {0xD83D, 1004},
+    {0xD83D, 1005},
+    {0xD83D, 1006},
+    {0xD83D, 1007},
+    {0xD83D, 1008},
+    {0xD83D, 1016},
+    {0xD83D, 1017},
+    {0xD83D, 1018},
+    {0xD83D, 1019},
+    {0xD83D, 1020},
+    {0xD83D, 1022},
+    {0xD83D, 1023},
+    {0xD83D, 1024},
+    {0xD83D, 1025},
+    {0xD83D, 1026},
+    {0xD83D, 1028},
+    {0xD83D, 1029},
+    {0xD83D, 1030},
+    {0xD83D, 1031},
+    {0xD83D, 1032},
+    {0xD83D, 1034},
+    {0xD83D, 1035},
+    {0xD83D, 1036},
+    {0xD83D, 1037},
+    {0xD83D, 1038},
+    {0xD83D, 1098},
+    {0xD83D, 1099},
+    {0xD83D, 1100},
+    {0xD83D, 1101},
+    {0xD83D, 1102},
+    {0xD83D, 1104},
+    {0xD83D, 1105},
+    {0xD83D, 1106},
+    {0xD83D, 1107},
+    {0xD83D, 1108},
+    {0xD83D, 1110},
+    {0xD83D, 1111},
+    {0xD83D, 1112},
+    {0xD83D, 1113},
+    {0xD83D, 1114},
+    {0xD83D, 1116},
+    {0xD83D, 1117},
+    {0xD83D, 1118},
+    {0xD83D, 1119},
+    {0xD83D, 1120},
+    {0xD83D, 1122},
+    {0xD83D, 1123},
+    {0xD83D, 1124},
+    {0xD83D, 1125},
+    {0xD83D, 1126},
+    {0xD83D, 1128},
+    {0xD83D, 1129},
+    {0xD83D, 1130},
+    {0xD83D, 1131},
+    {0xD83D, 1132},
+    {0xD83D, 1134},
+    {0xD83D, 1135},
+    {0xD83D, 1136},
+    {0xD83D, 1137},
+    {0xD83D, 1138},
+    {0xD83D, 1140},
+    {0xD83D, 1141},
+    {0xD83D, 1142},
+    {0xD83D, 1143},
+    {0xD83D, 1144},
+    {0xD83D, 1156},
+    {0xD83D, 1157},
+    {0xD83D, 1158},
+    {0xD83D, 1159},
+    {0xD83D, 1160},
+    {0xD83D, 1162},
+    {0xD83D, 1163},
+    {0xD83D, 1164},
+    {0xD83D, 1165},
+    {0xD83D, 1166},
+    {0xD83D, 1168},
+    {0xD83D, 1169},
+    {0xD83D, 1170},
+    {0xD83D, 1171},
+    {0xD83D, 1172},
+    {0xD83D, 1174},
+    {0xD83D, 1175},
+    {0xD83D, 1176},
+    {0xD83D, 1177},
+    {0xD83D, 1178},
+    {0xD83D, 1180},
+    {0xD83D, 1181},
+    {0xD83D, 1182},
+    {0xD83D, 1183},
+    {0xD83D, 1184},
+    {0xD83D, 1186},
+    {0xD83D, 1187},
+    {0xD83D, 1188},
+    {0xD83D, 1189},
+    {0xD83D, 1190},
+    {0xD83D, 1198},
+    {0xD83D, 1199},
+    {0xD83D, 1200},
+    {0xD83D, 1201},
+    {0xD83D, 1202},
+    {0xD83D, 1204},
+    {0xD83D, 1205},
+    {0xD83D, 1206},
+    {0xD83D, 1207},
+    {0xD83D, 1208},
+    {0xD83D, 1210},
+    {0xD83D, 1211},
+    {0xD83D, 1212},
+    {0xD83D, 1213},
+    {0xD83D, 1214},
+    {0xD83D, 1216},
+    {0xD83D, 1217},
+    {0xD83D, 1218},
+    {0xD83D, 1219},
+    {0xD83D, 1220},
+    {0xD83D, 1222},
+    {0xD83D, 1223},
+    {0xD83D, 1224},
+    {0xD83D, 1225},
+    {0xD83D, 1226},
+    {0xD83D, 1234},
+    {0xD83D, 1235},
+    {0xD83D, 1236},
+    {0xD83D, 1237},
+    {0xD83D, 1238},
+    {0xD83D, 1246},
+    {0xD83D, 1247},
+    {0xD83D, 1248},
+    {0xD83D, 1249},
+    {0xD83D, 1250},
+    {0xD83D, 1252},
+    {0xD83D, 1253},
+    {0xD83D, 1254},
+    {0xD83D, 1255},
+    {0xD83D, 1256},
+    {0xD83D, 1258},
+    {0xD83D, 1259},
+    {0xD83D, 1260},
+    {0xD83D, 1261},
+    {0xD83D, 1262},
+    {0xD83D, 1264},
+    {0xD83D, 1265},
+    {0xD83D, 1266},
+    {0xD83D, 1267},
+    {0xD83D, 1268},
+    {0xD83D, 1459},
+    {0xD83D, 1460},
+    {0xD83D, 1461},
+    {0xD83D, 1462},
+    {0xD83D, 1463},
+    {0xD83D, 1465},
+    {0xD83D, 1466},
+    {0xD83D, 1467},
+    {0xD83D, 1468},
+    {0xD83D, 1469},
+    {0xD83D, 1480},
+    {0xD83D, 1481},
+    {0xD83D, 1482},
+    {0xD83D, 1483},
+    {0xD83D, 1484},
+    {0xD83D, 1486},
+    {0xD83D, 1487},
+    {0xD83D, 1488},
+    {0xD83D, 1489},
+    {0xD83D, 1490},
+    {0xD83D, 1498},
+    {0xD83D, 1499},
+    {0xD83D, 1500},
+    {0xD83D, 1501},
+    {0xD83D, 1502},
+    {0xD83D, 1504},
+    {0xD83D, 1505},
+    {0xD83D, 1506},
+    {0xD83D, 1507},
+    {0xD83D, 1508},
+    {0xD83D, 1522},
+    {0xD83D, 1523},
+    {0xD83D, 1524},
+    {0xD83D, 1525},
+    {0xD83D, 1526},
+    {0xD83D, 1528},
+    {0xD83D, 1529},
+    {0xD83D, 1530},
+    {0xD83D, 1531},
+    {0xD83D, 1532},
+    {0xD83D, 1558},
+    {0xD83D, 1559},
+    {0xD83D, 1560},
+    {0xD83D, 1561},
+    {0xD83D, 1562},
+    {0xD83D, 1564},
+    {0xD83D, 1565},
+    {0xD83D, 1566},
+    {0xD83D, 1567},
+    {0xD83D, 1568},
+    {0xD83D, 1595},
+    {0xD83D, 1596},
+    {0xD83D, 1597},
+    {0xD83D, 1598},
+    {0xD83D, 1599},
+    {0xD83D, 1601},
+    {0xD83D, 1602},
+    {0xD83D, 1603},
+    {0xD83D, 1604},
+    {0xD83D, 1605},
+    {0xD83D, 1613},
+    {0xD83D, 1614},
+    {0xD83D, 1615},
+    {0xD83D, 1616},
+    {0xD83D, 1617},
+    {0xD83D, 1619},
+    {0xD83D, 1620},
+    {0xD83D, 1621},
+    {0xD83D, 1622},
+    {0xD83D, 1623},
+    {0xD83D, 1644},
+    {0xD83D, 1645},
+    {0xD83D, 1646},
+    {0xD83D, 1647},
+    {0xD83D, 1648},
+    {0xD83D, 1650},
+    {0xD83D, 1651},
+    {0xD83D, 1652},
+    {0xD83D, 1653},
+    {0xD83D, 1654},
+    {0xD83D, 1662},
+    {0xD83D, 1663},
+    {0xD83D, 1664},
+    {0xD83D, 1665},
+    {0xD83D, 1666},
+    {0xD83D, 1668},
+    {0xD83D, 1669},
+    {0xD83D, 1670},
+    {0xD83D, 1671},
+    {0xD83D, 1672},
+    {0xD83D, 1955},
+    {0xD83D, 1956},
+    {0xD83D, 1957},
+    {0xD83D, 1958},
+    {0xD83D, 1959},
+    {0xD83D, 1961},
+    {0xD83D, 1962},
+    {0xD83D, 1963},
+    {0xD83D, 1964},
+    {0xD83D, 1965},
+    {0xD83D, 2106},
+    {0xD83D, 2107},
+    {0xD83D, 2108},
+    {0xD83D, 2109},
+    {0xD83D, 2110},
+    {0xD83D, 2112},
+    {0xD83D, 2113},
+    {0xD83D, 2114},
+    {0xD83D, 2115},
+    {0xD83D, 2116},
+    {0xD83D, 2124},
+    {0xD83D, 2125},
+    {0xD83D, 2126},
+    {0xD83D, 2127},
+    {0xD83D, 2128},
+    {0xD83D, 2130},
+    {0xD83D, 2131},
+    {0xD83D, 2132},
+    {0xD83D, 2133},
+    {0xD83D, 2134},
+    {0xD83D, 2142},
+    {0xD83D, 2143},
+    {0xD83D, 2144},
+    {0xD83D, 2145},
+    {0xD83D, 2146},
+    {0xD83D, 2148},
+    {0xD83D, 2149},
+    {0xD83D, 2150},
+    {0xD83D, 2151},
+    {0xD83D, 2152},
+    {0xD83D, 2163},
+    {0xD83D, 2164},
+    {0xD83D, 2165},
+    {0xD83D, 2166},
+    {0xD83D, 2167},
+    {0xD83D, 2169},
+    {0xD83D, 2170},
+    {0xD83D, 2171},
+    {0xD83D, 2172},
+    {0xD83D, 2173},
+    {0xD83D, 2187},
+    {0xD83D, 2188},
+    {0xD83D, 2189},
+    {0xD83D, 2190},
+    {0xD83D, 2191},
+    {0xD83D, 2193},
+    {0xD83D, 2194},
+    {0xD83D, 2195},
+    {0xD83D, 2196},
+    {0xD83D, 2197},
+    {0xD83D, 2205},
+    {0xD83D, 2206},
+    {0xD83D, 2207},
+    {0xD83D, 2208},
+    {0xD83D, 2209},
+    {0xD83D, 2211},
+    {0xD83D, 2212},
+    {0xD83D, 2213},
+    {0xD83D, 2214},
+    {0xD83D, 2215},
+    {0xD83D, 2264},
+    {0xD83D, 2265},
+    {0xD83D, 2266},
+    {0xD83D, 2267},
+    {0xD83D, 2268},
+    {0xD83D, 2270},
+    {0xD83D, 2271},
+    {0xD83D, 2272},
+    {0xD83D, 2273},
+    {0xD83D, 2274},
+    {0xD83D, 2298},
+    {0xD83D, 2299},
+    {0xD83D, 2300},
+    {0xD83D, 2301},
+    {0xD83D, 2302},
+    {0xD83D, 2304},
+    {0xD83D, 2305},
+    {0xD83D, 2306},
+    {0xD83D, 2307},
+    {0xD83D, 2308},
+    {0xD83D, 2316},
+    {0xD83D, 2317},
+    {0xD83D, 2318},
+    {0xD83D, 2319},
+    {0xD83D, 2320},
+    {0xD83D, 2322},
+    {0xD83D, 2323},
+    {0xD83D, 2324},
+    {0xD83D, 2325},
+    {0xD83D, 2326},
+    {0xD83D, 2334},
+    {0xD83D, 2335},
+    {0xD83D, 2336},
+    {0xD83D, 2337},
+    {0xD83D, 2338},
+    {0xD83D, 2346},
+    {0xD83D, 2347},
+    {0xD83D, 2348},
+    {0xD83D, 2349},
+    {0xD83D, 2350},
+    {0xD83D, 2358},
+    {0xD83D, 2359},
+    {0xD83D, 2360},
+    {0xD83D, 2361},
+    {0xD83D, 2362},
+    {0xD83D, 1954},
+    {0xD83D, 1960},
+    {0xD83D, 2087},
+    {0xD83D, 699},
+    {0xD83D, 717},
+    {0xD83D, 740},
+    {0xD83D, 862},
+    {0xD83D, 868},
+    {0xD83D, 874},
+    {0xD83D, 880},
+    {0xD83D, 886},
+    {0xD83D, 892},
+    {0xD83D, 898},
+    {0xD83D, 904},
+    {0xD83D, 911},
+    {0xD83D, 914},
+    {0xD83D, 925},
+    {0xD83D, 931},
+    {0xD83D, 937},
+    {0xD83D, 943},
+    {0xD83D, 949},
+    {0xD83D, 955},
+    {0xD83D, 967},
+    {0xD83D, 973},
+    {0xD83D, 979},
+    {0xD83D, 985},
+    {0xD83D, 991},
+    {0xD83D, 1003},
+    {0xD83D, 1015},
+    {0xD83D, 1021},
+    {0xD83D, 1027},
+    {0xD83D, 1033},
+    {0xD83D, 1097},
+    {0xD83D, 1103},
+    {0xD83D, 1109},
+    {0xD83D, 1115},
+    {0xD83D, 1121},
+    {0xD83D, 1127},
+    {0xD83D, 1133},
+    {0xD83D, 1139},
+    {0xD83D, 1146},
+    {0xD83D, 1149},
+    {0xD83D, 1155},
+    {0xD83D, 1161},
+    {0xD83D, 1167},
+    {0xD83D, 1173},
+    {0xD83D, 1179},
+    {0xD83D, 1185},
+    {0xD83D, 1197},
+    {0xD83D, 1203},
+    {0xD83D, 1209},
+    {0xD83D, 1215},
+    {0xD83D, 1221},
+    {0xD83D, 1233},
+    {0xD83D, 1245},
+    {0xD83D, 1251},
+    {0xD83D, 1257},
+    {0xD83D, 1263},
+    {0xD83D, 1458},
+    {0xD83D, 1464},
+    {0xD83D, 1476},
+    {0xD83D, 1477},
+    {0xD83D, 1479},
+    {0xD83D, 1485},
+    {0xD83D, 1497},
+    {0xD83D, 1503},
+    {0xD83D, 1521},
+    {0xD83D, 1527},
+    {0xD83D, 1557},
+    {0xD83D, 1563},
+    {0xD83D, 1594},
+    {0xD83D, 1600},
+    {0xD83D, 1612},
+    {0xD83D, 1618},
+    {0xD83D, 1643},
+    {0xD83D, 1649},
+    {0xD83D, 1661},
+    {0xD83D, 1667},
+    {0xD83D, 2077},
+    {0xD83D, 2085},
+    {0xD83D, 2100},
+    {0xD83D, 2101},
+    {0xD83D, 2105},
+    {0xD83D, 2111},
+    {0xD83D, 2123},
+    {0xD83D, 2129},
+    {0xD83D, 2141},
+    {0xD83D, 2147},
+    {0xD83D, 2162},
+    {0xD83D, 2168},
+    {0xD83D, 2186},
+    {0xD83D, 2192},
+    {0xD83D, 2204},
+    {0xD83D, 2210},
+    {0xD83D, 2263},
+    {0xD83D, 2269},
+    {0xD83D, 2297},
+    {0xD83D, 2303},
+    {0xD83D, 2315},
+    {0xD83D, 2321},
+    {0xD83D, 2333},
+    {0xD83D, 2345},
+    {0xD83D, 2357},
+    {0xD83D, 685},
+    {0xD83D, 718},
+    {0xD83D, 750},
+    {0xD83D, 751},
+    {0xD83D, 752},
+    {0xD83D, 753},
+    {0xD83D, 754},
+    {0xD83D, 756},
+    {0xD83D, 757},
+    {0xD83D, 758},
+    {0xD83D, 759},
+    {0xD83D, 760},
+    {0xD83D, 764},
+    {0xD83D, 765},
+    {0xD83D, 766},
+    {0xD83D, 767},
+    {0xD83D, 768},
+    {0xD83D, 770},
+    {0xD83D, 771},
+    {0xD83D, 772},
+    {0xD83D, 773},
+    {0xD83D, 774},
+    {0xD83D, 776},
+    {0xD83D, 777},
+    {0xD83D, 778},
+    {0xD83D, 779},
+    {0xD83D, 780},
+    {0xD83D, 782},
+    {0xD83D, 783},
+    {0xD83D, 784},
+    {0xD83D, 785},
+    {0xD83D, 786},
+    {0xD83D, 788},
+    {0xD83D, 789},
+    {0xD83D, 790},
+    {0xD83D, 791},
+    {0xD83D, 792},
+    {0xD83D, 794},
+    {0xD83D, 795},
+    {0xD83D, 796},
+    {0xD83D, 797},
+    {0xD83D, 798},
+    {0xD83D, 800},
+    {0xD83D, 801},
+    {0xD83D, 802},
+    {0xD83D, 803},
+    {0xD83D, 804},
+    {0xD83D, 806},
+    {0xD83D, 807},
+    {0xD83D, 808},
+    {0xD83D, 809},
+    {0xD83D, 810},
+    {0xD83D, 812},
+    {0xD83D, 813},
+    {0xD83D, 814},
+    {0xD83D, 815},
+    {0xD83D, 816},
+    {0xD83D, 818},
+    {0xD83D, 819},
+    {0xD83D, 820},
+    {0xD83D, 821},
+    {0xD83D, 822},
+    {0xD83D, 824},
+    {0xD83D, 825},
+    {0xD83D, 826},
+    {0xD83D, 827},
+    {0xD83D, 828},
+    {0xD83D, 851},
+    {0xD83D, 852},
+    {0xD83D, 853},
+    {0xD83D, 854},
+    {0xD83D, 855},
+    {0xD83D, 857},
+    {0xD83D, 858},
+    {0xD83D, 859},
+    {0xD83D, 860},
+    {0xD83D, 861},
+    {0xD83D, 1092},
+    {0xD83D, 1093},
+    {0xD83D, 1094},
+    {0xD83D, 1095},
+    {0xD83D, 1096},
+    {0xD83D, 1374},
+    {0xD83D, 1375},
+    {0xD83D, 1376},
+    {0xD83D, 1377},
+    {0xD83D, 1378},
+    {0xD83D, 1381},
+    {0xD83D, 1382},
+    {0xD83D, 1383},
+    {0xD83D, 1384},
+    {0xD83D, 1385},
+    {0xD83D, 1407},
+    {0xD83D, 1408},
+    {0xD83D, 1409},
+    {0xD83D, 1410},
+    {0xD83D, 1411},
+    {0xD83D, 1433},
+    {0xD83D, 1434},
+    {0xD83D, 1435},
+    {0xD83D, 1436},
+    {0xD83D, 1437},
+    {0xD83D, 1471},
+    {0xD83D, 1472},
+    {0xD83D, 1473},
+    {0xD83D, 1474},
+    {0xD83D, 1475},
+    {0xD83D, 1492},
+    {0xD83D, 1493},
+    {0xD83D, 1494},
+    {0xD83D, 1495},
+    {0xD83D, 1496},
+    {0xD83D, 1510},
+    {0xD83D, 1511},
+    {0xD83D, 1512},
+    {0xD83D, 1513},
+    {0xD83D, 1514},
+    {0xD83D, 1516},
+    {0xD83D, 1517},
+    {0xD83D, 1518},
+    {0xD83D, 1519},
+    {0xD83D, 1520},
+    {0xD83D, 1534},
+    {0xD83D, 1535},
+    {0xD83D, 1536},
+    {0xD83D, 1537},
+    {0xD83D, 1538},
+    {0xD83D, 1540},
+    {0xD83D, 1541},
+    {0xD83D, 1542},
+    {0xD83D, 1543},
+    {0xD83D, 1544},
+    {0xD83D, 1546},
+    {0xD83D, 1547},
+    {0xD83D, 1548},
+    {0xD83D, 1549},
+    {0xD83D, 1550},
+    {0xD83D, 1552},
+    {0xD83D, 1553},
+    {0xD83D, 1554},
+    {0xD83D, 1555},
+    {0xD83D, 1556},
+    {0xD83D, 1570},
+    {0xD83D, 1571},
+    {0xD83D, 1572},
+    {0xD83D, 1573},
+    {0xD83D, 1574},
+    {0xD83D, 1576},
+    {0xD83D, 1577},
+    {0xD83D, 1578},
+    {0xD83D, 1579},
+    {0xD83D, 1580},
+    {0xD83D, 1585},
+    {0xD83D, 1586},
+    {0xD83D, 1587},
+    {0xD83D, 1588},
+    {0xD83D, 1589},
+    {0xD83D, 1607},
+    {0xD83D, 1608},
+    {0xD83D, 1609},
+    {0xD83D, 1610},
+    {0xD83D, 1611},
+    {0xD83D, 1625},
+    {0xD83D, 1626},
+    {0xD83D, 1627},
+    {0xD83D, 1628},
+    {0xD83D, 1629},
+    {0xD83D, 1631},
+    {0xD83D, 1632},
+    {0xD83D, 1633},
+    {0xD83D, 1634},
+    {0xD83D, 1635},
+    {0xD83D, 1638},
+    {0xD83D, 1639},
+    {0xD83D, 1640},
+    {0xD83D, 1641},
+    {0xD83D, 1642},
+    {0xD83D, 1656},
+    {0xD83D, 1657},
+    {0xD83D, 1658},
+    {0xD83D, 1659},
+    {0xD83D, 1660},
+    {0xD83D, 1674},
+    {0xD83D, 1675},
+    {0xD83D, 1676},
+    {0xD83D, 1677},
+    {0xD83D, 1678},
+    {0xD83D, 1687},
+    {0xD83D, 1688},
+    {0xD83D, 1689},
+    {0xD83D, 1690},
+    {0xD83D, 1691},
+    {0xD83D, 1714},
+    {0xD83D, 1715},
+    {0xD83D, 1716},
+    {0xD83D, 1717},
+    {0xD83D, 1718},
+    {0xD83D, 1764},
+    {0xD83D, 1765},
+    {0xD83D, 1766},
+    {0xD83D, 1767},
+    {0xD83D, 1768},
+    {0xD83D, 1949},
+    {0xD83D, 1950},
+    {0xD83D, 1951},
+    {0xD83D, 1952},
+    {0xD83D, 1953},
+    {0xD83D, 1967},
+    {0xD83D, 1968},
+    {0xD83D, 1969},
+    {0xD83D, 1970},
+    {0xD83D, 1971},
+    {0xD83D, 1977},
+    {0xD83D, 1978},
+    {0xD83D, 1979},
+    {0xD83D, 1980},
+    {0xD83D, 1981},
+    {0xD83D, 1988},
+    {0xD83D, 1989},
+    {0xD83D, 1990},
+    {0xD83D, 1991},
+    {0xD83D, 1992},
+    {0xD83D, 1994},
+    {0xD83D, 1995},
+    {0xD83D, 1996},
+    {0xD83D, 1997},
+    {0xD83D, 1998},
+    {0xD83D, 2000},
+    {0xD83D, 2001},
+    {0xD83D, 2002},
+    {0xD83D, 2003},
+    {0xD83D, 2004},
+    {0xD83D, 2118},
+    {0xD83D, 2119},
+    {0xD83D, 2120},
+    {0xD83D, 2121},
+    {0xD83D, 2122},
+    {0xD83D, 2136},
+    {0xD83D, 2137},
+    {0xD83D, 2138},
+    {0xD83D, 2139},
+    {0xD83D, 2140},
+    {0xD83D, 2154},
+    {0xD83D, 2155},
+    {0xD83D, 2156},
+    {0xD83D, 2157},
+    {0xD83D, 2158},
+    {0xD83D, 2175},
+    {0xD83D, 2176},
+    {0xD83D, 2177},
+    {0xD83D, 2178},
+    {0xD83D, 2179},
+    {0xD83D, 2181},
+    {0xD83D, 2182},
+    {0xD83D, 2183},
+    {0xD83D, 2184},
+    {0xD83D, 2185},
+    {0xD83D, 2199},
+    {0xD83D, 2200},
+    {0xD83D, 2201},
+    {0xD83D, 2202},
+    {0xD83D, 2203},
+    {0xD83D, 2217},
+    {0xD83D, 2218},
+    {0xD83D, 2219},
+    {0xD83D, 2220},
+    {0xD83D, 2221},
+    {0xD83D, 2223},
+    {0xD83D, 2224},
+    {0xD83D, 2225},
+    {0xD83D, 2226},
+    {0xD83D, 2227},
+    {0xD83D, 2276},
+    {0xD83D, 2277},
+    {0xD83D, 2278},
+    {0xD83D, 2279},
+    {0xD83D, 2280},
+    {0xD83D, 2310},
+    {0xD83D, 2311},
+    {0xD83D, 2312},
+    {0xD83D, 2313},
+    {0xD83D, 2314},
+    {0xD83D, 2328},
+    {0xD83D, 2329},
+    {0xD83D, 2330},
+    {0xD83D, 2331},
+    {0xD83D, 2332},
+    {0xD83D, 2364},
+    {0xD83D, 2365},
+    {0xD83D, 2366},
+    {0xD83D, 2367},
+    {0xD83D, 2368},
+    {0xD83D, 2379},
+    {0xD83D, 2380},
+    {0xD83D, 2381},
+    {0xD83D, 2382},
+    {0xD83D, 2383},
+    {0xD83D, 2391},
+    {0xD83D, 2392},
+    {0xD83D, 2393},
+    {0xD83D, 2394},
+    {0xD83D, 2395},
+    {0xD83D, 745},
+    {0xD83D, 748},
+    {0xD83D, 1851},
+    {0xD83D, 1915},
+    {0xD83D, 1916},
+    {0xD83D, 1945},
+    {0xD83D, 1946},
+    {0xD83D, 1947},
+    {0xD83D, 1948},
+    {0xD83D, 1966},
+    {0xD83D, 1972},
+    {0xD83D, 1973},
+    {0xD83D, 1974},
+    {0xD83D, 1975},
+    {0xD83D, 1982},
+    {0xD83D, 1983},
+    {0xD83D, 1984},
+    {0xD83D, 1985},
+    {0xD83D, 1986},
+    {0xD83D, 1987},
+    {0xD83D, 2006},
+    {0xD83D, 2007},
+    {0xD83D, 2008},
+    {0xD83D, 2009},
+    {0xD83D, 2010},
+    {0xD83D, 2011},
+    {0xD83D, 2012},
+    {0xD83D, 2013},
+    {0xD83D, 2014},
+    {0xD83D, 2015},
+    {0xD83D, 2016},
+    {0xD83D, 2017},
+    {0xD83D, 2018},
+    {0xD83D, 2019},
+    {0xD83D, 2020},
+    {0xD83D, 2021},
+    {0xD83D, 2022},
+    {0xD83D, 2023},
+    {0xD83D, 2024},
+    {0xD83D, 2025},
+    {0xD83D, 2389},
+    {0xD83D, 2396},
+    {0xD83D, 2397},
+    {0xD83D, 2398},
+    {0xD83D, 2409},
+    {0xD83D, 2410},
+    {0xD83D, 2411},
+    {0xD83D, 2412},
+    {0xD83D, 2413},
+    {0xD83D, 2414},
+    {0xD83D, 2415},
+    {0xD83D, 2418},
+    {0xD83D, 2419},
+    {0xD83D, 677},
+    {0xD83D, 678},
+    {0xD83D, 679},
+    {0xD83D, 680},
+    {0xD83D, 681},
+    {0xD83D, 682},
+    {0xD83D, 683},
+    {0xD83D, 684},
+    {0xD83D, 686},
+    {0xD83D, 687},
+    {0xD83D, 688},
+    {0xD83D, 689},
+    {0xD83D, 690},
+    {0xD83D, 691},
+    {0xD83D, 692},
+    {0xD83D, 693},
+    {0xD83D, 694},
+    {0xD83D, 695},
+    {0xD83D, 696},
+    {0xD83D, 697},
+    {0xD83D, 698},
+    {0xD83D, 700},
+    {0xD83D, 701},
+    {0xD83D, 702},
+    {0xD83D, 703},
+    {0xD83D, 704},
+    {0xD83D, 705},
+    {0xD83D, 706},
+    {0xD83D, 707},
+    {0xD83D, 708},
+    {0xD83D, 709},
+    {0xD83D, 710},
+    {0xD83D, 711},
+    {0xD83D, 712},
+    {0xD83D, 713},
+    {0xD83D, 714},
+    {0xD83D, 715},
+    {0xD83D, 716},
+    {0xD83D, 719},
+    {0xD83D, 720},
+    {0xD83D, 721},
+    {0xD83D, 722},
+    {0xD83D, 723},
+    {0xD83D, 724},
+    {0xD83D, 725},
+    {0xD83D, 726},
+    {0xD83D, 727},
+    {0xD83D, 728},
+    {0xD83D, 729},
+    {0xD83D, 730},
+    {0xD83D, 731},
+    {0xD83D, 732},
+    {0xD83D, 733},
+    {0xD83D, 734},
+    {0xD83D, 735},
+    {0xD83D, 736},
+    {0xD83D, 737},
+    {0xD83D, 738},
+    {0xD83D, 739},
+    {0xD83D, 741},
+    {0xD83D, 742},
+    {0xD83D, 743},
+    {0xD83D, 744},
+    {0xD83D, 746},
+    {0xD83D, 749},
+    {0xD83D, 755},
+    {0xD83D, 761},
+    {0xD83D, 762},
+    {0xD83D, 763},
+    {0xD83D, 769},
+    {0xD83D, 775},
+    {0xD83D, 781},
+    {0xD83D, 787},
+    {0xD83D, 793},
+    {0xD83D, 799},
+    {0xD83D, 805},
+    {0xD83D, 811},
+    {0xD83D, 817},
+    {0xD83D, 823},
+    {0xD83D, 829},
+    {0xD83D, 830},
+    {0xD83D, 831},
+    {0xD83D, 832},
+    {0xD83D, 833},
+    {0xD83D, 834},
+    {0xD83D, 835},
+    {0xD83D, 836},
+    {0xD83D, 837},
+    {0xD83D, 838},
+    {0xD83D, 839},
+    {0xD83D, 840},
+    {0xD83D, 841},
+    {0xD83D, 842},
+    {0xD83D, 843},
+    {0xD83D, 844},
+    {0xD83D, 845},
+    {0xD83D, 846},
+    {0xD83D, 847},
+    {0xD83D, 848},
+    {0xD83D, 849},
+    {0xD83D, 850},
+    {0xD83D, 856},
+    {0xD83D, 1091},
+    {0xD83D, 1373},
+    {0xD83D, 1379},
+    {0xD83D, 1380},
+    {0xD83D, 1406},
+    {0xD83D, 1432},
+    {0xD83D, 1470},
+    {0xD83D, 1478},
+    {0xD83D, 1491},
+    {0xD83D, 1509},
+    {0xD83D, 1515},
+    {0xD83D, 1533},
+    {0xD83D, 1539},
+    {0xD83D, 1545},
+    {0xD83D, 1551},
+    {0xD83D, 1569},
+    {0xD83D, 1575},
+    {0xD83D, 1581},
+    {0xD83D, 1582},
+    {0xD83D, 1583},
+    {0xD83D, 1584},
+    {0xD83D, 1590},
+    {0xD83D, 1591},
+    {0xD83D, 1592},
+    {0xD83D, 1593},
+    {0xD83D, 1606},
+    {0xD83D, 1624},
+    {0xD83D, 1630},
+    {0xD83D, 1636},
+    {0xD83D, 1637},
+    {0xD83D, 1655},
+    {0xD83D, 1673},
+    {0xD83D, 1679},
+    {0xD83D, 1680},
+    {0xD83D, 1681},
+    {0xD83D, 1682},
+    {0xD83D, 1683},
+    {0xD83D, 1684},
+    {0xD83D, 1685},
+    {0xD83D, 1686},
+    {0xD83D, 1712},
+    {0xD83D, 1713},
+    {0xD83D, 1739},
+    {0xD83D, 1740},
+    {0xD83D, 1741},
+    {0xD83D, 1742},
+    {0xD83D, 1743},
+    {0xD83D, 1744},
+    {0xD83D, 1745},
+    {0xD83D, 1746},
+    {0xD83D, 1747},
+    {0xD83D, 1748},
+    {0xD83D, 1749},
+    {0xD83D, 1750},
+    {0xD83D, 1751},
+    {0xD83D, 1752},
+    {0xD83D, 1753},
+    {0xD83D, 1754},
+    {0xD83D, 1755},
+    {0xD83D, 1756},
+    {0xD83D, 1757},
+    {0xD83D, 1758},
+    {0xD83D, 1759},
+    {0xD83D, 1760},
+    {0xD83D, 1761},
+    {0xD83D, 1762},
+    {0xD83D, 1763},
+    {0xD83D, 1769},
+    {0xD83D, 1770},
+    {0xD83D, 1771},
+    {0xD83D, 1772},
+    {0xD83D, 1773},
+    {0xD83D, 1774},
+    {0xD83D, 1775},
+    {0xD83D, 1776},
+    {0xD83D, 1777},
+    {0xD83D, 1778},
+    {0xD83D, 1779},
+    {0xD83D, 1780},
+    {0xD83D, 1781},
+    {0xD83D, 1782},
+    {0xD83D, 1783},
+    {0xD83D, 1784},
+    {0xD83D, 1785},
+    {0xD83D, 1786},
+    {0xD83D, 1787},
+    {0xD83D, 1788},
+    {0xD83D, 1789},
+    {0xD83D, 1790},
+    {0xD83D, 1791},
+    {0xD83D, 1792},
+    {0xD83D, 1793},
+    {0xD83D, 1794},
+    {0xD83D, 1795},
+    {0xD83D, 1796},
+    {0xD83D, 1797},
+    {0xD83D, 1798},
+    {0xD83D, 1799},
+    {0xD83D, 1800},
+    {0xD83D, 1801},
+    {0xD83D, 1802},
+    {0xD83D, 1803},
+    {0xD83D, 1804},
+    {0xD83D, 1805},
+    {0xD83D, 1806},
+    {0xD83D, 1807},
+    {0xD83D, 1808},
+    {0xD83D, 1809},
+    {0xD83D, 1810},
+    {0xD83D, 1811},
+    {0xD83D, 1812},
+    {0xD83D, 1813},
+    {0xD83D, 1814},
+    {0xD83D, 1815},
+    {0xD83D, 1816},
+    {0xD83D, 1817},
+    {0xD83D, 1818},
+    {0xD83D, 1819},
+    {0xD83D, 1820},
+    {0xD83D, 1821},
+    {0xD83D, 1822},
+    {0xD83D, 1823},
+    {0xD83D, 1824},
+    {0xD83D, 1825},
+    {0xD83D, 1826},
+    {0xD83D, 1827},
+    {0xD83D, 1828},
+    {0xD83D, 1829},
+    {0xD83D, 1830},
+    {0xD83D, 1831},
+    {0xD83D, 1832},
+    {0xD83D, 1833},
+    {0xD83D, 1834},
+    {0xD83D, 1835},
+    {0xD83D, 1836},
+    {0xD83D, 1837},
+    {0xD83D, 1838},
+    {0xD83D, 1839},
+    {0xD83D, 1840},
+    {0xD83D, 1841},
+    {0xD83D, 1842},
+    {0xD83D, 1843},
+    {0xD83D, 1844},
+    {0xD83D, 1845},
+    {0xD83D, 1846},
+    {0xD83D, 1847},
+    {0xD83D, 1848},
+    {0xD83D, 1849},
+    {0xD83D, 1850},
+    {0xD83D, 1852},
+    {0xD83D, 1853},
+    {0xD83D, 1854},
+    {0xD83D, 1855},
+    {0xD83D, 1856},
+    {0xD83D, 1857},
+    {0xD83D, 1858},
+    {0xD83D, 1859},
+    {0xD83D, 1860},
+    {0xD83D, 1861},
+    {0xD83D, 1862},
+    {0xD83D, 1863},
+    {0xD83D, 1864},
+    {0xD83D, 1865},
+    {0xD83D, 1866},
+    {0xD83D, 1867},
+    {0xD83D, 1868},
+    {0xD83D, 1869},
+    {0xD83D, 1870},
+    {0xD83D, 1871},
+    {0xD83D, 1872},
+    {0xD83D, 1873},
+    {0xD83D, 1874},
+    {0xD83D, 1875},
+    {0xD83D, 1876},
+    {0xD83D, 1877},
+    {0xD83D, 1878},
+    {0xD83D, 1879},
+    {0xD83D, 1880},
+    {0xD83D, 1881},
+    {0xD83D, 1882},
+    {0xD83D, 1883},
+    {0xD83D, 1884},
+    {0xD83D, 1885},
+    {0xD83D, 1886},
+    {0xD83D, 1887},
+    {0xD83D, 1888},
+    {0xD83D, 1889},
+    {0xD83D, 1890},
+    {0xD83D, 1891},
+    {0xD83D, 1892},
+    {0xD83D, 1893},
+    {0xD83D, 1894},
+    {0xD83D, 1895},
+    {0xD83D, 1896},
+    {0xD83D, 1897},
+    {0xD83D, 1898},
+    {0xD83D, 1899},
+    {0xD83D, 1900},
+    {0xD83D, 1901},
+    {0xD83D, 1902},
+    {0xD83D, 1903},
+    {0xD83D, 1904},
+    {0xD83D, 1905},
+    {0xD83D, 1906},
+    {0xD83D, 1907},
+    {0xD83D, 1908},
+    {0xD83D, 1909},
+    {0xD83D, 1910},
+    {0xD83D, 1911},
+    {0xD83D, 1912},
+    {0xD83D, 1913},
+    {0xD83D, 1914},
+    {0xD83D, 1917},
+    {0xD83D, 1918},
+    {0xD83D, 1919},
+    {0xD83D, 1920},
+    {0xD83D, 1921},
+    {0xD83D, 1922},
+    {0xD83D, 1923},
+    {0xD83D, 1924},
+    {0xD83D, 1925},
+    {0xD83D, 1926},
+    {0xD83D, 1927},
+    {0xD83D, 1928},
+    {0xD83D, 1929},
+    {0xD83D, 1930},
+    {0xD83D, 1931},
+    {0xD83D, 1932},
+    {0xD83D, 1933},
+    {0xD83D, 1934},
+    {0xD83D, 1935},
+    {0xD83D, 1936},
+    {0xD83D, 1937},
+    {0xD83D, 1938},
+    {0xD83D, 1939},
+    {0xD83D, 1940},
+    {0xD83D, 1941},
+    {0xD83D, 1942},
+    {0xD83D, 1943},
+    {0xD83D, 1944},
+    {0xD83D, 1976},
+    {0xD83D, 1993},
+    {0xD83D, 1999},
+    {0xD83D, 2005},
+    {0xD83D, 2026},
+    {0xD83D, 2027},
+    {0xD83D, 2028},
+    {0xD83D, 2029},
+    {0xD83D, 2030},
+    {0xD83D, 2031},
+    {0xD83D, 2032},
+    {0xD83D, 2033},
+    {0xD83D, 2034},
+    {0xD83D, 2035},
+    {0xD83D, 2036},
+    {0xD83D, 2037},
+    {0xD83D, 2038},
+    {0xD83D, 2039},
+    {0xD83D, 2040},
+    {0xD83D, 2041},
+    {0xD83D, 2042},
+    {0xD83D, 2043},
+    {0xD83D, 2044},
+    {0xD83D, 2045},
+    {0xD83D, 2046},
+    {0xD83D, 2047},
+    {0xD83D, 2048},
+    {0xD83D, 2049},
+    {0xD83D, 2050},
+    {0xD83D, 2051},
+    {0xD83D, 2052},
+    {0xD83D, 2053},
+    {0xD83D, 2054},
+    {0xD83D, 2055},
+    {0xD83D, 2056},
+    {0xD83D, 2057},
+    {0xD83D, 2058},
+    {0xD83D, 2059},
+    {0xD83D, 2060},
+    {0xD83D, 2061},
+    {0xD83D, 2062},
+    {0xD83D, 2063},
+    {0xD83D, 2064},
+    {0xD83D, 2065},
+    {0xD83D, 2066},
+    {0xD83D, 2067},
+    {0xD83D, 2068},
+    {0xD83D, 2069},
+    {0xD83D, 2070},
+    {0xD83D, 2071},
+    {0xD83D, 2072},
+    {0xD83D, 2073},
+    {0xD83D, 2074},
+    {0xD83D, 2075},
+    {0xD83D, 2076},
+    {0xD83D, 2078},
+    {0xD83D, 2079},
+    {0xD83D, 2080},
+    {0xD83D, 2081},
+    {0xD83D, 2082},
+    {0xD83D, 2083},
+    {0xD83D, 2084},
+    {0xD83D, 2086},
+    {0xD83D, 2088},
+    {0xD83D, 2089},
+    {0xD83D, 2090},
+    {0xD83D, 2091},
+    {0xD83D, 2092},
+    {0xD83D, 2093},
+    {0xD83D, 2094},
+    {0xD83D, 2095},
+    {0xD83D, 2096},
+    {0xD83D, 2097},
+    {0xD83D, 2098},
+    {0xD83D, 2099},
+    {0xD83D, 2102},
+    {0xD83D, 2103},
+    {0xD83D, 2104},
+    {0xD83D, 2117},
+    {0xD83D, 2135},
+    {0xD83D, 2153},
+    {0xD83D, 2159},
+    {0xD83D, 2160},
+    {0xD83D, 2161},
+    {0xD83D, 2174},
+    {0xD83D, 2180},
+    {0xD83D, 2198},
+    {0xD83D, 2216},
+    {0xD83D, 2222},
+    {0xD83D, 2228},
+    {0xD83D, 2229},
+    {0xD83D, 2230},
+    {0xD83D, 2231},
+    {0xD83D, 2232},
+    {0xD83D, 2233},
+    {0xD83D, 2234},
+    {0xD83D, 2235},
+    {0xD83D, 2236},
+    {0xD83D, 2237},
+    {0xD83D, 2238},
+    {0xD83D, 2239},
+    {0xD83D, 2240},
+    {0xD83D, 2241},
+    {0xD83D, 2242},
+    {0xD83D, 2243},
+    {0xD83D, 2244},
+    {0xD83D, 2245},
+    {0xD83D, 2246},
+    {0xD83D, 2247},
+    {0xD83D, 2248},
+    {0xD83D, 2249},
+    {0xD83D, 2250},
+    {0xD83D, 2251},
+    {0xD83D, 2252},
+    {0xD83D, 2253},
+    {0xD83D, 2254},
+    {0xD83D, 2255},
+    {0xD83D, 2256},
+    {0xD83D, 2257},
+    {0xD83D, 2258},
+    {0xD83D, 2259},
+    {0xD83D, 2260},
+    {0xD83D, 2261},
+    {0xD83D, 2262},
+    {0xD83D, 2275},
+    {0xD83D, 2281},
+    {0xD83D, 2282},
+    {0xD83D, 2283},
+    {0xD83D, 2284},
+    {0xD83D, 2285},
+    {0xD83D, 2286},
+    {0xD83D, 2287},
+    {0xD83D, 2288},
+    {0xD83D, 2289},
+    {0xD83D, 2290},
+    {0xD83D, 2291},
+    {0xD83D, 2292},
+    {0xD83D, 2293},
+    {0xD83D, 2294},
+    {0xD83D, 2295},
+    {0xD83D, 2296},
+    {0xD83D, 2309},
+    {0xD83D, 2327},
+    {0xD83D, 2363},
+    {0xD83D, 2369},
+    {0xD83D, 2370},
+    {0xD83D, 2371},
+    {0xD83D, 2372},
+    {0xD83D, 2373},
+    {0xD83D, 2374},
+    {0xD83D, 2375},
+    {0xD83D, 2376},
+    {0xD83D, 2377},
+    {0xD83D, 2378},
+    {0xD83D, 2384},
+    {0xD83D, 2385},
+    {0xD83D, 2386},
+    {0xD83D, 2387},
+    {0xD83D, 2388},
+    {0xD83D, 2390},
+    {0xD83D, 2399},
+    {0xD83D, 2400},
+    {0xD83D, 2401},
+    {0xD83D, 2402},
+    {0xD83D, 2403},
+    {0xD83D, 2404},
+    {0xD83D, 2405},
+    {0xD83D, 2406},
+    {0xD83D, 2407},
+    {0xD83D, 2408},
+    {0xD83D, 2416},
+    {0xD83D, 2417},
+    {0xD83D, 2420},
+    {0xD83D, 2421},
+    {0xD83D, 2422},
+    {0xD83D, 2423},
+    {0xD83D, 2424},
+    {0xD83D, 2425},
+    {0xD83D, 2426},
+    {0xD83D, 2427},
+    {0xD83D, 2428},
+    {0xD83D, 2429},
+    {0xD83D, 2430},
+    {0xD83D, 2431},
+    {0xD83D, 2432},
+    {0xD83D, 2433},
+    {0xD83D, 2434},
+    {0xD83D, 2435},
+    {0xD83D, 2436},
+    {0xD83D, 2437},
+    {0xD83D, 2438},
+    {0xD83D, 2439},
+    {0xD83D, 2440},
+    {0xD83D, 2441},
+    {0xD83E, 1692},
+    {0xD83E, 1693},
+    {0xD83E, 1694},
+    {0xD83E, 1695},
+    {0xD83E, 1696},
+    {0xD83E, 1697},
+    {0xD83E, 1698},
+    {0xD83E, 1699},
+    {0xD83E, 1700},
+    {0xD83E, 1701},
+    {0xD83E, 1702},
+    {0xD83E, 1703},
+    {0xD83E, 1704},
+    {0xD83E, 1705},
+    {0xD83E, 1706},
+    {0xD83E, 1707},
+    {0xD83E, 1708},
+    {0xD83E, 1709},
+    {0xD83E, 1710},
+    {0xD83E, 1711},
+    {0xD83E, 1719},
+    {0xD83E, 1720},
+    {0xD83E, 1721},
+    {0xD83E, 1722},
+    {0xD83E, 1723},
+    {0xD83E, 1724},
+    {0xD83E, 1725},
+    {0xD83E, 1726},
+    {0xD83E, 1727},
+    {0xD83E, 1728},
+    {0xD83E, 1729},
+    {0xD83E, 1730},
+    {0xD83E, 1731},
+    {0xD83E, 1732},
+    {0xD83E, 1733},
+    {0xD83E, 1734},
+    {0xD83E, 1735},
+    {0xD83E, 1736},
+    {0xD83E, 1737},
+    {0xD83E, 1738},
+    {0xD83E, 3068},
+    {0xD83E, 3069},
+    {0xD83E, 3070},
+    {0xD83E, 3071},
+    {0xD83E, 3072},
+    {0xD83E, 3073},
+    {0xD83E, 3074},
+    {0xD83E, 3075},
+    {0xD83E, 3076},
+    {0xD83E, 3077},
+    {0xD83E, 3078},
+    {0xD83E, 3079},
+    {0xD83E, 3080},
+    {0xD83E, 3081},
+    {0xD83E, 3082},
+    {0xD83E, 3083},
+    {0xD83E, 3084},
+    {0xD83E, 3085},
+    {0xD83E, 3086},
+    {0xD83E, 3087},
+    {0xD83E, 3088},
+    {0xD83E, 3089},
+    {0xD83E, 3090},
+    {0xD83E, 3091},
+    {0xD83E, 3092},
+    {0xD83E, 3154},
+    {0xD83E, 2929},
+    {0xD83E, 2930},
+    {0xD83E, 2931},
+    {0xD83E, 2932},
+    {0xD83E, 2933},
+    {0xD83E, 2941},
+    {0xD83E, 2942},
+    {0xD83E, 2943},
+    {0xD83E, 2944},
+    {0xD83E, 2945},
+    {0xD83E, 3094},
+    {0xD83E, 3095},
+    {0xD83E, 3096},
+    {0xD83E, 3097},
+    {0xD83E, 3098},
+    {0xD83E, 3130},
+    {0xD83E, 3131},
+    {0xD83E, 3132},
+    {0xD83E, 3133},
+    {0xD83E, 3134},
+    {0xD83E, 3142},
+    {0xD83E, 3143},
+    {0xD83E, 3144},
+    {0xD83E, 3145},
+    {0xD83E, 3146},
+    {0xD83E, 2500},
+    {0xD83E, 2501},
+    {0xD83E, 2502},
+    {0xD83E, 2503},
+    {0xD83E, 2504},
+    {0xD83E, 2505},
+    {0xD83E, 2506},
+    {0xD83E, 2507},
+    {0xD83E, 2508},
+    {0xD83E, 2509},
+    {0xD83E, 2510},
+    {0xD83E, 2511},
+    {0xD83E, 2512},
+    {0xD83E, 2513},
+    {0xD83E, 2514},
+    {0xD83E, 2515},
+    {0xD83E, 2516},
+    {0xD83E, 2517},
+    {0xD83E, 2518},
+    {0xD83E, 2519},
+    {0xD83E, 2928},
+    {0xD83E, 2940},
+    {0xD83E, 3067},
+    {0xD83E, 3093},
+    {0xD83E, 3129},
+    {0xD83E, 3141},
+    {0xD83E, 3153},
+    {0xD83E, 3155},
+    {0xD83E, 2539},
+    {0xD83E, 2540},
+    {0xD83E, 2541},
+    {0xD83E, 2542},
+    {0xD83E, 2543},
+    {0xD83E, 2545},
+    {0xD83E, 2546},
+    {0xD83E, 2547},
+    {0xD83E, 2548},
+    {0xD83E, 2549},
+    {0xD83E, 2596},
+    {0xD83E, 2597},
+    {0xD83E, 2598},
+    {0xD83E, 2599},
+    {0xD83E, 2600},
+    {0xD83E, 2602},
+    {0xD83E, 2603},
+    {0xD83E, 2604},
+    {0xD83E, 2605},
+    {0xD83E, 2606},
+    {0xD83E, 2620},
+    {0xD83E, 2621},
+    {0xD83E, 2622},
+    {0xD83E, 2623},
+    {0xD83E, 2624},
+    {0xD83E, 2626},
+    {0xD83E, 2627},
+    {0xD83E, 2628},
+    {0xD83E, 2629},
+    {0xD83E, 2630},
+    {0xD83E, 2638},
+    {0xD83E, 2639},
+    {0xD83E, 2640},
+    {0xD83E, 2641},
+    {0xD83E, 2642},
+    {0xD83E, 2644},
+    {0xD83E, 2645},
+    {0xD83E, 2646},
+    {0xD83E, 2647},
+    {0xD83E, 2648},
+    {0xD83E, 2656},
+    {0xD83E, 2657},
+    {0xD83E, 2658},
+    {0xD83E, 2659},
+    {0xD83E, 2660},
+    {0xD83E, 2662},
+    {0xD83E, 2663},
+    {0xD83E, 2664},
+    {0xD83E, 2665},
+    {0xD83E, 2666},
+    {0xD83E, 2678},
+    {0xD83E, 2679},
+    {0xD83E, 2680},
+    {0xD83E, 2681},
+    {0xD83E, 2682},
+    {0xD83E, 2684},
+    {0xD83E, 2685},
+    {0xD83E, 2686},
+    {0xD83E, 2687},
+    {0xD83E, 2688},
+    {0xD83E, 2696},
+    {0xD83E, 2697},
+    {0xD83E, 2698},
+    {0xD83E, 2699},
+    {0xD83E, 2700},
+    {0xD83E, 2702},
+    {0xD83E, 2703},
+    {0xD83E, 2704},
+    {0xD83E, 2705},
+    {0xD83E, 2706},
+    {0xD83E, 2845},
+    {0xD83E, 2846},
+    {0xD83E, 2847},
+    {0xD83E, 2848},
+    {0xD83E, 2849},
+    {0xD83E, 2851},
+    {0xD83E, 2852},
+    {0xD83E, 2853},
+    {0xD83E, 2854},
+    {0xD83E, 2855},
+    {0xD83E, 2863},
+    {0xD83E, 2864},
+    {0xD83E, 2865},
+    {0xD83E, 2866},
+    {0xD83E, 2867},
+    {0xD83E, 2869},
+    {0xD83E, 2870},
+    {0xD83E, 2871},
+    {0xD83E, 2872},
+    {0xD83E, 2873},
+    {0xD83E, 2905},
+    {0xD83E, 2906},
+    {0xD83E, 2907},
+    {0xD83E, 2908},
+    {0xD83E, 2909},
+    {0xD83E, 2911},
+    {0xD83E, 2912},
+    {0xD83E, 2913},
+    {0xD83E, 2914},
+    {0xD83E, 2915},
+    {0xD83E, 2923},
+    {0xD83E, 2924},
+    {0xD83E, 2925},
+    {0xD83E, 2926},
+    {0xD83E, 2927},
+    {0xD83E, 2935},
+    {0xD83E, 2936},
+    {0xD83E, 2937},
+    {0xD83E, 2938},
+    {0xD83E, 2939},
+    {0xD83E, 2947},
+    {0xD83E, 2948},
+    {0xD83E, 2949},
+    {0xD83E, 2950},
+    {0xD83E, 2951},
+    {0xD83E, 2959},
+    {0xD83E, 2960},
+    {0xD83E, 2961},
+    {0xD83E, 2962},
+    {0xD83E, 2963},
+    {0xD83E, 2965},
+    {0xD83E, 2966},
+    {0xD83E, 2967},
+    {0xD83E, 2968},
+    {0xD83E, 2969},
+    {0xD83E, 2978},
+    {0xD83E, 2979},
+    {0xD83E, 2980},
+    {0xD83E, 2981},
+    {0xD83E, 2982},
+    {0xD83E, 2984},
+    {0xD83E, 2985},
+    {0xD83E, 2986},
+    {0xD83E, 2987},
+    {0xD83E, 2988},
+    {0xD83E, 2990},
+    {0xD83E, 2991},
+    {0xD83E, 2992},
+    {0xD83E, 2993},
+    {0xD83E, 2994},
+    {0xD83E, 2996},
+    {0xD83E, 2997},
+    {0xD83E, 2998},
+    {0xD83E, 2999},
+    {0xD83E, 3000},
+    {0xD83E, 3002},
+    {0xD83E, 3003},
+    {0xD83E, 3004},
+    {0xD83E, 3005},
+    {0xD83E, 3006},
+    {0xD83E, 3008},
+    {0xD83E, 3009},
+    {0xD83E, 3010},
+    {0xD83E, 3011},
+    {0xD83E, 3012},
+    {0xD83E, 3014},
+    {0xD83E, 3015},
+    {0xD83E, 3016},
+    {0xD83E, 3017},
+    {0xD83E, 3018},
+    {0xD83E, 3020},
+    {0xD83E, 3021},
+    {0xD83E, 3022},
+    {0xD83E, 3023},
+    {0xD83E, 3024},
+    {0xD83E, 3026},
+    {0xD83E, 3027},
+    {0xD83E, 3028},
+    {0xD83E, 3029},
+    {0xD83E, 3030},
+    {0xD83E, 3032},
+    {0xD83E, 3033},
+    {0xD83E, 3034},
+    {0xD83E, 3035},
+    {0xD83E, 3036},
+    {0xD83E, 3038},
+    {0xD83E, 3039},
+    {0xD83E, 3040},
+    {0xD83E, 3041},
+    {0xD83E, 3042},
+    {0xD83E, 3044},
+    {0xD83E, 3045},
+    {0xD83E, 3046},
+    {0xD83E, 3047},
+    {0xD83E, 3048},
+    {0xD83E, 3050},
+    {0xD83E, 3051},
+    {0xD83E, 3052},
+    {0xD83E, 3053},
+    {0xD83E, 3054},
+    {0xD83E, 3056},
+    {0xD83E, 3057},
+    {0xD83E, 3058},
+    {0xD83E, 3059},
+    {0xD83E, 3060},
+    {0xD83E, 3062},
+    {0xD83E, 3063},
+    {0xD83E, 3064},
+    {0xD83E, 3065},
+    {0xD83E, 3066},
+    {0xD83E, 3100},
+    {0xD83E, 3101},
+    {0xD83E, 3102},
+    {0xD83E, 3103},
+    {0xD83E, 3104},
+    {0xD83E, 3106},
+    {0xD83E, 3107},
+    {0xD83E, 3108},
+    {0xD83E, 3109},
+    {0xD83E, 3110},
+    {0xD83E, 3112},
+    {0xD83E, 3113},
+    {0xD83E, 3114},
+    {0xD83E, 3115},
+    {0xD83E, 3116},
+    {0xD83E, 3118},
+    {0xD83E, 3119},
+    {0xD83E, 3120},
+    {0xD83E, 3121},
+    {0xD83E, 3122},
+    {0xD83E, 3124},
+    {0xD83E, 3125},
+    {0xD83E, 3126},
+    {0xD83E, 3127},
+    {0xD83E, 3128},
+    {0xD83E, 3136},
+    {0xD83E, 3137},
+    {0xD83E, 3138},
+    {0xD83E, 3139},
+    {0xD83E, 3140},
+    {0xD83E, 3148},
+    {0xD83E, 3149},
+    {0xD83E, 3150},
+    {0xD83E, 3151},
+    {0xD83E, 3152},
+    {0xD83E, 3158},
+    {0xD83E, 3159},
+    {0xD83E, 3160},
+    {0xD83E, 3161},
+    {0xD83E, 3162},
+    {0xD83E, 3164},
+    {0xD83E, 3165},
+    {0xD83E, 3166},
+    {0xD83E, 3167},
+    {0xD83E, 3168},
+    {0xD83E, 3170},
+    {0xD83E, 3171},
+    {0xD83E, 3172},
+    {0xD83E, 3173},
+    {0xD83E, 3174},
+    {0xD83E, 3194},
+    {0xD83E, 3195},
+    {0xD83E, 3196},
+    {0xD83E, 3197},
+    {0xD83E, 3198},
+    {0xD83E, 3200},
+    {0xD83E, 3201},
+    {0xD83E, 3202},
+    {0xD83E, 3203},
+    {0xD83E, 3204},
+    {0xD83E, 3218},
+    {0xD83E, 3219},
+    {0xD83E, 3220},
+    {0xD83E, 3221},
+    {0xD83E, 3222},
+    {0xD83E, 3224},
+    {0xD83E, 3225},
+    {0xD83E, 3226},
+    {0xD83E, 3227},
+    {0xD83E, 3228},
+    {0xD83E, 3236},
+    {0xD83E, 3237},
+    {0xD83E, 3238},
+    {0xD83E, 3239},
+    {0xD83E, 3240},
+    {0xD83E, 3242},
+    {0xD83E, 3243},
+    {0xD83E, 3244},
+    {0xD83E, 3245},
+    {0xD83E, 3246},
+    {0xD83E, 3254},
+    {0xD83E, 3255},
+    {0xD83E, 3256},
+    {0xD83E, 3257},
+    {0xD83E, 3258},
+    {0xD83E, 3260},
+    {0xD83E, 3261},
+    {0xD83E, 3262},
+    {0xD83E, 3263},
+    {0xD83E, 3264},
+    {0xD83E, 3272},
+    {0xD83E, 3273},
+    {0xD83E, 3274},
+    {0xD83E, 3275},
+    {0xD83E, 3276},
+    {0xD83E, 3278},
+    {0xD83E, 3279},
+    {0xD83E, 3280},
+    {0xD83E, 3281},
+    {0xD83E, 3282},
+    {0xD83E, 3290},
+    {0xD83E, 3291},
+    {0xD83E, 3292},
+    {0xD83E, 3293},
+    {0xD83E, 3294},
+    {0xD83E, 3296},
+    {0xD83E, 3297},
+    {0xD83E, 3298},
+    {0xD83E, 3299},
+    {0xD83E, 3300},
+    {0xD83E, 3308},
+    {0xD83E, 3309},
+    {0xD83E, 3310},
+    {0xD83E, 3311},
+    {0xD83E, 3312},
+    {0xD83E, 3314},
+    {0xD83E, 3315},
+    {0xD83E, 3316},
+    {0xD83E, 3317},
+    {0xD83E, 3318},
+    {0xD83E, 3326},
+    {0xD83E, 3327},
+    {0xD83E, 3328},
+    {0xD83E, 3329},
+    {0xD83E, 3330},
+    {0xD83E, 3332},
+    {0xD83E, 3333},
+    {0xD83E, 3334},
+    {0xD83E, 3335},
+    {0xD83E, 3336},
+    {0xD83E, 3344},
+    {0xD83E, 3345},
+    {0xD83E, 3346},
+    {0xD83E, 3347},
+    {0xD83E, 3348},
+    {0xD83E, 3350},
+    {0xD83E, 3351},
+    {0xD83E, 3352},
+    {0xD83E, 3353},
+    {0xD83E, 3354},
+    {0xD83E, 2538},
+    {0xD83E, 2544},
+    {0xD83E, 2595},
+    {0xD83E, 2601},
+    {0xD83E, 2619},
+    {0xD83E, 2625},
+    {0xD83E, 2637},
+    {0xD83E, 2643},
+    {0xD83E, 2655},
+    {0xD83E, 2661},
+    {0xD83E, 2674},
+    {0xD83E, 2675},
+    {0xD83E, 2677},
+    {0xD83E, 2683},
+    {0xD83E, 2695},
+    {0xD83E, 2701},
+    {0xD83E, 2844},
+    {0xD83E, 2850},
+    {0xD83E, 2862},
+    {0xD83E, 2868},
+    {0xD83E, 2904},
+    {0xD83E, 2910},
+    {0xD83E, 2922},
+    {0xD83E, 2934},
+    {0xD83E, 2946},
+    {0xD83E, 2958},
+    {0xD83E, 2964},
+    {0xD83E, 2977},
+    {0xD83E, 2983},
+    {0xD83E, 2989},
+    {0xD83E, 2995},
+    {0xD83E, 3001},
+    {0xD83E, 3007},
+    {0xD83E, 3013},
+    {0xD83E, 3019},
+    {0xD83E, 3025},
+    {0xD83E, 3031},
+    {0xD83E, 3037},
+    {0xD83E, 3043},
+    {0xD83E, 3049},
+    {0xD83E, 3055},
+    {0xD83E, 3061},
+    {0xD83E, 3099},
+    {0xD83E, 3105},
+    {0xD83E, 3111},
+    {0xD83E, 3117},
+    {0xD83E, 3123},
+    {0xD83E, 3135},
+    {0xD83E, 3147},
+    {0xD83E, 3156},
+    {0xD83E, 3157},
+    {0xD83E, 3163},
+    {0xD83E, 3169},
+    {0xD83E, 3193},
+    {0xD83E, 3199},
+    {0xD83E, 3217},
+    {0xD83E, 3223},
+    {0xD83E, 3235},
+    {0xD83E, 3241},
+    {0xD83E, 3253},
+    {0xD83E, 3259},
+    {0xD83E, 3271},
+    {0xD83E, 3277},
+    {0xD83E, 3289},
+    {0xD83E, 3295},
+    {0xD83E, 3307},
+    {0xD83E, 3313},
+    {0xD83E, 3325},
+    {0xD83E, 3331},
+    {0xD83E, 3343},
+    {0xD83E, 3349},
+    {0xD83E, 3361},
+    {0xD83E, 3362},
+    {0xD83E, 3364},
+    {0xD83E, 3365},
+    {0xD83E, 2443},
+    {0xD83E, 2444},
+    {0xD83E, 2445},
+    {0xD83E, 2446},
+    {0xD83E, 2447},
+    {0xD83E, 2451},
+    {0xD83E, 2452},
+    {0xD83E, 2453},
+    {0xD83E, 2454},
+    {0xD83E, 2455},
+    {0xD83E, 2465},
+    {0xD83E, 2466},
+    {0xD83E, 2467},
+    {0xD83E, 2468},
+    {0xD83E, 2469},
+    {0xD83E, 2471},
+    {0xD83E, 2472},
+    {0xD83E, 2473},
+    {0xD83E, 2474},
+    {0xD83E, 2475},
+    {0xD83E, 2477},
+    {0xD83E, 2478},
+    {0xD83E, 2479},
+    {0xD83E, 2480},
+    {0xD83E, 2481},
+    {0xD83E, 2483},
+    {0xD83E, 2484},
+    {0xD83E, 2485},
+    {0xD83E, 2486},
+    {0xD83E, 2487},
+    {0xD83E, 2489},
+    {0xD83E, 2490},
+    {0xD83E, 2491},
+    {0xD83E, 2492},
+    {0xD83E, 2493},
+    {0xD83E, 2495},
+    {0xD83E, 2496},
+    {0xD83E, 2497},
+    {0xD83E, 2498},
+    {0xD83E, 2499},
+    {0xD83E, 2521},
+    {0xD83E, 2522},
+    {0xD83E, 2523},
+    {0xD83E, 2524},
+    {0xD83E, 2525},
+    {0xD83E, 2527},
+    {0xD83E, 2528},
+    {0xD83E, 2529},
+    {0xD83E, 2530},
+    {0xD83E, 2531},
+    {0xD83E, 2551},
+    {0xD83E, 2552},
+    {0xD83E, 2553},
+    {0xD83E, 2554},
+    {0xD83E, 2555},
+    {0xD83E, 2566},
+    {0xD83E, 2567},
+    {0xD83E, 2568},
+    {0xD83E, 2569},
+    {0xD83E, 2570},
+    {0xD83E, 2572},
+    {0xD83E, 2573},
+    {0xD83E, 2574},
+    {0xD83E, 2575},
+    {0xD83E, 2576},
+    {0xD83E, 2578},
+    {0xD83E, 2579},
+    {0xD83E, 2580},
+    {0xD83E, 2581},
+    {0xD83E, 2582},
+    {0xD83E, 2584},
+    {0xD83E, 2585},
+    {0xD83E, 2586},
+    {0xD83E, 2587},
+    {0xD83E, 2588},
+    {0xD83E, 2590},
+    {0xD83E, 2591},
+    {0xD83E, 2592},
+    {0xD83E, 2593},
+    {0xD83E, 2594},
+    {0xD83E, 2608},
+    {0xD83E, 2609},
+    {0xD83E, 2610},
+    {0xD83E, 2611},
+    {0xD83E, 2612},
+    {0xD83E, 2614},
+    {0xD83E, 2615},
+    {0xD83E, 2616},
+    {0xD83E, 2617},
+    {0xD83E, 2618},
+    {0xD83E, 2632},
+    {0xD83E, 2633},
+    {0xD83E, 2634},
+    {0xD83E, 2635},
+    {0xD83E, 2636},
+    {0xD83E, 2650},
+    {0xD83E, 2651},
+    {0xD83E, 2652},
+    {0xD83E, 2653},
+    {0xD83E, 2654},
+    {0xD83E, 2668},
+    {0xD83E, 2669},
+    {0xD83E, 2670},
+    {0xD83E, 2671},
+    {0xD83E, 2672},
+    {0xD83E, 2690},
+    {0xD83E, 2691},
+    {0xD83E, 2692},
+    {0xD83E, 2693},
+    {0xD83E, 2694},
+    {0xD83E, 2708},
+    {0xD83E, 2709},
+    {0xD83E, 2710},
+    {0xD83E, 2711},
+    {0xD83E, 2712},
+    {0xD83E, 2769},
+    {0xD83E, 2770},
+    {0xD83E, 2771},
+    {0xD83E, 2772},
+    {0xD83E, 2773},
+    {0xD83E, 2832},
+    {0xD83E, 2833},
+    {0xD83E, 2834},
+    {0xD83E, 2835},
+    {0xD83E, 2836},
+    {0xD83E, 2838},
+    {0xD83E, 2839},
+    {0xD83E, 2840},
+    {0xD83E, 2841},
+    {0xD83E, 2842},
+    {0xD83E, 2857},
+    {0xD83E, 2858},
+    {0xD83E, 2859},
+    {0xD83E, 2860},
+    {0xD83E, 2861},
+    {0xD83E, 2875},
+    {0xD83E, 2876},
+    {0xD83E, 2877},
+    {0xD83E, 2878},
+    {0xD83E, 2879},
+    {0xD83E, 2882},
+    {0xD83E, 2883},
+    {0xD83E, 2884},
+    {0xD83E, 2885},
+    {0xD83E, 2886},
+    {0xD83E, 2917},
+    {0xD83E, 2918},
+    {0xD83E, 2919},
+    {0xD83E, 2920},
+    {0xD83E, 2921},
+    {0xD83E, 2953},
+    {0xD83E, 2954},
+    {0xD83E, 2955},
+    {0xD83E, 2956},
+    {0xD83E, 2957},
+    {0xD83E, 2971},
+    {0xD83E, 2972},
+    {0xD83E, 2973},
+    {0xD83E, 2974},
+    {0xD83E, 2975},
+    {0xD83E, 3176},
+    {0xD83E, 3177},
+    {0xD83E, 3178},
+    {0xD83E, 3179},
+    {0xD83E, 3180},
+    {0xD83E, 3182},
+    {0xD83E, 3183},
+    {0xD83E, 3184},
+    {0xD83E, 3185},
+    {0xD83E, 3186},
+    {0xD83E, 3188},
+    {0xD83E, 3189},
+    {0xD83E, 3190},
+    {0xD83E, 3191},
+    {0xD83E, 3192},
+    {0xD83E, 3206},
+    {0xD83E, 3207},
+    {0xD83E, 3208},
+    {0xD83E, 3209},
+    {0xD83E, 3210},
+    {0xD83E, 3212},
+    {0xD83E, 3213},
+    {0xD83E, 3214},
+    {0xD83E, 3215},
+    {0xD83E, 3216},
+    {0xD83E, 3230},
+    {0xD83E, 3231},
+    {0xD83E, 3232},
+    {0xD83E, 3233},
+    {0xD83E, 3234},
+    {0xD83E, 3248},
+    {0xD83E, 3249},
+    {0xD83E, 3250},
+    {0xD83E, 3251},
+    {0xD83E, 3252},
+    {0xD83E, 3266},
+    {0xD83E, 3267},
+    {0xD83E, 3268},
+    {0xD83E, 3269},
+    {0xD83E, 3270},
+    {0xD83E, 3284},
+    {0xD83E, 3285},
+    {0xD83E, 3286},
+    {0xD83E, 3287},
+    {0xD83E, 3288},
+    {0xD83E, 3302},
+    {0xD83E, 3303},
+    {0xD83E, 3304},
+    {0xD83E, 3305},
+    {0xD83E, 3306},
+    {0xD83E, 3320},
+    {0xD83E, 3321},
+    {0xD83E, 3322},
+    {0xD83E, 3323},
+    {0xD83E, 3324},
+    {0xD83E, 3338},
+    {0xD83E, 3339},
+    {0xD83E, 3340},
+    {0xD83E, 3341},
+    {0xD83E, 3342},
+    {0xD83E, 3356},
+    {0xD83E, 3357},
+    {0xD83E, 3358},
+    {0xD83E, 3359},
+    {0xD83E, 3360},
+    {0xD83E, 3475},
+    {0xD83E, 3476},
+    {0xD83E, 3477},
+    {0xD83E, 3478},
+    {0xD83E, 3479},
+    {0xD83E, 3481},
+    {0xD83E, 3482},
+    {0xD83E, 3483},
+    {0xD83E, 3484},
+    {0xD83E, 3485},
+    {0xD83E, 3487},
+    {0xD83E, 3488},
+    {0xD83E, 3489},
+    {0xD83E, 3490},
+    {0xD83E, 3491},
+    {0xD83E, 3520},
+    {0xD83E, 3521},
+    {0xD83E, 3522},
+    {0xD83E, 3523},
+    {0xD83E, 3524},
+    {0xD83E, 3526},
+    {0xD83E, 3527},
+    {0xD83E, 3528},
+    {0xD83E, 3529},
+    {0xD83E, 3530},
+    {0xD83E, 3532},
+    {0xD83E, 3533},
+    {0xD83E, 3534},
+    {0xD83E, 3535},
+    {0xD83E, 3536},
+    {0xD83E, 3538},
+    {0xD83E, 3539},
+    {0xD83E, 3540},
+    {0xD83E, 3541},
+    {0xD83E, 3542},
+    {0xD83E, 3544},
+    {0xD83E, 3545},
+    {0xD83E, 3546},
+    {0xD83E, 3547},
+    {0xD83E, 3548},
+    {0xD83E, 3550},
+    {0xD83E, 3551},
+    {0xD83E, 3552},
+    {0xD83E, 3553},
+    {0xD83E, 3554},
+    {0xD83E, 3556},
+    {0xD83E, 3557},
+    {0xD83E, 3558},
+    {0xD83E, 3559},
+    {0xD83E, 3560},
+    {0xD83E, 3562},
+    {0xD83E, 3563},
+    {0xD83E, 3564},
+    {0xD83E, 3565},
+    {0xD83E, 3566},
+    {0xD83E, 3568},
+    {0xD83E, 3569},
+    {0xD83E, 3570},
+    {0xD83E, 3571},
+    {0xD83E, 3572},
+    {0xD83E, 2442},
+    {0xD83E, 2448},
+    {0xD83E, 2449},
+    {0xD83E, 2450},
+    {0xD83E, 2456},
+    {0xD83E, 2457},
+    {0xD83E, 2458},
+    {0xD83E, 2459},
+    {0xD83E, 2460},
+    {0xD83E, 2461},
+    {0xD83E, 2462},
+    {0xD83E, 2463},
+    {0xD83E, 2464},
+    {0xD83E, 2470},
+    {0xD83E, 2476},
+    {0xD83E, 2482},
+    {0xD83E, 2488},
+    {0xD83E, 2494},
+    {0xD83E, 2520},
+    {0xD83E, 2526},
+    {0xD83E, 2532},
+    {0xD83E, 2533},
+    {0xD83E, 2534},
+    {0xD83E, 2535},
+    {0xD83E, 2536},
+    {0xD83E, 2537},
+    {0xD83E, 2550},
+    {0xD83E, 2556},
+    {0xD83E, 2557},
+    {0xD83E, 2558},
+    {0xD83E, 2559},
+    {0xD83E, 2560},
+    {0xD83E, 2561},
+    {0xD83E, 2562},
+    {0xD83E, 2563},
+    {0xD83E, 2564},
+    {0xD83E, 2565},
+    {0xD83E, 2571},
+    {0xD83E, 2577},
+    {0xD83E, 2583},
+    {0xD83E, 2589},
+    {0xD83E, 2607},
+    {0xD83E, 2613},
+    {0xD83E, 2631},
+    {0xD83E, 2649},
+    {0xD83E, 2667},
+    {0xD83E, 2673},
+    {0xD83E, 2676},
+    {0xD83E, 2689},
+    {0xD83E, 2707},
+    {0xD83E, 2713},
+    {0xD83E, 2714},
+    {0xD83E, 2715},
+    {0xD83E, 2716},
+    {0xD83E, 2717},
+    {0xD83E, 2718},
+    {0xD83E, 2719},
+    {0xD83E, 2720},
+    {0xD83E, 2721},
+    {0xD83E, 2722},
+    {0xD83E, 2723},
+    {0xD83E, 2724},
+    {0xD83E, 2725},
+    {0xD83E, 2726},
+    {0xD83E, 2727},
+    {0xD83E, 2728},
+    {0xD83E, 2729},
+    {0xD83E, 2730},
+    {0xD83E, 2731},
+    {0xD83E, 2732},
+    {0xD83E, 2733},
+    {0xD83E, 2734},
+    {0xD83E, 2735},
+    {0xD83E, 2736},
+    {0xD83E, 2737},
+    {0xD83E, 2738},
+    {0xD83E, 2739},
+    {0xD83E, 2740},
+    {0xD83E, 2741},
+    {0xD83E, 2742},
+    {0xD83E, 2743},
+    {0xD83E, 2744},
+    {0xD83E, 2745},
+    {0xD83E, 2746},
+    {0xD83E, 2747},
+    {0xD83E, 2748},
+    {0xD83E, 2749},
+    {0xD83E, 2750},
+    {0xD83E, 2751},
+    {0xD83E, 2752},
+    {0xD83E, 2753},
+    {0xD83E, 2754},
+    {0xD83E, 2755},
+    {0xD83E, 2756},
+    {0xD83E, 2757},
+    {0xD83E, 2758},
+    {0xD83E, 2759},
+    {0xD83E, 2760},
+    {0xD83E, 2761},
+    {0xD83E, 2762},
+    {0xD83E, 2763},
+    {0xD83E, 2764},
+    {0xD83E, 2765},
+    {0xD83E, 2766},
+    {0xD83E, 2767},
+    {0xD83E, 2768},
+    {0xD83E, 2774},
+    {0xD83E, 2775},
+    {0xD83E, 2776},
+    {0xD83E, 2777},
+    {0xD83E, 2778},
+    {0xD83E, 2779},
+    {0xD83E, 2780},
+    {0xD83E, 2781},
+    {0xD83E, 2782},
+    {0xD83E, 2783},
+    {0xD83E, 2784},
+    {0xD83E, 2785},
+    {0xD83E, 2786},
+    {0xD83E, 2787},
+    {0xD83E, 2788},
+    {0xD83E, 2789},
+    {0xD83E, 2790},
+    {0xD83E, 2791},
+    {0xD83E, 2792},
+    {0xD83E, 2793},
+    {0xD83E, 2794},
+    {0xD83E, 2795},
+    {0xD83E, 2796},
+    {0xD83E, 2797},
+    {0xD83E, 2798},
+    {0xD83E, 2799},
+    {0xD83E, 2800},
+    {0xD83E, 2801},
+    {0xD83E, 2802},
+    {0xD83E, 2803},
+    {0xD83E, 2804},
+    {0xD83E, 2805},
+    {0xD83E, 2806},
+    {0xD83E, 2807},
+    {0xD83E, 2808},
+    {0xD83E, 2809},
+    {0xD83E, 2810},
+    {0xD83E, 2811},
+    {0xD83E, 2812},
+    {0xD83E, 2813},
+    {0xD83E, 2814},
+    {0xD83E, 2815},
+    {0xD83E, 2816},
+    {0xD83E, 2817},
+    {0xD83E, 2818},
+    {0xD83E, 2819},
+    {0xD83E, 2820},
+    {0xD83E, 2821},
+    {0xD83E, 2822},
+    {0xD83E, 2823},
+    {0xD83E, 2824},
+    {0xD83E, 2825},
+    {0xD83E, 2826},
+    {0xD83E, 2827},
+    {0xD83E, 2828},
+    {0xD83E, 2829},
+    {0xD83E, 2830},
+    {0xD83E, 2831},
+    {0xD83E, 2837},
+    {0xD83E, 2843},
+    {0xD83E, 2856},
+    {0xD83E, 2874},
+    {0xD83E, 2880},
+    {0xD83E, 2881},
+    {0xD83E, 2887},
+    {0xD83E, 2888},
+    {0xD83E, 2889},
+    {0xD83E, 2890},
+    {0xD83E, 2891},
+    {0xD83E, 2892},
+    {0xD83E, 2893},
+    {0xD83E, 2894},
+    {0xD83E, 2895},
+    {0xD83E, 2896},
+    {0xD83E, 2897},
+    {0xD83E, 2898},
+    {0xD83E, 2899},
+    {0xD83E, 2900},
+    {0xD83E, 2901},
+    {0xD83E, 2902},
+    {0xD83E, 2903},
+    {0xD83E, 2916},
+    {0xD83E, 2952},
+    {0xD83E, 2970},
+    {0xD83E, 2976},
+    {0xD83E, 3175},
+    {0xD83E, 3181},
+    {0xD83E, 3187},
+    {0xD83E, 3205},
+    {0xD83E, 3211},
+    {0xD83E, 3229},
+    {0xD83E, 3247},
+    {0xD83E, 3265},
+    {0xD83E, 3283},
+    {0xD83E, 3301},
+    {0xD83E, 3319},
+    {0xD83E, 3337},
+    {0xD83E, 3355},
+    {0xD83E, 3363},
+    {0xD83E, 3366},
+    {0xD83E, 3367},
+    {0xD83E, 3368},
+    {0xD83E, 3369},
+    {0xD83E, 3370},
+    {0xD83E, 3371},
+    {0xD83E, 3372},
+    {0xD83E, 3373},
+    {0xD83E, 3374},
+    {0xD83E, 3375},
+    {0xD83E, 3376},
+    {0xD83E, 3377},
+    {0xD83E, 3378},
+    {0xD83E, 3379},
+    {0xD83E, 3380},
+    {0xD83E, 3381},
+    {0xD83E, 3382},
+    {0xD83E, 3383},
+    {0xD83E, 3384},
+    {0xD83E, 3385},
+    {0xD83E, 3386},
+    {0xD83E, 3387},
+    {0xD83E, 3388},
+    {0xD83E, 3389},
+    {0xD83E, 3390},
+    {0xD83E, 3391},
+    {0xD83E, 3392},
+    {0xD83E, 3393},
+    {0xD83E, 3394},
+    {0xD83E, 3395},
+    {0xD83E, 3396},
+    {0xD83E, 3397},
+    {0xD83E, 3398},
+    {0xD83E, 3399},
+    {0xD83E, 3400},
+    {0xD83E, 3401},
+    {0xD83E, 3402},
+    {0xD83E, 3403},
+    {0xD83E, 3404},
+    {0xD83E, 3405},
+    {0xD83E, 3406},
+    {0xD83E, 3407},
+    {0xD83E, 3408},
+    {0xD83E, 3409},
+    {0xD83E, 3410},
+    {0xD83E, 3411},
+    {0xD83E, 3412},
+    {0xD83E, 3413},
+    {0xD83E, 3414},
+    {0xD83E, 3415},
+    {0xD83E, 3416},
+    {0xD83E, 3417},
+    {0xD83E, 3418},
+    {0xD83E, 3419},
+    {0xD83E, 3420},
+    {0xD83E, 3421},
+    {0xD83E, 3422},
+    {0xD83E, 3423},
+    {0xD83E, 3424},
+    {0xD83E, 3425},
+    {0xD83E, 3426},
+    {0xD83E, 3427},
+    {0xD83E, 3428},
+    {0xD83E, 3429},
+    {0xD83E, 3430},
+    {0xD83E, 3431},
+    {0xD83E, 3432},
+    {0xD83E, 3433},
+    {0xD83E, 3434},
+    {0xD83E, 3435},
+    {0xD83E, 3436},
+    {0xD83E, 3437},
+    {0xD83E, 3438},
+    {0xD83E, 3439},
+    {0xD83E, 3440},
+    {0xD83E, 3441},
+    {0xD83E, 3442},
+    {0xD83E, 3443},
+    {0xD83E, 3444},
+    {0xD83E, 3445},
+    {0xD83E, 3446},
+    {0xD83E, 3447},
+    {0xD83E, 3448},
+    {0xD83E, 3449},
+    {0xD83E, 3450},
+    {0xD83E, 3451},
+    {0xD83E, 3452},
+    {0xD83E, 3453},
+    {0xD83E, 3454},
+    {0xD83E, 3455},
+    {0xD83E, 3456},
+    {0xD83E, 3457},
+    {0xD83E, 3458},
+    {0xD83E, 3459},
+    {0xD83E, 3460},
+    {0xD83E, 3461},
+    {0xD83E, 3462},
+    {0xD83E, 3463},
+    {0xD83E, 3464},
+    {0xD83E, 3465},
+    {0xD83E, 3466},
+    {0xD83E, 3467},
+    {0xD83E, 3468},
+    {0xD83E, 3469},
+    {0xD83E, 3470},
+    {0xD83E, 3471},
+    {0xD83E, 3472},
+    {0xD83E, 3473},
+    {0xD83E, 3474},
+    {0xD83E, 3480},
+    {0xD83E, 3486},
+    {0xD83E, 3492},
+    {0xD83E, 3493},
+    {0xD83E, 3494},
+    {0xD83E, 3495},
+    {0xD83E, 3496},
+    {0xD83E, 3497},
+    {0xD83E, 3498},
+    {0xD83E, 3499},
+    {0xD83E, 3500},
+    {0xD83E, 3501},
+    {0xD83E, 3502},
+    {0xD83E, 3503},
+    {0xD83E, 3504},
+    {0xD83E, 3505},
+    {0xD83E, 3506},
+    {0xD83E, 3507},
+    {0xD83E, 3508},
+    {0xD83E, 3509},
+    {0xD83E, 3510},
+    {0xD83E, 3511},
+    {0xD83E, 3512},
+    {0xD83E, 3513},
+    {0xD83E, 3514},
+    {0xD83E, 3515},
+    {0xD83E, 3516},
+    {0xD83E, 3517},
+    {0xD83E, 3518},
+    {0xD83E, 3519},
+    {0xD83E, 3525},
+    {0xD83E, 3531},
+    {0xD83E, 3537},
+    {0xD83E, 3543},
+    {0xD83E, 3549},
+    {0xD83E, 3555},
+    {0xD83E, 3561},
+    {0xD83E, 3567},
+};
+const size_t FIRST_UNIT_COUNT = std::size(FIRST_UNITS);
+
+const uint32_t SHORT_CODE_SEEDS[] = {
+    12, 1, 3, 22, 6, 52, 214, 6, 1, 668, 0, 2,
+    39, 3, 0, 215, 12, 34, 33, 21, 16, 8, 5, 50,
+    32, 30, 2, 11, 37, 61, 34, 53, 3, 4, 4, 1,
+    9, 113, 1, 11, 72, 388, 91, 8, 37, 6, 2, 4,
+    86, 5, 1, 22, 4, 5, 54, 70, 60, 2, 11, 21,
+    128, 89, 6, 22, 2, 34, 135, 15, 127, 18, 4, 5,
+    86, 4, 59, 62, 13, 77, 92, 122, 37, 27, 2, 246,
+    11, 102, 22, 4, 10, 1, 42, 43, 84, 13, 54, 138,
+    1, 49, 37, 16, 1, 47, 3, 39, 39, 3, 30, 11,
+    2, 1, 93, 10, 144, 16, 16, 4, 17, 6, 25, 14,
+    20, 3, 62, 76, 236, 2, 52, 32, 0, 30, 1, 9,
+    129, 1, 62, 13, 1, 49, 3, 11, 65, 16, 2, 240,
+    5, 2, 5, 226, 68, 45, 12, 47, 8, 20, 16, 12,
+    20, 103, 20, 288, 15, 1, 265, 5, 36, 1, 48, 5,
+    7, 64, 59, 74, 187, 110, 2, 308, 190, 61, 201, 34,
+    65, 1, 21, 17, 211, 120, 25, 77, 48, 14, 443, 278,
+    24, 4, 12, 272, 72, 388, 2, 30, 4, 4, 56, 69,
+    6, 2, 45, 26, 186, 1, 9, 4, 8, 71, 4, 6,
+    22, 17, 22, 1, 4, 12, 2, 0, 3, 117, 44, 1,
+    1, 8, 52, 26, 301, 11, 2, 0, 132, 22, 48, 2,
+    106, 147, 69, 78, 122, 291, 52, 16, 1, 16, 51, 8,
+    13, 70, 12, 9, 4, 50, 22, 78, 8, 206, 0, 511,
+    2, 13, 129, 3, 10, 161, 144, 39, 91, 215, 9, 10,
+    0, 57, 3, 1, 1, 102, 4, 306, 7, 93, 107, 9,
+    119, 202, 44, 3, 50, 103, 1, 3, 91, 5, 16, 82,
+    36, 22, 117, 64, 1, 2, 1, 8, 175, 6, 210, 0,
+    45, 1, 250, 127, 130, 102, 239, 2, 2, 1, 54, 160,
+    24, 21, 151, 27, 16, 116, 440, 292, 16, 131, 14, 35,
+    2, 12, 6, 23, 170, 87, 20, 99, 22, 1, 1, 17,
+    6, 7, 267, 349, 105, 1, 3, 1, 22, 7, 6, 154,
+    14, 30, 86, 3, 11, 13, 132, 77, 21, 13, 204, 89,
+    25, 83, 20, 3, 5, 69, 1, 22, 70, 133, 13, 51,
+    19, 105, 65, 36, 3, 223, 8, 2, 97, 277, 1, 5,
+    1, 1, 0, 49, 7, 8, 1, 2, 48, 90, 34, 41,
+    238, 798, 128, 4, 2, 328, 41, 1, 303, 9, 86, 86,
+    99, 361, 138, 6, 1428, 17, 51, 1, 17, 14, 234, 15,
+    33, 11, 70, 0, 6, 295, 2, 60, 571, 134, 8, 6,
+    136, 8, 78, 3, 2, 15, 128, 2, 23, 3, 10, 269,
+    159, 89, 21, 49, 38, 2, 968, 0, 3, 115, 13, 401,
+    132, 18, 5, 0, 45, 3, 29, 26, 225, 1, 1, 220,
+    220, 2, 70, 168, 30, 39, 73, 234, 73, 53, 6, 32,
+    2, 786, 0, 1, 31, 18, 81, 2, 131, 257, 34, 375,
+    11, 1, 68, 27, 44, 5, 90, 111, 0, 3, 236, 844,
+    2, 3, 72, 5, 3, 384, 191, 31, 195, 55, 27, 5,
+    30, 259, 88, 74, 13, 318, 8, 494, 1013, 38, 59, 469,
+    72, 0, 47, 1, 25, 2, 802, 14, 59, 9, 4, 348,
+    46, 56, 257, 190, 13, 17, 1594, 405, 52, 10, 3, 69,
+    1, 75, 5, 114, 1, 93, 1, 51, 19, 30, 6, 34,
+    441, 55, 4, 2, 93, 149, 205, 205, 722, 600, 164, 33,
+    87, 19, 4, 4, 523, 1, 290, 217, 161, 565, 1294, 81,
+    63, 314, 357, 1, 78, 3, 81, 816, 740, 1027, 0, 1,
+    198, 25, 113, 109, 180, 178, 16, 36, 8, 2, 200, 75,
+    5, 2, 214, 964, 25, 102, 32, 1201, 579, 23, 205, 150,
+    5, 133, 1, 311, 10, 17, 64, 54, 10, 1, 166, 2,
+    463, 1205, 136, 6, 345, 38, 40, 20, 2, 69, 147, 35,
+    23, 30, 565, 75, 1005, 205, 22, 22, 30, 5, 22, 98,
+    26, 323, 242, 28, 312, 209, 1423, 782, 0, 171, 149, 96,
+    259, 159, 133, 467, 538, 3, 14, 207, 38, 447, 122, 564,
+    481, 248, 80, 496, 787, 16, 83, 108, 1, 2, 127, 334,
+    2156, 28, 429, 107, 231, 32, 50, 674, 14, 1, 0, 5,
+    233, 60, 211, 2, 3, 202, 20, 5, 7, 1, 607, 20,
+    110, 1, 816, 48, 193, 45, 21, 46, 199, 307, 163, 34,
+    55, 278, 3, 133, 26, 67, 56, 654, 178, 225, 3, 55,
+    1, 231, 477, 266, 1877, 100, 2, 11, 105, 186, 21, 5,
+    787, 1069, 1389, 169, 10, 13, 79, 1116, 1150, 121, 600, 24,
+    8, 42, 202, 140, 17, 1, 48, 88, 3, 78, 1, 21,
+    49, 2141, 911, 4, 71, 0, 379, 61, 527, 1, 221, 93,
+    17, 1, 5, 162, 1, 657, 71, 30, 147, 17, 1179, 4,
+    306, 1, 112, 29, 6, 3, 215, 189, 2, 207, 1024, 537,
+    337, 7, 591, 1279, 230, 56, 85, 383, 22, 12, 83, 1,
+    16, 6, 175, 10, 62, 568, 424, 3, 91, 369, 20, 83,
+    15, 52, 67, 125, 16, 76, 10, 207, 6, 2987, 1, 38,
+    1, 88, 13, 358, 356, 855, 152, 1, 1, 8, 192, 320,
+    1704, 1, 46, 73, 6, 76, 1, 67, 3934, 1240, 1032, 127,
+    644, 4021, 2, 15, 72, 181, 42, 69, 6, 2, 53, 10,
+    8, 392, 20, 177, 52, 1, 839, 29, 112, 120, 1897, 42,
+    36, 1326, 1304, 64, 876, 14, 181, 1, 572, 181, 93, 1700,
+    8082, 2, 262, 2279, 83, 2, 18, 1056, 409, 193, 12, 159,
+    699, 246, 212, 21, 107, 2, 2705, 866, 766, 67, 1, 1277,
+    0, 1087, 1617, 93, 443, 17, 447, 2, 34, 25, 1, 3025,
+    46,
+};
+const size_t SHORT_CODE_BUCKET_COUNT = std::size(SHORT_CODE_SEEDS);
+
+const uint16_t SHORT_CODE_SLOTS[] = {
+    3496, 710, 1799, 673, 598, 192, 335, 2728, 1787, 1738, 3601, 2637,
+    2487, 1795, 3523, 891, 2097, 97, 2272, 2955, 1505, 925, 39, 1638,
+    2762, 1168, 1929, 1789, 2006, 1585, 1599, 1070, 3503, 2282, 1910, 2906,
+    1364, 2621, 2026, 2640, 1342, 2522, 3019, 1692, 3411, 178, 2091, 3137,
+    35, 5, 2307, 940, 776, 3464, 2276, 2984, 2263, 2596, 1950, 3015,
+    353, 2256, 804, 2675, 843, 679, 1994, 2338, 1589, 736, 665, 77,
+    1290, 2389, 498, 3379, 2326, 1279, 2833, 1633, 3088, 953, 1530, 1989,
+    3498, 2003, 2022, 604, 3724, 741, 2848, 337, 3393, 3242, 1162, 2014,
+    969, 2930, 3340, 2352, 1701, 996, 3249, 574, 800, 3332, 3679, 3708,
+    1866, 751, 110, 46, 194, 1024, 21, 708, 1033, 1497, 2885, 2668,
+    2295, 1959, 2325, 3443, 3292, 948, 820, 3789, 501, 2563, 1306, 3282,
+    3569, 494, 1234, 811, 2726, 1205, 1873, 2081, 3251, 851, 2350, 2595,
+    1906, 2397, 3127, 3659, 159, 1792, 3396, 3741, 1670, 1156, 3075, 3737,
+    3678, 2475, 2800, 1870, 1570, 2257, 559, 1360, 359, 799, 3316, 2901,
+    3538, 1097, 1202, 69, 696, 897, 2208, 2826, 1209, 2429, 107, 567,
+    840, 1398, 1763, 2493, 2556, 1377, 3381, 3155, 1651, 3671, 2939, 2500,
+    3168, 1936, 3422, 191, 2497, 203, 1063, 568, 2233, 625, 1773, 701,
+    1668, 3353, 2742, 810, 1141, 2899, 2343, 2748, 3834, 2180, 992, 2435,
+    3240, 893, 3374, 2273, 2119, 779, 3300, 731, 2243, 2951, 318, 321,
+    1710, 728, 475, 1711, 1250, 2642, 217, 2828, 3020, 2197, 2246, 486,
+    1521, 1417, 3359, 3082, 1232, 2118, 3234, 3655, 2979, 1453, 2305, 3336,
+    1405, 1626, 2138, 3312, 3079, 964, 1644, 363, 966, 3094, 1334, 823,
+    17, 364, 646, 1914, 370, 1330, 2882, 3512, 249, 2980, 3511, 2331,
+    415, 2193, 2038, 1489, 1171, 1613, 1183, 2905, 1267, 56, 2740, 2942,
+    1094, 1121, 2203, 2453, 2154, 2786, 1478, 410, 2089, 481, 2622, 1785,
+    3840, 2514, 196, 117, 60, 935, 586, 524, 1553, 2486, 1411, 1418,
+    3781, 2690, 86, 2485, 796, 276, 2333, 2605, 1084, 3514, 277, 2334,
+    2680, 2613, 3807, 3236, 1420, 2339, 434, 2092, 3005, 1646, 3817, 3838,
+    1629, 933, 2369, 212, 660, 513, 2456, 1869, 1602, 1740, 657, 2483,
+    1882, 584, 594, 3256, 1927, 1359, 3488, 3149, 1890, 3697, 620, 723,
+    2719, 1605, 2383, 1905, 717, 3128, 2183, 1288, 100, 142, 2921, 111,
+    44, 538, 3221, 3280, 805, 2405, 4, 2445, 770, 3535, 3600, 1608,
+    3388, 1702, 951, 1327, 412, 2473, 827, 175, 3787, 1944, 3055, 144,
+    6, 1707, 1956, 2647, 2802, 2467, 2948, 87, 1379, 3017, 3751, 150,
+    2749, 1969, 2150, 886, 1193, 2730, 356, 865, 1975, 3524, 1256, 2442,
+    2953, 1558, 3608, 3489, 2407, 3227, 12, 581, 1213, 497, 1192, 990,
+    1211, 655, 1275, 1515, 2716, 1793, 34, 3007, 447, 1480, 801, 1160,
+    1634, 1072, 898, 3509, 2417, 3164, 591, 1473, 2549, 1635, 185, 2353,
+    3145, 2704, 3691, 208, 1949, 2235, 517, 3618, 2195, 333, 1836, 597,
+    685, 1746, 629, 3743, 556, 426, 1970, 2049, 1468, 3209, 1324, 637,
+    1491, 1872, 2857, 1519, 2161, 2770, 1683, 2030, 1396, 1822, 809, 3425,
+    1539, 2659, 341, 692, 2830, 2009, 342, 2124, 168, 1826, 1109, 1597,
+    2880, 2512, 767, 3370, 2600, 2529, 27, 2351, 1013, 3279, 2711, 190,
+    476, 284, 1437, 755, 1881, 2439, 1772, 3513, 1587, 3466, 2915, 2041,
+    263, 600, 3426, 778, 910, 3360, 1146, 1650, 3417, 1028, 896, 1217,
+    825, 3043, 855, 3648, 3171, 444, 2132, 2292, 3402, 1322, 1685, 1760,
+    3148, 3288, 3467, 2187, 2400, 971, 2985, 2879, 2072, 297, 2994, 2923,
+    2831, 1074, 1579, 3244, 546, 2252, 2129, 1880, 402, 1301, 2306, 2889,
+    1133, 3833, 1485, 177, 1545, 3694, 3692, 3385, 3575, 1526, 433, 2323,
+    2153, 2698, 2260, 1352, 2137, 1043, 2029, 1237, 1188, 2470, 2177, 246,
+    2300, 2070, 1958, 781, 3250, 2380, 3343, 2867, 2946, 1079, 1538, 1424,
+    2358, 1648, 3167, 900, 1622, 126, 3062, 2289, 2128, 14, 2656, 292,
+    429, 706, 2593, 543, 3803, 869, 3826, 2018, 527, 2934, 2927, 7,
+    3068, 3023, 2234, 3727, 924, 1182, 2949, 1805, 2001, 1391, 1744, 1088,
+    2055, 1750, 681, 2424, 268, 106, 2451, 348, 2763, 307, 3408, 92,
+    3527, 1059, 1838, 1977, 483, 1434, 1777, 816, 2147, 2363, 3091, 1942,
+    236, 3442, 2357, 1447, 1428, 3200, 1575, 309, 3621, 403, 2683, 790,
+    449, 240, 2170, 2090, 1001, 343, 184, 280, 3696, 2374, 880, 1039,
+    2216, 63, 2175, 1443, 3228, 1609, 1366, 1752, 229, 2936, 2152, 833,
+    3816, 1165, 1271, 3798, 3142, 3089, 207, 79, 1048, 2914, 3432, 1260,
+    503, 448, 2028, 2929, 3629, 2852, 3630, 1179, 1462, 545, 3436, 2607,
+    902, 3468, 1272, 3421, 89, 3097, 156, 999, 2913, 1625, 298, 1814,
+    3100, 3337, 2054, 995, 1471, 534, 2218, 1265, 1203, 1002, 3225, 137,
+    2303, 1466, 585, 1811, 519, 2734, 234, 1090, 645, 929, 2088, 2188,
+    1228, 2166, 3445, 2436, 374, 38, 1550, 2494, 109, 3687, 3178, 1455,
+    1500, 3450, 456, 3390, 1270, 2809, 1968, 1328, 3412, 2557, 769, 1735,
+    1076, 395, 2655, 1240, 2536, 1251, 1017, 3371, 211, 1510, 2415, 3024,
+    380, 224, 919, 214, 273, 854, 283, 2932, 3676, 1776, 3006, 303,
+    3547, 2501, 3483, 2623, 892, 2463, 997, 1350, 1296, 2907, 2841, 3786,
+    1318, 1932, 3213, 3165, 3217, 3599, 3772, 1161, 3257, 1831, 903, 3352,
+    2341, 3346, 9, 3125, 3093, 2693, 2945, 381, 2784, 127, 3290, 1546,
+    2402, 3324, 332, 2944, 3446, 2125, 1258, 2903, 2232, 847, 121, 2760,
+    3675, 1336, 617, 2580, 588, 3555, 2724, 866, 1804, 1503, 3386, 3173,
+    3139, 2440, 2692, 1887, 2146, 1858, 1584, 1191, 182, 95, 2961, 3111,
+    2064, 2871, 2461, 2776, 2842, 152, 2875, 2162, 2168, 1477, 2793, 3132,
+    2008, 2827, 3493, 222, 3598, 1930, 1504, 2044, 2601, 128, 32, 2666,
+    1149, 1912, 3674, 1239, 340, 621, 3308, 2691, 1459, 2564, 2392, 2066,
+    2151, 1809, 160, 3842, 3684, 1115, 2732, 3582, 2502, 2519, 2182, 2471,
+    2911, 2616, 2354, 3454, 347, 777, 1479, 3162, 3635, 754, 2790, 3819,
+    1143, 1775, 0, 2312, 639, 2007, 864, 2649, 3644, 3815, 435, 836,
+    3078, 3195, 3806, 3138, 179, 1606, 2421, 2920, 2568, 432, 3455, 1601,
+    1144, 388, 3031, 2308, 2262, 3387, 3548, 2633, 698, 3749, 1532, 1614,
+    989, 291, 2799, 1440, 2053, 1332, 956, 237, 2420, 2561, 1423, 3118,
+    319, 2174, 713, 3574, 1363, 2184, 3003, 3728, 189, 2133, 3825, 2314,
+    2854, 2997, 3685, 507, 441, 1223, 1830, 3039, 611, 2058, 1868, 1292,
+    1163, 1982, 1314, 1044, 1923, 663, 1957, 1643, 3293, 822, 1150, 644,
+    1917, 3232, 2165, 2191, 972, 1819, 2344, 3518, 1430, 1953, 1514, 1954,
+    2541, 1302, 580, 2941, 230, 759, 1373, 3778, 596, 609, 2823, 1665,
+    1821, 3389, 1341, 2484, 3796, 3060, 1885, 2922, 1073, 1673, 2315, 3296,
+    405, 1282, 1114, 2310, 901, 1834, 835, 1176, 1011, 139, 3331, 1759,
+    1099, 3046, 1935, 3832, 3534, 662, 2745, 3304, 1529, 1159, 3545, 2386,
+    1816, 1604, 3245, 299, 1895, 2249, 2534, 3182, 324, 1266, 1444, 2021,
+    3661, 2181, 3016, 3738, 881, 45, 1855, 416, 1848, 1632, 3350, 266,
+    1730, 3680, 355, 1884, 59, 1556, 3314, 2130, 3570, 1020, 3226, 937,
+    3658, 2472, 3654, 1042, 1224, 3827, 2670, 2535, 2302, 1085, 2672, 3161,
+    3693, 782, 1221, 2428, 3317, 3394, 1864, 2665, 1891, 233, 3266, 2309,
+    957, 1012, 2627, 3276, 3083, 700, 2654, 2032, 1997, 2126, 2033, 2210,
+    1877, 1827, 1540, 1871, 256, 3585, 3544, 3134, 2729, 1092, 2102, 2492,
+    1103, 2938, 3603, 3627, 562, 2797, 2186, 3762, 1167, 1299, 2373, 113,
+    2239, 3351, 730, 1151, 962, 3495, 1867, 3525, 326, 98, 1433, 1187,
+    118, 1559, 3510, 2443, 68, 2332, 3406, 1659, 487, 495, 1674, 2080,
+    926, 983, 3617, 2458, 2423, 2614, 3843, 2342, 1619, 3026, 547, 151,
+    1178, 575, 837, 3456, 2977, 2336, 3744, 529, 509, 2036, 2395, 743,
+    1565, 3080, 2712, 1806, 3120, 2464, 2163, 1095, 2755, 939, 1281, 1725,
+    2676, 2327, 2335, 1727, 3802, 1212, 2694, 2478, 619, 1966, 2987, 1111,
+    504, 2611, 824, 3262, 1919, 8, 566, 1310, 766, 915, 2155, 1653,
+    3706, 3702, 2992, 10, 2158, 3486, 998, 1853, 2883, 349, 3177, 3104,
+    961, 1616, 3067, 1551, 1465, 101, 3430, 275, 2100, 1231, 3342, 3646,
+    2583, 1317, 1402, 3836, 3163, 1502, 2798, 991, 2688, 407, 2753, 2606,
+    1173, 3252, 967, 2159, 3821, 914, 834, 1940, 3327, 1774, 828, 729,
+    2539, 634, 2671, 3453, 264, 385, 3809, 2345, 3447, 1666, 3117, 533,
+    3479, 64, 3036, 443, 2785, 2431, 1255, 2490, 2766, 226, 518, 269,
+    1069, 2801, 2673, 2438, 3181, 1081, 761, 3073, 765, 3625, 3191, 1567,
+    279, 3557, 2546, 3760, 1180, 3215, 2937, 408, 414, 3474, 2446, 2517,
+    3214, 623, 170, 2573, 1245, 2567, 105, 22, 1046, 906, 826, 2087,
+    2157, 1132, 3061, 1525, 1649, 1682, 216, 641, 329, 2040, 2390, 2860,
+    3054, 154, 1189, 2574, 3151, 3622, 848, 3463, 557, 752, 1138, 3609,
+    1362, 102, 3047, 3363, 3845, 2078, 3564, 1976, 3448, 1533, 1127, 2204,
+    3683, 1852, 1218, 2733, 2804, 703, 592, 3516, 2959, 81, 760, 1119,
+    512, 2978, 845, 1833, 733, 2454, 3305, 2362, 3719, 2709, 1325, 1581,
+    2887, 3492, 158, 1837, 3372, 3196, 219, 3587, 463, 3434, 267, 1015,
+    33, 3774, 1656, 2663, 938, 3435, 2340, 2265, 1937, 1475, 1458, 3204,
+    2764, 3413, 1450, 3307, 3109, 965, 1421, 439, 1123, 523, 838, 1951,
+    1498, 1714, 2322, 812, 1719, 1152, 103, 1291, 3711, 2612, 654, 1588,
+    649, 753, 2304, 1492, 1313, 677, 2592, 2777, 2035, 2741, 477, 1408,
+    1091, 492, 366, 2866, 2847, 3053, 3270, 2789, 1846, 3281, 242, 3765,
+    3179, 42, 1862, 2048, 3562, 2648, 3566, 1840, 2328, 300, 2679, 1118,
+    1572, 2594, 286, 2278, 3591, 1147, 3187, 2507, 1813, 627, 2238, 3143,
+    987, 1061, 1807, 1307, 1347, 23, 2250, 165, 2269, 829, 172, 2888,
+    1698, 3783, 2294, 1259, 375, 941, 2297, 2515, 1667, 2281, 3208, 1797,
+    2835, 2714, 1952, 3201, 1254, 3672, 1397, 2926, 2434, 884, 3790, 1829,
+    515, 520, 1, 2859, 3357, 352, 397, 1068, 231, 135, 1026, 616,
+    3107, 3397, 1652, 1689, 1672, 186, 3303, 2569, 2145, 587, 2870, 1215,
+    735, 2916, 2743, 3392, 2156, 1346, 1067, 3660, 3239, 774, 1374, 2851,
+    270, 1562, 3018, 949, 1401, 2615, 3499, 1918, 3108, 3147, 1902, 3405,
+    3105, 3748, 994, 2537, 945, 1850, 1723, 2781, 1946, 2167, 3631, 1694,
+    2820, 2059, 2829, 797, 421, 51, 1124, 3439, 3597, 2271, 3733, 876,
+    1355, 1040, 3700, 3457, 241, 2109, 576, 863, 2787, 1204, 3471, 2427,
+    1751, 648, 883, 1104, 3718, 2057, 1974, 2818, 3746, 1621, 1198, 2685,
+    686, 3136, 1761, 2222, 3726, 25, 857, 894, 24, 3159, 2891, 613,
+    1947, 1472, 510, 2931, 756, 3647, 1716, 3779, 325, 480, 1285, 1948,
+    3414, 1768, 3058, 1298, 2577, 93, 1715, 3619, 1476, 3653, 2884, 3254,
+    2319, 1671, 748, 2268, 2947, 3801, 125, 3846, 2774, 2702, 3056, 3028,
+    36, 3052, 2101, 1779, 2821, 3497, 3344, 3758, 18, 1316, 638, 1414,
+    2910, 1009, 3729, 3449, 558, 361, 888, 1023, 2715, 3481, 3673, 2895,
+    3703, 2200, 803, 2019, 1508, 1058, 2912, 3341, 2570, 2873, 688, 2349,
+    889, 220, 2209, 2582, 3059, 1520, 2387, 346, 40, 2629, 806, 2988,
+    2681, 2874, 1857, 3246, 615, 968, 3070, 3515, 1709, 2909, 3197, 183,
+    120, 1177, 394, 2975, 563, 872, 3013, 2266, 1600, 3086, 315, 3051,
+    2368, 3578, 3206, 590, 1921, 3325, 2377, 257, 640, 146, 932, 2575,
+    2261, 2364, 817, 1153, 3335, 535, 887, 1901, 3452, 2477, 3797, 304,
+    2846, 3747, 1603, 1962, 2952, 401, 1493, 1032, 1568, 119, 3367, 2972,
+    2367, 2406, 3636, 1345, 3740, 1610, 3030, 2094, 1684, 1640, 1269, 905,
+    2360, 3140, 2411, 650, 1112, 1886, 912, 1246, 3793, 3520, 74, 2065,
+    1456, 2713, 1620, 2737, 3077, 3652, 675, 3185, 1036, 422, 3473, 2950,
+    2298, 2863, 247, 1791, 3010, 2356, 26, 3782, 289, 1627, 3632, 1170,
+    661, 1243, 1800, 334, 1945, 794, 2103, 2437, 1607, 683, 3049, 531,
+    3297, 1960, 2034, 986, 2212, 2366, 358, 1803, 1464, 2547, 745, 1743,
+    747, 2117, 3348, 1990, 2520, 3243, 2767, 1249, 1765, 1136, 338, 1077,
+    3278, 209, 2283, 2769, 317, 856, 1416, 2632, 308, 1999, 1029, 311,
+    2653, 1576, 1134, 2414, 1230, 850, 684, 13, 2602, 285, 3841, 290,
+    3069, 3814, 771, 873, 2628, 250, 1630, 1338, 2481, 176, 934, 3048,
+    610, 1289, 2960, 3459, 2127, 798, 3487, 223, 1592, 2498, 3440, 2636,
+    699, 3757, 1631, 907, 1593, 2013, 3670, 1499, 1128, 1876, 714, 572,
+    1681, 2136, 362, 687, 2782, 1586, 643, 635, 2185, 3681, 2082, 2410,
+    2837, 1734, 784, 310, 1277, 2587, 3099, 1808, 3657, 839, 3110, 1107,
+    383, 491, 3633, 11, 1771, 1512, 3410, 2566, 2968, 2839, 2689, 521,
+    2419, 1304, 2433, 577, 3590, 3649, 3792, 1451, 3419, 2548, 3478, 1358,
+    478, 1448, 2313, 193, 3805, 73, 82, 636, 3690, 2658, 2504, 525,
+    541, 1708, 2849, 895, 3272, 676, 2858, 2211, 3207, 3638, 2031, 2060,
+    628, 1623, 2634, 1699, 3500, 2954, 2441, 2176, 1897, 1054, 1283, 2381,
+    1137, 462, 2248, 436, 1035, 1027, 2214, 3376, 1705, 3029, 3563, 1687,
+    1248, 871, 2017, 3713, 3602, 1756, 2237, 3383, 2409, 3106, 1055, 1849,
+    2625, 1754, 1904, 232, 1861, 2086, 2840, 3285, 1938, 3041, 878, 2219,
+    3366, 2555, 697, 2491, 936, 2699, 2513, 3174, 2141, 213, 387, 2459,
+    1560, 2223, 3042, 3571, 1369, 722, 225, 2321, 2754, 3568, 1655, 3589,
+    2253, 390, 2585, 2562, 2697, 3763, 980, 2862, 3255, 1181, 1025, 1348,
+    2808, 1309, 2597, 1220, 2886, 928, 3475, 2872, 1484, 3526, 1387, 899,
+    3071, 2589, 244, 1755, 537, 1964, 3531, 2108, 984, 1741, 3403, 1457,
+    1226, 2758, 2553, 274, 2897, 2171, 802, 3329, 3824, 3119, 514, 1057,
+    2207, 2576, 1517, 1018, 2116, 861, 3490, 1991, 1262, 2016, 3265, 1312,
+    1645, 2869, 3651, 3716, 3761, 1219, 1571, 2202, 842, 473, 2426, 2981,
+    2242, 2967, 2134, 2110, 255, 1116, 3273, 1745, 3034, 180, 1713, 2908,
+    702, 2624, 3667, 1022, 542, 526, 1371, 2856, 3650, 1175, 3135, 108,
+    1983, 3844, 450, 313, 3090, 3668, 3784, 3358, 2807, 1663, 2752, 3295,
+    651, 3480, 3776, 3114, 195, 466, 265, 1357, 2687, 3794, 115, 2836,
+    1802, 3639, 1720, 2603, 3522, 2993, 3323, 3321, 3423, 2379, 2287, 3573,
+    2803, 3689, 3096, 1389, 1981, 1006, 2805, 2002, 1386, 496, 1783, 3438,
+    2503, 130, 3476, 1446, 2231, 3098, 1594, 3210, 719, 3354, 1263, 3154,
+    369, 488, 31, 2898, 2543, 849, 1131, 2877, 3294, 3150, 1303, 1899,
+    3309, 2025, 378, 314, 1106, 1005, 2069, 3299, 988, 2757, 134, 788,
+    3588, 682, 1516, 198, 479, 1926, 1889, 1704, 3709, 171, 322, 3409,
+    2956, 1404, 3320, 1158, 3022, 821, 272, 3623, 3009, 474, 1769, 3395,
+    404, 2717, 2301, 3707, 2998, 377, 1573, 3212, 3656, 1376, 958, 1482,
+    2660, 3616, 1820, 2832, 2620, 384, 749, 1920, 2448, 437, 164, 946,
+    3586, 3494, 593, 1078, 1781, 942, 589, 122, 1467, 1676, 1102, 2982,
+    2213, 775, 2178, 2524, 1486, 712, 2531, 2320, 2957, 197, 727, 2588,
+    1065, 149, 1883, 602, 3065, 536, 1225, 2990, 3615, 2359, 1913, 2646,
+    2365, 2316, 84, 2736, 511, 3732, 2684, 169, 1139, 1210, 3072, 1534,
+    1796, 399, 3662, 2388, 3771, 2489, 1577, 1235, 2169, 3333, 1252, 1216,
+    3800, 2318, 460, 3813, 3822, 20, 716, 2544, 3764, 2376, 1675, 1780,
+    382, 2225, 3418, 2552, 1449, 1703, 350, 252, 3444, 1712, 1739, 199,
+    3759, 2892, 1582, 2844, 1412, 2591, 963, 458, 3606, 1844, 2933, 846,
+    3000, 2286, 239, 2540, 1580, 2538, 2775, 3415, 2240, 2455, 1335, 2042,
+    3220, 1900, 2469, 2528, 1343, 1390, 818, 1934, 1148, 1034, 2228, 2450,
+    3268, 1731, 254, 293, 1564, 3605, 1941, 1548, 1933, 2523, 2986, 19,
+    3491, 3462, 506, 560, 2551, 330, 2843, 2825, 2974, 3610, 65, 792,
+    554, 3198, 3420, 3202, 2532, 2806, 3231, 365, 413, 3505, 664, 3277,
+    815, 2965, 2765, 3767, 2771, 1021, 1445, 693, 3558, 921, 1082, 3223,
+    1595, 1501, 406, 2783, 2599, 1253, 2039, 1729, 3620, 2371, 1536, 1045,
+    1297, 3755, 482, 3428, 1728, 3839, 1488, 579, 3541, 1762, 3469, 47,
+    2991, 1875, 1757, 2056, 2071, 258, 3561, 3549, 70, 1284, 3166, 670,
+    2720, 2189, 2398, 2, 1452, 1535, 1030, 1557, 1353, 2545, 2401, 1894,
+    3224, 868, 1688, 3205, 1528, 1618, 2761, 671, 446, 3596, 2505, 786,
+    2346, 166, 3365, 3477, 1943, 2565, 1892, 2452, 3095, 582, 2586, 1931,
+    978, 468, 143, 3634, 852, 2068, 423, 3441, 1569, 808, 278, 2164,
+    1817, 2259, 548, 1896, 2063, 1385, 302, 2083, 668, 3595, 2012, 1117,
+    372, 2855, 2496, 2876, 1372, 1426, 573, 271, 2047, 757, 656, 3122,
+    1978, 3682, 1463, 1280, 3391, 262, 3643, 3289, 3126, 431, 2853, 2020,
+    1321, 2274, 3141, 3264, 1264, 2700, 2279, 1060, 3637, 50, 221, 2444,
+    3229, 85, 357, 1555, 982, 1916, 1596, 282, 2878, 3400, 3799, 389,
+    3260, 973, 1993, 3730, 1598, 2347, 2662, 3318, 2814, 2317, 732, 1145,
+    2727, 1915, 188, 1661, 3536, 2404, 1824, 3263, 2447, 2224, 3153, 328,
+    1726, 3579, 3433, 2488, 2296, 691, 2230, 57, 2935, 599, 2925, 80,
+    3377, 877, 1323, 440, 2768, 853, 3152, 2896, 331, 867, 1972, 1242,
+    1537, 200, 909, 3085, 3230, 3613, 2722, 2111, 502, 391, 2705, 1749,
+    261, 2201, 3170, 3326, 3131, 2329, 2378, 2221, 398, 2122, 3517, 2412,
+    500, 2396, 787, 238, 2744, 3362, 427, 2571, 578, 1331, 3572, 2738,
+    3640, 879, 3008, 2474, 532, 3710, 2324, 2508, 1987, 2746, 2845, 155,
+    1660, 3580, 3567, 1098, 1706, 2695, 2005, 3238, 3186, 1483, 1100, 2721,
+    2731, 91, 3717, 327, 549, 2533, 544, 2516, 3384, 1222, 53, 2052,
+    15, 3754, 2076, 2581, 3472, 2479, 1129, 750, 3356, 3663, 1339, 3665,
+    3628, 1624, 2983, 3311, 763, 3368, 1736, 923, 1841, 141, 2723, 3715,
+    3064, 3169, 695, 783, 1378, 3380, 2558, 344, 2610, 528, 1329, 3695,
+    1527, 2482, 2989, 583, 2928, 1427, 2572, 955, 552, 539, 1552, 2074,
+    2299, 2413, 2635, 3382, 2179, 2940, 371, 3465, 758, 1832, 2285, 3705,
+    112, 1155, 1810, 3027, 1996, 570, 3021, 1495, 316, 55, 1697, 1268,
+    3484, 1764, 1436, 3723, 2868, 1380, 1860, 718, 3330, 1135, 2962, 1315,
+    3742, 1509, 669, 1798, 3092, 1542, 764, 3427, 1549, 3037, 3584, 2904,
+    2682, 3180, 3795, 1766, 3113, 2598, 1200, 1196, 3554, 3577, 1429, 974,
+    1461, 2708, 1064, 393, 1227, 2004, 3812, 720, 658, 1724, 3750, 860,
+    1662, 2149, 772, 626, 445, 1541, 1680, 2280, 2652, 2788, 1748, 2795,
+    2495, 145, 569, 3818, 2120, 1274, 296, 3194, 1955, 430, 484, 3530,
+    3669, 490, 3084, 680, 3714, 2023, 2024, 3775, 2291, 1120, 204, 1963,
+    2510, 2661, 795, 2093, 3116, 785, 1062, 1407, 1770, 2963, 3451, 493,
+    467, 3725, 1415, 248, 832, 601, 2104, 3002, 3736, 1365, 1356, 88,
+    2644, 551, 1851, 1563, 1583, 540, 2861, 2756, 3722, 3146, 2943, 3508,
+    2631, 3319, 161, 977, 707, 1544, 2816, 2725, 3040, 530, 3219, 1438,
+    3641, 1003, 2247, 773, 814, 2277, 3804, 913, 1276, 457, 1199, 993,
+    2290, 1578, 148, 3375, 3345, 417, 131, 3172, 1961, 2578, 1911, 1859,
+    2011, 206, 3121, 2499, 3076, 2255, 2924, 1823, 2050, 561, 737, 1928,
+    1184, 2893, 3482, 1733, 1924, 2418, 3745, 2361, 2815, 2465, 1828, 1909,
+    2073, 2696, 1742, 3014, 2121, 1523, 3831, 3271, 738, 813, 3235, 16,
+    1016, 605, 1843, 1784, 140, 927, 981, 3322, 2707, 1786, 411, 1207,
+    2288, 1154, 3581, 71, 3298, 78, 3115, 1422, 2399, 243, 1677, 2227,
+    1432, 904, 2394, 789, 2639, 287, 3753, 1273, 1326, 1441, 1518, 947,
+    715, 2834, 1400, 1086, 1425, 2144, 607, 2817, 360, 917, 1087, 294,
+    2638, 2267, 3378, 3546, 2085, 2375, 2811, 1105, 3302, 3533, 2739, 3521,
+    890, 1229, 1257, 3369, 3780, 3458, 3539, 3593, 1767, 2703, 114, 1815,
+    485, 2422, 472, 469, 2264, 3830, 3203, 1641, 1066, 3176, 652, 734,
+    116, 1194, 461, 1874, 3431, 2194, 1758, 3025, 1375, 3124, 1031, 2701,
+    129, 1381, 667, 3756, 1524, 608, 1442, 762, 3735, 1130, 1071, 1370,
+    2258, 3551, 705, 1392, 3626, 875, 1847, 3129, 1718, 3766, 1047, 2584,
+    1439, 3556, 908, 3612, 3248, 52, 1454, 3261, 2043, 1185, 522, 931,
+    174, 1690, 1340, 3699, 2918, 3788, 2630, 3286, 2403, 2674, 1839, 807,
+    1490, 2850, 1236, 642, 2140, 1617, 187, 1561, 659, 1642, 666, 90,
+    3429, 3540, 2890, 3401, 740, 1939, 2579, 1410, 3810, 2460, 916, 2457,
+    2468, 709, 1845, 950, 2751, 1311, 1406, 1080, 2135, 2106, 3614, 2772,
+    2525, 3565, 3103, 3777, 1206, 454, 1113, 1637, 3237, 975, 3424, 742,
+    43, 1233, 2115, 3157, 2796, 1788, 1888, 2061, 455, 99, 132, 1037,
+    1470, 1172, 2348, 2107, 3461, 711, 1566, 2838, 1000, 2530, 1543, 2382,
+    306, 2735, 3583, 2196, 1052, 1142, 3050, 425, 3253, 1591, 62, 1574,
+    66, 452, 1101, 465, 2542, 2560, 3835, 1247, 882, 260, 2526, 2067,
+    1014, 1979, 1513, 3339, 3542, 2027, 2810, 674, 3158, 379, 2393, 2619,
+    1241, 1174, 985, 1166, 1201, 1431, 3502, 647, 104, 1238, 3267, 3283,
+    2973, 228, 3004, 2794, 147, 339, 2311, 1244, 3045, 3123, 489, 1658,
+    2822, 1384, 124, 1679, 3604, 819, 2919, 689, 550, 2206, 373, 2971,
+    218, 61, 1664, 1382, 943, 1474, 3791, 2172, 2995, 1287, 2718, 1695,
+    1169, 653, 3837, 2449, 874, 3361, 1547, 2084, 1208, 37, 2686, 603,
+    2996, 3284, 1108, 251, 1995, 2099, 3720, 1383, 253, 571, 41, 288,
+    1435, 3175, 2677, 3081, 3688, 2710, 1778, 3347, 3190, 565, 1305, 791,
+    453, 2824, 1351, 1818, 1967, 3338, 3773, 2160, 1294, 1051, 2791, 1691,
+    1110, 49, 1393, 595, 2966, 351, 2999, 2198, 2617, 1611, 885, 1973,
+    1878, 3470, 3501, 3044, 1300, 3698, 3287, 3611, 1164, 459, 2750, 1879,
+    2046, 2095, 2123, 2077, 3645, 392, 2355, 3211, 930, 2747, 3355, 505,
+    1657, 2865, 2251, 1696, 564, 2293, 1320, 2370, 1019, 3712, 2618, 744,
+    136, 960, 1925, 2970, 1717, 632, 862, 2051, 780, 2462, 1801, 3407,
+    2425, 2275, 2139, 3485, 3112, 2650, 2148, 2706, 1998, 622, 631, 2384,
+    396, 29, 1965, 1419, 3820, 3291, 2667, 1494, 3, 3192, 2780, 3752,
+    911, 1333, 1041, 1835, 3701, 918, 920, 3399, 2778, 694, 3193, 1354,
+    3785, 354, 2608, 2190, 1409, 2819, 1075, 2079, 1986, 1319, 3189, 1721,
+    386, 451, 3398, 976, 418, 3437, 2015, 464, 3506, 2521, 3642, 1669,
+    2199, 959, 2480, 2476, 1004, 1140, 1737, 2645, 3160, 162, 2330, 2506,
+    1010, 2669, 3739, 3233, 630, 2220, 3011, 1286, 624, 3074, 2664, 1195,
+    3133, 922, 1654, 2657, 1368, 2958, 858, 1056, 1893, 2976, 3553, 3808,
+    3218, 1854, 2812, 2337, 3216, 555, 3306, 2241, 2779, 2466, 1367, 3543,
+    2113, 301, 2229, 3731, 859, 235, 768, 471, 428, 1344, 690, 323,
+    3519, 320, 2554, 2284, 2096, 3269, 726, 3770, 28, 3038, 420, 75,
+    1992, 157, 3704, 1460, 2236, 48, 2917, 3063, 2881, 3275, 1790, 1190,
+    1825, 870, 2254, 2432, 3102, 1349, 704, 3607, 1049, 954, 2037, 2773,
+    2900, 1856, 1985, 1496, 3241, 2969, 368, 2609, 3199, 1794, 2864, 1554,
+    2098, 3507, 516, 2270, 3258, 678, 2372, 633, 3828, 305, 3188, 2792,
+    1413, 442, 1308, 400, 3592, 1984, 1700, 3349, 54, 153, 1636, 1395,
+    1531, 1907, 672, 3310, 3183, 844, 3823, 3301, 3057, 259, 367, 614,
+    2416, 618, 2192, 3130, 3460, 295, 1903, 2205, 1388, 1261, 3404, 2010,
+    336, 470, 3035, 2590, 2215, 1522, 2759, 1590, 3529, 3247, 1863, 1038,
+    2217, 979, 1093, 2604, 281, 724, 419, 2045, 1782, 3274, 202, 173,
+    1126, 1747, 1186, 2964, 1842, 3624, 1908, 3559, 409, 2408, 205, 1053,
+    1693, 970, 2511, 201, 3334, 2651, 1647, 96, 499, 612, 1008, 1612,
+    138, 2527, 508, 3156, 3734, 2550, 3594, 2902, 3721, 1722, 72, 3101,
+    3033, 2105, 1507, 3666, 553, 3576, 2000, 2509, 2114, 1628, 227, 3066,
+    3184, 1399, 739, 944, 1898, 181, 3315, 2131, 1050, 94, 2626, 376,
+    2385, 1125, 1295, 3768, 3829, 133, 3416, 1487, 1922, 3259, 2678, 1506,
+    123, 721, 3313, 167, 3032, 2142, 1686, 2430, 215, 67, 1511, 83,
+    2173, 2643, 2391, 438, 2894, 1469, 1214, 3528, 3664, 1361, 1988, 345,
+    3373, 312, 1096, 2245, 1481, 2559, 424, 3552, 76, 2112, 2075, 3222,
+    3686, 1293, 1394, 2244, 1089, 725, 1753, 1678, 746, 831, 1197, 3811,
+    2641, 2143, 3364, 1083, 3677, 58, 3087, 3560, 1639, 606, 841, 3504,
+    3328, 1732, 1971, 245, 1007, 2226, 3144, 1278, 2813, 3550, 830, 1812,
+    1157, 1980, 1122, 1615, 210, 793, 163, 3001, 3769, 3012, 3537, 2062,
+    1337, 30, 1865, 952, 2518, 3532, 1403,
+};
+const size_t SHORT_CODE_SLOT_COUNT = std::size(SHORT_CODE_SLOTS);
+
+}  // namespace chatterino::emojitable::data
+// clang-format on
@@ -1,151 +1,81 @@
 #include "providers/emoji/Emojis.hpp"
 
-#include "common/QLogging.hpp"
+#include "debug/StartupProfiler.hpp"
 #include "messages/Emote.hpp"
 #include "messages/Image.hpp"
+#include "providers/emoji/EmojiTable.hpp"
 #include "singletons/Settings.hpp"
 #include "util/QMagicEnum.hpp"
-#include "util/RapidjsonHelpers.hpp"
 
 #include <boost/variant.hpp>
-#include <QFile>
-#include <rapidjson/error/en.h>
-#include <rapidjson/error/error.h>
-#include <rapidjson/rapidjson.h>
 
+#include <cassert>
 #include <map>
 #include <memory>
+#include <span>
 
 namespace {
 
 using namespace chatterino;
 
-const std::map<QString, QString> TONE_NAMES{
-    {"1F3FB", "tone1"}, {"1F3FC", "tone2"}, {"1F3FD", "tone3"},
-    {"1F3FE", "tone4"}, {"1F3FF", "tone5"},
-};
-
-void parseEmoji(const std::shared_ptr<EmojiData> &emojiData,
-                const rapidjson::Value &unparsedEmoji,
-                const QString &shortCode = {})
+QString fromTable(std::u16string_view text)
 {
-    std::vector<char32_t> unicodeBytes{};
-
-    struct {
-        bool apple;
-        bool google;
-        bool twitter;
-        bool facebook;
-    } capabilities{};
-
-    if (!shortCode.isEmpty())
-    {
-        emojiData->shortCodes.push_back(shortCode);
-    }
-    else
-    {
-        // Load short codes from the suggested short_names
-        const auto &shortNames = unparsedEmoji["short_names"];
-        for (const auto &shortName : shortNames.GetArray())
-        {
-            emojiData->shortCodes.emplace_back(shortName.GetString());
-        }
-    }
-
-    rj::getSafe(unparsedEmoji, "non_qualified", emojiData->nonQualifiedCode);
-    rj::getSafe(unparsedEmoji, "unified", emojiData->unifiedCode);
-    assert(!emojiData->unifiedCode.isEmpty());
-
-    rj::getSafe(unparsedEmoji, "has_img_apple", capabilities.apple);
-    rj::getSafe(unparsedEmoji, "has_img_google", capabilities.google);
-    rj::getSafe(unparsedEmoji, "has_img_twitter", capabilities.twitter);
-    rj::getSafe(unparsedEmoji, "has_img_facebook", capabilities.facebook);
-
-    if (capabilities.apple)
-    {
-        emojiData->capabilities.set(EmojiData::Capability::Apple);
-    }
-    if (capabilities.google)
-    {
-        emojiData->capabilities.set(EmojiData::Capability::Google);
-    }
-    if (capabilities.twitter)
-    {
-        emojiData->capabilities.set(EmojiData::Capability::Twitter);
-    }
-    if (capabilities.facebook)
+    if (text.empty())
     {
-        emojiData->capabilities.set(EmojiData::Capability::Facebook);
-    }
-
-    QStringList unicodeCharacters = emojiData->unifiedCode.toLower().split('-');
-
-    for (const QString &unicodeCharacter : unicodeCharacters)
-    {
-        bool ok{false};
-        unicodeBytes.push_back(unicodeCharacter.toUInt(&ok, 16));
-        if (!ok)
-        {
-            qCWarning(chatterinoEmoji)
-                << "Failed to parse emoji" << emojiData->shortCodes;
-            return;
-        }
-    }
-
-    // We can safely do a narrowing static cast since unicodeBytes will never be a large number
-    emojiData->value =
-        QString::fromUcs4(unicodeBytes.data(),
-                          static_cast<QString::size_type>(unicodeBytes.size()));
-
-    if (!emojiData->nonQualifiedCode.isEmpty())
-    {
-        QStringList nonQualifiedCharacters =
-            emojiData->nonQualifiedCode.toLower().split('-');
-        std::vector<char32_t> nonQualifiedBytes{};
-        for (const QString &unicodeCharacter : nonQualifiedCharacters)
-        {
-            bool ok{false};
-            nonQualifiedBytes.push_back(
-                QString(unicodeCharacter).toUInt(&ok, 16));
-            if (!ok)
-            {
-                qCWarning(chatterinoEmoji)
-                    << "Failed to parse emoji nonQualified"
-                    << emojiData->shortCodes;
-                return;
-            }
-        }
-
-        // We can safely do a narrowing static cast since unicodeBytes will never be a large number
-        emojiData->nonQualified = QString::fromUcs4(
-            nonQualifiedBytes.data(),
-            static_cast<QString::size_type>(nonQualifiedBytes.size()));
+        return {};
     }
+    return QString::fromRawData(reinterpret_cast<const QChar *>(text.data()),
+                                static_cast<qsizetype>(text.size()));
 }
 
-// getToneNames takes a tones and returns their names in the same order
-// The format of the tones is: "1F3FB-1F3FB" or "1F3FB"
-// The output of the tone names is: "tone1-tone1" or "tone1"
-QString getToneNames(const QString &tones)
+EmotePtr makeEmote(const EmojiData &emoji, const QString &emojiSet)
 {
-    auto toneParts = tones.split('-');
-    QStringList toneNameResults;
-    for (const auto &tonePart : toneParts)
+    // clang-format off
+    static std::map<QString, QString> emojiSets = {
+        // JSDELIVR
+        // {"Twitter", "https://cdn.jsdelivr.net/npm/emoji-datasource-twitter@4.0.4/img/twitter/64/"},
+        // {"Facebook", "https://cdn.jsdelivr.net/npm/emoji-datasource-facebook@4.0.4/img/facebook/64/"},
+        // {"Apple", "https://cdn.jsdelivr.net/npm/emoji-datasource-apple@5.0.1/img/apple/64/"},
+        // {"Google", "https://cdn.jsdelivr.net/npm/emoji-datasource-google@4.0.4/img/google/64/"},
+        // {"Messenger", "https://cdn.jsdelivr.net/npm/emoji-datasource-messenger@4.0.4/img/messenger/64/"},
+
+        // OBRODAI
+        {"Twitter", "https://pajbot.com/static/emoji-v2/img/twitter/64/"},
+        {"Facebook", "https://pajbot.com/static/emoji-v2/img/facebook/64/"},
+        {"Apple", "https://pajbot.com/static/emoji-v2/img/apple/64/"},
+        {"Google", "https://pajbot.com/static/emoji-v2/img/google/64/"},
+
+        // Cloudflare+B2 bucket
+        // {"Twitter", "https://chatterino2-emoji-cdn.pajlada.se/file/c2-emojis/emojis-v1/twitter/64/"},
+        // {"Facebook", "https://chatterino2-emoji-cdn.pajlada.se/file/c2-emojis/emojis-v1/facebook/64/"},
+        // {"Apple", "https://chatterino2-emoji-cdn.pajlada.se/file/c2-emojis/emojis-v1/apple/64/"},
+        // {"Google", "https://chatterino2-emoji-cdn.pajlada.se/file/c2-emojis/emojis-v1/google/64/"},
+    };
+    // clang-format on
+
+    EmojiData::Capability setCapability =
+        qmagicenum::enumCast<EmojiData::Capability>(emojiSet).value_or(
+            EmojiData::Capability::Google);
+
+    QString emojiSetToUse = emojiSet;
+    // Both Twitter/Twemoji and Google have all images
+    if (!emoji.capabilities.has(setCapability))
     {
-        auto toneNameIt = TONE_NAMES.find(tonePart);
-        if (toneNameIt == TONE_NAMES.end())
-        {
-            qDebug() << "Tone with key" << tonePart
-                     << "does not exist in tone names map";
-            continue;
-        }
-
-        toneNameResults.append(toneNameIt->second);
+        emojiSetToUse = QStringLiteral("Twitter");
     }
 
-    assert(!toneNameResults.isEmpty());
-
-    return toneNameResults.join('-');
+    QString code = emoji.unifiedCode.toLower();
+    QString urlPrefix = "https://pajbot.com/static/emoji-v2/img/twitter/64/";
+    auto it = emojiSets.find(emojiSetToUse);
+    if (it != emojiSets.end())
+    {
+        urlPrefix = it->second;
+    }
+    QString url = urlPrefix + code + ".png";
+    return std::make_shared<Emote>(Emote{
+        EmoteName{emoji.value},
+        ImageSet{Image::fromUrl({url}, 0.35, {64, 64})},
+        Tooltip{":" + emoji.shortCodes[0] + ":<br/>Emoji"}, Url{}});
 }
 
 }  // namespace
@@ -160,142 +90,86 @@ void Emojis::load()
     }
     this->loaded_ = true;
 
+    StartupStep step("Emojis");
     this->loadEmojis();
+    this->applyEmojiSet(getSettings()->emojiSet.getValue());
 
-    this->sortEmojis();
-
-    this->loadEmojiSet();
+    this->connectEmojiSet();
 }
 
 void Emojis::loadEmojis()
 {
-    // Current version: https://github.com/iamcal/emoji-data/blob/v15.1.1/emoji.json (Emoji version 15.1 (2023))
-    QFile file(":/emoji.json");
-    file.open(QFile::ReadOnly);
-    QTextStream s1(&file);
-    QString data = s1.readAll();
-    rapidjson::Document root;
-    rapidjson::ParseResult result = root.Parse(data.toUtf8(), data.length());
-
-    if (result.Code() != rapidjson::kParseErrorNone)
+    // The strings point into the static tables and all EmojiData objects are
+    // allocated at once
+    auto entries = emojitable::entries();
+    auto shortCodes = emojitable::shortCodes();
+
+    this->data_ = std::make_shared<Data>();
+    this->data_->shortCodes.reserve(shortCodes.size());
+    for (const auto &shortCode : shortCodes)
     {
-        qCWarning(chatterinoEmoji)
-            << "JSON parse error:" << rapidjson::GetParseError_En(result.Code())
-            << "(" << result.Offset() << ")";
-        return;
+        this->data_->shortCodes.emplace_back(fromTable(shortCode.name));
     }
+    std::span<const QString> allShortCodes = this->data_->shortCodes;
 
-    for (const auto &unparsedEmoji : root.GetArray())
+    this->data_->emojis.resize(entries.size());
+    this->emojis.reserve(entries.size());
+    for (size_t i = 0; i < entries.size(); i++)
     {
-        auto emojiData = std::make_shared<EmojiData>();
-        parseEmoji(emojiData, unparsedEmoji);
-
-        for (const auto &shortCode : emojiData->shortCodes)
-        {
-            this->emojiShortCodeToEmoji_.insert(shortCode, emojiData);
-            this->shortCodes.emplace_back(shortCode);
-        }
-
-        this->emojiFirstByte_[emojiData->value.at(0)].append(emojiData);
-
-        this->emojis.push_back(emojiData);
-
-        if (unparsedEmoji.HasMember("skin_variations"))
-        {
-            for (const auto &skinVariation :
-                 unparsedEmoji["skin_variations"].GetObject())
-            {
-                auto toneName = getToneNames(skinVariation.name.GetString());
-                const auto &variation = skinVariation.value;
-
-                auto variationEmojiData = std::make_shared<EmojiData>();
-
-                parseEmoji(variationEmojiData, variation,
-                           emojiData->shortCodes[0] + "_" + toneName);
+        const auto &entry = entries[i];
+        auto &emojiData = this->data_->emojis[i];
+        emojiData.value = fromTable(entry.value);
+        emojiData.nonQualified = fromTable(entry.nonQualified);
+        emojiData.unifiedCode = fromTable(entry.unifiedCode);
+        emojiData.nonQualifiedCode = fromTable(entry.nonQualifiedCode);
+        emojiData.capabilities =
+            EmojiData::Capabilities(static_cast<EmojiData::Capability>(
+                entry.capabilities));
+        emojiData.shortCodes =
+            allShortCodes.subspan(entry.firstShortCode, entry.shortCodeCount);
+
+        this->emojis.emplace_back(this->data_, &emojiData);
+    }
 
-                this->emojiShortCodeToEmoji_.insert(
-                    variationEmojiData->shortCodes[0], variationEmojiData);
-                this->shortCodes.push_back(variationEmojiData->shortCodes[0]);
+    this->shortCodes.reserve(shortCodes.size());
+    for (auto index : emojitable::sortedShortCodes())
+    {
+        this->shortCodes.emplace_back(allShortCodes[index]);
+    }
+}
 
-                this->emojiFirstByte_[variationEmojiData->value.at(0)].append(
-                    variationEmojiData);
+void Emojis::connectEmojiSet()
+{
+    getSettings()->emojiSet.connect(
+        [this](const auto &emojiSet) { this->applyEmojiSet(emojiSet); },
+        false);
+}
 
-                this->emojis.push_back(variationEmojiData);
-            }
-        }
-    }
+void Emojis::applyEmojiSet(const QString &emojiSet)
+{
+    std::lock_guard lock(this->emotesMutex_);
+    this->emojiSet_ = emojiSet;
+    // Emotes that were already looked up stay valid
+    this->emotes_.assign(this->data_->emojis.size(), nullptr);
 }
 
-void Emojis::sortEmojis()
+EmotePtr Emojis::emoteAt(size_t index) const
 {
-    for (auto &p : this->emojiFirstByte_)
+    std::lock_guard lock(this->emotesMutex_);
+    auto &emote = this->emotes_[index];
+    if (!emote)
     {
-        std::stable_sort(p.begin(), p.end(),
-                         [](const auto &lhs, const auto &rhs) {
-                             return lhs->value.length() > rhs->value.length();
-                         });
+        emote = makeEmote(this->data_->emojis[index], this->emojiSet_);
     }
-
-    auto &p = this->shortCodes;
-    std::stable_sort(p.begin(), p.end(), [](const auto &lhs, const auto &rhs) {
-        return lhs < rhs;
-    });
+    return emote;
 }
 
-void Emojis::loadEmojiSet()
+EmotePtr Emojis::getEmote(const EmojiData &emoji) const
 {
-    getSettings()->emojiSet.connect([this](const auto &emojiSet) {
-        EmojiData::Capability setCapability =
-            qmagicenum::enumCast<EmojiData::Capability>(emojiSet).value_or(
-                EmojiData::Capability::Google);
+    const auto &all = this->data_->emojis;
+    assert(&emoji >= all.data() && &emoji < all.data() + all.size());
 
-        for (const auto &emoji : this->emojis)
-        {
-            QString emojiSetToUse = emojiSet;
-            // clang-format off
-            static std::map<QString, QString> emojiSets = {
-                // JSDELIVR
-                // {"Twitter", "https://cdn.jsdelivr.net/npm/emoji-datasource-twitter@4.0.4/img/twitter/64/"},
-                // {"Facebook", "https://cdn.jsdelivr.net/npm/emoji-datasource-facebook@4.0.4/img/facebook/64/"},
-                // {"Apple", "https://cdn.jsdelivr.net/npm/emoji-datasource-apple@5.0.1/img/apple/64/"},
-                // {"Google", "https://cdn.jsdelivr.net/npm/emoji-datasource-google@4.0.4/img/google/64/"},
-                // {"Messenger", "https://cdn.jsdelivr.net/npm/emoji-datasource-messenger@4.0.4/img/messenger/64/"},
-
-                // OBRODAI
-                {"Twitter", "https://pajbot.com/static/emoji-v2/img/twitter/64/"},
-                {"Facebook", "https://pajbot.com/static/emoji-v2/img/facebook/64/"},
-                {"Apple", "https://pajbot.com/static/emoji-v2/img/apple/64/"},
-                {"Google", "https://pajbot.com/static/emoji-v2/img/google/64/"},
-
-                // Cloudflare+B2 bucket
-                // {"Twitter", "https://chatterino2-emoji-cdn.pajlada.se/file/c2-emojis/emojis-v1/twitter/64/"},
-                // {"Facebook", "https://chatterino2-emoji-cdn.pajlada.se/file/c2-emojis/emojis-v1/facebook/64/"},
-                // {"Apple", "https://chatterino2-emoji-cdn.pajlada.se/file/c2-emojis/emojis-v1/apple/64/"},
-                // {"Google", "https://chatterino2-emoji-cdn.pajlada.se/file/c2-emojis/emojis-v1/google/64/"},
-            };
-            // clang-format on
-
-            // Both Twitter/Twemoji and Google have all images
-            if (!emoji->capabilities.has(setCapability))
-            {
-                emojiSetToUse = QStringLiteral("Twitter");
-            }
-
-            QString code = emoji->unifiedCode.toLower();
-            QString urlPrefix =
-                "https://pajbot.com/static/emoji-v2/img/twitter/64/";
-            auto it = emojiSets.find(emojiSetToUse);
-            if (it != emojiSets.end())
-            {
-                urlPrefix = it->second;
-            }
-            QString url = urlPrefix + code + ".png";
-            emoji->emote = std::make_shared<Emote>(Emote{
-                EmoteName{emoji->value},
-                ImageSet{Image::fromUrl({url}, 0.35, {64, 64})},
-                Tooltip{":" + emoji->shortCodes[0] + ":<br/>Emoji"}, Url{}});
-        }
-    });
+    return this->emoteAt(static_cast<size_t>(&emoji - all.data()));
 }
 
 std::vector<boost::variant<EmotePtr, QString>> Emojis::parse(
@@ -313,23 +187,22 @@ std::vector<boost::variant<EmotePtr, QString>> Emojis::parse(
             continue;
         }
 
-        auto it = this->emojiFirstByte_.find(character);
-        if (it == this->emojiFirstByte_.end())
+        auto possibleEmojis = emojitable::startingWith(character.unicode());
+        if (possibleEmojis.empty())
         {
             // No emoji starts with this character
             continue;
         }
 
-        const auto &possibleEmojis = it.value();
-
         auto remainingCharacters = text.length() - i - 1;
 
-        std::shared_ptr<EmojiData> matchedEmoji;
+        size_t matchedEmoji = 0;
 
         QString::size_type matchedEmojiLength = 0;
 
-        for (const std::shared_ptr<EmojiData> &emoji : possibleEmojis)
+        for (const auto &possibleEmoji : possibleEmojis)
         {
+            const auto &emoji = this->emojis[possibleEmoji.entry];
             auto emojiNonQualifiedExtraCharacters =
                 emoji->nonQualified.length() - 1;
             auto emojiExtraCharacters = emoji->value.length() - 1;
@@ -341,7 +214,7 @@ std::vector<boost::variant<EmotePtr, QString>> Emojis::parse(
 
                 if (match)
                 {
-                    matchedEmoji = emoji;
+                    matchedEmoji = possibleEmoji.entry;
                     matchedEmojiLength = emoji->value.length();
 
                     break;
@@ -358,7 +231,7 @@ std::vector<boost::variant<EmotePtr, QString>> Emojis::parse(
 
                 if (match)
                 {
-                    matchedEmoji = emoji;
+                    matchedEmoji = possibleEmoji.entry;
                     matchedEmojiLength = emoji->nonQualified.length();
 
                     break;
@@ -385,7 +258,7 @@ std::vector<boost::variant<EmotePtr, QString>> Emojis::parse(
         }
 
         // Push the emoji as a word to parsedWords
-        result.emplace_back(matchedEmoji->emote);
+        result.emplace_back(this->emoteAt(matchedEmoji));
 
         lastParsedEmojiEndIndex = currentParsedEmojiEndIndex;
 
@@ -417,14 +290,13 @@ QString Emojis::replaceShortCodes(const QString &text) const
         QString matchString =
             capturedString.toLower().mid(1, capturedString.size() - 2);
 
-        auto emojiIt = this->emojiShortCodeToEmoji_.constFind(matchString);
-
-        if (emojiIt == this->emojiShortCodeToEmoji_.constEnd())
+        auto entry = emojitable::findShortCode(matchString);
+        if (!entry)
         {
             continue;
         }
 
-        const auto &emojiData = emojiIt.value();
+        const auto &emojiData = this->emojis[*entry];
 
         ret.replace(offset + match.capturedStart(), match.capturedLength(),
                     emojiData->value);
@@ -3,11 +3,11 @@
 #include "common/FlagsEnum.hpp"
 
 #include <boost/variant.hpp>
-#include <QMap>
 #include <QRegularExpression>
-#include <QVector>
 
 #include <memory>
+#include <mutex>
+#include <span>
 #include <vector>
 
 namespace chatterino {
@@ -28,7 +28,7 @@ struct EmojiData {
     QString nonQualifiedCode;
 
     // i.e. thinking
-    std::vector<QString> shortCodes;
+    std::span<const QString> shortCodes;
 
     enum class Capability : uint8_t {
         Apple = 1 << 0,
@@ -41,8 +41,6 @@ struct EmojiData {
     Capabilities capabilities;
 
     std::vector<EmojiData> variations;
-
-    EmotePtr emote;
 };
 
 using EmojiPtr = std::shared_ptr<EmojiData>;
@@ -57,6 +55,10 @@ public:
     virtual const std::vector<EmojiPtr> &getEmojis() const = 0;
     virtual const std::vector<QString> &getShortCodes() const = 0;
     virtual QString replaceShortCodes(const QString &text) const = 0;
+    /// @brief Returns the emote of @a emoji in the current emoji set
+    ///
+    /// The emote is created on the first lookup.
+    virtual EmotePtr getEmote(const EmojiData &emoji) const = 0;
 };
 
 class Emojis : public IEmojis
@@ -72,24 +74,33 @@ public:
 
     const std::vector<EmojiPtr> &getEmojis() const override;
     const std::vector<QString> &getShortCodes() const override;
+    EmotePtr getEmote(const EmojiData &emoji) const override;
 
 private:
     void loadEmojis();
-    void sortEmojis();
-    void loadEmojiSet();
-
+    void applyEmojiSet(const QString &emojiSet);
+    void connectEmojiSet();
+    EmotePtr emoteAt(size_t index) const;
+
+    struct Data {
+        /// All emojis in the order of emojitable::entries()
+        std::vector<EmojiData> emojis;
+        /// All short codes in the order of emojitable::shortCodes()
+        std::vector<QString> shortCodes;
+    };
+    /// The pointers in `emojis` share ownership of this
+    std::shared_ptr<Data> data_;
     std::vector<EmojiPtr> emojis;
 
+    mutable std::mutex emotesMutex_;
+    /// Guarded by emotesMutex_
+    QString emojiSet_;
+    /// Emotes of `data_` in `emojiSet_`, created on the first lookup
+    mutable std::vector<EmotePtr> emotes_;
+
     /// Emojis
     QRegularExpression findShortCodesRegex_{":([-+\\w]+):"};
 
-    // shortCodeToEmoji maps strings like "sunglasses" to its emoji
-    QMap<QString, std::shared_ptr<EmojiData>> emojiShortCodeToEmoji_;
-
-    // Maps the first character of the emoji unicode string to a vector of
-    // possible emojis
-    QMap<QChar, QVector<std::shared_ptr<EmojiData>>> emojiFirstByte_;
-
     bool loaded_ = false;
 };
 
@@ -6,6 +6,7 @@
 #include "messages/Emote.hpp"
 #include "messages/Image.hpp"
 #include "messages/MessageBuilder.hpp"
+#include "providers/EmoteSnapshot.hpp"
 #include "providers/ffz/FfzUtil.hpp"
 #include "providers/twitch/TwitchChannel.hpp"
 #include "singletons/Settings.hpp"
@@ -238,20 +239,32 @@ void FfzEmotes::loadEmotes()
         return;
     }
 
-    readProviderEmotesCache("global", "frankerfacez", [this](auto jsonDoc) {
-        auto parsedSet = parseGlobalEmotes(jsonDoc.object());
-        this->setEmotes(std::make_shared<EmoteMap>(std::move(parsedSet)));
-    });
+    QByteArray etag;
+    if (auto snapshot = readEmoteSnapshot(FFZ_SNAPSHOT_PROVIDER,
+                                          globalEmoteSnapshotKey()))
+    {
+        this->setEmotes(
+            std::make_shared<EmoteMap>(std::move(snapshot->emotes)));
+        etag = std::move(snapshot->etag);
+    }
 
     QString url("https://api.frankerfacez.com/v1/set/global");
 
     NetworkRequest(url)
         .timeout(30000)
+        .ifNoneMatch(etag)
         .onSuccess([this](auto result) {
-            writeProviderEmotesCache("global", "frankerfacez",
-                                     result.getData());
-            auto parsedSet = parseGlobalEmotes(result.parseJson());
-            this->setEmotes(std::make_shared<EmoteMap>(std::move(parsedSet)));
+            if (result.status() == 304)
+            {
+                qCDebug(LOG) << "Global FFZ emotes didn't change";
+                return;
+            }
+
+            auto parsedSet = std::make_shared<EmoteMap>(
+                parseGlobalEmotes(result.parseJson()));
+            writeEmoteSnapshot(FFZ_SNAPSHOT_PROVIDER, globalEmoteSnapshotKey(),
+                               parsedSet, result.rawHeader("ETag"));
+            this->setEmotes(std::move(parsedSet));
         })
         .onError([](auto result) {
             qCWarning(chatterinoFfzemotes)
@@ -284,8 +297,6 @@ void FfzEmotes::loadChannel(
                     vipBadgeCallback = std::move(vipBadgeCallback),
                     channelBadgesCallback = std::move(channelBadgesCallback),
                     channel, channelID, manualRefresh](const auto &result) {
-            writeProviderEmotesCache(channelID, "frankerfacez",
-                                     result.getData());
             const auto json = result.parseJson();
 
             auto emoteMap = parseChannelEmotes(json);
@@ -1,15 +1,13 @@
 #pragma once
 
 #include "common/QLogging.hpp"
-#include "providers/liveupdates/BasicPubSubWebsocket.hpp"
-#include "singletons/Settings.hpp"
+#include "common/websockets/WebSocketPool.hpp"
 #include "util/DebugCount.hpp"
-#include "util/Helpers.hpp"
 
-#include <pajlada/signals/signal.hpp>
+#include <QByteArray>
+#include <QString>
 
 #include <atomic>
-#include <chrono>
 #include <unordered_set>
 
 namespace chatterino {
@@ -33,11 +31,10 @@ public:
     // The maximum amount of subscriptions this connections can handle
     const size_t maxSubscriptions;
 
-    BasicPubSubClient(liveupdates::WebsocketClient &websocketClient,
-                      liveupdates::WebsocketHandle handle,
+    BasicPubSubClient(WebSocketPool &pool, WebSocketHandle handle,
                       size_t maxSubscriptions = 100)
         : maxSubscriptions(maxSubscriptions)
-        , websocketClient_(websocketClient)
+        , pool_(pool)
         , handle_(std::move(handle))
     {
     }
@@ -50,24 +47,14 @@ public:
     BasicPubSubClient &operator=(const BasicPubSubClient &&) = delete;
 
 protected:
+    /// Called from the websocket thread once the connection is open
     virtual void onConnectionEstablished()
     {
     }
 
-    bool send(const char *payload)
+    void send(const QByteArray &payload)
     {
-        liveupdates::WebsocketErrorCode ec;
-        this->websocketClient_.send(this->handle_, payload,
-                                    websocketpp::frame::opcode::text, ec);
-
-        if (ec)
-        {
-            qCDebug(chatterinoLiveupdates) << "Error sending message" << payload
-                                           << ":" << ec.message().c_str();
-            return false;
-        }
-
-        return true;
+        this->handle_.sendText(payload);
     }
 
     /**
@@ -96,8 +83,7 @@ protected:
         qCDebug(chatterinoLiveupdates) << "Subscribing to" << subscription;
         DebugCount::increase("LiveUpdates subscriptions");
 
-        QByteArray encoded = subscription.encodeSubscribe();
-        this->send(encoded);
+        this->send(subscription.encodeSubscribe());
 
         return true;
     }
@@ -116,33 +102,16 @@ protected:
         qCDebug(chatterinoLiveupdates) << "Unsubscribing from" << subscription;
         DebugCount::decrease("LiveUpdates subscriptions");
 
-        QByteArray encoded = subscription.encodeUnsubscribe();
-        this->send(encoded);
+        this->send(subscription.encodeUnsubscribe());
 
         return true;
     }
 
-    void close(const std::string &reason,
-               websocketpp::close::status::value code =
-                   websocketpp::close::status::normal)
+    /// Closes the connection. Can be called from any thread.
+    void close(const QString &reason)
     {
-        liveupdates::WebsocketErrorCode ec;
-
-        auto conn = this->websocketClient_.get_con_from_hdl(this->handle_, ec);
-        if (ec)
-        {
-            qCDebug(chatterinoLiveupdates)
-                << "Error getting connection:" << ec.message().c_str();
-            return;
-        }
-
-        conn->close(code, reason, ec);
-        if (ec)
-        {
-            qCDebug(chatterinoLiveupdates)
-                << "Error closing:" << ec.message().c_str();
-            return;
-        }
+        qCDebug(chatterinoLiveupdates) << "Closing connection:" << reason;
+        this->handle_.close();
     }
 
     bool isStarted() const
@@ -159,7 +128,8 @@ protected:
     {
     }
 
-    liveupdates::WebsocketClient &websocketClient_;
+    /// The pool this connection lives in (e.g. for timers)
+    WebSocketPool &pool_;
 
 private:
     void start()
@@ -177,7 +147,7 @@ private:
         this->stopImpl();
     }
 
-    liveupdates::WebsocketHandle handle_;
+    WebSocketHandle handle_;
     std::unordered_set<Subscription> subscriptions_;
 
     std::atomic<bool> started_{false};
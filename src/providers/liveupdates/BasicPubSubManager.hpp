@@ -1,30 +1,21 @@
 #pragma once
 
 #include "common/QLogging.hpp"
-#include "common/Version.hpp"
+#include "common/websockets/WebSocketPool.hpp"
 #include "providers/liveupdates/BasicPubSubClient.hpp"
-#include "providers/liveupdates/BasicPubSubWebsocket.hpp"
-#include "providers/NetworkConfigurationProvider.hpp"
-#include "providers/twitch/PubSubHelpers.hpp"
 #include "util/DebugCount.hpp"
 #include "util/ExponentialBackoff.hpp"
 #include "util/OnceFlag.hpp"
-#include "util/RenameThread.hpp"
 
-#include <pajlada/signals/signal.hpp>
-#include <QJsonObject>
-#include <QScopeGuard>
+#include <QByteArray>
 #include <QString>
-#include <QStringBuilder>
-#include <websocketpp/client.hpp>
+#include <QUrl>
 
 #include <algorithm>
 #include <atomic>
 #include <chrono>
-#include <exception>
-#include <map>
 #include <memory>
-#include <thread>
+#include <mutex>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -36,13 +27,15 @@ namespace chatterino {
  * simple PubSub servers over the Websocket protocol.
  * It acts as a pool for connections (see BasicPubSubClient).
  *
+ * Connections are opened in a WebSocketPool. Managers sharing a pool share
+ * its thread. Subscriptions are packed into as few connections as possible.
+ *
  * You can customize the clients, by creating your custom
  * client in ::createClient.
  *
  * You **must** implement #onMessage. The method gets called for every
- * received message on every connection.
- * If you want to get the connection this message was received on,
- * use #findClient.
+ * received message on every connection from the websocket thread, so
+ * messages can be parsed there.
  *
  * You must expose your own subscribe and unsubscribe methods
  * (e.g. [un-]subscribeTopic).
@@ -63,40 +56,17 @@ template <typename Subscription>
 class BasicPubSubManager
 {
 public:
-    BasicPubSubManager(QString host, QString shortName)
+    /// @param pool The pool to open connections in. If this is null, the
+    ///             manager creates its own pool.
+    BasicPubSubManager(QString host, QString shortName,
+                       WebSocketPool *pool = nullptr)
         : host_(std::move(host))
         , shortName_(std::move(shortName))
+        , ownPool_(pool == nullptr ? std::make_unique<WebSocketPool>()
+                                   : nullptr)
+        , pool_(pool == nullptr ? *this->ownPool_ : *pool)
+        , lifetime_(std::make_shared<Lifetime>(this))
     {
-        this->websocketClient_.set_access_channels(
-            websocketpp::log::alevel::all);
-        this->websocketClient_.clear_access_channels(
-            websocketpp::log::alevel::frame_payload |
-            websocketpp::log::alevel::frame_header);
-
-        this->websocketClient_.init_asio();
-
-        // SSL Handshake
-        this->websocketClient_.set_tls_init_handler([this](auto hdl) {
-            return this->onTLSInit(hdl);
-        });
-
-        this->websocketClient_.set_message_handler([this](auto hdl, auto msg) {
-            this->onMessage(hdl, msg);
-        });
-        this->websocketClient_.set_open_handler([this](auto hdl) {
-            this->onConnectionOpen(hdl);
-        });
-        this->websocketClient_.set_close_handler([this](auto hdl) {
-            this->onConnectionClose(hdl);
-        });
-        this->websocketClient_.set_fail_handler([this](auto hdl) {
-            this->onConnectionFail(hdl);
-        });
-        this->websocketClient_.set_user_agent(
-            QStringLiteral("Chatterino/%1 (%2)")
-                .arg(Version::instance().version(),
-                     Version::instance().commitHash())
-                .toStdString());
     }
 
     virtual ~BasicPubSubManager()
@@ -117,23 +87,18 @@ public:
         std::atomic<uint32_t> connectionsFailed{0};
     } diag;
 
+    /// Starts opening connections for subscriptions
     void start()
     {
-        this->work_ = std::make_shared<boost::asio::executor_work_guard<
-            boost::asio::io_context::executor_type>>(
-            this->websocketClient_.get_io_service().get_executor());
-        this->mainThread_.reset(new std::thread([this] {
-            // make sure we set in any case, even exceptions
-            auto guard = qScopeGuard([&] {
-                this->stoppedFlag_.set();
-            });
-
-            runThread();
-        }));
-
-        renameThread(*this->mainThread_.get(), "BPSM-" % this->shortName_);
+        std::lock_guard lock(this->mutex_);
+        this->started_ = true;
+        if (!this->pendingSubscriptions_.empty())
+        {
+            this->addClient();
+        }
     }
 
+    /// Closes all connections and waits (up to 100ms) for them to close
     void stop()
     {
         if (this->stopping_)
@@ -141,122 +106,164 @@ public:
             return;
         }
 
-        this->stopping_ = true;
-
-        for (const auto &client : this->clients_)
-        {
-            client.second->close("Shutting down");
-        }
-
-        this->work_.reset();
-
-        if (!this->mainThread_->joinable())
         {
-            return;
-        }
+            std::lock_guard lock(this->mutex_);
+            this->stopping_ = true;
 
-        // NOTE:
-        // There is a case where a new client was initiated but not added to the clients list.
-        // We just don't join the thread & let the operating system nuke the thread if joining fails
-        // within 1s.
-        if (this->stoppedFlag_.waitFor(std::chrono::milliseconds{100}))
-        {
-            this->mainThread_->join();
-            return;
+            for (auto &[id, handle] : this->connecting_)
+            {
+                handle.close();
+            }
+            for (const auto &[id, client] : this->clients_)
+            {
+                client->close(QStringLiteral("Shutting down"));
+            }
+            if (this->connecting_.empty() && this->clients_.empty())
+            {
+                this->stoppedFlag_.set();
+            }
         }
 
-        qCWarning(chatterinoLiveupdates)
-            << "Thread didn't finish within 100ms, force-stop the client";
-        this->websocketClient_.stop();
-        if (this->stoppedFlag_.waitFor(std::chrono::milliseconds{20}))
+        if (!this->stoppedFlag_.waitFor(std::chrono::milliseconds{100}))
         {
-            this->mainThread_->join();
-            return;
+            qCWarning(chatterinoLiveupdates)
+                << this->shortName_
+                << "connections didn't close within 100ms, discarding them";
         }
 
-        qCWarning(chatterinoLiveupdates)
-            << "Thread didn't finish after stopping, discard it";
-        // detach the thread so the destructor doesn't attempt any joining
-        this->mainThread_->detach();
+        // From here on, no callback from a connection reaches this manager
+        std::lock_guard lock(this->lifetime_->mutex);
+        this->lifetime_->manager = nullptr;
     }
 
 protected:
-    using WebsocketMessagePtr =
-        websocketpp::config::asio_tls_client::message_type::ptr;
-    using WebsocketContextPtr =
-        websocketpp::lib::shared_ptr<boost::asio::ssl::context>;
-
-    virtual void onMessage(websocketpp::connection_hdl hdl,
-                           WebsocketMessagePtr msg) = 0;
+    /// Called from the websocket thread for every text message
+    virtual void onMessage(BasicPubSubClient<Subscription> &client,
+                           const QByteArray &payload) = 0;
 
     virtual std::shared_ptr<BasicPubSubClient<Subscription>> createClient(
-        liveupdates::WebsocketClient &client, websocketpp::connection_hdl hdl)
+        WebSocketPool &pool, WebSocketHandle handle)
     {
-        return std::make_shared<BasicPubSubClient<Subscription>>(client, hdl);
+        return std::make_shared<BasicPubSubClient<Subscription>>(
+            pool, std::move(handle));
     }
 
-    /**
-     * @param hdl The handle of the client.
-     * @return The client managing this connection, empty shared_ptr otherwise.
-     */
-    std::shared_ptr<BasicPubSubClient<Subscription>> findClient(
-        websocketpp::connection_hdl hdl)
+    void unsubscribe(const Subscription &subscription)
     {
-        auto clientIt = this->clients_.find(hdl);
-
-        if (clientIt == this->clients_.end())
+        std::lock_guard lock(this->mutex_);
+        for (auto &[id, client] : this->clients_)
         {
-            return {};
+            if (client->unsubscribe(subscription))
+            {
+                return;
+            }
         }
-
-        return clientIt->second;
     }
 
-    void unsubscribe(const Subscription &subscription)
+    void subscribe(const Subscription &subscription)
     {
-        for (auto &client : this->clients_)
+        std::lock_guard lock(this->mutex_);
+        this->subscribeLocked(subscription);
+    }
+
+private:
+    /// Ensures callbacks from connections and timers don't use the manager
+    /// after it stopped.
+    struct Lifetime {
+        explicit Lifetime(BasicPubSubManager *manager)
+            : manager(manager)
         {
-            if (client.second->unsubscribe(subscription))
+        }
+
+        std::mutex mutex;
+        BasicPubSubManager *manager;
+
+        /// Calls @a fn with the manager if it's still alive
+        static void with(const std::weak_ptr<Lifetime> &weak, auto &&fn)
+        {
+            auto self = weak.lock();
+            if (!self)
             {
                 return;
             }
+            std::lock_guard lock(self->mutex);
+            if (self->manager != nullptr)
+            {
+                fn(*self->manager);
+            }
         }
-    }
+    };
 
-    void subscribe(const Subscription &subscription)
+    class Listener : public WebSocketListener
     {
-        if (this->trySubscribe(subscription))
+    public:
+        Listener(std::weak_ptr<Lifetime> lifetime, size_t id)
+            : lifetime_(std::move(lifetime))
+            , id_(id)
         {
-            return;
         }
 
-        this->addClient();
-        this->pendingSubscriptions_.emplace_back(subscription);
-        DebugCount::increase("LiveUpdates subscription backlog");
-    }
+        void onOpen() override
+        {
+            this->opened_ = true;
+            Lifetime::with(this->lifetime_, [&](BasicPubSubManager &manager) {
+                manager.onConnectionOpen(this->id_);
+            });
+        }
 
-private:
-    void onConnectionOpen(websocketpp::connection_hdl hdl)
+        void onTextMessage(QByteArray data) override
+        {
+            Lifetime::with(this->lifetime_, [&](BasicPubSubManager &manager) {
+                manager.onTextMessage(this->id_, data);
+            });
+        }
+
+        void onBinaryMessage(QByteArray /*data*/) override
+        {
+        }
+
+        void onClose(std::unique_ptr<WebSocketListener> /*self*/) override
+        {
+            Lifetime::with(this->lifetime_, [&](BasicPubSubManager &manager) {
+                manager.onConnectionClose(this->id_, this->opened_);
+            });
+        }
+
+    private:
+        std::weak_ptr<Lifetime> lifetime_;
+        size_t id_;
+        bool opened_ = false;
+    };
+
+    void onConnectionOpen(size_t id)
     {
+        std::lock_guard lock(this->mutex_);
+
         DebugCount::increase("LiveUpdates connections");
         this->addingClient_ = false;
         this->diag.connectionsOpened.fetch_add(1, std::memory_order_acq_rel);
 
         this->connectBackoff_.reset();
 
-        auto client = this->createClient(this->websocketClient_, hdl);
+        auto handle = this->connecting_.extract(id);
+        if (handle.empty())
+        {
+            // If this assert goes off, there's something wrong with the
+            // connection creation/preserving code KKona
+            assert(false);
+            return;
+        }
 
-        // We separate the starting from the constructor because we will want to use
-        // shared_from_this
+        auto client =
+            this->createClient(this->pool_, std::move(handle.mapped()));
         client->start();
-
-        this->clients_.emplace(hdl, client);
+        this->clients_.emplace(id, client);
 
         auto pendingSubsToTake = std::min(this->pendingSubscriptions_.size(),
                                           client->maxSubscriptions);
 
         qCDebug(chatterinoLiveupdates)
-            << "LiveUpdate connection opened, subscribing to"
+            << this->shortName_ << "connection opened, subscribing to"
             << pendingSubsToTake << "subscriptions!";
 
         while (pendingSubsToTake > 0 && !this->pendingSubscriptions_.empty())
@@ -280,151 +287,145 @@ private:
         }
     }
 
-    void onConnectionFail(websocketpp::connection_hdl hdl)
+    void onTextMessage(size_t id, const QByteArray &data)
     {
-        DebugCount::increase("LiveUpdates failed connections");
-        this->diag.connectionsFailed.fetch_add(1, std::memory_order_acq_rel);
-
-        if (auto conn = this->websocketClient_.get_con_from_hdl(std::move(hdl)))
-        {
-            qCDebug(chatterinoLiveupdates)
-                << "LiveUpdates connection attempt failed (error: "
-                << conn->get_ec().message().c_str() << ")";
-        }
-        else
+        std::shared_ptr<BasicPubSubClient<Subscription>> client;
         {
-            qCDebug(chatterinoLiveupdates)
-                << "LiveUpdates connection attempt failed but we can't get the "
-                   "connection from a handle.";
-        }
-        this->addingClient_ = false;
-        if (!this->pendingSubscriptions_.empty())
-        {
-            runAfter(this->websocketClient_.get_io_service(),
-                     this->connectBackoff_.next(), [this](auto /*timer*/) {
-                         this->addClient();
-                     });
+            std::lock_guard lock(this->mutex_);
+            auto it = this->clients_.find(id);
+            if (it == this->clients_.end())
+            {
+                return;
+            }
+            client = it->second;
         }
+
+        // Not holding the lock allows subclasses to (un-)subscribe here
+        this->onMessage(*client, data);
     }
 
-    void onConnectionClose(websocketpp::connection_hdl hdl)
+    void onConnectionClose(size_t id, bool opened)
     {
-        qCDebug(chatterinoLiveupdates) << "Connection closed";
-        DebugCount::decrease("LiveUpdates connections");
-        this->diag.connectionsClosed.fetch_add(1, std::memory_order_acq_rel);
-
-        auto clientIt = this->clients_.find(hdl);
-
-        // If this assert goes off, there's something wrong with the connection
-        // creation/preserving code KKona
-        assert(clientIt != this->clients_.end());
+        std::lock_guard lock(this->mutex_);
 
-        auto client = clientIt->second;
+        if (opened)
+        {
+            qCDebug(chatterinoLiveupdates)
+                << this->shortName_ << "connection closed";
+            DebugCount::decrease("LiveUpdates connections");
+            this->diag.connectionsClosed.fetch_add(1,
+                                                   std::memory_order_acq_rel);
 
-        this->clients_.erase(clientIt);
+            auto clientIt = this->clients_.find(id);
+            assert(clientIt != this->clients_.end());
+            auto client = clientIt->second;
+            this->clients_.erase(clientIt);
 
-        client->stop();
+            client->stop();
 
-        if (!this->stopping_)
-        {
-            for (const auto &sub : client->subscriptions_)
+            if (!this->stopping_)
             {
-                this->subscribe(sub);
+                for (const auto &sub : client->subscriptions_)
+                {
+                    this->subscribeLocked(sub);
+                }
             }
         }
-    }
-
-    WebsocketContextPtr onTLSInit(const websocketpp::connection_hdl & /*hdl*/)
-    {
-        WebsocketContextPtr ctx(new boost::asio::ssl::context(
-            boost::asio::ssl::context::tls_client));
-
-        try
-        {
-            ctx->set_options(boost::asio::ssl::context::default_workarounds |
-                             boost::asio::ssl::context::no_tlsv1 |
-                             boost::asio::ssl::context::no_tlsv1_1 |
-                             boost::asio::ssl::context::single_dh_use);
-        }
-        catch (const std::exception &e)
+        else
         {
             qCDebug(chatterinoLiveupdates)
-                << "Exception caught in OnTLSInit:" << e.what();
+                << this->shortName_ << "connection attempt failed";
+            DebugCount::increase("LiveUpdates failed connections");
+            this->diag.connectionsFailed.fetch_add(1,
+                                                   std::memory_order_acq_rel);
+
+            this->connecting_.erase(id);
+            this->addingClient_ = false;
+            if (!this->pendingSubscriptions_.empty() && !this->stopping_)
+            {
+                this->pool_.runAfter(
+                    this->connectBackoff_.next(),
+                    [lifetime{std::weak_ptr(this->lifetime_)}] {
+                        Lifetime::with(lifetime,
+                                       [](BasicPubSubManager &manager) {
+                                           std::lock_guard lock(
+                                               manager.mutex_);
+                                           manager.addClient();
+                                       });
+                    });
+            }
         }
 
-        return ctx;
+        if (this->stopping_ && this->connecting_.empty() &&
+            this->clients_.empty())
+        {
+            this->stoppedFlag_.set();
+        }
     }
 
-    void runThread()
+    /// Must be called with #mutex_ held
+    void subscribeLocked(const Subscription &subscription)
     {
-        qCDebug(chatterinoLiveupdates) << "Start LiveUpdates manager thread";
-        this->websocketClient_.run();
-        qCDebug(chatterinoLiveupdates)
-            << "Done with LiveUpdates manager thread";
+        for (auto &[id, client] : this->clients_)
+        {
+            if (client->subscribe(subscription))
+            {
+                return;
+            }
+        }
+
+        this->pendingSubscriptions_.emplace_back(subscription);
+        DebugCount::increase("LiveUpdates subscription backlog");
+        this->addClient();
     }
 
+    /// Must be called with #mutex_ held
     void addClient()
     {
-        if (this->addingClient_)
+        if (this->addingClient_ || !this->started_ || this->stopping_)
         {
             return;
         }
 
-        qCDebug(chatterinoLiveupdates) << "Adding an additional client";
+        qCDebug(chatterinoLiveupdates)
+            << "Adding an additional" << this->shortName_ << "client";
 
         this->addingClient_ = true;
 
-        websocketpp::lib::error_code ec;
-        auto con = this->websocketClient_.get_connection(
-            this->host_.toStdString(), ec);
+        auto id = this->nextConnectionID_++;
+        this->connecting_.emplace(
+            id, this->pool_.createSocket(
+                    {.url = QUrl(this->host_)},
+                    std::make_unique<Listener>(this->lifetime_, id)));
+    }
 
-        if (ec)
-        {
-            qCDebug(chatterinoLiveupdates)
-                << "Unable to establish connection:" << ec.message().c_str();
-            return;
-        }
+    const QString host_;
 
-        NetworkConfigurationProvider::applyToWebSocket(con);
+    /// Short name of the service (e.g. "7TV" or "BTTV")
+    const QString shortName_;
 
-        this->websocketClient_.connect(con);
-    }
+    std::unique_ptr<WebSocketPool> ownPool_;
+    WebSocketPool &pool_;
 
-    bool trySubscribe(const Subscription &subscription)
-    {
-        for (auto &client : this->clients_)
-        {
-            if (client.second->subscribe(subscription))
-            {
-                return true;
-            }
-        }
-        return false;
-    }
+    std::shared_ptr<Lifetime> lifetime_;
 
-    std::map<liveupdates::WebsocketHandle,
-             std::shared_ptr<BasicPubSubClient<Subscription>>,
-             std::owner_less<liveupdates::WebsocketHandle>>
+    /// Protects the state below. Connection callbacks run on the websocket
+    /// thread, while subscriptions are usually made from the GUI thread.
+    std::mutex mutex_;
+
+    /// Connections that aren't open yet
+    std::unordered_map<size_t, WebSocketHandle> connecting_;
+    std::unordered_map<size_t, std::shared_ptr<BasicPubSubClient<Subscription>>>
         clients_;
+    size_t nextConnectionID_ = 0;
 
     std::vector<Subscription> pendingSubscriptions_;
-    std::atomic<bool> addingClient_{false};
+    bool addingClient_ = false;
+    bool started_ = false;
     ExponentialBackoff<5> connectBackoff_{std::chrono::milliseconds(1000)};
 
-    std::shared_ptr<boost::asio::executor_work_guard<
-        boost::asio::io_context::executor_type>>
-        work_{nullptr};
-
-    liveupdates::WebsocketClient websocketClient_;
-    std::unique_ptr<std::thread> mainThread_;
     OnceFlag stoppedFlag_;
-
-    const QString host_;
-
-    /// Short name of the service (e.g. "7TV" or "BTTV")
-    const QString shortName_;
-
-    bool stopping_{false};
+    std::atomic<bool> stopping_{false};
 };
 
 }  // namespace chatterino
@@ -34,16 +34,33 @@ void SeventvAPI::getUserByTwitchID(
         .execute();
 }
 
+void SeventvAPI::getUserByTwitchIDRaw(
+    const QString &twitchID, SuccessCallback<const NetworkResult &> &&onSuccess,
+    ErrorCallback &&onError, const QByteArray &etag)
+{
+    NetworkRequest(API_URL_USER.arg(twitchID), NetworkRequestType::Get)
+        .timeout(20000)
+        .ifNoneMatch(etag)
+        .onSuccess(
+            [callback = std::move(onSuccess)](const NetworkResult &result) {
+                callback(result);
+            })
+        .onError([callback = std::move(onError)](const NetworkResult &result) {
+            callback(result);
+        })
+        .execute();
+}
+
 void SeventvAPI::getEmoteSet(const QString &emoteSet,
-                             SuccessCallback<const QJsonObject &> &&onSuccess,
-                             ErrorCallback &&onError)
+                             SuccessCallback<const NetworkResult &> &&onSuccess,
+                             ErrorCallback &&onError, const QByteArray &etag)
 {
     NetworkRequest(API_URL_EMOTE_SET.arg(emoteSet), NetworkRequestType::Get)
         .timeout(25000)
+        .ifNoneMatch(etag)
         .onSuccess(
             [callback = std::move(onSuccess)](const NetworkResult &result) {
-                auto json = result.parseJson();
-                callback(json);
+                callback(result);
             })
         .onError([callback = std::move(onError)](const NetworkResult &result) {
             callback(result);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <QByteArray>
+
 #include <functional>
 
 class QString;
@@ -28,9 +30,19 @@ public:
         const QString &twitchID,
         SuccessCallback<const QJsonObject &> &&onSuccess,
         ErrorCallback &&onError);
+
+    /// Like #getUserByTwitchID, but passes the unparsed response.
+    /// If @a etag is set, the response might be a 304 without a body.
+    virtual void getUserByTwitchIDRaw(
+        const QString &twitchID,
+        SuccessCallback<const NetworkResult &> &&onSuccess,
+        ErrorCallback &&onError, const QByteArray &etag = {});
+    /// Passes the unparsed response (see seventv::detail::parseEmoteSet).
+    /// If @a etag is set, the response might be a 304 without a body.
     virtual void getEmoteSet(const QString &emoteSet,
-                             SuccessCallback<const QJsonObject &> &&onSuccess,
-                             ErrorCallback &&onError);
+                             SuccessCallback<const NetworkResult &> &&onSuccess,
+                             ErrorCallback &&onError,
+                             const QByteArray &etag = {});
 
     virtual void updatePresence(const QString &twitchChannelID,
                                 const QString &seventvUserID,
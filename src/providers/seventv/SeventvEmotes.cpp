@@ -8,11 +8,13 @@
 #include "messages/Image.hpp"
 #include "messages/ImageSet.hpp"
 #include "messages/MessageBuilder.hpp"
+#include "providers/EmoteSnapshot.hpp"
 #include "providers/seventv/eventapi/Dispatch.hpp"
 #include "providers/seventv/SeventvAPI.hpp"
 #include "providers/twitch/TwitchChannel.hpp"
 #include "singletons/Settings.hpp"
 #include "util/Helpers.hpp"
+#include "util/JsonStream.hpp"
 
 #include <QJsonArray>
 #include <QJsonDocument>
@@ -22,6 +24,7 @@
 
 #include <array>
 #include <utility>
+#include <vector>
 
 /**
  * # References
@@ -39,6 +42,7 @@ using namespace seventv::eventapi;
 
 // These declarations won't throw an exception.
 const QString CHANNEL_HAS_NO_EMOTES("This channel has no 7TV channel emotes.");
+
 const QString EMOTE_LINK_FORMAT("https://7tv.app/emotes/%1");
 
 struct CreateEmoteResult {
@@ -56,14 +60,151 @@ EmotePtr cachedOrMake(Emote &&emote, const EmoteId &id)
     return cachedOrMakeEmotePtr(std::move(emote), cache, mutex, id);
 }
 
+/// A file of an ImageHost
+struct ImageFile {
+    QString name;
+    QString staticName;
+    double width = 0;
+    int height = 16;
+    bool isWebp = false;
+};
+
+/// The fields of an ImageHost we use
+struct ImageHost {
+    // "//cdn.7tv[...]"
+    QString url;
+    std::vector<ImageFile> files;
+};
+
+/// The fields of an ActiveEmote and its EmotePartial (data) we use
+struct ActiveEmoteFields {
+    QString id;
+    QString name;
+    int64_t flags = 0;
+
+    bool hasData = false;
+    QString baseName;
+    int64_t dataFlags = 0;
+    bool listed = false;
+    QString author;
+    ImageHost host;
+};
+
+ImageHost imageHostFromJson(const QJsonObject &emoteData)
+{
+    auto host = emoteData["host"].toObject();
+    ImageHost result{.url = host["url"].toString()};
+
+    for (auto fileItem : host["files"].toArray())
+    {
+        auto file = fileItem.toObject();
+        if (file["format"].toString() != "WEBP")
+        {
+            continue;  // We only use webp
+        }
+        result.files.push_back({
+            .name = file["name"].toString(),
+            .staticName = file["static_name"].toString(),
+            .width = file["width"].toDouble(),
+            .height = file["height"].toInt(16),
+            .isWebp = true,
+        });
+    }
+
+    return result;
+}
+
+ActiveEmoteFields activeEmoteFromJson(const QJsonObject &activeEmote)
+{
+    auto emoteData = activeEmote["data"].toObject();
+    return {
+        .id = activeEmote["id"].toString(),
+        .name = activeEmote["name"].toString(),
+        .flags = activeEmote["flags"].toInt(),
+        .hasData = !emoteData.empty(),
+        .baseName = emoteData["name"].toString(),
+        .dataFlags = emoteData["flags"].toInt(),
+        .listed = emoteData["listed"].toBool(),
+        .author = emoteData["owner"].toObject()["display_name"].toString(),
+        .host = imageHostFromJson(emoteData),
+    };
+}
+
+ImageSet makeImageSet(const ImageHost &host, bool useStatic)
+{
+    std::array<ImagePtr, 4> sizes;
+    double baseWidth = 0.0;
+    size_t nextSize = 0;
+
+    for (const auto &file : host.files)
+    {
+        if (nextSize >= sizes.size())
+        {
+            break;
+        }
+
+        double scale = 1.0;  // in relation to first image
+        if (baseWidth > 0.0)
+        {
+            scale = baseWidth / file.width;
+        }
+        else
+        {
+            // => this is the first image
+            baseWidth = file.width;
+        }
+
+        const auto &name = useStatic && !file.staticName.isEmpty()
+                               ? file.staticName
+                               : file.name;
+
+        auto image = Image::fromUrl(
+            {QString("https:%1/%2").arg(host.url, name)}, scale,
+            {static_cast<int>(file.width), file.height});
+
+        sizes.at(nextSize) = image;
+        nextSize++;
+    }
+
+    if (nextSize < sizes.size())
+    {
+        // this should be really rare
+        // this means we didn't get all sizes of an emote
+        if (nextSize == 0)
+        {
+            qCDebug(chatterinoSeventv)
+                << "Got file list without any eligible files";
+            // When this emote is typed, chatterino will crash.
+            return ImageSet{};
+        }
+        for (; nextSize < sizes.size(); nextSize++)
+        {
+            sizes.at(nextSize) = Image::getEmpty();
+        }
+    }
+
+    // Typically, 7TV provides four versions (1x, 2x, 3x, and 4x). The 3x
+    // version has a scale factor of 1/3, which is a size other providers don't
+    // provide - they only provide the 4x version (0.25). To be in line with
+    // other providers, we prefer the 4x version but fall back to the 3x one if
+    // it doesn't exist.
+    auto largest = std::move(sizes[3]);
+    if (!largest || largest->isEmpty())
+    {
+        largest = std::move(sizes[2]);
+    }
+
+    return ImageSet{sizes[0], sizes[1], largest};
+}
+
 /**
   * This decides whether an emote should be displayed
   * as zero-width
   */
-bool isZeroWidthActive(const QJsonObject &activeEmote)
+bool isZeroWidthActive(const ActiveEmoteFields &activeEmote)
 {
     auto flags = SeventvActiveEmoteFlags(
-        SeventvActiveEmoteFlag(activeEmote.value("flags").toInt()));
+        SeventvActiveEmoteFlag(activeEmote.flags));
     return flags.has(SeventvActiveEmoteFlag::ZeroWidth);
 }
 
@@ -97,14 +238,13 @@ Tooltip createAliasedTooltip(const QString &name, const QString &baseName,
                                              : author.toHtmlEscaped())};
 }
 
-CreateEmoteResult createEmote(const QJsonObject &activeEmote,
-                              const QJsonObject &emoteData, bool isGlobal)
+CreateEmoteResult createEmote(const ActiveEmoteFields &activeEmote,
+                              bool isGlobal)
 {
-    auto emoteId = EmoteId{activeEmote["id"].toString()};
-    auto emoteName = EmoteName{activeEmote["name"].toString()};
-    auto author =
-        EmoteAuthor{emoteData["owner"].toObject()["display_name"].toString()};
-    auto baseEmoteName = EmoteName{emoteData["name"].toString()};
+    auto emoteId = EmoteId{activeEmote.id};
+    auto emoteName = EmoteName{activeEmote.name};
+    auto author = EmoteAuthor{activeEmote.author};
+    auto baseEmoteName = EmoteName{activeEmote.baseName};
     bool zeroWidth = isZeroWidthActive(activeEmote);
     bool aliasedName = emoteName != baseEmoteName;
     auto tooltip =
@@ -112,7 +252,7 @@ CreateEmoteResult createEmote(const QJsonObject &activeEmote,
             ? createAliasedTooltip(emoteName.string, baseEmoteName.string,
                                    author.string, isGlobal)
             : createTooltip(emoteName.string, author.string, isGlobal);
-    auto imageSet = SeventvEmotes::createImageSet(emoteData, false);
+    auto imageSet = makeImageSet(activeEmote.host, false);
 
     auto emote = Emote({
         emoteName,
@@ -128,18 +268,226 @@ CreateEmoteResult createEmote(const QJsonObject &activeEmote,
     return {emote, emoteId, emoteName, !emote.images.getImage1()->isEmpty()};
 }
 
-bool checkEmoteVisibility(const QJsonObject &emoteData)
+bool checkEmoteVisibility(const ActiveEmoteFields &activeEmote)
 {
-    if (!emoteData["listed"].toBool() &&
-        !getSettings()->showUnlistedSevenTVEmotes)
+    if (!activeEmote.hasData)
     {
         return false;
     }
-    auto flags =
-        SeventvEmoteFlags(SeventvEmoteFlag(emoteData["flags"].toInt()));
+    if (!activeEmote.listed && !getSettings()->showUnlistedSevenTVEmotes)
+    {
+        return false;
+    }
+    auto flags = SeventvEmoteFlags(SeventvEmoteFlag(activeEmote.dataFlags));
     return !flags.has(SeventvEmoteFlag::ContentTwitchDisallowed);
 }
 
+/// Adds @a activeEmote to @a emotes if it's visible and has images
+void addActiveEmote(EmoteMap &emotes, const ActiveEmoteFields &activeEmote,
+                    bool isGlobal)
+{
+    if (!checkEmoteVisibility(activeEmote))
+    {
+        return;
+    }
+
+    auto result = createEmote(activeEmote, isGlobal);
+    if (!result.hasImages)
+    {
+        // this shouldn't happen but if it does, it will crash,
+        // so we don't add the emote
+        qCDebug(chatterinoSeventv)
+            << "Emote without images:" << activeEmote.id << activeEmote.name;
+        return;
+    }
+    emotes[result.name] = cachedOrMake(std::move(result.emote), result.id);
+}
+
+/// @brief Collects the emotes of an emote set while streaming a response
+///
+/// This understands emote set responses (/v3/emote-sets/:id) and user
+/// responses (/v3/users/twitch/:id), where the emote set is in `emote_set`.
+class EmoteSetVisitor
+{
+public:
+    EmoteSetVisitor(bool isUser, bool isGlobal)
+        : isUser_(isUser)
+        , isGlobal_(isGlobal)
+        , offset_(isUser ? 1 : 0)
+    {
+    }
+
+    void onValue(const JsonStreamPath &path, const JsonStreamValue &value)
+    {
+        if (this->isUser_)
+        {
+            if (path.keyAt(0) == "user")
+            {
+                this->onUserValue(path, value);
+                return;
+            }
+            if (path.keyAt(0) != "emote_set")
+            {
+                return;
+            }
+        }
+
+        auto o = this->offset_;
+        if (path.size() <= o + 2)
+        {
+            if (path.matches({"id"}, o))
+            {
+                this->info.id = value.toString();
+            }
+            else if (path.matches({"name"}, o))
+            {
+                this->info.name = value.toString();
+            }
+            return;
+        }
+        if (path.keyAt(o) != "emotes" || path.indexAt(o + 1) < 0)
+        {
+            return;
+        }
+
+        // relative to the active emote
+        o += 2;
+        auto &emote = this->current_;
+        if (path.matches({"id"}, o))
+        {
+            emote.id = value.toString();
+        }
+        else if (path.matches({"name"}, o))
+        {
+            emote.name = value.toString();
+        }
+        else if (path.matches({"flags"}, o))
+        {
+            emote.flags = value.toInt();
+        }
+        else if (path.keyAt(o) == "data")
+        {
+            emote.hasData = true;
+            this->onEmoteDataValue(path, value, o + 1);
+        }
+    }
+
+    void onEnd(const JsonStreamPath &path)
+    {
+        if (this->isUser_)
+        {
+            if (path.matches({"user", "connections", "*"}) &&
+                !this->foundTwitchConnection_)
+            {
+                this->info.twitchConnectionIndex++;
+            }
+            if (path.keyAt(0) != "emote_set")
+            {
+                return;
+            }
+        }
+
+        auto o = this->offset_;
+        if (path.matches({"emotes", "*"}, o))
+        {
+            addActiveEmote(this->emotes, this->current_, this->isGlobal_);
+            this->current_ = {};
+        }
+        else if (path.matches({"emotes", "*", "data", "host", "files", "*"},
+                              o))
+        {
+            if (this->currentFile_.isWebp)
+            {
+                this->current_.host.files.push_back(
+                    std::move(this->currentFile_));
+            }
+            this->currentFile_ = {};
+        }
+    }
+
+    EmoteMap emotes;
+    seventv::detail::EmoteSetInfo info;
+
+private:
+    void onUserValue(const JsonStreamPath &path, const JsonStreamValue &value)
+    {
+        if (path.matches({"user", "id"}))
+        {
+            this->info.userID = value.toString();
+        }
+        else if (path.matches({"user", "connections", "*", "platform"}) &&
+                 value.toStringView() == "TWITCH")
+        {
+            this->foundTwitchConnection_ = true;
+        }
+    }
+
+    /// @param o The offset of the first segment inside `data`
+    void onEmoteDataValue(const JsonStreamPath &path,
+                          const JsonStreamValue &value, size_t o)
+    {
+        auto &emote = this->current_;
+        if (path.matches({"name"}, o))
+        {
+            emote.baseName = value.toString();
+        }
+        else if (path.matches({"flags"}, o))
+        {
+            emote.dataFlags = value.toInt();
+        }
+        else if (path.matches({"listed"}, o))
+        {
+            emote.listed = value.toBool();
+        }
+        else if (path.matches({"owner", "display_name"}, o))
+        {
+            emote.author = value.toString();
+        }
+        else if (path.matches({"host", "url"}, o))
+        {
+            emote.host.url = value.toString();
+        }
+        else if (path.size() == o + 4 && path.keyAt(o) == "host" &&
+                 path.keyAt(o + 1) == "files")
+        {
+            this->onFileValue(path.keyAt(o + 3), value);
+        }
+    }
+
+    void onFileValue(std::string_view key, const JsonStreamValue &value)
+    {
+        auto &file = this->currentFile_;
+        if (key == "name")
+        {
+            file.name = value.toString();
+        }
+        else if (key == "static_name")
+        {
+            file.staticName = value.toString();
+        }
+        else if (key == "width")
+        {
+            file.width = value.toDouble();
+        }
+        else if (key == "height")
+        {
+            file.height = static_cast<int>(value.toInt(16));
+        }
+        else if (key == "format")
+        {
+            file.isWebp = value.toStringView() == "WEBP";
+        }
+    }
+
+    bool isUser_;
+    bool isGlobal_;
+    size_t offset_;
+
+    bool foundTwitchConnection_ = false;
+    ActiveEmoteFields current_;
+    ImageFile currentFile_;
+};
+
 EmotePtr createUpdatedEmote(const EmotePtr &oldEmote,
                             const EmoteUpdateDispatch &dispatch)
 {
@@ -173,28 +521,41 @@ EmoteMap seventv::detail::parseEmotes(const QJsonArray &emoteSetEmotes,
 
     for (const auto &activeEmoteJson : emoteSetEmotes)
     {
-        auto activeEmote = activeEmoteJson.toObject();
-        auto emoteData = activeEmote["data"].toObject();
+        addActiveEmote(emotes, activeEmoteFromJson(activeEmoteJson.toObject()),
+                       isGlobal);
+    }
 
-        if (emoteData.empty() || !checkEmoteVisibility(emoteData))
-        {
-            continue;
-        }
+    return emotes;
+}
 
-        auto result = createEmote(activeEmote, emoteData, isGlobal);
-        if (!result.hasImages)
-        {
-            // this shouldn't happen but if it does, it will crash,
-            // so we don't add the emote
-            qCDebug(chatterinoSeventv)
-                << "Emote without images:" << activeEmote;
-            continue;
-        }
-        auto ptr = cachedOrMake(std::move(result.emote), result.id);
-        emotes[result.name] = ptr;
+EmoteMap seventv::detail::parseEmoteSet(const QByteArray &json, bool isGlobal,
+                                        EmoteSetInfo *info)
+{
+    EmoteSetVisitor visitor(false, isGlobal);
+    if (!streamJson(json, visitor))
+    {
+        qCWarning(chatterinoSeventv) << "Failed to parse emote set";
+    }
+    if (info)
+    {
+        *info = std::move(visitor.info);
     }
+    return std::move(visitor.emotes);
+}
 
-    return emotes;
+EmoteMap seventv::detail::parseUserEmoteSet(const QByteArray &json,
+                                            EmoteSetInfo *info)
+{
+    EmoteSetVisitor visitor(true, false);
+    if (!streamJson(json, visitor))
+    {
+        qCWarning(chatterinoSeventv) << "Failed to parse user";
+    }
+    if (info)
+    {
+        *info = std::move(visitor.info);
+    }
+    return std::move(visitor.emotes);
 }
 
 SeventvEmotes::SeventvEmotes()
@@ -232,30 +593,40 @@ void SeventvEmotes::loadGlobalEmotes()
         return;
     }
 
-    readProviderEmotesCache("global", "seventv", [this](auto jsonDoc) {
-        auto emoteMap = parseEmotes(jsonDoc.object()["emotes"].toArray(), true);
-        this->setGlobalEmotes(std::make_shared<EmoteMap>(std::move(emoteMap)));
-    });
+    QByteArray etag;
+    if (auto snapshot = readEmoteSnapshot(SEVENTV_SNAPSHOT_PROVIDER,
+                                          globalEmoteSnapshotKey()))
+    {
+        this->setGlobalEmotes(
+            std::make_shared<EmoteMap>(std::move(snapshot->emotes)));
+        etag = std::move(snapshot->etag);
+    }
 
     qCDebug(chatterinoSeventv) << "Loading 7TV Global Emotes";
 
     getApp()->getSeventvAPI()->getEmoteSet(
         u"global"_s,
-        [this](const auto &json) {
-            writeProviderEmotesCache("global", "seventv",
-                                     QJsonDocument(json).toJson());
-            QJsonArray parsedEmotes = json["emotes"].toArray();
+        [this](const NetworkResult &result) {
+            if (result.status() == 304)
+            {
+                qCDebug(chatterinoSeventv) << "7TV Global Emotes didn't change";
+                return;
+            }
 
-            auto emoteMap = parseEmotes(parsedEmotes, true);
+            auto emoteMap = std::make_shared<EmoteMap>(
+                parseEmoteSet(result.getData(), true));
             qCDebug(chatterinoSeventv)
-                << "Loaded" << emoteMap.size() << "7TV Global Emotes";
-            this->setGlobalEmotes(
-                std::make_shared<EmoteMap>(std::move(emoteMap)));
+                << "Loaded" << emoteMap->size() << "7TV Global Emotes";
+            writeEmoteSnapshot(SEVENTV_SNAPSHOT_PROVIDER,
+                               globalEmoteSnapshotKey(), emoteMap,
+                               result.rawHeader("ETag"));
+            this->setGlobalEmotes(std::move(emoteMap));
         },
         [](const auto &result) {
             qCWarning(chatterinoSeventv)
                 << "Couldn't load 7TV global emotes" << result.getData();
-        });
+        ,
+        etag);
 }
 
 void SeventvEmotes::setGlobalEmotes(std::shared_ptr<const EmoteMap> emotes)
@@ -265,22 +636,27 @@ void SeventvEmotes::setGlobalEmotes(std::shared_ptr<const EmoteMap> emotes)
 
 void SeventvEmotes::loadChannelEmotes(
     const std::weak_ptr<Channel> &channel, const QString &channelId,
+    const QByteArray &etag,
     std::function<void(EmoteMap &&, ChannelInfo)> callback, bool manualRefresh,
     bool cacheHit)
 {
     qCDebug(chatterinoSeventv)
         << "Reloading 7TV Channel Emotes" << channelId << manualRefresh;
 
-    getApp()->getSeventvAPI()->getUserByTwitchID(
+    getApp()->getSeventvAPI()->getUserByTwitchIDRaw(
         channelId,
         [callback = std::move(callback), channel, channelId,
-         manualRefresh](const auto &json) {
-            writeProviderEmotesCache(channelId, "seventv",
-                                     QJsonDocument(json).toJson());
-            const auto emoteSet = json["emote_set"].toObject();
-            const auto parsedEmotes = emoteSet["emotes"].toArray();
+         manualRefresh](const NetworkResult &result) {
+            if (result.status() == 304)
+            {
+                qCDebug(chatterinoSeventv)
+                    << "7TV Channel Emotes for" << channelId
+                    << "didn't change";
+                return;
+            }
 
-            auto emoteMap = parseEmotes(parsedEmotes, false);
+            EmoteSetInfo info;
+            auto emoteMap = parseUserEmoteSet(result.getData(), &info);
             bool hasEmotes = !emoteMap.empty();
 
             qCDebug(chatterinoSeventv)
@@ -289,21 +665,14 @@ void SeventvEmotes::loadChannelEmotes(
 
             if (hasEmotes)
             {
-                auto user = json["user"].toObject();
-
-                size_t connectionIdx = 0;
-                for (const auto &conn : user["connections"].toArray())
-                {
-                    if (conn.toObject()["platform"].toString() == "TWITCH")
-                    {
-                        break;
-                    }
-                    connectionIdx++;
-                }
-
                 callback(std::move(emoteMap),
-                         {user["id"].toString(), emoteSet["id"].toString(),
-                          connectionIdx});
+                         {
+                             .userID = info.userID,
+                             .emoteSetID = info.id,
+                             .twitchConnectionIndex =
+                                 info.twitchConnectionIndex,
+                             .etag = result.rawHeader("ETag"),
+                         });
             }
 
             auto shared = channel.lock();
@@ -357,7 +726,8 @@ void SeventvEmotes::loadChannelEmotes(
                         "Using cached 7TV emotes as fallback.");
                 }
             }
-        });
+        ,
+        etag);
 }
 
 std::optional<EmotePtr> SeventvEmotes::addEmote(
@@ -365,15 +735,15 @@ std::optional<EmotePtr> SeventvEmotes::addEmote(
     const EmoteAddDispatch &dispatch)
 {
     // Check for visibility first, so we don't copy the map.
-    auto emoteData = dispatch.emoteJson["data"].toObject();
-    if (emoteData.empty() || !checkEmoteVisibility(emoteData))
+    auto activeEmote = activeEmoteFromJson(dispatch.emoteJson);
+    if (!checkEmoteVisibility(activeEmote))
     {
         return std::nullopt;
     }
 
     // This copies the map.
     EmoteMap updatedMap = *map.get();
-    auto result = createEmote(dispatch.emoteJson, emoteData, false);
+    auto result = createEmote(activeEmote, false);
     if (!result.hasImages)
     {
         // Incoming emote didn't contain any images, abort
@@ -439,15 +809,15 @@ void SeventvEmotes::getEmoteSet(
 
     getApp()->getSeventvAPI()->getEmoteSet(
         emoteSetId,
-        [callback = std::move(successCallback), emoteSetId](const auto &json) {
-            auto parsedEmotes = json["emotes"].toArray();
-
-            auto emoteMap = parseEmotes(parsedEmotes, false);
+        [callback = std::move(successCallback),
+         emoteSetId](const NetworkResult &result) {
+            EmoteSetInfo info;
+            auto emoteMap = parseEmoteSet(result.getData(), false, &info);
 
             qCDebug(chatterinoSeventv) << "Loaded" << emoteMap.size()
                                        << "7TV Emotes from" << emoteSetId;
 
-            callback(std::move(emoteMap), json["name"].toString());
+            callback(std::move(emoteMap), info.name);
         },
         [emoteSetId, callback = std::move(errorCallback)](const auto &result) {
             callback(result.formatError());
@@ -457,89 +827,7 @@ void SeventvEmotes::getEmoteSet(
 ImageSet SeventvEmotes::createImageSet(const QJsonObject &emoteData,
                                        bool useStatic)
 {
-    auto host = emoteData["host"].toObject();
-    // "//cdn.7tv[...]"
-    auto baseUrl = host["url"].toString();
-    auto files = host["files"].toArray();
-
-    std::array<ImagePtr, 4> sizes;
-    double baseWidth = 0.0;
-    size_t nextSize = 0;
-
-    for (auto fileItem : files)
-    {
-        if (nextSize >= sizes.size())
-        {
-            break;
-        }
-
-        auto file = fileItem.toObject();
-        if (file["format"].toString() != "WEBP")
-        {
-            continue;  // We only use webp
-        }
-
-        double width = file["width"].toDouble();
-        double scale = 1.0;  // in relation to first image
-        if (baseWidth > 0.0)
-        {
-            scale = baseWidth / width;
-        }
-        else
-        {
-            // => this is the first image
-            baseWidth = width;
-        }
-
-        auto name = [&] {
-            if (useStatic)
-            {
-                auto staticName = file["static_name"].toString();
-                if (!staticName.isEmpty())
-                {
-                    return staticName;
-                }
-            }
-            return file["name"].toString();
-        }();
-
-        auto image =
-            Image::fromUrl({QString("https:%1/%2").arg(baseUrl, name)}, scale,
-                           {static_cast<int>(width), file["height"].toInt(16)});
-
-        sizes.at(nextSize) = image;
-        nextSize++;
-    }
-
-    if (nextSize < sizes.size())
-    {
-        // this should be really rare
-        // this means we didn't get all sizes of an emote
-        if (nextSize == 0)
-        {
-            qCDebug(chatterinoSeventv)
-                << "Got file list without any eligible files";
-            // When this emote is typed, chatterino will crash.
-            return ImageSet{};
-        }
-        for (; nextSize < sizes.size(); nextSize++)
-        {
-            sizes.at(nextSize) = Image::getEmpty();
-        }
-    }
-
-    // Typically, 7TV provides four versions (1x, 2x, 3x, and 4x). The 3x
-    // version has a scale factor of 1/3, which is a size other providers don't
-    // provide - they only provide the 4x version (0.25). To be in line with
-    // other providers, we prefer the 4x version but fall back to the 3x one if
-    // it doesn't exist.
-    auto largest = std::move(sizes[3]);
-    if (!largest || largest->isEmpty())
-    {
-        largest = std::move(sizes[2]);
-    }
-
-    return ImageSet{sizes[0], sizes[1], largest};
+    return makeImageSet(imageHostFromJson(emoteData), useStatic);
 }
 
 }  // namespace chatterino
@@ -5,6 +5,7 @@
 #include "common/FlagsEnum.hpp"
 
 #include <pajlada/signals/scoped-connection.hpp>
+#include <QByteArray>
 #include <QJsonArray>
 #include <QJsonObject>
 #include <QString>
@@ -88,6 +89,26 @@ namespace seventv::detail {
 
     EmoteMap parseEmotes(const QJsonArray &emoteSetEmotes, bool isGlobal);
 
+    /// Information about an emote set collected while parsing it
+    struct EmoteSetInfo {
+        QString id;
+        QString name;
+        /// Only set for user responses
+        QString userID;
+        /// Only set for user responses
+        size_t twitchConnectionIndex = 0;
+    };
+
+    /// Parses an emote set response (/v3/emote-sets/:id) without building
+    /// a DOM.
+    EmoteMap parseEmoteSet(const QByteArray &json, bool isGlobal,
+                           EmoteSetInfo *info = nullptr);
+
+    /// Parses the emote set of a user response (/v3/users/twitch/:id)
+    /// without building a DOM.
+    EmoteMap parseUserEmoteSet(const QByteArray &json,
+                               EmoteSetInfo *info = nullptr);
+
 }  // namespace seventv::detail
 
 class SeventvEmotes final
@@ -97,6 +118,8 @@ public:
         QString userID;
         QString emoteSetID;
         size_t twitchConnectionIndex;
+        /// ETag of the response the emotes were loaded from
+        QByteArray etag;
     };
 
     SeventvEmotes();
@@ -105,8 +128,11 @@ public:
     std::optional<EmotePtr> globalEmote(const EmoteName &name) const;
     void loadGlobalEmotes();
     void setGlobalEmotes(std::shared_ptr<const EmoteMap> emotes);
+    /// Loads the emotes of a channel. If @a etag is set and the emotes didn't
+    /// change, @a callback isn't called.
     static void loadChannelEmotes(
         const std::weak_ptr<Channel> &channel, const QString &channelId,
+        const QByteArray &etag,
         std::function<void(EmoteMap &&, ChannelInfo)> callback,
         bool manualRefresh, bool cacheHit);
 
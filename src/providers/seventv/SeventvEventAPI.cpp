@@ -20,8 +20,9 @@ using namespace seventv::eventapi;
 using namespace chatterino::literals;
 
 SeventvEventAPI::SeventvEventAPI(
-    QString host, std::chrono::milliseconds defaultHeartbeatInterval)
-    : BasicPubSubManager(std::move(host), u"7TV"_s)
+    QString host, std::chrono::milliseconds defaultHeartbeatInterval,
+    WebSocketPool *pool)
+    : BasicPubSubManager(std::move(host), u"7TV"_s, pool)
     , heartbeatInterval_(defaultHeartbeatInterval)
 {
 }
@@ -104,20 +105,17 @@ void SeventvEventAPI::unsubscribeTwitchChannel(const QString &id)
 }
 
 std::shared_ptr<BasicPubSubClient<Subscription>> SeventvEventAPI::createClient(
-    liveupdates::WebsocketClient &client, websocketpp::connection_hdl hdl)
+    WebSocketPool &pool, WebSocketHandle handle)
 {
-    auto shared =
-        std::make_shared<Client>(client, hdl, this->heartbeatInterval_);
+    auto shared = std::make_shared<Client>(pool, std::move(handle),
+                                           this->heartbeatInterval_);
     return std::static_pointer_cast<BasicPubSubClient<Subscription>>(
         std::move(shared));
 }
 
-void SeventvEventAPI::onMessage(
-    websocketpp::connection_hdl hdl,
-    BasicPubSubManager<Subscription>::WebsocketMessagePtr msg)
+void SeventvEventAPI::onMessage(BasicPubSubClient<Subscription> &client,
+                                const QByteArray &payload)
 {
-    const auto &payload = QString::fromStdString(msg->get_payload());
-
     auto pMessage = parseBaseMessage(payload);
 
     if (!pMessage)
@@ -126,27 +124,22 @@ void SeventvEventAPI::onMessage(
             << "Unable to parse incoming event-api message: " << payload;
         return;
     }
+    auto *stvClient = dynamic_cast<Client *>(&client);
     auto message = *pMessage;
     switch (message.op)
     {
         case Opcode::Hello: {
-            if (auto client = this->findClient(hdl))
+            if (stvClient)
             {
-                if (auto *stvClient = dynamic_cast<Client *>(client.get()))
-                {
-                    stvClient->setHeartbeatInterval(
-                        message.data["heartbeat_interval"].toInt());
-                }
+                stvClient->setHeartbeatInterval(
+                    message.data["heartbeat_interval"].toInt());
             }
         }
         break;
         case Opcode::Heartbeat: {
-            if (auto client = this->findClient(hdl))
+            if (stvClient)
             {
-                if (auto *stvClient = dynamic_cast<Client *>(client.get()))
-                {
-                    stvClient->handleHeartbeat();
-                }
+                stvClient->handleHeartbeat();
             }
         }
         break;
@@ -162,12 +155,9 @@ void SeventvEventAPI::onMessage(
         }
         break;
         case Opcode::Reconnect: {
-            if (auto client = this->findClient(hdl))
+            if (stvClient)
             {
-                if (auto *stvClient = dynamic_cast<Client *>(client.get()))
-                {
-                    stvClient->close("Reconnecting");
-                }
+                stvClient->close(u"Reconnecting"_s);
             }
         }
         break;
@@ -29,9 +29,11 @@ class SeventvEventAPI
         pajlada::Signals::Signal<T>;  // type-id is vector<T, Alloc<T>>
 
 public:
+    /// @param pool The pool to open connections in (see BasicPubSubManager)
     SeventvEventAPI(QString host,
                     std::chrono::milliseconds defaultHeartbeatInterval =
-                        std::chrono::milliseconds(25000));
+                        std::chrono::milliseconds(25000),
+                    WebSocketPool *pool = nullptr);
 
     ~SeventvEventAPI() override;
 
@@ -67,12 +69,10 @@ public:
 
 protected:
     std::shared_ptr<BasicPubSubClient<seventv::eventapi::Subscription>>
-        createClient(liveupdates::WebsocketClient &client,
-                     websocketpp::connection_hdl hdl) override;
+        createClient(WebSocketPool &pool, WebSocketHandle handle) override;
     void onMessage(
-        websocketpp::connection_hdl hdl,
-        BasicPubSubManager<seventv::eventapi::Subscription>::WebsocketMessagePtr
-            msg) override;
+        BasicPubSubClient<seventv::eventapi::Subscription> &client,
+        const QByteArray &payload) override;
 
 private:
     void handleDispatch(const seventv::eventapi::Dispatch &dispatch);
@@ -1,28 +1,19 @@
 #include "providers/seventv/eventapi/Client.hpp"
 
 #include "providers/seventv/eventapi/Subscription.hpp"
-#include "providers/twitch/PubSubHelpers.hpp"
 
 #include <utility>
 
 namespace chatterino::seventv::eventapi {
 
-Client::Client(liveupdates::WebsocketClient &websocketClient,
-               liveupdates::WebsocketHandle handle,
+Client::Client(WebSocketPool &pool, WebSocketHandle handle,
                std::chrono::milliseconds heartbeatInterval)
-    : BasicPubSubClient<Subscription>(websocketClient, std::move(handle))
+    : BasicPubSubClient<Subscription>(pool, std::move(handle))
     , lastHeartbeat_(std::chrono::steady_clock::now())
     , heartbeatInterval_(heartbeatInterval)
-    , heartbeatTimer_(std::make_shared<boost::asio::steady_timer>(
-          this->websocketClient_.get_io_service()))
 {
 }
 
-void Client::stopImpl()
-{
-    this->heartbeatTimer_->cancel();
-}
-
 void Client::onConnectionEstablished()
 {
     this->lastHeartbeat_.store(std::chrono::steady_clock::now(),
@@ -49,20 +40,23 @@ void Client::checkHeartbeat()
     // after three missed heartbeats.
     // https://github.com/SevenTV/EventAPI/tree/ca4ff15cc42b89560fa661a76c5849047763d334#heartbeat
     assert(this->isStarted());
+    auto interval = this->heartbeatInterval_.load();
     if ((std::chrono::steady_clock::now() - this->lastHeartbeat_.load()) >
-        3 * this->heartbeatInterval_)
+        3 * interval)
     {
         qCDebug(chatterinoSeventvEventAPI)
             << "Didn't receive a heartbeat in time, disconnecting!";
-        this->close("Didn't receive a heartbeat in time");
+        this->close(QStringLiteral("Didn't receive a heartbeat in time"));
 
         return;
     }
 
-    auto self = std::dynamic_pointer_cast<Client>(this->shared_from_this());
+    std::weak_ptr weak =
+        std::dynamic_pointer_cast<Client>(this->shared_from_this());
 
-    runAfter(this->heartbeatTimer_, this->heartbeatInterval_, [self](auto) {
-        if (!self->isStarted())
+    this->pool_.runAfter(interval, [weak] {
+        auto self = weak.lock();
+        if (!self || !self->isStarted())
         {
             return;
         }
@@ -5,6 +5,9 @@
 // of std::hash for Subscription
 #include "providers/seventv/eventapi/Subscription.hpp"
 
+#include <atomic>
+#include <chrono>
+
 namespace chatterino {
 class SeventvEventAPI;
 
@@ -15,12 +18,9 @@ namespace chatterino::seventv::eventapi {
 class Client : public BasicPubSubClient<Subscription>
 {
 public:
-    Client(liveupdates::WebsocketClient &websocketClient,
-           liveupdates::WebsocketHandle handle,
+    Client(WebSocketPool &pool, WebSocketHandle handle,
            std::chrono::milliseconds heartbeatInterval);
 
-    void stopImpl() override;
-
     void setHeartbeatInterval(int intervalMs);
     void handleHeartbeat();
 
@@ -33,8 +33,7 @@ private:
     std::atomic<std::chrono::time_point<std::chrono::steady_clock>>
         lastHeartbeat_;
     // This will be set once on the welcome message.
-    std::chrono::milliseconds heartbeatInterval_;
-    std::shared_ptr<boost::asio::steady_timer> heartbeatTimer_;
+    std::atomic<std::chrono::milliseconds> heartbeatInterval_;
 
     friend SeventvEventAPI;
 };
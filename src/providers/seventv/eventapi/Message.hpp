@@ -3,6 +3,7 @@
 #include "providers/seventv/eventapi/Subscription.hpp"
 
 #include <magic_enum/magic_enum.hpp>
+#include <QByteArray>
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QString>
@@ -28,6 +29,6 @@ std::optional<InnerClass> Message::toInner()
     return InnerClass{this->data};
 }
 
-std::optional<Message> parseBaseMessage(const QString &blob);
+std::optional<Message> parseBaseMessage(const QByteArray &blob);
 
 }  // namespace chatterino::seventv::eventapi
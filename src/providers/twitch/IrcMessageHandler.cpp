@@ -7,11 +7,15 @@
 #include "common/QLogging.hpp"
 #include "controllers/accounts/AccountController.hpp"
 #include "controllers/ignores/IgnoreController.hpp"
+#include "controllers/plugins/PluginController.hpp"
+#include "controllers/userdata/UserDataController.hpp"
+#include "debug/Trace.hpp"
 #include "messages/Link.hpp"
 #include "messages/Message.hpp"
 #include "messages/MessageBuilder.hpp"
 #include "messages/MessageColor.hpp"
 #include "messages/MessageElement.hpp"
+#include "messages/MessageRouting.hpp"
 #include "messages/MessageSink.hpp"
 #include "messages/MessageThread.hpp"
 #include "providers/twitch/TwitchAccount.hpp"
@@ -292,6 +296,8 @@ void IrcMessageHandler::parseMessageInto(Communi::IrcMessage *message,
                                          MessageSink &sink,
                                          TwitchChannel *channel)
 {
+    CHATTERINO_TRACE("irc", "parseMessageInto");
+
     auto command = message->command();
 
     if (command == u"PRIVMSG"_s)
@@ -334,6 +340,8 @@ void IrcMessageHandler::parseMessageInto(Communi::IrcMessage *message,
 void IrcMessageHandler::handlePrivMessage(Communi::IrcPrivateMessage *message,
                                           ITwitchIrcServer &twitchServer)
 {
+    CHATTERINO_TRACE("irc", "handlePrivMessage");
+
     auto chan = channelOrEmptyByTarget(message->target(), twitchServer);
     if (chan->isEmpty())
     {
@@ -589,11 +597,17 @@ void IrcMessageHandler::handleWhisperMessage(Communi::IrcMessage *ircMessage)
     }
 
     message->flags.set(MessageFlag::Whisper);
-    MessageBuilder::triggerHighlights(c, alert);
+    const auto routes = routeMessage(
+        *message, MessageSinkTrait::AddMentionsToGlobalChannel);
+
+    if (routes.has(MessageRoute::Alert))
+    {
+        MessageBuilder::triggerHighlights(c, alert);
+    }
 
     getApp()->getTwitch()->setLastUserThatWhisperedMe(message->loginName);
 
-    if (message->flags.has(MessageFlag::ShowInMentions))
+    if (routes.has(MessageRoute::Mentions))
     {
         getApp()->getTwitch()->getMentionsChannel()->addMessage(
             message, MessageContext::Original);
@@ -1106,18 +1120,14 @@ void IrcMessageHandler::addMessage(Communi::IrcMessage *message,
 
         sink.applySimilarityFilters(msg);
 
-        if (!msg->flags.has(MessageFlag::Similar) ||
-            (!getSettings()->hideSimilar &&
-             getSettings()->shownSimilarTriggerHighlights))
+        const auto routes = routeMessage(*msg, sink.sinkTraits());
+
+        if (routes.has(MessageRoute::Alert))
         {
             MessageBuilder::triggerHighlights(chan, alert);
         }
 
-        const auto highlighted = msg->flags.has(MessageFlag::Highlighted);
-        const auto showInMentions = msg->flags.has(MessageFlag::ShowInMentions);
-
-        if (highlighted && showInMentions &&
-            sink.sinkTraits().has(MessageSinkTrait::AddMentionsToGlobalChannel))
+        if (routes.has(MessageRoute::Mentions))
         {
             twitch.getMentionsChannel()->addMessage(msg,
                                                     MessageContext::Original);
@@ -1125,6 +1135,34 @@ void IrcMessageHandler::addMessage(Communi::IrcMessage *message,
 
         sink.addMessage(msg, MessageContext::Original);
         chan->addRecentChatter(msg->displayName);
+
+        // Remember the user across channels and restarts
+        std::optional<QColor> color;
+        if (auto tagColor = tags.value("color").toString();
+            !tagColor.isEmpty())
+        {
+            color = QColor(tagColor);
+        }
+        getApp()->getUserData()->updateMetadata({
+            .id = msg->userID,
+            .login = msg->loginName,
+            .displayName =
+                parseTagString(tags.value("display-name").toString()).trimmed(),
+            .color = color,
+        });
+
+#ifdef CHATTERINO_HAVE_PLUGINS
+        // Only live messages are passed to plugins, not ones loaded from the
+        // recent-messages API.
+        if (&sink == static_cast<MessageSink *>(chan))
+        {
+            auto *plugins = getApp()->getPlugins();
+            if (plugins != nullptr)
+            {
+                plugins->onMessageReceived(chan->shared_from_this(), msg);
+            }
+        }
+#endif
     }
 }
 
@@ -0,0 +1,169 @@
+#include "providers/twitch/MessageSendQueue.hpp"
+
+#include <algorithm>
+#include <array>
+#include <utility>
+
+namespace {
+
+/// Commands that act on other users or the chat instead of posting in it
+constexpr std::array MODERATION_COMMANDS{
+    u"ban",         u"unban",          u"timeout",     u"untimeout",
+    u"delete",      u"clear",          u"slow",        u"slowoff",
+    u"followers",   u"followersoff",   u"subscribers", u"subscribersoff",
+    u"emoteonly",   u"emoteonlyoff",   u"uniquechat",  u"uniquechatoff",
+    u"r9kbeta",     u"r9kbetaoff",     u"warn",
+};
+
+}  // namespace
+
+namespace chatterino {
+
+MessageSendQueue::Clock::time_point MessageSendQueue::Window::nextSend(
+    Clock::time_point now)
+{
+    while (!this->sent.empty() && this->sent.front() + WINDOW <= now)
+    {
+        this->sent.pop_front();
+    }
+
+    auto next = now;
+    if (!this->sent.empty())
+    {
+        next = std::max(next, this->sent.back() + this->minOffset);
+    }
+    if (this->sent.size() >= this->maxMessages)
+    {
+        next = std::max(next, this->sent.front() + WINDOW);
+    }
+    return next;
+}
+
+bool MessageSendQueue::isModerationCommand(QStringView message)
+{
+    if (!message.startsWith(u'/') && !message.startsWith(u'.'))
+    {
+        return false;
+    }
+
+    auto command = message.mid(1);
+    auto space = command.indexOf(u' ');
+    if (space >= 0)
+    {
+        command = command.left(space);
+    }
+
+    return std::ranges::any_of(MODERATION_COMMANDS, [&](const char16_t *name) {
+        return command.compare(QStringView(name), Qt::CaseInsensitive) == 0;
+    });
+}
+
+bool MessageSendQueue::enqueue(Message message)
+{
+    auto it = this->queue_.end();
+    if (!message.mergeKey.isEmpty())
+    {
+        it = std::find_if(this->queue_.begin(), this->queue_.end(),
+                          [&](const auto &queued) {
+                              return queued.channel == message.channel &&
+                                     queued.mergeKey == message.mergeKey;
+                          });
+    }
+    if (it != this->queue_.end())
+    {
+        it->priority = std::max(it->priority, message.priority);
+        return false;
+    }
+
+    auto channel = message.channel;
+    this->queue_.emplace_back(std::move(message));
+    this->queueChanged.invoke(channel);
+    return true;
+}
+
+std::optional<MessageSendQueue::Clock::time_point> MessageSendQueue::process(
+    Clock::time_point now)
+{
+    std::optional<Clock::time_point> next;
+    bool sentAny = true;
+    while (sentAny)
+    {
+        sentAny = false;
+        next.reset();
+
+        for (bool highRateLimit : {false, true})
+        {
+            auto it = this->nextFor(highRateLimit);
+            if (it == this->queue_.end())
+            {
+                continue;
+            }
+
+            auto &window = highRateLimit ? this->high_ : this->normal_;
+            auto sendAt = window.nextSend(now);
+            if (sendAt > now)
+            {
+                next = next ? std::min(*next, sendAt) : sendAt;
+                continue;
+            }
+
+            // Remove the message before sending it in case sending queues
+            // another message
+            auto message = std::move(*it);
+            this->queue_.erase(it);
+            window.sent.push_back(now);
+
+            message.send();
+            this->queueChanged.invoke(message.channel);
+            sentAny = true;
+        }
+    }
+
+    return next;
+}
+
+void MessageSendQueue::clear()
+{
+    auto queue = std::exchange(this->queue_, {});
+    this->normal_.sent.clear();
+    this->high_.sent.clear();
+
+    for (const auto &message : queue)
+    {
+        this->queueChanged.invoke(message.channel);
+    }
+}
+
+size_t MessageSendQueue::size() const
+{
+    return this->queue_.size();
+}
+
+size_t MessageSendQueue::queuedFor(const QString &channel) const
+{
+    return static_cast<size_t>(
+        std::count_if(this->queue_.begin(), this->queue_.end(),
+                      [&](const auto &message) {
+                          return message.channel == channel;
+                      }));
+}
+
+std::deque<MessageSendQueue::Message>::iterator MessageSendQueue::nextFor(
+    bool highRateLimit)
+{
+    auto best = this->queue_.end();
+    for (auto it = this->queue_.begin(); it != this->queue_.end(); it++)
+    {
+        if (it->highRateLimit != highRateLimit)
+        {
+            continue;
+        }
+        if (best == this->queue_.end() || it->priority > best->priority)
+        {
+            best = it;
+        }
+    }
+    return best;
+}
+
+}  // namespace chatterino
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <pajlada/signals/signal.hpp>
+#include <QString>
+#include <QStringView>
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <optional>
+
+namespace chatterino {
+
+/// @brief Sends chat messages of an account as fast as Twitch allows
+///
+/// Twitch allows 20 messages per 30 seconds in channels where the user is a
+/// regular chatter and 100 messages per 30 seconds in channels where they're
+/// a moderator, VIP, or the broadcaster. Both windows are shared between all
+/// channels. Instead of dropping messages that would exceed a limit, they're
+/// queued and sent as soon as their window allows it.
+///
+/// - Messages with a higher priority are sent first. Messages with the same
+///   priority are sent in the order they were queued.
+/// - Queueing a message with the same merge key as a queued message doesn't
+///   add it again.
+///
+/// The queue doesn't own a timer. #process() sends everything that's allowed
+/// at the given time and returns when the next message can be sent, so the
+/// queue can be driven by a fake clock in tests.
+///
+/// This class isn't thread-safe.
+class MessageSendQueue
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class Priority : std::uint8_t {
+        Chat,
+        Moderation,
+    };
+
+    struct Message {
+        /// Name of the channel this message is sent to
+        QString channel;
+        /// Queued messages with the same key are merged. Messages with an
+        /// empty key are never merged.
+        QString mergeKey;
+        Priority priority = Priority::Chat;
+        /// Whether the user has elevated rate limits in the channel
+        bool highRateLimit = false;
+        /// Actually sends the message
+        std::function<void()> send;
+    };
+
+    static constexpr size_t NORMAL_MAX_MESSAGES = 19;
+    static constexpr size_t HIGH_MAX_MESSAGES = 99;
+    static constexpr std::chrono::milliseconds NORMAL_MIN_OFFSET{1100};
+    static constexpr std::chrono::milliseconds HIGH_MIN_OFFSET{100};
+    /// Slightly longer than Twitch's 30 seconds to account for latency
+    static constexpr std::chrono::seconds WINDOW{32};
+
+    /// Queues @a message. Returns false if it was merged with a queued
+    /// message. The priority of the queued message is raised if needed.
+    ///
+    /// The message isn't sent until the next call to #process().
+    bool enqueue(Message message);
+
+    /// Sends all messages that are allowed at @a now
+    ///
+    /// @returns The time the next queued message can be sent or std::nullopt
+    ///          if the queue is empty.
+    std::optional<Clock::time_point> process(Clock::time_point now);
+
+    /// Whether @a message is a moderation command (e.g. `/ban` or `.timeout`)
+    /// that should be sent with Priority::Moderation
+    static bool isModerationCommand(QStringView message);
+
+    /// Removes all queued messages and forgets about sent messages
+    void clear();
+
+    /// Number of queued messages
+    size_t size() const;
+    /// Number of queued messages for @a channel
+    size_t queuedFor(const QString &channel) const;
+
+    /// Invoked with the name of a channel whenever the number of messages
+    /// queued for it changed
+    pajlada::Signals::Signal<QString> queueChanged;
+
+private:
+    struct Window {
+        size_t maxMessages;
+        Clock::duration minOffset;
+        std::deque<Clock::time_point> sent;
+
+        /// Prunes old messages and returns the earliest time a message can
+        /// be sent (which might be before @a now)
+        Clock::time_point nextSend(Clock::time_point now);
+    };
+
+    /// Returns the message to send next in the window selected by
+    /// @a highRateLimit or end() if there's none
+    std::deque<Message>::iterator nextFor(bool highRateLimit);
+
+    Window normal_{NORMAL_MAX_MESSAGES, NORMAL_MIN_OFFSET, {}};
+    Window high_{HIGH_MAX_MESSAGES, HIGH_MIN_OFFSET, {}};
+
+    /// In the order the messages were queued
+    std::deque<Message> queue_;
+};
+
+}  // namespace chatterino
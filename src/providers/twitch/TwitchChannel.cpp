@@ -17,6 +17,7 @@
 #include "messages/MessageBuilder.hpp"
 #include "messages/MessageElement.hpp"
 #include "messages/MessageThread.hpp"
+#include "providers/EmoteSnapshot.hpp"
 #include "providers/bttv/BttvEmotes.hpp"
 #include "providers/bttv/BttvLiveUpdates.hpp"
 #include "providers/bttv/liveupdates/BttvLiveUpdateMessages.hpp"
@@ -108,11 +109,21 @@ TwitchChannel::TwitchChannel(const QString &name)
 {
     qCDebug(chatterinoTwitch) << "[TwitchChannel" << name << "] Opened";
 
+    this->createdTimer_.start();
+    if (!getApp()->isTest())
+    {
+        this->active_ = !getSettings()->lazyChannelActivation;
+        this->loadEmoteSnapshots();
+    }
+
     this->bSignals_.emplace_back(
         getApp()->getAccounts()->twitch.currentUserChanged.connect([this] {
             this->setMod(false);
-            this->refreshPubSub();
-            this->refreshTwitchChannelEmotes(false);
+            if (this->active_)
+            {
+                this->refreshPubSub();
+                this->refreshTwitchChannelEmotes(false);
+            }
         }));
 
     this->refreshPubSub();
@@ -127,7 +138,10 @@ TwitchChannel::TwitchChannel(const QString &name)
     std::ignore = this->joined.connect([this]() {
         if (this->disconnected_)
         {
-            this->loadRecentMessagesReconnect();
+            if (this->active_)
+            {
+                this->loadRecentMessagesReconnect();
+            }
             this->lastConnectedAt_ = std::chrono::system_clock::now();
             this->disconnected_ = false;
         }
@@ -213,6 +227,30 @@ void TwitchChannel::initialize()
     this->refreshBadges();
 }
 
+void TwitchChannel::activate()
+{
+    if (this->active_)
+    {
+        return;
+    }
+    this->active_ = true;
+
+    qCDebug(chatterinoTwitch)
+        << "[TwitchChannel" << this->getName() << "] Activated after"
+        << this->createdTimer_.elapsed() << "ms";
+
+    // Without a room ID, everything is loaded in roomIdChanged
+    if (!this->roomId().isEmpty())
+    {
+        this->loadActiveData();
+    }
+}
+
+bool TwitchChannel::isActive() const
+{
+    return this->active_;
+}
+
 bool TwitchChannel::isEmpty() const
 {
     return this->getName().isEmpty();
@@ -319,31 +357,69 @@ void TwitchChannel::refreshTwitchChannelEmotes(bool manualRefresh)
         });
 }
 
+void TwitchChannel::loadEmoteSnapshots()
+{
+    auto key = channelEmoteSnapshotKey(this->getName());
+    auto load = [&](const QString &provider, EmoteSnapshotInfo &info,
+                    auto setEmotes) {
+        auto snapshot = readEmoteSnapshot(provider, key);
+        if (!snapshot)
+        {
+            return;
+        }
+        info = {
+            .etag = std::move(snapshot->etag),
+            .extra = std::move(snapshot->extra),
+        };
+        setEmotes(
+            std::make_shared<const EmoteMap>(std::move(snapshot->emotes)));
+    };
+
+    if (Settings::instance().enableBTTVChannelEmotes)
+    {
+        load(BTTV_SNAPSHOT_PROVIDER, this->bttvSnapshot_, [this](auto map) {
+            this->setBttvEmotes(std::move(map));
+        });
+    }
+    if (Settings::instance().enableFFZChannelEmotes)
+    {
+        load(FFZ_SNAPSHOT_PROVIDER, this->ffzSnapshot_, [this](auto map) {
+            this->setFfzEmotes(std::move(map));
+        });
+    }
+    if (Settings::instance().enableSevenTVChannelEmotes)
+    {
+        load(SEVENTV_SNAPSHOT_PROVIDER, this->seventvSnapshot_,
+             [this](auto map) {
+                 this->setSeventvEmotes(std::move(map));
+             });
+    }
+}
+
 void TwitchChannel::refreshBTTVChannelEmotes(bool manualRefresh)
 {
     if (!Settings::instance().enableBTTVChannelEmotes)
     {
         this->bttvEmotes_.set(EMPTY_EMOTE_MAP);
+        this->channelEmotesChanged.invoke();
         return;
     }
 
-    bool cacheHit = readProviderEmotesCache(
-        this->roomId(), "betterttv",
-        [this, weak = weakOf<Channel>(this)](auto jsonDoc) {
-            if (auto shared = weak.lock())
-            {
-                auto emoteMap = bttv::detail::parseChannelEmotes(
-                    jsonDoc.object(), this->getLocalizedName());
-                this->setBttvEmotes(std::make_shared<const EmoteMap>(emoteMap));
-            }
-        });
-
+    bool cacheHit = this->bttvSnapshot_.belongsTo(this->roomId());
     BttvEmotes::loadChannel(
         weakOf<Channel>(this), this->roomId(), this->getLocalizedName(),
-        [this, weak = weakOf<Channel>(this)](auto &&emoteMap) {
+        cacheHit && !manualRefresh ? this->bttvSnapshot_.etag : QByteArray(),
+        [this, weak = weakOf<Channel>(this),
+         roomID = this->roomId()](auto &&emoteMap, QByteArray etag) {
             if (auto shared = weak.lock())
             {
-                this->setBttvEmotes(std::make_shared<const EmoteMap>(emoteMap));
+                auto map = std::make_shared<const EmoteMap>(
+                    std::forward<decltype(emoteMap)>(emoteMap));
+                this->bttvSnapshot_ = {.etag = etag, .extra = {roomID}};
+                writeEmoteSnapshot(BTTV_SNAPSHOT_PROVIDER,
+                                   channelEmoteSnapshotKey(this->getName()),
+                                   map, etag, {roomID});
+                this->setBttvEmotes(std::move(map));
             }
         },
         manualRefresh, cacheHit);
@@ -354,21 +430,26 @@ void TwitchChannel::refreshFFZChannelEmotes(bool manualRefresh)
     if (!Settings::instance().enableFFZChannelEmotes)
     {
         this->ffzEmotes_.set(EMPTY_EMOTE_MAP);
+        this->channelEmotesChanged.invoke();
         return;
     }
 
-    bool cacheHit = readProviderEmotesCache(
-        this->roomId(), "frankerfacez", [this](const auto &jsonDoc) {
-            auto emoteMap = ffz::detail::parseChannelEmotes(jsonDoc.object());
-            this->setFfzEmotes(std::make_shared<const EmoteMap>(emoteMap));
-        });
-
+    // The room response also contains the badges of the channel, so it's
+    // always requested in full
+    bool cacheHit = this->ffzSnapshot_.belongsTo(this->roomId());
     FfzEmotes::loadChannel(
         weakOf<Channel>(this), this->roomId(),
-        [this, weak = weakOf<Channel>(this)](auto &&emoteMap) {
+        [this, weak = weakOf<Channel>(this),
+         roomID = this->roomId()](auto &&emoteMap) {
             if (auto shared = weak.lock())
             {
-                this->setFfzEmotes(std::make_shared<const EmoteMap>(emoteMap));
+                auto map = std::make_shared<const EmoteMap>(
+                    std::forward<decltype(emoteMap)>(emoteMap));
+                this->ffzSnapshot_ = {.etag = {}, .extra = {roomID}};
+                writeEmoteSnapshot(FFZ_SNAPSHOT_PROVIDER,
+                                   channelEmoteSnapshotKey(this->getName()),
+                                   map, {}, {roomID});
+                this->setFfzEmotes(std::move(map));
             }
         },
         [this, weak = weakOf<Channel>(this)](auto &&modBadge) {
@@ -401,26 +482,45 @@ void TwitchChannel::refreshSevenTVChannelEmotes(bool manualRefresh)
     if (!Settings::instance().enableSevenTVChannelEmotes)
     {
         this->seventvEmotes_.set(EMPTY_EMOTE_MAP);
+        this->channelEmotesChanged.invoke();
         return;
     }
 
-    bool cacheHit = readProviderEmotesCache(
-        this->roomId(), "seventv", [this](auto jsonDoc) {
-            const auto json = jsonDoc.object();
-            const auto emoteSet = json["emote_set"].toObject();
-            const auto parsedEmotes = emoteSet["emotes"].toArray();
-            auto emoteMap = seventv::detail::parseEmotes(parsedEmotes, false);
-            this->setSeventvEmotes(std::make_shared<const EmoteMap>(emoteMap));
-        });
+    // extra: [roomID, userID, emoteSetID, twitchConnectionIndex]
+    bool cacheHit = this->seventvSnapshot_.belongsTo(this->roomId()) &&
+                    this->seventvSnapshot_.extra.size() == 4;
+    if (cacheHit)
+    {
+        const auto &extra = this->seventvSnapshot_.extra;
+        this->updateSeventvData(extra[1], extra[2]);
+        this->seventvUserTwitchConnectionIndex_ = extra[3].toULongLong();
+    }
 
     SeventvEmotes::loadChannelEmotes(
         weakOf<Channel>(this), this->roomId(),
-        [this, weak = weakOf<Channel>(this)](auto &&emoteMap,
-                                             auto channelInfo) {
+        cacheHit && !manualRefresh ? this->seventvSnapshot_.etag
+                                   : QByteArray(),
+        [this, weak = weakOf<Channel>(this),
+         roomID = this->roomId()](auto &&emoteMap, auto channelInfo) {
             if (auto shared = weak.lock())
             {
-                this->setSeventvEmotes(
-                    std::make_shared<const EmoteMap>(emoteMap));
+                auto map = std::make_shared<const EmoteMap>(
+                    std::forward<decltype(emoteMap)>(emoteMap));
+                this->seventvSnapshot_ = {
+                    .etag = channelInfo.etag,
+                    .extra =
+                        {
+                            roomID,
+                            channelInfo.userID,
+                            channelInfo.emoteSetID,
+                            QString::number(channelInfo.twitchConnectionIndex),
+                        },
+                };
+                writeEmoteSnapshot(SEVENTV_SNAPSHOT_PROVIDER,
+                                   channelEmoteSnapshotKey(this->getName()),
+                                   map, this->seventvSnapshot_.etag,
+                                   this->seventvSnapshot_.extra);
+                this->setSeventvEmotes(std::move(map));
                 this->updateSeventvData(channelInfo.userID,
                                         channelInfo.emoteSetID);
                 this->seventvUserTwitchConnectionIndex_ =
@@ -433,16 +533,19 @@ void TwitchChannel::refreshSevenTVChannelEmotes(bool manualRefresh)
 void TwitchChannel::setBttvEmotes(std::shared_ptr<const EmoteMap> &&map)
 {
     this->bttvEmotes_.set(std::move(map));
+    this->channelEmotesChanged.invoke();
 }
 
 void TwitchChannel::setFfzEmotes(std::shared_ptr<const EmoteMap> &&map)
 {
     this->ffzEmotes_.set(std::move(map));
+    this->channelEmotesChanged.invoke();
 }
 
 void TwitchChannel::setSeventvEmotes(std::shared_ptr<const EmoteMap> &&map)
 {
     this->seventvEmotes_.set(std::move(map));
+    this->channelEmotesChanged.invoke();
 }
 
 void TwitchChannel::addQueuedRedemption(const QString &rewardId,
@@ -707,17 +810,35 @@ void TwitchChannel::roomIdChanged()
     {
         return;
     }
-    this->refreshPubSub();
+    // Badges are needed to build the messages received while the channel
+    // isn't active and the live status is shown on the tab.
     this->refreshBadges();
     this->refreshCheerEmotes();
+    getApp()->getTwitchLiveController()->add(
+        std::dynamic_pointer_cast<TwitchChannel>(shared_from_this()));
+
+    if (this->active_)
+    {
+        this->loadActiveData();
+    }
+    else
+    {
+        qCDebug(chatterinoTwitch) << "[TwitchChannel" << this->getName()
+                                  << "] Deferring loads until shown";
+    }
+}
+
+void TwitchChannel::loadActiveData()
+{
+    this->refreshPubSub();
     this->refreshTwitchChannelEmotes(false);
     this->refreshFFZChannelEmotes(false);
     this->refreshBTTVChannelEmotes(false);
     this->refreshSevenTVChannelEmotes(false);
     this->joinBttvChannel();
     this->listenSevenTVCosmetics();
-    getApp()->getTwitchLiveController()->add(
-        std::dynamic_pointer_cast<TwitchChannel>(shared_from_this()));
+    this->refreshChatters();
+    this->loadRecentMessages();
 }
 
 QString TwitchChannel::prepareMessage(const QString &message) const
@@ -893,6 +1014,21 @@ bool TwitchChannel::hasHighRateLimit() const
     return this->isMod() || this->isBroadcaster() || this->isVip();
 }
 
+size_t TwitchChannel::queuedMessages() const
+{
+    return this->queuedMessages_;
+}
+
+void TwitchChannel::setQueuedMessages(size_t count)
+{
+    if (this->queuedMessages_ == count)
+    {
+        return;
+    }
+    this->queuedMessages_ = count;
+    this->queuedMessagesChanged.invoke();
+}
+
 bool TwitchChannel::canReconnect() const
 {
     return true;
@@ -928,7 +1064,6 @@ void TwitchChannel::setRoomId(const QString &id)
         if (!getApp()->isTest())
         {
             this->roomIdChanged();
-            this->loadRecentMessages();
         }
         this->disconnected_ = false;
         this->lastConnectedAt_ = std::chrono::system_clock::now();
@@ -1061,6 +1196,7 @@ void TwitchChannel::addBttvEmote(
 {
     auto emote = BttvEmotes::addEmote(this->getDisplayName(), this->bttvEmotes_,
                                       message);
+    this->channelEmotesChanged.invoke();
 
     this->addOrReplaceLiveUpdatesAddRemove(true, "BTTV", QString() /*actor*/,
                                            emote->name.string);
@@ -1075,6 +1211,7 @@ void TwitchChannel::updateBttvEmote(
     {
         return;
     }
+    this->channelEmotesChanged.invoke();
 
     const auto [oldEmote, newEmote] = *updated;
     if (oldEmote->name == newEmote->name)
@@ -1096,6 +1233,7 @@ void TwitchChannel::removeBttvEmote(
     {
         return;
     }
+    this->channelEmotesChanged.invoke();
 
     this->addOrReplaceLiveUpdatesAddRemove(false, "BTTV", QString() /*actor*/,
                                            (*removed)->name.string);
@@ -1108,6 +1246,7 @@ void TwitchChannel::addSeventvEmote(
     {
         return;
     }
+    this->channelEmotesChanged.invoke();
 
     this->addOrReplaceLiveUpdatesAddRemove(
         true, "7TV", dispatch.actorName, dispatch.emoteJson["name"].toString());
@@ -1120,6 +1259,7 @@ void TwitchChannel::updateSeventvEmote(
     {
         return;
     }
+    this->channelEmotesChanged.invoke();
 
     auto builder =
         MessageBuilder(liveUpdatesUpdateEmoteMessage, "7TV", dispatch.actorName,
@@ -1135,6 +1275,7 @@ void TwitchChannel::removeSeventvEmote(
     {
         return;
     }
+    this->channelEmotesChanged.invoke();
 
     this->addOrReplaceLiveUpdatesAddRemove(false, "7TV", dispatch.actorName,
                                            (*removed)->name.string);
@@ -1159,6 +1300,7 @@ void TwitchChannel::updateSeventvUser(
                 {
                     this->seventvEmotes_.set(
                         std::make_shared<EmoteMap>(emotes));
+                    this->channelEmotesChanged.invoke();
                     auto builder =
                         MessageBuilder(liveUpdatesUpdateEmoteSetMessage, "7TV",
                                        dispatch.actorName, name);
@@ -1172,6 +1314,7 @@ void TwitchChannel::updateSeventvUser(
                 if (auto shared = weak.lock())
                 {
                     this->seventvEmotes_.set(EMPTY_EMOTE_MAP);
+                    this->channelEmotesChanged.invoke();
                     this->addSystemMessage(
                         QString("Failed updating 7TV emote set (%1).")
                             .arg(reason));
@@ -1393,7 +1536,16 @@ void TwitchChannel::loadRecentMessages()
                 return;
             }
 
-            tc->addMessagesAtStart(messages);
+            if (tc->hasMessages())
+            {
+                // The channel was activated after it joined, so it already
+                // received some of the messages (see activate)
+                tc->fillInMissingMessages(messages);
+            }
+            else
+            {
+                tc->addMessagesAtStart(messages);
+            }
             tc->loadingRecentMessages_.clear();
 
             std::vector<MessagePtr> msgs;
@@ -1497,7 +1649,7 @@ void TwitchChannel::loadRecentMessagesReconnect()
 
 void TwitchChannel::refreshPubSub()
 {
-    if (getApp()->isTest())
+    if (getApp()->isTest() || !this->active_)
     {
         return;
     }
@@ -1645,7 +1797,7 @@ void TwitchChannel::refreshPubSub()
 void TwitchChannel::refreshChatters()
 {
     // helix endpoint only works for mods
-    if (!this->hasModRights())
+    if (!this->hasModRights() || !this->active_)
     {
         return;
     }
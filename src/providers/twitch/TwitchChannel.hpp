@@ -17,9 +17,11 @@
 #include <boost/signals2.hpp>
 #include <IrcMessage>
 #include <pajlada/signals/signalholder.hpp>
+#include <QByteArray>
 #include <QColor>
 #include <QElapsedTimer>
 #include <QRegularExpression>
+#include <QStringList>
 
 #include <atomic>
 #include <mutex>
@@ -151,6 +153,15 @@ public:
 
     void initialize();
 
+    /// @brief Loads everything that's only needed once this channel is shown
+    ///
+    /// With lazy channel activation, channels in hidden tabs only join IRC.
+    /// Recent messages, third party emotes, PubSub/EventSub and live update
+    /// subscriptions as well as chatters are loaded once a split showing the
+    /// channel becomes visible. Calling this more than once has no effect.
+    void activate();
+    bool isActive() const;
+
     // Channel methods
     bool isEmpty() const override;
     bool canSendMessage() const override;
@@ -161,6 +172,10 @@ public:
     bool isStaff() const;
     bool isBroadcaster() const override;
     bool hasHighRateLimit() const override;
+    /// Number of messages waiting for the rate limit to send them
+    size_t queuedMessages() const;
+    /// Only the TwitchIrcServer may call this
+    void setQueuedMessages(size_t count);
     bool canReconnect() const override;
     void reconnect() override;
     QString getCurrentStreamID() const override;
@@ -293,6 +308,12 @@ public:
 
     pajlada::Signals::NoArgSignal roomModesChanged;
 
+    /// Fires when the number of queued messages changed
+    pajlada::Signals::NoArgSignal queuedMessagesChanged;
+
+    /// Fires when the BTTV, FFZ or 7TV emotes of this channel changed
+    pajlada::Signals::NoArgSignal channelEmotesChanged;
+
     // Channel point rewards
     void addQueuedRedemption(const QString &rewardId,
                              const QString &originalContent,
@@ -357,6 +378,11 @@ private:
     /// This should only happen once per channel, whenever the ID goes from unset to set
     void roomIdChanged();
 
+    /// Loads the emote snapshots of this channel (see EmoteSnapshot.hpp)
+    void loadEmoteSnapshots();
+    /// Loads the data deferred until the channel is active (see #activate)
+    void loadActiveData();
+
     /** Joins (subscribes to) a Twitch channel for updates on BTTV. */
     void joinBttvChannel() const;
     /**
@@ -432,6 +458,9 @@ private:
     UniqueAccess<StreamStatus> streamStatus_;
     UniqueAccess<RoomModes> roomModes;
     bool disconnected_{};
+    bool active_ = true;
+    /// Started when the channel is created, used to log the activation delay
+    QElapsedTimer createdTimer_;
     std::optional<std::chrono::time_point<std::chrono::system_clock>>
         lastConnectedAt_{};
     std::atomic_flag loadingRecentMessages_ = ATOMIC_FLAG_INIT;
@@ -467,6 +496,7 @@ private:
 
     // --
     QString lastSentMessage_;
+    size_t queuedMessages_ = 0;
     QObject lifetimeGuard_;
     QTimer chattersListTimer_;
     QTimer threadClearTimer_;
@@ -490,6 +520,21 @@ private:
      */
     size_t seventvUserTwitchConnectionIndex_{};
 
+    /// The ETag and provider specific data of a channel's emote snapshot
+    struct EmoteSnapshotInfo {
+        QByteArray etag;
+        /// The first entry is the room ID the emotes were loaded for
+        QStringList extra;
+
+        bool belongsTo(const QString &roomID) const
+        {
+            return !this->extra.isEmpty() && this->extra.front() == roomID;
+        }
+    };
+    EmoteSnapshotInfo bttvSnapshot_;
+    EmoteSnapshotInfo ffzSnapshot_;
+    EmoteSnapshotInfo seventvSnapshot_;
+
     /**
      * The next moment in time to signal activity in this channel to 7TV.
      * Or: Up until this moment we don't need to send activity.
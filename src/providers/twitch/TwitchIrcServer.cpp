@@ -32,6 +32,7 @@
 #include <pajlada/signals/signalholder.hpp>
 #include <QCoreApplication>
 #include <QMetaEnum>
+#include <QStringBuilder>
 
 #include <cassert>
 #include <functional>
@@ -227,12 +228,30 @@ TwitchIrcServer::TwitchIrcServer()
     this->connections_.managedConnect(this->readConnection_->heartbeat, [this] {
         this->markChannelsConnected();
     });
+
+    this->sendQueueTimer_.setSingleShot(true);
+    QObject::connect(&this->sendQueueTimer_, &QTimer::timeout, this, [this] {
+        this->processSendQueue();
+    });
+    this->connections_.managedConnect(
+        this->sendQueue_.queueChanged, [this](const QString &channelName) {
+            auto channel = std::dynamic_pointer_cast<TwitchChannel>(
+                this->getChannelOrEmpty(channelName));
+            if (channel)
+            {
+                channel->setQueuedMessages(
+                    this->sendQueue_.queuedFor(channelName));
+            }
+        });
 }
 
 void TwitchIrcServer::initialize()
 {
     getApp()->getAccounts()->twitch.currentUserChanged.connect([this]() {
         postToThread([this] {
+            // Queued messages were meant to be sent by the previous account
+            this->sendQueueTimer_.stop();
+            this->sendQueue_.clear();
             this->connect();
         });
     });
@@ -690,72 +709,75 @@ std::shared_ptr<Channel> TwitchIrcServer::getChannelOrEmptyByID(
     return Channel::getEmpty();
 }
 
-bool TwitchIrcServer::prepareToSend(
-    const std::shared_ptr<TwitchChannel> &channel)
+void TwitchIrcServer::enqueueMessage(
+    const std::shared_ptr<TwitchChannel> &channel, const QString &message,
+    const QString &replyId, std::function<void()> send)
 {
-    std::lock_guard<std::mutex> guard(this->lastMessageMutex_);
-
-    auto &lastMessage = channel->hasHighRateLimit() ? this->lastMessageMod_
-                                                    : this->lastMessagePleb_;
-    size_t maxMessageCount = channel->hasHighRateLimit() ? 99 : 19;
-    auto minMessageOffset = (channel->hasHighRateLimit() ? 100ms : 1100ms);
+    assertInGuiThread();
 
-    auto now = std::chrono::steady_clock::now();
+    using Priority = MessageSendQueue::Priority;
 
-    // check if you are sending messages too fast
-    if (!lastMessage.empty() && lastMessage.back() + minMessageOffset > now)
+    // Twitch drops duplicate messages anyway, so sending them again isn't
+    // useful unless the user allowed duplicate messages
+    QString mergeKey;
+    if (!getSettings()->allowDuplicateMessages)
     {
-        if (this->lastErrorTimeSpeed_ + 30s < now)
-        {
-            channel->addSystemMessage("You are sending messages too quickly.");
-
-            this->lastErrorTimeSpeed_ = now;
-        }
-        return false;
+        mergeKey = replyId % u'\n' % message;
     }
 
-    // remove messages older than 30 seconds
-    while (!lastMessage.empty() && lastMessage.front() + 32s < now)
-    {
-        lastMessage.pop();
-    }
+    // Commands that weren't handled by us are sent as-is. Moderation actions
+    // of moderators skip the queued chat messages.
+    auto priority =
+        channel->isMod() && MessageSendQueue::isModerationCommand(message)
+            ? Priority::Moderation
+            : Priority::Chat;
+
+    this->sendQueue_.enqueue({
+        .channel = channel->getName(),
+        .mergeKey = mergeKey,
+        .priority = priority,
+        .highRateLimit = channel->hasHighRateLimit(),
+        .send = std::move(send),
+    });
+    this->processSendQueue();
+}
 
-    // check if you are sending too many messages
-    if (lastMessage.size() >= maxMessageCount)
+void TwitchIrcServer::processSendQueue()
+{
+    auto now = MessageSendQueue::Clock::now();
+    auto next = this->sendQueue_.process(now);
+    if (!next)
     {
-        if (this->lastErrorTimeAmount_ + 30s < now)
-        {
-            channel->addSystemMessage("You are sending too many messages.");
-
-            this->lastErrorTimeAmount_ = now;
-        }
-        return false;
+        this->sendQueueTimer_.stop();
+        return;
     }
 
-    lastMessage.push(now);
-    return true;
+    auto delay = std::chrono::ceil<std::chrono::milliseconds>(*next - now);
+    this->sendQueueTimer_.start(delay);
 }
 
 void TwitchIrcServer::onMessageSendRequested(
     const std::shared_ptr<TwitchChannel> &channel, const QString &message,
     bool &sent)
 {
-    sent = false;
-
-    bool canSend = this->prepareToSend(channel);
-    if (!canSend)
-    {
-        return;
-    }
+    this->enqueueMessage(
+        channel, message, {},
+        [this, weak = std::weak_ptr(channel), message] {
+            auto channel = weak.lock();
+            if (!channel)
+            {
+                return;
+            }
 
-    if (shouldSendHelixChat())
-    {
-        sendHelixMessage(channel, message);
-    }
-    else
-    {
-        this->sendMessage(channel->getName(), message);
-    }
+            if (shouldSendHelixChat())
+            {
+                sendHelixMessage(channel, message);
+            }
+            else
+            {
+                this->sendMessage(channel->getName(), message);
+            }
+        });
 
     sent = true;
 }
@@ -764,23 +786,27 @@ void TwitchIrcServer::onReplySendRequested(
     const std::shared_ptr<TwitchChannel> &channel, const QString &message,
     const QString &replyId, bool &sent)
 {
-    sent = false;
+    this->enqueueMessage(
+        channel, message, replyId,
+        [this, weak = std::weak_ptr(channel), message, replyId] {
+            auto channel = weak.lock();
+            if (!channel)
+            {
+                return;
+            }
 
-    bool canSend = this->prepareToSend(channel);
-    if (!canSend)
-    {
-        return;
-    }
+            if (shouldSendHelixChat())
+            {
+                sendHelixMessage(channel, message, replyId);
+            }
+            else
+            {
+                this->sendRawMessage("@reply-parent-msg-id=" + replyId +
+                                     " PRIVMSG #" + channel->getName() +
+                                     " :" + message);
+            }
+        });
 
-    if (shouldSendHelixChat())
-    {
-        sendHelixMessage(channel, message, replyId);
-    }
-    else
-    {
-        this->sendRawMessage("@reply-parent-msg-id=" + replyId + " PRIVMSG #" +
-                             channel->getName() + " :" + message);
-    }
     sent = true;
 }
 
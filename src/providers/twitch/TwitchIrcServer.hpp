@@ -4,17 +4,16 @@
 #include "common/Channel.hpp"
 #include "common/Common.hpp"
 #include "providers/irc/IrcConnection2.hpp"
+#include "providers/twitch/MessageSendQueue.hpp"
 #include "util/RatelimitBucket.hpp"
 
 #include <IrcMessage>
 #include <pajlada/signals/signal.hpp>
 #include <pajlada/signals/signalholder.hpp>
 
-#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
-#include <queue>
 
 namespace chatterino {
 
@@ -176,7 +175,13 @@ private:
                               const QString &message, const QString &replyId,
                               bool &sent);
 
-    bool prepareToSend(const std::shared_ptr<TwitchChannel> &channel);
+    /// Queues a message in #sendQueue_. @a send is called once the rate
+    /// limits allow it.
+    void enqueueMessage(const std::shared_ptr<TwitchChannel> &channel,
+                        const QString &message, const QString &replyId,
+                        std::function<void()> send);
+    /// Sends all messages that are allowed now and schedules the next send
+    void processSendQueue();
 
     QMap<QString, std::weak_ptr<Channel>> channels;
     std::mutex channelMutex;
@@ -195,11 +200,9 @@ private:
 
     pajlada::Signals::SignalHolder connections_;
 
-    std::mutex lastMessageMutex_;
-    std::queue<std::chrono::steady_clock::time_point> lastMessagePleb_;
-    std::queue<std::chrono::steady_clock::time_point> lastMessageMod_;
-    std::chrono::steady_clock::time_point lastErrorTimeSpeed_;
-    std::chrono::steady_clock::time_point lastErrorTimeAmount_;
+    /// Outgoing messages of the current account
+    MessageSendQueue sendQueue_;
+    QTimer sendQueueTimer_;
 };
 
 }  // namespace chatterino
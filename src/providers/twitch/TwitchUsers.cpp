@@ -1,15 +1,21 @@
 #include "providers/twitch/TwitchUsers.hpp"
 
+#include "Application.hpp"
 #include "common/QLogging.hpp"
+#include "controllers/userdata/UserDataController.hpp"
 #include "providers/twitch/api/Helix.hpp"
+#include "providers/twitch/api/HelixScheduler.hpp"
 #include "providers/twitch/TwitchUser.hpp"
 
 #include <boost/unordered/unordered_flat_map.hpp>
-#include <QStringList>
-#include <QTimer>
+#include <QDateTime>
 
 namespace {
 
+/// Users fetched from Helix within this time aren't looked up again. Being
+/// seen in chat doesn't count, as that doesn't tell us about renames.
+constexpr qint64 MAX_STORED_USER_AGE_SECONDS = 7LL * 24 * 60 * 60;
+
 auto withSelf(auto *ptr, auto cb)
 {
     return [weak{ptr->weak_from_this()}, cb = std::move(cb)](auto &&...args) {
@@ -29,17 +35,10 @@ namespace chatterino {
 class TwitchUsersPrivate
     : public std::enable_shared_from_this<TwitchUsersPrivate>
 {
-public:
-    TwitchUsersPrivate();
-
 private:
     boost::unordered_flat_map<UserId, std::shared_ptr<TwitchUser>> cache;
-    QStringList unresolved;
-    QTimer nextBatchTimer;
-    bool isResolving = false;
 
     std::shared_ptr<TwitchUser> makeUnresolved(const UserId &id);
-    void makeNextRequest();
     void updateUsers(const std::vector<HelixUser> &users);
 
     friend TwitchUsers;
@@ -62,21 +61,10 @@ std::shared_ptr<TwitchUser> TwitchUsers::resolveID(const UserId &id)
     return this->private_->makeUnresolved(id);
 }
 
-TwitchUsersPrivate::TwitchUsersPrivate()
-{
-    this->nextBatchTimer.setSingleShot(true);
-    // Wait for multiple request batches to come in before making a request
-    this->nextBatchTimer.setInterval(250);
-
-    QObject::connect(&this->nextBatchTimer, &QTimer::timeout, [this] {
-        this->makeNextRequest();
-    });
-}
-
 std::shared_ptr<TwitchUser> TwitchUsersPrivate::makeUnresolved(const UserId &id)
 {
     // assumption: Cache entry is empty so neither a shared pointer was created
-    //             nor an entry in the unresolved list was added.
+    //             nor a lookup was queued.
     auto ptr = this->cache
                    .emplace(id, std::make_shared<TwitchUser>(TwitchUser{
                                     .id = id.string,
@@ -90,50 +78,48 @@ std::shared_ptr<TwitchUser> TwitchUsersPrivate::makeUnresolved(const UserId &id)
         return ptr;
     }
 
-    this->unresolved.append(id.string);
-    if (!this->isResolving && !this->nextBatchTimer.isActive())
+    auto stored = getApp()->getUserData()->getMetadata(id.string);
+    if (stored)
     {
-        this->nextBatchTimer.start();
-    }
-    return ptr;
-}
+        ptr->name = stored->login;
+        ptr->displayName = stored->displayName;
+        ptr->profilePictureUrl = stored->profilePictureUrl;
 
-void TwitchUsersPrivate::makeNextRequest()
-{
-    if (this->unresolved.empty())
-    {
-        return;
+        if (!stored->login.isEmpty() && !stored->profilePictureUrl.isEmpty() &&
+            QDateTime::currentSecsSinceEpoch() - stored->lastResolved <
+                MAX_STORED_USER_AGE_SECONDS)
+        {
+            return ptr;
+        }
     }
 
-    if (this->isResolving)
-    {
-        qCWarning(chatterinoTwitch) << "Tried to start request while resolving";
-        return;
-    }
-    this->isResolving = true;
-
-    auto ids = this->unresolved.mid(
-        0, std::min<qsizetype>(this->unresolved.size(), 100));
-    this->unresolved = this->unresolved.mid(ids.length());
-    getHelix()->fetchUsers(ids, {},
-                           withSelf(this,
-                                    [](auto self, const auto &users) {
-                                        self->updateUsers(users);
-                                        self->isResolving = false;
-                                        self->makeNextRequest();
-                                    }),
-                           withSelf(this, [](auto self) {
-                               qCWarning(chatterinoTwitch)
-                                   << "Failed to load users";
-                               self->isResolving = false;
-                               self->makeNextRequest();
-                           }));
+    // The scheduler merges these lookups into batched requests
+    HelixScheduler::instance().fetchUsersById(
+        {id.string},
+        withSelf(this,
+                 [](auto self, const auto &users) {
+                     self->updateUsers(users);
+                 }),
+        [] {
+            qCWarning(chatterinoTwitch) << "Failed to load users";
+        });
+    return ptr;
 }
 
 void TwitchUsersPrivate::updateUsers(const std::vector<HelixUser> &users)
 {
+    auto *userData = getApp()->getUserData();
+    auto now = QDateTime::currentSecsSinceEpoch();
     for (const auto &user : users)
     {
+        userData->updateMetadata({
+            .id = user.id,
+            .login = user.login,
+            .displayName = user.displayName,
+            .profilePictureUrl = user.profileImageUrl,
+            .lastResolved = now,
+        });
+
         auto cached = this->cache.find(UserId{user.id});
         if (cached == this->cache.end())
         {
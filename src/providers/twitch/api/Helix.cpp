@@ -6,6 +6,7 @@
 #include "common/network/NetworkRequest.hpp"
 #include "common/network/NetworkResult.hpp"
 #include "common/QLogging.hpp"
+#include "providers/twitch/api/HelixScheduler.hpp"
 #include "util/CancellationToken.hpp"
 #include "util/QMagicEnum.hpp"
 
@@ -3424,6 +3425,10 @@ NetworkRequest Helix::makeRequest(const QString &url, const QUrlQuery &urlQuery,
         .header("Accept", "application/json")
         .header("Client-ID", this->clientId)
         .header("Authorization", "Bearer " + this->oauthToken)
+        .onResponse([](const NetworkResult &result) {
+            HelixRateLimiter::instance().update(
+                result, HelixRateLimiter::Clock::now());
+        })
 #ifndef NDEBUG
         .ignoreSslErrors(ignoreSslErrors)
 #endif
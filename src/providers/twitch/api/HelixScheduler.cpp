@@ -0,0 +1,389 @@
+#include "providers/twitch/api/HelixScheduler.hpp"
+
+#include "common/network/NetworkResult.hpp"
+#include "common/QLogging.hpp"
+#include "debug/PerformanceCounters.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+using namespace chatterino;
+
+void addLatency(std::chrono::steady_clock::time_point queuedAt)
+{
+    auto &counters = PerformanceCounters::instance();
+    auto latency = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - queuedAt);
+    counters.helixLookupsCompleted.fetch_add(1, std::memory_order_relaxed);
+    counters.helixLookupLatencyMs.fetch_add(
+        static_cast<uint64_t>(latency.count()), std::memory_order_relaxed);
+}
+
+}  // namespace
+
+namespace chatterino {
+
+void HelixRateLimiter::update(const NetworkResult &result,
+                              Clock::time_point now)
+{
+    bool limitOk = false;
+    bool remainingOk = false;
+    bool resetOk = false;
+    auto limit = result.rawHeader("Ratelimit-Limit").toInt(&limitOk);
+    auto remaining =
+        result.rawHeader("Ratelimit-Remaining").toInt(&remainingOk);
+    auto reset = result.rawHeader("Ratelimit-Reset").toLongLong(&resetOk);
+    if (!limitOk || !remainingOk || !resetOk)
+    {
+        return;
+    }
+
+    this->update(limit, remaining,
+                 Clock::time_point(std::chrono::seconds(reset)), now);
+}
+
+void HelixRateLimiter::update(int limit, int remaining, Clock::time_point reset,
+                              Clock::time_point now)
+{
+    std::lock_guard lock(this->mutex_);
+    this->refill(now);
+
+    this->limit_ = std::max(limit, 1);
+    // Tokens taken locally might not have reached the server yet, so never
+    // increase the number of tokens from a response.
+    this->tokens_ =
+        std::clamp<double>(this->tokens_, 0, std::max(remaining, 0));
+
+    auto missing = this->limit_ - remaining;
+    auto untilReset = std::chrono::duration<double>(reset - now).count();
+    if (missing > 0 && untilReset > 0)
+    {
+        this->refillPerSecond_ = missing / untilReset;
+    }
+    else
+    {
+        this->refillPerSecond_ =
+            this->limit_ / std::chrono::duration<double>(REFILL_PERIOD).count();
+    }
+}
+
+bool HelixRateLimiter::tryAcquire(int reserve, Clock::time_point now)
+{
+    std::lock_guard lock(this->mutex_);
+    this->refill(now);
+    if (this->tokens_ < reserve + 1)
+    {
+        return false;
+    }
+    this->tokens_ -= 1;
+    return true;
+}
+
+std::chrono::milliseconds HelixRateLimiter::timeUntilAvailable(
+    int reserve, Clock::time_point now)
+{
+    std::lock_guard lock(this->mutex_);
+    this->refill(now);
+    auto needed = reserve + 1 - this->tokens_;
+    if (needed <= 0)
+    {
+        return std::chrono::milliseconds{0};
+    }
+    return std::chrono::milliseconds{static_cast<int64_t>(
+        std::ceil(needed / this->refillPerSecond_ * 1000.0))};
+}
+
+int HelixRateLimiter::available(Clock::time_point now)
+{
+    std::lock_guard lock(this->mutex_);
+    this->refill(now);
+    return static_cast<int>(this->tokens_);
+}
+
+int HelixRateLimiter::limit() const
+{
+    std::lock_guard lock(this->mutex_);
+    return this->limit_;
+}
+
+void HelixRateLimiter::refill(Clock::time_point now)
+{
+    if (now <= this->lastRefill_)
+    {
+        return;
+    }
+    auto elapsed = std::chrono::duration<double>(now - this->lastRefill_);
+    this->tokens_ = std::min<double>(
+        this->limit_, this->tokens_ + elapsed.count() * this->refillPerSecond_);
+    this->lastRefill_ = now;
+}
+
+HelixRateLimiter &HelixRateLimiter::instance()
+{
+    static HelixRateLimiter limiter;
+    return limiter;
+}
+
+HelixScheduler::HelixScheduler(HelixRateLimiter &limiter, IHelix *helix)
+    : limiter_(limiter)
+    , helix_(helix)
+{
+    this->usersById_.fetch = [](IHelix *helix, const QStringList &ids,
+                                auto onSuccess, auto onFailure) {
+        helix->fetchUsers(ids, {}, std::move(onSuccess), std::move(onFailure));
+    };
+    this->usersById_.keyOf = [](const HelixUser &user) {
+        return user.id;
+    };
+
+    this->streamsById_.fetch = [](IHelix *helix, const QStringList &ids,
+                                  auto onSuccess, auto onFailure) {
+        helix->fetchStreams(ids, {}, std::move(onSuccess),
+                            std::move(onFailure), [] {});
+    };
+    this->streamsById_.keyOf = [](const HelixStream &stream) {
+        return stream.userId;
+    };
+
+    this->streamsByLogin_.fetch = [](IHelix *helix, const QStringList &logins,
+                                     auto onSuccess, auto onFailure) {
+        helix->fetchStreams({}, logins, std::move(onSuccess),
+                            std::move(onFailure), [] {});
+    };
+    this->streamsByLogin_.keyOf = [](const HelixStream &stream) {
+        return stream.userLogin.toLower();
+    };
+
+    this->channelsById_.fetch = [](IHelix *helix, const QStringList &ids,
+                                   auto onSuccess, auto onFailure) {
+        helix->fetchChannels(ids, std::move(onSuccess), std::move(onFailure));
+    };
+    this->channelsById_.keyOf = [](const HelixChannel &channel) {
+        return channel.userId;
+    };
+
+    this->flushTimer_.setSingleShot(true);
+    QObject::connect(&this->flushTimer_, &QTimer::timeout, [this] {
+        this->flush();
+    });
+}
+
+void HelixScheduler::fetchUsersById(
+    QStringList ids, ResultCallback<std::vector<HelixUser>> onSuccess,
+    HelixFailureCallback onFailure)
+{
+    this->enqueue(this->usersById_, std::move(ids), std::move(onSuccess),
+                  std::move(onFailure));
+}
+
+void HelixScheduler::fetchStreamsById(
+    QStringList ids, ResultCallback<std::vector<HelixStream>> onSuccess,
+    HelixFailureCallback onFailure)
+{
+    this->enqueue(this->streamsById_, std::move(ids), std::move(onSuccess),
+                  std::move(onFailure));
+}
+
+void HelixScheduler::fetchStreamsByLogin(
+    QStringList logins, ResultCallback<std::vector<HelixStream>> onSuccess,
+    HelixFailureCallback onFailure)
+{
+    for (auto &login : logins)
+    {
+        login = login.toLower();
+    }
+    this->enqueue(this->streamsByLogin_, std::move(logins),
+                  std::move(onSuccess), std::move(onFailure));
+}
+
+void HelixScheduler::fetchChannelsById(
+    QStringList ids, ResultCallback<std::vector<HelixChannel>> onSuccess,
+    HelixFailureCallback onFailure)
+{
+    this->enqueue(this->channelsById_, std::move(ids), std::move(onSuccess),
+                  std::move(onFailure));
+}
+
+void HelixScheduler::flush()
+{
+    this->flushTimer_.stop();
+
+    bool done = this->flushQueue(this->usersById_);
+    done = done && this->flushQueue(this->streamsById_);
+    done = done && this->flushQueue(this->streamsByLogin_);
+    done = done && this->flushQueue(this->channelsById_);
+    if (done)
+    {
+        return;
+    }
+
+    auto wait = this->limiter_.timeUntilAvailable(
+        RESERVED_TOKENS, HelixRateLimiter::Clock::now());
+    qCDebug(chatterinoTwitch) << "Helix rate limit reached, delaying"
+                              << this->queuedLookups() << "lookups by"
+                              << wait.count() << "ms";
+    PerformanceCounters::instance().helixRateLimitWaits.fetch_add(
+        1, std::memory_order_relaxed);
+    this->flushTimer_.start(std::max(wait, MERGE_DELAY));
+}
+
+size_t HelixScheduler::queuedLookups() const
+{
+    return this->usersById_.pending.size() + this->streamsById_.pending.size() +
+           this->streamsByLogin_.pending.size() +
+           this->channelsById_.pending.size();
+}
+
+HelixScheduler &HelixScheduler::instance()
+{
+    // Like the Helix instance, this is never destroyed, so callbacks of
+    // requests that are still running can't outlive it.
+    static auto *scheduler = new HelixScheduler(HelixRateLimiter::instance());
+    return *scheduler;
+}
+
+template <typename T>
+void HelixScheduler::enqueue(Queue<T> &queue, QStringList keys,
+                             ResultCallback<std::vector<T>> onSuccess,
+                             HelixFailureCallback onFailure)
+{
+    keys.removeDuplicates();
+    keys.removeAll({});
+
+    auto lookup = std::make_shared<Lookup<T>>();
+    lookup->missingKeys = {keys.begin(), keys.end()};
+    lookup->keys = std::move(keys);
+    lookup->onSuccess = std::move(onSuccess);
+    lookup->onFailure = std::move(onFailure);
+    lookup->queuedAt = std::chrono::steady_clock::now();
+
+    if (lookup->keys.isEmpty())
+    {
+        if (lookup->onSuccess)
+        {
+            lookup->onSuccess({});
+        }
+        return;
+    }
+
+    queue.pending.push_back(std::move(lookup));
+    PerformanceCounters::instance().helixLookupsQueued.fetch_add(
+        1, std::memory_order_relaxed);
+
+    if (!this->flushTimer_.isActive())
+    {
+        this->flushTimer_.start(MERGE_DELAY);
+    }
+}
+
+template <typename T>
+bool HelixScheduler::flushQueue(Queue<T> &queue)
+{
+    auto &counters = PerformanceCounters::instance();
+
+    while (!queue.pending.empty())
+    {
+        if (!this->limiter_.tryAcquire(RESERVED_TOKENS,
+                                       HelixRateLimiter::Clock::now()))
+        {
+            return false;
+        }
+
+        QStringList batch;
+        std::unordered_set<QString> inBatch;
+        std::vector<std::shared_ptr<Lookup<T>>> lookups;
+        while (!queue.pending.empty() && batch.size() < BATCH_SIZE)
+        {
+            auto lookup = queue.pending.front();
+            while (lookup->nextKey < lookup->keys.size() &&
+                   batch.size() < BATCH_SIZE)
+            {
+                const auto &key = lookup->keys.at(lookup->nextKey);
+                if (inBatch.insert(key).second)
+                {
+                    batch.append(key);
+                }
+                lookup->nextKey++;
+            }
+            lookup->runningBatches++;
+            lookups.push_back(lookup);
+
+            if (lookup->nextKey < lookup->keys.size())
+            {
+                break;  // the rest goes into the next batch
+            }
+            queue.pending.pop_front();
+            counters.helixLookupsQueued.fetch_sub(1,
+                                                  std::memory_order_relaxed);
+        }
+
+        counters.helixBatchesSent.fetch_add(1, std::memory_order_relaxed);
+        queue.fetch(
+            this->helix(), batch,
+            [this, lookups, &queue](const std::vector<T> &results) {
+                this->batchFinished(lookups, &results, queue);
+            },
+            [this, lookups, &queue] {
+                this->batchFinished<T>(lookups, nullptr, queue);
+            });
+    }
+
+    return true;
+}
+
+template <typename T>
+void HelixScheduler::batchFinished(
+    const std::vector<std::shared_ptr<Lookup<T>>> &lookups,
+    const std::vector<T> *results, const Queue<T> &queue)
+{
+    for (const auto &lookup : lookups)
+    {
+        lookup->runningBatches--;
+        if (results == nullptr)
+        {
+            lookup->failed = true;
+        }
+        else
+        {
+            for (const auto &item : *results)
+            {
+                if (lookup->missingKeys.erase(queue.keyOf(item)) > 0)
+                {
+                    lookup->results.push_back(item);
+                }
+            }
+        }
+
+        if (lookup->runningBatches > 0 ||
+            lookup->nextKey < lookup->keys.size())
+        {
+            continue;
+        }
+
+        addLatency(lookup->queuedAt);
+        if (lookup->failed)
+        {
+            if (lookup->onFailure)
+            {
+                lookup->onFailure();
+            }
+        }
+        else if (lookup->onSuccess)
+        {
+            lookup->onSuccess(lookup->results);
+        }
+    }
+}
+
+IHelix *HelixScheduler::helix() const
+{
+    if (this->helix_ != nullptr)
+    {
+        return this->helix_;
+    }
+    return getHelix();
+}
+
+}  // namespace chatterino
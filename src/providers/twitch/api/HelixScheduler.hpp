@@ -0,0 +1,173 @@
+#pragma once
+
+#include "providers/twitch/api/Helix.hpp"
+
+#include <QString>
+#include <QStringList>
+#include <QTimer>
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace chatterino {
+
+class NetworkResult;
+
+/// @brief Token bucket mirroring Helix' rate limit
+///
+/// Helix allows a number of points per minute (`Ratelimit-Limit`), refilling
+/// the bucket continuously until it's full at `Ratelimit-Reset`. Every Helix
+/// response updates the bucket from its `Ratelimit-*` headers. Between
+/// responses, the bucket refills at the rate derived from the last headers.
+///
+/// This is thread-safe.
+class HelixRateLimiter
+{
+public:
+    using Clock = std::chrono::system_clock;
+
+    /// Points per minute Helix grants a user access token
+    static constexpr int DEFAULT_LIMIT = 800;
+    static constexpr std::chrono::seconds REFILL_PERIOD{60};
+
+    /// Updates the bucket from the `Ratelimit-*` headers of @a result (if it
+    /// has any)
+    void update(const NetworkResult &result, Clock::time_point now);
+    void update(int limit, int remaining, Clock::time_point reset,
+                Clock::time_point now);
+
+    /// Takes a token if more than @a reserve tokens are available
+    bool tryAcquire(int reserve, Clock::time_point now);
+
+    /// Time until tryAcquire(@a reserve) can succeed
+    std::chrono::milliseconds timeUntilAvailable(int reserve,
+                                                 Clock::time_point now);
+
+    /// Tokens currently available (rounded down)
+    int available(Clock::time_point now);
+    int limit() const;
+
+    static HelixRateLimiter &instance();
+
+private:
+    void refill(Clock::time_point now);
+
+    mutable std::mutex mutex_;
+    int limit_ = DEFAULT_LIMIT;
+    double tokens_ = DEFAULT_LIMIT;
+    double refillPerSecond_ = DEFAULT_LIMIT / 60.0;
+    Clock::time_point lastRefill_{};
+};
+
+/// @brief Merges Helix lookups from different callers into batched requests
+///
+/// Lookups (users, streams and channels by ID or login) made within
+/// #MERGE_DELAY of each other are merged into requests of up to #BATCH_SIZE
+/// items. Every lookup receives exactly the items it asked for once all
+/// batches containing its items finished, or its failure callback if any of
+/// them failed.
+///
+/// Batches are only sent while the rate limit has more than
+/// #RESERVED_TOKENS points left, so interactive requests (e.g. commands)
+/// aren't starved by background lookups. Otherwise, they're delayed until the
+/// bucket refilled.
+///
+/// This must only be used from the GUI thread.
+class HelixScheduler
+{
+public:
+    /// Maximum number of items Helix accepts in one lookup
+    static constexpr qsizetype BATCH_SIZE = 100;
+    /// Lookups made within this time of the first queued one are merged
+    static constexpr std::chrono::milliseconds MERGE_DELAY{250};
+    /// Rate limit points left for requests not made through the scheduler
+    static constexpr int RESERVED_TOKENS = 20;
+
+    /// @param helix The Helix instance to use. Uses getHelix() if null.
+    explicit HelixScheduler(HelixRateLimiter &limiter,
+                            IHelix *helix = nullptr);
+
+    void fetchUsersById(QStringList ids,
+                        ResultCallback<std::vector<HelixUser>> onSuccess,
+                        HelixFailureCallback onFailure);
+    void fetchStreamsById(QStringList ids,
+                          ResultCallback<std::vector<HelixStream>> onSuccess,
+                          HelixFailureCallback onFailure);
+    void fetchStreamsByLogin(QStringList logins,
+                             ResultCallback<std::vector<HelixStream>> onSuccess,
+                             HelixFailureCallback onFailure);
+    void fetchChannelsById(QStringList ids,
+                           ResultCallback<std::vector<HelixChannel>> onSuccess,
+                           HelixFailureCallback onFailure);
+
+    /// Sends the queued lookups as far as the rate limit allows
+    void flush();
+
+    /// Number of lookups that weren't sent yet
+    size_t queuedLookups() const;
+
+    static HelixScheduler &instance();
+
+private:
+    template <typename T>
+    struct Lookup {
+        QStringList keys;
+        /// Keys no result was received for yet. A key can be part of multiple
+        /// batches if other lookups in later batches ask for it too.
+        std::unordered_set<QString> missingKeys;
+        ResultCallback<std::vector<T>> onSuccess;
+        HelixFailureCallback onFailure;
+        std::chrono::steady_clock::time_point queuedAt;
+
+        /// Index of the first key that isn't part of a batch yet
+        qsizetype nextKey = 0;
+        size_t runningBatches = 0;
+        bool failed = false;
+        std::vector<T> results;
+    };
+
+    template <typename T>
+    struct Queue {
+        using Fetch = std::function<void(IHelix *, const QStringList &,
+                                         ResultCallback<std::vector<T>>,
+                                         HelixFailureCallback)>;
+
+        Fetch fetch;
+        /// Returns the (normalized) key @a item answers
+        std::function<QString(const T &)> keyOf;
+        std::deque<std::shared_ptr<Lookup<T>>> pending;
+    };
+
+    template <typename T>
+    void enqueue(Queue<T> &queue, QStringList keys,
+                 ResultCallback<std::vector<T>> onSuccess,
+                 HelixFailureCallback onFailure);
+
+    /// Sends batches from @a queue until it's empty or the rate limit is
+    /// reached. Returns false if it stopped because of the rate limit.
+    template <typename T>
+    bool flushQueue(Queue<T> &queue);
+
+    template <typename T>
+    void batchFinished(const std::vector<std::shared_ptr<Lookup<T>>> &lookups,
+                       const std::vector<T> *results, const Queue<T> &queue);
+
+    IHelix *helix() const;
+
+    HelixRateLimiter &limiter_;
+    IHelix *helix_;
+
+    Queue<HelixUser> usersById_;
+    Queue<HelixStream> streamsById_;
+    Queue<HelixStream> streamsByLogin_;
+    Queue<HelixChannel> channelsById_;
+
+    QTimer flushTimer_;
+};
+
+}  // namespace chatterino
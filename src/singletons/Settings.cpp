@@ -2,6 +2,7 @@
 
 #include "Application.hpp"
 #include "common/Args.hpp"
+#include "common/QLogging.hpp"
 #include "controllers/filters/FilterRecord.hpp"
 #include "controllers/highlights/HighlightBadge.hpp"
 #include "controllers/highlights/HighlightBlacklistUser.hpp"
@@ -11,9 +12,17 @@
 #include "controllers/nicknames/Nickname.hpp"
 #include "debug/Benchmark.hpp"
 #include "pajlada/settings/signalargs.hpp"
+#include "singletons/helper/SettingsJournal.hpp"
+#include "util/AsyncFileWriter.hpp"
+#include "util/FilesystemHelpers.hpp"
 #include "util/WindowsHelper.hpp"
 
+#include <pajlada/settings/backup.hpp>
 #include <pajlada/signals/scoped-connection.hpp>
+#include <QSaveFile>
+#include <QTimer>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
 
 namespace {
 
@@ -36,6 +45,10 @@ void initializeSignalVector(pajlada::Signals::SignalHolder &signalHolder,
     });
 }
 
+/// Time between a setting change and the journal write. Changes made in
+/// quick succession (e.g. dragging a slider) end up in a single write.
+constexpr int JOURNAL_DELAY_MS = 1000;
+
 }  // namespace
 
 namespace chatterino {
@@ -147,19 +160,25 @@ Settings *Settings::instance_ = nullptr;
 Settings::Settings(const Args &args, const QString &settingsDirectory)
     : prevInstance_(Settings::instance_)
     , disableSaving(args.dontSaveSettings)
+    , settingsPath_(settingsDirectory + "/settings.json")
+    , journal_(std::make_shared<SettingsJournal>(settingsDirectory +
+                                                 "/settings.journal"))
+    , journalTimer_(std::make_unique<QTimer>())
 {
-    QString settingsPath = settingsDirectory + "/settings.json";
-
     // get global instance of the settings library
     auto settingsInstance = pajlada::Settings::SettingManager::getInstance();
 
-    settingsInstance->load(qPrintable(settingsPath));
+    settingsInstance->load(qPrintable(this->settingsPath_));
 
     settingsInstance->setBackupEnabled(true);
     settingsInstance->setBackupSlots(9);
     settingsInstance->saveMethod =
         pajlada::Settings::SettingManager::SaveMethod::SaveManually;
 
+    // Changes since settings.json was last written have to be applied before
+    // the signal vectors are filled
+    this->replayJournal();
+
     initializeSignalVector(this->signalHolder, this->highlightedMessagesSetting,
                            this->highlightedMessages);
     initializeSignalVector(this->signalHolder, this->highlightedUsersSetting,
@@ -181,6 +200,8 @@ Settings::Settings(const Args &args, const QString &settingsDirectory)
     initializeSignalVector(this->signalHolder, this->loggedChannelsSetting,
                            this->loggedChannels);
 
+    this->trackChanges();
+
     instance_ = this;
 
 #ifdef USEWINSDK
@@ -198,14 +219,196 @@ Settings::~Settings()
     Settings::instance_ = this->prevInstance_;
 }
 
-void Settings::requestSave() const
+void Settings::requestSave()
 {
     if (this->disableSaving)
     {
         return;
     }
 
-    pajlada::Settings::SettingManager::gSave();
+    // Entries journaled so far are part of the snapshot. They're removed
+    // from the journal once the snapshot was written - until then (or if
+    // writing fails), they're still replayed on the next start.
+    auto generation = this->journalGeneration_.getValue() + 1;
+    this->journalGeneration_.setValue(generation);
+
+    // The empty path is the root of the settings tree
+    auto settingManager = pajlada::Settings::SettingManager::getInstance();
+    const auto *root = settingManager->get("");
+    if (root == nullptr)
+    {
+        return;
+    }
+    // Copying the tree is cheap compared to serializing and writing it
+    auto snapshot = std::make_shared<rapidjson::Document>();
+    snapshot->CopyFrom(*root, snapshot->GetAllocator());
+
+    // The snapshot contains all changes
+    {
+        std::lock_guard lock(this->changedSettingsMutex_);
+        this->changedSettings_.clear();
+    }
+    this->journalTimer_->stop();
+
+    // Only the newest snapshot matters, so queued saves are replaced
+    AsyncFileWriter::instance().post(
+        [settingsPath = this->settingsPath_, snapshot, journal = this->journal_,
+         generation] {
+            std::error_code ec;
+            pajlada::Settings::Backup::saveWithBackup(
+                qStringToStdPath(settingsPath),
+                {.enabled = true, .numSlots = 9},
+                [&](const auto &path, auto &ec) {
+                    rapidjson::StringBuffer buffer;
+                    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(
+                        buffer);
+                    snapshot->Accept(writer);
+
+                    QSaveFile file(stdPathToQString(path));
+                    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+                    {
+                        ec = std::make_error_code(std::errc::io_error);
+                        return;
+                    }
+
+                    file.write(buffer.GetString(),
+                               static_cast<qint64>(buffer.GetSize()));
+                    if (!file.commit() || file.error() != QFile::NoError)
+                    {
+                        ec = std::make_error_code(std::errc::io_error);
+                    }
+                },
+                ec);
+
+            if (ec)
+            {
+                // The journal still has all changes since the last save
+                qCWarning(chatterinoSettings)
+                    << "Failed to save settings"
+                    << QString::fromStdString(ec.message());
+                return;
+            }
+            journal->removeOlderThan(generation);
+        },
+        this->settingsPath_);
+}
+
+void Settings::writeJournal()
+{
+    std::set<std::string> changed;
+    {
+        std::lock_guard lock(this->changedSettingsMutex_);
+        std::swap(changed, this->changedSettings_);
+    }
+
+    if (this->disableSaving || changed.empty())
+    {
+        return;
+    }
+
+    QByteArray entries;
+    for (const auto &path : changed)
+    {
+        auto it = this->journaledSettings_.find(path);
+        if (it == this->journaledSettings_.end())
+        {
+            continue;
+        }
+        auto setting = it->second.lock();
+        if (!setting)
+        {
+            continue;
+        }
+
+        const auto *value = setting->unmarshalJSON();
+        if (value == nullptr)
+        {
+            continue;
+        }
+        entries += SettingsJournal::encode(path, *value,
+                                           this->journalGeneration_.getValue());
+    }
+    this->journal_->append(std::move(entries));
+
+    if (this->journal_->size() > SettingsJournal::COMPACT_SIZE)
+    {
+        this->requestSave();
+    }
+}
+
+void Settings::replayJournal()
+{
+    for (const auto &weakSetting : _settings)
+    {
+        if (auto setting = weakSetting.lock())
+        {
+            this->journaledSettings_[setting->getPath()] = weakSetting;
+        }
+    }
+
+    auto replayed = this->journal_->replay(
+        this->journalGeneration_.getValue(),
+        [this](const std::string &path, const rapidjson::Value &value) {
+            auto it = this->journaledSettings_.find(path);
+            if (it == this->journaledSettings_.end())
+            {
+                return;
+            }
+            auto setting = it->second.lock();
+            if (!setting)
+            {
+                return;
+            }
+
+            pajlada::Settings::SignalArgs args;
+            args.compareBeforeSet = true;
+            setting->marshalJSON(value, std::move(args));
+        });
+
+    if (replayed > 0)
+    {
+        qCDebug(chatterinoSettings)
+            << "Replayed" << replayed << "settings journal entries";
+    }
+}
+
+void Settings::trackChanges()
+{
+    this->journalTimer_->setSingleShot(true);
+    this->journalTimer_->setInterval(JOURNAL_DELAY_MS);
+    QObject::connect(this->journalTimer_.get(), &QTimer::timeout, [this] {
+        this->writeJournal();
+    });
+
+    for (const auto &[path, weakSetting] : this->journaledSettings_)
+    {
+        auto setting = weakSetting.lock();
+        if (!setting)
+        {
+            continue;
+        }
+
+        this->signalHolder.managedConnect(
+            setting->updated, [this, path = path](const auto &...) {
+                this->settingChanged(path);
+            });
+    }
+}
+
+void Settings::settingChanged(const std::string &path)
+{
+    {
+        std::lock_guard lock(this->changedSettingsMutex_);
+        this->changedSettings_.insert(path);
+    }
+
+    // Settings are sometimes changed from other threads
+    QMetaObject::invokeMethod(this->journalTimer_.get(), [this] {
+        if (!this->journalTimer_->isActive())
+        {
+            this->journalTimer_->start();
+        }
+    });
 }
 
 void Settings::saveSnapshot()
@@ -22,11 +22,19 @@
 #include <pajlada/settings/settinglistener.hpp>
 #include <pajlada/signals/signalholder.hpp>
 
+#include <memory>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+
+class QTimer;
+
 using TimeoutButton = std::pair<QString, int>;
 
 namespace chatterino {
 
 class Args;
+class SettingsJournal;
 
 #ifdef Q_OS_WIN32
 #    define DEFAULT_FONT_FAMILY "Segoe UI"
@@ -114,8 +122,18 @@ public:
 
     /// Request the settings to be saved to file
     ///
+    /// This takes a snapshot of all settings. It's serialized and written to
+    /// settings.json on the AsyncFileWriter thread, after which the journal
+    /// entries it contains are removed.
     /// Depending on the launch options, a save might end up not happening
-    void requestSave() const;
+    void requestSave();
+
+    /// @brief Appends settings changed since the last write to the journal
+    ///
+    /// This is called shortly after a setting changed. Only settings
+    /// registered through ChatterinoSetting are journaled - others (e.g.
+    /// hotkeys and accounts) are only written by requestSave().
+    void writeJournal();
 
     void saveSnapshot();
     void restoreSnapshot();
@@ -619,6 +637,10 @@ public:
 
     BoolSetting loadTwitchMessageHistoryOnConnect = {
         "/misc/twitch/loadMessageHistoryOnConnect", true};
+    /// Only join channels in hidden tabs and load everything else once
+    /// they're shown (see TwitchChannel::activate)
+    BoolSetting lazyChannelActivation = {"/misc/twitch/lazyChannelActivation",
+                                         false};
     IntSetting twitchMessageHistoryLimit = {
         "/misc/twitch/messageHistoryLimit",
         800,
@@ -743,8 +765,27 @@ public:
 private:
     void updateModerationActions();
 
+    void replayJournal();
+    void trackChanges();
+    void settingChanged(const std::string &path);
+
     std::unique_ptr<rapidjson::Document> snapshot_;
 
+    const QString settingsPath_;
+    /// Shared with queued saves
+    std::shared_ptr<SettingsJournal> journal_;
+    std::unique_ptr<QTimer> journalTimer_;
+    /// Increased whenever settings.json is written (see SettingsJournal)
+    pajlada::Settings::Setting<int> journalGeneration_{
+        "/misc/settingsJournalGeneration", 0};
+    /// Registered settings by their path
+    std::unordered_map<std::string,
+                       std::weak_ptr<pajlada::Settings::SettingData>>
+        journaledSettings_;
+    /// Paths of settings changed since the last journal write
+    std::set<std::string> changedSettings_;
+    std::mutex changedSettingsMutex_;
+
     pajlada::Signals::SignalHolder signalHolder;
 };
 
@@ -6,6 +6,7 @@
 #include "providers/twitch/TwitchIrcServer.hpp"
 #include "singletons/Settings.hpp"
 #include "util/PostToThread.hpp"
+#include "util/ProcessScanner.hpp"
 
 #include <QAbstractEventDispatcher>
 #include <QDebug>
@@ -50,7 +51,11 @@ const QStringList &broadcastingBinaries()
 
 bool isBroadcasterSoftwareActive()
 {
-#if defined(Q_OS_LINUX) || defined(Q_OS_MACOS)
+#if defined(Q_OS_LINUX)
+    // Only called from the StreamerMode thread
+    static ProcessScanner scanner(broadcastingBinaries());
+    return scanner.isAnyRunning();
+#elif defined(Q_OS_MACOS)
     static bool shouldShowTimeoutWarning = true;
     static bool shouldShowWarning = true;
 
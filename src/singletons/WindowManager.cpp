@@ -9,6 +9,7 @@
 #include "singletons/Paths.hpp"
 #include "singletons/Settings.hpp"
 #include "singletons/Theme.hpp"
+#include "util/AsyncFileWriter.hpp"
 #include "util/CombinePath.hpp"
 #include "util/FilesystemHelpers.hpp"
 #include "util/SignalListener.hpp"
@@ -24,6 +25,7 @@
 
 #include <pajlada/settings/backup.hpp>
 #include <QDebug>
+#include <QElapsedTimer>
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QJsonObject>
@@ -428,7 +430,13 @@ void WindowManager::initialize()
 
         this->emotePopupBounds_ = windowLayout.emotePopupBounds_;
 
+        QElapsedTimer timer;
+        timer.start();
         this->applyWindowLayout(windowLayout);
+        qCDebug(chatterinoWindowmanager)
+            << "Restored window layout in" << timer.elapsed() << "ms"
+            << "(lazy channel activation:"
+            << getSettings()->lazyChannelActivation.getValue() << ")";
     }
 
     if (getApp()->getArgs().isFramelessEmbed)
@@ -536,34 +544,39 @@ void WindowManager::save()
     obj.insert("windows", windowArr);
     document.setObject(obj);
 
-    // save file
-    std::error_code ec;
-    pajlada::Settings::Backup::saveWithBackup(
-        qStringToStdPath(this->windowLayoutFilePath),
-        {.enabled = true, .numSlots = 9},
-        [&](const auto &path, auto &ec) {
-            QSaveFile file(stdPathToQString(path));
-            if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
-            {
-                ec = std::make_error_code(std::errc::io_error);
-                return;
-            }
+    // Serializing and writing the file happens on the writer thread. Only
+    // the newest layout matters, so queued saves are replaced.
+    AsyncFileWriter::instance().post(
+        [filePath = this->windowLayoutFilePath,
+         document = std::move(document)] {
+            std::error_code ec;
+            pajlada::Settings::Backup::saveWithBackup(
+                qStringToStdPath(filePath), {.enabled = true, .numSlots = 9},
+                [&](const auto &path, auto &ec) {
+                    QSaveFile file(stdPathToQString(path));
+                    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+                    {
+                        ec = std::make_error_code(std::errc::io_error);
+                        return;
+                    }
+
+                    file.write(document.toJson(QJsonDocument::Indented));
+                    if (!file.commit() || file.error() != QFile::NoError)
+                    {
+                        ec = std::make_error_code(std::errc::io_error);
+                    }
+                },
+                ec);
 
-            file.write(document.toJson(QJsonDocument::Indented));
-            if (!file.commit() || file.error() != QFile::NoError)
+            if (ec)
             {
-                ec = std::make_error_code(std::errc::io_error);
+                // TODO(Qt 6.5): drop fromStdString
+                qCWarning(chatterinoWindowmanager)
+                    << "Failed to save windowlayout"
+                    << QString::fromStdString(ec.message());
             }
         },
-        ec);
-
-    if (ec)
-    {
-        // TODO(Qt 6.5): drop fromStdString
-        qCWarning(chatterinoWindowmanager)
-            << "Failed to save windowlayout"
-            << QString::fromStdString(ec.message());
-    }
+        this->windowLayoutFilePath);
 }
 
 void WindowManager::sendAlert()
@@ -0,0 +1,659 @@
+#include "singletons/helper/LogSearch.hpp"
+
+#include "common/QLogging.hpp"
+
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+#include <QtEndian>
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <unordered_map>
+
+namespace {
+
+using namespace chatterino;
+
+/// Shorter words aren't indexed and can't narrow down a search
+constexpr qsizetype MIN_WORD_LENGTH = 2;
+/// Longer words are truncated (lookups are by prefix anyways)
+constexpr qsizetype MAX_WORD_LENGTH = 32;
+
+// File layout (all integers are little endian):
+//   header:    magic, u32 version, u64 log size, u32 word count, u32 padding
+//   directory: per word (sorted by UTF-8 bytes):
+//              u32 word offset, u32 word length, u32 postings offset,
+//              u32 postings count
+//   words:     UTF-8, padded to 4 bytes
+//   postings:  u32 line offsets
+constexpr QByteArrayView INDEX_MAGIC = "C2LI";
+constexpr uint32_t INDEX_VERSION = 1;
+constexpr qsizetype HEADER_SIZE = 24;
+constexpr qsizetype ENTRY_SIZE = 16;
+
+struct LiveIndices {
+    std::mutex mutex;
+    std::unordered_map<QString, std::shared_ptr<LiveLogIndex>> indices;
+};
+
+LiveIndices &liveIndices()
+{
+    static LiveIndices instance;
+    return instance;
+}
+
+/// LoggingChannel and searches might use different separators
+QString liveIndexKey(const QString &logPath)
+{
+    return QDir::cleanPath(logPath);
+}
+
+std::shared_ptr<LiveLogIndex> findLiveIndex(const QString &logPath)
+{
+    auto &live = liveIndices();
+    std::lock_guard lock(live.mutex);
+    auto it = live.indices.find(liveIndexKey(logPath));
+    if (it == live.indices.end())
+    {
+        return nullptr;
+    }
+    return it->second;
+}
+
+/// Held while an index file is opened or (re-)built, so concurrent searches
+/// don't build the same index
+std::mutex &indexBuildMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+/// Held while an index file is written
+std::mutex &indexWriteMutex()
+{
+    static std::mutex mutex;
+    return mutex;
+}
+
+struct ParsedLine {
+    bool valid = false;
+    QStringView time;
+    QStringView login;
+    QStringView content;
+};
+
+/// Splits a line written by LoggingChannel into its author and content
+ParsedLine parseLine(QStringView line)
+{
+    // "# Start logging at ..." and "# Stop logging at ..."
+    if (line.startsWith(u"# "))
+    {
+        return {};
+    }
+
+    // Mention and AutoMod logs prefix lines with the channel ("#channel ")
+    if (line.startsWith(u'#'))
+    {
+        auto space = line.indexOf(u' ');
+        if (space < 0)
+        {
+            return {};
+        }
+        line = line.mid(space + 1);
+    }
+
+    if (!line.startsWith(u'['))
+    {
+        return {};
+    }
+    auto timeEnd = line.indexOf(u"] ");
+    if (timeEnd < 0)
+    {
+        return {};
+    }
+
+    ParsedLine parsed{
+        .valid = true,
+        .time = line.mid(1, timeEnd - 1),
+        .login = {},
+        .content = line.mid(timeEnd + 2),
+    };
+
+    // User messages are "login: text" or "Display login: text"
+    auto colon = parsed.content.indexOf(u": ");
+    if (colon > 0)
+    {
+        auto author = parsed.content.left(colon);
+        if (author.count(u' ') <= 1)
+        {
+            parsed.login = author.mid(author.lastIndexOf(u' ') + 1);
+        }
+    }
+
+    return parsed;
+}
+
+template <typename F>
+void forEachWord(QStringView text, F &&fn)
+{
+    qsizetype start = -1;
+    for (qsizetype i = 0; i <= text.size(); i++)
+    {
+        if (i < text.size() && text[i].isLetterOrNumber())
+        {
+            if (start < 0)
+            {
+                start = i;
+            }
+            continue;
+        }
+
+        if (start >= 0 && i - start >= MIN_WORD_LENGTH)
+        {
+            fn(text.mid(start, std::min(i - start, MAX_WORD_LENGTH)));
+        }
+        start = -1;
+    }
+}
+
+QByteArray wordKey(QStringView word)
+{
+    return word.toString().toCaseFolded().toUtf8();
+}
+
+QByteArray userKey(QStringView login)
+{
+    return '@' + login.toString().toLower().toUtf8();
+}
+
+/// Read-only view of an index written by LogIndexBuilder::write
+class LogIndexReader
+{
+public:
+    bool open(const QString &path, qint64 logSize)
+    {
+        this->file_.setFileName(path);
+        if (!this->file_.open(QFile::ReadOnly) ||
+            this->file_.size() < HEADER_SIZE)
+        {
+            return false;
+        }
+
+        this->size_ = this->file_.size();
+        this->data_ = this->file_.map(0, this->size_);
+        if (this->data_ == nullptr)
+        {
+            return false;
+        }
+
+        if (QByteArrayView(this->data_, INDEX_MAGIC.size()) != INDEX_MAGIC ||
+            this->u32(4) != INDEX_VERSION ||
+            qFromLittleEndian<quint64>(this->data_ + 8) !=
+                static_cast<quint64>(logSize))
+        {
+            return false;
+        }
+
+        this->count_ = this->u32(16);
+        return HEADER_SIZE + ENTRY_SIZE * qsizetype{this->count_} <=
+               this->size_;
+    }
+
+    std::vector<uint32_t> lookupPrefix(const QByteArray &prefix) const
+    {
+        // binary search for the first word not less than the prefix
+        uint32_t lo = 0;
+        uint32_t hi = this->count_;
+        while (lo < hi)
+        {
+            auto mid = lo + ((hi - lo) / 2);
+            if (this->wordAt(mid).compare(prefix) < 0)
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+
+        std::vector<uint32_t> offsets;
+        for (auto i = lo;
+             i < this->count_ && this->wordAt(i).startsWith(prefix); i++)
+        {
+            auto entry = HEADER_SIZE + ENTRY_SIZE * qsizetype{i};
+            qsizetype start = this->u32(entry + 8);
+            qsizetype count = this->u32(entry + 12);
+            if (start + (count * 4) > this->size_)
+            {
+                continue;
+            }
+            for (qsizetype j = 0; j < count; j++)
+            {
+                offsets.push_back(this->u32(start + (j * 4)));
+            }
+        }
+        return offsets;
+    }
+
+private:
+    uint32_t u32(qsizetype pos) const
+    {
+        return qFromLittleEndian<quint32>(this->data_ + pos);
+    }
+
+    QByteArrayView wordAt(uint32_t i) const
+    {
+        auto entry = HEADER_SIZE + ENTRY_SIZE * qsizetype{i};
+        qsizetype start = this->u32(entry);
+        qsizetype length = this->u32(entry + 4);
+        if (start + length > this->size_)
+        {
+            return {};
+        }
+        return {this->data_ + start, length};
+    }
+
+    QFile file_;
+    const uchar *data_ = nullptr;
+    qsizetype size_ = 0;
+    uint32_t count_ = 0;
+};
+
+/// Returns the sorted offsets of all lines that contain every key (as a
+/// prefix of one of their words).
+template <typename Index>
+std::vector<uint32_t> lookupAll(const Index &index,
+                                const std::vector<QByteArray> &keys)
+{
+    std::vector<std::vector<uint32_t>> lists;
+    lists.reserve(keys.size());
+    for (const auto &key : keys)
+    {
+        auto offsets = index.lookupPrefix(key);
+        if (offsets.empty())
+        {
+            return {};
+        }
+        std::sort(offsets.begin(), offsets.end());
+        offsets.erase(std::unique(offsets.begin(), offsets.end()),
+                      offsets.end());
+        lists.emplace_back(std::move(offsets));
+    }
+
+    std::sort(lists.begin(), lists.end(), [](const auto &a, const auto &b) {
+        return a.size() < b.size();
+    });
+
+    auto result = std::move(lists.front());
+    for (size_t i = 1; i < lists.size() && !result.empty(); i++)
+    {
+        std::vector<uint32_t> next;
+        std::set_intersection(result.begin(), result.end(), lists[i].begin(),
+                              lists[i].end(), std::back_inserter(next));
+        result = std::move(next);
+    }
+    return result;
+}
+
+/// Checks @a parsed the same way the index is searched: every word key has
+/// to be a prefix of one of the line's words.
+bool lineMatches(const ParsedLine &parsed, const LogSearchQuery &query,
+                 const std::vector<QByteArray> &wordKeys)
+{
+    if (!parsed.valid)
+    {
+        return false;
+    }
+
+    if (!query.user.isEmpty() &&
+        parsed.login.compare(query.user, Qt::CaseInsensitive) != 0)
+    {
+        return false;
+    }
+
+    if (wordKeys.empty())
+    {
+        return true;
+    }
+
+    std::vector<QByteArray> lineWords;
+    forEachWord(parsed.content, [&](QStringView word) {
+        lineWords.emplace_back(wordKey(word));
+    });
+    return std::ranges::all_of(wordKeys, [&](const auto &key) {
+        return std::ranges::any_of(lineWords, [&](const auto &word) {
+            return word.startsWith(key);
+        });
+    });
+}
+
+/// Returns the matching lines of the log file at @a logPath in order
+std::vector<LogSearchResult> searchFile(
+    const QString &logPath, QDate date, const std::vector<QByteArray> &keys,
+    const std::vector<QByteArray> &wordKeys, const LogSearchQuery &query)
+{
+    QFile log(logPath);
+    if (!log.open(QFile::ReadOnly))
+    {
+        return {};
+    }
+
+    // Mapping avoids copying files of which only a few lines are read
+    QByteArray contents;
+    QByteArrayView data;
+    auto logSize = log.size();
+    if (const auto *mapped = log.map(0, logSize))
+    {
+        data = {mapped, logSize};
+    }
+    else
+    {
+        contents = log.readAll();
+        data = contents;
+    }
+
+    std::optional<std::vector<uint32_t>> candidates;
+    // Lines after this aren't in the index and are checked one by one
+    qsizetype indexedSize = data.size();
+    if (!keys.empty() && logSize <= std::numeric_limits<uint32_t>::max())
+    {
+        if (auto live = findLiveIndex(logPath))
+        {
+            // The file is still being written to, so an index file would be
+            // outdated right away
+            std::unique_lock lock(live->mutex);
+            if (live->complete)
+            {
+                candidates = lookupAll(live->builder, keys);
+                indexedSize = std::min<qsizetype>(live->logSize, data.size());
+            }
+            else
+            {
+                lock.unlock();
+                LogIndexBuilder builder;
+                builder.addLines(data.toByteArray());
+                candidates = lookupAll(builder, keys);
+            }
+        }
+        else
+        {
+            std::lock_guard lock(indexBuildMutex());
+            auto indexPath = indexPathFor(logPath);
+            LogIndexReader reader;
+            if (reader.open(indexPath, logSize))
+            {
+                candidates = lookupAll(reader, keys);
+            }
+            else
+            {
+                LogIndexBuilder builder;
+                builder.addLines(data.toByteArray());
+                if (!builder.write(indexPath, logSize))
+                {
+                    qCDebug(chatterinoHelper)
+                        << "Failed to write log index" << indexPath;
+                }
+                candidates = lookupAll(builder, keys);
+            }
+        }
+    }
+
+    std::vector<LogSearchResult> results;
+    auto checkLine = [&](qsizetype start) {
+        auto end = data.indexOf('\n', start);
+        if (end < 0)
+        {
+            end = data.size();
+        }
+        auto line = QString::fromUtf8(data.sliced(start, end - start));
+        auto parsed = parseLine(line);
+        if (lineMatches(parsed, query, wordKeys))
+        {
+            auto time = QTime::fromString(parsed.time.toString(), "HH:mm:ss");
+            results.push_back({
+                .time = QDateTime(date, time),
+                .text = parsed.content.toString(),
+            });
+        }
+        return end + 1;
+    };
+
+    qsizetype pos = 0;
+    if (candidates)
+    {
+        for (auto offset : *candidates)
+        {
+            if (offset < indexedSize)
+            {
+                checkLine(offset);
+            }
+        }
+        pos = indexedSize;
+    }
+    while (pos < data.size())
+    {
+        pos = checkLine(pos);
+    }
+
+    return results;
+}
+
+}  // namespace
+
+namespace chatterino {
+
+void LogIndexBuilder::addLine(uint32_t offset, QStringView line)
+{
+    auto parsed = parseLine(line);
+    if (!parsed.valid)
+    {
+        return;
+    }
+
+    auto add = [&](QByteArray key) {
+        auto &offsets = this->postings_[std::move(key)];
+        if (offsets.empty() || offsets.back() != offset)
+        {
+            offsets.push_back(offset);
+        }
+    };
+
+    forEachWord(parsed.content, [&](QStringView word) {
+        add(wordKey(word));
+    });
+    if (!parsed.login.isEmpty())
+    {
+        add(userKey(parsed.login));
+    }
+}
+
+void LogIndexBuilder::addLines(const QByteArray &logData)
+{
+    if (logData.size() > std::numeric_limits<uint32_t>::max())
+    {
+        return;
+    }
+
+    for (qsizetype pos = 0; pos < logData.size();)
+    {
+        auto end = logData.indexOf('\n', pos);
+        if (end < 0)
+        {
+            end = logData.size();
+        }
+        this->addLine(static_cast<uint32_t>(pos),
+                      QString::fromUtf8(logData.sliced(pos, end - pos)));
+        pos = end + 1;
+    }
+}
+
+bool LogIndexBuilder::write(const QString &indexPath, qint64 logSize) const
+{
+    qsizetype wordsSize = 0;
+    qsizetype postingsSize = 0;
+    for (const auto &[word, offsets] : this->postings_)
+    {
+        wordsSize += word.size();
+        postingsSize += static_cast<qsizetype>(offsets.size()) * 4;
+    }
+    wordsSize = (wordsSize + 3) & ~qsizetype{3};
+
+    auto directoryStart = HEADER_SIZE;
+    auto wordsStart =
+        directoryStart +
+        (ENTRY_SIZE * static_cast<qsizetype>(this->postings_.size()));
+    auto postingsStart = wordsStart + wordsSize;
+    auto totalSize = postingsStart + postingsSize;
+    if (totalSize > std::numeric_limits<uint32_t>::max())
+    {
+        return false;
+    }
+
+    QByteArray out(totalSize, '\0');
+    auto *data = reinterpret_cast<uchar *>(out.data());
+    auto putU32 = [&](qsizetype pos, qsizetype value) {
+        qToLittleEndian(static_cast<quint32>(value), data + pos);
+    };
+
+    std::copy(INDEX_MAGIC.begin(), INDEX_MAGIC.end(), out.begin());
+    putU32(4, INDEX_VERSION);
+    qToLittleEndian(static_cast<quint64>(logSize), data + 8);
+    putU32(16, static_cast<qsizetype>(this->postings_.size()));
+
+    auto entry = directoryStart;
+    auto wordPos = wordsStart;
+    auto postingPos = postingsStart;
+    for (const auto &[word, offsets] : this->postings_)
+    {
+        putU32(entry, wordPos);
+        putU32(entry + 4, word.size());
+        putU32(entry + 8, postingPos);
+        putU32(entry + 12, static_cast<qsizetype>(offsets.size()));
+        entry += ENTRY_SIZE;
+
+        std::copy(word.begin(), word.end(), out.begin() + wordPos);
+        wordPos += word.size();
+
+        for (auto offset : offsets)
+        {
+            putU32(postingPos, offset);
+            postingPos += 4;
+        }
+    }
+
+    std::lock_guard lock(indexWriteMutex());
+    QSaveFile file(indexPath);
+    if (!file.open(QFile::WriteOnly) || file.write(out) != out.size())
+    {
+        return false;
+    }
+    return file.commit();
+}
+
+std::vector<uint32_t> LogIndexBuilder::lookupPrefix(
+    const QByteArray &prefix) const
+{
+    std::vector<uint32_t> offsets;
+    for (auto it = this->postings_.lower_bound(prefix);
+         it != this->postings_.end() && it->first.startsWith(prefix); ++it)
+    {
+        offsets.insert(offsets.end(), it->second.begin(), it->second.end());
+    }
+    return offsets;
+}
+
+QString indexPathFor(const QString &logPath)
+{
+    return logPath + ".idx";
+}
+
+void registerLiveIndex(const QString &logPath,
+                       std::shared_ptr<LiveLogIndex> index)
+{
+    auto &live = liveIndices();
+    std::lock_guard lock(live.mutex);
+    live.indices[liveIndexKey(logPath)] = std::move(index);
+}
+
+void unregisterLiveIndex(const QString &logPath)
+{
+    auto &live = liveIndices();
+    std::lock_guard lock(live.mutex);
+    live.indices.erase(liveIndexKey(logPath));
+}
+
+std::vector<LogSearchResult> searchLogs(
+    const QString &directory, const QString &channelName,
+    const LogSearchQuery &query, const std::function<bool()> &isCancelled)
+{
+    std::vector<QByteArray> wordKeys;
+    for (const auto &word : query.words)
+    {
+        forEachWord(word, [&](QStringView part) {
+            wordKeys.emplace_back(wordKey(part));
+        });
+    }
+    auto keys = wordKeys;
+    if (!query.user.isEmpty())
+    {
+        keys.emplace_back(userKey(query.user));
+    }
+
+    // Daily logs are named "<channel>-yyyy-MM-dd.log". Going from newest to
+    // oldest lets us stop as soon as we have enough results.
+    // Special channels (e.g. "/mentions") are logged without their slash,
+    // since LoggingChannel appends their name to the directory.
+    auto prefix =
+        (channelName.startsWith('/') ? channelName.mid(1) : channelName) + '-';
+    auto files = QDir(directory).entryList({prefix + "*.log"}, QDir::Files,
+                                           QDir::Name | QDir::Reversed);
+
+    std::vector<std::vector<LogSearchResult>> perFile;
+    size_t nResults = 0;
+    for (const auto &fileName : files)
+    {
+        if (isCancelled && isCancelled())
+        {
+            return {};
+        }
+        if (nResults >= query.limit)
+        {
+            break;
+        }
+
+        auto date = QDate::fromString(
+            fileName.mid(prefix.size(), fileName.size() - prefix.size() - 4),
+            "yyyy-MM-dd");
+        if (!date.isValid())
+        {
+            // stream logs ("<channel>-<stream-id>.log") duplicate daily logs
+            continue;
+        }
+        if ((query.from.isValid() && date < query.from) ||
+            (query.to.isValid() && date > query.to))
+        {
+            continue;
+        }
+
+        auto results = searchFile(directory + '/' + fileName, date, keys,
+                                  wordKeys, query);
+        auto take = std::min(results.size(), query.limit - nResults);
+        results.erase(results.begin(),
+                      results.end() - static_cast<ptrdiff_t>(take));
+        nResults += take;
+        perFile.emplace_back(std::move(results));
+    }
+
+    std::vector<LogSearchResult> results;
+    results.reserve(nResults);
+    for (auto it = perFile.rbegin(); it != perFile.rend(); ++it)
+    {
+        std::move(it->begin(), it->end(), std::back_inserter(results));
+    }
+    return results;
+}
+
+}  // namespace chatterino
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <QByteArray>
+#include <QDate>
+#include <QDateTime>
+#include <QString>
+#include <QStringList>
+#include <QStringView>
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace chatterino {
+
+/// @brief Collects the inverted index of a single log file
+///
+/// Every line is split into case-folded words which map to the byte offsets
+/// of the lines containing them. The author of a line is stored as the word
+/// `@login`. Indices are stored next to the log file (see #indexPathFor).
+class LogIndexBuilder
+{
+public:
+    /// Adds the line starting at @a offset in the log file.
+    ///
+    /// Offsets must be added in increasing order.
+    void addLine(uint32_t offset, QStringView line);
+
+    /// Indexes all lines of @a logData
+    void addLines(const QByteArray &logData);
+
+    /// Writes the index for a log file of @a logSize bytes to @a indexPath.
+    bool write(const QString &indexPath, qint64 logSize) const;
+
+    /// Sorted offsets of all lines containing a word starting with @a prefix
+    std::vector<uint32_t> lookupPrefix(const QByteArray &prefix) const;
+
+private:
+    std::map<QByteArray, std::vector<uint32_t>> postings_;
+};
+
+/// @brief The index of a log file that's still being written to
+///
+/// LoggingChannel adds every line it writes, so searches don't have to
+/// re-index the file (see #registerLiveIndex).
+struct LiveLogIndex {
+    std::mutex mutex;
+    LogIndexBuilder builder;
+    /// Size of the log file after the last added line
+    qint64 logSize = 0;
+    /// False if the file contains lines that weren't added
+    bool complete = false;
+};
+
+/// Makes searches use @a index for the log file at @a logPath instead of
+/// reading (and writing) its index file.
+void registerLiveIndex(const QString &logPath,
+                       std::shared_ptr<LiveLogIndex> index);
+
+/// Removes the live index of the log file at @a logPath
+void unregisterLiveIndex(const QString &logPath);
+
+struct LogSearchQuery {
+    /// Login name of the author (case-insensitive). Empty matches all lines.
+    QString user;
+    /// Every word has to be the prefix of a word in the line
+    /// (case-insensitive). Words are split at non-alphanumeric characters and
+    /// parts shorter than two characters are ignored.
+    QStringList words;
+    /// Inclusive date range. Invalid dates don't limit the range.
+    QDate from;
+    QDate to;
+    /// Maximum number of results. The newest results are kept.
+    size_t limit = 1000;
+};
+
+struct LogSearchResult {
+    /// Local time the line was logged at
+    QDateTime time;
+    /// The logged line without its timestamp
+    QString text;
+};
+
+/// Returns the path of the index belonging to the log file at @a logPath
+QString indexPathFor(const QString &logPath);
+
+/// @brief Searches the daily logs of @a channelName in @a directory
+///
+/// Special channels like `/mentions` are searched by their name too.
+///
+/// Indices that are missing or out of date are (re-)built and saved, so only
+/// the first search over older logs has to read them completely. Files that
+/// are still being written to use their live index instead.
+///
+/// This does blocking I/O and should not be called from the GUI thread.
+///
+/// @param isCancelled  checked before every file, the search stops early and
+///                     returns no results once it returns true
+/// @returns the matching lines ordered from oldest to newest
+std::vector<LogSearchResult> searchLogs(
+    const QString &directory, const QString &channelName,
+    const LogSearchQuery &query,
+    const std::function<bool()> &isCancelled = {});
+
+}  // namespace chatterino
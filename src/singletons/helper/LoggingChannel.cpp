@@ -10,6 +10,8 @@
 #include <QDateTime>
 #include <QDir>
 
+#include <limits>
+
 namespace {
 
 const QByteArray ENDLINE("\n");
@@ -52,40 +54,46 @@ QString generateDateString(const QDateTime &now)
     return now.toString("yyyy-MM-dd");
 }
 
-}  // namespace
-
-namespace chatterino {
-
-LoggingChannel::LoggingChannel(QString _channelName, QString _platform)
-    : channelName(std::move(_channelName))
-    , platform(std::move(_platform))
+QString generateSubDirectory(const QString &channelName,
+                             const QString &platform)
 {
-    if (this->channelName.startsWith("/whispers"))
+    QString subDirectory;
+    if (channelName.startsWith("/whispers"))
     {
-        this->subDirectory = "Whispers";
+        subDirectory = "Whispers";
     }
     else if (channelName.startsWith("/mentions"))
     {
-        this->subDirectory = "Mentions";
+        subDirectory = "Mentions";
     }
     else if (channelName.startsWith("/live"))
     {
-        this->subDirectory = "Live";
+        subDirectory = "Live";
     }
     else if (channelName.startsWith("/automod"))
     {
-        this->subDirectory = "AutoMod";
+        subDirectory = "AutoMod";
     }
     else
     {
-        this->subDirectory =
+        subDirectory =
             QStringLiteral("Channels") + QDir::separator() + channelName;
     }
 
     // enforce capitalized platform names
-    this->subDirectory = platform[0].toUpper() + platform.mid(1).toLower() +
-                         QDir::separator() + this->subDirectory;
+    return platform[0].toUpper() + platform.mid(1).toLower() +
+           QDir::separator() + subDirectory;
+}
+
+}  // namespace
+
+namespace chatterino {
 
+LoggingChannel::LoggingChannel(QString _channelName, QString _platform)
+    : channelName(std::move(_channelName))
+    , platform(std::move(_platform))
+    , subDirectory(generateSubDirectory(this->channelName, this->platform))
+{
     getSettings()->logPath.connect([this](const QString &logPath, auto) {
         this->baseDirectory = logPath.isEmpty()
                                   ? getApp()->getPaths().messageLogDirectory
@@ -97,6 +105,8 @@ LoggingChannel::LoggingChannel(QString _channelName, QString _platform)
 LoggingChannel::~LoggingChannel()
 {
     appendLine(this->fileHandle, generateClosingString());
+    this->writeIndex();
+    unregisterLiveIndex(this->fileHandle.fileName());
     this->fileHandle.close();
     this->currentStreamFileHandle.close();
 }
@@ -109,8 +119,11 @@ void LoggingChannel::openLogFile()
     if (this->fileHandle.isOpen())
     {
         this->fileHandle.flush();
+        this->writeIndex();
+        unregisterLiveIndex(this->fileHandle.fileName());
         this->fileHandle.close();
     }
+    this->liveIndex = std::make_shared<LiveLogIndex>();
 
     QString baseFileName = this->channelName + "-" + this->dateString + ".log";
 
@@ -129,8 +142,12 @@ void LoggingChannel::openLogFile()
     this->fileHandle.setFileName(fileName);
 
     this->fileHandle.open(QIODevice::Append);
+    // Lines written before we opened the file aren't in our index
+    this->liveIndex->complete = this->fileHandle.size() == 0;
 
     appendLine(this->fileHandle, generateOpeningString(now));
+    this->liveIndex->logSize = this->fileHandle.size();
+    registerLiveIndex(this->fileHandle.fileName(), this->liveIndex);
 }
 
 void LoggingChannel::openStreamLogFile(const QString &streamID)
@@ -230,7 +247,21 @@ void LoggingChannel::addMessage(const MessagePtr &message,
     str.append(messageText);
     str.append(ENDLINE);
 
+    auto offset = this->fileHandle.size();
     appendLine(this->fileHandle, str);
+    {
+        std::lock_guard lock(this->liveIndex->mutex);
+        if (offset > std::numeric_limits<uint32_t>::max())
+        {
+            this->liveIndex->complete = false;
+        }
+        else if (this->liveIndex->complete)
+        {
+            this->liveIndex->builder.addLine(static_cast<uint32_t>(offset),
+                                             str);
+        }
+        this->liveIndex->logSize = this->fileHandle.size();
+    }
 
     if (!streamID.isEmpty() && getSettings()->separatelyStoreStreamLogs)
     {
@@ -243,4 +274,34 @@ void LoggingChannel::addMessage(const MessagePtr &message,
     }
 }
 
+QString LoggingChannel::logDirectory(const QString &channelName,
+                                     const QString &platform)
+{
+    const QString &logPath = getSettings()->logPath;
+    auto baseDirectory =
+        logPath.isEmpty() ? getApp()->getPaths().messageLogDirectory : logPath;
+    return baseDirectory + QDir::separator() +
+           generateSubDirectory(channelName, platform);
+}
+
+void LoggingChannel::writeIndex()
+{
+    if (!this->fileHandle.isOpen())
+    {
+        return;
+    }
+
+    std::lock_guard lock(this->liveIndex->mutex);
+    if (!this->liveIndex->complete)
+    {
+        return;
+    }
+
+    auto indexPath = indexPathFor(this->fileHandle.fileName());
+    if (!this->liveIndex->builder.write(indexPath, this->fileHandle.size()))
+    {
+        qCDebug(chatterinoHelper) << "Failed to write log index" << indexPath;
+    }
+}
+
 }  // namespace chatterino
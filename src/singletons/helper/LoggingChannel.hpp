@@ -1,5 +1,7 @@
 #pragma once
 
+#include "singletons/helper/LogSearch.hpp"
+
 #include <QFile>
 #include <QString>
 
@@ -26,9 +28,14 @@ public:
 
     void addMessage(const MessagePtr &message, const QString &streamID);
 
+    /// Returns the directory the logs of @a channelName are written to
+    static QString logDirectory(const QString &channelName,
+                                const QString &platform);
+
 private:
     void openLogFile();
     void openStreamLogFile(const QString &streamID);
+    void writeIndex();
 
     const QString channelName;
     const QString platform;
@@ -41,6 +48,11 @@ private:
 
     QString dateString;
 
+    /// Index of the current daily log file, used by searches while it's open.
+    /// Only complete (and written) if the file was created by us, otherwise
+    /// it's built when it's searched.
+    std::shared_ptr<LiveLogIndex> liveIndex;
+
     friend class Logging;
 };
 
@@ -0,0 +1,208 @@
+#include "singletons/helper/SettingsJournal.hpp"
+
+#include "common/QLogging.hpp"
+#include "util/AsyncFileWriter.hpp"
+
+#include <QFile>
+#include <QSaveFile>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <utility>
+
+namespace {
+
+/// Entries written before generations existed belong to generation 0
+int64_t generationOf(const rapidjson::Document &entry)
+{
+    if (entry.HasMember("generation") && entry["generation"].IsInt64())
+    {
+        return entry["generation"].GetInt64();
+    }
+    return 0;
+}
+
+}  // namespace
+
+namespace chatterino {
+
+SettingsJournal::SettingsJournal(QString path)
+    : path_(std::move(path))
+{
+    QFile file(this->path_);
+    if (!file.exists() || !file.open(QIODevice::ReadWrite))
+    {
+        return;
+    }
+
+    // We might have crashed while appending the last entry
+    auto contents = file.readAll();
+    auto end = contents.lastIndexOf('\n') + 1;
+    if (end < contents.size())
+    {
+        qCWarning(chatterinoSettings)
+            << "Dropping incomplete entry from the settings journal";
+        file.resize(end);
+    }
+    this->size_ = end;
+}
+
+QByteArray SettingsJournal::encode(const std::string &path,
+                                   const rapidjson::Value &value,
+                                   int64_t generation)
+{
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+
+    writer.StartObject();
+    writer.Key("generation");
+    writer.Int64(generation);
+    writer.Key("path");
+    writer.String(path.c_str(), static_cast<rapidjson::SizeType>(path.size()));
+    writer.Key("value");
+    value.Accept(writer);
+    writer.EndObject();
+
+    QByteArray entry(buffer.GetString(),
+                     static_cast<qsizetype>(buffer.GetSize()));
+    entry.append('\n');
+    return entry;
+}
+
+void SettingsJournal::append(QByteArray entries)
+{
+    if (entries.isEmpty())
+    {
+        return;
+    }
+
+    this->size_ += entries.size();
+    AsyncFileWriter::instance().post(
+        [path = this->path_, entries = std::move(entries)] {
+            QFile file(path);
+            if (!file.open(QIODevice::WriteOnly | QIODevice::Append))
+            {
+                qCWarning(chatterinoSettings)
+                    << "Failed to open settings journal" << path
+                    << file.errorString();
+                return;
+            }
+
+            auto previousSize = file.size();
+            if (file.write(entries) != entries.size() || !file.flush())
+            {
+                qCWarning(chatterinoSettings)
+                    << "Failed to write settings journal" << path
+                    << file.errorString();
+                file.resize(previousSize);
+            }
+        });
+}
+
+void SettingsJournal::removeOlderThan(int64_t minGeneration)
+{
+    QFile file(this->path_);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return;
+    }
+    auto contents = file.readAll();
+    file.close();
+
+    QByteArray kept;
+    for (const auto &line : contents.split('\n'))
+    {
+        if (line.isEmpty())
+        {
+            continue;
+        }
+
+        rapidjson::Document entry;
+        entry.Parse(line.constData(), static_cast<size_t>(line.size()));
+        if (entry.HasParseError() || !entry.IsObject() ||
+            generationOf(entry) < minGeneration)
+        {
+            continue;
+        }
+        kept += line;
+        kept += '\n';
+    }
+
+    if (kept.isEmpty())
+    {
+        if (!QFile::remove(this->path_))
+        {
+            qCWarning(chatterinoSettings)
+                << "Failed to remove settings journal" << this->path_;
+            return;
+        }
+    }
+    else
+    {
+        QSaveFile out(this->path_);
+        if (!out.open(QIODevice::WriteOnly) ||
+            out.write(kept) != kept.size() || !out.commit())
+        {
+            qCWarning(chatterinoSettings)
+                << "Failed to compact settings journal" << this->path_
+                << out.errorString();
+            return;
+        }
+    }
+
+    // Entries that are still queued are part of the size too
+    this->size_ += kept.size() - contents.size();
+}
+
+size_t SettingsJournal::replay(
+    int64_t minGeneration,
+    const std::function<void(const std::string &path,
+                             const rapidjson::Value &value)> &apply) const
+{
+    QFile file(this->path_);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        return 0;
+    }
+
+    size_t applied = 0;
+    auto contents = file.readAll();
+    for (const auto &line : contents.split('\n'))
+    {
+        if (line.isEmpty())
+        {
+            continue;
+        }
+
+        rapidjson::Document entry;
+        entry.Parse(line.constData(), static_cast<size_t>(line.size()));
+        if (entry.HasParseError() || !entry.IsObject() ||
+            !entry.HasMember("path") || !entry["path"].IsString() ||
+            !entry.HasMember("value"))
+        {
+            qCWarning(chatterinoSettings)
+                << "Skipping invalid settings journal entry" << line;
+            continue;
+        }
+
+        if (generationOf(entry) < minGeneration)
+        {
+            // Already contained in settings.json
+            continue;
+        }
+
+        apply(std::string(entry["path"].GetString(),
+                          entry["path"].GetStringLength()),
+              entry["value"]);
+        applied++;
+    }
+
+    return applied;
+}
+
+qint64 SettingsJournal::size() const
+{
+    return this->size_;
+}
+
+}  // namespace chatterino
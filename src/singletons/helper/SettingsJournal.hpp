@@ -0,0 +1,72 @@
+#pragma once
+
+#include <QByteArray>
+#include <QString>
+#include <rapidjson/document.h>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace chatterino {
+
+/// @brief An append-only log of changed settings
+///
+/// Every line is a JSON object
+/// `{"generation": 1, "path": "/some/setting", "value": ...}`.
+/// Replaying the log on top of settings.json restores all changes made since
+/// settings.json was last written. Only the changed settings are appended,
+/// so saving a single change doesn't serialize the whole settings tree.
+///
+/// The generation is increased whenever settings.json is saved, which makes
+/// all previous entries obsolete. They're removed once settings.json was
+/// written, so replaying skips entries of older generations in case we
+/// crashed in between (or the write failed).
+///
+/// Writes happen on the AsyncFileWriter thread.
+class SettingsJournal
+{
+public:
+    /// Once the journal is larger than this, settings.json should be
+    /// rewritten and the journal cleared
+    static constexpr qint64 COMPACT_SIZE = 256 * 1024;
+
+    /// Opens the journal at @a path and drops an incomplete last entry
+    explicit SettingsJournal(QString path);
+
+    /// Serializes the change of a setting to a journal entry
+    static QByteArray encode(const std::string &path,
+                             const rapidjson::Value &value,
+                             int64_t generation = 0);
+
+    /// Queues @a entries (see encode()) to be appended to the journal
+    void append(QByteArray entries);
+
+    /// @brief Removes all entries older than @a minGeneration
+    ///
+    /// This does blocking I/O and is meant to run on the AsyncFileWriter
+    /// thread after settings.json with @a minGeneration was written.
+    void removeOlderThan(int64_t minGeneration);
+
+    /// @brief Calls @a apply for every entry in the journal
+    ///
+    /// Entries older than @a minGeneration are skipped. This reads the file
+    /// directly, so entries that are still queued are skipped too.
+    ///
+    /// @returns The number of applied entries
+    size_t replay(int64_t minGeneration,
+                  const std::function<void(const std::string &path,
+                                           const rapidjson::Value &value)>
+                      &apply) const;
+
+    /// Size of the journal in bytes, including queued entries
+    qint64 size() const;
+
+private:
+    const QString path_;
+    /// Updated from the writer thread by removeOlderThan()
+    std::atomic<qint64> size_ = 0;
+};
+
+}  // namespace chatterino
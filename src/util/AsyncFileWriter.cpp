@@ -0,0 +1,98 @@
+#include "util/AsyncFileWriter.hpp"
+
+#include "util/RenameThread.hpp"
+
+#include <algorithm>
+
+namespace chatterino {
+
+AsyncFileWriter::AsyncFileWriter()
+{
+    this->thread_ = std::make_unique<std::thread>([this] {
+        this->run();
+    });
+    renameThread(*this->thread_, "C2FileWriter");
+}
+
+AsyncFileWriter::~AsyncFileWriter()
+{
+    {
+        std::lock_guard lock(this->mutex_);
+        this->stopping_ = true;
+    }
+    this->jobAvailable_.notify_one();
+    this->thread_->join();
+}
+
+AsyncFileWriter &AsyncFileWriter::instance()
+{
+    static AsyncFileWriter writer;
+    return writer;
+}
+
+void AsyncFileWriter::post(std::function<void()> job, const QString &key)
+{
+    {
+        std::lock_guard lock(this->mutex_);
+        if (!key.isEmpty())
+        {
+            auto it = std::ranges::find(this->queue_, key, &Job::key);
+            if (it != this->queue_.end())
+            {
+                it->run = std::move(job);
+                return;
+            }
+        }
+        this->queue_.push_back({
+            .key = key,
+            .run = std::move(job),
+        });
+    }
+    this->jobAvailable_.notify_one();
+}
+
+void AsyncFileWriter::waitForIdle()
+{
+    std::unique_lock lock(this->mutex_);
+    this->idle_.wait(lock, [this] {
+        return this->queue_.empty() && !this->running_;
+    });
+}
+
+size_t AsyncFileWriter::pending() const
+{
+    std::lock_guard lock(this->mutex_);
+    return this->queue_.size() + (this->running_ ? 1 : 0);
+}
+
+void AsyncFileWriter::run()
+{
+    std::unique_lock lock(this->mutex_);
+    while (true)
+    {
+        this->jobAvailable_.wait(lock, [this] {
+            return !this->queue_.empty() || this->stopping_;
+        });
+        if (this->queue_.empty())
+        {
+            // Only stop once all jobs ran
+            return;
+        }
+
+        auto job = std::move(this->queue_.front());
+        this->queue_.pop_front();
+        this->running_ = true;
+
+        lock.unlock();
+        job.run();
+        lock.lock();
+
+        this->running_ = false;
+        if (this->queue_.empty())
+        {
+            this->idle_.notify_all();
+        }
+    }
+}
+
+}  // namespace chatterino
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <QString>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace chatterino {
+
+/// @brief Runs file writes on a background thread
+///
+/// Saving settings and the window layout used to serialize and write the
+/// files on the GUI thread. Instead, callers should take a cheap copy of the
+/// data on the GUI thread and post a job that serializes and writes it here.
+///
+/// Jobs run one after another in the order they were posted.
+class AsyncFileWriter
+{
+public:
+    AsyncFileWriter();
+    /// Runs all queued jobs before returning
+    ~AsyncFileWriter();
+
+    AsyncFileWriter(const AsyncFileWriter &) = delete;
+    AsyncFileWriter(AsyncFileWriter &&) = delete;
+    AsyncFileWriter &operator=(const AsyncFileWriter &) = delete;
+    AsyncFileWriter &operator=(AsyncFileWriter &&) = delete;
+
+    static AsyncFileWriter &instance();
+
+    /// @brief Queues @a job to run on the writer thread
+    ///
+    /// If @a key isn't empty and a job with the same key is still queued,
+    /// that job is replaced by @a job. This is used for files that are
+    /// completely rewritten, where only the newest contents matter.
+    void post(std::function<void()> job, const QString &key = {});
+
+    /// Blocks until all queued jobs ran
+    void waitForIdle();
+
+    /// Number of jobs that are queued or running
+    size_t pending() const;
+
+private:
+    struct Job {
+        QString key;
+        std::function<void()> run;
+    };
+
+    void run();
+
+    mutable std::mutex mutex_;
+    std::condition_variable jobAvailable_;
+    std::condition_variable idle_;
+    std::deque<Job> queue_;
+    bool running_ = false;
+    bool stopping_ = false;
+
+    std::unique_ptr<std::thread> thread_;
+};
+
+}  // namespace chatterino
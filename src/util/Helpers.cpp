@@ -13,7 +13,6 @@
 #include <QRegularExpression>
 #include <QStringBuilder>
 #include <QStringView>
-#include <QThreadPool>
 #include <QTimeZone>
 #include <QUuid>
 
@@ -393,51 +392,6 @@ void removeLastQS(QString &str)
 #endif
 }
 
-void writeProviderEmotesCache(const QString &id, const QString &provider,
-                              const QByteArray &bytes)
-{
-    QThreadPool::globalInstance()->start([bytes, id, provider]() {
-        auto cacheKey = id % "." % provider;
-        QFile responseCache(getApp()->getPaths().cacheFilePath(cacheKey));
-
-        if (responseCache.open(QIODevice::WriteOnly))
-        {
-            qCDebug(chatterinoCache)
-                << "Saved json response " << id << "." << provider;
-            responseCache.write(qCompress(bytes));
-        }
-    });
-}
-
-bool readProviderEmotesCache(const QString &id, const QString &provider,
-                             const std::function<void(QJsonDocument)> &callback)
-{
-    auto cacheKey = id % "." % provider;
-    QFile responseCache(getApp()->getPaths().cacheFilePath(cacheKey));
-
-    if (responseCache.open(QIODevice::ReadOnly))
-    {
-        QJsonParseError parseError;
-        auto doc = QJsonDocument::fromJson(qUncompress(responseCache.readAll()),
-                                           &parseError);
-
-        if (parseError.error != QJsonParseError::NoError)
-        {
-            qCWarning(chatterinoCache)
-                << "Emote cache " << id << "." << provider
-                << " parsing failed: " << parseError.errorString();
-        }
-
-        qCDebug(chatterinoCache)
-            << "Loaded emote cache: " << id << "." << provider;
-        callback(doc);
-        return true;
-    }
-
-    // If the API call fails, we need to know if loading cached emotes was successful
-    return false;
-}
-
 std::pair<QStringView, QStringView> splitOnce(QStringView haystack,
                                               QStringView needle) noexcept
 {
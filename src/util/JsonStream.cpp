@@ -0,0 +1,112 @@
+#include "util/JsonStream.hpp"
+
+namespace chatterino {
+
+size_t JsonStreamPath::size() const
+{
+    return this->segments_.size();
+}
+
+std::string_view JsonStreamPath::keyAt(size_t depth) const
+{
+    if (depth >= this->segments_.size())
+    {
+        return {};
+    }
+    return this->segments_[depth].key;
+}
+
+int64_t JsonStreamPath::indexAt(size_t depth) const
+{
+    if (depth >= this->segments_.size())
+    {
+        return -1;
+    }
+    return this->segments_[depth].index;
+}
+
+bool JsonStreamPath::matches(std::initializer_list<std::string_view> pattern,
+                             size_t offset) const
+{
+    if (this->segments_.size() != offset + pattern.size())
+    {
+        return false;
+    }
+
+    auto it = this->segments_.begin() + static_cast<ptrdiff_t>(offset);
+    for (auto part : pattern)
+    {
+        if (part != "*" && (it->inArray || it->key != part))
+        {
+            return false;
+        }
+        it++;
+    }
+    return true;
+}
+
+bool JsonStreamValue::isNull() const
+{
+    return std::holds_alternative<std::nullptr_t>(this->value_);
+}
+
+bool JsonStreamValue::isString() const
+{
+    return std::holds_alternative<std::string_view>(this->value_);
+}
+
+bool JsonStreamValue::toBool(bool defaultValue) const
+{
+    if (const auto *b = std::get_if<bool>(&this->value_))
+    {
+        return *b;
+    }
+    return defaultValue;
+}
+
+int64_t JsonStreamValue::toInt(int64_t defaultValue) const
+{
+    if (const auto *i = std::get_if<int64_t>(&this->value_))
+    {
+        return *i;
+    }
+    if (const auto *u = std::get_if<uint64_t>(&this->value_))
+    {
+        return static_cast<int64_t>(*u);
+    }
+    return defaultValue;
+}
+
+double JsonStreamValue::toDouble(double defaultValue) const
+{
+    if (const auto *d = std::get_if<double>(&this->value_))
+    {
+        return *d;
+    }
+    if (const auto *i = std::get_if<int64_t>(&this->value_))
+    {
+        return static_cast<double>(*i);
+    }
+    if (const auto *u = std::get_if<uint64_t>(&this->value_))
+    {
+        return static_cast<double>(*u);
+    }
+    return defaultValue;
+}
+
+std::string_view JsonStreamValue::toStringView() const
+{
+    if (const auto *s = std::get_if<std::string_view>(&this->value_))
+    {
+        return *s;
+    }
+    return {};
+}
+
+QString JsonStreamValue::toString() const
+{
+    auto view = this->toStringView();
+    return QString::fromUtf8(view.data(), static_cast<qsizetype>(view.size()));
+}
+
+}  // namespace chatterino
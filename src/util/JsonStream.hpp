@@ -0,0 +1,213 @@
+#pragma once
+
+#include <QByteArray>
+#include <QString>
+#include <rapidjson/reader.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace chatterino {
+
+/// @brief The location of a value while streaming a JSON document
+///
+/// Each segment is either a key of an object or an index of an array. Keys
+/// point into the document and are only valid during a callback.
+class JsonStreamPath
+{
+public:
+    size_t size() const;
+
+    /// The key at @a depth (empty for array elements)
+    std::string_view keyAt(size_t depth) const;
+
+    /// The index at @a depth (-1 for object members)
+    int64_t indexAt(size_t depth) const;
+
+    /// @brief Checks if the segments starting at @a offset are exactly
+    ///        @a pattern.
+    ///
+    /// A `*` in the pattern matches any key or index. Array elements are only
+    /// matched by `*`.
+    bool matches(std::initializer_list<std::string_view> pattern,
+                 size_t offset = 0) const;
+
+private:
+    struct Segment {
+        std::string_view key;
+        int64_t index = -1;
+        bool inArray = false;
+    };
+
+    std::vector<Segment> segments_;
+
+    template <typename Visitor>
+    friend class JsonStreamHandler;
+};
+
+/// @brief A scalar value of a streamed JSON document
+///
+/// Strings point into the document and are only valid during a callback.
+class JsonStreamValue
+{
+public:
+    using Variant = std::variant<std::nullptr_t, bool, int64_t, uint64_t,
+                                 double, std::string_view>;
+
+    explicit JsonStreamValue(Variant value)
+        : value_(value)
+    {
+    }
+
+    bool isNull() const;
+    bool isString() const;
+
+    bool toBool(bool defaultValue = false) const;
+    int64_t toInt(int64_t defaultValue = 0) const;
+    double toDouble(double defaultValue = 0) const;
+    /// The string or an empty view if this isn't a string
+    std::string_view toStringView() const;
+    QString toString() const;
+
+private:
+    Variant value_;
+};
+
+/// rapidjson SAX handler forwarding values to a visitor (see #streamJson)
+template <typename Visitor>
+class JsonStreamHandler
+{
+public:
+    explicit JsonStreamHandler(Visitor &visitor)
+        : visitor_(visitor)
+    {
+    }
+
+    bool Null()
+    {
+        return this->scalar(nullptr);
+    }
+
+    bool Bool(bool b)
+    {
+        return this->scalar(b);
+    }
+
+    bool Int(int i)
+    {
+        return this->scalar(static_cast<int64_t>(i));
+    }
+
+    bool Uint(unsigned u)
+    {
+        return this->scalar(static_cast<int64_t>(u));
+    }
+
+    bool Int64(int64_t i)
+    {
+        return this->scalar(i);
+    }
+
+    bool Uint64(uint64_t u)
+    {
+        return this->scalar(u);
+    }
+
+    bool Double(double d)
+    {
+        return this->scalar(d);
+    }
+
+    bool RawNumber(const char *str, rapidjson::SizeType length, bool /*copy*/)
+    {
+        return this->scalar(std::string_view(str, length));
+    }
+
+    bool String(const char *str, rapidjson::SizeType length, bool /*copy*/)
+    {
+        return this->scalar(std::string_view(str, length));
+    }
+
+    bool StartObject()
+    {
+        this->beforeValue();
+        this->path_.segments_.push_back({});
+        return true;
+    }
+
+    bool Key(const char *str, rapidjson::SizeType length, bool /*copy*/)
+    {
+        this->path_.segments_.back().key = {str, length};
+        return true;
+    }
+
+    bool EndObject(rapidjson::SizeType /*memberCount*/)
+    {
+        this->path_.segments_.pop_back();
+        this->visitor_.onEnd(this->path_);
+        return true;
+    }
+
+    bool StartArray()
+    {
+        this->beforeValue();
+        this->path_.segments_.push_back(
+            {.key = {}, .index = -1, .inArray = true});
+        return true;
+    }
+
+    bool EndArray(rapidjson::SizeType /*elementCount*/)
+    {
+        this->path_.segments_.pop_back();
+        this->visitor_.onEnd(this->path_);
+        return true;
+    }
+
+private:
+    void beforeValue()
+    {
+        if (!this->path_.segments_.empty() &&
+            this->path_.segments_.back().inArray)
+        {
+            this->path_.segments_.back().index++;
+        }
+    }
+
+    bool scalar(JsonStreamValue::Variant value)
+    {
+        this->beforeValue();
+        this->visitor_.onValue(this->path_, JsonStreamValue(value));
+        return true;
+    }
+
+    Visitor &visitor_;
+    JsonStreamPath path_;
+};
+
+/// @brief Parses @a json without building a DOM
+///
+/// The visitor must provide
+/// `void onValue(const JsonStreamPath &, const JsonStreamValue &)`, which is
+/// called for every scalar, and `void onEnd(const JsonStreamPath &)`, which
+/// is called after an object or array at the given path ended.
+///
+/// The document is parsed in place, so @a json is detached if it's shared.
+///
+/// @returns `false` if @a json isn't valid JSON. The visitor might have
+///          received values before the error.
+template <typename Visitor>
+bool streamJson(QByteArray json, Visitor &visitor)
+{
+    JsonStreamHandler<Visitor> handler(visitor);
+    // data() detaches and is always null-terminated
+    rapidjson::InsituStringStream stream(json.data());
+    rapidjson::Reader reader;
+    return !reader.Parse<rapidjson::kParseInsituFlag>(stream, handler)
+                .IsError();
+}
+
+}  // namespace chatterino
@@ -0,0 +1,89 @@
+#include "util/ProcessScanner.hpp"
+
+#include <QDir>
+#include <QFile>
+
+#include <utility>
+
+namespace {
+
+/// TASK_COMM_LEN - 1 (the kernel stores 16 bytes including the terminator)
+constexpr qsizetype MAX_COMM_LENGTH = 15;
+
+bool readMatches(const QString &commPath, const QStringList &names)
+{
+    QFile file(commPath);
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        // The process exited in the meantime
+        return false;
+    }
+
+    auto comm = QString::fromUtf8(file.readAll()).trimmed();
+    return names.contains(comm, Qt::CaseInsensitive);
+}
+
+}  // namespace
+
+namespace chatterino {
+
+ProcessScanner::ProcessScanner(const QStringList &names, QString procRoot)
+    : procRoot_(std::move(procRoot))
+{
+    for (const auto &name : names)
+    {
+        this->names_.append(name.left(MAX_COMM_LENGTH));
+    }
+}
+
+bool ProcessScanner::isAnyRunning()
+{
+    QDir root(this->procRoot_);
+    auto entries = root.entryList(QDir::Dirs | QDir::NoDotAndDotDot);
+
+    std::unordered_map<qint64, KnownProcess> current;
+    current.reserve(entries.size());
+
+    bool anyRunning = false;
+    for (const auto &entry : entries)
+    {
+        bool isPid = false;
+        auto pid = entry.toLongLong(&isPid);
+        if (!isPid)
+        {
+            continue;
+        }
+
+        auto commPath = root.filePath(entry + QStringLiteral("/comm"));
+        KnownProcess process;
+        auto it = this->known_.find(pid);
+        if (it == this->known_.end())
+        {
+            process.matches = readMatches(commPath, this->names_);
+            process.rechecks = RECHECK_SCANS;
+        }
+        else
+        {
+            process = it->second;
+            if (!process.matches && process.rechecks > 0)
+            {
+                process.matches = readMatches(commPath, this->names_);
+                process.rechecks--;
+            }
+        }
+
+        current.emplace(pid, process);
+        anyRunning = anyRunning || process.matches;
+    }
+
+    // Exited processes are dropped
+    this->known_ = std::move(current);
+    return anyRunning;
+}
+
+size_t ProcessScanner::knownProcesses() const
+{
+    return this->known_.size();
+}
+
+}  // namespace chatterino
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <QString>
+#include <QStringList>
+
+#include <cstdint>
+#include <unordered_map>
+
+namespace chatterino {
+
+/// @brief Checks if any process with one of the given names is running by
+///        scanning a procfs directory (Linux)
+///
+/// The scan is incremental: the name of a process is only read while its PID
+/// is new and PIDs are forgotten once they're gone. A process that doesn't
+/// match is read again in the next #RECHECK_SCANS scans, since it might have
+/// been seen between fork and exec (with the name of its parent). A PID
+/// that's reused between two scans keeps the name of the old process.
+///
+/// Names are compared case-insensitively against `/proc/<pid>/comm`, which
+/// the kernel truncates to 15 characters. The names to look for are
+/// truncated the same way.
+///
+/// This class isn't thread-safe.
+class ProcessScanner
+{
+public:
+    /// Number of scans a new process that doesn't match is read again in
+    static constexpr uint8_t RECHECK_SCANS = 2;
+
+    explicit ProcessScanner(const QStringList &names,
+                            QString procRoot = QStringLiteral("/proc"));
+
+    /// Scans for new and exited processes
+    bool isAnyRunning();
+
+    /// Number of processes that were seen in the last scan
+    size_t knownProcesses() const;
+
+private:
+    QStringList names_;
+    QString procRoot_;
+
+    struct KnownProcess {
+        /// Does the name match any of `names_`?
+        bool matches = false;
+        /// Number of remaining scans the name is read again in
+        uint8_t rechecks = 0;
+    };
+
+    std::unordered_map<qint64, KnownProcess> known_;
+};
+
+}  // namespace chatterino
@@ -10,6 +10,7 @@
 #include <QPainter>
 #include <QTimer>
 
+#include <algorithm>
 #include <cmath>
 
 namespace {
@@ -24,6 +25,31 @@ bool areClose(auto a, auto b)
     return std::abs(a - b) <= 0.0001;
 }
 
+/// Appends the runs of equal, non-empty rows to @a runs
+void appendMinimapRuns(std::vector<chatterino::Scrollbar::MinimapRun> &runs,
+                       const std::vector<QRgb> &rows, bool fullWidth)
+{
+    int nRows = static_cast<int>(rows.size());
+    int start = 0;
+    for (int y = 1; y <= nRows; y++)
+    {
+        if (y < nRows && rows[y] == rows[start])
+        {
+            continue;
+        }
+        if (rows[start] != 0)
+        {
+            runs.push_back({
+                .y = start,
+                .height = y - start,
+                .color = rows[start],
+                .fullWidth = fullWidth,
+            });
+        }
+        start = y;
+    }
+}
+
 }  // namespace
 
 namespace chatterino {
@@ -62,9 +88,34 @@ boost::circular_buffer<ScrollbarHighlight> Scrollbar::getHighlights() const
     return this->highlights_;
 }
 
+const std::vector<Scrollbar::MinimapRun> &Scrollbar::getMinimap()
+{
+    this->updateMinimap();
+    return this->minimap_;
+}
+
 void Scrollbar::addHighlight(ScrollbarHighlight highlight)
 {
+    if (this->highlights_.full())
+    {
+        // The oldest highlight will be evicted
+        this->frontSequence_++;
+        while (!this->nonNullHighlights_.empty() &&
+               this->nonNullHighlights_.front() < this->frontSequence_)
+        {
+            this->nonNullHighlights_.pop_front();
+        }
+    }
+
+    bool isNull = highlight.isNull();
     this->highlights_.push_back(std::move(highlight));
+    if (!isNull)
+    {
+        this->nonNullHighlights_.push_back(
+            this->frontSequence_ +
+            static_cast<int64_t>(this->highlights_.size()) - 1);
+    }
+    this->minimapDirty_ = true;
 }
 
 void Scrollbar::addHighlightsAtStart(
@@ -80,8 +131,15 @@ void Scrollbar::addHighlightsAtStart(
 
     for (size_t i = 0; i < nItems; i++)
     {
-        this->highlights_.push_front(highlights[highlights.size() - 1 - i]);
+        const auto &highlight = highlights[highlights.size() - 1 - i];
+        this->highlights_.push_front(highlight);
+        this->frontSequence_--;
+        if (!highlight.isNull())
+        {
+            this->nonNullHighlights_.push_front(this->frontSequence_);
+        }
     }
+    this->minimapDirty_ = true;
 }
 
 void Scrollbar::replaceHighlight(size_t index, ScrollbarHighlight replacement)
@@ -91,12 +149,113 @@ void Scrollbar::replaceHighlight(size_t index, ScrollbarHighlight replacement)
         return;
     }
 
+    bool wasNull = this->highlights_[index].isNull();
+    bool isNull = replacement.isNull();
     this->highlights_[index] = std::move(replacement);
+    this->minimapDirty_ = true;
+
+    if (wasNull == isNull)
+    {
+        return;
+    }
+
+    auto sequence = this->frontSequence_ + static_cast<int64_t>(index);
+    auto it = std::lower_bound(this->nonNullHighlights_.begin(),
+                               this->nonNullHighlights_.end(), sequence);
+    if (isNull)
+    {
+        this->nonNullHighlights_.erase(it);
+    }
+    else
+    {
+        this->nonNullHighlights_.insert(it, sequence);
+    }
 }
 
 void Scrollbar::clearHighlights()
 {
     this->highlights_.clear();
+    this->nonNullHighlights_.clear();
+    this->frontSequence_ = 0;
+    this->minimapDirty_ = true;
+}
+
+void Scrollbar::invalidateHighlights()
+{
+    this->minimapDirty_ = true;
+    this->update();
+}
+
+void Scrollbar::updateMinimap()
+{
+    int w = this->width();
+    int h = this->height();
+    size_t nHighlights = std::max<size_t>(this->highlights_.size(), 1);
+    float dY = static_cast<float>(h) / static_cast<float>(nHighlights);
+    int highlightHeight =
+        static_cast<int>(std::ceil(std::max(this->scale() * 2.0F, dY)));
+
+    MinimapKey key{
+        .width = w,
+        .height = h,
+        .highlightHeight = highlightHeight,
+        .redeemed = getSettings()->enableRedeemedHighlight,
+        .firstMessage = getSettings()->enableFirstMessageHighlight,
+        .elevated = getSettings()->enableElevatedMessageHighlight,
+    };
+    if (!this->minimapDirty_ && key == this->minimapKey_)
+    {
+        return;
+    }
+    this->minimapKey_ = key;
+    this->minimapDirty_ = false;
+    this->minimap_.clear();
+
+    if (h <= 0 || this->nonNullHighlights_.empty())
+    {
+        return;
+    }
+
+    // Later highlights are painted over earlier ones. `Line` highlights cover
+    // the whole row, `Default` highlights only the middle.
+    std::vector<QRgb> fullRows(static_cast<size_t>(h), 0);
+    std::vector<QRgb> middleRows(static_cast<size_t>(h), 0);
+    for (auto sequence : this->nonNullHighlights_)
+    {
+        auto i = static_cast<size_t>(sequence - this->frontSequence_);
+        const auto &highlight = this->highlights_[i];
+
+        if ((highlight.isRedeemedHighlight() && !key.redeemed) ||
+            (highlight.isFirstMessageHighlight() && !key.firstMessage) ||
+            (highlight.isElevatedMessageHighlight() && !key.elevated))
+        {
+            continue;
+        }
+
+        // rgb() is always opaque
+        QRgb color = highlight.getColor().rgb();
+        int y = std::min(static_cast<int>(dY * static_cast<float>(i)), h - 1);
+        switch (highlight.getStyle())
+        {
+            case ScrollbarHighlight::Default: {
+                int end = std::min(h, y + highlightHeight);
+                std::fill(middleRows.begin() + y, middleRows.begin() + end,
+                          color);
+            }
+            break;
+
+            case ScrollbarHighlight::Line: {
+                fullRows[y] = color;
+                middleRows[y] = color;
+            }
+            break;
+
+            case ScrollbarHighlight::None:;
+        }
+    }
+
+    appendMinimapRuns(this->minimap_, fullRows, true);
+    appendMinimapRuns(this->minimap_, middleRows, false);
 }
 
 void Scrollbar::scrollToBottom(bool animate)
@@ -293,12 +452,6 @@ void Scrollbar::paintEvent(QPaintEvent * /*event*/)
     QPainter painter(this);
     painter.fillRect(this->rect(), this->theme->scrollbars.background);
 
-    bool enableRedeemedHighlights = getSettings()->enableRedeemedHighlight;
-    bool enableFirstMessageHighlights =
-        getSettings()->enableFirstMessageHighlight;
-    bool enableElevatedMessageHighlights =
-        getSettings()->enableElevatedMessageHighlight;
-
     if (this->shouldShowThumb())
     {
         this->thumbRect_.setX(xOffset);
@@ -316,59 +469,21 @@ void Scrollbar::paintEvent(QPaintEvent * /*event*/)
         }
     }
 
-    if (this->shouldShowHighlights() && !this->highlights_.empty())
+    if (this->shouldShowHighlights() && !this->nonNullHighlights_.empty())
     {
-        size_t nHighlights = this->highlights_.size();
-        int w = this->width();
-        float dY = static_cast<float>(this->height()) /
-                   static_cast<float>(nHighlights);
-        int highlightHeight =
-            static_cast<int>(std::ceil(std::max(this->scale() * 2.0F, dY)));
+        this->updateMinimap();
 
-        for (size_t i = 0; i < nHighlights; i++)
+        int w = this->width();
+        for (const auto &run : this->minimap_)
         {
-            const auto &highlight = this->highlights_[i];
-
-            if (highlight.isNull())
-            {
-                continue;
-            }
-
-            if (highlight.isRedeemedHighlight() && !enableRedeemedHighlights)
+            if (run.fullWidth)
             {
-                continue;
+                painter.fillRect(0, run.y, w, run.height, QColor(run.color));
             }
-
-            if (highlight.isFirstMessageHighlight() &&
-                !enableFirstMessageHighlights)
-            {
-                continue;
-            }
-
-            if (highlight.isElevatedMessageHighlight() &&
-                !enableElevatedMessageHighlights)
-            {
-                continue;
-            }
-
-            QColor color = highlight.getColor();
-            color.setAlpha(255);
-
-            int y = static_cast<int>(dY * static_cast<float>(i));
-            switch (highlight.getStyle())
+            else
             {
-                case ScrollbarHighlight::Default: {
-                    painter.fillRect(w / 8 * 3, y, w / 4, highlightHeight,
-                                     color);
-                }
-                break;
-
-                case ScrollbarHighlight::Line: {
-                    painter.fillRect(0, y, w, 1, color);
-                }
-                break;
-
-                case ScrollbarHighlight::None:;
+                painter.fillRect(w / 8 * 3, run.y, w / 4, run.height,
+                                 QColor(run.color));
             }
         }
     }
@@ -9,6 +9,10 @@
 #include <QPropertyAnimation>
 #include <QWidget>
 
+#include <cstdint>
+#include <deque>
+#include <vector>
+
 namespace chatterino {
 
 class ChannelView;
@@ -85,16 +89,38 @@ class Scrollbar : public BaseWidget
 public:
     Scrollbar(size_t messagesLimit, ChannelView *parent);
 
+    /// @brief Consecutive rows of the highlight minimap with the same color
+    ///
+    /// The minimap is the aggregation of all highlights per pixel row. It's
+    /// rebuilt when the highlights or the size change, so painting only
+    /// depends on the height of the scrollbar.
+    struct MinimapRun {
+        int y = 0;
+        int height = 0;
+        QRgb color = 0;
+        /// `Line` highlights span the whole width, `Default` ones only the
+        /// middle
+        bool fullWidth = false;
+
+        bool operator==(const MinimapRun &other) const = default;
+    };
+
     /// Return a copy of the highlights
     ///
     /// Should only be used for tests
     boost::circular_buffer<ScrollbarHighlight> getHighlights() const;
+    /// Return the highlight minimap, rebuilding it if needed
+    ///
+    /// Should only be used for tests
+    const std::vector<MinimapRun> &getMinimap();
     void addHighlight(ScrollbarHighlight highlight);
     void addHighlightsAtStart(
         const std::vector<ScrollbarHighlight> &highlights_);
     void replaceHighlight(size_t index, ScrollbarHighlight replacement);
 
     void clearHighlights();
+    /// Rebuilds the minimap on the next paint (e.g. after colors changed)
+    void invalidateHighlights();
 
     void scrollToBottom(bool animate = false);
     void scrollToTop(bool animate = false);
@@ -163,6 +189,7 @@ private:
     Q_PROPERTY(qreal currentValue_ READ getCurrentValue WRITE setCurrentValue)
 
     void updateScroll();
+    void updateMinimap();
 
     enum class MouseLocation {
         /// The mouse is positioned outside the scrollbar
@@ -180,6 +207,27 @@ private:
     QPropertyAnimation currentValueAnimation_;
 
     boost::circular_buffer<ScrollbarHighlight> highlights_;
+    /// Sequence number of the first highlight. Non-null highlights are
+    /// tracked by their sequence number, so evicting the oldest highlight
+    /// doesn't shift the others.
+    int64_t frontSequence_ = 0;
+    /// Sequence numbers of all highlights that aren't null (ascending)
+    std::deque<int64_t> nonNullHighlights_;
+
+    /// The parameters the minimap was built with
+    struct MinimapKey {
+        int width = 0;
+        int height = 0;
+        int highlightHeight = 0;
+        bool redeemed = false;
+        bool firstMessage = false;
+        bool elevated = false;
+
+        bool operator==(const MinimapKey &other) const = default;
+    };
+    MinimapKey minimapKey_;
+    std::vector<MinimapRun> minimap_;
+    bool minimapDirty_ = true;
 
     bool atBottom_{true};
     /// This takes precedence over `settingHideThumb`
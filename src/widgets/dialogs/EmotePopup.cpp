@@ -6,10 +6,9 @@
 #include "controllers/hotkeys/HotkeyController.hpp"
 #include "debug/Benchmark.hpp"
 #include "messages/Emote.hpp"
-#include "messages/Message.hpp"
-#include "messages/MessageBuilder.hpp"
-#include "messages/MessageElement.hpp"
+#include "messages/Link.hpp"
 #include "providers/bttv/BttvEmotes.hpp"
+#include "providers/emoji/Emojis.hpp"
 #include "providers/ffz/FfzEmotes.hpp"
 #include "providers/seventv/SeventvEmotes.hpp"
 #include "providers/twitch/TwitchAccount.hpp"
@@ -19,10 +18,9 @@
 #include "singletons/Theme.hpp"
 #include "singletons/WindowManager.hpp"
 #include "util/Helpers.hpp"
-#include "widgets/helper/ChannelView.hpp"
+#include "widgets/helper/EmoteGridView.hpp"
 #include "widgets/helper/TrimRegExpValidator.hpp"
 #include "widgets/Notebook.hpp"
-#include "widgets/Scrollbar.hpp"
 
 #include <QAbstractButton>
 #include <QHBoxLayout>
@@ -36,105 +34,74 @@ namespace {
 
 using namespace chatterino;
 
-auto makeTitleMessage(const QString &title)
-{
-    MessageBuilder builder;
-    builder.emplace<TextElement>(title, MessageElementFlag::Text);
-    builder->flags.set(MessageFlag::Centered);
-    return builder.release();
-}
+const QString NO_EMOTES_TEXT = QStringLiteral("no emotes available");
 
-auto makeEmoteMessage(std::vector<EmotePtr> emotes,
-                      const MessageElementFlag &emoteFlag)
+std::vector<EmoteGridItem> makeEmoteItems(std::vector<EmotePtr> emotes)
 {
-    MessageBuilder builder;
-    builder->flags.set(MessageFlag::Centered);
-    builder->flags.set(MessageFlag::DisableCompactEmotes);
-
-    if (emotes.empty())
-    {
-        builder.emplace<TextElement>("no emotes available",
-                                     MessageElementFlag::Text,
-                                     MessageColor::System);
-        return builder.release();
-    }
-
-    std::sort(emotes.begin(), emotes.end(), [](const auto &l, const auto &r) {
+    std::ranges::sort(emotes, [](const auto &l, const auto &r) {
         return compareEmoteStrings(l->name.string, r->name.string);
     });
-    for (const auto &emote : emotes)
+
+    std::vector<EmoteGridItem> items;
+    items.reserve(emotes.size());
+    for (auto &emote : emotes)
     {
-        builder
-            .emplace<EmoteElement>(
-                emote,
-                MessageElementFlags{MessageElementFlag::AlwaysShow, emoteFlag})
-            ->setLink(Link(Link::InsertText, emote->name.string));
+        auto name = emote->name.string;
+        items.push_back({
+            .emote = std::move(emote),
+            .name = name,
+            .insertText = name,
+        });
     }
-
-    return builder.release();
+    return items;
 }
 
-auto makeEmoteMessage(const EmoteMap &map, const MessageElementFlag &emoteFlag)
+std::vector<EmoteGridItem> makeEmoteItems(const EmoteMap &map)
 {
-    if (map.empty())
-    {
-        MessageBuilder builder;
-        builder->flags.set(MessageFlag::Centered);
-        builder->flags.set(MessageFlag::DisableCompactEmotes);
-        builder.emplace<TextElement>("no emotes available",
-                                     MessageElementFlag::Text,
-                                     MessageColor::System);
-        return builder.release();
-    }
-
-    std::vector<EmotePtr> vec;
-    vec.reserve(map.size());
+    std::vector<EmotePtr> emotes;
+    emotes.reserve(map.size());
     for (const auto &[_name, ptr] : map)
     {
-        vec.emplace_back(ptr);
+        emotes.emplace_back(ptr);
     }
-    return makeEmoteMessage(std::move(vec), emoteFlag);
+    return makeEmoteItems(std::move(emotes));
 }
 
-auto makeEmojiMessage(const std::vector<EmojiPtr> &emojiMap)
+std::vector<EmoteGridItem> makeEmojiItems(const IEmojis &emojis)
 {
-    MessageBuilder builder;
-    builder->flags.set(MessageFlag::Centered);
-    builder->flags.set(MessageFlag::DisableCompactEmotes);
-
-    for (const auto &value : emojiMap)
-    {
-        builder
-            .emplace<EmoteElement>(
-                value->emote,
-                MessageElementFlags{MessageElementFlag::AlwaysShow,
-                                    MessageElementFlag::EmojiAll})
-            ->setLink(
-                Link(Link::Type::InsertText, ":" + value->shortCodes[0] + ":"));
+    std::vector<EmoteGridItem> items;
+    items.reserve(emojis.getEmojis().size());
+    for (const auto &emoji : emojis.getEmojis())
+    {
+        items.push_back({
+            .emote = emojis.getEmote(*emoji),
+            .name = emoji->shortCodes[0],
+            .insertText = ":" + emoji->shortCodes[0] + ":",
+        });
     }
-
-    return builder.release();
+    return items;
 }
 
-void addEmotes(Channel &channel, auto &&emotes, const QString &title,
-               const MessageElementFlag &emoteFlag)
+void addEmotes(std::vector<EmoteGridSection> &sections, auto &&emotes,
+               const QString &title)
 {
-    channel.addMessage(makeTitleMessage(title), MessageContext::Original);
-    channel.addMessage(
-        makeEmoteMessage(std::forward<decltype(emotes)>(emotes), emoteFlag),
-        MessageContext::Original);
+    sections.push_back({
+        .title = title,
+        .items = makeEmoteItems(std::forward<decltype(emotes)>(emotes)),
+        .emptyText = NO_EMOTES_TEXT,
+    });
 }
 
 void addTwitchEmoteSets(const std::shared_ptr<const EmoteMap> &local,
                         const std::shared_ptr<const TwitchEmoteSetMap> &sets,
-                        Channel &globalChannel, Channel &subChannel,
+                        std::vector<EmoteGridSection> &globalSections,
+                        std::vector<EmoteGridSection> &subSections,
                         const QString &currentChannelID,
                         const QString &channelName)
 {
     if (!local->empty())
     {
-        addEmotes(subChannel, *local, channelName % u" (Follower)",
-                  MessageElementFlag::TwitchEmote);
+        addEmotes(subSections, *local, channelName % u" (Follower)");
     }
 
     std::vector<
@@ -146,8 +113,7 @@ void addTwitchEmoteSets(const std::shared_ptr<const EmoteMap> &local,
         if (set.owner->id == currentChannelID)
         {
             // Put current channel emotes at the top
-            addEmotes(subChannel, set.emotes, set.title(),
-                      MessageElementFlag::TwitchEmote);
+            addEmotes(subSections, set.emotes, set.title());
         }
         else
         {
@@ -161,59 +127,61 @@ void addTwitchEmoteSets(const std::shared_ptr<const EmoteMap> &local,
 
     for (const auto &[title, set] : sortedSets)
     {
-        addEmotes(set.get().isSubLike ? subChannel : globalChannel,
-                  set.get().emotes, title, MessageElementFlag::TwitchEmote);
+        addEmotes(set.get().isSubLike ? subSections : globalSections,
+                  set.get().emotes, title);
     }
 }
 
-void loadEmojis(ChannelView &view, const std::vector<EmojiPtr> &emojiMap)
-{
-    ChannelPtr emojiChannel(new Channel("", Channel::Type::None));
-    // set the channel first to make sure the scrollbar is at the top
-    view.setChannel(emojiChannel);
-
-    emojiChannel->addMessage(makeEmojiMessage(emojiMap),
-                             MessageContext::Original);
-}
-
-void loadEmojis(Channel &channel, const std::vector<EmojiPtr> &emojiMap,
-                const QString &title)
-{
-    channel.addMessage(makeTitleMessage(title), MessageContext::Original);
-    channel.addMessage(makeEmojiMessage(emojiMap), MessageContext::Original);
-}
-
-// Create an emote
-EmoteMap filterEmoteMap(const QString &text,
-                        const std::shared_ptr<const EmoteMap> &emotes)
+/// Builds the sections shown when searching. Unlike in the tabs, the emotes
+/// of disabled providers are included.
+///
+/// Global emotes are included in all Twitch channels (@a isTwitchChannel),
+/// including special ones like /mentions without a @a twitchChannel.
+std::vector<EmoteGridSection> makeSearchSections(bool isTwitchChannel,
+                                                 TwitchChannel *twitchChannel)
 {
-    EmoteMap filteredMap;
+    std::vector<EmoteGridSection> sections;
 
-    for (const auto &emote : *emotes)
+    if (twitchChannel != nullptr)
     {
-        if (emote.first.string.contains(text, Qt::CaseInsensitive))
+        addEmotes(sections, *twitchChannel->localTwitchEmotes(),
+                  twitchChannel->getName() % u" (Follower)");
+
+        for (const auto &[_id, set] :
+             **getApp()->getAccounts()->twitch.getCurrent()->accessEmoteSets())
         {
-            filteredMap.insert(emote);
+            addEmotes(sections, set.emotes, set.title());
         }
     }
 
-    return filteredMap;
-}
-
-std::vector<EmotePtr> filterEmoteVec(const QString &text,
-                                     const std::vector<EmotePtr> &emotes)
-{
-    std::vector<EmotePtr> filtered;
+    if (isTwitchChannel)
+    {
+        // global
+        addEmotes(sections, *getApp()->getBttvEmotes()->emotes(),
+                  "BetterTTV (Global)");
+        addEmotes(sections, *getApp()->getFfzEmotes()->emotes(),
+                  "FrankerFaceZ (Global)");
+        addEmotes(sections, *getApp()->getSeventvEmotes()->globalEmotes(),
+                  "7TV (Global)");
+    }
 
-    for (const auto &emote : emotes)
+    if (twitchChannel != nullptr)
     {
-        if (emote->name.string.contains(text, Qt::CaseInsensitive))
-        {
-            filtered.emplace_back(emote);
-        }
+        // channel
+        addEmotes(sections, *twitchChannel->bttvEmotes(),
+                  "BetterTTV (Channel)");
+        addEmotes(sections, *twitchChannel->ffzEmotes(),
+                  "FrankerFaceZ (Channel)");
+        addEmotes(sections, *twitchChannel->seventvEmotes(), "7TV (Channel)");
     }
 
-    return filtered;
+    sections.push_back({
+        .title = "Emojis",
+        .items = makeEmojiItems(*getApp()->getEmotes()->getEmojis()),
+        .emptyText = {},
+    });
+
+    return sections;
 }
 
 }  // namespace
@@ -265,13 +233,9 @@ EmotePopup::EmotePopup(QWidget *parent)
     };
 
     auto makeView = [&](QString tabTitle, bool addToNotebook = true) {
-        auto *view = new ChannelView(nullptr);
+        auto *view = new EmoteGridView(nullptr);
 
-        view->setOverrideFlags(MessageElementFlags{
-            MessageElementFlag::Default, MessageElementFlag::AlwaysShow,
-            MessageElementFlag::EmoteImages});
-        view->setEnableScrollingToBottom(false);
-        // We can safely ignore this signal connection since the ChannelView is deleted
+        // We can safely ignore this signal connection since the EmoteGridView is deleted
         // either when the notebook is deleted, or when our main layout is deleted.
         std::ignore = view->linkClicked.connect(clicked);
 
@@ -295,8 +259,11 @@ EmotePopup::EmotePopup(QWidget *parent)
     this->globalEmotesView_ = makeView("Global");
     this->viewEmojis_ = makeView("Emojis");
 
-    loadEmojis(*this->viewEmojis_,
-               getApp()->getEmotes()->getEmojis()->getEmojis());
+    this->viewEmojis_->setSections({{
+        .title = {},
+        .items = makeEmojiItems(*getApp()->getEmotes()->getEmojis()),
+        .emptyText = {},
+    }});
     this->addShortcuts();
     this->signalHolder_.managedConnect(getApp()->getHotkeys()->onItemsUpdated,
                                        [this]() {
@@ -380,17 +347,22 @@ void EmotePopup::addShortcuts()
                  return "scrollPage hotkey called without arguments!";
              }
              auto direction = arguments.at(0);
-             auto *channelView = dynamic_cast<ChannelView *>(
-                 this->notebook_->getSelectedPage());
+             auto *view = this->searchView_->isVisible()
+                              ? this->searchView_
+                              : dynamic_cast<EmoteGridView *>(
+                                    this->notebook_->getSelectedPage());
+             if (view == nullptr)
+             {
+                 return "";
+             }
 
-             auto &scrollbar = channelView->getScrollBar();
              if (direction == "up")
              {
-                 scrollbar.offset(-scrollbar.getPageSize());
+                 view->scrollPages(-1);
              }
              else if (direction == "down")
              {
-                 scrollbar.offset(scrollbar.getPageSize());
+                 view->scrollPages(1);
              }
              else
              {
@@ -422,89 +394,88 @@ void EmotePopup::loadChannel(ChannelPtr channel)
 
     this->setWindowTitle("Emotes in #" + this->channel_->getName());
 
-    if (this->twitchChannel_ == nullptr)
+    this->channelConnections_.clear();
+    if (this->twitchChannel_ != nullptr)
     {
-        return;
+        this->channelConnections_.managedConnect(
+            this->twitchChannel_->channelEmotesChanged, [this] {
+                this->reloadEmotes();
+            });
     }
 
-    this->globalEmotesView_->setChannel(
-        std::make_shared<Channel>("", Channel::Type::None));
-    this->subEmotesView_->setChannel(
-        std::make_shared<Channel>("", Channel::Type::None));
-    this->channelEmotesView_->setChannel(
-        std::make_shared<Channel>("", Channel::Type::None));
-    this->searchView_->setChannel(
-        std::make_shared<Channel>("", Channel::Type::None));
-
     this->reloadEmotes();
 }
 
 void EmotePopup::reloadEmotes()
 {
+    // true in special channels like /mentions
+    bool isTwitchChannel = this->channel_ && this->channel_->isTwitchChannel();
+    this->searchIndex_ = EmoteSearchIndex(makeSearchSections(
+        isTwitchChannel, isTwitchChannel ? this->twitchChannel_ : nullptr));
+    this->filterEmotes(this->search_->text());
+
     if (this->twitchChannel_ == nullptr)
     {
         return;
     }
 
-    auto subChannel = this->subEmotesView_->underlyingChannel();
-    auto globalChannel = this->globalEmotesView_->underlyingChannel();
-    auto channelChannel = this->channelEmotesView_->underlyingChannel();
-
-    subChannel->clearMessages();
-    globalChannel->clearMessages();
-    channelChannel->clearMessages();
+    std::vector<EmoteGridSection> subSections;
+    std::vector<EmoteGridSection> globalSections;
+    std::vector<EmoteGridSection> channelSections;
 
     // twitch
     addTwitchEmoteSets(
         twitchChannel_->localTwitchEmotes(),
         *getApp()->getAccounts()->twitch.getCurrent()->accessEmoteSets(),
-        *globalChannel, *subChannel, twitchChannel_->roomId(),
+        globalSections, subSections, twitchChannel_->roomId(),
         twitchChannel_->getName());
 
     // global
     if (Settings::instance().enableBTTVGlobalEmotes)
     {
-        addEmotes(*globalChannel, *getApp()->getBttvEmotes()->emotes(),
-                  "BetterTTV", MessageElementFlag::BttvEmote);
+        addEmotes(globalSections, *getApp()->getBttvEmotes()->emotes(),
+                  "BetterTTV");
     }
     if (Settings::instance().enableFFZGlobalEmotes)
     {
-        addEmotes(*globalChannel, *getApp()->getFfzEmotes()->emotes(),
-                  "FrankerFaceZ", MessageElementFlag::FfzEmote);
+        addEmotes(globalSections, *getApp()->getFfzEmotes()->emotes(),
+                  "FrankerFaceZ");
     }
     if (Settings::instance().enableSevenTVGlobalEmotes)
     {
-        addEmotes(*globalChannel, *getApp()->getSeventvEmotes()->globalEmotes(),
-                  "7TV", MessageElementFlag::SevenTVEmote);
+        addEmotes(globalSections, *getApp()->getSeventvEmotes()->globalEmotes(),
+                  "7TV");
     }
 
     // channel
     if (Settings::instance().enableBTTVChannelEmotes)
     {
-        addEmotes(*channelChannel, *this->twitchChannel_->bttvEmotes(),
-                  "BetterTTV", MessageElementFlag::BttvEmote);
+        addEmotes(channelSections, *this->twitchChannel_->bttvEmotes(),
+                  "BetterTTV");
     }
     if (Settings::instance().enableFFZChannelEmotes)
     {
-        addEmotes(*channelChannel, *this->twitchChannel_->ffzEmotes(),
-                  "FrankerFaceZ", MessageElementFlag::FfzEmote);
+        addEmotes(channelSections, *this->twitchChannel_->ffzEmotes(),
+                  "FrankerFaceZ");
     }
     if (Settings::instance().enableSevenTVChannelEmotes)
     {
-        addEmotes(*channelChannel, *this->twitchChannel_->seventvEmotes(),
-                  "7TV", MessageElementFlag::SevenTVEmote);
+        addEmotes(channelSections, *this->twitchChannel_->seventvEmotes(),
+                  "7TV");
     }
 
-    if (subChannel->getMessageSnapshot().size() == 0)
+    if (subSections.empty())
     {
-        MessageBuilder builder;
-        builder->flags.set(MessageFlag::Centered);
-        builder->flags.set(MessageFlag::DisableCompactEmotes);
-        builder.emplace<TextElement>("no subscription emotes available",
-                                     MessageElementFlag::Text,
-                                     MessageColor::System);
-        subChannel->addMessage(builder.release(), MessageContext::Original);
+        subSections.push_back({
+            .title = {},
+            .items = {},
+            .emptyText = "no subscription emotes available",
+        });
     }
+
+    this->subEmotesView_->setSections(std::move(subSections));
+    this->globalEmotesView_->setSections(std::move(globalSections));
+    this->channelEmotesView_->setSections(std::move(channelSections));
 }
 
 bool EmotePopup::eventFilter(QObject *object, QEvent *event)
@@ -522,86 +493,6 @@ bool EmotePopup::eventFilter(QObject *object, QEvent *event)
     return false;
 }
 
-void EmotePopup::filterTwitchEmotes(std::shared_ptr<Channel> searchChannel,
-                                    const QString &searchText)
-{
-    if (this->twitchChannel_)
-    {
-        auto local = filterEmoteMap(searchText,
-                                    this->twitchChannel_->localTwitchEmotes());
-        if (!local.empty())
-        {
-            addEmotes(*searchChannel, local,
-                      this->twitchChannel_->getName() % u" (Follower)",
-                      MessageElementFlag::TwitchEmote);
-        }
-
-        for (const auto &[_id, set] :
-             **getApp()->getAccounts()->twitch.getCurrent()->accessEmoteSets())
-        {
-            auto filtered = filterEmoteVec(searchText, set.emotes);
-            if (!filtered.empty())
-            {
-                addEmotes(*searchChannel, std::move(filtered), set.title(),
-                          MessageElementFlag::TwitchEmote);
-            }
-        }
-    }
-
-    auto bttvGlobalEmotes =
-        filterEmoteMap(searchText, getApp()->getBttvEmotes()->emotes());
-    auto ffzGlobalEmotes =
-        filterEmoteMap(searchText, getApp()->getFfzEmotes()->emotes());
-    auto seventvGlobalEmotes = filterEmoteMap(
-        searchText, getApp()->getSeventvEmotes()->globalEmotes());
-
-    // global
-    if (!bttvGlobalEmotes.empty())
-    {
-        addEmotes(*searchChannel, bttvGlobalEmotes, "BetterTTV (Global)",
-                  MessageElementFlag::BttvEmote);
-    }
-    if (!ffzGlobalEmotes.empty())
-    {
-        addEmotes(*searchChannel, ffzGlobalEmotes, "FrankerFaceZ (Global)",
-                  MessageElementFlag::FfzEmote);
-    }
-    if (!seventvGlobalEmotes.empty())
-    {
-        addEmotes(*searchChannel, seventvGlobalEmotes, "7TV (Global)",
-                  MessageElementFlag::SevenTVEmote);
-    }
-
-    if (this->twitchChannel_ == nullptr)
-    {
-        return;
-    }
-
-    auto bttvChannelEmotes =
-        filterEmoteMap(searchText, this->twitchChannel_->bttvEmotes());
-    auto ffzChannelEmotes =
-        filterEmoteMap(searchText, this->twitchChannel_->ffzEmotes());
-    auto seventvChannelEmotes =
-        filterEmoteMap(searchText, this->twitchChannel_->seventvEmotes());
-
-    // channel
-    if (!bttvChannelEmotes.empty())
-    {
-        addEmotes(*searchChannel, bttvChannelEmotes, "BetterTTV (Channel)",
-                  MessageElementFlag::BttvEmote);
-    }
-    if (!ffzChannelEmotes.empty())
-    {
-        addEmotes(*searchChannel, ffzChannelEmotes, "FrankerFaceZ (Channel)",
-                  MessageElementFlag::FfzEmote);
-    }
-    if (!seventvChannelEmotes.empty())
-    {
-        addEmotes(*searchChannel, seventvChannelEmotes, "7TV (Channel)",
-                  MessageElementFlag::SevenTVEmote);
-    }
-}
-
 void EmotePopup::filterEmotes(const QString &searchText)
 {
     if (searchText.length() == 0)
@@ -611,32 +502,8 @@ void EmotePopup::filterEmotes(const QString &searchText)
 
         return;
     }
-    auto searchChannel = this->searchView_->underlyingChannel();
-    searchChannel->clearMessages();
 
-    // true in special channels like /mentions
-    if (this->channel_->isTwitchChannel())
-    {
-        this->filterTwitchEmotes(searchChannel, searchText);
-    }
-
-    std::vector<EmojiPtr> filteredEmojis{};
-    int emojiCount = 0;
-
-    const auto &emojis = getApp()->getEmotes()->getEmojis()->getEmojis();
-    for (const auto &emoji : emojis)
-    {
-        if (emoji->shortCodes[0].contains(searchText, Qt::CaseInsensitive))
-        {
-            filteredEmojis.push_back(emoji);
-            emojiCount++;
-        }
-    }
-    // emojis
-    if (emojiCount > 0)
-    {
-        loadEmojis(*searchChannel, filteredEmojis, "Emojis");
-    }
+    this->searchView_->setSections(this->searchIndex_.search(searchText));
 
     this->notebook_->hide();
     this->searchView_->show();
@@ -1,14 +1,16 @@
 #pragma once
 
 #include "widgets/BasePopup.hpp"
+#include "widgets/helper/EmoteGridLayout.hpp"
 
 #include <pajlada/signals/signal.hpp>
+#include <pajlada/signals/signalholder.hpp>
 #include <QLineEdit>
 
 namespace chatterino {
 
 struct Link;
-class ChannelView;
+class EmoteGridView;
 class Channel;
 using ChannelPtr = std::shared_ptr<Channel>;
 class Notebook;
@@ -31,24 +33,27 @@ protected:
     void themeChangedEvent() override;
 
 private:
-    ChannelView *globalEmotesView_{};
-    ChannelView *channelEmotesView_{};
-    ChannelView *subEmotesView_{};
-    ChannelView *viewEmojis_{};
+    EmoteGridView *globalEmotesView_{};
+    EmoteGridView *channelEmotesView_{};
+    EmoteGridView *subEmotesView_{};
+    EmoteGridView *viewEmojis_{};
     /**
      * @brief Visible only when the user has specified a search query into the `search_` input.
      * Otherwise the `notebook_` and all other views are visible.
      */
-    ChannelView *searchView_{};
+    EmoteGridView *searchView_{};
+
+    /// All emotes that can be searched for. Rebuilt in #reloadEmotes().
+    EmoteSearchIndex searchIndex_;
 
     ChannelPtr channel_;
     TwitchChannel *twitchChannel_{};
+    /// Reloads the emotes when the channel's emotes change
+    pajlada::Signals::SignalHolder channelConnections_;
 
     QLineEdit *search_;
     Notebook *notebook_;
 
-    void filterTwitchEmotes(std::shared_ptr<Channel> searchChannel,
-                            const QString &searchText);
     void filterEmotes(const QString &text);
     void addShortcuts() override;
     bool eventFilter(QObject *object, QEvent *event) override;
@@ -8,6 +8,7 @@
 #include "controllers/commands/CommandController.hpp"
 #include "controllers/filters/FilterSet.hpp"
 #include "debug/Benchmark.hpp"
+#include "debug/Trace.hpp"
 #include "messages/Emote.hpp"
 #include "messages/Image.hpp"
 #include "messages/layouts/MessageLayout.hpp"
@@ -421,6 +422,7 @@ void ChannelView::initializeSignals()
         getApp()->getWindows()->gifRepaintRequested, [&] {
             if (!this->animationArea_.isEmpty())
             {
+                this->performanceStats_.gifRepaints++;
                 this->queueUpdate(this->animationArea_);
             }
         });
@@ -641,6 +643,8 @@ void ChannelView::queueUpdate(const QRect &area)
 void ChannelView::invalidateBuffers()
 {
     this->bufferInvalidationQueued_ = true;
+    // Highlight colors might have changed
+    this->scrollBar_->invalidateHighlights();
     this->queueLayout();
 }
 
@@ -666,7 +670,8 @@ void ChannelView::showEvent(QShowEvent * /*event*/)
 
 void ChannelView::performLayout(bool causedByScrollbar, bool causedByShow)
 {
-    // BenchmarkGuard benchmark("layout");
+    CHATTERINO_TRACE("layout", "ChannelView::performLayout");
+    auto layoutStart = SteadyClock::now();
 
     this->layoutQueued_ = false;
 
@@ -686,6 +691,9 @@ void ChannelView::performLayout(bool causedByScrollbar, bool causedByShow)
     this->goToBottom_->setVisible(this->enableScrollingToBottom_ &&
                                   this->scrollBar_->isVisible() &&
                                   !this->scrollBar_->isAtBottom());
+
+    this->performanceStats_.layouts++;
+    this->performanceStats_.layoutTime += SteadyClock::now() - layoutStart;
 }
 
 void ChannelView::layoutVisibleMessages(
@@ -705,7 +713,7 @@ void ChannelView::layoutVisibleMessages(
         {
             const auto &message = messages[i];
 
-            redrawRequired |= message->layout(
+            auto changed = message->layout(
                 {
                     .messageColors = this->messageColors_,
                     .flags = flags,
@@ -715,6 +723,11 @@ void ChannelView::layoutVisibleMessages(
                                   static_cast<float>(this->devicePixelRatio()),
                 },
                 this->bufferInvalidationQueued_);
+            if (changed)
+            {
+                redrawRequired = true;
+                this->performanceStats_.messagesLaidOut++;
+            }
 
             y += message->getHeight();
         }
@@ -1536,7 +1549,8 @@ void ChannelView::scrollToMessageLayout(MessageLayout *layout,
 
 void ChannelView::paintEvent(QPaintEvent *event)
 {
-    //    BenchmarkGuard benchmark("paint");
+    CHATTERINO_TRACE("paint", "ChannelView::paintEvent");
+    auto frameStart = SteadyClock::now();
 
     QPainter painter(this);
 
@@ -1580,6 +1594,9 @@ void ChannelView::paintEvent(QPaintEvent *event)
         painter.drawText(QRectF(textX, pausedY, textWidth, indicatorSize),
                          Qt::AlignLeft | Qt::AlignVCenter, text);
     }
+
+    this->performanceStats_.frames++;
+    this->performanceStats_.frameTime += SteadyClock::now() - frameStart;
 }
 
 // if overlays is false then it draws the message, if true then it draws things
@@ -3329,4 +3346,19 @@ ChannelView::ChannelViewID ChannelView::getID() const
     return this->id_;
 }
 
+const ChannelView::PerformanceStats &ChannelView::performanceStats() const
+{
+    return this->performanceStats_;
+}
+
+int64_t ChannelView::bufferMemoryUsage()
+{
+    int64_t total = 0;
+    for (const auto &layout : this->getMessagesSnapshot())
+    {
+        total += layout->bufferMemoryUsage();
+    }
+    return total;
+}
+
 }  // namespace chatterino
@@ -220,6 +220,24 @@ public:
     /// combined with the filter set IDs
     ChannelViewID getID() const;
 
+    /// Running totals of the painting and layout work done by this view.
+    /// Rates are computed by comparing two snapshots.
+    struct PerformanceStats {
+        uint64_t frames = 0;
+        SteadyClock::duration frameTime{};
+
+        uint64_t layouts = 0;
+        SteadyClock::duration layoutTime{};
+        /// Messages that had to be laid out again or repainted into their buffer
+        uint64_t messagesLaidOut = 0;
+
+        uint64_t gifRepaints = 0;
+    };
+    const PerformanceStats &performanceStats() const;
+
+    /// Bytes used by the pixmap buffers of the messages in this view
+    int64_t bufferMemoryUsage();
+
     pajlada::Signals::Signal<QMouseEvent *> mouseDown;
     pajlada::Signals::NoArgSignal selectionChanged;
     pajlada::Signals::Signal<HighlightState> tabHighlightRequested;
@@ -326,6 +344,8 @@ private:
     void updateID();
     ChannelViewID id_{};
 
+    PerformanceStats performanceStats_;
+
     bool layoutQueued_ = false;
     bool bufferInvalidationQueued_ = false;
 
@@ -0,0 +1,195 @@
+#include "widgets/helper/EmoteGridLayout.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace chatterino {
+
+void EmoteGridLayout::layout(const std::vector<EmoteGridSection> &sections,
+                             int width, int cellSize, int textHeight)
+{
+    this->rows_.clear();
+    this->cellSize_ = std::max(cellSize, 1);
+    this->columns_ = std::max(width / this->cellSize_, 1);
+    this->left_ = std::max((width - this->columns_ * this->cellSize_) / 2, 0);
+
+    int y = 0;
+    auto addRow = [&](Row row) {
+        row.y = y;
+        y += row.height;
+        this->rows_.emplace_back(row);
+    };
+
+    for (size_t section = 0; section < sections.size(); section++)
+    {
+        const auto &current = sections[section];
+        if (!current.title.isEmpty())
+        {
+            addRow({
+                .kind = Row::Kind::Title,
+                .height = textHeight,
+                .section = section,
+            });
+        }
+
+        if (current.items.empty())
+        {
+            if (!current.emptyText.isEmpty())
+            {
+                addRow({
+                    .kind = Row::Kind::Note,
+                    .height = textHeight,
+                    .section = section,
+                });
+            }
+            continue;
+        }
+
+        auto columns = static_cast<size_t>(this->columns_);
+        for (size_t first = 0; first < current.items.size(); first += columns)
+        {
+            addRow({
+                .kind = Row::Kind::Emotes,
+                .height = this->cellSize_,
+                .section = section,
+                .first = first,
+                .count = std::min(columns, current.items.size() - first),
+            });
+        }
+    }
+
+    this->totalHeight_ = y;
+}
+
+const std::vector<EmoteGridLayout::Row> &EmoteGridLayout::rows() const
+{
+    return this->rows_;
+}
+
+std::span<const EmoteGridLayout::Row> EmoteGridLayout::rowsIn(int top,
+                                                              int bottom) const
+{
+    auto begin =
+        std::ranges::upper_bound(this->rows_, top, {}, [](const Row &row) {
+            return row.y + row.height;
+        });
+    auto end = std::ranges::lower_bound(begin, this->rows_.end(), bottom, {},
+                                        &Row::y);
+    return {begin, end};
+}
+
+int EmoteGridLayout::totalHeight() const
+{
+    return this->totalHeight_;
+}
+
+int EmoteGridLayout::columns() const
+{
+    return this->columns_;
+}
+
+QRect EmoteGridLayout::cellRect(const Row &row, size_t column) const
+{
+    return {
+        this->left_ + static_cast<int>(column) * this->cellSize_,
+        row.y,
+        this->cellSize_,
+        this->cellSize_,
+    };
+}
+
+std::optional<EmoteGridLayout::ItemIndex> EmoteGridLayout::itemAt(
+    QPoint pos) const
+{
+    auto rows = this->rowsIn(pos.y(), pos.y() + 1);
+    if (rows.empty() || rows.front().kind != Row::Kind::Emotes ||
+        pos.x() < this->left_)
+    {
+        return std::nullopt;
+    }
+
+    const auto &row = rows.front();
+    auto column =
+        static_cast<size_t>((pos.x() - this->left_) / this->cellSize_);
+    if (column >= row.count)
+    {
+        return std::nullopt;
+    }
+    return ItemIndex{.section = row.section, .item = row.first + column};
+}
+
+EmoteSearchIndex::EmoteSearchIndex(std::vector<EmoteGridSection> sections)
+    : sections_(std::move(sections))
+{
+    for (size_t section = 0; section < this->sections_.size(); section++)
+    {
+        const auto &items = this->sections_[section].items;
+        for (size_t item = 0; item < items.size(); item++)
+        {
+            this->entries_.push_back({
+                .key = items[item].name.toLower(),
+                .section = static_cast<std::uint32_t>(section),
+                .item = static_cast<std::uint32_t>(item),
+            });
+        }
+    }
+}
+
+std::vector<EmoteGridSection> EmoteSearchIndex::search(const QString &query)
+{
+    auto needle = query.toLower();
+
+    std::vector<std::uint32_t> matches;
+    auto check = [&](std::uint32_t entry) {
+        if (this->entries_[entry].key.contains(needle))
+        {
+            matches.push_back(entry);
+        }
+    };
+
+    // Names containing the new query contain the previous one as well, so
+    // only the previous matches need to be checked
+    if (!this->lastQuery_.isEmpty() && needle.contains(this->lastQuery_))
+    {
+        for (auto entry : this->lastMatches_)
+        {
+            check(entry);
+        }
+    }
+    else
+    {
+        for (size_t entry = 0; entry < this->entries_.size(); entry++)
+        {
+            check(static_cast<std::uint32_t>(entry));
+        }
+    }
+
+    std::vector<EmoteGridSection> result;
+    std::optional<std::uint32_t> currentSection;
+    for (auto match : matches)
+    {
+        const auto &entry = this->entries_[match];
+        if (currentSection != entry.section)
+        {
+            currentSection = entry.section;
+            result.push_back({
+                .title = this->sections_[entry.section].title,
+                .items = {},
+                .emptyText = {},
+            });
+        }
+        result.back().items.push_back(
+            this->sections_[entry.section].items[entry.item]);
+    }
+
+    this->lastQuery_ = std::move(needle);
+    this->lastMatches_ = std::move(matches);
+    return result;
+}
+
+size_t EmoteSearchIndex::size() const
+{
+    return this->entries_.size();
+}
+
+}  // namespace chatterino
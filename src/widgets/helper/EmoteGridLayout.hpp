@@ -0,0 +1,129 @@
+#pragma once
+
+#include <QPoint>
+#include <QRect>
+#include <QString>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace chatterino {
+
+struct Emote;
+using EmotePtr = std::shared_ptr<const Emote>;
+
+struct EmoteGridItem {
+    EmotePtr emote;
+    /// Name the item is searched by
+    QString name;
+    /// Text inserted into the input when the item is clicked
+    QString insertText;
+};
+
+struct EmoteGridSection {
+    /// Sections without a title don't get a title row
+    QString title;
+    std::vector<EmoteGridItem> items;
+    /// Shown if there are no items (nothing is shown if this is empty)
+    QString emptyText;
+};
+
+/// @brief Positions of the rows of an emote grid
+///
+/// Every emote occupies a square cell of the same size, so the layout only
+/// depends on the number of emotes in each section and not on their images.
+/// This allows laying out thousands of emotes without loading a single image.
+/// The view only needs to look at the rows in its viewport.
+class EmoteGridLayout
+{
+public:
+    struct Row {
+        enum class Kind : std::uint8_t {
+            Title,
+            /// A section's `emptyText`
+            Note,
+            Emotes,
+        };
+
+        Kind kind = Kind::Emotes;
+        int y = 0;
+        int height = 0;
+        size_t section = 0;
+        /// Index of the first item of this row in its section (`Emotes` only)
+        size_t first = 0;
+        /// Number of items in this row (`Emotes` only)
+        size_t count = 0;
+    };
+
+    struct ItemIndex {
+        size_t section = 0;
+        size_t item = 0;
+
+        bool operator==(const ItemIndex &other) const = default;
+    };
+
+    /// Lays out @a sections for a view that's @a width pixels wide. Titles
+    /// and notes are @a textHeight pixels high.
+    void layout(const std::vector<EmoteGridSection> &sections, int width,
+                int cellSize, int textHeight);
+
+    const std::vector<Row> &rows() const;
+    /// Returns the rows intersecting the range [@a top, @a bottom)
+    std::span<const Row> rowsIn(int top, int bottom) const;
+
+    int totalHeight() const;
+    int columns() const;
+
+    /// Returns the rectangle of the @a column-th cell in @a row
+    QRect cellRect(const Row &row, size_t column) const;
+    /// Returns the item at @a pos (relative to the top of the content)
+    std::optional<ItemIndex> itemAt(QPoint pos) const;
+
+private:
+    std::vector<Row> rows_;
+    int columns_ = 1;
+    int cellSize_ = 0;
+    /// X coordinate of the first column (the grid is centered)
+    int left_ = 0;
+    int totalHeight_ = 0;
+};
+
+/// @brief Lookup of emotes by name across all sections of the emote popup
+///
+/// Names are lowercased once when the index is built, so searching only
+/// compares lowercased strings instead of doing a case-insensitive comparison
+/// of every name on every keystroke. When the query is extended (i.e. the
+/// user types another character), only the previous matches are searched.
+class EmoteSearchIndex
+{
+public:
+    EmoteSearchIndex() = default;
+    explicit EmoteSearchIndex(std::vector<EmoteGridSection> sections);
+
+    /// Returns the sections with the items whose name contains @a query
+    /// (case-insensitive). Sections without a match are omitted.
+    std::vector<EmoteGridSection> search(const QString &query);
+
+    /// Number of indexed items
+    size_t size() const;
+
+private:
+    struct Entry {
+        QString key;
+        std::uint32_t section;
+        std::uint32_t item;
+    };
+
+    std::vector<EmoteGridSection> sections_;
+    /// In the order of the sections and their items
+    std::vector<Entry> entries_;
+
+    QString lastQuery_;
+    /// Indices into `entries_`
+    std::vector<std::uint32_t> lastMatches_;
+};
+
+}  // namespace chatterino
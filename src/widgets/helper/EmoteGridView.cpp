@@ -0,0 +1,320 @@
+#include "widgets/helper/EmoteGridView.hpp"
+
+#include "Application.hpp"
+#include "messages/Emote.hpp"
+#include "messages/Image.hpp"
+#include "messages/Link.hpp"
+#include "singletons/Fonts.hpp"
+#include "singletons/Settings.hpp"
+#include "singletons/Theme.hpp"
+#include "singletons/WindowManager.hpp"
+#include "widgets/TooltipWidget.hpp"
+
+#include <QCoreApplication>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QScrollBar>
+
+#include <algorithm>
+#include <utility>
+
+namespace {
+
+using namespace chatterino;
+
+/// Size of a cell at scale 1 (28px Twitch emotes plus padding)
+constexpr int CELL_SIZE = 32;
+constexpr int CELL_PADDING = 2;
+constexpr int TEXT_PADDING = 8;
+constexpr int SCROLLBAR_WIDTH = 10;
+
+}  // namespace
+
+namespace chatterino {
+
+EmoteGridView::EmoteGridView(QWidget *parent)
+    : BaseWidget(parent)
+    , scrollBar_(new QScrollBar(Qt::Vertical, this))
+    , tooltipWidget_(new TooltipWidget(this))
+{
+    this->setMouseTracking(true);
+    this->setAttribute(Qt::WA_OpaquePaintEvent);
+
+    QObject::connect(this->scrollBar_, &QScrollBar::valueChanged, this, [this] {
+        this->hoveredItem_.reset();
+        this->tooltipWidget_->hide();
+        this->update();
+    });
+
+    // Images that finished loading request a layout
+    this->signalHolder_.managedConnect(
+        getApp()->getWindows()->layoutRequested, [this](Channel *channel) {
+            if (channel == nullptr && this->isVisible())
+            {
+                this->updateLayout();
+            }
+        });
+    this->signalHolder_.managedConnect(
+        getApp()->getWindows()->gifRepaintRequested, [this] {
+            if (this->paintedAnimated_ && this->isVisible())
+            {
+                this->update();
+            }
+        });
+    this->signalHolder_.managedConnect(getApp()->getFonts()->fontChanged,
+                                       [this] {
+                                           this->updateLayout();
+                                       });
+
+    this->scaleChangedEvent(this->scale());
+    this->themeChangedEvent();
+}
+
+void EmoteGridView::setSections(std::vector<EmoteGridSection> sections)
+{
+    this->sections_ = std::move(sections);
+    this->hoveredItem_.reset();
+    this->tooltipWidget_->hide();
+    this->updateLayout();
+    this->scrollBar_->setValue(0);
+}
+
+void EmoteGridView::scrollPages(int pages)
+{
+    this->scrollBar_->setValue(this->scrollBar_->value() +
+                               pages * this->scrollBar_->pageStep());
+}
+
+void EmoteGridView::updateLayout()
+{
+    auto scale = this->scale();
+    auto cellSize = static_cast<int>(
+        CELL_SIZE * scale * getSettings()->emoteScale.getValue());
+    auto textHeight =
+        getApp()->getFonts()->getFontMetrics(FontStyle::ChatMedium, scale)
+            .height() +
+        static_cast<int>(TEXT_PADDING * scale);
+
+    this->layout_.layout(this->sections_, this->viewportWidth(), cellSize,
+                         textHeight);
+
+    this->scrollBar_->setRange(
+        0, std::max(this->layout_.totalHeight() - this->height(), 0));
+    this->scrollBar_->setPageStep(this->height());
+    this->scrollBar_->setSingleStep(cellSize);
+    this->update();
+}
+
+int EmoteGridView::viewportWidth() const
+{
+    return this->width() - this->scrollBar_->width();
+}
+
+const EmoteGridItem *EmoteGridView::itemAt(
+    const std::optional<EmoteGridLayout::ItemIndex> &index) const
+{
+    if (!index || index->section >= this->sections_.size())
+    {
+        return nullptr;
+    }
+    const auto &items = this->sections_[index->section].items;
+    if (index->item >= items.size())
+    {
+        return nullptr;
+    }
+    return &items[index->item];
+}
+
+void EmoteGridView::paintEvent(QPaintEvent * /*event*/)
+{
+    QPainter painter(this);
+    painter.fillRect(this->rect(), this->theme->messages.backgrounds.regular);
+
+    auto top = this->scrollBar_->value();
+    auto scale = this->scale();
+    auto imageScale = scale * static_cast<float>(this->devicePixelRatioF());
+    auto padding = static_cast<int>(CELL_PADDING * scale);
+    auto width = this->viewportWidth();
+
+    painter.translate(0, -top);
+    painter.setFont(
+        getApp()->getFonts()->getFont(FontStyle::ChatMedium, scale));
+
+    bool paintedAnimated = false;
+    for (const auto &row : this->layout_.rowsIn(top, top + this->height()))
+    {
+        const auto &section = this->sections_[row.section];
+        QRect textRect(0, row.y, width, row.height);
+
+        switch (row.kind)
+        {
+            case EmoteGridLayout::Row::Kind::Title:
+                painter.setPen(this->theme->messages.textColors.regular);
+                painter.drawText(textRect, Qt::AlignCenter, section.title);
+                break;
+
+            case EmoteGridLayout::Row::Kind::Note:
+                painter.setPen(this->theme->messages.textColors.system);
+                painter.drawText(textRect, Qt::AlignCenter, section.emptyText);
+                break;
+
+            case EmoteGridLayout::Row::Kind::Emotes:
+                for (size_t i = 0; i < row.count; i++)
+                {
+                    auto cell = this->layout_.cellRect(row, i);
+                    if (this->hoveredItem_ ==
+                        EmoteGridLayout::ItemIndex{row.section, row.first + i})
+                    {
+                        painter.fillRect(cell, this->theme->messages.selection);
+                    }
+
+                    const auto &emote = section.items[row.first + i].emote;
+                    const auto &image =
+                        emote->images.getImageOrLoaded(imageScale);
+                    auto pixmap = image->pixmapOrLoad();
+                    if (!pixmap)
+                    {
+                        continue;
+                    }
+                    paintedAnimated = paintedAnimated || image->animated();
+
+                    // Only scale down images that don't fit into the cell
+                    auto target = cell.marginsRemoved(
+                        {padding, padding, padding, padding});
+                    QSize size(static_cast<int>(image->width() * scale),
+                               static_cast<int>(image->height() * scale));
+                    if (size.width() > target.width() ||
+                        size.height() > target.height())
+                    {
+                        size.scale(target.size(), Qt::KeepAspectRatio);
+                    }
+
+                    QRect imageRect({}, size);
+                    imageRect.moveCenter(cell.center());
+                    painter.drawPixmap(imageRect, *pixmap);
+                }
+                break;
+        }
+    }
+
+    this->paintedAnimated_ = paintedAnimated;
+}
+
+void EmoteGridView::resizeEvent(QResizeEvent *event)
+{
+    this->scrollBar_->setGeometry(this->width() - this->scrollBar_->width(), 0,
+                                  this->scrollBar_->width(), this->height());
+    this->updateLayout();
+
+    BaseWidget::resizeEvent(event);
+}
+
+void EmoteGridView::wheelEvent(QWheelEvent *event)
+{
+    QCoreApplication::sendEvent(this->scrollBar_, event);
+}
+
+void EmoteGridView::mouseMoveEvent(QMouseEvent *event)
+{
+    this->updateHover(event->pos(), event->globalPosition().toPoint(),
+                      event->modifiers());
+}
+
+void EmoteGridView::mouseReleaseEvent(QMouseEvent *event)
+{
+    if (event->button() != Qt::LeftButton)
+    {
+        return;
+    }
+
+    const auto *item = this->itemAt(this->layout_.itemAt(
+        event->pos() + QPoint(0, this->scrollBar_->value())));
+    if (item != nullptr)
+    {
+        this->linkClicked.invoke(Link(Link::InsertText, item->insertText));
+    }
+}
+
+void EmoteGridView::leaveEvent(QEvent * /*event*/)
+{
+    this->hoveredItem_.reset();
+    this->tooltipWidget_->hide();
+    this->update();
+}
+
+void EmoteGridView::updateHover(QPoint pos, QPoint globalPos,
+                                Qt::KeyboardModifiers modifiers)
+{
+    auto hovered =
+        this->layout_.itemAt(pos + QPoint(0, this->scrollBar_->value()));
+    if (hovered == this->hoveredItem_)
+    {
+        return;
+    }
+    this->hoveredItem_ = hovered;
+    this->update();
+
+    const auto *item = this->itemAt(hovered);
+    if (item == nullptr || item->emote->tooltip.string.isEmpty())
+    {
+        this->tooltipWidget_->hide();
+        return;
+    }
+
+    auto showThumbnailSetting = getSettings()->emotesTooltipPreview.getValue();
+    bool showThumbnail =
+        showThumbnailSetting == ThumbnailPreviewMode::AlwaysShow ||
+        (showThumbnailSetting == ThumbnailPreviewMode::ShowOnShift &&
+         modifiers == Qt::ShiftModifier);
+
+    this->tooltipWidget_->setOne({
+        showThumbnail ? item->emote->images.getImage(3.0) : nullptr,
+        item->emote->tooltip.string,
+    });
+    this->tooltipWidget_->moveTo(globalPos + QPoint(16, 16),
+                                 widgets::BoundsChecking::CursorPosition);
+    this->tooltipWidget_->setWordWrap(false);
+    this->tooltipWidget_->show();
+}
+
+void EmoteGridView::scaleChangedEvent(float newScale)
+{
+    this->scrollBar_->setFixedWidth(
+        static_cast<int>(SCROLLBAR_WIDTH * newScale));
+    this->scrollBar_->setGeometry(this->width() - this->scrollBar_->width(), 0,
+                                  this->scrollBar_->width(), this->height());
+    this->updateLayout();
+}
+
+void EmoteGridView::themeChangedEvent()
+{
+    BaseWidget::themeChangedEvent();
+
+    this->scrollBar_->setStyleSheet(
+        QStringLiteral(R"(
+        QScrollBar {
+            background: %1;
+            border: none;
+        }
+        QScrollBar::add-line,
+        QScrollBar::sub-line,
+        QScrollBar::add-page,
+        QScrollBar::sub-page {
+            width: 0;
+            height: 0;
+            background: none;
+        }
+        QScrollBar::handle {
+            background: %2;
+            min-height: 16;
+        }
+        QScrollBar::handle:hover {
+            background: %3;
+        })")
+            .arg(this->theme->scrollbars.background.name(QColor::HexArgb),
+                 this->theme->scrollbars.thumb.name(QColor::HexArgb),
+                 this->theme->scrollbars.thumbSelected.name(QColor::HexArgb)));
+    this->update();
+}
+
+}  // namespace chatterino
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "widgets/BaseWidget.hpp"
+#include "widgets/helper/EmoteGridLayout.hpp"
+
+#include <pajlada/signals/signal.hpp>
+
+#include <optional>
+#include <vector>
+
+class QScrollBar;
+
+namespace chatterino {
+
+struct Link;
+class TooltipWidget;
+
+/// @brief A scrollable grid of emotes split into titled sections
+///
+/// Unlike a ChannelView, this view doesn't build messages for the emotes.
+/// Only the rows in the viewport are painted and only their images are
+/// requested, so showing thousands of emotes is cheap (see EmoteGridLayout).
+class EmoteGridView : public BaseWidget
+{
+public:
+    explicit EmoteGridView(QWidget *parent = nullptr);
+
+    /// Replaces the shown sections and scrolls to the top
+    void setSections(std::vector<EmoteGridSection> sections);
+
+    /// Scrolls by @a pages viewport heights (negative values scroll up)
+    void scrollPages(int pages);
+
+    /// Invoked with an `InsertText` link when an item is clicked
+    pajlada::Signals::Signal<Link> linkClicked;
+
+protected:
+    void paintEvent(QPaintEvent *event) override;
+    void resizeEvent(QResizeEvent *event) override;
+    void wheelEvent(QWheelEvent *event) override;
+    void mouseMoveEvent(QMouseEvent *event) override;
+    void mouseReleaseEvent(QMouseEvent *event) override;
+    void leaveEvent(QEvent *event) override;
+    void scaleChangedEvent(float newScale) override;
+    void themeChangedEvent() override;
+
+private:
+    void updateLayout();
+    int viewportWidth() const;
+    const EmoteGridItem *itemAt(
+        const std::optional<EmoteGridLayout::ItemIndex> &index) const;
+    void updateHover(QPoint pos, QPoint globalPos,
+                     Qt::KeyboardModifiers modifiers);
+
+    std::vector<EmoteGridSection> sections_;
+    EmoteGridLayout layout_;
+
+    QScrollBar *scrollBar_;
+    TooltipWidget *tooltipWidget_;
+
+    std::optional<EmoteGridLayout::ItemIndex> hoveredItem_;
+    /// Whether an animated image was painted in the last paint event
+    bool paintedAnimated_ = false;
+};
+
+}  // namespace chatterino
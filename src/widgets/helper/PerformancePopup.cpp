@@ -0,0 +1,234 @@
+#include "widgets/helper/PerformancePopup.hpp"
+
+#include "common/Channel.hpp"
+#include "common/Literals.hpp"
+#include "debug/PerformanceCounters.hpp"
+#include "util/Clipboard.hpp"
+
+#include <QFontDatabase>
+#include <QLabel>
+#include <QLocale>
+#include <QPushButton>
+#include <QStringBuilder>
+#include <QTimer>
+#include <QVBoxLayout>
+
+#include <chrono>
+
+namespace {
+
+constexpr int REFRESH_INTERVAL_MS = 1000;
+
+double toMs(std::chrono::steady_clock::duration d)
+{
+    return std::chrono::duration<double, std::milli>(d).count();
+}
+
+double average(std::chrono::steady_clock::duration total, uint64_t count)
+{
+    if (count == 0)
+    {
+        return 0;
+    }
+    return toMs(total) / static_cast<double>(count);
+}
+
+}  // namespace
+
+namespace chatterino {
+
+using namespace literals;
+
+PerformancePopup::PerformancePopup(ChannelView *view)
+    : view_(view)
+    , text_(new QLabel(this))
+{
+    auto *layout = new QVBoxLayout(this);
+    auto *timer = new QTimer(this);
+    auto *copyButton = new QPushButton(u"&Copy"_s);
+
+    this->text_->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+
+    if (this->view_)
+    {
+        this->lastViewStats_ = this->view_->performanceStats();
+    }
+    const auto &counters = PerformanceCounters::instance();
+    this->lastMessagesIngested_ = counters.messagesIngested.load();
+    this->lastFilterEvaluationsRequested_ =
+        counters.filterEvaluationsRequested.load();
+    this->lastFilterEvaluations_ = counters.filterEvaluations.load();
+    this->lastImagesDecoded_ = counters.imagesDecoded.load();
+    this->lastHttpFinished_ = counters.httpRequestsFinished.load();
+    this->lastHttp2Finished_ = counters.http2RequestsFinished.load();
+    this->lastHttpQueueTimeMs_ = counters.httpQueueTimeMs.load();
+    this->lastHttpRequestTimeMs_ = counters.httpRequestTimeMs.load();
+    this->lastHelixCompleted_ = counters.helixLookupsCompleted.load();
+    this->lastHelixLatencyMs_ = counters.helixLookupLatencyMs.load();
+    this->sinceLastRefresh_.start();
+
+    QObject::connect(timer, &QTimer::timeout, this, [this] {
+        this->refresh();
+    });
+    timer->start(REFRESH_INTERVAL_MS);
+    this->text_->setText(u"Collecting..."_s);
+
+    layout->addWidget(this->text_);
+    layout->addWidget(copyButton, 1);
+
+    QObject::connect(copyButton, &QPushButton::clicked, this, [this] {
+        crossPlatformCopy(this->text_->text());
+    });
+}
+
+void PerformancePopup::refresh()
+{
+    auto seconds =
+        static_cast<double>(this->sinceLastRefresh_.restart()) / 1000.0;
+    if (seconds <= 0)
+    {
+        return;
+    }
+
+    QLocale locale;
+    auto rate = [&](uint64_t now, uint64_t before) {
+        return locale.toString(static_cast<double>(now - before) / seconds,
+                               'f', 1);
+    };
+    auto ms = [&](double value) -> QString {
+        return locale.toString(value, 'f', 2) % u" ms";
+    };
+
+    QString text;
+
+    if (this->view_)
+    {
+        const auto &stats = this->view_->performanceStats();
+        const auto &last = this->lastViewStats_;
+        auto frames = stats.frames - last.frames;
+        auto layouts = stats.layouts - last.layouts;
+        auto laidOut = stats.messagesLaidOut - last.messagesLaidOut;
+
+        text += u"View: "_s % this->view_->underlyingChannel()->getName() %
+                u"\nFrames/s: "_s % rate(stats.frames, last.frames) %
+                u"\nFrame time (avg): "_s %
+                ms(average(stats.frameTime - last.frameTime, frames)) %
+                u"\nLayout time (avg): "_s %
+                ms(average(stats.layoutTime - last.layoutTime, layouts)) %
+                u"\nMessages laid out per frame: "_s %
+                locale.toString(
+                    frames == 0 ? 0.0
+                                : static_cast<double>(laidOut) /
+                                      static_cast<double>(frames),
+                    'f', 1) %
+                u"\nPixmap buffers: "_s %
+                locale.formattedDataSize(this->view_->bufferMemoryUsage()) %
+                u"\nGIF repaints/s: "_s %
+                rate(stats.gifRepaints, last.gifRepaints) % u"\n\n"_s;
+
+        this->lastViewStats_ = stats;
+    }
+    else
+    {
+        text += u"View: (closed)\n\n"_s;
+    }
+
+    const auto &counters = PerformanceCounters::instance();
+    auto messagesIngested = counters.messagesIngested.load();
+    auto imagesDecoded = counters.imagesDecoded.load();
+
+    text += u"Messages ingested/s: "_s %
+            rate(messagesIngested, this->lastMessagesIngested_) %
+            u"\nImages decoded/s: "_s %
+            rate(imagesDecoded, this->lastImagesDecoded_) %
+            u"\nPending image loads: "_s %
+            locale.toString(
+                static_cast<qlonglong>(counters.pendingImageLoads.load()));
+
+    auto filterRequested = counters.filterEvaluationsRequested.load();
+    auto filterEvaluations = counters.filterEvaluations.load();
+    auto messages = messagesIngested - this->lastMessagesIngested_;
+    auto perMessage = [&](uint64_t now, uint64_t before) {
+        if (messages == 0)
+        {
+            return locale.toString(0.0, 'f', 2);
+        }
+        return locale.toString(
+            static_cast<double>(now - before) / static_cast<double>(messages),
+            'f', 2);
+    };
+
+    text += u"\nFilter evaluations per message: "_s %
+            perMessage(filterEvaluations, this->lastFilterEvaluations_) %
+            u" (requested: "_s %
+            perMessage(filterRequested,
+                       this->lastFilterEvaluationsRequested_) %
+            u")"_s;
+
+    auto httpFinished = counters.httpRequestsFinished.load();
+    auto http2Finished = counters.http2RequestsFinished.load();
+    auto httpQueueTimeMs = counters.httpQueueTimeMs.load();
+    auto httpRequestTimeMs = counters.httpRequestTimeMs.load();
+    auto requests = httpFinished - this->lastHttpFinished_;
+    auto msAverage = [&](uint64_t now, uint64_t before) {
+        if (requests == 0)
+        {
+            return ms(0);
+        }
+        return ms(static_cast<double>(now - before) /
+                  static_cast<double>(requests));
+    };
+
+    text += u"\n\nHTTP requests running: "_s %
+            locale.toString(
+                static_cast<qlonglong>(counters.httpRequestsRunning.load())) %
+            u"\nHTTP requests queued: "_s %
+            locale.toString(
+                static_cast<qlonglong>(counters.httpRequestsQueued.load())) %
+            u"\nHTTP requests finished/s: "_s %
+            rate(httpFinished, this->lastHttpFinished_) %
+            u"\nHTTP queue time (avg): "_s %
+            msAverage(httpQueueTimeMs, this->lastHttpQueueTimeMs_) %
+            u"\nHTTP request time (avg): "_s %
+            msAverage(httpRequestTimeMs, this->lastHttpRequestTimeMs_) %
+            u"\nHTTP/2 requests/s: "_s %
+            rate(http2Finished, this->lastHttp2Finished_) %
+            u"\nHTTP requests coalesced: "_s %
+            locale.toString(static_cast<qulonglong>(
+                counters.httpRequestsCoalesced.load()));
+
+    auto helixCompleted = counters.helixLookupsCompleted.load();
+    auto helixLatencyMs = counters.helixLookupLatencyMs.load();
+    auto helixLookups = helixCompleted - this->lastHelixCompleted_;
+
+    text += u"\n\nHelix lookups queued: "_s %
+            locale.toString(
+                static_cast<qlonglong>(counters.helixLookupsQueued.load())) %
+            u"\nHelix lookup latency (avg): "_s %
+            ms(helixLookups == 0
+                   ? 0.0
+                   : static_cast<double>(helixLatencyMs -
+                                         this->lastHelixLatencyMs_) /
+                         static_cast<double>(helixLookups)) %
+            u"\nHelix batches sent: "_s %
+            locale.toString(
+                static_cast<qulonglong>(counters.helixBatchesSent.load())) %
+            u"\nHelix rate limit waits: "_s %
+            locale.toString(
+                static_cast<qulonglong>(counters.helixRateLimitWaits.load()));
+
+    this->lastMessagesIngested_ = messagesIngested;
+    this->lastFilterEvaluationsRequested_ = filterRequested;
+    this->lastFilterEvaluations_ = filterEvaluations;
+    this->lastImagesDecoded_ = imagesDecoded;
+    this->lastHttpFinished_ = httpFinished;
+    this->lastHttp2Finished_ = http2Finished;
+    this->lastHttpQueueTimeMs_ = httpQueueTimeMs;
+    this->lastHttpRequestTimeMs_ = httpRequestTimeMs;
+    this->lastHelixCompleted_ = helixCompleted;
+    this->lastHelixLatencyMs_ = helixLatencyMs;
+
+    this->text_->setText(text);
+}
+
+}  // namespace chatterino
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "widgets/BasePopup.hpp"
+#include "widgets/helper/ChannelView.hpp"
+
+#include <QElapsedTimer>
+#include <QPointer>
+
+#include <cstdint>
+
+class QLabel;
+
+namespace chatterino {
+
+/// Shows live painting/layout numbers of one ChannelView together with
+/// process-wide message, image and network counters.
+class PerformancePopup : public BasePopup
+{
+public:
+    explicit PerformancePopup(ChannelView *view);
+
+private:
+    void refresh();
+
+    QPointer<ChannelView> view_;
+    QLabel *text_;
+
+    QElapsedTimer sinceLastRefresh_;
+    ChannelView::PerformanceStats lastViewStats_;
+    uint64_t lastMessagesIngested_ = 0;
+    uint64_t lastFilterEvaluationsRequested_ = 0;
+    uint64_t lastFilterEvaluations_ = 0;
+    uint64_t lastImagesDecoded_ = 0;
+    uint64_t lastHttpFinished_ = 0;
+    uint64_t lastHttp2Finished_ = 0;
+    uint64_t lastHttpQueueTimeMs_ = 0;
+    uint64_t lastHttpRequestTimeMs_ = 0;
+    uint64_t lastHelixCompleted_ = 0;
+    uint64_t lastHelixLatencyMs_ = 0;
+};
+
+}  // namespace chatterino
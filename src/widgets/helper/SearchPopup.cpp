@@ -4,6 +4,7 @@
 #include "common/Channel.hpp"
 #include "controllers/filters/FilterSet.hpp"
 #include "controllers/hotkeys/HotkeyController.hpp"
+#include "messages/MessageBuilder.hpp"
 #include "messages/MessageElement.hpp"
 #include "messages/search/AuthorPredicate.hpp"
 #include "messages/search/BadgePredicate.hpp"
@@ -13,32 +14,55 @@
 #include "messages/search/RegexPredicate.hpp"
 #include "messages/search/SubstringPredicate.hpp"
 #include "messages/search/SubtierPredicate.hpp"
+#include "singletons/helper/LoggingChannel.hpp"
+#include "singletons/helper/LogSearch.hpp"
 #include "singletons/Settings.hpp"
 #include "singletons/Theme.hpp"
 #include "singletons/WindowManager.hpp"
+#include "util/PostToThread.hpp"
 #include "widgets/helper/ChannelView.hpp"
 #include "widgets/splits/Split.hpp"
 
 #include <QHBoxLayout>
 #include <QLineEdit>
+#include <QPointer>
 #include <QPushButton>
+#include <QtConcurrent>
+
+namespace {
+
+// This regex captures all name:value predicate pairs into named capturing
+// groups and matches all other inputs seperated by spaces as normal
+// strings.
+// It also ignores whitespaces in values when being surrounded by quotation
+// marks, to enable inputs like this => regex:"kappa 123"
+const QRegularExpression &predicateRegex()
+{
+    static QRegularExpression regex(
+        R"lit((?<negation>[!\-])?(?:(?<name>\w+):(?<value>".+?"|[^\s]+))|[^\s]+?(?=$|\s))lit");
+    return regex;
+}
+
+const QRegularExpression &trimQuotationMarksRegex()
+{
+    static QRegularExpression regex(R"(^"|"$)");
+    return regex;
+}
+
+}  // namespace
 
 namespace chatterino {
 
-ChannelPtr SearchPopup::filter(const QString &text, const QString &channelName,
-                               const LimitedQueueSnapshot<MessagePtr> &snapshot)
+ChannelPtr SearchPopup::filter(
+    const std::vector<std::unique_ptr<MessagePredicate>> &predicates,
+    const QString &channelName, const std::vector<MessagePtr> &messages)
 {
     ChannelPtr channel(new Channel(channelName, Channel::Type::None));
 
-    // Parse predicates from tags in "text"
-    auto predicates = parsePredicates(text);
-
     // Check for every message whether it fulfills all predicates that have
     // been registered
-    for (size_t i = 0; i < snapshot.size(); ++i)
+    for (const auto &message : messages)
     {
-        MessagePtr message = snapshot[i];
-
         bool accept = true;
         for (const auto &pred : predicates)
         {
@@ -72,6 +96,11 @@ SearchPopup::SearchPopup(QWidget *parent, Split *split)
           parent)
     , split_(split)
 {
+    this->logSearchTimer_.setSingleShot(true);
+    this->logSearchTimer_.setInterval(300);
+    QObject::connect(&this->logSearchTimer_, &QTimer::timeout, this,
+                     &SearchPopup::searchLogs);
+
     this->initLayout();
     if (this->split_ && this->split_->getChannelView().hasSelection())
     {
@@ -85,6 +114,20 @@ SearchPopup::SearchPopup(QWidget *parent, Split *split)
     this->themeChangedEvent();
 }
 
+SearchPopup::~SearchPopup()
+{
+    // Stop a running log search
+    (*this->logSearchGeneration_)++;
+
+    for (const auto &weak : this->indexedChannels_)
+    {
+        if (auto channel = weak.lock())
+        {
+            channel->releaseSearchIndex();
+        }
+    }
+}
+
 void SearchPopup::addShortcuts()
 {
     HotkeyController::HotkeyMap actions{
@@ -129,6 +172,16 @@ void SearchPopup::addChannel(ChannelView &channel)
     }
 
     this->searchChannels_.append(std::ref(channel));
+    channel.channel()->retainSearchIndex();
+    this->indexedChannels_.emplace_back(channel.channel());
+
+    // Logs are only searched for a single Twitch channel
+    this->logsButton_->setVisible(this->searchChannels_.size() == 1 &&
+                                  channel.channel()->isTwitchChannel());
+    if (this->logsButton_->isHidden())
+    {
+        this->logsButton_->setChecked(false);
+    }
 
     this->updateWindowTitle();
 }
@@ -224,22 +277,81 @@ void SearchPopup::themeChangedEvent()
 
 void SearchPopup::search()
 {
-    if (this->snapshot_.size() == 0)
+    // Any running log search is outdated now
+    (*this->logSearchGeneration_)++;
+
+    if (this->logsButton_->isChecked())
     {
-        this->snapshot_ = this->buildSnapshot();
+        this->logSearchTimer_.start();
+        return;
     }
+    this->logSearchTimer_.stop();
+
+    // Parse predicates from tags in the input
+    auto predicates = parsePredicates(this->searchInput_->text());
+
+    QStringList substrings;
+    for (const auto &pred : predicates)
+    {
+        auto substring = pred->requiredSubstring();
+        if (!substring.isEmpty())
+        {
+            substrings.append(substring);
+        }
+    }
+
+    this->channelView_->setChannel(filter(predicates, this->channelName_,
+                                          this->collectCandidates(substrings)));
+}
+
+void SearchPopup::searchLogs()
+{
+    auto query = parseLogQuery(this->searchInput_->text());
+    auto directory = LoggingChannel::logDirectory(this->channelName_,
+                                                  QStringLiteral("twitch"));
+    auto counter = this->logSearchGeneration_;
+    auto generation = ++(*counter);
+
+    std::ignore = QtConcurrent::run([self = QPointer(this), directory,
+                                     channelName = this->channelName_,
+                                     query = std::move(query), counter,
+                                     generation] {
+        auto results =
+            chatterino::searchLogs(directory, channelName, query, [&] {
+                return *counter != generation;
+            });
+
+        postToThread([self, channelName, results = std::move(results),
+                      counter, generation] {
+            if (!self || *counter != generation)
+            {
+                return;
+            }
 
-    this->channelView_->setChannel(filter(this->searchInput_->text(),
-                                          this->channelName_, this->snapshot_));
+            ChannelPtr channel(new Channel(channelName, Channel::Type::None));
+            for (const auto &result : results)
+            {
+                auto message = MessageBuilder(
+                                   systemMessage,
+                                   result.time.toString("yyyy-MM-dd ") +
+                                       result.text,
+                                   result.time.time())
+                                   .release();
+                channel->addMessage(message, MessageContext::Repost);
+            }
+            self->channelView_->setChannel(channel);
+        });
+    });
 }
 
-LimitedQueueSnapshot<MessagePtr> SearchPopup::buildSnapshot()
+std::vector<MessagePtr> SearchPopup::collectCandidates(
+    const QStringList &substrings)
 {
     // no point in filtering/sorting if it's a single channel search
     if (this->searchChannels_.length() == 1)
     {
         const auto channelPtr = this->searchChannels_.at(0);
-        return channelPtr.get().channel()->getMessageSnapshot();
+        return channelPtr.get().channel()->findSearchCandidates(substrings);
     }
 
     auto combinedSnapshot = std::vector<std::shared_ptr<const Message>>{};
@@ -248,10 +360,10 @@ LimitedQueueSnapshot<MessagePtr> SearchPopup::buildSnapshot()
         ChannelView &sharedView = channel.get();
 
         const FilterSetPtr filterSet = sharedView.getFilterSet();
-        const LimitedQueueSnapshot<MessagePtr> &snapshot =
-            sharedView.channel()->getMessageSnapshot();
+        const auto candidates =
+            sharedView.channel()->findSearchCandidates(substrings);
 
-        for (const auto &message : snapshot)
+        for (const auto &message : candidates)
         {
             if (filterSet && !filterSet->filter(message, sharedView.channel()))
             {
@@ -283,10 +395,7 @@ LimitedQueueSnapshot<MessagePtr> SearchPopup::buildSnapshot()
                   return a->serverReceivedTime < b->serverReceivedTime;
               });
 
-    auto queue = LimitedQueue<MessagePtr>(combinedSnapshot.size());
-    queue.pushFront(combinedSnapshot);
-
-    return queue.getSnapshot();
+    return combinedSnapshot;
 }
 
 void SearchPopup::initLayout()
@@ -317,6 +426,21 @@ void SearchPopup::initLayout()
                 this->searchInput_->installEventFilter(this);
             }
 
+            // LOGS TOGGLE
+            {
+                this->logsButton_ = new QPushButton("Logs", this);
+                this->logsButton_->setCheckable(true);
+                this->logsButton_->setToolTip(
+                    "Search the chat logs of this channel on disk.\n"
+                    "Supports from:user, since:yyyy-MM-dd and "
+                    "until:yyyy-MM-dd.");
+                this->logsButton_->hide();
+                layout2->addWidget(this->logsButton_);
+
+                QObject::connect(this->logsButton_, &QPushButton::toggled,
+                                 this, &SearchPopup::search);
+            }
+
             layout1->addLayout(layout2);
         }
 
@@ -338,16 +462,7 @@ void SearchPopup::initLayout()
 std::vector<std::unique_ptr<MessagePredicate>> SearchPopup::parsePredicates(
     const QString &input)
 {
-    // This regex captures all name:value predicate pairs into named capturing
-    // groups and matches all other inputs seperated by spaces as normal
-    // strings.
-    // It also ignores whitespaces in values when being surrounded by quotation
-    // marks, to enable inputs like this => regex:"kappa 123"
-    static QRegularExpression predicateRegex(
-        R"lit((?<negation>[!\-])?(?:(?<name>\w+):(?<value>".+?"|[^\s]+))|[^\s]+?(?=$|\s))lit");
-    static QRegularExpression trimQuotationMarksRegex(R"(^"|"$)");
-
-    QRegularExpressionMatchIterator it = predicateRegex.globalMatch(input);
+    QRegularExpressionMatchIterator it = predicateRegex().globalMatch(input);
 
     std::vector<std::unique_ptr<MessagePredicate>> predicates;
 
@@ -358,7 +473,7 @@ std::vector<std::unique_ptr<MessagePredicate>> SearchPopup::parsePredicates(
         QString name = match.captured("name");
         bool isNegated = !match.captured("negation").isEmpty();
         QString value = match.captured("value");
-        value.remove(trimQuotationMarksRegex);
+        value.remove(trimQuotationMarksRegex());
 
         // match predicates
 
@@ -406,4 +521,38 @@ std::vector<std::unique_ptr<MessagePredicate>> SearchPopup::parsePredicates(
     return predicates;
 }
 
+LogSearchQuery SearchPopup::parseLogQuery(const QString &input)
+{
+    LogSearchQuery query;
+
+    QRegularExpressionMatchIterator it = predicateRegex().globalMatch(input);
+    while (it.hasNext())
+    {
+        QRegularExpressionMatch match = it.next();
+
+        QString name = match.captured("name");
+        QString value = match.captured("value");
+        value.remove(trimQuotationMarksRegex());
+
+        if (name == "from")
+        {
+            query.user = value;
+        }
+        else if (name == "since")
+        {
+            query.from = QDate::fromString(value, Qt::ISODate);
+        }
+        else if (name == "until")
+        {
+            query.to = QDate::fromString(value, Qt::ISODate);
+        }
+        else
+        {
+            query.words.append(match.captured());
+        }
+    }
+
+    return query;
+}
+
 }  // namespace chatterino
@@ -1,22 +1,28 @@
 #pragma once
 
 #include "ForwardDecl.hpp"
-#include "messages/LimitedQueueSnapshot.hpp"
 #include "widgets/BasePopup.hpp"
 
+#include <QTimer>
+
+#include <atomic>
 #include <memory>
+#include <vector>
 
 class QLineEdit;
+class QPushButton;
 
 namespace chatterino {
 
 class Split;
 class MessagePredicate;
+struct LogSearchQuery;
 
 class SearchPopup : public BasePopup
 {
 public:
     SearchPopup(QWidget *parent, Split *split = nullptr);
+    ~SearchPopup() override;
 
     virtual void addChannel(ChannelView &channel);
     void goToMessage(const MessagePtr &message);
@@ -37,23 +43,33 @@ protected:
 private:
     void initLayout();
     void search();
+    void searchLogs();
     void addShortcuts() override;
-    LimitedQueueSnapshot<MessagePtr> buildSnapshot();
+
+    /**
+     * @brief Collects the messages of all searched channels that might
+     *        contain every one of @a substrings.
+     *
+     * Uses the search index of each channel to skip messages that can't
+     * match. Messages from multiple channels are filtered through the view's
+     * filters, deduplicated and sorted by time.
+     */
+    std::vector<MessagePtr> collectCandidates(const QStringList &substrings);
 
     /**
      * @brief Only retains those message from a list of messages that satisfy a
      *        search query.
      *
-     * @param text          the search query -- will be parsed for MessagePredicates
+     * @param predicates    the predicates parsed from the search query
      * @param channelName   name of the channel to be returned
-     * @param snapshot      list of messages to filter
-     * @param filterSet     channel filter to apply
+     * @param messages      list of messages to filter
      *
      * @return a ChannelPtr with "channelName" and the filtered messages from
-     *         "snapshot"
+     *         "messages"
      */
-    static ChannelPtr filter(const QString &text, const QString &channelName,
-                             const LimitedQueueSnapshot<MessagePtr> &snapshot);
+    static ChannelPtr filter(
+        const std::vector<std::unique_ptr<MessagePredicate>> &predicates,
+        const QString &channelName, const std::vector<MessagePtr> &messages);
 
     /**
      * @brief Checks the input for tags and registers their corresponding
@@ -65,12 +81,28 @@ private:
     static std::vector<std::unique_ptr<MessagePredicate>> parsePredicates(
         const QString &input);
 
-    LimitedQueueSnapshot<MessagePtr> snapshot_;
+    /**
+     * @brief Parses the input for a search in the on-disk logs.
+     *
+     * Supports `from:user`, `since:yyyy-MM-dd` and `until:yyyy-MM-dd`. All
+     * other words have to start a word in a line.
+     */
+    static LogSearchQuery parseLogQuery(const QString &input);
+
     QLineEdit *searchInput_{};
+    QPushButton *logsButton_{};
+    /// Delays log searches until the input stopped changing
+    QTimer logSearchTimer_;
+    /// Incremented for every search to cancel outdated log searches. Shared
+    /// with the running search, which might outlive the popup.
+    std::shared_ptr<std::atomic<uint64_t>> logSearchGeneration_ =
+        std::make_shared<std::atomic<uint64_t>>(0);
     ChannelView *channelView_{};
     QString channelName_{};
     Split *split_ = nullptr;
     QList<std::reference_wrapper<ChannelView>> searchChannels_;
+    /// Channels whose search index is retained while this popup is open
+    std::vector<std::weak_ptr<Channel>> indexedChannels_;
 };
 
 }  // namespace chatterino
@@ -1311,6 +1311,14 @@ void GeneralPage::initLayout(GeneralPageView &layout)
         "\"Subscribed Reply Threads\" highlight settings.");
     layout.addCheckbox("Load message history on connect",
                        s.loadTwitchMessageHistoryOnConnect);
+    layout.addCheckbox(
+        "Only load channels in hidden tabs when they're opened",
+        s.lazyChannelActivation, false,
+        "When enabled, channels in tabs that aren't shown only join chat. "
+        "Message history, channel emotes and moderation events are loaded "
+        "once the tab is opened for the first time.\n"
+        "This speeds up starting with many tabs. Applies to channels opened "
+        "after changing this.");
     // TODO: Change phrasing to use better english once we can tag settings, right now it's kept as history instead of historical so that the setting shows up when the user searches for history
     layout.addIntInput("Max number of history messages to load on connect",
                        s.twitchMessageHistoryLimit, 10, 800, 10);
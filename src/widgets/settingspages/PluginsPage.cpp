@@ -3,6 +3,7 @@
 
 #    include "Application.hpp"
 #    include "common/Args.hpp"
+#    include "controllers/plugins/Plugin.hpp"
 #    include "controllers/plugins/PluginController.hpp"
 #    include "singletons/Paths.hpp"
 #    include "singletons/Settings.hpp"
@@ -18,6 +19,79 @@
 #    include <QPushButton>
 #    include <QWidget>
 
+#    include <chrono>
+#    include <cstdint>
+
+namespace {
+
+using namespace chatterino;
+
+QString formatMiB(size_t bytes)
+{
+    return QString::number(static_cast<double>(bytes) / (1024.0 * 1024.0),
+                           'f', 1) +
+           " MiB";
+}
+
+QString formatMs(std::chrono::nanoseconds duration)
+{
+    return QString::number(
+               std::chrono::duration<double, std::milli>(duration).count(),
+               'f', 2) +
+           " ms";
+}
+
+/// Formats the memory usage and per-callback timings of @a plugin
+QString formatStats(const Plugin &plugin)
+{
+    QString text;
+    if (const auto *limits = plugin.limits())
+    {
+        text += QString("Memory: %1 (peak %2, limit %3)")
+                    .arg(formatMiB(limits->memoryUsed),
+                         formatMiB(limits->memoryPeak),
+                         formatMiB(limits->memoryLimit));
+        if (limits->failedAllocations > 0)
+        {
+            text += QString(", %1 allocations refused")
+                        .arg(limits->failedAllocations);
+        }
+    }
+
+    for (const auto &[label, stats] : plugin.callbackStats)
+    {
+        if (!text.isEmpty())
+        {
+            text += '\n';
+        }
+        // entries are only created by a call, so calls is never zero
+        auto average = stats.total / static_cast<int64_t>(stats.calls);
+        text += QString("%1: %2 calls, avg %3, max %4")
+                    .arg(label)
+                    .arg(stats.calls)
+                    .arg(formatMs(average), formatMs(stats.max));
+        if (stats.budgetExceeded > 0)
+        {
+            text += QString(", %1 aborted (instruction budget)")
+                        .arg(stats.budgetExceeded);
+        }
+    }
+
+    if (plugin.totalDroppedMessages > 0)
+    {
+        if (!text.isEmpty())
+        {
+            text += '\n';
+        }
+        text += QString("%1 received messages dropped because the plugin fell "
+                        "behind")
+                    .arg(plugin.totalDroppedMessages);
+    }
+    return text;
+}
+
+}  // namespace
+
 namespace chatterino {
 
 PluginsPage::PluginsPage()
@@ -176,6 +250,14 @@ void PluginsPage::rebuildContent()
         }
         pluginEntry->addRow("Commands",
                             new QLabel(commandsTxt, this->dataFrame_));
+
+        auto statsTxt = formatStats(*plugin);
+        if (!statsTxt.isEmpty())
+        {
+            auto *statsLabel = new QLabel(statsTxt, this->dataFrame_);
+            statsLabel->setTextInteractionFlags(Qt::TextSelectableByMouse);
+            pluginEntry->addRow("Statistics", statsLabel);
+        }
         if (!plugin->meta.permissions.empty())
         {
             QString perms = "<ul>";
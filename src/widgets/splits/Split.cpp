@@ -26,6 +26,7 @@
 #include "widgets/helper/ChannelView.hpp"
 #include "widgets/helper/DebugPopup.hpp"
 #include "widgets/helper/NotebookTab.hpp"
+#include "widgets/helper/PerformancePopup.hpp"
 #include "widgets/helper/ResizingTextEdit.hpp"
 #include "widgets/helper/SearchPopup.hpp"
 #include "widgets/Notebook.hpp"
@@ -490,6 +491,15 @@ void Split::addShortcuts()
              popup->show();
              return "";
          }},
+        {"performance",
+         [this](const std::vector<QString> &) -> QString {
+             auto *popup = new PerformancePopup(this->view_);
+             popup->setAttribute(Qt::WA_DeleteOnClose);
+             popup->setWindowTitle("Chatterino - Performance - " +
+                                   this->getChannel()->getName());
+             popup->show();
+             return "";
+         }},
         {"focus",
          [this](const std::vector<QString> &arguments) -> QString {
              if (arguments.empty())
@@ -984,6 +994,8 @@ void Split::setChannel(IndirectChannel newChannel)
             this->actionRequested.invoke(Action::RefreshTab);
         });
 
+    this->activateChannel();
+
     this->channelChanged.invoke();
     this->actionRequested.invoke(Action::RefreshTab);
 
@@ -1093,6 +1105,27 @@ void Split::resizeEvent(QResizeEvent *event)
     this->overlay_->setGeometry(this->rect());
 }
 
+void Split::showEvent(QShowEvent *event)
+{
+    BaseWidget::showEvent(event);
+
+    this->activateChannel();
+}
+
+void Split::activateChannel()
+{
+    if (!this->isVisible())
+    {
+        return;
+    }
+
+    auto *tc = dynamic_cast<TwitchChannel *>(this->getChannel().get());
+    if (tc != nullptr)
+    {
+        tc->activate();
+    }
+}
+
 void Split::enterEvent(QEnterEvent * /*event*/)
 {
     this->isMouseOver_ = true;
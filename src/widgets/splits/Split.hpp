@@ -110,6 +110,7 @@ protected:
     void keyPressEvent(QKeyEvent *event) override;
     void keyReleaseEvent(QKeyEvent *event) override;
     void resizeEvent(QResizeEvent *event) override;
+    void showEvent(QShowEvent *event) override;
     void enterEvent(QEnterEvent * /*event*/) override;
     void leaveEvent(QEvent *event) override;
 
@@ -117,6 +118,9 @@ protected:
     void dropEvent(QDropEvent *event) override;
 
 private:
+    /// Activates the channel if it's a Twitch channel and this split is
+    /// visible (see TwitchChannel::activate)
+    void activateChannel();
     void channelNameUpdated(const QString &newChannelName);
     void handleModifiers(Qt::KeyboardModifiers modifiers);
     void updateInputPlaceholder();
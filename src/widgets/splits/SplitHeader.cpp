@@ -783,6 +783,10 @@ void SplitHeader::handleChannelChanged()
             twitchChannel->streamStatusChanged, [this]() {
                 this->updateChannelText();
             });
+        this->channelConnections_.managedConnect(
+            twitchChannel->queuedMessagesChanged, [this]() {
+                this->updateChannelText();
+            });
     }
 }
 
@@ -870,6 +874,11 @@ void SplitHeader::updateChannelText()
         {
             this->tooltipText_ = formatOfflineTooltip(*streamStatus);
         }
+
+        if (auto queued = twitchChannel->queuedMessages(); queued > 0)
+        {
+            title += QString(" - %1 queued").arg(queued);
+        }
     }
 
     if (!title.isEmpty() && !this->split_->getFilters().empty())
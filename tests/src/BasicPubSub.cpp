@@ -1,3 +1,4 @@
+#include "mocks/BaseApplication.hpp"
 #include "providers/liveupdates/BasicPubSubClient.hpp"
 #include "providers/liveupdates/BasicPubSubManager.hpp"
 #include "Test.hpp"
@@ -98,14 +99,12 @@ public:
     }
 
 protected:
-    void onMessage(
-        websocketpp::connection_hdl /*hdl*/,
-        BasicPubSubManager<DummySubscription>::WebsocketMessagePtr msg) override
+    void onMessage(BasicPubSubClient<DummySubscription> & /*client*/,
+                   const QByteArray &payload) override
     {
         std::lock_guard<std::mutex> guard(this->messageMtx_);
         this->messagesReceived.fetch_add(1, std::memory_order_acq_rel);
-        this->messageQueue_.emplace_back(
-            QString::fromStdString(msg->get_payload()));
+        this->messageQueue_.emplace_back(QString::fromUtf8(payload));
     }
 
 private:
@@ -116,6 +115,7 @@ private:
 TEST(BasicPubSub, SubscriptionCycle)
 {
     const QString host("wss://127.0.0.1:9050/liveupdates/sub-unsub");
+    mock::BaseApplication app;
     MyManager manager(host);
     manager.start();
 
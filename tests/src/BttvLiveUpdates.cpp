@@ -1,5 +1,6 @@
 #include "providers/bttv/BttvLiveUpdates.hpp"
 
+#include "mocks/BaseApplication.hpp"
 #include "Test.hpp"
 
 #include <QString>
@@ -16,6 +17,7 @@ const QString TARGET_USER_NAME = "Alien";
 TEST(BttvLiveUpdates, AllEvents)
 {
     const QString host("wss://127.0.0.1:9050/liveupdates/bttv/all-events");
+    mock::BaseApplication app;
     chatterino::BttvLiveUpdates liveUpdates(host);
     liveUpdates.start();
 
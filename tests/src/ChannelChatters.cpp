@@ -3,6 +3,7 @@
 #include "mocks/BaseApplication.hpp"
 #include "mocks/Channel.hpp"
 #include "mocks/Logging.hpp"
+#include "mocks/UserData.hpp"
 #include "Test.hpp"
 
 #include <QColor>
@@ -23,7 +24,13 @@ public:
         return &this->logging;
     }
 
+    IUserDataController *getUserData() override
+    {
+        return &this->userData;
+    }
+
     mock::EmptyLogging logging;
+    mock::UserDataController userData;
 };
 
 }  // namespace
@@ -130,3 +137,27 @@ TEST(ChannelChatters, insertMaxSize)
     EXPECT_EQ(chatters.getUserColor("zneix"), QColor());
     EXPECT_EQ(chatters.getUserColor("user1"), QColor("#00f"));
 }
+
+// Ensure colors of users seen in other channels are used
+TEST(ChannelChatters, getColorFromUserData)
+{
+    MockApplication app;
+
+    MockChannel channel("test");
+
+    ChannelChatters chatters(channel);
+
+    app.userData.updateMetadata({
+        .id = "11148817",
+        .login = "pajlada",
+        .displayName = "pajlada",
+        .color = QColor("#f00"),
+    });
+
+    EXPECT_EQ(chatters.getUserColor("PajLada"), QColor("#f00"));
+    EXPECT_EQ(chatters.colorsSize(), 0);
+
+    // Colors seen in this channel take precedence
+    chatters.setUserColor("pajlada", QColor("#00f"));
+    EXPECT_EQ(chatters.getUserColor("pajlada"), QColor("#00f"));
+}
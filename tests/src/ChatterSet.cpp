@@ -85,3 +85,43 @@ TEST(ChatterSet, MaxSizeLastUsed)
     EXPECT_TRUE(set.contains("pajlada"));
     EXPECT_TRUE(set.contains("Pajlada"));
 }
+
+TEST(ChatterSet, FilterByPrefix)
+{
+    ChatterSet set;
+    set.addRecentChatter("pajlada");
+    set.addRecentChatter("Pajbot");
+    set.addRecentChatter("forsen");
+    set.addRecentChatter("pajaDank");
+
+    // most recent chatters come first
+    EXPECT_EQ(set.filterByPrefix("PAJ"),
+              (std::vector<QString>{"pajaDank", "Pajbot", "pajlada"}));
+    EXPECT_EQ(set.filterByPrefix("pajl"), (std::vector<QString>{"pajlada"}));
+    EXPECT_TRUE(set.filterByPrefix("nymn").empty());
+
+    set.addRecentChatter("pajlada");
+    EXPECT_EQ(set.allWithPrefix("paj"),
+              (std::vector<std::pair<QString, QString>>{
+                  {"pajlada", "pajlada"},
+                  {"pajadank", "pajaDank"},
+                  {"pajbot", "Pajbot"},
+              }));
+}
+
+TEST(ChatterSet, FilterByPrefixAfterEviction)
+{
+    ChatterSet set;
+    set.addRecentChatter("pajlada");
+    for (size_t i = 0; i < ChatterSet::CHATTER_LIMIT; ++i)
+    {
+        set.addRecentChatter(QString("user%1").arg(i));
+    }
+
+    EXPECT_TRUE(set.filterByPrefix("paj").empty());
+    EXPECT_EQ(set.filterByPrefix("user").size(), ChatterSet::CHATTER_LIMIT);
+
+    set.updateOnlineChatters({"user1", "user10", "forsen"});
+    EXPECT_EQ(set.filterByPrefix("user1").size(), 2U);
+    EXPECT_EQ(set.filterByPrefix("for"), (std::vector<QString>{"forsen"}));
+}
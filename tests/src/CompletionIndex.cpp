@@ -0,0 +1,33 @@
+#include "controllers/completion/CompletionIndex.hpp"
+
+#include "Test.hpp"
+
+using namespace chatterino::completion;
+
+TEST(CompletionIndex, FindContaining)
+{
+    CompletionIndex index({
+        "PagMan",
+        "pajaW",
+        "PAJAW",
+        "Clap",
+        ":)",
+        "peepoHappy",
+    });
+
+    EXPECT_EQ(index.size(), 6U);
+    EXPECT_EQ(index.findContaining(u""),
+              (std::vector<uint32_t>{0, 1, 2, 3, 4, 5}));
+
+    // short queries
+    EXPECT_EQ(index.findContaining(u"pa"), (std::vector<uint32_t>{0, 1, 2}));
+    EXPECT_EQ(index.findContaining(u")"), (std::vector<uint32_t>{4}));
+
+    // trigram lookups
+    EXPECT_EQ(index.findContaining(u"paja"), (std::vector<uint32_t>{1, 2}));
+    EXPECT_EQ(index.findContaining(u"APP"), (std::vector<uint32_t>{5}));
+    EXPECT_EQ(index.findContaining(u"man"), (std::vector<uint32_t>{0}));
+    EXPECT_TRUE(index.findContaining(u"xyz").empty());
+    // the trigrams have to be part of the same name
+    EXPECT_TRUE(index.findContaining(u"pajaWpagman").empty());
+}
@@ -1,6 +1,7 @@
 #include "providers/emoji/Emojis.hpp"
 
 #include "common/Literals.hpp"
+#include "providers/emoji/EmojiTable.hpp"
 #include "Test.hpp"
 
 #include <QDebug>
@@ -78,7 +79,7 @@ TEST(Emojis, Parse)
                 break;
             }
         }
-        return emoji->emote;
+        return emojis.getEmote(*emoji);
     };
 
     auto penguin = getEmoji("1F427");
@@ -169,3 +170,81 @@ TEST(Emojis, Parse)
         }
     }
 }
+
+TEST(Emojis, Load)
+{
+    Emojis emojis;
+
+    emojis.load();
+
+    ASSERT_EQ(emojis.replaceShortCodes("foo :penguin: bar"), "foo 🐧 bar");
+    ASSERT_FALSE(emojis.getEmojis().empty());
+    for (const auto &emoji : emojis.getEmojis())
+    {
+        ASSERT_FALSE(emoji->shortCodes.empty());
+    }
+
+    // Emotes are created once and then reused
+    const auto &first = *emojis.getEmojis()[0];
+    auto emote = emojis.getEmote(first);
+    ASSERT_NE(emote, nullptr);
+    ASSERT_EQ(emojis.getEmote(first), emote);
+    ASSERT_EQ(emote->name.string, first.value);
+
+    // Loading again doesn't load the emojis twice
+    auto count = emojis.getEmojis().size();
+    emojis.load();
+    ASSERT_EQ(emojis.getEmojis().size(), count);
+}
+
+TEST(EmojiTable, findShortCode)
+{
+    auto shortCodes = emojitable::shortCodes();
+    ASSERT_FALSE(shortCodes.empty());
+
+    for (const auto &shortCode : shortCodes)
+    {
+        QStringView name(shortCode.name.data(),
+                         static_cast<qsizetype>(shortCode.name.size()));
+        auto entry = emojitable::findShortCode(name);
+        ASSERT_TRUE(entry.has_value()) << name.toString();
+        ASSERT_EQ(*entry, shortCode.entry) << name.toString();
+    }
+
+    auto penguin = emojitable::findShortCode(u"penguin");
+    ASSERT_TRUE(penguin.has_value());
+    ASSERT_TRUE(emojitable::entries()[*penguin].unifiedCode == u"1F427");
+    ASSERT_FALSE(emojitable::findShortCode(u"").has_value());
+    ASSERT_FALSE(emojitable::findShortCode(u"nonexistantcode").has_value());
+    ASSERT_FALSE(emojitable::findShortCode(u"PENGUIN").has_value());
+}
+
+TEST(EmojiTable, startingWith)
+{
+    auto entries = emojitable::entries();
+    // The first emoji is #️⃣
+    auto emojis = emojitable::startingWith(u'#');
+    ASSERT_EQ(emojis.size(), 1);
+    ASSERT_EQ(emojis.front().entry, 0);
+    ASSERT_TRUE(entries.front().unifiedCode == u"0023-FE0F-20E3");
+
+    ASSERT_TRUE(emojitable::startingWith(u'a').empty());
+
+    // Longest emojis first
+    emojis = emojitable::startingWith(u'\xD83D');
+    ASSERT_GT(emojis.size(), 1);
+    for (size_t i = 1; i < emojis.size(); i++)
+    {
+        ASSERT_GE(entries[emojis[i - 1].entry].value.size(),
+                  entries[emojis[i].entry].value.size());
+    }
+
+    // Sorted short codes
+    auto sorted = emojitable::sortedShortCodes();
+    ASSERT_EQ(sorted.size(), emojitable::shortCodes().size());
+    for (size_t i = 1; i < sorted.size(); i++)
+    {
+        ASSERT_TRUE(emojitable::shortCodes()[sorted[i - 1]].name <=
+                    emojitable::shortCodes()[sorted[i]].name);
+    }
+}
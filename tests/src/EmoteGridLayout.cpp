@@ -0,0 +1,146 @@
+#include "widgets/helper/EmoteGridLayout.hpp"
+
+#include "messages/Emote.hpp"
+#include "Test.hpp"
+
+using namespace chatterino;
+
+namespace {
+
+using Kind = EmoteGridLayout::Row::Kind;
+
+EmoteGridSection makeSection(const QString &title, QStringList names)
+{
+    EmoteGridSection section{
+        .title = title,
+        .items = {},
+        .emptyText = "no emotes available",
+    };
+    for (const auto &name : names)
+    {
+        section.items.push_back({
+            .emote = std::make_shared<const Emote>(Emote{.name = {name}}),
+            .name = name,
+            .insertText = name,
+        });
+    }
+    return section;
+}
+
+QStringList names(const EmoteGridSection &section)
+{
+    QStringList result;
+    for (const auto &item : section.items)
+    {
+        result.append(item.name);
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(EmoteGridLayout, rows)
+{
+    std::vector<EmoteGridSection> sections{
+        makeSection("A", {"1", "2", "3", "4", "5"}),
+        makeSection("B", {}),
+        makeSection({}, {"6"}),
+    };
+
+    EmoteGridLayout layout;
+    // 2 columns, centered with 5px on the left
+    layout.layout(sections, 50, 20, 10);
+    ASSERT_EQ(layout.columns(), 2);
+
+    const auto &rows = layout.rows();
+    ASSERT_EQ(rows.size(), 7);
+
+    ASSERT_EQ(rows[0].kind, Kind::Title);
+    ASSERT_EQ(rows[1].kind, Kind::Emotes);
+    ASSERT_EQ(rows[1].first, 0);
+    ASSERT_EQ(rows[1].count, 2);
+    ASSERT_EQ(rows[3].first, 4);
+    ASSERT_EQ(rows[3].count, 1);
+    ASSERT_EQ(rows[4].kind, Kind::Title);
+    ASSERT_EQ(rows[5].kind, Kind::Note);
+    ASSERT_EQ(rows[5].section, 1);
+    ASSERT_EQ(rows[6].kind, Kind::Emotes);
+    ASSERT_EQ(rows[6].section, 2);
+
+    // 3 * 10 (text) + 4 * 20 (emotes)
+    ASSERT_EQ(layout.totalHeight(), 110);
+    ASSERT_EQ(rows[6].y, 90);
+    ASSERT_EQ(layout.cellRect(rows[1], 1), QRect(25, 10, 20, 20));
+}
+
+TEST(EmoteGridLayout, rowsIn)
+{
+    std::vector<EmoteGridSection> sections{
+        makeSection("A", {"1", "2", "3", "4", "5"}),
+    };
+
+    EmoteGridLayout layout;
+    layout.layout(sections, 20, 20, 10);
+    // title at 0, emotes at 10, 30, 50, 70, 90
+    ASSERT_EQ(layout.rows().size(), 6);
+
+    auto rows = layout.rowsIn(0, 10);
+    ASSERT_EQ(rows.size(), 1);
+    ASSERT_EQ(rows.front().kind, Kind::Title);
+
+    rows = layout.rowsIn(29, 51);
+    ASSERT_EQ(rows.size(), 3);
+    ASSERT_EQ(rows.front().y, 10);
+    ASSERT_EQ(rows.back().y, 50);
+
+    rows = layout.rowsIn(110, 200);
+    ASSERT_TRUE(rows.empty());
+}
+
+TEST(EmoteGridLayout, itemAt)
+{
+    std::vector<EmoteGridSection> sections{
+        makeSection("A", {"1", "2", "3"}),
+    };
+
+    EmoteGridLayout layout;
+    layout.layout(sections, 50, 20, 10);
+
+    using Index = EmoteGridLayout::ItemIndex;
+    ASSERT_EQ(layout.itemAt({10, 5}), std::nullopt);   // title
+    ASSERT_EQ(layout.itemAt({2, 15}), std::nullopt);   // left of the grid
+    ASSERT_EQ(layout.itemAt({10, 15}), (Index{0, 0}));
+    ASSERT_EQ(layout.itemAt({30, 15}), (Index{0, 1}));
+    ASSERT_EQ(layout.itemAt({10, 35}), (Index{0, 2}));
+    ASSERT_EQ(layout.itemAt({30, 35}), std::nullopt);  // empty cell
+}
+
+TEST(EmoteSearchIndex, search)
+{
+    EmoteSearchIndex index({
+        makeSection("A", {"Kappa", "KappaPride", "PogChamp"}),
+        makeSection("B", {"forsenE"}),
+        makeSection("C", {"kappa"}),
+    });
+    ASSERT_EQ(index.size(), 5);
+
+    auto result = index.search("KAP");
+    ASSERT_EQ(result.size(), 2);
+    ASSERT_EQ(result[0].title, "A");
+    ASSERT_EQ(names(result[0]), (QStringList{"Kappa", "KappaPride"}));
+    ASSERT_EQ(result[1].title, "C");
+    ASSERT_EQ(names(result[1]), QStringList{"kappa"});
+
+    // narrowed from the previous query
+    result = index.search("kappap");
+    ASSERT_EQ(result.size(), 1);
+    ASSERT_EQ(names(result[0]), QStringList{"KappaPride"});
+
+    // not an extension of the previous query
+    result = index.search("e");
+    ASSERT_EQ(result.size(), 2);
+    ASSERT_EQ(names(result[0]), QStringList{"KappaPride"});
+    ASSERT_EQ(names(result[1]), QStringList{"forsenE"});
+
+    ASSERT_TRUE(index.search("nothing").empty());
+}
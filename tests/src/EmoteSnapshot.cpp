@@ -0,0 +1,80 @@
+#include "providers/EmoteSnapshot.hpp"
+
+#include "messages/Emote.hpp"
+#include "messages/Image.hpp"
+#include "mocks/BaseApplication.hpp"
+#include "Test.hpp"
+
+#include <QByteArray>
+
+using namespace chatterino;
+
+namespace {
+
+class EmoteSnapshotTest : public ::testing::Test
+{
+public:
+    mock::BaseApplication mockApplication;
+};
+
+EmotePtr makeEmote(const QString &name, const QString &id, bool zeroWidth)
+{
+    return std::make_shared<const Emote>(Emote{
+        .name = {name},
+        .images =
+            ImageSet{
+                Image::fromUrl({"https://example.com/" + id + "/1x"}, 1,
+                               {28, 28}),
+                Image::fromUrl({"https://example.com/" + id + "/2x"}, 0.5,
+                               {56, 56}),
+                Image::getEmpty(),
+            },
+        .tooltip = {name + "<br>Channel Emote"},
+        .homePage = {"https://example.com/" + id},
+        .zeroWidth = zeroWidth,
+        .id = {id},
+        .author = {"author"},
+        .baseName = zeroWidth ? std::optional<EmoteName>({"base"})
+                              : std::nullopt,
+    });
+}
+
+}  // namespace
+
+TEST_F(EmoteSnapshotTest, roundtrip)
+{
+    EmoteMap emotes;
+    emotes[{"Kappa"}] = makeEmote("Kappa", "1", false);
+    emotes[{"alias"}] = makeEmote("SoSnowy", "2", true);
+
+    auto data = detail::serializeEmoteSnapshot(emotes, "\"etag\"",
+                                               {"11148817", "extra"});
+    auto snapshot = detail::deserializeEmoteSnapshot(data);
+    ASSERT_TRUE(snapshot.has_value());
+
+    ASSERT_EQ(snapshot->etag, QByteArray("\"etag\""));
+    ASSERT_EQ(snapshot->extra, QStringList({"11148817", "extra"}));
+    ASSERT_EQ(snapshot->emotes.size(), emotes.size());
+    for (const auto &[name, emote] : emotes)
+    {
+        auto it = snapshot->emotes.find(name);
+        ASSERT_NE(it, snapshot->emotes.end()) << name.string.toStdString();
+        ASSERT_EQ(*it->second, *emote) << name.string.toStdString();
+        ASSERT_EQ(it->second->images.getImage1()->expectedSize(),
+                  emote->images.getImage1()->expectedSize());
+        ASSERT_TRUE(it->second->images.getImage3()->isEmpty());
+    }
+}
+
+TEST_F(EmoteSnapshotTest, invalid)
+{
+    ASSERT_FALSE(detail::deserializeEmoteSnapshot({}).has_value());
+    ASSERT_FALSE(
+        detail::deserializeEmoteSnapshot("{\"emotes\": []}").has_value());
+
+    EmoteMap emotes;
+    emotes[{"Kappa"}] = makeEmote("Kappa", "1", false);
+    auto data = detail::serializeEmoteSnapshot(emotes, {}, {});
+    data.chop(8);
+    ASSERT_FALSE(detail::deserializeEmoteSnapshot(data).has_value());
+}
@@ -6,6 +6,7 @@
 #include "mocks/BaseApplication.hpp"
 #include "mocks/Logging.hpp"
 #include "mocks/TwitchIrcServer.hpp"
+#include "mocks/UserData.hpp"
 #include "providers/twitch/eventsub/Connection.hpp"
 #include "Test.hpp"
 #include "util/QCompareTransparent.hpp"
@@ -207,10 +208,16 @@ public:
         return &this->highlights;
     }
 
+    IUserDataController *getUserData() override
+    {
+        return &this->userData;
+    }
+
     mock::EmptyLogging logging;
     mock::MockTwitchIrcServer twitch;
     AccountController accounts;
     HighlightController highlights;
+    mock::UserDataController userData;
 };
 
 std::shared_ptr<TwitchChannel> makeMockTwitchChannel(const QString &name)
@@ -1,8 +1,12 @@
 #include "controllers/accounts/AccountController.hpp"
+#include "controllers/filters/FilterRecord.hpp"
+#include "controllers/filters/FilterResultCache.hpp"
 #include "controllers/filters/lang/expressions/UnaryOperation.hpp"
 #include "controllers/filters/lang/Filter.hpp"
 #include "controllers/filters/lang/Types.hpp"
 #include "controllers/highlights/HighlightController.hpp"
+#include "debug/PerformanceCounters.hpp"
+#include "messages/Message.hpp"
 #include "messages/MessageBuilder.hpp"
 #include "mocks/BaseApplication.hpp"
 #include "mocks/Channel.hpp"
@@ -297,6 +301,55 @@ TEST_F(FiltersF, TypingContextChecks)
     delete privmsg;
 }
 
+TEST_F(FiltersF, ResultCache)
+{
+    auto &cache = FilterResultCache::instance();
+    const auto &counters = PerformanceCounters::instance();
+    cache.clear();
+
+    auto highlighted =
+        std::make_shared<FilterRecord>("highlighted", "flags.highlighted");
+    auto named = std::make_shared<FilterRecord>(
+        "named", R"(channel.name == "pajlada")");
+    ASSERT_TRUE(highlighted->valid());
+    ASSERT_TRUE(named->valid());
+
+    MockChannel channel("pajlada");
+    auto message = std::make_shared<Message>();
+    message->channelName = "pajlada";
+    MessagePtr shared = message;
+
+    auto before = counters.filterEvaluations.load();
+    auto evaluations = [&] {
+        return counters.filterEvaluations.load() - before;
+    };
+
+    ASSERT_FALSE(cache.filter(highlighted, shared, &channel));
+    ASSERT_TRUE(cache.filter(named, shared, &channel));
+    ASSERT_EQ(evaluations(), 2);
+    ASSERT_EQ(cache.size(), 2);
+
+    // Other views with the same filters reuse the results
+    ASSERT_FALSE(cache.filter(highlighted, shared, &channel));
+    ASSERT_TRUE(cache.filter(named, shared, &channel));
+    ASSERT_EQ(evaluations(), 2);
+
+    // The context depends on the flags of the message
+    message->flags.set(MessageFlag::Highlighted);
+    ASSERT_TRUE(cache.filter(highlighted, shared, &channel));
+    ASSERT_EQ(evaluations(), 3);
+
+    // Results of a destroyed filter aren't used for a new one
+    highlighted.reset();
+    auto notHighlighted =
+        std::make_shared<FilterRecord>("not highlighted", "!flags.highlighted");
+    ASSERT_FALSE(cache.filter(notHighlighted, shared, &channel));
+    ASSERT_EQ(evaluations(), 4);
+
+    cache.clear();
+    ASSERT_EQ(cache.size(), 0);
+}
+
 TEST_F(FiltersF, ExpressionDebug)
 {
     struct TestCase {
@@ -0,0 +1,377 @@
+#include "providers/twitch/api/HelixScheduler.hpp"
+
+#include "mocks/Helix.hpp"
+#include "Test.hpp"
+
+#include <QJsonObject>
+
+#include <algorithm>
+#include <thread>
+
+using namespace chatterino;
+using namespace std::chrono_literals;
+using ::testing::_;
+using ::testing::StrictMock;
+
+namespace {
+
+using Clock = HelixRateLimiter::Clock;
+
+const Clock::time_point NOW = Clock::time_point(1'700'000'000s);
+
+HelixUser makeUser(const QString &id)
+{
+    return HelixUser(QJsonObject{{"id", id}, {"login", "user" + id}});
+}
+
+HelixStream makeStream(const QString &id, const QString &login)
+{
+    return HelixStream(QJsonObject{{"user_id", id}, {"user_login", login}});
+}
+
+QStringList makeIDs(int from, int to)
+{
+    QStringList ids;
+    for (int i = from; i < to; i++)
+    {
+        ids.append(QString::number(i));
+    }
+    return ids;
+}
+
+}  // namespace
+
+TEST(HelixRateLimiter, Acquire)
+{
+    HelixRateLimiter limiter;
+    // the bucket starts full
+    EXPECT_EQ(limiter.available(NOW), HelixRateLimiter::DEFAULT_LIMIT);
+
+    limiter.update(800, 3, NOW + 60s, NOW);
+    EXPECT_EQ(limiter.available(NOW), 3);
+    EXPECT_TRUE(limiter.tryAcquire(1, NOW));
+    EXPECT_TRUE(limiter.tryAcquire(1, NOW));
+    // one token is reserved
+    EXPECT_FALSE(limiter.tryAcquire(1, NOW));
+    EXPECT_TRUE(limiter.tryAcquire(0, NOW));
+    EXPECT_FALSE(limiter.tryAcquire(0, NOW));
+}
+
+TEST(HelixRateLimiter, Refill)
+{
+    HelixRateLimiter limiter;
+    // 800 tokens are missing and the bucket is full again in 80s
+    limiter.update(800, 0, NOW + 80s, NOW);
+    EXPECT_EQ(limiter.available(NOW), 0);
+    EXPECT_EQ(limiter.timeUntilAvailable(0, NOW), 100ms);
+    EXPECT_EQ(limiter.timeUntilAvailable(9, NOW), 1000ms);
+
+    EXPECT_EQ(limiter.available(NOW + 1s), 10);
+    EXPECT_EQ(limiter.available(NOW + 40s), 400);
+    EXPECT_EQ(limiter.available(NOW + 500s), 800);
+    EXPECT_EQ(limiter.timeUntilAvailable(0, NOW + 500s), 0ms);
+}
+
+TEST(HelixRateLimiter, ResponsesDontAddTokens)
+{
+    HelixRateLimiter limiter;
+    limiter.update(800, 10, NOW + 60s, NOW);
+    for (int i = 0; i < 5; i++)
+    {
+        ASSERT_TRUE(limiter.tryAcquire(0, NOW));
+    }
+
+    // this response was sent before our requests reached the server
+    limiter.update(800, 10, NOW + 60s, NOW);
+    EXPECT_EQ(limiter.available(NOW), 5);
+
+    // other clients (or requests made without the limiter) used tokens
+    limiter.update(800, 2, NOW + 60s, NOW);
+    EXPECT_EQ(limiter.available(NOW), 2);
+}
+
+TEST(HelixRateLimiter, Headers)
+{
+    HelixRateLimiter limiter;
+    limiter.update(NetworkResult(NetworkResult::NetworkError::NoError, 200, {},
+                                 {
+                                     {"Ratelimit-Limit", "30"},
+                                     {"ratelimit-remaining", "12"},
+                                     {"Ratelimit-Reset", "1700000060"},
+                                 }),
+                   NOW);
+    EXPECT_EQ(limiter.limit(), 30);
+    EXPECT_EQ(limiter.available(NOW), 12);
+
+    // responses without the headers are ignored
+    limiter.update(
+        NetworkResult(NetworkResult::NetworkError::NoError, 200, {}, {}),
+        NOW);
+    EXPECT_EQ(limiter.limit(), 30);
+    EXPECT_EQ(limiter.available(NOW), 12);
+}
+
+TEST(HelixScheduler, MergesLookups)
+{
+    StrictMock<mock::Helix> helix;
+    HelixRateLimiter limiter;
+    HelixScheduler scheduler(limiter, &helix);
+
+    std::vector<HelixUser> first;
+    std::vector<HelixUser> second;
+    scheduler.fetchUsersById(
+        {"1", "2"},
+        [&](const auto &users) {
+            first = users;
+        },
+        [] {
+            FAIL();
+        });
+    scheduler.fetchUsersById(
+        {"2", "3"},
+        [&](const auto &users) {
+            second = users;
+        },
+        [] {
+            FAIL();
+        });
+    EXPECT_EQ(scheduler.queuedLookups(), 2U);
+
+    EXPECT_CALL(helix, fetchUsers(QStringList{"1", "2", "3"}, QStringList{},
+                                  _, _))
+        .WillOnce([](auto, auto, auto success, auto) {
+            success({makeUser("3"), makeUser("1"), makeUser("2")});
+        });
+    scheduler.flush();
+
+    EXPECT_EQ(scheduler.queuedLookups(), 0U);
+    // every lookup only gets the users it asked for
+    ASSERT_EQ(first.size(), 2U);
+    EXPECT_EQ(first[0].id, "1");
+    EXPECT_EQ(first[1].id, "2");
+    ASSERT_EQ(second.size(), 2U);
+    EXPECT_EQ(second[0].id, "3");
+    EXPECT_EQ(second[1].id, "2");
+}
+
+TEST(HelixScheduler, SplitsIntoBatches)
+{
+    StrictMock<mock::Helix> helix;
+    HelixRateLimiter limiter;
+    HelixScheduler scheduler(limiter, &helix);
+
+    int calls = 0;
+    size_t received = 0;
+    scheduler.fetchStreamsById(
+        makeIDs(0, 150),
+        [&](const auto &streams) {
+            calls++;
+            received = streams.size();
+        },
+        [] {
+            FAIL();
+        });
+    scheduler.fetchStreamsById(
+        makeIDs(150, 160),
+        [&](const auto &streams) {
+            EXPECT_EQ(streams.size(), 10U);
+        },
+        [] {
+            FAIL();
+        });
+
+    std::vector<ResultCallback<std::vector<HelixStream>>> pending;
+    std::vector<QStringList> batches;
+    EXPECT_CALL(helix, fetchStreams(_, QStringList{}, _, _, _))
+        .Times(2)
+        .WillRepeatedly([&](auto ids, auto, auto success, auto, auto) {
+            batches.push_back(ids);
+            pending.push_back(success);
+        });
+    scheduler.flush();
+
+    ASSERT_EQ(batches.size(), 2U);
+    EXPECT_EQ(batches[0], makeIDs(0, 100));
+    EXPECT_EQ(batches[1], makeIDs(100, 160));
+
+    auto respond = [](const QStringList &ids) {
+        std::vector<HelixStream> streams;
+        for (const auto &id : ids)
+        {
+            streams.push_back(makeStream(id, "user" + id));
+        }
+        return streams;
+    };
+    pending[0](respond(batches[0]));
+    // the first lookup waits for the rest of its streams
+    EXPECT_EQ(calls, 0);
+    pending[1](respond(batches[1]));
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(received, 150U);
+}
+
+TEST(HelixScheduler, KeysInMultipleBatches)
+{
+    StrictMock<mock::Helix> helix;
+    HelixRateLimiter limiter;
+    HelixScheduler scheduler(limiter, &helix);
+
+    std::vector<HelixUser> first;
+    std::vector<HelixUser> second;
+    scheduler.fetchUsersById(
+        makeIDs(0, 150),
+        [&](const auto &users) {
+            first = users;
+        },
+        [] {
+            FAIL();
+        });
+    scheduler.fetchUsersById(
+        {"5", "200"},
+        [&](const auto &users) {
+            second = users;
+        },
+        [] {
+            FAIL();
+        });
+
+    std::vector<QStringList> batches;
+    EXPECT_CALL(helix, fetchUsers(_, QStringList{}, _, _))
+        .Times(2)
+        .WillRepeatedly([&](auto ids, auto, auto success, auto) {
+            batches.push_back(ids);
+            std::vector<HelixUser> users;
+            for (const auto &id : ids)
+            {
+                users.push_back(makeUser(id));
+            }
+            success(users);
+        });
+    scheduler.flush();
+
+    // "5" is part of both batches, but only delivered once
+    ASSERT_EQ(batches.size(), 2U);
+    EXPECT_TRUE(batches[1].contains("5"));
+    EXPECT_EQ(first.size(), 150U);
+    EXPECT_EQ(std::ranges::count(first, QString("5"), &HelixUser::id), 1);
+    EXPECT_EQ(second.size(), 2U);
+}
+
+TEST(HelixScheduler, Failure)
+{
+    StrictMock<mock::Helix> helix;
+    HelixRateLimiter limiter;
+    HelixScheduler scheduler(limiter, &helix);
+
+    bool failed = false;
+    scheduler.fetchChannelsById(
+        {"1"},
+        [](const auto &) {
+            FAIL();
+        },
+        [&] {
+            failed = true;
+        });
+
+    EXPECT_CALL(helix, fetchChannels(QStringList{"1"}, _, _))
+        .WillOnce([](auto, auto, auto failure) {
+            failure();
+        });
+    scheduler.flush();
+    EXPECT_TRUE(failed);
+}
+
+TEST(HelixScheduler, FailureOnlyAffectsItsLookups)
+{
+    StrictMock<mock::Helix> helix;
+    HelixRateLimiter limiter;
+    HelixScheduler scheduler(limiter, &helix);
+
+    // e.g. LiveController looks up every batch of 100 channels separately
+    size_t received = 0;
+    bool failed = false;
+    scheduler.fetchStreamsById(
+        makeIDs(0, 100),
+        [&](const auto &streams) {
+            received = streams.size();
+        },
+        [] {
+            FAIL();
+        });
+    scheduler.fetchStreamsById(
+        makeIDs(100, 200),
+        [](const auto &) {
+            FAIL();
+        },
+        [&] {
+            failed = true;
+        });
+
+    EXPECT_CALL(helix, fetchStreams(_, QStringList{}, _, _, _))
+        .Times(2)
+        .WillRepeatedly([](auto ids, auto, auto success, auto failure, auto) {
+            if (ids.contains("150"))
+            {
+                failure();
+                return;
+            }
+            std::vector<HelixStream> streams;
+            for (const auto &id : ids)
+            {
+                streams.push_back(makeStream(id, "user" + id));
+            }
+            success(streams);
+        });
+    scheduler.flush();
+
+    EXPECT_EQ(received, 100U);
+    EXPECT_TRUE(failed);
+}
+
+TEST(HelixScheduler, LoginsAreCaseInsensitive)
+{
+    StrictMock<mock::Helix> helix;
+    HelixRateLimiter limiter;
+    HelixScheduler scheduler(limiter, &helix);
+
+    std::vector<HelixStream> result;
+    scheduler.fetchStreamsByLogin(
+        {"Forsen", "pajlada"},
+        [&](const auto &streams) {
+            result = streams;
+        },
+        [] {
+            FAIL();
+        });
+
+    EXPECT_CALL(helix, fetchStreams(QStringList{},
+                                    QStringList{"forsen", "pajlada"}, _, _, _))
+        .WillOnce([](auto, auto, auto success, auto, auto) {
+            success({makeStream("22484632", "FORSEN")});
+        });
+    scheduler.flush();
+
+    ASSERT_EQ(result.size(), 1U);
+    EXPECT_EQ(result[0].userId, "22484632");
+}
+
+TEST(HelixScheduler, RespectsRateLimit)
+{
+    StrictMock<mock::Helix> helix;
+    HelixRateLimiter limiter;
+    HelixScheduler scheduler(limiter, &helix);
+
+    // only the reserved tokens are left - the bucket refills with 13 tokens/s
+    limiter.update(800, HelixScheduler::RESERVED_TOKENS, Clock::now() + 60s,
+                   Clock::now());
+
+    scheduler.fetchUsersById({"1"}, [](const auto &) {}, [] {});
+    scheduler.flush();
+    EXPECT_EQ(scheduler.queuedLookups(), 1U);
+
+    std::this_thread::sleep_for(200ms);
+    EXPECT_CALL(helix, fetchUsers(QStringList{"1"}, QStringList{}, _, _))
+        .Times(1);
+    scheduler.flush();
+    EXPECT_EQ(scheduler.queuedLookups(), 0U);
+}
@@ -0,0 +1,107 @@
+#include "messages/ImageRegistry.hpp"
+
+#include "messages/Image.hpp"
+#include "Test.hpp"
+
+#include <QtConcurrent>
+
+#include <algorithm>
+#include <vector>
+
+using namespace chatterino;
+
+TEST(ImageRegistry, reusesLiveImages)
+{
+    auto &registry = ImageRegistry::instance();
+    auto before = registry.size();
+
+    Url url{"https://cdn.7tv.app/emote/registry-test/1x.webp"};
+    auto first = Image::fromUrl(url);
+    auto second = Image::fromUrl(url);
+    ASSERT_EQ(first, second);
+    ASSERT_EQ(registry.size(), before + 1);
+
+    auto other = Image::fromUrl(Url{"https://cdn.7tv.app/emote/other/1x.webp"});
+    ASSERT_NE(first, other);
+    ASSERT_EQ(registry.size(), before + 2);
+}
+
+TEST(ImageRegistry, prunesDestroyedImages)
+{
+    auto &registry = ImageRegistry::instance();
+    auto before = registry.size();
+
+    Url url{"https://cdn.betterttv.net/emote/registry-test/1x"};
+    auto image = Image::fromUrl(url);
+    ASSERT_EQ(registry.size(), before + 1);
+
+    image.reset();
+    ASSERT_EQ(registry.size(), before);
+
+    // A new image is created once the old one is gone
+    image = Image::fromUrl(url);
+    ASSERT_NE(image, nullptr);
+    ASSERT_EQ(registry.size(), before + 1);
+}
+
+TEST(ImageRegistry, concurrentLookups)
+{
+    auto &registry = ImageRegistry::instance();
+    auto before = registry.size();
+
+    constexpr int URL_COUNT = 64;
+    auto lookup = [](int offset) {
+        std::vector<ImagePtr> images;
+        for (int i = 0; i < URL_COUNT; i++)
+        {
+            auto id = (i + offset) % URL_COUNT;
+            images.push_back(Image::fromUrl(
+                {QString("https://cdn.frankerfacez.com/emote/%1/1").arg(id)}));
+        }
+        // Sort by URL, so all threads see the same order
+        std::ranges::sort(images, {}, [](const auto &image) {
+            return image->url().string;
+        });
+        return images;
+    };
+
+    std::vector<QFuture<std::vector<ImagePtr>>> futures;
+    for (int thread = 0; thread < 8; thread++)
+    {
+        futures.push_back(QtConcurrent::run(lookup, thread * 7));
+    }
+
+    auto expected = futures.front().result();
+    ASSERT_EQ(expected.size(), static_cast<size_t>(URL_COUNT));
+    for (auto &future : futures)
+    {
+        ASSERT_EQ(future.result(), expected);
+    }
+    ASSERT_EQ(registry.size(), before + URL_COUNT);
+}
+
+TEST(ImageRegistry, imageProviderOf)
+{
+    std::vector<std::pair<QString, ImageProvider>> cases{
+        {"https://static-cdn.jtvnw.net/emoticons/v2/25/default/dark/1.0",
+         ImageProvider::Twitch},
+        {"https://static-cdn.jtvnw.net/badges/v1/"
+         "5527c58c-fb7d-422d-b71b-f309dcb85cc1/1",
+         ImageProvider::Badges},
+        {"https://cdn.betterttv.net/emote/566ca04265dbbdab32ec054a/1x",
+         ImageProvider::Bttv},
+        {"https://cdn.frankerfacez.com/emote/9/1", ImageProvider::Ffz},
+        {"https://cdn.frankerfacez.com/badge/2/1", ImageProvider::Badges},
+        {"https://cdn.7tv.app/emote/01F6MZGCNG000255K4X1K96D8K/1x.webp",
+         ImageProvider::Seventv},
+        {"https://chatterino2-emoji-cdn.pajlada.se/file/1f600.png",
+         ImageProvider::Other},
+        {"https://www.chatterino.com", ImageProvider::Other},
+        {"", ImageProvider::Other},
+    };
+
+    for (const auto &[url, expected] : cases)
+    {
+        ASSERT_EQ(imageProviderOf(Url{url}), expected) << url;
+    }
+}
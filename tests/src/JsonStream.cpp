@@ -0,0 +1,119 @@
+#include "util/JsonStream.hpp"
+
+#include "Test.hpp"
+
+#include <QStringList>
+
+#include <string>
+#include <vector>
+
+using namespace chatterino;
+
+namespace {
+
+/// Records every callback as "path=value" or "end path"
+class RecordingVisitor
+{
+public:
+    void onValue(const JsonStreamPath &path, const JsonStreamValue &value)
+    {
+        std::string entry = format(path) + "=";
+        if (value.isString())
+        {
+            entry += value.toStringView();
+        }
+        else if (value.isNull())
+        {
+            entry += "null";
+        }
+        else
+        {
+            entry += std::to_string(value.toDouble(-1));
+        }
+        this->events.push_back(entry);
+    }
+
+    void onEnd(const JsonStreamPath &path)
+    {
+        this->events.push_back("end " + format(path));
+    }
+
+    std::vector<std::string> events;
+
+private:
+    static std::string format(const JsonStreamPath &path)
+    {
+        std::string out;
+        for (size_t i = 0; i < path.size(); i++)
+        {
+            out += '/';
+            if (path.indexAt(i) >= 0)
+            {
+                out += std::to_string(path.indexAt(i));
+            }
+            else
+            {
+                out += path.keyAt(i);
+            }
+        }
+        return out;
+    }
+};
+
+}  // namespace
+
+TEST(JsonStream, paths)
+{
+    RecordingVisitor visitor;
+    ASSERT_TRUE(streamJson(
+        R"({"a": 1, "b": [true, {"c": "d"}, null], "e": {"f": []}})",
+        visitor));
+
+    std::vector<std::string> expected{
+        "/a=1.000000",      "/b/0=-1.000000", "/b/1/c=d", "end /b/1",
+        "/b/2=null",        "end /b",         "end /e/f", "end /e",
+        "end ",
+    };
+    ASSERT_EQ(visitor.events, expected);
+}
+
+TEST(JsonStream, invalid)
+{
+    RecordingVisitor visitor;
+    ASSERT_FALSE(streamJson(R"({"a": 1, "b": )", visitor));
+    ASSERT_FALSE(streamJson({}, visitor));
+}
+
+TEST(JsonStream, matches)
+{
+    struct Visitor {
+        void onValue(const JsonStreamPath &path,
+                     const JsonStreamValue &value)
+        {
+            if (path.matches({"emotes", "*", "name"}))
+            {
+                this->names.push_back(value.toString());
+            }
+            if (path.matches({"name"}, 2))
+            {
+                this->relative++;
+            }
+        }
+
+        void onEnd(const JsonStreamPath & /*path*/)
+        {
+        }
+
+        QStringList names;
+        int relative = 0;
+    } visitor;
+
+    ASSERT_TRUE(streamJson(R"({"emotes": [{"name": "a"}, {"name": "b"}],
+                               "other": [{"name": "c"}],
+                               "name": "d",
+                               "emotes2": {"x": {"name": "e"}}})",
+                           visitor));
+    ASSERT_EQ(visitor.names, QStringList({"a", "b"}));
+    // Every "name" at depth 2
+    ASSERT_EQ(visitor.relative, 4);
+}
@@ -0,0 +1,229 @@
+#include "singletons/helper/LogSearch.hpp"
+
+#include "Test.hpp"
+
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+
+using namespace chatterino;
+
+namespace {
+
+void writeLog(const QString &path, const QByteArray &contents)
+{
+    QFile file(path);
+    ASSERT_TRUE(file.open(QFile::WriteOnly));
+    file.write(contents);
+}
+
+std::vector<QString> texts(const std::vector<LogSearchResult> &results)
+{
+    std::vector<QString> out;
+    for (const auto &result : results)
+    {
+        out.push_back(result.text);
+    }
+    return out;
+}
+
+class LogSearchTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_TRUE(this->dir.isValid());
+
+        writeLog(this->dir.filePath("pajlada-2024-01-01.log"),
+                 "# Start logging at 2024-01-01 10:00:00 CET\n"
+                 "[10:00:01] pajlada: hello chat\n"
+                 "[10:00:02] Forsen forsen: HELLO there\n"
+                 "[10:00:03] pajlada has been timed out for 1s.\n"
+                 "# Stop logging at 2024-01-01 11:00:00 CET\n");
+        writeLog(this->dir.filePath("pajlada-2024-01-02.log"),
+                 "# Start logging at 2024-01-02 10:00:00 CET\n"
+                 "[12:30:00] nymn: hello pajlada\n"
+                 "[12:30:05] pajlada: goodbye\n");
+        // stream logs duplicate the daily logs
+        writeLog(this->dir.filePath("pajlada-123456.log"),
+                 "[12:30:00] nymn: hello pajlada\n");
+    }
+
+    std::vector<LogSearchResult> search(const LogSearchQuery &query)
+    {
+        return searchLogs(this->dir.path(), "pajlada", query);
+    }
+
+    QTemporaryDir dir;
+};
+
+}  // namespace
+
+TEST_F(LogSearchTest, Words)
+{
+    auto results = this->search({.words = {"hello"}});
+    EXPECT_EQ(texts(results), (std::vector<QString>{
+                                  "pajlada: hello chat",
+                                  "Forsen forsen: HELLO there",
+                                  "nymn: hello pajlada",
+                              }));
+    ASSERT_EQ(results.size(), 3U);
+    EXPECT_EQ(results[0].time,
+              QDateTime(QDate(2024, 1, 1), QTime(10, 0, 1)));
+    EXPECT_EQ(results[2].time,
+              QDateTime(QDate(2024, 1, 2), QTime(12, 30, 0)));
+
+    // every word must be contained, prefixes of words match
+    EXPECT_EQ(texts(this->search({.words = {"hel", "THER"}})),
+              (std::vector<QString>{"Forsen forsen: HELLO there"}));
+    EXPECT_TRUE(this->search({.words = {"kappa"}}).empty());
+    // only prefixes of words match, not any substring
+    EXPECT_TRUE(this->search({.words = {"ello"}}).empty());
+
+    // indices are saved next to the logs
+    EXPECT_TRUE(QFile::exists(
+        indexPathFor(this->dir.filePath("pajlada-2024-01-01.log"))));
+}
+
+TEST_F(LogSearchTest, User)
+{
+    EXPECT_EQ(texts(this->search({.user = "PAJLADA"})),
+              (std::vector<QString>{
+                  "pajlada: hello chat",
+                  "pajlada: goodbye",
+              }));
+    EXPECT_EQ(texts(this->search({.user = "forsen", .words = {"hello"}})),
+              (std::vector<QString>{"Forsen forsen: HELLO there"}));
+    EXPECT_TRUE(this->search({.user = "pajl"}).empty());
+}
+
+TEST_F(LogSearchTest, DateRangeAndLimit)
+{
+    EXPECT_EQ(texts(this->search({
+                  .words = {"hello"},
+                  .from = QDate(2024, 1, 2),
+              })),
+              (std::vector<QString>{"nymn: hello pajlada"}));
+    EXPECT_EQ(texts(this->search({
+                  .words = {"hello"},
+                  .to = QDate(2024, 1, 1),
+              })),
+              (std::vector<QString>{
+                  "pajlada: hello chat",
+                  "Forsen forsen: HELLO there",
+              }));
+
+    // the newest results are kept
+    EXPECT_EQ(texts(this->search({.words = {"hello"}, .limit = 2})),
+              (std::vector<QString>{
+                  "Forsen forsen: HELLO there",
+                  "nymn: hello pajlada",
+              }));
+}
+
+TEST_F(LogSearchTest, StaleIndex)
+{
+    auto path = this->dir.filePath("pajlada-2024-01-02.log");
+    EXPECT_EQ(this->search({.words = {"later"}}).size(), 0U);
+
+    QFile file(path);
+    ASSERT_TRUE(file.open(QFile::Append));
+    file.write("[13:00:00] nymn: later\n");
+    file.close();
+
+    // the index no longer matches the log's size, so it's rebuilt
+    EXPECT_EQ(texts(this->search({.words = {"later"}})),
+              (std::vector<QString>{"nymn: later"}));
+}
+
+TEST(LogIndexBuilder, IncrementalMatchesRebuilt)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    auto path = dir.filePath("nymn-2024-02-01.log");
+
+    // LoggingChannel indexes lines as it writes them
+    QByteArray contents("# Start logging at 2024-02-01 00:00:00 CET\n");
+    LogIndexBuilder builder;
+    for (const auto *line : {"[00:00:01] nymn: first line\n",
+                             "[00:00:02] pajlada: second line\n"})
+    {
+        builder.addLine(static_cast<uint32_t>(contents.size()),
+                        QString::fromUtf8(line));
+        contents.append(line);
+    }
+    writeLog(path, contents);
+    ASSERT_TRUE(builder.write(indexPathFor(path), contents.size()));
+
+    EXPECT_EQ(builder.lookupPrefix("line"), (std::vector<uint32_t>{43, 71}));
+    EXPECT_EQ(builder.lookupPrefix("@paj"), (std::vector<uint32_t>{71}));
+
+    EXPECT_EQ(texts(searchLogs(dir.path(), "nymn", {.words = {"second"}})),
+              (std::vector<QString>{"pajlada: second line"}));
+}
+
+TEST_F(LogSearchTest, LiveIndex)
+{
+    auto path = this->dir.filePath("pajlada-2024-01-03.log");
+    QByteArray contents("# Start logging at 2024-01-03 10:00:00 CET\n");
+    auto live = std::make_shared<LiveLogIndex>();
+    live->complete = true;
+    for (const auto *line :
+         {"[10:00:01] nymn: live one\n", "[10:00:02] nymn: live two\n"})
+    {
+        live->builder.addLine(static_cast<uint32_t>(contents.size()),
+                              QString::fromUtf8(line));
+        contents.append(line);
+    }
+    live->logSize = contents.size();
+
+    // the last line hasn't been added to the live index yet
+    contents.append("[10:00:03] nymn: live three\n");
+    writeLog(path, contents);
+    registerLiveIndex(path, live);
+
+    EXPECT_EQ(texts(this->search({.words = {"live"}})),
+              (std::vector<QString>{
+                  "nymn: live one",
+                  "nymn: live two",
+                  "nymn: live three",
+              }));
+    EXPECT_EQ(texts(this->search({.words = {"two"}})),
+              (std::vector<QString>{"nymn: live two"}));
+    // lines after the live index match the same way as indexed ones
+    EXPECT_TRUE(this->search({.words = {"ive"}}).empty());
+    EXPECT_EQ(texts(this->search({.words = {"thr"}})),
+              (std::vector<QString>{"nymn: live three"}));
+    // files that are still written to don't get an index file
+    EXPECT_FALSE(QFile::exists(indexPathFor(path)));
+
+    unregisterLiveIndex(path);
+    EXPECT_EQ(this->search({.words = {"live"}}).size(), 3U);
+    EXPECT_TRUE(QFile::exists(indexPathFor(path)));
+}
+
+TEST_F(LogSearchTest, Cancelled)
+{
+    EXPECT_TRUE(searchLogs(this->dir.path(), "pajlada", {.words = {"hello"}},
+                           [] {
+                               return true;
+                           })
+                    .empty());
+}
+
+TEST(LogSearch, SpecialChannels)
+{
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+
+    // LoggingChannel writes "/mentions" to "mentions-<date>.log"
+    writeLog(dir.filePath("mentions-2024-03-01.log"),
+             "# Start logging at 2024-03-01 10:00:00 CET\n"
+             "#pajlada [10:00:01] nymn: hello pajlada\n"
+             "#forsen [10:00:02] forsen: pajlada xD\n");
+
+    EXPECT_EQ(texts(searchLogs(dir.path(), "/mentions", {.words = {"hello"}})),
+              (std::vector<QString>{"nymn: hello pajlada"}));
+    EXPECT_EQ(texts(searchLogs(dir.path(), "/mentions", {.user = "forsen"})),
+              (std::vector<QString>{"forsen: pajlada xD"}));
+}
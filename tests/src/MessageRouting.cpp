@@ -0,0 +1,67 @@
+#include "messages/MessageRouting.hpp"
+
+#include "messages/Message.hpp"
+#include "mocks/BaseApplication.hpp"
+#include "Test.hpp"
+
+using namespace chatterino;
+
+namespace {
+
+class MessageRoutingTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        this->mockApplication = std::make_unique<mock::BaseApplication>();
+    }
+
+    void TearDown() override
+    {
+        this->mockApplication.reset();
+    }
+
+    std::unique_ptr<mock::BaseApplication> mockApplication;
+};
+
+MessageRoutes route(MessageFlags flags,
+                    MessageSinkTraits traits = MessageSinkTrait::None)
+{
+    Message message;
+    message.flags = flags;
+    return routeMessage(message, traits);
+}
+
+}  // namespace
+
+TEST_F(MessageRoutingTest, mentions)
+{
+    constexpr auto global = MessageSinkTrait::AddMentionsToGlobalChannel;
+
+    ASSERT_EQ(route({}, global), MessageRoute::Alert);
+    ASSERT_EQ(route(MessageFlag::Highlighted, global), MessageRoute::Alert);
+    ASSERT_EQ(route({MessageFlag::Highlighted, MessageFlag::ShowInMentions},
+                    global),
+              (MessageRoutes{MessageRoute::Alert, MessageRoute::Mentions}));
+    ASSERT_EQ(route({MessageFlag::Whisper, MessageFlag::ShowInMentions},
+                    global),
+              (MessageRoutes{MessageRoute::Alert, MessageRoute::Mentions}));
+
+    // e.g. messages loaded from the recent-messages API
+    ASSERT_EQ(route({MessageFlag::Highlighted, MessageFlag::ShowInMentions}),
+              MessageRoute::Alert);
+}
+
+TEST_F(MessageRoutingTest, similar)
+{
+    auto *settings = getSettings();
+    settings->hideSimilar = false;
+    settings->shownSimilarTriggerHighlights = false;
+    ASSERT_EQ(route(MessageFlag::Similar), MessageRoute::None);
+
+    settings->shownSimilarTriggerHighlights = true;
+    ASSERT_EQ(route(MessageFlag::Similar), MessageRoute::Alert);
+
+    settings->hideSimilar = true;
+    ASSERT_EQ(route(MessageFlag::Similar), MessageRoute::None);
+}
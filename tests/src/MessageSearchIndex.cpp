@@ -0,0 +1,118 @@
+#include "messages/search/MessageSearchIndex.hpp"
+
+#include "messages/LimitedQueue.hpp"
+#include "messages/Message.hpp"
+#include "Test.hpp"
+
+#include <memory>
+
+using namespace chatterino;
+
+namespace {
+
+MessagePtr makeMessage(const QString &text)
+{
+    auto msg = std::make_shared<Message>();
+    msg->searchText = text;
+    return msg;
+}
+
+std::vector<QString> texts(const std::vector<MessagePtr> &messages)
+{
+    std::vector<QString> out;
+    for (const auto &msg : messages)
+    {
+        out.push_back(msg->searchText);
+    }
+    return out;
+}
+
+}  // namespace
+
+TEST(MessageSearchIndex, FindsSubstringsCaseInsensitively)
+{
+    MessageSearchIndex index;
+    index.append(makeMessage("forsen: hello chat"));
+    index.append(makeMessage("nymn: HeLLo there"));
+    index.append(makeMessage("pajlada: goodbye"));
+
+    EXPECT_EQ(texts(index.candidates({"hello"})),
+              (std::vector<QString>{"forsen: hello chat", "nymn: HeLLo there"}));
+    EXPECT_EQ(texts(index.candidates({"HELLO", "there"})),
+              (std::vector<QString>{"nymn: HeLLo there"}));
+    EXPECT_TRUE(index.candidates({"xyz"}).empty());
+}
+
+TEST(MessageSearchIndex, ShortQueriesReturnEverything)
+{
+    MessageSearchIndex index;
+    index.append(makeMessage("abc"));
+    index.append(makeMessage("def"));
+
+    EXPECT_EQ(index.candidates({}).size(), 2U);
+    EXPECT_EQ(index.candidates({"xy"}).size(), 2U);
+}
+
+TEST(MessageSearchIndex, Eviction)
+{
+    MessageSearchIndex index;
+    for (int i = 0; i < 3000; i++)
+    {
+        index.append(makeMessage(QString("message %1").arg(i)));
+        if (index.size() > 1000)
+        {
+            index.evictFront();
+        }
+    }
+
+    ASSERT_EQ(index.size(), 1000U);
+    EXPECT_FALSE(index.candidates({"message 25"}).empty());
+    EXPECT_TRUE(index.candidates({"message 1999"}).empty());
+    EXPECT_EQ(texts(index.candidates({"message 2999"})),
+              (std::vector<QString>{"message 2999"}));
+    EXPECT_EQ(index.candidates({"message"}).front()->searchText,
+              "message 2000");
+}
+
+TEST(MessageSearchIndex, Replace)
+{
+    MessageSearchIndex index;
+    auto first = makeMessage("first message");
+    auto second = makeMessage("second message");
+    index.append(first);
+    index.append(second);
+
+    auto edited = makeMessage("edited message");
+    index.replace(0, first, edited);
+    ASSERT_TRUE(index.isValid());
+    EXPECT_EQ(texts(index.candidates({"edited"})),
+              (std::vector<QString>{"edited message"}));
+    // stale trigrams only produce candidates that the predicates filter out
+    EXPECT_EQ(texts(index.candidates({"first"})),
+              (std::vector<QString>{"edited message"}));
+
+    // a mismatching replacement invalidates the index
+    index.replace(1, first, edited);
+    EXPECT_FALSE(index.isValid());
+}
+
+TEST(MessageSearchIndex, Rebuild)
+{
+    LimitedQueue<MessagePtr> queue(10);
+    queue.pushBack(makeMessage("one"));
+    queue.pushBack(makeMessage("two"));
+    queue.pushBack(makeMessage("three"));
+
+    MessageSearchIndex index;
+    index.invalidate();
+    EXPECT_FALSE(index.isValid());
+
+    index.rebuild(queue.getSnapshot());
+    ASSERT_TRUE(index.isValid());
+    EXPECT_EQ(index.size(), 3U);
+    EXPECT_EQ(texts(index.candidates({"thr"})),
+              (std::vector<QString>{"three"}));
+
+    index.clear();
+    EXPECT_EQ(index.size(), 0U);
+}
@@ -0,0 +1,209 @@
+#include "providers/twitch/MessageSendQueue.hpp"
+
+#include "Test.hpp"
+
+#include <QStringList>
+
+using namespace chatterino;
+using namespace std::chrono_literals;
+
+namespace {
+
+using Clock = MessageSendQueue::Clock;
+using Priority = MessageSendQueue::Priority;
+
+const Clock::time_point NOW = Clock::time_point(1'700'000'000s);
+
+MessageSendQueue::Message makeMessage(QStringList &sent, const QString &text,
+                                      bool highRateLimit = false,
+                                      Priority priority = Priority::Chat)
+{
+    return {
+        .channel = "pajlada",
+        .mergeKey = text,
+        .priority = priority,
+        .highRateLimit = highRateLimit,
+        .send =
+            [&sent, text] {
+                sent.append(text);
+            },
+    };
+}
+
+}  // namespace
+
+TEST(MessageSendQueue, sendsImmediately)
+{
+    MessageSendQueue queue;
+    QStringList sent;
+
+    queue.enqueue(makeMessage(sent, "a"));
+    ASSERT_EQ(queue.size(), 1);
+    ASSERT_FALSE(queue.process(NOW).has_value());
+    ASSERT_EQ(sent, QStringList{"a"});
+    ASSERT_EQ(queue.size(), 0);
+}
+
+TEST(MessageSendQueue, minOffset)
+{
+    MessageSendQueue queue;
+    QStringList sent;
+
+    queue.enqueue(makeMessage(sent, "a"));
+    queue.enqueue(makeMessage(sent, "b"));
+    ASSERT_EQ(queue.process(NOW), NOW + MessageSendQueue::NORMAL_MIN_OFFSET);
+    ASSERT_EQ(sent, QStringList{"a"});
+    ASSERT_EQ(queue.queuedFor("pajlada"), 1);
+    ASSERT_EQ(queue.queuedFor("forsen"), 0);
+
+    // too early
+    ASSERT_EQ(queue.process(NOW + 1s),
+              NOW + MessageSendQueue::NORMAL_MIN_OFFSET);
+    ASSERT_EQ(sent, QStringList{"a"});
+
+    ASSERT_FALSE(
+        queue.process(NOW + MessageSendQueue::NORMAL_MIN_OFFSET).has_value());
+    ASSERT_EQ(sent, (QStringList{"a", "b"}));
+}
+
+TEST(MessageSendQueue, window)
+{
+    MessageSendQueue queue;
+    QStringList sent;
+
+    auto now = NOW;
+    for (size_t i = 0; i < MessageSendQueue::NORMAL_MAX_MESSAGES; i++)
+    {
+        queue.enqueue(makeMessage(sent, QString::number(i)));
+        queue.process(now);
+        now += 1500ms;
+    }
+    ASSERT_EQ(static_cast<size_t>(sent.size()),
+              MessageSendQueue::NORMAL_MAX_MESSAGES);
+
+    // The window is full until the first message is old enough
+    queue.enqueue(makeMessage(sent, "last"));
+    ASSERT_EQ(queue.process(now), NOW + MessageSendQueue::WINDOW);
+    ASSERT_EQ(static_cast<size_t>(sent.size()),
+              MessageSendQueue::NORMAL_MAX_MESSAGES);
+
+    ASSERT_FALSE(queue.process(NOW + MessageSendQueue::WINDOW).has_value());
+    ASSERT_EQ(sent.last(), "last");
+}
+
+TEST(MessageSendQueue, separateWindows)
+{
+    MessageSendQueue queue;
+    QStringList sent;
+
+    queue.enqueue(makeMessage(sent, "normal1"));
+    queue.enqueue(makeMessage(sent, "normal2"));
+    queue.enqueue(makeMessage(sent, "high1", true));
+    queue.enqueue(makeMessage(sent, "high2", true));
+
+    ASSERT_EQ(queue.process(NOW), NOW + MessageSendQueue::HIGH_MIN_OFFSET);
+    ASSERT_EQ(sent, (QStringList{"normal1", "high1"}));
+
+    ASSERT_EQ(queue.process(NOW + MessageSendQueue::HIGH_MIN_OFFSET),
+              NOW + MessageSendQueue::NORMAL_MIN_OFFSET);
+    ASSERT_EQ(sent, (QStringList{"normal1", "high1", "high2"}));
+
+    ASSERT_FALSE(
+        queue.process(NOW + MessageSendQueue::NORMAL_MIN_OFFSET).has_value());
+    ASSERT_EQ(sent, (QStringList{"normal1", "high1", "high2", "normal2"}));
+}
+
+TEST(MessageSendQueue, priority)
+{
+    MessageSendQueue queue;
+    QStringList sent;
+
+    queue.enqueue(makeMessage(sent, "chat1", true));
+    queue.enqueue(makeMessage(sent, "chat2", true));
+    queue.enqueue(makeMessage(sent, "/ban a", true, Priority::Moderation));
+    queue.enqueue(makeMessage(sent, "/ban b", true, Priority::Moderation));
+
+    auto now = NOW;
+    while (auto next = queue.process(now))
+    {
+        now = *next;
+    }
+    ASSERT_EQ(sent, (QStringList{"/ban a", "/ban b", "chat1", "chat2"}));
+}
+
+TEST(MessageSendQueue, merge)
+{
+    MessageSendQueue queue;
+    QStringList sent;
+
+    queue.enqueue(makeMessage(sent, "a"));
+    queue.enqueue(makeMessage(sent, "b"));
+    queue.enqueue(makeMessage(sent, "c"));
+    // "a" is already sent at this point
+    ASSERT_TRUE(queue.process(NOW).has_value());
+
+    ASSERT_TRUE(queue.enqueue(makeMessage(sent, "a")));
+    ASSERT_FALSE(queue.enqueue(makeMessage(sent, "b")));
+    // Merging raises the priority
+    ASSERT_FALSE(queue.enqueue(
+        makeMessage(sent, "c", false, Priority::Moderation)));
+    ASSERT_EQ(queue.size(), 3);
+
+    // Messages with an empty key are never merged
+    auto unmergeable = makeMessage(sent, "d");
+    unmergeable.mergeKey.clear();
+    ASSERT_TRUE(queue.enqueue(unmergeable));
+    ASSERT_TRUE(queue.enqueue(unmergeable));
+
+    auto now = NOW;
+    while (auto next = queue.process(now))
+    {
+        now = *next;
+    }
+    ASSERT_EQ(sent, (QStringList{"a", "c", "b", "a", "d", "d"}));
+}
+
+TEST(MessageSendQueue, queueChanged)
+{
+    MessageSendQueue queue;
+    QStringList sent;
+    QStringList changed;
+    std::ignore = queue.queueChanged.connect([&](const QString &channel) {
+        changed.append(channel);
+    });
+
+    queue.enqueue(makeMessage(sent, "a"));
+    queue.enqueue(makeMessage(sent, "a"));
+    ASSERT_EQ(changed.size(), 1);
+
+    queue.process(NOW);
+    ASSERT_EQ(changed.size(), 2);
+
+    queue.enqueue(makeMessage(sent, "b"));
+    queue.clear();
+    ASSERT_EQ(changed.size(), 4);
+    ASSERT_EQ(queue.size(), 0);
+
+    // clear() also resets the windows
+    queue.enqueue(makeMessage(sent, "c"));
+    ASSERT_FALSE(queue.process(NOW).has_value());
+    ASSERT_EQ(sent, (QStringList{"a", "c"}));
+}
+
+TEST(MessageSendQueue, isModerationCommand)
+{
+    for (const auto *message :
+         {"/ban a", "/TIMEOUT a 10", ".delete id", "/clear", "/slowoff"})
+    {
+        EXPECT_TRUE(MessageSendQueue::isModerationCommand(
+            QString::fromUtf8(message)))
+            << message;
+    }
+    for (const auto *message :
+         {"/me waves", "/banana", "ban a", "hello /ban", "/", ""})
+    {
+        EXPECT_FALSE(MessageSendQueue::isModerationCommand(
+            QString::fromUtf8(message)))
+            << message;
+    }
+}
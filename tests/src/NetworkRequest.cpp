@@ -1,7 +1,9 @@
 #include "common/network/NetworkRequest.hpp"
 
+#include "common/network/NetworkCoalescer.hpp"
 #include "common/network/NetworkManager.hpp"
 #include "common/network/NetworkResult.hpp"
+#include "debug/PerformanceCounters.hpp"
 #include "NetworkHelpers.hpp"
 #include "Test.hpp"
 
@@ -254,7 +256,8 @@ TEST(NetworkRequest, BatchedTimeouts)
     {
         auto state = std::make_shared<RequestState>();
 
-        auto url = getDelayURL(1);
+        // distinct URLs, so the requests aren't coalesced
+        auto url = getDelayURL(1) + "?request=" + QString::number(i);
 
         NetworkRequest(url)
             .timeout(1500)
@@ -277,3 +280,118 @@ TEST(NetworkRequest, BatchedTimeouts)
     }
 #endif
 }
+
+TEST(NetworkRequest, CoalesceIdenticalRequests)
+{
+    static const auto numRequests = 5;
+
+    struct RequestState {
+        RequestWaiter waiter;
+        QByteArray data;
+    };
+
+    auto &coalesced = PerformanceCounters::instance().httpRequestsCoalesced;
+    auto coalescedBefore = coalesced.load();
+
+    std::vector<std::shared_ptr<RequestState>> states;
+    for (auto i = 0; i < numRequests; ++i)
+    {
+        auto state = std::make_shared<RequestState>();
+        NetworkRequest(getDelayURL(1))
+            .onSuccess([=](const NetworkResult &result) {
+                state->data = result.getData();
+            })
+            .finally([=] {
+                state->waiter.requestDone();
+            })
+            .execute();
+        states.emplace_back(state);
+    }
+
+    for (const auto &state : states)
+    {
+        state->waiter.waitForRequest();
+        EXPECT_FALSE(state->data.isEmpty());
+        EXPECT_EQ(state->data, states.front()->data);
+    }
+
+    // only the first request was sent
+    EXPECT_EQ(coalesced.load() - coalescedBefore,
+              static_cast<uint64_t>(numRequests - 1));
+    EXPECT_EQ(network::detail::NetworkCoalescer::instance().size(), 0U);
+}
+
+TEST(NetworkRequest, CoalesceOnlyIdenticalGets)
+{
+    auto &coalesced = PerformanceCounters::instance().httpRequestsCoalesced;
+    auto coalescedBefore = coalesced.load();
+
+    std::vector<std::shared_ptr<RequestWaiter>> waiters;
+    auto send = [&](NetworkRequest &&request) {
+        auto waiter = std::make_shared<RequestWaiter>();
+        std::move(request)
+            .finally([=] {
+                waiter->requestDone();
+            })
+            .execute();
+        waiters.emplace_back(waiter);
+    };
+
+    auto url = getDelayURL(1);
+    send(NetworkRequest(url));
+    // different headers
+    send(NetworkRequest(url).header("X-Test", "1"));
+    send(NetworkRequest(url).header("X-Test", "2"));
+    // different URL
+    send(NetworkRequest(url + "?a=b"));
+    // not a GET request
+    send(NetworkRequest(QString("%1/post").arg(HTTPBIN_BASE_URL),
+                        NetworkRequestType::Post)
+             .payload("a"));
+    send(NetworkRequest(QString("%1/post").arg(HTTPBIN_BASE_URL),
+                        NetworkRequestType::Post)
+             .payload("a"));
+
+    for (const auto &waiter : waiters)
+    {
+        waiter->waitForRequest();
+    }
+
+    EXPECT_EQ(coalesced.load(), coalescedBefore);
+}
+
+TEST(NetworkRequest, CoalescedErrors)
+{
+    static const auto numRequests = 3;
+
+    struct RequestState {
+        RequestWaiter waiter;
+        std::optional<int> status;
+        bool successCalled = false;
+    };
+
+    std::vector<std::shared_ptr<RequestState>> states;
+    for (auto i = 0; i < numRequests; ++i)
+    {
+        auto state = std::make_shared<RequestState>();
+        NetworkRequest(getStatusURL(404))
+            .onSuccess([=](const NetworkResult & /*result*/) {
+                state->successCalled = true;
+            })
+            .onError([=](const NetworkResult &result) {
+                state->status = result.status();
+            })
+            .finally([=] {
+                state->waiter.requestDone();
+            })
+            .execute();
+        states.emplace_back(state);
+    }
+
+    for (const auto &state : states)
+    {
+        state->waiter.waitForRequest();
+        EXPECT_FALSE(state->successCalled);
+        EXPECT_EQ(state->status, 404);
+    }
+}
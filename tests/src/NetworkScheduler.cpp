@@ -0,0 +1,139 @@
+#include "common/network/NetworkScheduler.hpp"
+
+#include "Test.hpp"
+
+#include <QUrl>
+
+#include <vector>
+
+using namespace chatterino;
+using namespace chatterino::network::detail;
+
+namespace {
+
+const QString HOST = "https://example.com:443";
+
+}  // namespace
+
+TEST(NetworkScheduler, HostKey)
+{
+    EXPECT_EQ(NetworkScheduler::hostKey(QUrl("https://example.com/a?b=c")),
+              "https://example.com:443");
+    EXPECT_EQ(NetworkScheduler::hostKey(QUrl("http://example.com/a")),
+              "http://example.com:80");
+    EXPECT_EQ(NetworkScheduler::hostKey(QUrl("http://127.0.0.1:9051/get")),
+              "http://127.0.0.1:9051");
+}
+
+TEST(NetworkScheduler, LimitPerHost)
+{
+    NetworkScheduler scheduler;
+    size_t started = 0;
+    for (size_t i = 0; i < NetworkScheduler::HTTP1_REQUESTS_PER_HOST + 2; i++)
+    {
+        scheduler.schedule(HOST, NetworkRequestPriority::High, [&] {
+            started++;
+        });
+    }
+    EXPECT_EQ(started, NetworkScheduler::HTTP1_REQUESTS_PER_HOST);
+    EXPECT_EQ(scheduler.running(HOST),
+              NetworkScheduler::HTTP1_REQUESTS_PER_HOST);
+    EXPECT_EQ(scheduler.queued(HOST), 2U);
+
+    // other hosts aren't affected
+    bool otherStarted = false;
+    scheduler.schedule("https://other.com:443", NetworkRequestPriority::Low,
+                       [&] {
+                           otherStarted = true;
+                       });
+    EXPECT_TRUE(otherStarted);
+
+    scheduler.finished(HOST, false);
+    EXPECT_EQ(started, NetworkScheduler::HTTP1_REQUESTS_PER_HOST + 1);
+    EXPECT_EQ(scheduler.queued(HOST), 1U);
+    scheduler.finished(HOST, false);
+    EXPECT_EQ(started, NetworkScheduler::HTTP1_REQUESTS_PER_HOST + 2);
+    EXPECT_EQ(scheduler.queued(HOST), 0U);
+    EXPECT_EQ(scheduler.running(HOST),
+              NetworkScheduler::HTTP1_REQUESTS_PER_HOST);
+}
+
+TEST(NetworkScheduler, Priorities)
+{
+    NetworkScheduler scheduler;
+    for (size_t i = 0; i < NetworkScheduler::HTTP1_REQUESTS_PER_HOST; i++)
+    {
+        scheduler.schedule(HOST, NetworkRequestPriority::Normal, [] {});
+    }
+
+    std::vector<QString> order;
+    auto push = [&](NetworkRequestPriority priority, const QString &name) {
+        scheduler.schedule(HOST, priority, [&order, name] {
+            order.push_back(name);
+        });
+    };
+    push(NetworkRequestPriority::Low, "low1");
+    push(NetworkRequestPriority::Normal, "normal1");
+    push(NetworkRequestPriority::High, "high1");
+    push(NetworkRequestPriority::Low, "low2");
+    push(NetworkRequestPriority::High, "high2");
+    push(NetworkRequestPriority::Normal, "normal2");
+    ASSERT_TRUE(order.empty());
+
+    for (int i = 0; i < 6; i++)
+    {
+        scheduler.finished(HOST, false);
+    }
+    EXPECT_EQ(order, (std::vector<QString>{
+                         "high1",
+                         "high2",
+                         "normal1",
+                         "normal2",
+                         "low1",
+                         "low2",
+                     }));
+}
+
+TEST(NetworkScheduler, Http2RaisesLimit)
+{
+    NetworkScheduler scheduler;
+    size_t started = 0;
+    for (size_t i = 0; i < NetworkScheduler::HTTP2_REQUESTS_PER_HOST; i++)
+    {
+        scheduler.schedule(HOST, NetworkRequestPriority::Normal, [&] {
+            started++;
+        });
+    }
+    EXPECT_EQ(started, NetworkScheduler::HTTP1_REQUESTS_PER_HOST);
+
+    // once a request used HTTP/2, the queued requests can be multiplexed
+    scheduler.finished(HOST, true);
+    EXPECT_EQ(started, NetworkScheduler::HTTP2_REQUESTS_PER_HOST);
+    EXPECT_EQ(scheduler.running(HOST),
+              NetworkScheduler::HTTP2_REQUESTS_PER_HOST - 1);
+    EXPECT_EQ(scheduler.queued(HOST), 0U);
+}
+
+TEST(NetworkScheduler, StartFinishingImmediately)
+{
+    NetworkScheduler scheduler;
+    for (size_t i = 0; i < NetworkScheduler::HTTP1_REQUESTS_PER_HOST; i++)
+    {
+        scheduler.schedule(HOST, NetworkRequestPriority::High, [] {});
+    }
+
+    // requests that fail right away finish from within their start function
+    size_t started = 0;
+    for (int i = 0; i < 3; i++)
+    {
+        scheduler.schedule(HOST, NetworkRequestPriority::High, [&] {
+            started++;
+            scheduler.finished(HOST, false);
+        });
+    }
+    scheduler.finished(HOST, false);
+    EXPECT_EQ(started, 3U);
+    EXPECT_EQ(scheduler.queued(HOST), 0U);
+    EXPECT_EQ(scheduler.running(HOST),
+              NetworkScheduler::HTTP1_REQUESTS_PER_HOST - 1);
+}
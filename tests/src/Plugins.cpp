@@ -2,23 +2,40 @@
 #    include "Application.hpp"
 #    include "common/Channel.hpp"
 #    include "common/network/NetworkCommon.hpp"
+#    include "controllers/accounts/AccountController.hpp"
 #    include "controllers/commands/Command.hpp"  // IWYU pragma: keep
 #    include "controllers/commands/CommandController.hpp"
+#    include "controllers/highlights/HighlightController.hpp"
 #    include "controllers/plugins/api/ChannelRef.hpp"
 #    include "controllers/plugins/api/WebSocket.hpp"
 #    include "controllers/plugins/Plugin.hpp"
 #    include "controllers/plugins/PluginController.hpp"
+#    include "controllers/plugins/PluginLimits.hpp"
 #    include "controllers/plugins/PluginPermission.hpp"
 #    include "controllers/plugins/SolTypes.hpp"  // IWYU pragma: keep
+#    include "controllers/sound/NullBackend.hpp"
+#    include "messages/Message.hpp"
 #    include "mocks/BaseApplication.hpp"
 #    include "mocks/Channel.hpp"
+#    include "mocks/ChatterinoBadges.hpp"
 #    include "mocks/Emotes.hpp"
+#    include "mocks/LinkResolver.hpp"
 #    include "mocks/Logging.hpp"
 #    include "mocks/TwitchIrcServer.hpp"
+#    include "mocks/UserData.hpp"
 #    include "NetworkHelpers.hpp"
+#    include "providers/bttv/BttvEmotes.hpp"
+#    include "providers/ffz/FfzBadges.hpp"
+#    include "providers/ffz/FfzEmotes.hpp"
+#    include "providers/seventv/SeventvBadges.hpp"
+#    include "providers/seventv/SeventvEmotes.hpp"
+#    include "providers/twitch/IrcMessageHandler.hpp"
+#    include "providers/twitch/TwitchBadges.hpp"
+#    include "providers/twitch/TwitchChannel.hpp"
 #    include "singletons/Logging.hpp"
 #    include "Test.hpp"
 
+#    include <IrcMessage>
 #    include <lauxlib.h>
 #    include <sol/state_view.hpp>
 #    include <sol/table.hpp>
@@ -75,6 +92,7 @@ public:
         : mock::BaseApplication(TEST_SETTINGS)
         , plugins(this->paths_)
         , commands(this->paths_)
+        , highlights(this->settings, &this->accounts)
     {
     }
 
@@ -103,11 +121,85 @@ public:
         return &this->logging;
     }
 
+    // The following are needed to parse IRC messages
+
+    AccountController *getAccounts() override
+    {
+        return &this->accounts;
+    }
+
+    IUserDataController *getUserData() override
+    {
+        return &this->userData;
+    }
+
+    HighlightController *getHighlights() override
+    {
+        return &this->highlights;
+    }
+
+    IChatterinoBadges *getChatterinoBadges() override
+    {
+        return &this->chatterinoBadges;
+    }
+
+    FfzBadges *getFfzBadges() override
+    {
+        return &this->ffzBadges;
+    }
+
+    SeventvBadges *getSeventvBadges() override
+    {
+        return &this->seventvBadges;
+    }
+
+    TwitchBadges *getTwitchBadges() override
+    {
+        return &this->twitchBadges;
+    }
+
+    BttvEmotes *getBttvEmotes() override
+    {
+        return &this->bttvEmotes;
+    }
+
+    FfzEmotes *getFfzEmotes() override
+    {
+        return &this->ffzEmotes;
+    }
+
+    SeventvEmotes *getSeventvEmotes() override
+    {
+        return &this->seventvEmotes;
+    }
+
+    ILinkResolver *getLinkResolver() override
+    {
+        return &this->linkResolver;
+    }
+
+    ISoundController *getSound() override
+    {
+        return &this->sound;
+    }
+
     PluginController plugins;
     mock::EmptyLogging logging;
     CommandController commands;
     mock::Emotes emotes;
     MockTwitch twitch;
+    AccountController accounts;
+    mock::UserDataController userData;
+    HighlightController highlights;
+    mock::ChatterinoBadges chatterinoBadges;
+    FfzBadges ffzBadges;
+    SeventvBadges seventvBadges;
+    TwitchBadges twitchBadges;
+    BttvEmotes bttvEmotes;
+    FfzEmotes ffzEmotes;
+    SeventvEmotes seventvEmotes;
+    mock::EmptyLinkResolver linkResolver;
+    NullBackend sound;
 };
 
 }  // namespace
@@ -160,8 +252,8 @@ protected:
                 QDir(app->paths_.pluginsDirectory).absoluteFilePath("test");
 
             plugindir.mkpath(".");
-            auto temp = std::make_unique<Plugin>("test", luaL_newstate(), meta,
-                                                 plugindir);
+            auto temp = std::make_unique<Plugin>(
+                "test", lua::newLimitedState(), meta, plugindir);
             this->rawpl = temp.get();
             plugins.insert({"test", std::move(temp)});
         }
@@ -419,6 +511,41 @@ TEST_F(PluginTest, testHttp)
     }
 }
 
+TEST_F(PluginTest, httpCallbackBudget)
+{
+    {
+        PluginPermission net;
+        net.type = PluginPermission::Type::Network;
+        configure({net});
+    }
+    rawpl->limits()->instructionBudget = 100'000;
+
+    RequestWaiter waiter;
+    (*lua)["done"] = [&waiter]() {
+        waiter.requestDone();
+    };
+    (*lua)["url"] = QString(HTTPBIN_BASE_URL) + "/status/200";
+    lua->script(R"lua(
+        _G.finally = false
+        local r = c2.HTTPRequest.create(c2.HTTPMethod.Get, url)
+        r:on_success(function(res)
+            while true do end
+        end)
+        r:finally(function()
+            _G.finally = true
+            done()
+        end)
+        r:execute()
+    )lua");
+    waiter.waitForRequest();
+
+    // the endless loop was aborted and the request still finished
+    EXPECT_TRUE(lua->get<bool>("finally"));
+    EXPECT_EQ(rawpl->callbackStats["HTTPRequest.on_success"].budgetExceeded,
+              1U);
+    EXPECT_EQ(rawpl->callbackStats["HTTPRequest.finally"].calls, 1U);
+}
+
 const QByteArray TEST_FILE_DATA = "Test file data\nWith a new line.\n";
 
 TEST_F(PluginTest, ioTest)
@@ -639,6 +766,187 @@ TEST_F(PluginTest, tryCallTest)
     }
 }
 
+TEST_F(PluginTest, instructionBudget)
+{
+    configure();
+    auto *limits = rawpl->limits();
+    ASSERT_NE(limits, nullptr);
+    limits->instructionBudget = 100'000;
+
+    lua->script(R"lua(
+        c2.register_command("/loop", function(ctx)
+            while true do end
+        end)
+        c2.register_command("/swallow", function(ctx)
+            while true do
+                pcall(function() while true do end end)
+            end
+        end)
+        c2.register_command("/short", function(ctx)
+            local sum = 0
+            for i = 1, 100 do sum = sum + i end
+            _G.sum = sum
+        end)
+    )lua");
+
+    app->commands.execCommand("/loop", channel, false);
+    EXPECT_EQ(rawpl->callbackStats["command /loop"].calls, 1U);
+    EXPECT_EQ(rawpl->callbackStats["command /loop"].budgetExceeded, 1U);
+
+    // the error can't be caught by the plugin
+    app->commands.execCommand("/swallow", channel, false);
+    EXPECT_EQ(rawpl->callbackStats["command /swallow"].budgetExceeded, 1U);
+
+    // the hook doesn't keep running on every instruction
+    EXPECT_GT(lua_gethookcount(PluginControllerAccess::state(rawpl)), 1);
+
+    // every callback gets a fresh budget
+    app->commands.execCommand("/short", channel, false);
+    EXPECT_EQ(lua->get<int>("sum"), 5050);
+    EXPECT_EQ(rawpl->callbackStats["command /short"].calls, 1U);
+    EXPECT_EQ(rawpl->callbackStats["command /short"].budgetExceeded, 0U);
+
+    // the budget isn't enforced outside of callbacks
+    lua->script(R"lua(
+        for i = 1, 1000000 do end
+    )lua");
+    EXPECT_EQ(limits->activeScopes, 0);
+}
+
+TEST_F(PluginTest, memoryLimit)
+{
+    configure();
+    auto *limits = rawpl->limits();
+    ASSERT_NE(limits, nullptr);
+    EXPECT_GT(limits->memoryUsed, 0U);
+    EXPECT_GE(limits->memoryPeak, limits->memoryUsed);
+
+    limits->memoryLimit = limits->memoryUsed + 1024 * 1024;
+    EXPECT_ANY_THROW(lua->script(R"lua(
+        _G.big = string.rep("a", 8 * 1024 * 1024)
+    )lua"));
+    EXPECT_GT(limits->failedAllocations, 0U);
+    EXPECT_LE(limits->memoryUsed, limits->memoryLimit);
+
+    // small allocations still succeed
+    lua->script(R"lua(
+        _G.small = string.rep("a", 1024)
+    )lua");
+    EXPECT_EQ(lua->get<std::string>("small").size(), 1024U);
+}
+
+TEST_F(PluginTest, messagesReceived)
+{
+    configure();
+    lua->script(R"lua(
+        _G.batches = 0
+        _G.texts = {}
+        _G.dropped = 0
+        c2.register_callback(c2.EventType.MessagesReceived, function(ev)
+            _G.batches = _G.batches + 1
+            _G.dropped = _G.dropped + ev.dropped
+            for _, msg in ipairs(ev.messages) do
+                table.insert(_G.texts, msg:get_login_name() .. ": " ..
+                    msg:get_text() .. " in " .. msg:get_channel():get_name())
+            end
+        end)
+    )lua");
+
+    auto makeMessage = [](const QString &login, const QString &text) {
+        auto msg = std::make_shared<Message>();
+        msg->loginName = login;
+        msg->messageText = text;
+        return msg;
+    };
+
+    app->plugins.onMessageReceived(channel, makeMessage("pajlada", "hello"));
+    app->plugins.onMessageReceived(channel, makeMessage("mm2pl", "hi"));
+    EXPECT_EQ(lua->get<int>("batches"), 0);
+
+    // both messages are delivered in one batch
+    app->plugins.deliverPendingMessages();
+    EXPECT_EQ(lua->get<int>("batches"), 1);
+    sol::table texts = (*lua)["texts"];
+    ASSERT_EQ(texts.size(), 2U);
+    EXPECT_EQ(texts.get<QString>(1), "pajlada: hello in mm2pl");
+    EXPECT_EQ(texts.get<QString>(2), "mm2pl: hi in mm2pl");
+    EXPECT_TRUE(rawpl->pendingMessages.empty());
+}
+
+TEST_F(PluginTest, messagesReceivedBackpressure)
+{
+    configure();
+    lua->script(R"lua(
+        _G.sizes = {}
+        _G.dropped = 0
+        _G.first = nil
+        c2.register_callback(c2.EventType.MessagesReceived, function(ev)
+            table.insert(_G.sizes, #ev.messages)
+            _G.dropped = _G.dropped + ev.dropped
+            _G.first = _G.first or ev.messages[1]:get_text()
+        end)
+    )lua");
+
+    constexpr size_t extra = 10;
+    for (size_t i = 0; i < PluginController::MAX_PENDING_MESSAGES + extra; i++)
+    {
+        auto msg = std::make_shared<Message>();
+        msg->messageText = QString::number(i);
+        app->plugins.onMessageReceived(channel, msg);
+    }
+    EXPECT_EQ(rawpl->pendingMessages.size(),
+              PluginController::MAX_PENDING_MESSAGES);
+    EXPECT_EQ(rawpl->totalDroppedMessages, extra);
+
+    // the oldest messages were dropped
+    while (!rawpl->pendingMessages.empty())
+    {
+        app->plugins.deliverPendingMessages();
+    }
+    sol::table sizes = (*lua)["sizes"];
+    ASSERT_EQ(sizes.size(), PluginController::MAX_PENDING_MESSAGES /
+                                PluginController::MAX_BATCH_SIZE);
+    EXPECT_EQ(sizes.get<size_t>(1), PluginController::MAX_BATCH_SIZE);
+    EXPECT_EQ(lua->get<size_t>("dropped"), extra);
+    EXPECT_EQ(lua->get<QString>("first"), QString::number(extra));
+}
+
+TEST_F(PluginTest, messagesReceivedFromIrc)
+{
+    configure();
+    lua->script(R"lua(
+        _G.texts = {}
+        c2.register_callback(c2.EventType.MessagesReceived, function(ev)
+            for _, msg in ipairs(ev.messages) do
+                table.insert(_G.texts, msg:get_text())
+            end
+        end)
+    )lua");
+
+    auto chan = std::make_shared<TwitchChannel>("pajlada");
+    auto *ircMessage = Communi::IrcMessage::fromData(
+        "@badge-info=;badges=;color=#EBA2C0;display-name=jammehcow;emotes=;"
+        "first-msg=0;flags=;id=9c2dd916-5a6d-4c1f-9fe7-a081b62a9c6b;mod=0;"
+        "returning-chatter=0;room-id=11148817;subscriber=0;"
+        "tmi-sent-ts=1662201093248;turbo=0;user-id=82674227;user-type= "
+        ":jammehcow!jammehcow@jammehcow.tmi.twitch.tv PRIVMSG #pajlada "
+        ":hello plugins",
+        nullptr);
+    ASSERT_NE(ircMessage, nullptr);
+
+    // The channel is its own sink, so this is a live message
+    IrcMessageHandler::parseMessageInto(ircMessage, *chan, chan.get());
+    delete ircMessage;
+
+    ASSERT_EQ(chan->getMessageSnapshot().size(), 1U);
+    ASSERT_EQ(rawpl->pendingMessages.size(), 1U);
+
+    app->plugins.deliverPendingMessages();
+    sol::table texts = (*lua)["texts"];
+    ASSERT_EQ(texts.size(), 1U);
+    EXPECT_EQ(texts.get<QString>(1), "hello plugins");
+}
+
 TEST_F(PluginTest, testTcpWebSocket)
 {
     configure({PluginPermission{{{"type", "Network"}}}});
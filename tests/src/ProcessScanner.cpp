@@ -0,0 +1,111 @@
+#include "util/ProcessScanner.hpp"
+
+#include "Test.hpp"
+
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+
+using namespace chatterino;
+
+namespace {
+
+class ProcessScannerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_TRUE(this->dir.isValid());
+        // not a process
+        ASSERT_TRUE(QDir(this->dir.path()).mkdir("self"));
+    }
+
+    void addProcess(qint64 pid, const QByteArray &comm)
+    {
+        QDir root(this->dir.path());
+        auto name = QString::number(pid);
+        ASSERT_TRUE(root.mkdir(name));
+        QFile file(root.filePath(name + "/comm"));
+        ASSERT_TRUE(file.open(QFile::WriteOnly));
+        file.write(comm + '\n');
+    }
+
+    void removeProcess(qint64 pid)
+    {
+        QDir processDir(this->dir.filePath(QString::number(pid)));
+        ASSERT_TRUE(processDir.removeRecursively());
+    }
+
+    QTemporaryDir dir;
+};
+
+}  // namespace
+
+TEST_F(ProcessScannerTest, Matches)
+{
+    ProcessScanner scanner({"obs", "Streamlabs Desktop"}, this->dir.path());
+    EXPECT_FALSE(scanner.isAnyRunning());
+
+    this->addProcess(1, "systemd");
+    this->addProcess(42, "obs-ffmpeg-mux");
+    EXPECT_FALSE(scanner.isAnyRunning());
+    EXPECT_EQ(scanner.knownProcesses(), 2);
+
+    this->addProcess(100, "OBS");
+    EXPECT_TRUE(scanner.isAnyRunning());
+
+    this->removeProcess(100);
+    EXPECT_FALSE(scanner.isAnyRunning());
+    EXPECT_EQ(scanner.knownProcesses(), 2);
+
+    // comm is truncated to 15 characters
+    this->addProcess(200, "Streamlabs Desk");
+    EXPECT_TRUE(scanner.isAnyRunning());
+}
+
+TEST_F(ProcessScannerTest, CachesNames)
+{
+    ProcessScanner scanner({"obs"}, this->dir.path());
+
+    this->addProcess(7, "obs");
+    EXPECT_TRUE(scanner.isAnyRunning());
+
+    // The name of a known PID isn't read again
+    QFile file(this->dir.filePath("7/comm"));
+    ASSERT_TRUE(file.open(QFile::WriteOnly | QFile::Truncate));
+    file.write("bash\n");
+    file.close();
+    EXPECT_TRUE(scanner.isAnyRunning());
+
+    // Once the PID is gone, it's forgotten
+    this->removeProcess(7);
+    EXPECT_FALSE(scanner.isAnyRunning());
+    this->addProcess(7, "bash");
+    EXPECT_FALSE(scanner.isAnyRunning());
+}
+
+TEST_F(ProcessScannerTest, RechecksNewProcesses)
+{
+    ProcessScanner scanner({"obs"}, this->dir.path());
+    auto rename = [this](qint64 pid, const QByteArray &comm) {
+        QFile file(this->dir.filePath(QString::number(pid) + "/comm"));
+        ASSERT_TRUE(file.open(QFile::WriteOnly | QFile::Truncate));
+        file.write(comm + '\n');
+    };
+
+    // Seen between fork and exec, it still has the name of its parent
+    this->addProcess(9, "bash");
+    EXPECT_FALSE(scanner.isAnyRunning());
+    rename(9, "obs");
+    EXPECT_TRUE(scanner.isAnyRunning());
+    this->removeProcess(9);
+
+    // Processes that don't match are only read in the first few scans
+    this->addProcess(10, "bash");
+    for (int i = 0; i <= ProcessScanner::RECHECK_SCANS; i++)
+    {
+        EXPECT_FALSE(scanner.isAnyRunning());
+    }
+    rename(10, "obs");
+    EXPECT_FALSE(scanner.isAnyRunning());
+}
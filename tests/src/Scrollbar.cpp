@@ -171,3 +171,63 @@ TEST(Scrollbar, AddHighlightsAtStart)
         EXPECT_EQ(highlights[9].getColor().red(), 1);
     }
 }
+
+TEST(Scrollbar, Minimap)
+{
+    MockApplication mockApplication;
+
+    Scrollbar scrollbar(10, nullptr);
+    scrollbar.resize(16, 100);
+
+    auto red = std::make_shared<QColor>(255, 0, 0);
+    auto green = std::make_shared<QColor>(0, 255, 0);
+    for (int i = 0; i < 10; ++i)
+    {
+        if (i == 2)
+        {
+            scrollbar.addHighlight({red});
+        }
+        else if (i == 5)
+        {
+            scrollbar.addHighlight({green, ScrollbarHighlight::Line});
+        }
+        else
+        {
+            scrollbar.addHighlight({});
+        }
+    }
+
+    // 10px per highlight
+    std::vector<Scrollbar::MinimapRun> expected{
+        {.y = 50, .height = 1, .color = green->rgb(), .fullWidth = true},
+        {.y = 20, .height = 10, .color = red->rgb(), .fullWidth = false},
+        {.y = 50, .height = 1, .color = green->rgb(), .fullWidth = false},
+    };
+    EXPECT_EQ(scrollbar.getMinimap(), expected);
+
+    // Evicting the first highlight moves everything up
+    scrollbar.addHighlight({});
+    expected = {
+        {.y = 40, .height = 1, .color = green->rgb(), .fullWidth = true},
+        {.y = 10, .height = 10, .color = red->rgb(), .fullWidth = false},
+        {.y = 40, .height = 1, .color = green->rgb(), .fullWidth = false},
+    };
+    EXPECT_EQ(scrollbar.getMinimap(), expected);
+
+    // Replacing the red highlight removes it
+    scrollbar.replaceHighlight(1, {});
+    expected = {
+        {.y = 40, .height = 1, .color = green->rgb(), .fullWidth = true},
+        {.y = 40, .height = 1, .color = green->rgb(), .fullWidth = false},
+    };
+    EXPECT_EQ(scrollbar.getMinimap(), expected);
+
+    // Highlights added at the start are placed before the others
+    scrollbar.clearHighlights();
+    scrollbar.addHighlight({});
+    scrollbar.addHighlightsAtStart({{red}});
+    expected = {
+        {.y = 0, .height = 50, .color = red->rgb(), .fullWidth = false},
+    };
+    EXPECT_EQ(scrollbar.getMinimap(), expected);
+}
@@ -0,0 +1,109 @@
+#include "singletons/helper/SettingsJournal.hpp"
+
+#include "Test.hpp"
+#include "util/AsyncFileWriter.hpp"
+
+#include <QFile>
+#include <QTemporaryDir>
+
+#include <map>
+
+using namespace chatterino;
+
+namespace {
+
+std::map<std::string, int> replay(const SettingsJournal &journal,
+                                  int64_t minGeneration = 0)
+{
+    std::map<std::string, int> values;
+    journal.replay(minGeneration, [&](const std::string &path,
+                                      const rapidjson::Value &value) {
+        ASSERT_TRUE(value.IsInt());
+        values[path] = value.GetInt();
+    });
+    return values;
+}
+
+}  // namespace
+
+TEST(SettingsJournal, replay)
+{
+    QTemporaryDir dir;
+    auto path = dir.filePath("settings.journal");
+
+    {
+        SettingsJournal journal(path);
+        ASSERT_EQ(journal.size(), 0);
+
+        auto entries = SettingsJournal::encode("/a", rapidjson::Value(1));
+        entries += SettingsJournal::encode("/b", rapidjson::Value(2));
+        journal.append(entries);
+        journal.append(SettingsJournal::encode("/a", rapidjson::Value(3)));
+        ASSERT_GT(journal.size(), 0);
+        AsyncFileWriter::instance().waitForIdle();
+
+        // Later entries override earlier ones
+        std::map<std::string, int> expected{{"/a", 3}, {"/b", 2}};
+        ASSERT_EQ(replay(journal), expected);
+    }
+
+    SettingsJournal journal(path);
+    ASSERT_EQ(QFile(path).size(), journal.size());
+    ASSERT_EQ(replay(journal).size(), 2);
+
+    // All entries are from generation 0
+    journal.removeOlderThan(1);
+    ASSERT_EQ(journal.size(), 0);
+    ASSERT_FALSE(QFile::exists(path));
+    ASSERT_TRUE(replay(journal).empty());
+}
+
+TEST(SettingsJournal, incompleteEntry)
+{
+    QTemporaryDir dir;
+    auto path = dir.filePath("settings.journal");
+
+    {
+        QFile file(path);
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+        file.write(SettingsJournal::encode("/a", rapidjson::Value(1)));
+        file.write("not json\n");
+        file.write(R"({"path": "/b", "val)");
+    }
+
+    SettingsJournal journal(path);
+    // The incomplete entry is dropped, the invalid one is skipped
+    std::map<std::string, int> expected{{"/a", 1}};
+    ASSERT_EQ(replay(journal), expected);
+
+    journal.append(SettingsJournal::encode("/b", rapidjson::Value(2)));
+    AsyncFileWriter::instance().waitForIdle();
+    expected["/b"] = 2;
+    ASSERT_EQ(replay(journal), expected);
+}
+
+TEST(SettingsJournal, skipsOlderGenerations)
+{
+    QTemporaryDir dir;
+    SettingsJournal journal(dir.filePath("settings.journal"));
+
+    // Entries written before settings.json was saved...
+    journal.append(SettingsJournal::encode("/a", rapidjson::Value(1), 1));
+    journal.append(SettingsJournal::encode("/b", rapidjson::Value(2), 1));
+    // ...and after it
+    journal.append(SettingsJournal::encode("/a", rapidjson::Value(3), 2));
+    AsyncFileWriter::instance().waitForIdle();
+
+    std::map<std::string, int> all{{"/a", 3}, {"/b", 2}};
+    ASSERT_EQ(replay(journal, 1), all);
+
+    // We crashed after saving settings.json with generation 2, but before the
+    // journal was cleared
+    std::map<std::string, int> newer{{"/a", 3}};
+    ASSERT_EQ(replay(journal, 2), newer);
+
+    // Once settings.json with generation 2 was written
+    journal.removeOlderThan(2);
+    ASSERT_EQ(replay(journal), newer);
+    ASSERT_EQ(journal.size(), QFile(dir.filePath("settings.journal")).size());
+}
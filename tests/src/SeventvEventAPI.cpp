@@ -1,5 +1,6 @@
 #include "providers/seventv/SeventvEventAPI.hpp"
 
+#include "mocks/BaseApplication.hpp"
 #include "providers/seventv/eventapi/Client.hpp"
 #include "providers/seventv/eventapi/Dispatch.hpp"
 #include "providers/seventv/eventapi/Message.hpp"
@@ -20,6 +21,7 @@ const QString TARGET_USER_ID = "60b39e943e203cc169dfc106";
 TEST(SeventvEventAPI, AllEvents)
 {
     const QString host("wss://127.0.0.1:9050/liveupdates/seventv/all-events");
+    mock::BaseApplication app;
     SeventvEventAPI eventAPI(host, std::chrono::milliseconds(1000));
     eventAPI.start();
 
@@ -95,6 +97,7 @@ TEST(SeventvEventAPI, AllEvents)
 TEST(SeventvEventAPI, NoHeartbeat)
 {
     const QString host("wss://127.0.0.1:9050/liveupdates/seventv/no-heartbeat");
+    mock::BaseApplication app;
     SeventvEventAPI eventApi(host, std::chrono::milliseconds(1000));
     eventApi.start();
 
@@ -0,0 +1,52 @@
+#include "debug/StartupProfiler.hpp"
+
+#include "Test.hpp"
+
+#include <algorithm>
+
+using namespace chatterino;
+
+TEST(StartupProfiler, report)
+{
+    std::vector<StartupStepRecord> steps{
+        {
+            .name = "Paths",
+            .thread = "GUI",
+            .startNs = 1'000'000,
+            .durationNs = 2'500'000,
+        },
+        {
+            .name = "Emojis",
+            .thread = "Worker",
+            .startNs = 4'000'000,
+            .durationNs = 30'000'000,
+        },
+    };
+
+    auto lines = startup::report(steps, 51'000'000).split('\n');
+    ASSERT_EQ(lines.size(), 4);
+    // Times are relative to the first step
+    ASSERT_EQ(lines[0], "Startup profile (first paint after 50.0 ms)");
+    ASSERT_TRUE(lines[2].contains("0.0 ms"));
+    ASSERT_TRUE(lines[2].contains("2.5 ms"));
+    ASSERT_TRUE(lines[2].endsWith("GUI           Paths"));
+    ASSERT_TRUE(lines[3].contains("3.0 ms"));
+    ASSERT_TRUE(lines[3].contains("30.0 ms"));
+    ASSERT_TRUE(lines[3].endsWith("Emojis"));
+
+    ASSERT_EQ(startup::report({}, 0), "No startup steps recorded");
+}
+
+TEST(StartupProfiler, steps)
+{
+    auto before = startup::steps().size();
+    {
+        StartupStep outer("outer");
+        StartupStep inner("inner");
+    }
+
+    auto steps = startup::steps();
+    ASSERT_EQ(steps.size(), before + 2);
+    // Ordered by their start, although the inner step finished first
+    ASSERT_TRUE(std::ranges::is_sorted(steps, {}, &StartupStepRecord::startNs));
+}
@@ -0,0 +1,88 @@
+#include "debug/Trace.hpp"
+
+#include "Test.hpp"
+
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <thread>
+
+using namespace chatterino;
+
+namespace {
+
+QJsonArray completeEvents()
+{
+    auto doc = QJsonDocument::fromJson(trace::toChromeTraceJson());
+    EXPECT_TRUE(doc.isObject());
+
+    QJsonArray events;
+    for (auto ev : doc.object()["traceEvents"].toArray())
+    {
+        if (ev.toObject()["ph"].toString() == "X")
+        {
+            events.append(ev);
+        }
+    }
+    return events;
+}
+
+}  // namespace
+
+TEST(Trace, ZonesAreRecorded)
+{
+    trace::clear();
+
+    {
+        TraceZone zone("outer", "test");
+        TraceZone inner("inner", "test");
+    }
+
+    auto events = completeEvents();
+    ASSERT_EQ(events.size(), 2);
+
+    // the inner zone finishes first
+    auto inner = events[0].toObject();
+    auto outer = events[1].toObject();
+    EXPECT_EQ(inner["name"].toString(), "inner");
+    EXPECT_EQ(outer["name"].toString(), "outer");
+    EXPECT_EQ(outer["cat"].toString(), "test");
+    EXPECT_LE(outer["ts"].toDouble(), inner["ts"].toDouble());
+    EXPECT_GE(outer["dur"].toDouble(), inner["dur"].toDouble());
+}
+
+TEST(Trace, ThreadsHaveSeparateIDs)
+{
+    trace::clear();
+
+    trace::record("main", "test", trace::now(), 1);
+    std::thread([] {
+        trace::record("worker", "test", trace::now(), 1);
+    }).join();
+
+    auto events = completeEvents();
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_NE(events[0].toObject()["tid"].toInteger(),
+              events[1].toObject()["tid"].toInteger());
+}
+
+TEST(Trace, RingBufferKeepsNewest)
+{
+    trace::clear();
+
+    for (size_t i = 0; i < trace::BUFFER_CAPACITY + 10; i++)
+    {
+        trace::record(i < 10 ? "old" : "new", "test", trace::now(), 0);
+    }
+
+    auto events = completeEvents();
+    ASSERT_EQ(events.size(), static_cast<qsizetype>(trace::BUFFER_CAPACITY));
+    for (auto ev : events)
+    {
+        ASSERT_EQ(ev.toObject()["name"].toString(), "new");
+    }
+
+    trace::clear();
+    EXPECT_TRUE(completeEvents().isEmpty());
+}
@@ -0,0 +1,316 @@
+#include "controllers/userdata/UserMetadataStore.hpp"
+
+#include "Test.hpp"
+
+#include <QDataStream>
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QTemporaryDir>
+
+using namespace chatterino;
+
+namespace {
+
+UserMetadata makeUser(const QString &id, const QString &login)
+{
+    return {
+        .id = id,
+        .login = login,
+        .displayName = login,
+        .profilePictureUrl = {},
+        .color = QColor("#ff0000"),
+        .data = {},
+        .lastSeen = QDateTime::currentSecsSinceEpoch(),
+        .lastResolved = QDateTime::currentSecsSinceEpoch() - 60,
+    };
+}
+
+void set(UserMetadataStore &store, const UserMetadata &user)
+{
+    store.update(user.id, [&](UserMetadata &stored) {
+        stored = user;
+    });
+}
+
+}  // namespace
+
+TEST(UserMetadataStore, persists)
+{
+    QTemporaryDir dir;
+    auto path = dir.filePath("users.db");
+
+    auto pajlada = makeUser("11148817", "pajlada");
+    pajlada.data.notes = "notes";
+    pajlada.data.color = QColor("#00ff00");
+    {
+        UserMetadataStore store(path);
+        ASSERT_EQ(store.size(), 0);
+
+        set(store, pajlada);
+        set(store, makeUser("2", "forsen"));
+        ASSERT_TRUE(store.hasPendingWrites());
+        store.flush();
+        ASSERT_FALSE(store.hasPendingWrites());
+        ASSERT_EQ(store.fileRecords(), 2);
+
+        // Only the changed record is appended
+        store.update("2", [](UserMetadata &user) {
+            user.displayName = "Forsen";
+        });
+        store.flush();
+        ASSERT_EQ(store.fileRecords(), 3);
+    }
+
+    UserMetadataStore store(path);
+    ASSERT_EQ(store.size(), 2);
+    ASSERT_EQ(store.fileRecords(), 3);
+    ASSERT_EQ(store.get("11148817"), pajlada);
+    ASSERT_EQ(store.getByLogin("FORSEN")->displayName, "Forsen");
+    ASSERT_EQ(store.get("3"), std::nullopt);
+}
+
+TEST(UserMetadataStore, update)
+{
+    QTemporaryDir dir;
+    UserMetadataStore store(dir.filePath("users.db"));
+
+    // Empty records aren't stored
+    ASSERT_FALSE(store.update("1", [](UserMetadata &) {}));
+    ASSERT_FALSE(store.update("", [](UserMetadata &user) {
+        user.login = "nobody";
+    }));
+    ASSERT_EQ(store.size(), 0);
+
+    ASSERT_TRUE(store.update("1", [](UserMetadata &user) {
+        user.login = "pajlada";
+    }));
+    ASSERT_FALSE(store.update("1", [](UserMetadata &user) {
+        user.login = "pajlada";
+    }));
+
+    // Renames update the login index
+    ASSERT_TRUE(store.update("1", [](UserMetadata &user) {
+        user.login = "pajlada2";
+    }));
+    ASSERT_EQ(store.getByLogin("pajlada"), std::nullopt);
+    ASSERT_EQ(store.getByLogin("pajlada2")->id, "1");
+
+    // Clearing all fields removes the user
+    ASSERT_TRUE(store.update("1", [](UserMetadata &user) {
+        user = {};
+    }));
+    ASSERT_EQ(store.size(), 0);
+    ASSERT_EQ(store.getByLogin("pajlada2"), std::nullopt);
+}
+
+TEST(UserMetadataStore, removalPersists)
+{
+    QTemporaryDir dir;
+    auto path = dir.filePath("users.db");
+    {
+        UserMetadataStore store(path);
+        set(store, makeUser("1", "pajlada"));
+        store.flush();
+        store.update("1", [](UserMetadata &user) {
+            user = {};
+        });
+    }
+
+    UserMetadataStore store(path);
+    ASSERT_EQ(store.size(), 0);
+    ASSERT_EQ(store.fileRecords(), 2);
+}
+
+TEST(UserMetadataStore, truncatedRecord)
+{
+    QTemporaryDir dir;
+    auto path = dir.filePath("users.db");
+    {
+        UserMetadataStore store(path);
+        set(store, makeUser("1", "pajlada"));
+        store.flush();
+        set(store, makeUser("2", "forsen"));
+    }
+
+    // Simulate a crash while appending the second record
+    {
+        QFile file(path);
+        ASSERT_TRUE(file.open(QIODevice::ReadWrite));
+        ASSERT_TRUE(file.resize(file.size() - 3));
+    }
+
+    {
+        UserMetadataStore store(path);
+        ASSERT_EQ(store.size(), 1);
+        ASSERT_TRUE(store.get("1").has_value());
+        ASSERT_TRUE(QFile::exists(path + ".bak"));
+
+        // New records are appended after the last complete one
+        set(store, makeUser("3", "zneix"));
+    }
+
+    UserMetadataStore store(path);
+    ASSERT_EQ(store.size(), 2);
+    ASSERT_TRUE(store.get("3").has_value());
+}
+
+TEST(UserMetadataStore, damagedRecord)
+{
+    QTemporaryDir dir;
+    auto path = dir.filePath("users.db");
+    {
+        UserMetadataStore store(path);
+        set(store, makeUser("1", "pajlada"));
+        set(store, makeUser("2", "forsen"));
+        store.flush();
+        set(store, makeUser("3", "zneix"));
+    }
+
+    // Break the ID of the first record (header: 8 bytes, size: 4 bytes)
+    qint64 fileSize = 0;
+    {
+        QFile file(path);
+        ASSERT_TRUE(file.open(QIODevice::ReadWrite));
+        fileSize = file.size();
+        ASSERT_TRUE(file.seek(12));
+        file.write(QByteArray("\x7f\xff\xff\xf0", 4));
+    }
+
+    // Only the damaged record is skipped
+    UserMetadataStore store(path);
+    ASSERT_EQ(store.size(), 2);
+    ASSERT_EQ(store.fileRecords(), 3);
+    ASSERT_EQ(QFileInfo(path).size(), fileSize);
+}
+
+TEST(UserMetadataStore, corruptSize)
+{
+    QTemporaryDir dir;
+    auto path = dir.filePath("users.db");
+    {
+        UserMetadataStore store(path);
+        set(store, makeUser("1", "pajlada"));
+        store.flush();
+        set(store, makeUser("2", "forsen"));
+        set(store, makeUser("3", "zneix"));
+    }
+
+    // Break the size of the second record
+    QByteArray original;
+    {
+        QFile file(path);
+        ASSERT_TRUE(file.open(QIODevice::ReadWrite));
+
+        QDataStream stream(&file);
+        ASSERT_TRUE(file.seek(8));
+        quint32 size = 0;
+        stream >> size;
+        ASSERT_TRUE(file.seek(8 + 4 + size));
+        stream << quint32{0xfffffff0};
+        ASSERT_TRUE(file.seek(0));
+        original = file.readAll();
+    }
+
+    {
+        UserMetadataStore store(path);
+        ASSERT_EQ(store.size(), 1);
+        ASSERT_TRUE(store.get("1").has_value());
+    }
+
+    // The corrupt file is kept as a backup
+    QFile backup(path + ".bak");
+    ASSERT_TRUE(backup.open(QIODevice::ReadOnly));
+    ASSERT_EQ(backup.readAll(), original);
+
+    UserMetadataStore store(path);
+    ASSERT_EQ(store.size(), 1);
+    ASSERT_EQ(store.fileRecords(), 1);
+}
+
+TEST(UserMetadataStore, recordsWithoutLastResolved)
+{
+    QTemporaryDir dir;
+    auto path = dir.filePath("users.db");
+
+    // A record as written before lastResolved was added
+    {
+        QFile file(path);
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+        QDataStream stream(&file);
+        stream.setVersion(QDataStream::Qt_6_0);
+
+        QByteArray payload;
+        QDataStream fields(&payload, QIODevice::WriteOnly);
+        fields.setVersion(QDataStream::Qt_6_0);
+        fields << QString("1") << QString("pajlada") << QString("pajlada")
+               << QString() << false << QRgb{} << false << QRgb{} << QString()
+               << qint64{1234};
+
+        stream << quint32{0x43485553} << quint32{1}
+               << static_cast<quint32>(payload.size());
+        stream.writeRawData(payload.constData(),
+                            static_cast<int>(payload.size()));
+    }
+
+    UserMetadataStore store(path);
+    ASSERT_EQ(store.size(), 1);
+    ASSERT_EQ(store.get("1")->lastSeen, 1234);
+    ASSERT_EQ(store.get("1")->lastResolved, 0);
+}
+
+TEST(UserMetadataStore, compact)
+{
+    QTemporaryDir dir;
+    auto path = dir.filePath("users.db");
+
+    auto expired = makeUser("2", "forsen");
+    expired.lastSeen -= UserMetadataStore::EXPIRY_SECONDS + 60;
+    auto customized = expired;
+    customized.id = "3";
+    customized.login = "zneix";
+    customized.data.notes = "kept";
+
+    UserMetadataStore store(path);
+    set(store, makeUser("1", "pajlada"));
+    set(store, expired);
+    set(store, customized);
+    for (int i = 0; i < 10; i++)
+    {
+        store.update("1", [&](UserMetadata &user) {
+            user.displayName = QString::number(i);
+        });
+        store.flush();
+    }
+    ASSERT_EQ(store.fileRecords(), 12);
+
+    store.compact();
+    ASSERT_EQ(store.size(), 2);
+    ASSERT_EQ(store.fileRecords(), 2);
+    ASSERT_EQ(store.get("2"), std::nullopt);
+    ASSERT_EQ(store.getByLogin("forsen"), std::nullopt);
+
+    UserMetadataStore reopened(path);
+    ASSERT_EQ(reopened.size(), 2);
+    ASSERT_EQ(reopened.get("1")->displayName, "9");
+    ASSERT_EQ(reopened.get("3")->data.notes, "kept");
+}
+
+TEST(UserMetadataStore, unknownFormat)
+{
+    QTemporaryDir dir;
+    auto path = dir.filePath("users.db");
+    {
+        QFile file(path);
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+        file.write("{\"users\": {}}");
+    }
+
+    UserMetadataStore store(path);
+    ASSERT_EQ(store.size(), 0);
+    ASSERT_TRUE(QFile::exists(path + ".bak"));
+
+    set(store, makeUser("1", "pajlada"));
+    store.flush();
+    ASSERT_EQ(UserMetadataStore(path).size(), 1);
+}